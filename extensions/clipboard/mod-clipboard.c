@@ -71,7 +71,7 @@ static Bounce Clipboard_Actor(
         INCLUDE_PARAMS_OF_READ;
         UNUSED(ARG(source));  // implied by `port`
 
-        if (REF(part) or REF(seek))
+        if (REF(part) or REF(seek) or REF(into) or REF(mapped))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(REF(string));  // handled in dispatcher
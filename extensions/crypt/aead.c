@@ -0,0 +1,716 @@
+//
+//  File: %aead.c
+//  Summary: "AEAD ciphers (AES-GCM, ChaCha20-Poly1305) for the Crypt module"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The mbedTLS subset in this tree was trimmed to what the old TLS 1.0-1.2
+// CBC ciphersuites needed, so it has no %gcm.c, %chachapoly.c or %aesni.c.
+// Rather than bring those (and the configuration they drag in) back, this
+// file implements just the two AEAD constructions that modern TLS uses:
+//
+// * AES-GCM (NIST SP 800-38D), using mbedTLS's AES key schedule.  The block
+//   encryption runs on AES-NI when the CPU has it (detected at runtime), and
+//   GHASH uses the 4-bit table method that mbedTLS's %gcm.c also uses.
+//
+// * ChaCha20-Poly1305 (RFC 8439).  ChaCha20 is fast in portable C, and the
+//   Poly1305 here is the well known 26-bit limb ("donna") formulation.
+//
+// Only the 12-byte nonces used by TLS are supported.  Tags are checked in
+// constant time, and open does not write any plaintext unless the tag is
+// good.
+//
+// !!! ARMv8 has AES instructions too, but there is no way to test them in
+// the current build matrix, so ARM uses the mbedTLS software AES for now.
+//
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mbedtls/aes.h"
+
+#include "aead.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #if defined(__GNUC__) || defined(__clang__)
+    #include <immintrin.h>
+    #define AEAD_AESNI 1
+    #define AEAD_AESNI_TARGET __attribute__((target("aes,sse2")))
+  #elif defined(_MSC_VER)
+    #include <intrin.h>
+    #define AEAD_AESNI 1
+    #define AEAD_AESNI_TARGET
+  #endif
+#endif
+
+
+static uint32_t Load_Le32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8)
+        | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void Store_Le32(unsigned char *p, uint32_t u) {
+    p[0] = (unsigned char)u;
+    p[1] = (unsigned char)(u >> 8);
+    p[2] = (unsigned char)(u >> 16);
+    p[3] = (unsigned char)(u >> 24);
+}
+
+static uint64_t Load_Be64(const unsigned char *p) {
+    uint64_t u = 0;
+    int i;
+    for (i = 0; i < 8; ++i)
+        u = (u << 8) | p[i];
+    return u;
+}
+
+static void Store_Be64(unsigned char *p, uint64_t u) {
+    int i;
+    for (i = 7; i >= 0; --i) {
+        p[i] = (unsigned char)u;
+        u >>= 8;
+    }
+}
+
+static int Tags_Equal(const unsigned char *a, const unsigned char *b) {
+    unsigned char diff = 0;
+    int i;
+    for (i = 0; i < AEAD_TAG_SIZE; ++i)
+        diff |= a[i] ^ b[i];
+    return diff == 0;
+}
+
+
+//=//// AES HARDWARE DETECTION ////////////////////////////////////////////=//
+
+#if defined(AEAD_AESNI)
+
+static int Cpu_Has_Aesni(void) {
+  #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 25)) != 0;
+  #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("aes") != 0;
+  #endif
+}
+
+// mbedTLS's software key schedule stores each round key as little-endian
+// words, which on x86 is the same byte layout AESENC expects.  (This is what
+// mbedTLS's own %aesni.c relies on as well.)
+//
+AEAD_AESNI_TARGET
+static void Aes_Ni_Encrypt_Blocks(
+    const unsigned char *rk,
+    int nr,
+    const unsigned char *in,
+    unsigned char *out,
+    size_t blocks
+){
+    for (; blocks >= 4; blocks -= 4, in += 64, out += 64) {
+        __m128i k = _mm_loadu_si128((const __m128i*)rk);
+        __m128i b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)in), k);
+        __m128i b1 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)(in + 16)), k
+        );
+        __m128i b2 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)(in + 32)), k
+        );
+        __m128i b3 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)(in + 48)), k
+        );
+        int r;
+        for (r = 1; r < nr; ++r) {
+            k = _mm_loadu_si128((const __m128i*)(rk + 16 * r));
+            b0 = _mm_aesenc_si128(b0, k);
+            b1 = _mm_aesenc_si128(b1, k);
+            b2 = _mm_aesenc_si128(b2, k);
+            b3 = _mm_aesenc_si128(b3, k);
+        }
+        k = _mm_loadu_si128((const __m128i*)(rk + 16 * nr));
+        _mm_storeu_si128((__m128i*)out, _mm_aesenclast_si128(b0, k));
+        _mm_storeu_si128((__m128i*)(out + 16), _mm_aesenclast_si128(b1, k));
+        _mm_storeu_si128((__m128i*)(out + 32), _mm_aesenclast_si128(b2, k));
+        _mm_storeu_si128((__m128i*)(out + 48), _mm_aesenclast_si128(b3, k));
+    }
+    for (; blocks > 0; --blocks, in += 16, out += 16) {
+        __m128i b = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)in),
+            _mm_loadu_si128((const __m128i*)rk)
+        );
+        int r;
+        for (r = 1; r < nr; ++r)
+            b = _mm_aesenc_si128(
+                b, _mm_loadu_si128((const __m128i*)(rk + 16 * r))
+            );
+        b = _mm_aesenclast_si128(
+            b, _mm_loadu_si128((const __m128i*)(rk + 16 * nr))
+        );
+        _mm_storeu_si128((__m128i*)out, b);
+    }
+}
+
+#endif
+
+static int aes_hardware = -1;  // -1 means not yet detected
+
+// Cached so the CPUID check only happens once.
+//
+int Aead_Has_Aes_Hardware(void) {
+    if (aes_hardware < 0) {
+      #if defined(AEAD_AESNI)
+        aes_hardware = Cpu_Has_Aesni();
+      #else
+        aes_hardware = 0;
+      #endif
+    }
+    return aes_hardware;
+}
+
+
+//=//// AES-GCM ///////////////////////////////////////////////////////////=//
+
+typedef struct {
+    mbedtls_aes_context aes;
+    int hardware;
+    uint64_t HL[16];  // GHASH multiplication table for H, low and high halves
+    uint64_t HH[16];
+    unsigned char y[16];  // running GHASH value
+} Gcm_State;
+
+// Reduction constants for the 4-bit table method
+//
+static const uint64_t Gcm_Last4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+static void Gcm_Encrypt_Blocks(
+    Gcm_State *gcm,
+    const unsigned char *in,
+    unsigned char *out,
+    size_t blocks
+){
+  #if defined(AEAD_AESNI)
+    if (gcm->hardware) {
+        Aes_Ni_Encrypt_Blocks(
+            (const unsigned char*)gcm->aes.MBEDTLS_PRIVATE(rk),
+            gcm->aes.MBEDTLS_PRIVATE(nr),
+            in,
+            out,
+            blocks
+        );
+        return;
+    }
+  #endif
+
+    for (; blocks > 0; --blocks, in += 16, out += 16)
+        mbedtls_aes_crypt_ecb(&gcm->aes, MBEDTLS_AES_ENCRYPT, in, out);
+}
+
+static int Gcm_Init(Gcm_State *gcm, const unsigned char *key, size_t key_size)
+{
+    mbedtls_aes_init(&gcm->aes);  // caller frees, even on error
+
+    if (key_size != 16 && key_size != 24 && key_size != 32)
+        return AEAD_ERR_BAD_KEY;
+
+    if (mbedtls_aes_setkey_enc(&gcm->aes, key, key_size * 8) != 0)
+        return AEAD_ERR_BAD_KEY;
+
+    gcm->hardware = Aead_Has_Aes_Hardware();
+
+    unsigned char h[16];
+    memset(h, 0, 16);
+    Gcm_Encrypt_Blocks(gcm, h, h, 1);
+
+    uint64_t vh = Load_Be64(h);
+    uint64_t vl = Load_Be64(h + 8);
+
+    gcm->HL[8] = vl;
+    gcm->HH[8] = vh;
+    gcm->HL[0] = 0;
+    gcm->HH[0] = 0;
+
+    int i;
+    for (i = 4; i > 0; i >>= 1) {
+        uint32_t T = (uint32_t)(vl & 1) * 0xe1000000U;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ ((uint64_t)T << 32);
+        gcm->HL[i] = vl;
+        gcm->HH[i] = vh;
+    }
+
+    for (i = 2; i <= 8; i *= 2) {
+        int j;
+        for (j = 1; j < i; ++j) {
+            gcm->HH[i + j] = gcm->HH[i] ^ gcm->HH[j];
+            gcm->HL[i + j] = gcm->HL[i] ^ gcm->HL[j];
+        }
+    }
+
+    memset(gcm->y, 0, 16);
+    return 0;
+}
+
+// y = y * H in GF(2^128)
+//
+static void Gcm_Mult(Gcm_State *gcm)
+{
+    const unsigned char *x = gcm->y;
+
+    unsigned char lo = x[15] & 0xf;
+    uint64_t zh = gcm->HH[lo];
+    uint64_t zl = gcm->HL[lo];
+
+    int i;
+    for (i = 15; i >= 0; --i) {
+        unsigned char rem;
+        lo = x[i] & 0xf;
+        unsigned char hi = (x[i] >> 4) & 0xf;
+
+        if (i != 15) {
+            rem = (unsigned char)zl & 0xf;
+            zl = (zh << 60) | (zl >> 4);
+            zh = zh >> 4;
+            zh ^= Gcm_Last4[rem] << 48;
+            zh ^= gcm->HH[lo];
+            zl ^= gcm->HL[lo];
+        }
+
+        rem = (unsigned char)zl & 0xf;
+        zl = (zh << 60) | (zl >> 4);
+        zh = zh >> 4;
+        zh ^= Gcm_Last4[rem] << 48;
+        zh ^= gcm->HH[hi];
+        zl ^= gcm->HL[hi];
+    }
+
+    Store_Be64(gcm->y, zh);
+    Store_Be64(gcm->y + 8, zl);
+}
+
+// Absorb data into GHASH, zero-padding the last partial block.
+//
+static void Gcm_Hash(Gcm_State *gcm, const unsigned char *p, size_t size)
+{
+    while (size > 0) {
+        size_t n = size < 16 ? size : 16;
+        size_t i;
+        for (i = 0; i < n; ++i)
+            gcm->y[i] ^= p[i];
+        Gcm_Mult(gcm);
+        p += n;
+        size -= n;
+    }
+}
+
+// GCM's counter only increments the low 32 bits (big-endian).
+//
+static void Gcm_Increment(unsigned char *counter) {
+    int i;
+    for (i = 15; i >= 12; --i)
+        if (++counter[i] != 0)
+            break;
+}
+
+static void Gcm_Ctr(
+    Gcm_State *gcm,
+    const unsigned char *nonce,
+    const unsigned char *in,
+    size_t size,
+    unsigned char *out
+){
+    unsigned char counters[8 * 16];
+    unsigned char stream[8 * 16];
+
+    unsigned char counter[16];
+    memcpy(counter, nonce, AEAD_NONCE_SIZE);
+    counter[12] = 0;
+    counter[13] = 0;
+    counter[14] = 0;
+    counter[15] = 2;  // 1 is J0, reserved for the tag
+
+    while (size > 0) {
+        size_t n = size < sizeof(stream) ? size : sizeof(stream);
+        size_t blocks = (n + 15) / 16;
+        size_t i;
+        for (i = 0; i < blocks; ++i) {
+            memcpy(counters + 16 * i, counter, 16);
+            Gcm_Increment(counter);
+        }
+        Gcm_Encrypt_Blocks(gcm, counters, stream, blocks);
+
+        for (i = 0; i < n; ++i)
+            out[i] = in[i] ^ stream[i];
+
+        in += n;
+        out += n;
+        size -= n;
+    }
+}
+
+static void Gcm_Tag(
+    Gcm_State *gcm,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *ciphertext, size_t size,
+    unsigned char *tag
+){
+    Gcm_Hash(gcm, aad, aad_size);
+    Gcm_Hash(gcm, ciphertext, size);
+
+    unsigned char lengths[16];
+    Store_Be64(lengths, (uint64_t)aad_size * 8);
+    Store_Be64(lengths + 8, (uint64_t)size * 8);
+    Gcm_Hash(gcm, lengths, 16);
+
+    unsigned char j0[16];
+    memcpy(j0, nonce, AEAD_NONCE_SIZE);
+    j0[12] = 0;
+    j0[13] = 0;
+    j0[14] = 0;
+    j0[15] = 1;
+    Gcm_Encrypt_Blocks(gcm, j0, j0, 1);
+
+    int i;
+    for (i = 0; i < 16; ++i)
+        tag[i] = gcm->y[i] ^ j0[i];
+}
+
+
+int Aead_Aes_Gcm_Seal(
+    const unsigned char *key, size_t key_size,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    unsigned char *tag
+){
+    Gcm_State gcm;
+    int ret = Gcm_Init(&gcm, key, key_size);
+    if (ret == 0) {
+        Gcm_Ctr(&gcm, nonce, in, size, out);
+        Gcm_Tag(&gcm, nonce, aad, aad_size, out, size, tag);
+    }
+    mbedtls_aes_free(&gcm.aes);
+    return ret;
+}
+
+
+int Aead_Aes_Gcm_Open(
+    const unsigned char *key, size_t key_size,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    const unsigned char *tag
+){
+    Gcm_State gcm;
+    int ret = Gcm_Init(&gcm, key, key_size);
+    if (ret == 0) {
+        unsigned char expected[AEAD_TAG_SIZE];
+        Gcm_Tag(&gcm, nonce, aad, aad_size, in, size, expected);
+        if (Tags_Equal(expected, tag))
+            Gcm_Ctr(&gcm, nonce, in, size, out);
+        else
+            ret = AEAD_ERR_AUTH_FAILED;
+    }
+    mbedtls_aes_free(&gcm.aes);
+    return ret;
+}
+
+
+//=//// CHACHA20 //////////////////////////////////////////////////////////=//
+
+#define CHACHA_ROTL(v,n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define CHACHA_QUARTER(a,b,c,d) \
+    a += b; d ^= a; d = CHACHA_ROTL(d, 16); \
+    c += d; b ^= c; b = CHACHA_ROTL(b, 12); \
+    a += b; d ^= a; d = CHACHA_ROTL(d, 8); \
+    c += d; b ^= c; b = CHACHA_ROTL(b, 7)
+
+static void Chacha20_Block(
+    const uint32_t *input,  // 16 words: constants, key, counter, nonce
+    unsigned char *out  // 64 bytes of keystream
+){
+    uint32_t x[16];
+    memcpy(x, input, sizeof(x));
+
+    int i;
+    for (i = 0; i < 10; ++i) {
+        CHACHA_QUARTER(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16; ++i)
+        Store_Le32(out + 4 * i, x[i] + input[i]);
+}
+
+static void Chacha20_Init(
+    uint32_t *state,
+    const unsigned char *key,
+    const unsigned char *nonce
+){
+    state[0] = 0x61707865;  // "expand 32-byte k"
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+
+    int i;
+    for (i = 0; i < 8; ++i)
+        state[4 + i] = Load_Le32(key + 4 * i);
+
+    state[12] = 0;  // block counter
+    for (i = 0; i < 3; ++i)
+        state[13 + i] = Load_Le32(nonce + 4 * i);
+}
+
+static void Chacha20_Xor(
+    uint32_t *state,
+    const unsigned char *in,
+    size_t size,
+    unsigned char *out
+){
+    unsigned char stream[64];
+    while (size > 0) {
+        Chacha20_Block(state, stream);
+        ++state[12];
+
+        size_t n = size < 64 ? size : 64;
+        size_t i;
+        for (i = 0; i < n; ++i)
+            out[i] = in[i] ^ stream[i];
+
+        in += n;
+        out += n;
+        size -= n;
+    }
+}
+
+
+//=//// POLY1305 //////////////////////////////////////////////////////////=//
+
+typedef struct {
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+} Poly1305_State;
+
+static void Poly1305_Init(Poly1305_State *p, const unsigned char *key)
+{
+    p->r[0] = Load_Le32(key + 0) & 0x3ffffff;
+    p->r[1] = (Load_Le32(key + 3) >> 2) & 0x3ffff03;
+    p->r[2] = (Load_Le32(key + 6) >> 4) & 0x3ffc0ff;
+    p->r[3] = (Load_Le32(key + 9) >> 6) & 0x3f03fff;
+    p->r[4] = (Load_Le32(key + 12) >> 8) & 0x00fffff;
+
+    memset(p->h, 0, sizeof(p->h));
+
+    int i;
+    for (i = 0; i < 4; ++i)
+        p->pad[i] = Load_Le32(key + 16 + 4 * i);
+}
+
+static void Poly1305_Block(Poly1305_State *p, const unsigned char *m)
+{
+    const uint32_t r0 = p->r[0], r1 = p->r[1], r2 = p->r[2];
+    const uint32_t r3 = p->r[3], r4 = p->r[4];
+    const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+
+    uint32_t h0 = p->h[0] + (Load_Le32(m + 0) & 0x3ffffff);
+    uint32_t h1 = p->h[1] + ((Load_Le32(m + 3) >> 2) & 0x3ffffff);
+    uint32_t h2 = p->h[2] + ((Load_Le32(m + 6) >> 4) & 0x3ffffff);
+    uint32_t h3 = p->h[3] + ((Load_Le32(m + 9) >> 6) & 0x3ffffff);
+    uint32_t h4 = p->h[4] + ((Load_Le32(m + 12) >> 8) | (1 << 24));
+
+    uint64_t d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4
+        + (uint64_t)h2 * s3 + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+    uint64_t d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0
+        + (uint64_t)h2 * s4 + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+    uint64_t d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1
+        + (uint64_t)h2 * r0 + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+    uint64_t d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2
+        + (uint64_t)h2 * r1 + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+    uint64_t d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3
+        + (uint64_t)h2 * r2 + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+    uint32_t c;
+    c = (uint32_t)(d0 >> 26); h0 = (uint32_t)d0 & 0x3ffffff;
+    d1 += c; c = (uint32_t)(d1 >> 26); h1 = (uint32_t)d1 & 0x3ffffff;
+    d2 += c; c = (uint32_t)(d2 >> 26); h2 = (uint32_t)d2 & 0x3ffffff;
+    d3 += c; c = (uint32_t)(d3 >> 26); h3 = (uint32_t)d3 & 0x3ffffff;
+    d4 += c; c = (uint32_t)(d4 >> 26); h4 = (uint32_t)d4 & 0x3ffffff;
+    h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += c;
+
+    p->h[0] = h0;
+    p->h[1] = h1;
+    p->h[2] = h2;
+    p->h[3] = h3;
+    p->h[4] = h4;
+}
+
+// The AEAD construction pads each part to 16 bytes with zeros, so there is
+// never a short final block to handle.
+//
+static void Poly1305_Padded(
+    Poly1305_State *p,
+    const unsigned char *m,
+    size_t size
+){
+    for (; size >= 16; size -= 16, m += 16)
+        Poly1305_Block(p, m);
+
+    if (size > 0) {
+        unsigned char block[16];
+        memset(block, 0, 16);
+        memcpy(block, m, size);
+        Poly1305_Block(p, block);
+    }
+}
+
+static void Poly1305_Finish(Poly1305_State *p, unsigned char *tag)
+{
+    uint32_t h0 = p->h[0], h1 = p->h[1], h2 = p->h[2];
+    uint32_t h3 = p->h[3], h4 = p->h[4];
+
+    uint32_t c;
+    c = h1 >> 26; h1 &= 0x3ffffff;
+    h2 += c; c = h2 >> 26; h2 &= 0x3ffffff;
+    h3 += c; c = h3 >> 26; h3 &= 0x3ffffff;
+    h4 += c; c = h4 >> 26; h4 &= 0x3ffffff;
+    h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += c;
+
+    // compute h - p, and use it if it didn't go negative (constant time)
+    //
+    uint32_t g0 = h0 + 5; c = g0 >> 26; g0 &= 0x3ffffff;
+    uint32_t g1 = h1 + c; c = g1 >> 26; g1 &= 0x3ffffff;
+    uint32_t g2 = h2 + c; c = g2 >> 26; g2 &= 0x3ffffff;
+    uint32_t g3 = h3 + c; c = g3 >> 26; g3 &= 0x3ffffff;
+    uint32_t g4 = h4 + c - (1UL << 26);
+
+    uint32_t mask = (g4 >> 31) - 1;
+    g0 &= mask; g1 &= mask; g2 &= mask; g3 &= mask; g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    h0 = h0 | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    uint64_t f = (uint64_t)h0 + p->pad[0];
+    Store_Le32(tag + 0, (uint32_t)f);
+    f = (uint64_t)h1 + p->pad[1] + (f >> 32);
+    Store_Le32(tag + 4, (uint32_t)f);
+    f = (uint64_t)h2 + p->pad[2] + (f >> 32);
+    Store_Le32(tag + 8, (uint32_t)f);
+    f = (uint64_t)h3 + p->pad[3] + (f >> 32);
+    Store_Le32(tag + 12, (uint32_t)f);
+}
+
+
+//=//// CHACHA20-POLY1305 /////////////////////////////////////////////////=//
+
+static void Chacha20_Poly1305_Tag(
+    uint32_t *state,  // counter is 0 on input, 1 on output
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *ciphertext, size_t size,
+    unsigned char *tag
+){
+    unsigned char block[64];
+    Chacha20_Block(state, block);
+    state[12] = 1;
+
+    Poly1305_State poly;
+    Poly1305_Init(&poly, block);  // one-time key is first 32 bytes
+
+    Poly1305_Padded(&poly, aad, aad_size);
+    Poly1305_Padded(&poly, ciphertext, size);
+
+    unsigned char lengths[16];
+    Store_Le32(lengths + 0, (uint32_t)aad_size);
+    Store_Le32(lengths + 4, (uint32_t)((uint64_t)aad_size >> 32));
+    Store_Le32(lengths + 8, (uint32_t)size);
+    Store_Le32(lengths + 12, (uint32_t)((uint64_t)size >> 32));
+    Poly1305_Block(&poly, lengths);
+
+    Poly1305_Finish(&poly, tag);
+}
+
+
+int Aead_Chacha20_Poly1305_Seal(
+    const unsigned char *key, size_t key_size,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    unsigned char *tag
+){
+    if (key_size != 32)
+        return AEAD_ERR_BAD_KEY;
+
+    uint32_t state[16];
+    Chacha20_Init(state, key, nonce);
+
+    uint32_t tag_state[16];
+    memcpy(tag_state, state, sizeof(state));
+
+    state[12] = 1;
+    Chacha20_Xor(state, in, size, out);
+    Chacha20_Poly1305_Tag(tag_state, aad, aad_size, out, size, tag);
+    return 0;
+}
+
+
+int Aead_Chacha20_Poly1305_Open(
+    const unsigned char *key, size_t key_size,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    const unsigned char *tag
+){
+    if (key_size != 32)
+        return AEAD_ERR_BAD_KEY;
+
+    uint32_t state[16];
+    Chacha20_Init(state, key, nonce);
+
+    unsigned char expected[AEAD_TAG_SIZE];
+    Chacha20_Poly1305_Tag(state, aad, aad_size, in, size, expected);
+    if (!Tags_Equal(expected, tag))
+        return AEAD_ERR_AUTH_FAILED;
+
+    Chacha20_Xor(state, in, size, out);  // tag computation left counter at 1
+    return 0;
+}
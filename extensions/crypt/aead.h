@@ -0,0 +1,75 @@
+//
+//  File: %aead.h
+//  Summary: "AEAD ciphers (AES-GCM, ChaCha20-Poly1305) for the Crypt module"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// These are plain C functions with no dependency on Rebol types, so that
+// %aead.c can be compiled like the mbedTLS library files it sits beside.
+//
+// All of them take a 12-byte nonce and produce or check a 16-byte tag.  The
+// `out` buffer may be the same as `in`.  Results are 0 on success, or one of
+// the negative codes below.
+//
+
+#include <stddef.h>
+
+#define AEAD_NONCE_SIZE 12
+#define AEAD_TAG_SIZE 16
+
+#define AEAD_ERR_BAD_KEY (-1)
+#define AEAD_ERR_AUTH_FAILED (-2)
+
+
+extern int Aead_Aes_Gcm_Seal(
+    const unsigned char *key, size_t key_size,  // 16, 24, or 32 bytes
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    unsigned char *tag  // written
+);
+
+extern int Aead_Aes_Gcm_Open(
+    const unsigned char *key, size_t key_size,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    const unsigned char *tag  // checked
+);
+
+extern int Aead_Chacha20_Poly1305_Seal(
+    const unsigned char *key, size_t key_size,  // 32 bytes
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    unsigned char *tag
+);
+
+extern int Aead_Chacha20_Poly1305_Open(
+    const unsigned char *key, size_t key_size,
+    const unsigned char *nonce,
+    const unsigned char *aad, size_t aad_size,
+    const unsigned char *in, size_t size,
+    unsigned char *out,
+    const unsigned char *tag
+);
+
+extern int Aead_Has_Aes_Hardware(void);
@@ -60,6 +60,13 @@ depends: [
     ;
     [%crypt/mbedtls/library/aes.c  #no-c++]
 
+    ; AEAD CIPHERS (AES-GCM, ChaCha20-Poly1305)
+    ;
+    ; Not from mbedTLS (the subset in this tree lacks %gcm.c etc.)  Uses the
+    ; AES above, with AES-NI instructions if the CPU has them.
+    ;
+    [%crypt/aead.c  #no-c++]
+
     ; !!! Plain Diffie-Hellman(-Merkel) is considered weaker than the
     ; Elliptic Curve Diffie-Hellman (ECDH).  It was an easier first test case
     ; to replace the %dh.h and %dh.c code, however.  Separate extensions for
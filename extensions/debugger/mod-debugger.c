@@ -104,6 +104,141 @@ bool Do_Breakpoint_Throws(
 }
 
 
+//
+//  Breakpoint_Hook_Throws: C
+//
+// Installed as PG_Breakpoint_Hook, so the evaluator calls it when it starts
+// an expression on a cell that SET-BREAKPOINT flagged.  The breakpoint acts
+// like a BREAKPOINT* placed before that expression: what RESUME gives back
+// is discarded, and the expression then runs normally.
+//
+bool Breakpoint_Hook_Throws(REBVAL *out, Frame(*) f)
+{
+    UNUSED(f);  // !!! could be given to the console as the focus frame
+
+    return Do_Breakpoint_Throws(
+        out,
+        false,  // not a Ctrl-C
+        Lib(BLANK)  // default result if RESUME does not override
+    );
+}
+
+
+// The cell the breakpoint flag goes on for a SET-BREAKPOINT location.  For
+// an array that's the cell at its index.  For interpreted functions it is
+// the first cell of the body, so any call to it breaks on entry.
+//
+static Cell(*) Breakpoint_Cell(const REBVAL *location)
+{
+    Array(const*) arr;
+    REBLEN index;
+
+    if (IS_ACTION(location)) {
+        Action(*) a = VAL_ACTION(location);
+        while (ACT_DISPATCHER(a) == &Hijacker_Dispatcher)
+            a = VAL_ACTION(ACT_ARCHETYPE(a));
+
+        if (
+            ACT_DISPATCHER(a) != &Func_Dispatcher
+            and ACT_DISPATCHER(a) != &Lambda_Dispatcher
+            and ACT_DISPATCHER(a) != &Lambda_Unoptimized_Dispatcher
+            and ACT_DISPATCHER(a) != &Block_Dispatcher
+        ){
+            fail ("Breakpoints can only be set on FUNC, LAMBDA, or DOES");
+        }
+
+        Cell(const*) body = ARR_AT(ACT_DETAILS(a), IDX_DETAILS_1);
+        arr = VAL_ARRAY(body);
+        index = VAL_INDEX(body);
+    }
+    else {
+        arr = VAL_ARRAY(location);
+        index = VAL_INDEX(location);
+    }
+
+    if (index >= ARR_LEN(arr))
+        fail (Error_Bad_Value(location));  // nothing there to break on
+
+    // The flag doesn't change the value, so it's set even in locked arrays
+    // (function bodies are always locked).
+    //
+    return m_cast(Cell(*), ARR_AT(arr, index));
+}
+
+
+//
+//  export set-breakpoint: native [
+//
+//  {Break into the debugger when evaluation reaches a position or function}
+//
+//      return: <none>
+//      location "Array position an expression starts at, or function"
+//          [any-array! action!]
+//  ]
+//
+DECLARE_NATIVE(set_breakpoint)
+//
+// There's no hook on every evaluation step: the flag is on the cell itself,
+// and the evaluator only looks at it when it starts an expression there.  So
+// loading the debugger doesn't slow evaluation down.
+//
+// Note that a breakpoint set on a position which is in the middle of an
+// expression (e.g. the argument of a function call) will not be hit.
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_SET_BREAKPOINT;
+
+    PG_Breakpoint_Hook = &Breakpoint_Hook_Throws;
+
+    Cell(*) cell = Breakpoint_Cell(ARG(location));
+    Set_Cell_Flag(cell, BREAKPOINT);
+
+    return NONE;
+}
+
+
+//
+//  export clear-breakpoint: native [
+//
+//  {Remove a breakpoint set by SET-BREAKPOINT}
+//
+//      return: [logic!]
+//          "True if there was a breakpoint to remove"
+//      location [any-array! action!]
+//  ]
+//
+DECLARE_NATIVE(clear_breakpoint)
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_CLEAR_BREAKPOINT;
+
+    Cell(*) cell = Breakpoint_Cell(ARG(location));
+    if (Not_Cell_Flag(cell, BREAKPOINT))
+        return Init_False(OUT);
+
+    Clear_Cell_Flag(cell, BREAKPOINT);
+    return Init_True(OUT);
+}
+
+
+//
+//  shutdown*: native [  ; Note: DO NOT EXPORT!
+//
+//  {Stop the evaluator from calling into the debugger on breakpoints}
+//
+//      return: <none>
+//  ]
+//
+DECLARE_NATIVE(shutdown_p)
+//
+// Cells may still have the breakpoint flag after this, and they'll just be
+// ignored by the evaluator.
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_SHUTDOWN_P;
+
+    PG_Breakpoint_Hook = nullptr;
+    return NONE;
+}
+
+
 //
 //  export breakpoint*: native [
 //
@@ -90,7 +90,7 @@ static Bounce DNS_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         INCLUDE_PARAMS_OF_READ;
         UNUSED(PARAM(source));  // covered by `port`
 
-        if (REF(part) or REF(seek))
+        if (REF(part) or REF(seek) or REF(into) or REF(mapped))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PARAM(string)); // handled in dispatcher
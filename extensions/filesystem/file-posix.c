@@ -39,9 +39,14 @@
 // abstraction layer that looks a lot like the POSIX interface, but with the
 // benefit of adding asynchronous (overlapped) IO.
 //
-// (At time of writing, this is passing in `nullptr` for the callback in all
-// operations, which means they are running synchronously.  But asynchronous
-// features are there to be taken advantage of when needed.)
+// Passing `nullptr` for the callback runs an operation synchronously, and
+// that is what most of these functions do.  But a file port can be switched
+// to async mode (`modify port 'async true`), in which case its reads, writes
+// and such are given a callback.  libuv then runs them on its threadpool,
+// and the interpreter runs the event loop while it waits for the result.
+// READ and WRITE still don't return until they're done--but meanwhile the
+// network extension's ports keep accepting, reading and sending, and timers
+// fire, so a slow disk (e.g. NFS) doesn't stall them.
 
 #include "reb-config.h"
 
@@ -52,6 +57,10 @@
     #undef IS_ERROR  // windows.h defines, contentious with IS_ERROR in Ren-C
     #undef OUT  // %minwindef.h defines this, we have a better use for it
     #undef VOID  // %winnt.h defines this, we have a better use for it
+#else
+    #include <errno.h>
+    #include <sys/mman.h>  // mmap() for READ/MAPPED
+    #include <unistd.h>  // sysconf() for the page size
 #endif
 
 #include "sys-core.h"
@@ -75,6 +84,131 @@ REBVAL *rebError_UV(int err) {
 }
 
 
+static void on_fs_finished(uv_fs_t *req)
+  { *cast(bool*, req->data) = true; }
+
+// Give this as the callback to a uv_fs_xxx() function, after setting the
+// req's `data` to point at a `finished` flag initialized to false.
+//
+#define Fs_Callback(file) \
+    ((file)->async ? &on_fs_finished : nullptr)
+
+// Call on the result of a uv_fs_xxx() function that was passed the callback
+// from Fs_Callback(), to get the result as if it had run synchronously.
+//
+static ssize_t Finish_Fs(FILEREQ *file, uv_fs_t *req, ssize_t submitted)
+{
+    if (not file->async or submitted < 0)  // done, or couldn't be queued
+        return submitted;
+
+    bool *finished = cast(bool*, req->data);
+    while (not *finished)
+        uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+    return req->result;
+}
+
+
+// Advance the position past data that was written (or buffered to be), and
+// grow the cached size if that went past the end.
+//
+static void Note_File_Written(FILEREQ *file, size_t size)
+{
+    file->offset += size;
+    if (
+        file->size_cache != FILESIZE_UNKNOWN
+        and file->offset > file->size_cache
+    ){
+        file->size_cache = file->offset;
+    }
+}
+
+
+static ssize_t Write_File_At(
+    FILEREQ *file,
+    const Byte* data,
+    size_t size,
+    uint64_t offset
+){
+    const int num_bufs = 1;
+    uv_buf_t buf;
+    buf.base = m_cast(char*, cs_cast(data));  // doesn't mutate
+    buf.len = size;
+
+    // !!! In async mode, code run by event callbacks while this waits (e.g.
+    // a network port's accept handler) could modify the data being written.
+    //
+    uv_fs_t req;
+    bool finished = false;
+    req.data = &finished;
+    ssize_t num_bytes_written = uv_fs_write(
+        uv_default_loop(),
+        &req,
+        file->id,
+        &buf,
+        num_bufs,
+        offset,
+        Fs_Callback(file)
+    );
+    num_bytes_written = Finish_Fs(file, &req, num_bytes_written);
+    uv_fs_req_cleanup(&req);
+
+    return num_bytes_written;
+}
+
+
+//
+//  Flush_File_Buffer: C
+//
+// Write out data held in the port's write buffer (if any).  This uses the
+// async mode if the port is in it, so one big write at a time can run on the
+// threadpool while the event loop keeps going.
+//
+REBVAL *Flush_File_Buffer(const REBVAL *port)
+{
+    FILEREQ *file = File_Of_Port(port);
+    if (file->buffer_used == 0)
+        return nullptr;
+
+    assert(file->id != FILEHANDLE_NONE);
+
+    size_t used = file->buffer_used;
+    file->buffer_used = 0;  // an error loses it, as with an unbuffered WRITE
+
+    ssize_t num_bytes_written = Write_File_At(
+        file, file->buffer, used, file->buffer_offset
+    );
+    if (num_bytes_written < 0) {
+        file->size_cache = FILESIZE_UNKNOWN;  // don't know what fail did
+        return rebError_UV(num_bytes_written);
+    }
+
+    assert(num_bytes_written == cast(ssize_t, used));
+    return nullptr;
+}
+
+
+//
+//  Set_File_Buffer_Size: C
+//
+// Takes effect on the next WRITE, with any data buffered so far written out.
+//
+REBVAL *Set_File_Buffer_Size(const REBVAL *port, size_t size)
+{
+    FILEREQ *file = File_Of_Port(port);
+
+    REBVAL *error = Flush_File_Buffer(port);
+
+    if (file->buffer) {
+        FREE_N(Byte, file->buffer_size, file->buffer);
+        file->buffer = nullptr;
+    }
+    file->buffer_size = size;
+
+    return error;
+}
+
+
 //
 //  Get_File_Size_Cacheable: C
 //
@@ -90,8 +224,21 @@ REBVAL *Get_File_Size_Cacheable(uint64_t *size, const REBVAL *port)
         return nullptr;  // assume accurate (checked each entry to File_Actor)
     }
 
+    if (file->buffer_used != 0) {  // fstat() wouldn't see the buffered data
+        REBVAL *error = Flush_File_Buffer(port);
+        if (error) {
+            *size = FILESIZE_UNKNOWN;
+            return error;
+        }
+    }
+
     uv_fs_t req;
-    int result = uv_fs_fstat(uv_default_loop(), &req, file->id, nullptr);
+    bool finished = false;
+    req.data = &finished;
+    int result = uv_fs_fstat(
+        uv_default_loop(), &req, file->id, Fs_Callback(file)
+    );
+    result = Finish_Fs(file, &req, result);
     if (result != 0) {
         *size = FILESIZE_UNKNOWN;
         return rebError_UV(result);
@@ -275,13 +422,27 @@ REBVAL *Close_File(const REBVAL *port)
 
     assert(file->id != FILEHANDLE_NONE);
 
+    REBVAL *flush_error = Flush_File_Buffer(port);  // close even if it fails
+    if (file->buffer) {
+        FREE_N(Byte, file->buffer_size, file->buffer);
+        file->buffer = nullptr;
+    }
+
     uv_fs_t req;
-    int result = uv_fs_close(uv_default_loop(), &req, file->id, nullptr);
+    bool finished = false;
+    req.data = &finished;
+    int result = uv_fs_close(
+        uv_default_loop(), &req, file->id, Fs_Callback(file)
+    );
+    result = Finish_Fs(file, &req, result);
 
     file->id = FILEHANDLE_NONE;
     file->offset = FILEOFFSET_UNKNOWN;
     file->size_cache = FILESIZE_UNKNOWN;
 
+    if (flush_error)
+        return flush_error;  // data was lost, more important than close error
+
     if (result < 0)
         return rebError_UV(result);
 
@@ -309,6 +470,8 @@ REBVAL *Read_File(const REBVAL *port, size_t length)
     buf.len = length;
 
     uv_fs_t req;
+    bool finished = false;
+    req.data = &finished;
     ssize_t num_bytes_read = uv_fs_read(
         uv_default_loop(),
         &req,
@@ -316,8 +479,10 @@ REBVAL *Read_File(const REBVAL *port, size_t length)
         &buf,
         num_bufs,
         file->offset,
-        nullptr  // no callback, synchronous
+        Fs_Callback(file)  // nullptr unless async, see Finish_Fs()
     );
+    num_bytes_read = Finish_Fs(file, &req, num_bytes_read);
+    uv_fs_req_cleanup(&req);
     if (num_bytes_read < 0)
         return rebError_UV(num_bytes_read);
 
@@ -332,6 +497,87 @@ REBVAL *Read_File(const REBVAL *port, size_t length)
 }
 
 
+#if !TO_WINDOWS
+
+static void Unmap_File_Data(void *base, Size size)
+  { munmap(base, size); }
+
+#endif
+
+
+//
+//  Read_File_Mapped: C
+//
+// Gives back a read-only BINARY! of the rest of the file from the current
+// offset, whose data is a memory mapping of the file instead of a copy.
+// Pages are only read in as they are touched, and the memory is returned to
+// the OS when the GC frees the BINARY!.
+//
+// The BINARY! must look terminated, but if the file's size is a multiple of
+// the page size there is no zero-filled slack after it in the mapping.  So
+// an anonymous region one byte larger is reserved first, and the file is
+// mapped over the front of it.
+//
+// !!! If another process truncates the file while it is mapped, touching the
+// lost pages raises SIGBUS.  That is the usual caveat of mmap(); callers
+// should only use /MAPPED on files they don't expect to be modified.
+//
+// !!! Windows would need CreateFileMapping()/MapViewOfFile() on the HANDLE
+// behind the CRT descriptor libuv uses.  Until then it reads normally.
+//
+REBVAL *Read_File_Mapped(const REBVAL *port, size_t length)
+{
+    FILEREQ *file = File_Of_Port(port);
+
+    assert(not file->is_dir);
+    assert(file->id != FILEHANDLE_NONE);
+
+  #if TO_WINDOWS
+    return Read_File(port, length);
+  #else
+    Size page_size = cast(Size, sysconf(_SC_PAGESIZE));
+    off_t aligned = file->offset - (file->offset % page_size);
+    Size delta = file->offset - aligned;
+
+    Size span = delta + length + 1;  // + 1 for terminator
+    span = (span + page_size - 1) / page_size * page_size;
+
+    void *base = mmap(
+        nullptr, span, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    );
+    if (base == MAP_FAILED)
+        return rebError_OS(errno);
+
+    void *mapped = mmap(
+        base,
+        delta + length,
+        PROT_READ,
+        MAP_PRIVATE | MAP_FIXED,
+        file->id,  // uv_file is the file descriptor on POSIX
+        aligned
+    );
+    if (mapped == MAP_FAILED) {
+        int errnum = errno;
+        munmap(base, span);
+        return rebError_OS(errnum);
+    }
+    assert(mapped == base);
+
+    Binary(*) bin = Make_Binary_External(
+        cast(Byte*, base) + delta,
+        length,
+        base,
+        span,
+        &Unmap_File_Data
+    );
+
+    file->offset += length;
+
+    return Init_Binary(Alloc_Value(), bin);
+  #endif
+}
+
+
 //
 //  Write_File: C
 //
@@ -383,15 +629,40 @@ REBVAL *Write_File(const REBVAL *port, const REBVAL *value, REBLEN limit)
 
     assert(file->offset != FILEOFFSET_UNKNOWN);
 
-    const int num_bufs = 1;
-    uv_buf_t buf;
-    buf.base = m_cast(char*, cs_cast(data));  // doesn't mutate
-    buf.len = size;
+    if (file->buffer_size != 0) {
+        if (file->buffer_used != 0 and not File_Offset_Is_Buffer_Tail(file)) {
+            REBVAL *error = Flush_File_Buffer(port);  // e.g. WRITE/SEEK
+            if (error)
+                return error;
+        }
 
-    uv_fs_t req;
-    ssize_t num_bytes_written = uv_fs_write(
-        uv_default_loop(), &req, file->id, &buf, num_bufs, file->offset, nullptr
-    );
+        if (size > file->buffer_size - file->buffer_used) {
+            REBVAL *error = Flush_File_Buffer(port);
+            if (error)
+                return error;
+        }
+
+        if (file->buffer == nullptr and size < file->buffer_size)
+            file->buffer = TRY_ALLOC_N(Byte, file->buffer_size);  // may fail
+
+        if (file->buffer != nullptr and size < file->buffer_size) {
+            if (file->buffer_used == 0)
+                file->buffer_offset = file->offset;
+            memcpy(file->buffer + file->buffer_used, data, size);
+            file->buffer_used += size;
+            Note_File_Written(file, size);
+
+            if (file->flush_on_newline and memchr(data, LF, size))
+                return Flush_File_Buffer(port);
+
+            return nullptr;
+        }
+
+        // Too big to be worth copying into the buffer (which is now empty),
+        // or it couldn't be allocated...so write it directly.
+    }
+
+    ssize_t num_bytes_written = Write_File_At(file, data, size, file->offset);
 
     if (num_bytes_written < 0) {
         file->size_cache = FILESIZE_UNKNOWN;  // don't know what fail did
@@ -400,19 +671,11 @@ REBVAL *Write_File(const REBVAL *port, const REBVAL *value, REBLEN limit)
 
     assert(num_bytes_written == cast(ssize_t, size));
 
-    file->offset += num_bytes_written;
-
     // !!! The concept of R3-Alpha was that it would keep the file size up to
     // date...theoretically.  But it actually didn't do that here.  Adding it,
     // but also adding a check in File_Actor() to make sure the cache is right.
     //
-    if (file->size_cache != FILESIZE_UNKNOWN) {
-        if (file->offset + num_bytes_written > file->size_cache) {
-            file->size_cache += (
-                num_bytes_written - (file->size_cache - file->offset)
-            );
-        }
-   }
+    Note_File_Written(file, num_bytes_written);
 
     return nullptr;
 }
@@ -427,9 +690,12 @@ REBVAL *Truncate_File(const REBVAL *port)
     assert(file->id != FILEHANDLE_NONE);
 
     uv_fs_t req;
+    bool finished = false;
+    req.data = &finished;
     int result = uv_fs_ftruncate(
-        uv_default_loop(), &req, file->id, file->offset, nullptr
+        uv_default_loop(), &req, file->id, file->offset, Fs_Callback(file)
     );
+    result = Finish_Fs(file, &req, result);
     if (result != 0)
         return rebError_UV(result);
 
@@ -104,11 +104,36 @@ struct Reb_File_Port_State {
 
     uint64_t size_cache;  // may be FILESIZE_UNKNOWN, use accessors
 
+    // If set, reads and writes run on libuv's threadpool while the event
+    // loop keeps running (see notes in %file-posix.c)
+    //
+    bool async;
+
+    // Optional write buffer, so a stream of small WRITEs (e.g. log lines)
+    // becomes a few large writes to the OS.  It holds data for the file
+    // positions from buffer_offset up to the current offset, and is written
+    // out when full, on FLUSH, and before any other operation on the port.
+    //
+    size_t buffer_size;  // configured size, 0 for unbuffered
+    bool flush_on_newline;  // write the buffer out after any WRITE with LF
+    Byte* buffer;  // allocated on first use, freed by Close_File()
+    size_t buffer_used;
+    uint64_t buffer_offset;
+
     uint64_t offset;
 };
 
 typedef struct Reb_File_Port_State FILEREQ;
 
+
+// A WRITE at the current offset would be continuing from the last buffered
+// WRITE, so it can be added to the buffer without checking the file size.
+//
+inline static bool File_Offset_Is_Buffer_Tail(FILEREQ *file) {
+    return file->buffer_used != 0
+        and file->offset == file->buffer_offset + file->buffer_used;
+}
+
 inline static FILEREQ *File_Of_Port(const REBVAL *port)
 {
     REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
@@ -372,7 +372,10 @@ depends: compose [
     ;
     [%filesystem/p-file.c <msc:/wd5220>]
     [%filesystem/p-dir.c <msc:/wd5220>]
+    [%filesystem/p-watch.c <msc:/wd5220>]
+    [%filesystem/p-task.c <msc:/wd5220>]
     [%filesystem/file-posix.c <msc:/wd5220>]
+    [%filesystem/read-deep.c <msc:/wd5220>]
 
     (spread uv-depends)
 
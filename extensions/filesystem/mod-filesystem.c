@@ -40,6 +40,8 @@
 
 extern Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
 extern Bounce Dir_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
+extern Bounce Watch_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
+extern Bounce Task_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
 
 
 #if TO_WINDOWS
@@ -111,6 +113,36 @@ DECLARE_NATIVE(get_dir_actor_handle)
 }
 
 
+//
+//  get-watch-actor-handle: native [
+//
+//  {Retrieve handle to the native actor for change notifications}
+//
+//      return: [handle!]
+//  ]
+//
+DECLARE_NATIVE(get_watch_actor_handle)
+{
+    Make_Port_Actor_Handle(OUT, &Watch_Actor);
+    return OUT;
+}
+
+
+//
+//  get-task-actor-handle: native [
+//
+//  {Retrieve handle to the native actor for worker thread jobs}
+//
+//      return: [handle!]
+//  ]
+//
+DECLARE_NATIVE(get_task_actor_handle)
+{
+    Make_Port_Actor_Handle(OUT, &Task_Actor);
+    return OUT;
+}
+
+
 // Options for To_REBOL_Path
 enum {
     PATH_OPT_SRC_IS_DIR = 1 << 0
@@ -649,3 +681,74 @@ DECLARE_NATIVE(get_current_exec)
 
     return Get_Current_Exec();
 }
+
+
+extern REBVAL *Read_Deep(
+    const REBVAL *root,
+    bool full,
+    bool info,
+    bool files,
+    bool dirs,
+    const char *pattern,
+    REBINT max_depth
+);
+
+//
+//  export read-deep: native [
+//
+//  {Read a directory tree, scanning many directories at once}
+//
+//      return: "Sorted paths, relative to root unless /FULL"
+//          [block!]
+//      root "Directory to read (must end in slash)"
+//          [file!]
+//      /full "Include the root in each path"
+//      /info "Follow each path with its size (blank for directories) and date"
+//      /type "Only include entries of this type"
+//          [word!]  ; 'file or 'dir
+//      /match "Only include entries whose names match this (* and ? wildcards)"
+//          [text!]
+//      /depth "How many levels to descend (1 is just the root's contents)"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(read_deep)
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_READ_DEEP;
+
+    REBVAL *root = ARG(root);
+    if (not rebDid("dir?", root))
+        fail (PARAM(root));
+
+    bool files = true;
+    bool dirs = true;
+    if (REF(type)) {
+        if (rebDid("'file = @", ARG(type)))
+            dirs = false;
+        else if (rebDid("'dir = @", ARG(type)))
+            files = false;
+        else
+            fail (PARAM(type));
+    }
+
+    REBINT max_depth = 0;  // no limit
+    if (REF(depth)) {
+        max_depth = VAL_INT32(ARG(depth));
+        if (max_depth < 1)
+            fail (PARAM(depth));
+    }
+
+    char *pattern = REF(match) ? rebSpell(ARG(match)) : nullptr;
+
+    REBVAL *result = Read_Deep(
+        root, REF(full), REF(info), files, dirs, pattern, max_depth
+    );
+
+    if (pattern)
+        rebFree(pattern);
+
+    if (IS_ERROR(result))
+        return RAISE(result);
+
+    return result;
+}
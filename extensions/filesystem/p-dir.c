@@ -161,8 +161,12 @@ Bounce Dir_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
 
         UNUSED(PARAM(source));
 
-        if (REF(part) or REF(seek) or REF(string) or REF(lines))
+        if (
+            REF(part) or REF(seek) or REF(string) or REF(lines)
+            or REF(into) or REF(mapped)
+        ){
             fail (Error_Bad_Refines_Raw());
+        }
 
         StackIndex base = TOP_INDEX;
         while (true) {
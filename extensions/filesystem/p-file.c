@@ -77,12 +77,15 @@ extern REBVAL *Get_File_Size_Cacheable(uint64_t *size, const REBVAL *port);
 extern REBVAL *Open_File(const REBVAL *port, int flags);
 extern REBVAL *Close_File(const REBVAL *port);
 extern REBVAL *Read_File(const REBVAL *port, size_t length);
+extern REBVAL *Read_File_Mapped(const REBVAL *port, size_t length);
 extern REBVAL *Write_File(const REBVAL *port, const REBVAL *data, REBLEN length);
 extern REBVAL *Query_File_Or_Directory(const REBVAL *port);
 extern REBVAL *Create_File(const REBVAL *port);
 extern REBVAL *Delete_File_Or_Directory(const REBVAL *port);
 extern REBVAL *Rename_File_Or_Directory(const REBVAL *port, const REBVAL *to);
 extern REBVAL *Truncate_File(const REBVAL *port);
+extern REBVAL *Flush_File_Buffer(const REBVAL *port);
+extern REBVAL *Set_File_Buffer_Size(const REBVAL *port, size_t size);
 
 
 inline static uint64_t File_Size_Cacheable_May_Fail(const REBVAL *port)
@@ -114,6 +117,16 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
     if (IS_BINARY(state)) {
         file = File_Of_Port(port);
 
+        // Only a run of WRITEs adds to the write buffer.  Anything else could
+        // look at the file (READ, QUERY, LENGTH OF...) or move the position,
+        // so the buffered data is written out first.
+        //
+        if (file->buffer_used != 0 and ID_OF_SYMBOL(verb) != SYM_WRITE) {
+            REBVAL *error = Flush_File_Buffer(port);
+            if (error)
+                fail (error);
+        }
+
       #if !defined(NDEBUG)
         //
         // If we think we know the size of the file, it needs to be actually
@@ -161,6 +174,11 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         file->is_dir = false;  // would be dispatching to Dir_Actor if dir
         file->size_cache = FILESIZE_UNKNOWN;
         file->offset = FILEOFFSET_UNKNOWN;
+        file->async = false;
+        file->buffer_size = 0;
+        file->flush_on_newline = false;
+        file->buffer = nullptr;
+        file->buffer_used = 0;
 
         // Generally speaking, you don't want to store REBVAL* or REBSER* in
         // something like this struct-embedded-in-a-BINARY! as it will be
@@ -229,6 +247,9 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         UNUSED(PARAM(string)); // handled in dispatcher
         UNUSED(PARAM(lines)); // handled in dispatcher
 
+        if (REF(into))
+            fail (Error_Bad_Refines_Raw());
+
         // Handle the READ %file shortcut case, where the FILE! has been
         // converted into a PORT! but has not been opened yet.
 
@@ -300,7 +321,14 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
                 len = limit;
         }
 
-        result = Read_File(port, len);
+        // The mapped BINARY! gets its terminator from the zero fill after the
+        // end of the file, so /MAPPED with a /PART that stops short of the
+        // end just reads normally.
+        //
+        if (REF(mapped) and file->offset + len == file_size)
+            result = Read_File_Mapped(port, len);
+        else
+            result = Read_File(port, len);
      }
 
      cleanup_read:
@@ -389,42 +417,52 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         REBVAL *result;
 
       blockscope {
-        uint64_t file_size = File_Size_Cacheable_May_Fail(port);
-
-        if (REF(append)) {
-            //
-            // We assume WRITE/APPEND has the same semantics as WRITE/SEEK to
-            // the end of the file.  This means the position before the call is
-            // lost, and WRITE after a WRITE/APPEND will always write to the
-            // new end of the file.
-            //
-            assert(not REF(seek));  // checked above
-            file->offset = file_size;
+        if (
+            not REF(append) and not REF(seek)
+            and File_Offset_Is_Buffer_Tail(file)
+        ){
+            // Continuing on from the last buffered WRITE, so the position is
+            // known to be in range (and getting the size would flush).
         }
         else {
-            // Seek addresses are 0-based:
-            //
-            // https://discourse.julialang.org/t/why-is-seek-zero-based/55569/
-            //
-            if (REF(seek)) {
-                int64_t seek = VAL_INT64(ARG(seek));
-                if (seek <= 0)
-                    result = rebValue(
-                        "make error! {Negative /PART passed to READ of file}"
+            uint64_t file_size = File_Size_Cacheable_May_Fail(port);
+
+            if (REF(append)) {
+                //
+                // We assume WRITE/APPEND has the same semantics as WRITE/SEEK
+                // to the end of the file.  This means the position before the
+                // call is lost, and WRITE after a WRITE/APPEND will always
+                // write to the new end of the file.
+                //
+                assert(not REF(seek));  // checked above
+                file->offset = file_size;
+            }
+            else {
+                // Seek addresses are 0-based:
+                //
+                // https://discourse.julialang.org/t/why-is-seek-zero-based/55569/
+                //
+                if (REF(seek)) {
+                    int64_t seek = VAL_INT64(ARG(seek));
+                    if (seek <= 0)
+                        result = rebValue(
+                            "make error!",
+                            "{Negative /PART passed to READ of file}"
+                        );
+                    file->offset = seek;
+                }
+
+                // !!! R3-Alpha would bound the seek to the file size; that's
+                // flaky and might give people a wrong impression.  Error.
+                //
+                if (file->offset > file_size) {
+                    result = Init_Error(
+                        Alloc_Value(),
+                        Error_Out_Of_Range(rebValue(rebI(file->offset)))
                     );
-                file->offset = seek;
+                    goto cleanup_write;
+               }
             }
-
-            // !!! R3-Alpha would bound the seek to the file size; that's flaky
-            // and might give people a wrong impression.  Let it error.
-            //
-            if (file->offset > file_size) {
-                result = Init_Error(
-                    Alloc_Value(),
-                    Error_Out_Of_Range(rebValue(rebI(file->offset)))
-                );
-                goto cleanup_write;
-           }
         }
 
         REBLEN len = Part_Len_May_Modify_Index(ARG(data), ARG(part));
@@ -512,12 +550,46 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         else
             flags |= UV_FS_O_RDWR;
 
+        // The write buffer settings come from the spec, so they can be given
+        // as e.g. `open [scheme: 'file path: %log.txt buffer-size: 65536]`
+        //
+        REBVAL *spec = CTX_VAR(ctx, STD_PORT_SPEC);
+        REBVAL *buffer_size = Obj_Value(spec, STD_PORT_SPEC_FILE_BUFFER_SIZE);
+        REBVAL *flush_on_newline = Obj_Value(
+            spec, STD_PORT_SPEC_FILE_FLUSH_ON_NEWLINE
+        );
+
+        if (buffer_size == nullptr or Is_Nulled(buffer_size))
+            file->buffer_size = 0;
+        else if (IS_INTEGER(buffer_size) and VAL_INT64(buffer_size) >= 0)
+            file->buffer_size = VAL_INT32(buffer_size);
+        else
+            fail (Error_Invalid_Spec_Raw(buffer_size));
+
+        if (flush_on_newline == nullptr or Is_Nulled(flush_on_newline))
+            file->flush_on_newline = false;
+        else if (IS_LOGIC(flush_on_newline))
+            file->flush_on_newline = VAL_LOGIC(flush_on_newline);
+        else
+            fail (Error_Invalid_Spec_Raw(flush_on_newline));
+
         REBVAL *error = Open_File(port, flags);
         if (error != nullptr)
             fail (Error_Cannot_Open_Raw(file->path, error));
 
         return COPY(port); }
 
+    //=//// FLUSH //////////////////////////////////////////////////////////=//
+    //
+    // Any buffered data was written out on entry to File_Actor(), as is done
+    // for all verbs besides WRITE.
+
+      case SYM_FLUSH: {
+        INCLUDE_PARAMS_OF_FLUSH;
+        UNUSED(PARAM(port));
+
+        return COPY(port); }
+
     //=//// COPY ///////////////////////////////////////////////////////////=//
     //
     // COPY on a file port has traditionally acted as a synonym for READ.  Not
@@ -642,6 +714,46 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
       case SYM_CREATE: {
         fail ("CREATE on file PORT! was ill-defined, use OPEN/NEW for now"); }
 
+    //=//// MODIFY /////////////////////////////////////////////////////////=//
+    //
+    // !!! Port modes don't have a general design yet.  The settings are a
+    // LOGIC! for whether operations run on libuv's threadpool, while the
+    // event loop keeps running (see notes in %file-posix.c), and the write
+    // buffer settings that OPEN takes from the spec:
+    //
+    //     modify port 'async true
+    //     modify port 'buffer-size 65536
+    //     modify port 'flush-on-newline true
+
+      case SYM_MODIFY: {
+        INCLUDE_PARAMS_OF_MODIFY;
+        UNUSED(PARAM(target));
+
+        REBVAL *value = ARG(value);
+
+        if (rebDid("'async = @", ARG(field))) {
+            if (not IS_LOGIC(value))
+                fail (PARAM(value));
+            file->async = VAL_LOGIC(value);
+        }
+        else if (rebDid("'buffer-size = @", ARG(field))) {
+            if (not IS_INTEGER(value) or VAL_INT64(value) < 0)
+                fail (PARAM(value));
+
+            REBVAL *error = Set_File_Buffer_Size(port, VAL_INT32(value));
+            if (error)
+                fail (error);
+        }
+        else if (rebDid("'flush-on-newline = @", ARG(field))) {
+            if (not IS_LOGIC(value))
+                fail (PARAM(value));
+            file->flush_on_newline = VAL_LOGIC(value);
+        }
+        else
+            fail (PARAM(field));
+
+        return Init_True(OUT); }
+
     //=//// QUERY //////////////////////////////////////////////////////////=//
     //
     // The QUERY verb implemented a very limited way of asking for information
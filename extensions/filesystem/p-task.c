@@ -0,0 +1,480 @@
+//
+//  File: %p-task.c
+//  Summary: "port for running heavy byte crunching on a worker thread"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A TASK port runs a compression or checksum on libuv's thread pool, so the
+// interpreter can go on servicing other ports (e.g. an HTTP server accepting
+// connections) while a big payload is crunched:
+//
+//     >> p: open [scheme: 'task job: 'deflate envelope: 'gzip input: data]
+//     >> wait [p server 10]  ; returns p when the result is ready
+//     >> read p
+//     == #{1F8B08...}
+//
+// Jobs are DEFLATE and INFLATE (with an optional ENVELOPE of ZLIB or GZIP, as
+// with the natives of the same name) and CRC32 or ADLER32 (giving the same
+// 4-byte little-endian BINARY! as CHECKSUM-CORE).
+//
+// The result is put as the single item of a BLOCK! in the port's `data` when
+// the libuv event loop runs (as in WAIT), so WAIT returns the port once it is
+// done.  READ gives the result, waiting for it if needed.  If the job failed
+// (e.g. corrupt data for INFLATE), READ raises the error.
+//
+// * The worker thread doesn't touch the interpreter at all: zlib and the
+//   output buffer use plain malloc(), and the BINARY! is made from it back on
+//   the interpreter's thread.
+//
+// * The input BINARY! is kept alive and has a hold put on it while the job
+//   runs, so attempts to modify it fail instead of racing with the worker.
+//   TEXT! input is converted to a UTF-8 BINARY! copy first.
+//
+// * CLOSE before the job finishes cancels it if it hasn't started yet.
+//   Otherwise the result is thrown away when it arrives.
+//
+
+#include "reb-config.h"
+
+#include "uv.h"  // includes windows.h
+#if TO_WINDOWS
+    #undef IS_ERROR  // windows.h defines, contentious with IS_ERROR in Ren-C
+    #undef OUT  // %minwindef.h defines this, we have a better use for it
+    #undef VOID  // %winnt.h defines this, we have a better use for it
+#endif
+
+#include "sys-core.h"
+
+#undef Byte  // sys-zlib.h defines it compatibly (unsigned char)
+#include "sys-zlib.h"
+
+
+extern REBVAL *rebError_UV(int err);
+
+
+enum Reb_Task_Job {
+    TASK_JOB_DEFLATE,
+    TASK_JOB_INFLATE,
+    TASK_JOB_CRC32,
+    TASK_JOB_ADLER32
+};
+
+struct Reb_Task {
+    uv_work_t req;
+
+    enum Reb_Task_Job job;
+    int window_bits;  // for DEFLATE and INFLATE
+
+    REBVAL *input;  // API handle, keeps the held BINARY! alive
+    bool took_hold;  // don't release a hold that was someone else's
+    const Byte* in;
+    Size size_in;
+
+    Byte* output;  // malloc()'d by the worker, nullptr on failure
+    Size size_out;
+    int status;  // zlib error code, if output is nullptr
+
+    REBVAL *port;  // API handle while running, nullptr once CLOSE'd
+};
+
+
+inline static struct Reb_Task *Task_Of_Port(const REBVAL *port)
+{
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
+    if (not IS_HANDLE(state))
+        return nullptr;  // not open
+    return VAL_HANDLE_POINTER(struct Reb_Task, state);
+}
+
+
+static void Deflate_On_Worker(struct Reb_Task *t)
+{
+    z_stream strm;
+    strm.zalloc = Z_NULL;  // default malloc(), see notes at top of file
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    t->status = deflateInit2(
+        &strm,
+        Z_DEFAULT_COMPRESSION,
+        Z_DEFLATED,
+        t->window_bits,
+        8,
+        Z_DEFAULT_STRATEGY
+    );
+    if (t->status != Z_OK)
+        return;
+
+    Size buf_size = deflateBound(&strm, t->size_in);
+    Byte* output = cast(Byte*, malloc(buf_size));
+    if (not output) {
+        t->status = Z_MEM_ERROR;
+        deflateEnd(&strm);
+        return;
+    }
+
+    strm.next_in = cast(const z_Bytef*, t->in);
+    strm.avail_in = t->size_in;
+    strm.next_out = output;
+    strm.avail_out = buf_size;
+
+    t->status = deflate(&strm, Z_FINISH);
+    if (t->status == Z_STREAM_END) {
+        t->output = output;
+        t->size_out = buf_size - strm.avail_out;
+    }
+    else
+        free(output);
+
+    deflateEnd(&strm);
+}
+
+
+static void Inflate_On_Worker(struct Reb_Task *t)
+{
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.next_in = cast(const z_Bytef*, t->in);
+    strm.avail_in = t->size_in;
+
+    t->status = inflateInit2(&strm, t->window_bits);
+    if (t->status != Z_OK)
+        return;
+
+    // The size isn't known in advance, so guess and double as needed (the
+    // same strategy as Decompress_Alloc_Core()).
+    //
+    Size buf_size = t->size_in < 16384 ? 32768 : t->size_in * 3;
+    Byte* output = cast(Byte*, malloc(buf_size));
+    strm.next_out = output;
+    strm.avail_out = buf_size;
+
+    while (output) {
+        t->status = inflate(&strm, Z_NO_FLUSH);
+        if (t->status == Z_STREAM_END)
+            break;
+        if (t->status != Z_OK)  // e.g. Z_DATA_ERROR for corrupt input
+            break;
+        if (strm.avail_out != 0) {
+            if (strm.avail_in == 0) {
+                t->status = Z_DATA_ERROR;  // input ended before end marker
+                break;
+            }
+            continue;
+        }
+
+        Byte* bigger = cast(Byte*, realloc(output, buf_size * 2));
+        if (not bigger) {
+            free(output);
+            output = nullptr;
+            break;
+        }
+        output = bigger;
+        strm.next_out = output + buf_size;
+        strm.avail_out = buf_size;
+        buf_size *= 2;
+    }
+
+    if (not output)
+        t->status = Z_MEM_ERROR;
+    else if (t->status == Z_STREAM_END) {
+        t->output = output;
+        t->size_out = buf_size - strm.avail_out;
+    }
+    else
+        free(output);
+
+    inflateEnd(&strm);
+}
+
+
+static void Checksum_On_Worker(struct Reb_Task *t)
+{
+    uLong crc;
+    if (t->job == TASK_JOB_CRC32)
+        crc = crc32_z(0L, t->in, t->size_in);
+    else
+        crc = z_adler32(1L, t->in, t->size_in);  // Adler-32's A starts at 1
+
+    t->output = cast(Byte*, malloc(4));
+    if (not t->output) {
+        t->status = Z_MEM_ERROR;
+        return;
+    }
+
+    int i;
+    for (i = 0; i < 4; ++i) {  // little endian, as with CHECKSUM-CORE
+        t->output[i] = crc % 256;
+        crc >>= 8;
+    }
+    t->size_out = 4;
+}
+
+
+// Runs on a thread pool thread.  Must not touch the interpreter.
+//
+static void on_task_work(uv_work_t *req)
+{
+    struct Reb_Task *t = cast(struct Reb_Task*, req->data);
+
+    switch (t->job) {
+      case TASK_JOB_DEFLATE:
+        Deflate_On_Worker(t);
+        break;
+
+      case TASK_JOB_INFLATE:
+        Inflate_On_Worker(t);
+        break;
+
+      case TASK_JOB_CRC32:
+      case TASK_JOB_ADLER32:
+        Checksum_On_Worker(t);
+        break;
+    }
+}
+
+
+// Runs on the interpreter's thread, from inside uv_run().
+//
+static void on_task_done(uv_work_t *req, int status)
+{
+    UNUSED(status);  // UV_ECANCELED if CLOSE got to it before a worker did
+    struct Reb_Task *t = cast(struct Reb_Task*, req->data);
+
+    if (t->took_hold)
+        CLEAR_SERIES_INFO(
+            m_cast(Binary(*), VAL_BINARY(t->input)), HOLD
+        );
+    rebRelease(t->input);
+
+    if (t->port) {  // not CLOSE'd, so deliver the result
+        Array(*) a = Make_Array(1);
+        if (t->output) {
+            Binary(*) bin = Make_Binary(t->size_out);
+            memcpy(BIN_HEAD(bin), t->output, t->size_out);
+            TERM_BIN_LEN(bin, t->size_out);
+            Init_Binary(Alloc_Tail_Array(a), bin);
+        }
+        else if (t->status == Z_MEM_ERROR)
+            Init_Error(Alloc_Tail_Array(a), Error_No_Memory(t->size_in));
+        else {
+            DECLARE_LOCAL (code);
+            Init_Integer(code, t->status);
+            Init_Error(Alloc_Tail_Array(a), Error_Bad_Compression_Raw(code));
+        }
+
+        Context(*) ctx = VAL_CONTEXT(t->port);
+        Init_Block(CTX_VAR(ctx, STD_PORT_DATA), a);
+        Init_Nulled(CTX_VAR(ctx, STD_PORT_STATE));  // job is over
+
+        rebRelease(t->port);
+    }
+
+    free(t->output);  // free(nullptr) is a no-op
+    FREE(struct Reb_Task, t);
+}
+
+
+//
+//  Task_Actor: C
+//
+Bounce Task_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
+{
+    Context(*) ctx = VAL_CONTEXT(port);
+    struct Reb_Task *task = Task_Of_Port(port);
+
+    switch (ID_OF_SYMBOL(verb)) {
+
+    //=//// REFLECT ////////////////////////////////////////////////////////=//
+
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+
+        UNUSED(ARG(value));  // implicitly comes from `port`
+        option(SymId) property = VAL_WORD_ID(ARG(property));
+
+        if (property == SYM_OPEN_Q)  // still open once done, until CLOSE
+            return Init_Logic(OUT, did task or IS_BLOCK(
+                CTX_VAR(ctx, STD_PORT_DATA)
+            ));
+
+        break; }
+
+    //=//// OPEN ///////////////////////////////////////////////////////////=//
+
+      case SYM_OPEN: {
+        INCLUDE_PARAMS_OF_OPEN;
+        UNUSED(PARAM(spec));
+
+        if (REF(new) or REF(read) or REF(write))
+            fail (Error_Bad_Refines_Raw());
+
+        if (task or IS_BLOCK(CTX_VAR(ctx, STD_PORT_DATA)))
+            fail (Error_Already_Open_Raw(port));
+
+        REBVAL *spec = CTX_VAR(ctx, STD_PORT_SPEC);
+        if (not IS_OBJECT(spec))
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        REBVAL *job = Obj_Value(spec, STD_PORT_SPEC_TASK_JOB);
+        REBVAL *envelope = Obj_Value(spec, STD_PORT_SPEC_TASK_ENVELOPE);
+        REBVAL *input = Obj_Value(spec, STD_PORT_SPEC_TASK_INPUT);
+
+        if (job == nullptr or not IS_WORD(job))
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        enum Reb_Task_Job which;
+        const char *name = STR_UTF8(VAL_WORD_SYMBOL(job));
+        if (VAL_WORD_ID(job) == SYM_CRC32)
+            which = TASK_JOB_CRC32;
+        else if (VAL_WORD_ID(job) == SYM_ADLER32)
+            which = TASK_JOB_ADLER32;
+        else if (0 == strcmp(name, "deflate"))
+            which = TASK_JOB_DEFLATE;
+        else if (0 == strcmp(name, "inflate"))
+            which = TASK_JOB_INFLATE;
+        else
+            fail (Error_Invalid_Spec_Raw(job));
+
+        // Window bits as in %u-compress.c: negative for raw deflate, +16 for
+        // a gzip envelope.
+        //
+        int window_bits = -(MAX_WBITS);
+        if (envelope and not Is_Nulled(envelope)) {
+            if (
+                which == TASK_JOB_CRC32 or which == TASK_JOB_ADLER32
+                or not IS_WORD(envelope)
+            ){
+                fail (Error_Invalid_Spec_Raw(envelope));
+            }
+            if (VAL_WORD_ID(envelope) == SYM_ZLIB)
+                window_bits = MAX_WBITS;
+            else if (VAL_WORD_ID(envelope) == SYM_GZIP)
+                window_bits = MAX_WBITS | 16;
+            else
+                fail (Error_Invalid_Spec_Raw(envelope));
+        }
+
+        if (input and IS_TEXT(input))
+            input = rebValue("as binary! copy", input);
+        else if (input and IS_BINARY(input))
+            input = rebValue(input);
+        else
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        Size size_in;
+        const Byte* in = VAL_BINARY_SIZE_AT(&size_in, input);
+
+        task = TRY_ALLOC(struct Reb_Task);
+        if (not task) {
+            rebRelease(input);
+            fail (Error_No_Memory(sizeof(struct Reb_Task)));
+        }
+
+        task->job = which;
+        task->window_bits = window_bits;
+        task->input = rebUnmanage(input);
+        task->in = in;
+        task->size_in = size_in;
+        task->output = nullptr;
+        task->size_out = 0;
+        task->status = Z_OK;
+
+        // Hold the input so it can't be modified (or expanded, which would
+        // move its data) while the worker reads it.
+        //
+        Binary(*) bin = m_cast(Binary(*), VAL_BINARY(input));
+        task->took_hold = not GET_SERIES_INFO(bin, HOLD);
+        if (task->took_hold)
+            SET_SERIES_INFO(bin, HOLD);
+
+        task->port = rebUnmanage(rebValue(port));
+
+        task->req.data = task;
+        int result = uv_queue_work(
+            uv_default_loop(), &task->req, &on_task_work, &on_task_done
+        );
+        if (result < 0) {
+            if (task->took_hold)
+                CLEAR_SERIES_INFO(bin, HOLD);
+            rebRelease(task->input);
+            rebRelease(task->port);
+            FREE(struct Reb_Task, task);
+            fail (Error_Cannot_Open_Raw(job, rebError_UV(result)));
+        }
+
+        Init_Handle_Cdata(
+            CTX_VAR(ctx, STD_PORT_STATE),
+            task,
+            sizeof(struct Reb_Task)
+        );
+
+        return COPY(port); }
+
+    //=//// READ ///////////////////////////////////////////////////////////=//
+    //
+    // Gives back the result, waiting for it if the job isn't done yet.
+
+      case SYM_READ: {
+        INCLUDE_PARAMS_OF_READ;
+        UNUSED(PARAM(source));
+
+        if (
+            REF(part) or REF(seek) or REF(string) or REF(lines)
+            or REF(into) or REF(mapped)
+        ){
+            fail (Error_Bad_Refines_Raw());
+        }
+
+        REBVAL *data = CTX_VAR(ctx, STD_PORT_DATA);
+        if (not task and not IS_BLOCK(data))
+            fail (Error_Not_Open_Raw(port));
+
+        while (not IS_BLOCK(data))  // set by on_task_done()
+            uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+        Cell(const*) result = ARR_HEAD(VAL_ARRAY(data));
+        if (IS_ERROR(result))
+            fail (VAL_CONTEXT(result));
+
+        return Copy_Cell(OUT, SPECIFIC(result)); }
+
+    //=//// CLOSE //////////////////////////////////////////////////////////=//
+
+      case SYM_CLOSE: {
+        INCLUDE_PARAMS_OF_CLOSE;
+        UNUSED(PARAM(port));
+
+        if (task) {  // still running, or not started yet
+            uv_cancel(cast(uv_req_t*, &task->req));  // fails if started
+            rebRelease(task->port);
+            task->port = nullptr;  // on_task_done() will just clean up
+            Init_Nulled(CTX_VAR(ctx, STD_PORT_STATE));
+        }
+        Init_Nulled(CTX_VAR(ctx, STD_PORT_DATA));
+        return COPY(port); }
+
+      default:
+        break;
+    }
+
+    fail (UNHANDLED);
+}
@@ -0,0 +1,313 @@
+//
+//  File: %p-watch.c
+//  Summary: "filesystem change notification port"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A WATCH port asks the OS to report changes under a file or directory, so
+// that tools which need to react to changes don't have to rescan the tree
+// every few seconds:
+//
+//     >> p: open [scheme: 'watch path: %src/]
+//     >> wait [p 10]  ; returns the port if anything changed in 10 seconds
+//     >> read p
+//     == [%file.c changed %new.c renamed]
+//
+// Events are pairs of a FILE! (relative to the watched directory) and a kind.
+// 'CHANGED means contents or attributes were modified, and 'RENAMED means
+// an entry appeared, disappeared, or was renamed.  (That is what libuv is
+// able to report in common across inotify, FSEvents, ReadDirectoryChangesW.)
+// A burst of identical events is reported once.
+//
+// Events accumulate as a BLOCK! in the port's `data`, whenever the libuv
+// event loop runs (as in WAIT).  READ takes them, waiting for at least one
+// if there are none yet.  WAIT returns ports with events in their `data`.
+//
+// * Setting `interval` in the spec uses uv_fs_poll instead, which compares
+//   stat() results at that interval.  That's for network filesystems where
+//   the OS can't deliver notifications.  It only sees changes to the path
+//   itself (for a directory, entries added or removed), and reports them
+//   with a BLANK! path.
+//
+// * `recursive: true` is honored on Windows and Mac.  libuv doesn't support
+//   it for inotify, so on Linux only the directory itself is watched.
+//
+// * An open port is kept alive by the watch, even if unreferenced.  CLOSE it
+//   to stop watching.
+//
+
+#include "reb-config.h"
+
+#include "uv.h"  // includes windows.h
+#if TO_WINDOWS
+    #undef IS_ERROR  // windows.h defines, contentious with IS_ERROR in Ren-C
+    #undef OUT  // %minwindef.h defines this, we have a better use for it
+    #undef VOID  // %winnt.h defines this, we have a better use for it
+#endif
+
+#include "sys-core.h"
+
+
+extern REBVAL *rebError_UV(int err);
+
+
+struct Reb_Fs_Watch {
+    union {
+        uv_fs_event_t event;
+        uv_fs_poll_t poll;
+    } handle;
+    bool polling;  // which member of the union is in use
+
+    REBVAL *port;  // API handle, keeps port alive while watching
+};
+
+
+inline static struct Reb_Fs_Watch *Fs_Watch_Of_Port(const REBVAL *port)
+{
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
+    if (not IS_HANDLE(state))
+        return nullptr;  // not open
+    return VAL_HANDLE_POINTER(struct Reb_Fs_Watch, state);
+}
+
+
+// Add an event to the port's `data`, unless the same one is already there.
+//
+static void Queue_Watch_Event(
+    struct Reb_Fs_Watch *watch,
+    const char *filename,  // nullptr if unknown, or for the path itself
+    const char *kind
+){
+    REBVAL *file = filename
+        ? rebValue("local-to-file", rebT(filename))
+        : rebValue("_");
+
+    rebElide(
+        "let events: (", watch->port, ").data",
+        "let event: reduce [", rebR(file), "as word!", rebT(kind), "]",
+        "if not find/skip events event 2 [append events spread event]"
+    );
+}
+
+
+static void on_fs_event(
+    uv_fs_event_t *handle,
+    const char *filename,
+    int events,
+    int status
+){
+    struct Reb_Fs_Watch *watch = cast(struct Reb_Fs_Watch*, handle->data);
+
+    if (status < 0) {  // e.g. an inotify queue overflow, so events were lost
+        Queue_Watch_Event(watch, nullptr, "error");
+        return;
+    }
+
+    if (events & UV_RENAME)
+        Queue_Watch_Event(watch, filename, "renamed");
+    if (events & UV_CHANGE)
+        Queue_Watch_Event(watch, filename, "changed");
+}
+
+
+static void on_fs_poll(
+    uv_fs_poll_t *handle,
+    int status,
+    const uv_stat_t *prev,
+    const uv_stat_t *curr
+){
+    UNUSED(prev);
+    UNUSED(curr);
+
+    struct Reb_Fs_Watch *watch = cast(struct Reb_Fs_Watch*, handle->data);
+
+    // The callback is only made when the stat() result changes, or when
+    // stat() starts or stops failing (e.g. the path was deleted or created).
+    //
+    if (status == UV_ENOENT or status == 0)
+        Queue_Watch_Event(watch, nullptr, status == 0 ? "changed" : "renamed");
+    else
+        Queue_Watch_Event(watch, nullptr, "error");
+}
+
+
+static void on_watch_closed(uv_handle_t *handle)
+{
+    FREE(struct Reb_Fs_Watch, cast(struct Reb_Fs_Watch*, handle->data));
+}
+
+
+//
+//  Watch_Actor: C
+//
+Bounce Watch_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
+{
+    Context(*) ctx = VAL_CONTEXT(port);
+    struct Reb_Fs_Watch *watch = Fs_Watch_Of_Port(port);
+
+    switch (ID_OF_SYMBOL(verb)) {
+
+    //=//// REFLECT ////////////////////////////////////////////////////////=//
+
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+
+        UNUSED(ARG(value));  // implicitly comes from `port`
+        option(SymId) property = VAL_WORD_ID(ARG(property));
+
+        if (property == SYM_OPEN_Q)
+            return Init_Logic(OUT, did watch);
+
+        break; }
+
+    //=//// OPEN ///////////////////////////////////////////////////////////=//
+
+      case SYM_OPEN: {
+        INCLUDE_PARAMS_OF_OPEN;
+        UNUSED(PARAM(spec));
+
+        if (REF(new) or REF(read) or REF(write))
+            fail (Error_Bad_Refines_Raw());
+
+        if (watch)
+            fail (Error_Already_Open_Raw(port));
+
+        REBVAL *spec = CTX_VAR(ctx, STD_PORT_SPEC);
+        if (not IS_OBJECT(spec))
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        REBVAL *path = Obj_Value(spec, STD_PORT_SPEC_HEAD_REF);
+        if (path and IS_URL(path))
+            path = Obj_Value(spec, STD_PORT_SPEC_HEAD_PATH);
+        if (path == nullptr or not IS_FILE(path))
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        REBVAL *recursive = Obj_Value(spec, STD_PORT_SPEC_WATCH_RECURSIVE);
+        REBVAL *interval = Obj_Value(spec, STD_PORT_SPEC_WATCH_INTERVAL);
+
+        unsigned int flags = 0;
+        if (recursive and IS_LOGIC(recursive)) {
+            if (VAL_LOGIC(recursive))
+                flags |= UV_FS_EVENT_RECURSIVE;
+        }
+        else if (recursive and not Is_Nulled(recursive))
+            fail (Error_Invalid_Spec_Raw(recursive));
+
+        REBLEN interval_ms = 0;
+        if (interval and not Is_Nulled(interval)) {
+            if (not (IS_TIME(interval) or IS_INTEGER(interval)))
+                fail (Error_Invalid_Spec_Raw(interval));
+            interval_ms = Milliseconds_From_Value(interval);
+            if (interval_ms == 0)
+                fail (Error_Invalid_Spec_Raw(interval));
+        }
+
+        watch = TRY_ALLOC(struct Reb_Fs_Watch);
+        if (not watch)
+            fail (Error_No_Memory(sizeof(struct Reb_Fs_Watch)));
+
+        char *path_utf8 = rebSpell("file-to-local/full/no-tail-slash", path);
+
+        int result;
+        if (interval_ms != 0) {
+            watch->polling = true;
+            uv_fs_poll_init(uv_default_loop(), &watch->handle.poll);
+            watch->handle.poll.data = watch;
+            result = uv_fs_poll_start(
+                &watch->handle.poll, &on_fs_poll, path_utf8, interval_ms
+            );
+        }
+        else {
+            watch->polling = false;
+            uv_fs_event_init(uv_default_loop(), &watch->handle.event);
+            watch->handle.event.data = watch;
+            result = uv_fs_event_start(
+                &watch->handle.event, &on_fs_event, path_utf8, flags
+            );
+        }
+
+        rebFree(path_utf8);
+
+        if (result < 0) {
+            uv_close(cast(uv_handle_t*, &watch->handle), &on_watch_closed);
+            fail (Error_Cannot_Open_Raw(path, rebError_UV(result)));
+        }
+
+        watch->port = rebUnmanage(rebValue(port));
+
+        Init_Block(CTX_VAR(ctx, STD_PORT_DATA), Make_Array(0));
+        Init_Handle_Cdata(
+            CTX_VAR(ctx, STD_PORT_STATE),
+            watch,
+            sizeof(struct Reb_Fs_Watch)
+        );
+
+        return COPY(port); }
+
+    //=//// READ ///////////////////////////////////////////////////////////=//
+    //
+    // Gives back the events so far (and clears them), or waits for some.
+
+      case SYM_READ: {
+        INCLUDE_PARAMS_OF_READ;
+        UNUSED(PARAM(source));
+
+        if (
+            REF(part) or REF(seek) or REF(string) or REF(lines)
+            or REF(into) or REF(mapped)
+        ){
+            fail (Error_Bad_Refines_Raw());
+        }
+
+        if (not watch)
+            fail (Error_Not_Open_Raw(port));
+
+        REBVAL *data = CTX_VAR(ctx, STD_PORT_DATA);
+        while (VAL_LEN_AT(data) == 0)  // callbacks can only append to it
+            uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+        Copy_Cell(OUT, data);
+        Init_Block(data, Make_Array(0));
+        return OUT; }
+
+    //=//// CLOSE //////////////////////////////////////////////////////////=//
+
+      case SYM_CLOSE: {
+        INCLUDE_PARAMS_OF_CLOSE;
+        UNUSED(PARAM(port));
+
+        if (watch) {
+            if (watch->polling)
+                uv_fs_poll_stop(&watch->handle.poll);
+            else
+                uv_fs_event_stop(&watch->handle.event);
+
+            rebRelease(watch->port);  // no more callbacks will use it
+            uv_close(cast(uv_handle_t*, &watch->handle), &on_watch_closed);
+
+            Init_Nulled(CTX_VAR(ctx, STD_PORT_STATE));
+        }
+        return COPY(port); }
+
+      default:
+        break;
+    }
+
+    fail (UNHANDLED);
+}
@@ -0,0 +1,504 @@
+//
+//  File: %read-deep.c
+//  Summary: "recursive directory traversal with requests run in parallel"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// READ of a directory gives one level, so recursing over it in usermode (as
+// %tools/read-deep.reb does) pays for a readdir and then a stat per entry,
+// each waiting on the last.  On network filesystems with millions of files
+// the latency of those round trips is what dominates.
+//
+// READ-DEEP instead keeps many uv_fs_scandir() and uv_fs_lstat() requests in
+// flight at once on libuv's threadpool.  The callbacks run on the main thread
+// inside uv_run(), but only fill in C structures--Rebol values are made once
+// the whole tree has been walked, so nothing can fail() out from under libuv.
+//
+// * Symbolic links are listed, but not followed into.  (/INFO gives the size
+//   and date of the link itself.)
+//
+// * Subdirectories that can't be read (e.g. permissions) are listed without
+//   their contents.  Only failing to read the root is an error.
+//
+// * libuv's threadpool has 4 threads unless UV_THREADPOOL_SIZE is set in the
+//   environment before its first use.  Issuing more requests than that only
+//   queues them, but keeps the pool from ever going idle waiting on us.
+//
+
+#include "reb-config.h"
+
+#include "uv.h"  // includes windows.h
+#if TO_WINDOWS
+    #undef IS_ERROR  // windows.h defines, contentious with IS_ERROR in Ren-C
+    #undef OUT  // %minwindef.h defines this, we have a better use for it
+    #undef VOID  // %winnt.h defines this, we have a better use for it
+#endif
+
+#include "sys-core.h"
+
+#include "file-req.h"
+
+
+extern REBVAL *rebError_UV(int err);
+extern REBVAL *File_Time_To_Rebol(uv_timespec_t uvtime);
+
+#define DEEP_MAX_IN_FLIGHT 64
+
+#define DEEP_ROOT -1  // "entry index" of the root directory
+
+
+typedef struct {
+    char *path;  // relative to the root, '/' separated, no trailing slash
+    int depth;  // 1 for entries directly in the root
+    bool is_dir;
+    bool listed;  // false if only kept to find out if it's a directory
+    bool have_stat;
+    int64_t size;
+    uv_timespec_t mtime;
+} Reb_Deep_Entry;
+
+typedef struct {
+    REBINT *items;
+    REBLEN head;
+    REBLEN tail;
+    REBLEN capacity;
+} Reb_Deep_Queue;
+
+typedef struct {
+    char *root;  // local format, ends in a separator
+    Size root_size;
+    bool want_info;
+    const char *pattern;  // nullptr for no filter
+    REBINT max_depth;  // 0 for no limit
+
+    Reb_Deep_Entry *entries;
+    REBLEN num_entries;
+    REBLEN entries_capacity;
+
+    Reb_Deep_Queue dirs;  // entry indices waiting to be scanned
+    Reb_Deep_Queue stats;  // entry indices waiting to be stat'd
+
+    int in_flight;
+    int error;  // libuv error code, for the root or out of memory
+} Reb_Deep_Walk;
+
+typedef struct {
+    uv_fs_t req;
+    Reb_Deep_Walk *walk;
+    REBINT entry;
+} Reb_Deep_Request;
+
+
+// Match a name against a pattern where `*` is any run of characters and `?`
+// is any one character.  When a `*` fails to match, retry it one character
+// further along (only the last `*` ever needs to be retried).
+//
+static bool Wildcard_Match(const char *pattern, const char *name)
+{
+    const char *star = nullptr;
+    const char *resume = nullptr;
+
+    while (*name != '\0') {
+        if (*pattern == '*') {
+            star = pattern++;
+            resume = name;
+        }
+        else if (*pattern == '?') {
+            ++pattern;
+            do
+                ++name;
+            while ((*name & 0xC0) == 0x80);  // skip UTF-8 continuation bytes
+        }
+        else if (*pattern == *name) {
+            ++pattern;
+            ++name;
+        }
+        else if (star) {
+            pattern = star + 1;
+            name = ++resume;
+        }
+        else
+            return false;
+    }
+
+    while (*pattern == '*')
+        ++pattern;
+    return *pattern == '\0';
+}
+
+
+static bool Push_Deep_Queue(Reb_Deep_Walk *walk, Reb_Deep_Queue *q, REBINT i)
+{
+    if (q->tail == q->capacity) {
+        if (q->head != 0) {  // slide down taken items before growing
+            memmove(
+                q->items,
+                q->items + q->head,
+                (q->tail - q->head) * sizeof(REBINT)
+            );
+            q->tail -= q->head;
+            q->head = 0;
+        }
+        else {
+            REBLEN capacity = q->capacity == 0 ? 256 : q->capacity * 2;
+            REBINT *items = TRY_ALLOC_N(REBINT, capacity);
+            if (not items) {
+                walk->error = UV_ENOMEM;
+                return false;
+            }
+            if (q->items) {
+                memcpy(items, q->items, q->tail * sizeof(REBINT));
+                FREE_N(REBINT, q->capacity, q->items);
+            }
+            q->items = items;
+            q->capacity = capacity;
+        }
+    }
+    q->items[q->tail++] = i;
+    return true;
+}
+
+
+static void Queue_Deep_Dir(Reb_Deep_Walk *walk, REBINT entry)
+{
+    if (
+        walk->max_depth == 0
+        or walk->entries[entry].depth < walk->max_depth
+    ){
+        Push_Deep_Queue(walk, &walk->dirs, entry);
+    }
+}
+
+
+// Full local path of an entry, for passing to libuv (which copies it).
+// Entry paths use '/', which Windows accepts as a separator too.
+//
+static char *Try_Deep_Full_Path(Reb_Deep_Walk *walk, REBINT entry, Size *n)
+{
+    const char *path = entry == DEEP_ROOT ? "" : walk->entries[entry].path;
+    Size path_size = strlen(path);
+
+    *n = walk->root_size + path_size + 1;
+    char *full = TRY_ALLOC_N(char, *n);
+    if (not full)
+        return nullptr;
+
+    memcpy(full, walk->root, walk->root_size);
+    memcpy(full + walk->root_size, path, path_size + 1);
+    return full;
+}
+
+
+static void on_deep_scandir(uv_fs_t *req);
+static void on_deep_stat(uv_fs_t *req);
+
+
+// Issue requests until the limit, preferring directory scans (they are what
+// discover more work).  Called to start, and at the end of each callback.
+//
+static void Pump_Deep_Walk(Reb_Deep_Walk *walk)
+{
+    while (walk->in_flight < DEEP_MAX_IN_FLIGHT and walk->error == 0) {
+        Reb_Deep_Queue *q;
+        if (walk->dirs.head != walk->dirs.tail)
+            q = &walk->dirs;
+        else if (walk->stats.head != walk->stats.tail)
+            q = &walk->stats;
+        else
+            break;
+
+        REBINT entry = q->items[q->head++];
+
+        Size n;
+        char *path = Try_Deep_Full_Path(walk, entry, &n);
+        Reb_Deep_Request *r = TRY_ALLOC(Reb_Deep_Request);
+        if (not path or not r) {
+            if (path)
+                FREE_N(char, n, path);
+            if (r)
+                FREE(Reb_Deep_Request, r);
+            walk->error = UV_ENOMEM;
+            break;
+        }
+
+        r->req.data = r;
+        r->walk = walk;
+        r->entry = entry;
+
+        int result;
+        if (q == &walk->dirs)
+            result = uv_fs_scandir(
+                uv_default_loop(), &r->req, path, 0, &on_deep_scandir
+            );
+        else
+            result = uv_fs_lstat(
+                uv_default_loop(), &r->req, path, &on_deep_stat
+            );
+
+        FREE_N(char, n, path);
+
+        if (result < 0) {  // not queued, so no callback will come
+            FREE(Reb_Deep_Request, r);
+            if (entry == DEEP_ROOT)
+                walk->error = result;
+            continue;
+        }
+
+        ++walk->in_flight;
+    }
+}
+
+
+static void Add_Deep_Entry(
+    Reb_Deep_Walk *walk,
+    REBINT parent,
+    const uv_dirent_t *dirent
+){
+    if (walk->num_entries == walk->entries_capacity) {
+        REBLEN capacity = walk->entries_capacity == 0
+            ? 256
+            : walk->entries_capacity * 2;
+        Reb_Deep_Entry *entries = TRY_ALLOC_N(Reb_Deep_Entry, capacity);
+        if (not entries) {
+            walk->error = UV_ENOMEM;
+            return;
+        }
+        if (walk->entries) {
+            memcpy(
+                entries,
+                walk->entries,
+                walk->num_entries * sizeof(Reb_Deep_Entry)
+            );
+            FREE_N(Reb_Deep_Entry, walk->entries_capacity, walk->entries);
+        }
+        walk->entries = entries;
+        walk->entries_capacity = capacity;
+    }
+
+    // Parent is looked up after growing, which may have moved the entries.
+    //
+    const char *parent_path;
+    Size parent_size;  // includes a '/' after it, if not the root
+    int depth;
+    if (parent == DEEP_ROOT) {
+        parent_path = nullptr;
+        parent_size = 0;
+        depth = 1;
+    }
+    else {
+        parent_path = walk->entries[parent].path;
+        parent_size = strlen(parent_path) + 1;
+        depth = walk->entries[parent].depth + 1;
+    }
+
+    Size name_size = strlen(dirent->name);
+    char *path = TRY_ALLOC_N(char, parent_size + name_size + 1);
+    if (not path) {
+        walk->error = UV_ENOMEM;
+        return;
+    }
+    if (parent_path) {
+        memcpy(path, parent_path, parent_size - 1);
+        path[parent_size - 1] = '/';
+    }
+    memcpy(path + parent_size, dirent->name, name_size + 1);
+
+    REBINT entry = walk->num_entries++;
+    Reb_Deep_Entry *e = &walk->entries[entry];
+    e->path = path;
+    e->depth = depth;
+    e->is_dir = (dirent->type == UV_DIRENT_DIR);
+    e->listed = (
+        walk->pattern == nullptr
+        or Wildcard_Match(walk->pattern, dirent->name)
+    );
+    e->have_stat = false;
+
+    // Some filesystems don't give the type in the directory listing, so it
+    // takes a stat to know whether to descend.  A directory that is being
+    // stat'd anyway is queued for scanning when the stat comes back.
+    //
+    if ((e->listed and walk->want_info) or dirent->type == UV_DIRENT_UNKNOWN)
+        Push_Deep_Queue(walk, &walk->stats, entry);
+    else if (e->is_dir)
+        Queue_Deep_Dir(walk, entry);
+}
+
+
+static void on_deep_scandir(uv_fs_t *req)
+{
+    Reb_Deep_Request *r = cast(Reb_Deep_Request*, req->data);
+    Reb_Deep_Walk *walk = r->walk;
+    --walk->in_flight;
+
+    if (req->result < 0) {
+        if (r->entry == DEEP_ROOT)
+            walk->error = req->result;
+    }
+    else {
+        uv_dirent_t dirent;
+        while (
+            walk->error == 0
+            and uv_fs_scandir_next(req, &dirent) != UV_EOF
+        ){
+            Add_Deep_Entry(walk, r->entry, &dirent);
+        }
+    }
+
+    uv_fs_req_cleanup(req);
+    FREE(Reb_Deep_Request, r);
+
+    Pump_Deep_Walk(walk);
+}
+
+
+static void on_deep_stat(uv_fs_t *req)
+{
+    Reb_Deep_Request *r = cast(Reb_Deep_Request*, req->data);
+    Reb_Deep_Walk *walk = r->walk;
+    --walk->in_flight;
+
+    Reb_Deep_Entry *e = &walk->entries[r->entry];
+    if (req->result == 0) {  // else e.g. deleted since listed, give no info
+        e->have_stat = true;
+        e->is_dir = S_ISDIR(req->statbuf.st_mode);
+        e->size = req->statbuf.st_size;
+        e->mtime = req->statbuf.st_mtim;
+    }
+    if (e->is_dir)
+        Queue_Deep_Dir(walk, r->entry);
+
+    uv_fs_req_cleanup(req);
+    FREE(Reb_Deep_Request, r);
+
+    Pump_Deep_Walk(walk);
+}
+
+
+static int Deep_Entry_Compare(const void *a, const void *b) {
+    return strcmp(
+        cast(const Reb_Deep_Entry*, a)->path,
+        cast(const Reb_Deep_Entry*, b)->path
+    );
+}
+
+
+static void Free_Deep_Walk(Reb_Deep_Walk *walk)
+{
+    REBLEN i;
+    for (i = 0; i < walk->num_entries; ++i) {
+        char *path = walk->entries[i].path;
+        FREE_N(char, strlen(path) + 1, path);
+    }
+    if (walk->entries)
+        FREE_N(Reb_Deep_Entry, walk->entries_capacity, walk->entries);
+    if (walk->dirs.items)
+        FREE_N(REBINT, walk->dirs.capacity, walk->dirs.items);
+    if (walk->stats.items)
+        FREE_N(REBINT, walk->stats.capacity, walk->stats.items);
+}
+
+
+//
+//  Read_Deep: C
+//
+// Gives back a BLOCK! of the tree under the `root` directory, sorted, or an
+// ERROR! if the root couldn't be read.  See READ-DEEP for the options.
+//
+REBVAL *Read_Deep(
+    const REBVAL *root,
+    bool full,
+    bool info,
+    bool files,  // include entries that are not directories
+    bool dirs,  // include directories
+    const char *pattern,
+    REBINT max_depth
+){
+    assert(IS_FILE(root));
+
+    Reb_Deep_Walk walk;
+    memset(&walk, 0, sizeof(walk));
+    walk.want_info = info;
+    walk.pattern = pattern;
+    walk.max_depth = max_depth;
+
+    walk.root = rebSpell("file-to-local/full", root);  // keeps trailing slash
+    walk.root_size = strlen(walk.root);
+
+    Push_Deep_Queue(&walk, &walk.dirs, DEEP_ROOT);
+    Pump_Deep_Walk(&walk);
+    while (walk.in_flight > 0)
+        uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+    rebFree(walk.root);
+
+    if (walk.error != 0) {
+        Free_Deep_Walk(&walk);
+        return rebError_UV(walk.error);
+    }
+
+    // Requests finish in whatever order the threadpool gets to them, so sort
+    // to give the same answer every time (parents come before children).
+    //
+    if (walk.num_entries != 0)
+        qsort(
+            walk.entries,
+            walk.num_entries,
+            sizeof(Reb_Deep_Entry),
+            &Deep_Entry_Compare
+        );
+
+    StackIndex base = TOP_INDEX;
+
+    REBLEN i;
+    for (i = 0; i < walk.num_entries; ++i) {
+        Reb_Deep_Entry *e = &walk.entries[i];
+        if (not e->listed or not (e->is_dir ? dirs : files))
+            continue;
+
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+        if (full)
+            Append_String(mo->series, root);
+        Append_Utf8(mo->series, e->path, strlen(e->path));
+        if (e->is_dir)
+            Append_Codepoint(mo->series, '/');
+        Init_File(PUSH(), Pop_Molded_String(mo));
+
+        if (not info)
+            continue;
+
+        if (e->is_dir or not e->have_stat)
+            Init_Blank(PUSH());
+        else
+            Init_Integer(PUSH(), e->size);
+
+        if (not e->have_stat)
+            Init_Blank(PUSH());
+        else {
+            REBVAL *date = File_Time_To_Rebol(e->mtime);
+            Copy_Cell(PUSH(), date);
+            rebRelease(date);
+        }
+    }
+
+    Free_Deep_Walk(&walk);
+
+    return Init_Block(Alloc_Value(), Pop_Stack_Values(base));
+}
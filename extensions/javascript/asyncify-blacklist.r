@@ -32,3 +32,12 @@
 ; be looked into.
 ;
 "Fail_Core"
+
+; A JS-AWAITER that has to wait suspends by returning BOUNCE_SUSPEND to the
+; trampoline (stackless), not with emscripten_sleep().  So the dispatcher and
+; the C half of resolve() and reject() never yield, and keeping them out of
+; the instrumentation matters for apps making many JS-NATIVE calls.
+;
+"JavaScript_Dispatcher"
+"RL_rebResolveNative_internal"
+"RL_rebRejectNative_internal"
@@ -279,6 +279,11 @@ inline static REBVAL *Value_From_Value_Id(heapaddr_t id) {
 inline static heapaddr_t Native_Id_For_Action(Action(*) act)
   { return Heapaddr_From_Pointer(ACT_KEYLIST(act)); }
 
+// Non-awaiters pass their argument addresses to JavaScript in an array, which
+// is on the C stack unless there are more arguments than this.
+//
+#define JS_NATIVE_MAX_STACK_ARGS 16
+
 enum {
     IDX_JS_NATIVE_OBJECT = IDX_NATIVE_MAX,
             // ^-- handle gives hookpoint for GC of table entry
@@ -669,6 +674,20 @@ EXTERN_C void RL_rebRejectNative_internal(
 //    convert it to a throw.  For now, the halt signal is communicated
 //    uniquely back to us as 0.
 //
+// 4. Non-awaiters are the common case (e.g. a browser app making thousands
+//    of small calls to the DOM), and they can never suspend.  So they skip
+//    the resolve() and reject() closures and the reentry into C through
+//    rebResolveNative_internal(): the result comes back as the EM_ASM_INT()
+//    return value.  Only a rejection still goes through the C export.
+//
+// 5. reb.ArgR("name") would otherwise pack the name onto the emscripten
+//    stack, call into C, intern the UTF-8 and search the keylist for every
+//    argument fetched.  Instead the addresses of all the arguments are put
+//    in one array up front, and the JS side of reb.ArgR() indexes into it
+//    by a name map made when the JS-NATIVE was created.  The array only has
+//    to live as long as the EM_ASM_INT() call, since non-awaiters can't
+//    outlive it.
+//
 Bounce JavaScript_Dispatcher(Frame(*) frame_)
 {
     Frame(*) f = frame_;
@@ -718,30 +737,29 @@ Bounce JavaScript_Dispatcher(Frame(*) frame_)
 
     STATE = ST_JS_NATIVE_RUNNING;  // resolve/reject change this STATE byte
 
+    if (not is_awaiter)
+        goto run_synchronous;
+
     EM_ASM(
         { reb.RunNative_internal($0, $1) },
         native_id,  // => $0, how it finds the javascript code to run
         frame_id  // => $1, how it knows to find this frame to update STATE
     );
 
-    if (not is_awaiter)  // same tactic for non-awaiter, see [1]
-        assert(STATE != ST_JS_NATIVE_RUNNING);
-    else {
-        if (STATE == ST_JS_NATIVE_RUNNING) {
-            TRACE(
-                "JavaScript_Dispatcher(%s) => suspending incomplete awaiter",
-                Frame_Label_Or_Anonymous_UTF8(f)
-            );
+    if (STATE == ST_JS_NATIVE_RUNNING) {
+        TRACE(
+            "JavaScript_Dispatcher(%s) => suspending incomplete awaiter",
+            Frame_Label_Or_Anonymous_UTF8(f)
+        );
 
-            // Note that reb.Halt() can force promise rejection, by way of the
-            // triggering of a cancellation signal.  See implementation notes
-            // for `reb.CancelAllCancelables_internal()`.
-            //
-            /* emscripten_sleep(50); */
+        // Note that reb.Halt() can force promise rejection, by way of the
+        // triggering of a cancellation signal.  See implementation notes
+        // for `reb.CancelAllCancelables_internal()`.
+        //
+        /* emscripten_sleep(50); */
 
-            STATE = ST_JS_NATIVE_SUSPENDED;
-            return BOUNCE_SUSPEND;  // signals trampoline to leave stack
-        }
+        STATE = ST_JS_NATIVE_SUSPENDED;
+        return BOUNCE_SUSPEND;  // signals trampoline to leave stack
     }
 
     if (STATE == ST_JS_NATIVE_RESOLVED)
@@ -752,6 +770,52 @@ Bounce JavaScript_Dispatcher(Frame(*) frame_)
 
     fail ("Unknown frame STATE value after reb.RunNative_internal()");
 
+} run_synchronous: {  ////////////////////////////////////////////////////////
+
+    // Same tactic for non-awaiter, see [1], but with a shortcut, see [4]
+
+    REBLEN num_args = FRM_NUM_ARGS(f);
+
+    heapaddr_t arg_ids_buf[JS_NATIVE_MAX_STACK_ARGS];
+    heapaddr_t *arg_ids = num_args <= JS_NATIVE_MAX_STACK_ARGS
+        ? arg_ids_buf
+        : rebAllocN(heapaddr_t, num_args);
+
+    REBVAL *arg = FRM_ARGS_HEAD(f);
+    REBLEN n;
+    for (n = 0; n < num_args; ++n, ++arg) {  // batch arg lookup, see [5]
+        if (Is_Nulled(arg))
+            arg_ids[n] = 0;  // no nulled cells in the API, as with rebArgR()
+        else
+            arg_ids[n] = Heapaddr_From_Pointer(arg);
+    }
+
+    heapaddr_t result_id = EM_ASM_INT(
+        { return reb.RunNativeSync_internal($0, $1, $2) },
+        native_id,  // => $0, how it finds the javascript code to run
+        frame_id,  // => $1, only used if the native rejects
+        arg_ids  // => $2, what the JS side of reb.ArgR() reads from
+    );
+
+    if (arg_ids != arg_ids_buf)
+        rebFree(arg_ids);
+
+    if (STATE == ST_JS_NATIVE_REJECTED)
+        goto handle_rejected;
+
+    assert(STATE == ST_JS_NATIVE_RUNNING);
+
+    REBVAL *result = Value_From_Value_Id(result_id);
+    if (result == nullptr)
+        Init_Nulled(OUT);
+    else {
+        Copy_Cell(OUT, result);
+        rebRelease(result);
+    }
+
+    STATE = ST_JS_NATIVE_RESOLVED;
+    goto handle_resolved;
+
 } handle_resolved: {  ////////////////////////////////////////////////////////
 
     FAIL_IF_BAD_RETURN_TYPE(f);
@@ -881,9 +945,41 @@ DECLARE_NATIVE(js_native)
 
     if (REF(awaiter))
         Append_Ascii(mo->series, "f.is_awaiter = true;\n");
-    else
+    else {
         Append_Ascii(mo->series, "f.is_awaiter = false;\n");
 
+        // Non-awaiters get their argument addresses as an array, so the JS
+        // side of reb.ArgR() needs a map from name to position in it.  (See
+        // notes on JavaScript_Dispatcher().)  Names that can't be put in a
+        // string literal as-is are left out, and looked up the slow way.
+        //
+        Append_Ascii(mo->series, "f.arg_index = new Map([");
+
+        const REBKEY *tail;
+        const REBKEY *key = ACT_KEYS(&tail, native);
+        REBLEN n;
+        for (n = 0; key != tail; ++key, ++n) {
+            Symbol(const*) symbol = KEY_SYMBOL(key);
+            if (
+                strchr(STR_UTF8(symbol), '"')
+                or strchr(STR_UTF8(symbol), '\\')
+            ){
+                continue;
+            }
+
+            Byte index_buf[60];
+            REBINT index_len = Emit_Integer(index_buf, n);
+
+            Append_Ascii(mo->series, "[\"");
+            Append_Spelling(mo->series, symbol);
+            Append_Ascii(mo->series, "\", ");
+            Append_Ascii_Len(mo->series, s_cast(index_buf), index_len);
+            Append_Ascii(mo->series, "], ");
+        }
+
+        Append_Ascii(mo->series, "]);\n");
+    }
+
     Byte id_buf[60];  // !!! Why 60?  Copied from MF_Integer()
     REBINT len = Emit_Integer(id_buf, native_id);
 
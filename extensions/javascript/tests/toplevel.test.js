@@ -31,5 +31,12 @@ function toplevelTest() {
 
     logTest(1, 3 == reb.UnboxInteger("1 + 2"))
 
+    let view = reb.MallocView(3)
+    view.set([1, 2, 3])
+    let binary = reb.RepossessView(view)
+    logTest(2, reb.Did(binary, "= #{010203}"))
+    reb.BytesView(binary)[1] = 255
+    logTest(3, reb.Did(reb.R(binary), "= #{01FF03}"))
+
     return all_pass
 }
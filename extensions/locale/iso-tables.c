@@ -0,0 +1,478 @@
+//
+//  File: %iso-tables.c
+//  Summary: "ISO 639 language and ISO 3166 territory names, for LOCALE"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// DO NOT EDIT this file.  It is rewritten by %iso639.r and %iso3166.r.
+//
+// These were MAP!s made by %ext-locale-init.reb when the extension loaded,
+// whether LOCALE was ever called or not.  As constant arrays sorted by code
+// they cost nothing until ISO-NAME does a binary search of one.
+//
+
+#include <stddef.h>  // size_t
+
+#include "iso-tables.h"
+
+
+//=//// ISO 639 ///////////////////////////////////////////////////////////=//
+//
+// Sorted by code for bsearch(), names are UTF-8 (non-ASCII bytes as octal)
+//
+// Updated by %iso639.r from %ISO-639-2_utf-8.txt
+//
+const struct Iso_Code_Name Iso_639_Table[] = {
+    {"aa", "Afar"},
+    {"ab", "Abkhazian"},
+    {"ae", "Avestan"},
+    {"af", "Afrikaans"},
+    {"ak", "Akan"},
+    {"am", "Amharic"},
+    {"an", "Aragonese"},
+    {"ar", "Arabic"},
+    {"as", "Assamese"},
+    {"av", "Avaric"},
+    {"ay", "Aymara"},
+    {"az", "Azerbaijani"},
+    {"ba", "Bashkir"},
+    {"be", "Belarusian"},
+    {"bg", "Bulgarian"},
+    {"bh", "Bihari languages"},
+    {"bi", "Bislama"},
+    {"bm", "Bambara"},
+    {"bn", "Bengali"},
+    {"bo", "Tibetan"},
+    {"br", "Breton"},
+    {"bs", "Bosnian"},
+    {"ca", "Catalan; Valencian"},
+    {"ce", "Chechen"},
+    {"ch", "Chamorro"},
+    {"co", "Corsican"},
+    {"cr", "Cree"},
+    {"cs", "Czech"},
+    {"cu", "Church Slavic; Old Slavonic; Church Slavonic; Old Bulgarian; Old Church Slavonic"},
+    {"cv", "Chuvash"},
+    {"cy", "Welsh"},
+    {"da", "Danish"},
+    {"de", "German"},
+    {"dv", "Divehi; Dhivehi; Maldivian"},
+    {"dz", "Dzongkha"},
+    {"ee", "Ewe"},
+    {"el", "Greek, Modern (1453-)"},
+    {"en", "English"},
+    {"eo", "Esperanto"},
+    {"es", "Spanish; Castilian"},
+    {"et", "Estonian"},
+    {"eu", "Basque"},
+    {"fa", "Persian"},
+    {"ff", "Fulah"},
+    {"fi", "Finnish"},
+    {"fj", "Fijian"},
+    {"fo", "Faroese"},
+    {"fr", "French"},
+    {"fy", "Western Frisian"},
+    {"ga", "Irish"},
+    {"gd", "Gaelic; Scottish Gaelic"},
+    {"gl", "Galician"},
+    {"gn", "Guarani"},
+    {"gu", "Gujarati"},
+    {"gv", "Manx"},
+    {"ha", "Hausa"},
+    {"he", "Hebrew"},
+    {"hi", "Hindi"},
+    {"ho", "Hiri Motu"},
+    {"hr", "Croatian"},
+    {"ht", "Haitian; Haitian Creole"},
+    {"hu", "Hungarian"},
+    {"hy", "Armenian"},
+    {"hz", "Herero"},
+    {"ia", "Interlingua (International Auxiliary Language Association)"},
+    {"id", "Indonesian"},
+    {"ie", "Interlingue; Occidental"},
+    {"ig", "Igbo"},
+    {"ii", "Sichuan Yi; Nuosu"},
+    {"ik", "Inupiaq"},
+    {"io", "Ido"},
+    {"is", "Icelandic"},
+    {"it", "Italian"},
+    {"iu", "Inuktitut"},
+    {"ja", "Japanese"},
+    {"jv", "Javanese"},
+    {"ka", "Georgian"},
+    {"kg", "Kongo"},
+    {"ki", "Kikuyu; Gikuyu"},
+    {"kj", "Kuanyama; Kwanyama"},
+    {"kk", "Kazakh"},
+    {"kl", "Kalaallisut; Greenlandic"},
+    {"km", "Central Khmer"},
+    {"kn", "Kannada"},
+    {"ko", "Korean"},
+    {"kr", "Kanuri"},
+    {"ks", "Kashmiri"},
+    {"ku", "Kurdish"},
+    {"kv", "Komi"},
+    {"kw", "Cornish"},
+    {"ky", "Kirghiz; Kyrgyz"},
+    {"la", "Latin"},
+    {"lb", "Luxembourgish; Letzeburgesch"},
+    {"lg", "Ganda"},
+    {"li", "Limburgan; Limburger; Limburgish"},
+    {"ln", "Lingala"},
+    {"lo", "Lao"},
+    {"lt", "Lithuanian"},
+    {"lu", "Luba-Katanga"},
+    {"lv", "Latvian"},
+    {"mg", "Malagasy"},
+    {"mh", "Marshallese"},
+    {"mi", "Maori"},
+    {"mk", "Macedonian"},
+    {"ml", "Malayalam"},
+    {"mn", "Mongolian"},
+    {"mr", "Marathi"},
+    {"ms", "Malay"},
+    {"mt", "Maltese"},
+    {"my", "Burmese"},
+    {"na", "Nauru"},
+    {"nb", "Bokm\303\245l, Norwegian; Norwegian Bokm\303\245l"},
+    {"nd", "Ndebele, North; North Ndebele"},
+    {"ne", "Nepali"},
+    {"ng", "Ndonga"},
+    {"nl", "Dutch; Flemish"},
+    {"nn", "Norwegian Nynorsk; Nynorsk, Norwegian"},
+    {"no", "Norwegian"},
+    {"nr", "Ndebele, South; South Ndebele"},
+    {"nv", "Navajo; Navaho"},
+    {"ny", "Chichewa; Chewa; Nyanja"},
+    {"oc", "Occitan (post 1500); Proven\303\247al"},
+    {"oj", "Ojibwa"},
+    {"om", "Oromo"},
+    {"or", "Oriya"},
+    {"os", "Ossetian; Ossetic"},
+    {"pa", "Panjabi; Punjabi"},
+    {"pi", "Pali"},
+    {"pl", "Polish"},
+    {"ps", "Pushto; Pashto"},
+    {"pt", "Portuguese"},
+    {"qu", "Quechua"},
+    {"rm", "Romansh"},
+    {"rn", "Rundi"},
+    {"ro", "Romanian; Moldavian; Moldovan"},
+    {"ru", "Russian"},
+    {"rw", "Kinyarwanda"},
+    {"sa", "Sanskrit"},
+    {"sc", "Sardinian"},
+    {"sd", "Sindhi"},
+    {"se", "Northern Sami"},
+    {"sg", "Sango"},
+    {"si", "Sinhala; Sinhalese"},
+    {"sk", "Slovak"},
+    {"sl", "Slovenian"},
+    {"sm", "Samoan"},
+    {"sn", "Shona"},
+    {"so", "Somali"},
+    {"sq", "Albanian"},
+    {"sr", "Serbian"},
+    {"ss", "Swati"},
+    {"st", "Sotho, Southern"},
+    {"su", "Sundanese"},
+    {"sv", "Swedish"},
+    {"sw", "Swahili"},
+    {"ta", "Tamil"},
+    {"te", "Telugu"},
+    {"tg", "Tajik"},
+    {"th", "Thai"},
+    {"ti", "Tigrinya"},
+    {"tk", "Turkmen"},
+    {"tl", "Tagalog"},
+    {"tn", "Tswana"},
+    {"to", "Tonga (Tonga Islands)"},
+    {"tr", "Turkish"},
+    {"ts", "Tsonga"},
+    {"tt", "Tatar"},
+    {"tw", "Twi"},
+    {"ty", "Tahitian"},
+    {"ug", "Uighur; Uyghur"},
+    {"uk", "Ukrainian"},
+    {"ur", "Urdu"},
+    {"uz", "Uzbek"},
+    {"ve", "Venda"},
+    {"vi", "Vietnamese"},
+    {"vo", "Volap\303\274k"},
+    {"wa", "Walloon"},
+    {"wo", "Wolof"},
+    {"xh", "Xhosa"},
+    {"yi", "Yiddish"},
+    {"yo", "Yoruba"},
+    {"za", "Zhuang; Chuang"},
+    {"zh", "Chinese"},
+    {"zu", "Zulu"},
+};
+
+const size_t Iso_639_Table_Count =
+    sizeof(Iso_639_Table) / sizeof(Iso_639_Table[0]);
+
+
+//=//// ISO 3166 //////////////////////////////////////////////////////////=//
+//
+// Sorted by code for bsearch(), names are UTF-8 (non-ASCII bytes as octal)
+//
+// Updated by %iso3166.r from %iso3166.txt
+//
+const struct Iso_Code_Name Iso_3166_Table[] = {
+    {"AD", "Andorra"},
+    {"AE", "United Arab Emirates"},
+    {"AF", "Afghanistan"},
+    {"AG", "Antigua And Barbuda"},
+    {"AI", "Anguilla"},
+    {"AL", "Albania"},
+    {"AM", "Armenia"},
+    {"AO", "Angola"},
+    {"AQ", "Antarctica"},
+    {"AR", "Argentina"},
+    {"AS", "American Samoa"},
+    {"AT", "Austria"},
+    {"AU", "Australia"},
+    {"AW", "Aruba"},
+    {"AX", "\303\205land Islands"},
+    {"AZ", "Azerbaijan"},
+    {"BA", "Bosnia And Herzegovina"},
+    {"BB", "Barbados"},
+    {"BD", "Bangladesh"},
+    {"BE", "Belgium"},
+    {"BF", "Burkina Faso"},
+    {"BG", "Bulgaria"},
+    {"BH", "Bahrain"},
+    {"BI", "Burundi"},
+    {"BJ", "Benin"},
+    {"BL", "Saint Barth\303\251lemy"},
+    {"BM", "Bermuda"},
+    {"BN", "Brunei Darussalam"},
+    {"BO", "Bolivia, Plurinational State of"},
+    {"BQ", "Bonaire, Sint Eustatius And Saba"},
+    {"BR", "Brazil"},
+    {"BS", "Bahamas"},
+    {"BT", "Bhutan"},
+    {"BV", "Bouvet Island"},
+    {"BW", "Botswana"},
+    {"BY", "Belarus"},
+    {"BZ", "Belize"},
+    {"CA", "Canada"},
+    {"CC", "Cocos (keeling) Islands"},
+    {"CD", "Congo, The Democratic Republic of The"},
+    {"CF", "Central African Republic"},
+    {"CG", "Congo"},
+    {"CH", "Switzerland"},
+    {"CI", "C\303\264te D'ivoire"},
+    {"CK", "Cook Islands"},
+    {"CL", "Chile"},
+    {"CM", "Cameroon"},
+    {"CN", "China"},
+    {"CO", "Colombia"},
+    {"CR", "Costa Rica"},
+    {"CU", "Cuba"},
+    {"CV", "Cape Verde"},
+    {"CW", "Cura\303\247ao"},
+    {"CX", "Christmas Island"},
+    {"CY", "Cyprus"},
+    {"CZ", "Czech Republic"},
+    {"DE", "Germany"},
+    {"DJ", "Djibouti"},
+    {"DK", "Denmark"},
+    {"DM", "Dominica"},
+    {"DO", "Dominican Republic"},
+    {"DZ", "Algeria"},
+    {"EC", "Ecuador"},
+    {"EE", "Estonia"},
+    {"EG", "Egypt"},
+    {"EH", "Western Sahara"},
+    {"ER", "Eritrea"},
+    {"ES", "Spain"},
+    {"ET", "Ethiopia"},
+    {"FI", "Finland"},
+    {"FJ", "Fiji"},
+    {"FK", "Falkland Islands (malvinas)"},
+    {"FM", "Micronesia, Federated States of"},
+    {"FO", "Faroe Islands"},
+    {"FR", "France"},
+    {"GA", "Gabon"},
+    {"GB", "United Kingdom"},
+    {"GD", "Grenada"},
+    {"GE", "Georgia"},
+    {"GF", "French Guiana"},
+    {"GG", "Guernsey"},
+    {"GH", "Ghana"},
+    {"GI", "Gibraltar"},
+    {"GL", "Greenland"},
+    {"GM", "Gambia"},
+    {"GN", "Guinea"},
+    {"GP", "Guadeloupe"},
+    {"GQ", "Equatorial Guinea"},
+    {"GR", "Greece"},
+    {"GS", "South Georgia And The South Sandwich Islands"},
+    {"GT", "Guatemala"},
+    {"GU", "Guam"},
+    {"GW", "Guinea-bissau"},
+    {"GY", "Guyana"},
+    {"HK", "Hong Kong"},
+    {"HM", "Heard Island And Mcdonald Islands"},
+    {"HN", "Honduras"},
+    {"HR", "Croatia"},
+    {"HT", "Haiti"},
+    {"HU", "Hungary"},
+    {"ID", "Indonesia"},
+    {"IE", "Ireland"},
+    {"IL", "Israel"},
+    {"IM", "Isle of Man"},
+    {"IN", "India"},
+    {"IO", "British Indian Ocean Territory"},
+    {"IQ", "Iraq"},
+    {"IR", "Iran, Islamic Republic of"},
+    {"IS", "Iceland"},
+    {"IT", "Italy"},
+    {"JE", "Jersey"},
+    {"JM", "Jamaica"},
+    {"JO", "Jordan"},
+    {"JP", "Japan"},
+    {"KE", "Kenya"},
+    {"KG", "Kyrgyzstan"},
+    {"KH", "Cambodia"},
+    {"KI", "Kiribati"},
+    {"KM", "Comoros"},
+    {"KN", "Saint Kitts And Nevis"},
+    {"KP", "Korea, Democratic People's Republic of"},
+    {"KR", "Korea, Republic of"},
+    {"KW", "Kuwait"},
+    {"KY", "Cayman Islands"},
+    {"KZ", "Kazakhstan"},
+    {"LA", "Lao People's Democratic Republic"},
+    {"LB", "Lebanon"},
+    {"LC", "Saint Lucia"},
+    {"LI", "Liechtenstein"},
+    {"LK", "Sri Lanka"},
+    {"LR", "Liberia"},
+    {"LS", "Lesotho"},
+    {"LT", "Lithuania"},
+    {"LU", "Luxembourg"},
+    {"LV", "Latvia"},
+    {"LY", "Libya"},
+    {"MA", "Morocco"},
+    {"MC", "Monaco"},
+    {"MD", "Moldova, Republic of"},
+    {"ME", "Montenegro"},
+    {"MF", "Saint Martin (french Part)"},
+    {"MG", "Madagascar"},
+    {"MH", "Marshall Islands"},
+    {"MK", "Macedonia, The Former Yugoslav Republic of"},
+    {"ML", "Mali"},
+    {"MM", "Myanmar"},
+    {"MN", "Mongolia"},
+    {"MO", "Macao"},
+    {"MP", "Northern Mariana Islands"},
+    {"MQ", "Martinique"},
+    {"MR", "Mauritania"},
+    {"MS", "Montserrat"},
+    {"MT", "Malta"},
+    {"MU", "Mauritius"},
+    {"MV", "Maldives"},
+    {"MW", "Malawi"},
+    {"MX", "Mexico"},
+    {"MY", "Malaysia"},
+    {"MZ", "Mozambique"},
+    {"NA", "Namibia"},
+    {"NC", "New Caledonia"},
+    {"NE", "Niger"},
+    {"NF", "Norfolk Island"},
+    {"NG", "Nigeria"},
+    {"NI", "Nicaragua"},
+    {"NL", "Netherlands"},
+    {"NO", "Norway"},
+    {"NP", "Nepal"},
+    {"NR", "Nauru"},
+    {"NU", "Niue"},
+    {"NZ", "New Zealand"},
+    {"OM", "Oman"},
+    {"PA", "Panama"},
+    {"PE", "Peru"},
+    {"PF", "French Polynesia"},
+    {"PG", "Papua New Guinea"},
+    {"PH", "Philippines"},
+    {"PK", "Pakistan"},
+    {"PL", "Poland"},
+    {"PM", "Saint Pierre And Miquelon"},
+    {"PN", "Pitcairn"},
+    {"PR", "Puerto Rico"},
+    {"PS", "Palestine, State of"},
+    {"PT", "Portugal"},
+    {"PW", "Palau"},
+    {"PY", "Paraguay"},
+    {"QA", "Qatar"},
+    {"RE", "R\303\251union"},
+    {"RO", "Romania"},
+    {"RS", "Serbia"},
+    {"RU", "Russian Federation"},
+    {"RW", "Rwanda"},
+    {"SA", "Saudi Arabia"},
+    {"SB", "Solomon Islands"},
+    {"SC", "Seychelles"},
+    {"SD", "Sudan"},
+    {"SE", "Sweden"},
+    {"SG", "Singapore"},
+    {"SH", "Saint Helena, Ascension And Tristan Da Cunha"},
+    {"SI", "Slovenia"},
+    {"SJ", "Svalbard And Jan Mayen"},
+    {"SK", "Slovakia"},
+    {"SL", "Sierra Leone"},
+    {"SM", "San Marino"},
+    {"SN", "Senegal"},
+    {"SO", "Somalia"},
+    {"SR", "Suriname"},
+    {"SS", "South Sudan"},
+    {"ST", "Sao Tome And Principe"},
+    {"SV", "El Salvador"},
+    {"SX", "Sint Maarten (dutch Part)"},
+    {"SY", "Syrian Arab Republic"},
+    {"SZ", "Swaziland"},
+    {"TC", "Turks And Caicos Islands"},
+    {"TD", "Chad"},
+    {"TF", "French Southern Territories"},
+    {"TG", "Togo"},
+    {"TH", "Thailand"},
+    {"TJ", "Tajikistan"},
+    {"TK", "Tokelau"},
+    {"TL", "Timor-leste"},
+    {"TM", "Turkmenistan"},
+    {"TN", "Tunisia"},
+    {"TO", "Tonga"},
+    {"TR", "Turkey"},
+    {"TT", "Trinidad And Tobago"},
+    {"TV", "Tuvalu"},
+    {"TW", "Taiwan, Province of China"},
+    {"TZ", "Tanzania, United Republic of"},
+    {"UA", "Ukraine"},
+    {"UG", "Uganda"},
+    {"UM", "United States Minor Outlying Islands"},
+    {"US", "United States"},
+    {"UY", "Uruguay"},
+    {"UZ", "Uzbekistan"},
+    {"VA", "Holy See (vatican City State)"},
+    {"VC", "Saint Vincent And The Grenadines"},
+    {"VE", "Venezuela, Bolivarian Republic of"},
+    {"VG", "Virgin Islands, British"},
+    {"VI", "Virgin Islands, U.S."},
+    {"VN", "Viet Nam"},
+    {"VU", "Vanuatu"},
+    {"WF", "Wallis And Futuna"},
+    {"WS", "Samoa"},
+    {"YE", "Yemen"},
+    {"YT", "Mayotte"},
+    {"ZA", "South Africa"},
+    {"ZM", "Zambia"},
+    {"ZW", "Zimbabwe"},
+};
+
+const size_t Iso_3166_Table_Count =
+    sizeof(Iso_3166_Table) / sizeof(Iso_3166_Table[0]);
@@ -0,0 +1,20 @@
+//
+//  File: %iso-tables.h
+//  Summary: "Declarations for the tables in %iso-tables.c"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+
+struct Iso_Code_Name {
+    char code[3];  // two letters and a terminator
+    const char *name;  // English name, UTF-8
+};
+
+extern const struct Iso_Code_Name Iso_639_Table[];  // lowercase codes
+extern const size_t Iso_639_Table_Count;
+
+extern const struct Iso_Code_Name Iso_3166_Table[];  // uppercase codes
+extern const size_t Iso_3166_Table_Count;
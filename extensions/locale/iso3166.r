@@ -49,18 +49,5 @@ parse3 cnt [
     <end>
 ]
 
-init-code: to text! read init
-space: charset " ^-^M^/"
-iso-3166-table-count: find mold iso-3166-table #"["
-parse3 init-code [
-    thru "iso-3166-table:"
-    to #"["
-    change [
-         #"[" thru #"]"
-    ] iso-3166-table-count
-    to <end>
-] else [
-    fail "Failed to update iso-3166-table"
-]
-
-write init init-code
+do %update-iso-table.r
+update-iso-table "Iso_3166_Table" iso-3166-table
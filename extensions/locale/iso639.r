@@ -1,6 +1,5 @@
 REBOL []
 
-init: %ext-locale-init.reb
 inp: %ISO-639-2_utf-8.txt
 count: read inp
 if #{EFBBBF} = to binary! copy/part count 3 [  ; UTF-8 BOM
@@ -51,18 +50,5 @@ parse3 cnt [
     <end>
 ]
 
-init-code: to text! read init
-space: charset " ^-^M^/"
-iso-639-table-count: find mold iso-639-table #"["
-parse3 init-code [
-    thru "iso-639-table:"
-    to #"["
-    change [
-         #"[" thru #"]"
-    ] iso-639-table-count
-    to <end>
-] else [
-    fail "Failed to update iso-639-table"
-]
-
-write init init-code
+do %update-iso-table.r
+update-iso-table "Iso_639_Table" iso-639-table
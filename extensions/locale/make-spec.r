@@ -19,5 +19,8 @@ source: [
 includes: copy [
     %prep/extensions/locale ;for %tmp-extensions-locale-init.inc
 ]
+depends: [
+    %locale/iso-tables.c  ; compiled-in ISO 639 and 3166 names, see ISO-NAME
+]
 
 requires: 'process ;for get-env
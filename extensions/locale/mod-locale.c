@@ -30,6 +30,8 @@
     #undef VOID  // %winnt.h defines this, we have a better use for it
 #endif
 #include <locale.h>
+#include <stdlib.h>  // bsearch()
+#include <string.h>  // strcmp()
 
 // IS_ERROR might be defined in winerror.h and tmp-kinds.h
 #ifdef IS_ERROR
@@ -40,6 +42,8 @@
 
 #include "tmp-mod-locale.h"
 
+#include "iso-tables.h"
+
 
 //
 //  export locale: native [
@@ -98,6 +102,82 @@ DECLARE_NATIVE(locale)
 }
 
 
+static int Compare_Iso_Code(const void *key, const void *entry) {
+    return strcmp(
+        cast(const char*, key),
+        cast(const struct Iso_Code_Name*, entry)->code
+    );
+}
+
+
+//
+//  iso-name: native [
+//
+//  {English name for a two-letter ISO language or territory code}
+//
+//      return: [<opt> text!]
+//      standard "639 for languages, 3166 for territories (countries)"
+//          [integer!]
+//      code "Case doesn't matter, e.g. `en` or `US`"
+//          [text!]
+//  ]
+//
+DECLARE_NATIVE(iso_name)
+//
+// The tables are constant sorted arrays compiled in from %iso-tables.c, so
+// there's no cost to having them unless a lookup is done.
+{
+    LOCALE_INCLUDE_PARAMS_OF_ISO_NAME;
+
+    const struct Iso_Code_Name *table;
+    size_t count;
+    bool upper;
+
+    switch (VAL_INT32(ARG(standard))) {
+      case 639:
+        table = Iso_639_Table;
+        count = Iso_639_Table_Count;
+        upper = false;
+        break;
+
+      case 3166:
+        table = Iso_3166_Table;
+        count = Iso_3166_Table_Count;
+        upper = true;
+        break;
+
+      default:
+        fail (PARAM(standard));
+    }
+
+    Size size;
+    Utf8(const*) utf8 = VAL_UTF8_SIZE_AT(&size, ARG(code));
+    if (size != 2)
+        return nullptr;
+
+    char key[3];
+    int i;
+    for (i = 0; i < 2; ++i) {
+        Byte b = cast(const Byte*, utf8)[i];
+        if (upper and b >= 'a' and b <= 'z')
+            b -= 'a' - 'A';
+        else if (not upper and b >= 'A' and b <= 'Z')
+            b += 'a' - 'A';
+        key[i] = cast(char, b);
+    }
+    key[2] = '\0';
+
+    const struct Iso_Code_Name *found = cast(
+        const struct Iso_Code_Name*,
+        bsearch(key, table, count, sizeof(table[0]), &Compare_Iso_Code)
+    );
+    if (not found)
+        return nullptr;
+
+    return rebText(found->name);
+}
+
+
 // Some locales are GNU extensions; define them as -1 if not present:
 //
 // http://man7.org/linux/man-pages/man7/locale.7.html
@@ -0,0 +1,64 @@
+REBOL [
+    Title: "Write a code-to-name MAP! into %iso-tables.c"
+    Purpose: {
+        Shared by %iso639.r and %iso3166.r.  The table replaces what's
+        between the braces of the named C array, sorted by code so that
+        ISO-NAME can use bsearch() on it.
+    }
+]
+
+c-string: func [
+    {C string literal of UTF-8 text, with non-ASCII bytes as octal escapes}
+
+    return: [text!]
+    text [text!]
+][
+    return unspaced [
+        {"}
+        collect [
+            for-each b as binary! text [
+                case [
+                    b >= 128 [
+                        keep unspaced [
+                            "\" shift b -6 (shift b -3) mod 8 b mod 8
+                        ]
+                    ]
+                    find [34 92] b [  ; double quote and backslash
+                        keep unspaced ["\" to char! b]
+                    ]
+                ] else [
+                    keep to char! b
+                ]
+            ]
+        ]
+        {"}
+    ]
+]
+
+update-iso-table: func [
+    {Replace the contents of a C array in %iso-tables.c with a MAP!}
+
+    array-name [text!]
+    table [map!]
+][
+    let codes: sort collect [for-each [code name] table [keep code]]
+    let rows: collect [
+        for-each code codes [
+            keep unspaced [
+                {    {"} code {", } c-string select table code "},^/"
+            ]
+        ]
+    ]
+    rows: unspaced rows
+
+    let c-code: to text! read %iso-tables.c
+    parse3 c-code [
+        thru unspaced [array-name "[] = {^/"]
+        change to "};" rows
+        to <end>
+    ] else [
+        fail ["Failed to update" array-name]
+    ]
+
+    write %iso-tables.c c-code
+]
@@ -50,6 +50,8 @@
 #include "sys-core.h"
 
 #include "reb-net.h"
+
+#include "../filesystem/file-req.h"  // for TRANSFER from an open file PORT!
 extern REBVAL *rebError_UV(int err);
 
 #include "tmp-mod-network.h"
@@ -125,7 +127,17 @@ void on_close(uv_handle_t *handle) {
     *finished = true;
 }
 
+static void Unwatch_Sock(SOCKREQ* sock);
+static void Flush_Queued_Writes(SOCKREQ *sock);
+static void Discard_Queued_Writes(SOCKREQ *sock);
+static REBVAL *Take_Write_Error(SOCKREQ *sock);
+
 static void Close_Sock_If_Needed(SOCKREQ* sock) {
+    if (sock->watch)
+        Unwatch_Sock(sock);
+
+    Discard_Queued_Writes(sock);
+
     if (sock->stream) {
         bool finished;
         sock->tcp.data = &finished;
@@ -138,6 +150,11 @@ static void Close_Sock_If_Needed(SOCKREQ* sock) {
         sock->stream = nullptr;
         sock->modes = 0;
     }
+
+    if (sock->write_error) {  // e.g. writes canceled by the uv_close()
+        rebRelease(sock->write_error);
+        sock->write_error = nullptr;
+    }
 }
 
 static void cleanup_sockreq(const REBVAL *v) {
@@ -156,6 +173,16 @@ REBVAL *Close_Socket(const REBVAL *port)
 
     REBVAL *error = nullptr;
 
+    // Coalesced writes are sent, and waited for, like a blocking WRITE.
+    //
+    if (sock->stream) {
+        Flush_Queued_Writes(sock);
+        while (sock->writes_in_flight != 0)
+            uv_run(uv_default_loop(), UV_RUN_ONCE);
+        if (sock->write_error)
+            error = Take_Write_Error(sock);
+    }
+
     // Note: R3-Alpha allowed closing closed sockets
     Close_Sock_If_Needed(sock);
 
@@ -163,28 +190,165 @@ REBVAL *Close_Socket(const REBVAL *port)
 }
 
 
+//=//// HOST RESOLUTION AND DNS CACHE ////////////////////////////////////=//
 //
-//  Lookup_Socket_Synchronously: C
+// getaddrinfo() blocks, so lookups are handed to libuv, which runs them on
+// its threadpool.  The caller still waits for the answer, but the event loop
+// keeps running meanwhile (timers, watched ports, other lookups).  RESOLVE
+// takes a BLOCK! of hosts and has all of their lookups in flight at once.
 //
-// !!! R3-Alpha would use asynchronous DNS API on Windows, but that API
-// was not supported by IPv6, and developers are encouraged to use normal
-// socket APIs with their own threads.  Now that we use libuv, there is again
-// the ability to specify a callback and do asynchronous lookup.  But this
-// would have to be fit in with a client understanding for how to request a
-// LOOKUP event, and when it had to be waited on.  For now it's synchronous.
+// Answers are cached in the process.  getaddrinfo() doesn't tell the TTL of
+// the records it found, so the cache uses a TTL that SET-DNS-CACHE can
+// change.  Hosts that don't exist are cached too ("negative caching"), with
+// a shorter TTL.  Temporary failures (e.g. a nameserver timeout) are not.
 //
-REBVAL *Lookup_Socket_Synchronously(
-    const REBVAL *port,
-    const REBVAL *hostname
+
+#define DNS_CACHE_BUCKETS 1024
+#define DNS_CACHE_MAX 16384  // past this, expired entries are purged
+
+struct Reb_Dns_Entry {
+    struct Reb_Dns_Entry *next;
+    uint64_t expires;  // milliseconds, see Dns_Now()
+    uint32_t ip;  // same byte order as SOCKREQ's remote_ip
+    int status;  // 0, or libuv error code of a negative entry
+    Size name_size;  // including '\0'
+    char *name;
+};
+
+static struct Reb_Dns_Entry *dns_cache[DNS_CACHE_BUCKETS];
+static REBLEN dns_cache_count = 0;
+
+static uint64_t dns_ttl = 60 * 1000;  // milliseconds, 0 disables caching
+static uint64_t dns_negative_ttl = 10 * 1000;
+
+static uint64_t Dns_Now(void)
+  { return uv_hrtime() / 1000000; }
+
+static uint32_t Dns_Hash(const char *name) {  // FNV-1a
+    uint32_t hash = 2166136261U;
+    for (; *name; ++name)
+        hash = (hash ^ cast(Byte, *name)) * 16777619U;
+    return hash % DNS_CACHE_BUCKETS;
+}
+
+static void Free_Dns_Entry(struct Reb_Dns_Entry *entry) {
+    FREE_N(char, entry->name_size, entry->name);
+    FREE(struct Reb_Dns_Entry, entry);
+    --dns_cache_count;
+}
+
+static void Purge_Dns_Cache(bool all)
+{
+    uint64_t now = Dns_Now();
+
+    REBLEN i;
+    for (i = 0; i < DNS_CACHE_BUCKETS; ++i) {
+        struct Reb_Dns_Entry **link = &dns_cache[i];
+        while (*link) {
+            struct Reb_Dns_Entry *entry = *link;
+            if (all or entry->expires <= now) {
+                *link = entry->next;
+                Free_Dns_Entry(entry);
+            }
+            else
+                link = &entry->next;
+        }
+    }
+}
+
+static struct Reb_Dns_Entry *Find_Dns_Entry(const char *name)
+{
+    uint64_t now = Dns_Now();
+
+    struct Reb_Dns_Entry **link = &dns_cache[Dns_Hash(name)];
+    while (*link) {
+        struct Reb_Dns_Entry *entry = *link;
+        if (entry->expires <= now) {  // drop stale entries as they're seen
+            *link = entry->next;
+            Free_Dns_Entry(entry);
+            continue;
+        }
+        if (strcmp(entry->name, name) == 0)
+            return entry;
+        link = &entry->next;
+    }
+    return nullptr;
+}
+
+static void Cache_Dns_Answer(const char *name, int status, uint32_t ip)
+{
+    uint64_t ttl;
+    if (status == 0)
+        ttl = dns_ttl;
+    else if (status == UV_EAI_NONAME or status == UV_EAI_NODATA)
+        ttl = dns_negative_ttl;
+    else
+        return;  // may work if asked again
+
+    if (ttl == 0)
+        return;
+
+    struct Reb_Dns_Entry *entry = Find_Dns_Entry(name);
+    if (not entry) {
+        if (dns_cache_count >= DNS_CACHE_MAX) {
+            Purge_Dns_Cache(false);
+            if (dns_cache_count >= DNS_CACHE_MAX)
+                Purge_Dns_Cache(true);
+        }
+
+        entry = TRY_ALLOC(struct Reb_Dns_Entry);
+        entry->name_size = strlen(name) + 1;
+        entry->name = TRY_ALLOC_N(char, entry->name_size);
+        memcpy(entry->name, name, entry->name_size);
+
+        uint32_t hash = Dns_Hash(name);
+        entry->next = dns_cache[hash];
+        dns_cache[hash] = entry;
+        ++dns_cache_count;
+    }
+
+    entry->expires = Dns_Now() + ttl;
+    entry->status = status;
+    entry->ip = ip;
+}
+
+
+typedef struct {
+    uv_getaddrinfo_t req;  // make first member so we can cast the address
+
+    char *name;  // rebSpell()'d, lowercased by Resolve_Hosts()
+    int status;
+    uint32_t ip;
+    REBLEN *num_pending;
+} Reb_Resolve_Request;
+
+static void on_resolved(
+    uv_getaddrinfo_t *req,
+    int status,
+    struct addrinfo *res
 ){
-    SOCKREQ *sock = Sock_Of_Port(port);
+    Reb_Resolve_Request *rebreq = cast(Reb_Resolve_Request*, req);
 
-    assert(IS_TEXT(hostname));
-    const char *hostname_utf8 = cs_cast(VAL_UTF8_AT(hostname));
-    char *port_number_utf8 = rebSpell(
-        Canon(FORM), rebI(sock->remote_port_number)
-    );
+    rebreq->status = status;
+    if (status == 0) {
+        // !!! Theoretically this is where we'd know whether it's an IPv6 or
+        // an IPv4 address.  This is still transitional IPv4 code, though.
+        //
+        struct sockaddr_in *sa = cast(struct sockaddr_in*, res->ai_addr);
+        assert(sizeof(sa->sin_addr) == 4);
+        memcpy(&rebreq->ip, &sa->sin_addr, 4);
+    }
+    uv_freeaddrinfo(res);  // have to free it (tolerates nullptr)
+
+    Cache_Dns_Answer(rebreq->name, status, rebreq->ip);
+    --(*rebreq->num_pending);
+}
 
+// Fill in the `status` and `ip` of each request from the cache, or by
+// looking it up.  All the lookups run concurrently.
+//
+static void Resolve_Hosts(Reb_Resolve_Request *reqs, REBLEN num_reqs)
+{
     // !!! You can leave the "hints" argument as nullptr.  But this is what
     // Julia said for hints, which didn't prescribe an ai_family of PF_INET,
     // and it also used memset() to 0...so it got hints.ai_protocol as
@@ -201,54 +365,194 @@ REBVAL *Lookup_Socket_Synchronously(
     // use the simpler-seeming libuv case.
     //
     struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
     hints.ai_family = PF_INET;
     hints.ai_socktype = SOCK_STREAM;
     hints.ai_protocol = IPPROTO_TCP;
     hints.ai_flags = 0;
 
-    // This is a replacement for:
-    //
-    //     HOSTENT *host = gethostbyname(cs_cast(hostname_utf8));
-    //
-    uv_getaddrinfo_t req;
-    int r = uv_getaddrinfo(
-        uv_default_loop(),
-        &req,
-        nullptr,  // callback
-        hostname_utf8,  // called "node" in libuv, but "hostname" in POSIX
-        port_number_utf8,  // "service" string or port (e.g. "echo", "80")
-        &hints  // "hints" (which is a const struct addrinfo*)
-    );
+    REBLEN num_pending = 0;
 
-    rebFree(port_number_utf8);
+    REBLEN i;
+    for (i = 0; i < num_reqs; ++i) {
+        Reb_Resolve_Request *rebreq = &reqs[i];
+        rebreq->num_pending = &num_pending;
+        rebreq->ip = 0;
 
-    if (r != 0)
-        return rebError_UV(r);
+        char *cp;  // host names are case-insensitive, cache them lowercase
+        for (cp = rebreq->name; *cp; ++cp) {
+            if (*cp >= 'A' and *cp <= 'Z')
+                *cp += 'a' - 'A';
+        }
 
-    // Synchronously fill in the port's remote_ip with the answer to looking
-    // up the hostname.
-    //
-    // This is a replacement for:
-    //
-    //      memcpy(&sock->remote_ip, *host->h_addr_list, 4);
-    //
-    struct sockaddr_in *sa = cast(struct sockaddr_in*, req.addrinfo->ai_addr);
+        struct Reb_Dns_Entry *entry = Find_Dns_Entry(rebreq->name);
+        if (entry) {
+            rebreq->status = entry->status;
+            rebreq->ip = entry->ip;
+            continue;
+        }
+
+        int r = uv_getaddrinfo(
+            uv_default_loop(),
+            &rebreq->req,
+            &on_resolved,
+            rebreq->name,  // called "node" in libuv, but "hostname" in POSIX
+            nullptr,  // "service" (e.g. "echo", "80"), not needed for the IP
+            &hints
+        );
+        if (r != 0)
+            rebreq->status = r;
+        else
+            ++num_pending;
+    }
 
-    // https://stackoverflow.com/q/31343855/
+    // The requests are on the caller's memory, so this can't give up early
+    // (e.g. on HALT) with any still in flight.
     //
-    assert(req.addrinfo->ai_addrlen == 16);
-    assert(sizeof(sa->sin_addr) == 4);
-    memcpy(&sock->remote_ip, &sa->sin_addr, 4);
+    while (num_pending != 0)
+        uv_run(uv_default_loop(), UV_RUN_ONCE);
+}
+
+
+//
+//  Lookup_Socket_Synchronously: C
+//
+// Fills in the port's remote_ip with the answer to looking up the hostname
+// (replacing R3-Alpha's `gethostbyname()`).  See Resolve_Hosts() for how the
+// interpreter keeps servicing events while the lookup happens.
+//
+REBVAL *Lookup_Socket_Synchronously(
+    const REBVAL *port,
+    const REBVAL *hostname
+){
+    SOCKREQ *sock = Sock_Of_Port(port);
+
+    assert(IS_TEXT(hostname));
 
-    uv_freeaddrinfo(req.addrinfo);  // have to free it
+    Reb_Resolve_Request rebreq;
+    rebreq.name = rebSpell(hostname);
+    Resolve_Hosts(&rebreq, 1);
+    rebFree(rebreq.name);
 
-    // !!! Theoretically this is where we'd know whether it's an IPv6 address
-    // or an IPv4 address.  This is still transitional IPv4 code, though.
+    if (rebreq.status != 0)
+        return rebError_UV(rebreq.status);
 
+    memcpy(&sock->remote_ip, &rebreq.ip, 4);
     return nullptr;
 }
 
 
+//
+//  export resolve: native [
+//
+//  {Look up the IPv4 address of hosts, using the DNS cache}
+//
+//      return: "BLOCK! has a TUPLE! or BLANK! for each host, in order"
+//          [<opt> tuple! block!]
+//      host "Lookups for a BLOCK! of hosts are all done at the same time"
+//          [text! block!]
+//  ]
+//
+DECLARE_NATIVE(resolve)
+{
+    NETWORK_INCLUDE_PARAMS_OF_RESOLVE;
+
+    REBVAL *host = ARG(host);
+
+    REBLEN num_reqs;
+    Cell(const*) tail;
+    Cell(const*) at;
+    if (IS_TEXT(host)) {
+        num_reqs = 1;
+        at = host;
+        tail = host + 1;
+    }
+    else {
+        at = VAL_ARRAY_AT(&tail, host);
+        num_reqs = tail - at;
+        if (num_reqs == 0)
+            return Init_Block(OUT, Make_Array(0));
+    }
+
+    Reb_Resolve_Request *reqs = rebAllocN(Reb_Resolve_Request, num_reqs);
+
+    REBLEN i;
+    for (i = 0; i < num_reqs; ++i, ++at) {
+        if (not IS_TEXT(at)) {
+            while (i != 0)
+                rebFree(reqs[--i].name);
+            rebFree(reqs);
+            fail (Error_Bad_Value(at));
+        }
+        reqs[i].name = rebSpell(SPECIFIC(at));
+    }
+
+    Resolve_Hosts(reqs, num_reqs);
+
+    // "Expected" failures give NULL (BLANK! in a block), like READ DNS://.
+    // Anything else is an error.
+    //
+    REBVAL *error = nullptr;
+    StackIndex base = TOP_INDEX;
+    for (i = 0; i < num_reqs; ++i) {
+        rebFree(reqs[i].name);
+
+        int status = reqs[i].status;
+        if (status == 0)
+            Init_Tuple_Bytes(PUSH(), cast(Byte*, &reqs[i].ip), 4);
+        else if (status == UV_EAI_NONAME or status == UV_EAI_NODATA)
+            Init_Blank(PUSH());
+        else {
+            if (not error)
+                error = rebError_UV(status);
+            Init_Blank(PUSH());
+        }
+    }
+    rebFree(reqs);
+
+    if (error) {
+        Drop_Data_Stack_To(base);
+        return RAISE(error);
+    }
+
+    if (IS_BLOCK(host))
+        return Init_Block(OUT, Pop_Stack_Values(base));
+
+    Move_Cell(OUT, TOP);
+    Drop_Data_Stack_To(base);
+    if (IS_BLANK(OUT))
+        return nullptr;
+    return OUT;
+}
+
+
+//
+//  export set-dns-cache: native [
+//
+//  {Set how long RESOLVE and network ports remember host lookups}
+//
+//      return: <none>
+//      ttl "Zero disables the cache (also clears it)"
+//          [integer! time!]
+//      /negative "How long to remember hosts that don't exist (default 10s)"
+//          [integer! time!]
+//  ]
+//
+DECLARE_NATIVE(set_dns_cache)
+{
+    NETWORK_INCLUDE_PARAMS_OF_SET_DNS_CACHE;
+
+    dns_ttl = Milliseconds_From_Value(ARG(ttl));
+    if (REF(negative))
+        dns_negative_ttl = Milliseconds_From_Value(ARG(negative));
+
+    if (dns_ttl == 0)
+        Purge_Dns_Cache(true);
+
+    return NONE;
+}
+
+
 // This libuv callback is triggered when a Request_Connect_Socket()
 // connection has been made...or an error is raised.
 //
@@ -405,6 +709,26 @@ REBVAL *Start_Listening_On_Socket(const REBVAL *port)
     struct sockaddr_in sa;
     Set_Addr(&sa, INADDR_ANY, sock->local_port_number);
 
+    // Letting several processes listen on one port has to be asked for before
+    // the bind().  libuv already sets SO_REUSEADDR on POSIX in uv_tcp_bind(),
+    // and it has no option for SO_REUSEPORT, so that is set on the socket
+    // that uv_tcp_init_ex() made.
+    //
+  #if defined(SO_REUSEPORT)
+    if (sock->reuse_port) {
+        uv_os_fd_t fd;
+        int r = uv_fileno(cast(uv_handle_t*, &sock->tcp), &fd);
+        if (r < 0)
+            return rebError_UV(r);
+
+        int on = 1;
+        if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) < 0)
+            return rebError_UV(uv_translate_sys_error(errno));
+    }
+  #else
+    assert(not sock->reuse_port);  // OPEN checks
+  #endif
+
   blockscope {
     int r = uv_tcp_bind(&sock->tcp, cast(struct sockaddr*, &sa), 0);
     if (r < 0)
@@ -457,23 +781,36 @@ REBVAL *Start_Listening_On_Socket(const REBVAL *port)
 // the `data` field of the port as a BINARY!.  This adds up over successive
 // reads until the port clears it.
 //
+// READ/INTO skips the port's data and reads straight into the caller's
+// BINARY!.  Since such a buffer is typically cleared and reused for the life
+// of a connection, unlimited reads offer libuv all of its spare capacity (or
+// libuv's suggested size, if that's more) so it settles at a size that needs
+// no further reallocation.
+//
 void on_read_alloc(uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf)
 {
-    UNUSED(suggested_size);
-
     Reb_Read_Request *rebreq = cast(Reb_Read_Request*, handle->data);
 
     Context(*) port_ctx = rebreq->port_ctx;
     REBVAL *port_data = CTX_VAR(port_ctx, STD_PORT_DATA);
 
     size_t bufsize;
-    if (rebreq->length == UNLIMITED)  // read maximum amount possible
-        bufsize = NET_BUF_SIZE;  // !!! use libuv's (large) suggestion instead?
-    else
+    if (rebreq->length != UNLIMITED)
         bufsize = rebreq->length - rebreq->actual;  // !!! use suggestion here?
+    else if (rebreq->into) {
+        bufsize = SER_AVAIL(rebreq->into);
+        if (bufsize < suggested_size)
+            bufsize = suggested_size;
+    }
+    else  // read maximum amount possible
+        bufsize = NET_BUF_SIZE;  // !!! use libuv's (large) suggestion instead?
 
     Binary(*) bin;
-    if (Is_Nulled(port_data)) {
+    if (rebreq->into) {
+        bin = rebreq->into;
+        Extend_Series_If_Necessary(bin, bufsize);
+    }
+    else if (Is_Nulled(port_data)) {
         bin = Make_Binary(bufsize);
         Init_Binary(port_data, bin);
     }
@@ -512,7 +849,9 @@ void on_read(uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf)
     REBVAL *port_data = CTX_VAR(port_ctx, STD_PORT_DATA);
 
     Binary(*) bin;
-    if (Is_Nulled(port_data)) {
+    if (rebreq->into)
+        bin = rebreq->into;
+    else if (Is_Nulled(port_data)) {
         //
         // An error like "connection reset by peer" can occur before a call to
         // on_read_alloc() is made, so the buffer might be null in that case.
@@ -543,7 +882,13 @@ void on_read(uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf)
         // the case of some "connection reset by peer" errors; so port_data
         // might be a binary or it might be nulled.
         //
-        Init_Nulled(port_data);
+        // A READ/INTO buffer belongs to the caller, so it's just put back to
+        // how it was before the READ.
+        //
+        if (rebreq->into)
+            TERM_BIN_LEN(rebreq->into, rebreq->into_start);
+        else
+            Init_Nulled(port_data);
 
         // Asking to do a `uv_read_stop()` when an error happens asserts:
         // https://github.com/joyent/libuv/issues/1534
@@ -657,6 +1002,174 @@ void on_write_finished(uv_write_t *req, int status)
 }
 
 
+//=//// COALESCED WRITES //////////////////////////////////////////////////=//
+//
+// Protocol code tends to WRITE a status line, then headers, then pieces of a
+// body, as separate calls.  If each is its own uv_write() that the WRITE has
+// to wait on, that's a syscall (and often a packet) for every piece.
+//
+// When a port is set to coalesce, WRITE just queues its copy of the data.
+// The queue is handed to libuv as one vectored write (writev() on POSIX,
+// WSASend() with several buffers on Windows) when one of these happens:
+//
+// * The queued bytes reach WRITE_COALESCE_LIMIT, like Nagle's algorithm
+//   sending once a full segment's worth is ready.
+//
+// * The port is READ.  A request/response protocol has to send everything
+//   it has before it can expect an answer.
+//
+// * WAIT is called.  This is the "end of a burst" for event-driven code.
+//
+// * The port is CLOSE'd, which also waits for the writes to finish.
+//
+
+#define WRITE_COALESCE_LIMIT (64 * 1024)
+
+static SOCKREQ *flush_list = nullptr;  // ports with queued writes
+
+static void on_write_batch_finished(uv_write_t *req, int status)
+{
+    Reb_Write_Batch *batch = cast(Reb_Write_Batch*, req);
+    SOCKREQ *sock = batch->sock;
+
+    // The callback may run during any later operation (e.g. a WAIT), so an
+    // error can't be left owned by whatever frame happens to be running.
+    //
+    if (status < 0 and sock->write_error == nullptr)
+        sock->write_error = rebUnmanage(rebError_UV(status));
+
+    REBLEN i;
+    for (i = 0; i < batch->num_binaries; ++i)
+        rebRelease(batch->binaries[i]);
+    rebFree(batch->binaries);
+    rebFree(batch);
+
+    --sock->writes_in_flight;
+}
+
+static void Unlist_Flush(SOCKREQ *sock)
+{
+    if (not sock->flush_listed)
+        return;
+
+    SOCKREQ **link = &flush_list;
+    while (*link != sock)
+        link = &(*link)->next_flush;
+    *link = sock->next_flush;
+
+    sock->next_flush = nullptr;
+    sock->flush_listed = false;
+}
+
+static void Flush_Queued_Writes(SOCKREQ *sock)
+{
+    Unlist_Flush(sock);
+
+    if (sock->num_queued == 0)
+        return;
+
+    Reb_Write_Batch *batch = rebAlloc(Reb_Write_Batch);
+    batch->sock = sock;
+    batch->binaries = sock->queued;
+    batch->num_binaries = sock->num_queued;
+
+    sock->queued = nullptr;
+    sock->num_queued = 0;
+    sock->queued_capacity = 0;
+    sock->queued_bytes = 0;
+
+    // uv_write() copies the uv_buf_t array, only the data has to stay put.
+    //
+    uv_buf_t *bufs = rebAllocN(uv_buf_t, batch->num_binaries);
+    REBLEN i;
+    for (i = 0; i < batch->num_binaries; ++i) {
+        REBVAL *bin = batch->binaries[i];
+        bufs[i].base = s_cast(m_cast(Byte*, VAL_BINARY_AT(bin)));
+        bufs[i].len = VAL_LEN_AT(bin);
+    }
+
+    int r = uv_write(
+        &batch->req,
+        sock->stream,
+        bufs,
+        batch->num_binaries,
+        &on_write_batch_finished
+    );
+    rebFree(bufs);
+
+    if (r < 0) {  // callback won't be called
+        ++sock->writes_in_flight;
+        on_write_batch_finished(&batch->req, r);
+        return;
+    }
+
+    ++sock->writes_in_flight;
+}
+
+static void Queue_Write(SOCKREQ *sock, REBVAL *binary)
+{
+    if (sock->num_queued == sock->queued_capacity) {
+        REBLEN capacity = sock->queued_capacity == 0
+            ? 8
+            : sock->queued_capacity * 2;
+        REBVAL **queued = rebAllocN(REBVAL*, capacity);
+        if (sock->num_queued != 0) {
+            memcpy(queued, sock->queued, sock->num_queued * sizeof(REBVAL*));
+            rebFree(sock->queued);
+        }
+        sock->queued = queued;
+        sock->queued_capacity = capacity;
+    }
+
+    sock->queued[sock->num_queued] = binary;
+    ++sock->num_queued;
+    sock->queued_bytes += VAL_LEN_AT(binary);
+
+    if (sock->queued_bytes >= WRITE_COALESCE_LIMIT)
+        Flush_Queued_Writes(sock);
+    else if (not sock->flush_listed) {
+        sock->next_flush = flush_list;
+        flush_list = sock;
+        sock->flush_listed = true;
+    }
+}
+
+static void Flush_All_Queued_Writes(void)
+{
+    while (flush_list)
+        Flush_Queued_Writes(flush_list);  // unlists it
+}
+
+// Data queued on a socket that is going away (e.g. its port was GC'd
+// without a CLOSE) is dropped, as it would be by an unflushed FILE*.
+//
+static void Discard_Queued_Writes(SOCKREQ *sock)
+{
+    Unlist_Flush(sock);
+
+    REBLEN i;
+    for (i = 0; i < sock->num_queued; ++i)
+        rebRelease(sock->queued[i]);
+    if (sock->queued)
+        rebFree(sock->queued);
+
+    sock->queued = nullptr;
+    sock->num_queued = 0;
+    sock->queued_capacity = 0;
+    sock->queued_bytes = 0;
+}
+
+// An error from a write that nobody waited on is given to the next READ,
+// WRITE or CLOSE of the port.
+//
+static REBVAL *Take_Write_Error(SOCKREQ *sock)
+{
+    REBVAL *error = sock->write_error;
+    sock->write_error = nullptr;
+    return rebManage(error);
+}
+
+
 //
 //  Transport_Actor: C
 //
@@ -666,6 +1179,20 @@ static Bounce Transport_Actor(
     Symbol(const*) verb,
     enum Transport_Type transport
 ){
+    // !!! If UDP is brought back, it should not be one datagram per READ and
+    // WRITE as R3-Alpha's was, which can't keep up with high-rate sources
+    // (e.g. telemetry at hundreds of thousands of datagrams a second).  The
+    // SOCKREQ would need a uv_udp_t instead of the uv_tcp_t, and then:
+    //
+    // * Receive by uv_udp_init_ex() with UV_UDP_RECVMMSG, handing libuv a
+    //   buffer of many datagrams' size in the alloc callback.  libuv then uses
+    //   recvmmsg() on Linux, and each callback is one datagram of the batch.
+    //   A READ would gather them into a BLOCK! of [binary! address] pairs.
+    //
+    // * Send by queueing each datagram of a BLOCK! with uv_udp_send() before
+    //   running the loop once.  libuv flushes its send queue with sendmmsg()
+    //   where it's available, so no separate batching API is needed.
+    //
     if (transport == TRANSPORT_UDP)  // disabled for now
         fail ("https://forum.rebol.info/t/fringe-udp-support-archiving/1730");
 
@@ -746,6 +1273,19 @@ static Bounce Transport_Actor(
             else
                 fail ("local-id field of PORT! spec must be NULL or INTEGER!");
 
+            REBVAL *reuse_port = Obj_Value(spec, STD_PORT_SPEC_NET_REUSE_PORT);
+            if (Is_Nulled(reuse_port))
+                sock->reuse_port = false;
+            else if (IS_LOGIC(reuse_port))
+                sock->reuse_port = VAL_LOGIC(reuse_port);
+            else
+                fail ("reuse-port field of PORT! spec must be NULL or LOGIC!");
+
+          #if !defined(SO_REUSEPORT)
+            if (sock->reuse_port)
+                fail ("reuse-port (SO_REUSEPORT) not available on this OS");
+          #endif
+
             // !!! R3-Alpha would open the socket using `socket()` call, and
             // then do a DNS lookup afterward if necessary.  But the right
             // way to do it is to look up the DNS first and find out what kind
@@ -834,7 +1374,7 @@ static Bounce Transport_Actor(
 
         UNUSED(PARAM(source));
 
-        if (REF(seek))
+        if (REF(seek) or REF(mapped))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PARAM(string)); // handled in dispatcher
@@ -843,11 +1383,55 @@ static Bounce Transport_Actor(
         if (sock->stream == nullptr and sock->transport != TRANSPORT_UDP)
             fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
 
+        Flush_Queued_Writes(sock);  // the other side may be waiting on them
+        if (sock->write_error)
+            return RAISE(Take_Write_Error(sock));
+
+        // A watched port has been reading into its data all along.  If WAIT
+        // said it was ready and all that's wanted is "what's there", don't
+        // go back to the loop.  Otherwise the watch's read is suspended so
+        // the request below gets the callbacks, and resumed afterward.
+        //
+        if (sock->watch) {
+            REBVAL *port_data = CTX_VAR(VAL_CONTEXT(port), STD_PORT_DATA);
+            if (
+                not REF(part)
+                and sock->watch_reading  // EOF/errors need a real READ
+                and IS_BINARY(port_data)
+                and VAL_LEN_AT(port_data) != 0
+            ){
+                Unlink_Ready(sock);
+                if (REF(into)) {
+                    Binary(*) into = VAL_BINARY_ENSURE_MUTABLE(ARG(into));
+                    Binary(*) bin = VAL_BINARY_KNOWN_MUTABLE(port_data);
+                    Size size = VAL_LEN_AT(port_data);
+                    Extend_Series_If_Necessary(into, size);
+                    memcpy(BIN_TAIL(into), VAL_BINARY_AT(port_data), size);
+                    TERM_BIN_LEN(into, BIN_LEN(into) + size);
+                    TERM_BIN_LEN(bin, VAL_INDEX(port_data));
+                }
+                return COPY(port);
+            }
+
+            if (sock->watch_reading) {
+                uv_read_stop(sock->stream);
+                sock->watch_reading = false;
+            }
+            Unlink_Ready(sock);
+        }
+
         Reb_Read_Request *rebreq = rebAlloc(Reb_Read_Request);
         rebreq->port_ctx = VAL_CONTEXT(port);
         rebreq->actual = 0;
         rebreq->result = nullptr;
 
+        if (REF(into)) {
+            rebreq->into = VAL_BINARY_ENSURE_MUTABLE(ARG(into));
+            rebreq->into_start = BIN_LEN(rebreq->into);
+        }
+        else
+            rebreq->into = nullptr;
+
         if (REF(part)) {
             if (not IS_INTEGER(ARG(part)))
                 fail (ARG(part));
@@ -876,6 +1460,9 @@ static Bounce Transport_Actor(
             uv_run(uv_default_loop(), UV_RUN_ONCE);
         } while (rebreq->result == nullptr);
 
+        if (sock->watch)  // resume watching (EOF will just report again)
+            Start_Watch_Reading(sock);
+
         if (not IS_BLANK(rebreq->result))
             return RAISE(rebreq->result);  // e.g. "broken pipe" ?
         rebRelease(rebreq->result);
@@ -904,6 +1491,9 @@ static Bounce Transport_Actor(
         //
         REBVAL *data = ARG(data);
 
+        if (sock->write_error)
+            return RAISE(Take_Write_Error(sock));
+
         // When we get the callback we'll get the libuv req pointer, which is
         // the same pointer as the rebreq (first struct member).
         //
@@ -934,6 +1524,14 @@ static Bounce Transport_Actor(
         );
         rebUnmanage(rebreq->binary);  // otherwise would be seen as a leak
 
+        if (sock->coalesce) {
+            Queue_Write(sock, rebreq->binary);
+            rebFree(rebreq);
+            return COPY(port);
+        }
+
+        Flush_Queued_Writes(sock);  // keep order if coalescing was turned off
+
         uv_buf_t buf;
         buf.base = s_cast(m_cast(Byte*, VAL_BINARY_AT(rebreq->binary)));
         buf.len = VAL_LEN_AT(rebreq->binary);
@@ -986,6 +1584,27 @@ static Bounce Transport_Actor(
 
         return result; }
 
+      case SYM_MODIFY: {
+        INCLUDE_PARAMS_OF_MODIFY;
+
+        UNUSED(PARAM(target));
+
+        // !!! Port modes don't have a general design yet.  This only knows
+        // the one setting, a LOGIC! for whether WRITE coalesces:
+        //
+        //     modify port 'coalesce true
+        //
+        if (not rebDid("'coalesce = @", ARG(field)))
+            fail (PARAM(field));
+        if (not IS_LOGIC(ARG(value)))
+            fail (PARAM(value));
+
+        sock->coalesce = VAL_LOGIC(ARG(value));
+        if (not sock->coalesce)
+            Flush_Queued_Writes(sock);
+
+        return Init_True(OUT); }
+
       case SYM_CLOSE: {
         if (sock->stream) {  // allows close of closed socket (?)
             REBVAL *error = Close_Socket(port);
@@ -1069,19 +1688,1090 @@ DECLARE_NATIVE(get_udp_actor_handle)
 }
 
 
-uv_timer_t wait_timer;
+//=//// WATCH SETS ////////////////////////////////////////////////////////=//
+//
+// WAIT on a block of ports has to be given the whole block each time, and
+// finding out which ports have data means reading each of them.  That's no
+// good for a server with thousands of idle keep-alive connections.
+//
+// A watch set is added to and removed from once per port.  While a port is
+// watched its socket is always reading (into the port's `data`, as with a
+// READ that has no /PART), and the libuv callback links the port into the
+// set's ready list.  WAIT on the set then only has to walk that list.
+//
+// The set does not keep its ports alive: a server is expected to hold its
+// connections anyway, and a port that is closed or GC'd leaves its set.
+//
 
-void wait_timer_callback(uv_timer_t* handle) {
-    assert(handle->data != nullptr);
-    handle->data = nullptr;
-}
+static void on_watch_alloc(
+    uv_handle_t *handle,
+    size_t suggested_size,
+    uv_buf_t *buf
+){
+    UNUSED(suggested_size);
 
+    SOCKREQ *sock = cast(SOCKREQ*, handle->data);
+    REBVAL *port_data = CTX_VAR(sock->watch_port_ctx, STD_PORT_DATA);
 
-uv_timer_t halt_poll_timer;
+    Binary(*) bin;
+    if (Is_Nulled(port_data)) {
+        bin = Make_Binary(NET_BUF_SIZE);
+        Init_Binary(port_data, bin);
+    }
+    else {
+        bin = VAL_BINARY_KNOWN_MUTABLE(port_data);
+        Extend_Series_If_Necessary(bin, NET_BUF_SIZE);
+    }
 
-void halt_poll_timer_callback(uv_timer_t* handle) {
-    //
-    // Doesn't actually do anything, just breaks the UV_RUN_ONCE loop
+    buf->base = s_cast(BIN_TAIL(bin));
+    buf->len = NET_BUF_SIZE;
+}
+
+static void Mark_Watch_Ready(SOCKREQ *sock)
+{
+    if (sock->ready)
+        return;
+    sock->ready = true;
+    sock->next_ready = sock->watch->ready;
+    sock->watch->ready = sock;
+}
+
+static void on_watch_read(
+    uv_stream_t *stream,
+    ssize_t nread,
+    const uv_buf_t *buf
+){
+    UNUSED(buf);
+
+    SOCKREQ *sock = cast(SOCKREQ*, stream->data);
+
+    if (nread == 0)
+        return;  // like EAGAIN, nothing happened
+
+    if (nread > 0) {
+        REBVAL *port_data = CTX_VAR(sock->watch_port_ctx, STD_PORT_DATA);
+        Binary(*) bin = VAL_BINARY_KNOWN_MUTABLE(port_data);
+        TERM_BIN_LEN(bin, BIN_LEN(bin) + nread);
+    }
+    else {
+        // EOF or error.  Stop reading so the loop doesn't spin on it; a READ
+        // of the port will restart the stream and report what happened.
+        //
+        uv_read_stop(stream);
+        sock->watch_reading = false;
+    }
+
+    Mark_Watch_Ready(sock);
+}
+
+static void Start_Watch_Reading(SOCKREQ *sock)
+{
+    sock->tcp.data = sock;
+    int r = uv_read_start(sock->stream, &on_watch_alloc, &on_watch_read);
+    sock->watch_reading = (r == 0);
+    if (r != 0)
+        Mark_Watch_Ready(sock);  // let READ report the problem
+}
+
+static void Unlink_Ready(SOCKREQ *sock)
+{
+    if (not sock->ready)
+        return;
+
+    SOCKREQ **link = &sock->watch->ready;
+    while (*link != sock)
+        link = &(*link)->next_ready;
+    *link = sock->next_ready;
+
+    sock->next_ready = nullptr;
+    sock->ready = false;
+}
+
+static void Unwatch_Sock(SOCKREQ *sock)
+{
+    struct Reb_Watch_Set *set = sock->watch;
+    assert(set);
+
+    if (sock->watch_reading) {
+        uv_read_stop(sock->stream);
+        sock->watch_reading = false;
+    }
+    sock->tcp.data = nullptr;
+
+    Unlink_Ready(sock);
+
+    if (sock->watch_prev)
+        sock->watch_prev->watch_next = sock->watch_next;
+    else
+        set->watched = sock->watch_next;
+    if (sock->watch_next)
+        sock->watch_next->watch_prev = sock->watch_prev;
+
+    sock->watch_prev = nullptr;
+    sock->watch_next = nullptr;
+    sock->watch_port_ctx = nullptr;
+    sock->watch = nullptr;
+}
+
+static void cleanup_watch_set(const REBVAL *v)
+{
+    struct Reb_Watch_Set *set = VAL_HANDLE_POINTER(struct Reb_Watch_Set, v);
+    while (set->watched)
+        Unwatch_Sock(set->watched);
+    FREE(struct Reb_Watch_Set, set);
+}
+
+static struct Reb_Watch_Set *Watch_Set_From_Handle(const REBVAL *handle)
+{
+    if (VAL_HANDLE_CLEANER(handle) != cleanup_watch_set)
+        fail ("Not a watch set (see MAKE-WATCH-SET)");
+    return VAL_HANDLE_POINTER(struct Reb_Watch_Set, handle);
+}
+
+static SOCKREQ *Watchable_Sock_Of_Port(const REBVAL *port)
+{
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
+    if (not IS_HANDLE(state) or VAL_HANDLE_CLEANER(state) != cleanup_sockreq)
+        fail ("Only TCP ports can be watched");
+
+    SOCKREQ *sock = Sock_Of_Port(port);
+    if (sock->transport != TRANSPORT_TCP or sock->stream == nullptr)
+        fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
+    return sock;
+}
+
+
+//
+//  export make-watch-set: native [
+//
+//  {Make a set of TCP ports for WAIT to watch for incoming data}
+//
+//      return: "Pass to WAIT (alone or in a block with a timeout)"
+//          [handle!]
+//  ]
+//
+DECLARE_NATIVE(make_watch_set)
+{
+    NETWORK_INCLUDE_PARAMS_OF_MAKE_WATCH_SET;
+
+    struct Reb_Watch_Set *set = TRY_ALLOC(struct Reb_Watch_Set);
+    set->watched = nullptr;
+    set->ready = nullptr;
+
+    return Init_Handle_Cdata_Managed(
+        OUT,
+        set,
+        sizeof(struct Reb_Watch_Set),
+        &cleanup_watch_set
+    );
+}
+
+
+//
+//  export watch-port: native [
+//
+//  {Add a connected TCP port to a watch set (the set won't keep it alive)}
+//
+//      return: <none>
+//      set [handle!]
+//      port [port!]
+//  ]
+//
+DECLARE_NATIVE(watch_port)
+{
+    NETWORK_INCLUDE_PARAMS_OF_WATCH_PORT;
+
+    struct Reb_Watch_Set *set = Watch_Set_From_Handle(ARG(set));
+    SOCKREQ *sock = Watchable_Sock_Of_Port(ARG(port));
+
+    if (sock->watch == set)
+        return NONE;  // already watched
+    if (sock->watch)
+        Unwatch_Sock(sock);  // a port is only in one set at a time
+
+    sock->watch = set;
+    sock->watch_port_ctx = VAL_CONTEXT(ARG(port));
+    sock->watch_prev = nullptr;
+    sock->watch_next = set->watched;
+    if (set->watched)
+        set->watched->watch_prev = sock;
+    set->watched = sock;
+
+    sock->ready = false;
+    sock->next_ready = nullptr;
+
+    // Data may already be sitting in the port from before it was watched.
+    //
+    REBVAL *port_data = CTX_VAR(sock->watch_port_ctx, STD_PORT_DATA);
+    if (IS_BINARY(port_data) and VAL_LEN_AT(port_data) != 0)
+        Mark_Watch_Ready(sock);
+
+    Start_Watch_Reading(sock);
+    return NONE;
+}
+
+
+//
+//  export unwatch-port: native [
+//
+//  {Remove a TCP port from the watch set it's in, if any}
+//
+//      return: <none>
+//      port [port!]
+//  ]
+//
+DECLARE_NATIVE(unwatch_port)
+{
+    NETWORK_INCLUDE_PARAMS_OF_UNWATCH_PORT;
+
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(ARG(port)), STD_PORT_STATE);
+    if (IS_HANDLE(state) and VAL_HANDLE_CLEANER(state) == cleanup_sockreq) {
+        SOCKREQ *sock = Sock_Of_Port(ARG(port));
+        if (sock->watch)
+            Unwatch_Sock(sock);
+    }
+    return NONE;
+}
+
+
+// Gather the ports that became ready into a BLOCK!, and reset them so the
+// next WAIT only reports new activity.
+//
+static REBVAL *Take_Ready_Ports(REBVAL *out, struct Reb_Watch_Set *set)
+{
+    StackIndex base = TOP_INDEX;
+
+    SOCKREQ *sock = set->ready;
+    while (sock) {
+        SOCKREQ *next = sock->next_ready;
+        Copy_Cell(PUSH(), CTX_ARCHETYPE(sock->watch_port_ctx));
+        sock->ready = false;
+        sock->next_ready = nullptr;
+        sock = next;
+    }
+    set->ready = nullptr;
+
+    return Init_Block(out, Pop_Stack_Values(base));
+}
+
+
+//=//// TRANSFER (SENDFILE) ///////////////////////////////////////////////=//
+//
+// Serving a file by READ-ing it and WRITE-ing the BINARY! copies it through
+// user space twice, and needs memory for the whole file.  TRANSFER instead
+// has the OS send from the file to the socket with sendfile(), a chunk at a
+// time so that progress can be reported and a HALT noticed in between.
+//
+// libuv's TCP sockets are non-blocking, and sendfile() on them gives EAGAIN
+// as soon as the socket buffer fills.  Since TRANSFER is synchronous like
+// WRITE, the socket is made blocking for the duration of each chunk.
+//
+
+#define TRANSFER_CHUNK_SIZE (1024 * 1024)
+
+#if TO_WINDOWS
+    typedef struct {
+        uv_write_t req;  // make first member so we can cast the address
+        int status;
+        bool finished;
+    } Reb_Chunk_Write;
+
+    static void on_chunk_written(uv_write_t *req, int status) {
+        Reb_Chunk_Write *w = cast(Reb_Chunk_Write*, req);
+        w->status = status;
+        w->finished = true;
+    }
+#endif
+
+// Returns the number of bytes sent (0 at end of file), or a negative libuv
+// error code.
+//
+static int64_t Transfer_Chunk(
+    SOCKREQ *sock,
+    uv_file in,
+    uint64_t offset,
+    size_t length
+){
+  #if TO_WINDOWS
+    //
+    // uv_fs_sendfile() on Windows is emulated with read() and write() of C
+    // runtime descriptors, which sockets aren't.  So this reads a chunk and
+    // writes it as WRITE would, which still keeps memory use bounded.
+    //
+    // !!! TransmitFile() would be the Windows equivalent of sendfile().
+    //
+    char *buffer = rebAllocN(char, length);
+    uv_buf_t buf;
+    buf.base = buffer;
+    buf.len = length;
+
+    uv_fs_t req;
+    int64_t n = uv_fs_read(
+        uv_default_loop(), &req, in, &buf, 1, offset, nullptr
+    );
+    uv_fs_req_cleanup(&req);
+
+    if (n > 0) {
+        buf.len = n;
+
+        Reb_Chunk_Write w;
+        w.finished = false;
+        int r = uv_write(&w.req, sock->stream, &buf, 1, &on_chunk_written);
+        if (r < 0)
+            n = r;
+        else {
+            do {
+                uv_run(uv_default_loop(), UV_RUN_ONCE);
+            } while (not w.finished);
+            if (w.status < 0)
+                n = w.status;
+        }
+    }
+
+    rebFree(buffer);
+    return n;
+  #else
+    uv_os_fd_t out;
+    int r = uv_fileno(cast(uv_handle_t*, &sock->tcp), &out);
+    if (r < 0)
+        return r;
+
+    uv_stream_set_blocking(sock->stream, 1);
+
+    uv_fs_t req;
+    int64_t n = uv_fs_sendfile(
+        uv_default_loop(), &req, out, in, offset, length, nullptr
+    );
+    uv_fs_req_cleanup(&req);
+
+    uv_stream_set_blocking(sock->stream, 0);
+    return n;
+  #endif
+}
+
+
+//
+//  export transfer: native [
+//
+//  {Send a file to a TCP port without reading it into memory (sendfile)}
+//
+//      return: "Number of bytes sent"
+//          [integer!]
+//      port "Connected TCP port"
+//          [port!]
+//      source "FILE! to send, or open file PORT! to send from its position"
+//          [file! port!]
+//      /part "Maximum number of bytes to send"
+//          [integer!]
+//      /progress "Called after each chunk with bytes sent and total to send"
+//          [action!]
+//  ]
+//
+DECLARE_NATIVE(transfer)
+{
+    NETWORK_INCLUDE_PARAMS_OF_TRANSFER;
+
+    REBVAL *port = ARG(port);
+
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
+    if (not IS_HANDLE(state) or VAL_HANDLE_CLEANER(state) != cleanup_sockreq)
+        fail ("TRANSFER needs a TCP port to send to");
+
+    SOCKREQ *sock = Sock_Of_Port(port);
+    if (sock->transport != TRANSPORT_TCP or sock->stream == nullptr)
+        fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
+
+    if (REF(part) and VAL_INT64(ARG(part)) < 0)
+        fail (PARAM(part));
+
+    // Anything already written has to go out ahead of the file.
+    //
+    Flush_Queued_Writes(sock);
+    while (sock->writes_in_flight != 0)
+        uv_run(uv_default_loop(), UV_RUN_ONCE);
+    if (sock->write_error)
+        return RAISE(Take_Write_Error(sock));
+
+    uv_file in;
+    FILEREQ *file = nullptr;
+    uint64_t offset;
+
+    if (IS_PORT(ARG(source))) {
+        if (not rebDid("'file = (@", ARG(source), ").scheme.name"))
+            fail ("TRANSFER can only send from a FILE! or a file PORT!");
+
+        file = File_Of_Port(ARG(source));
+        if (file->id == FILEHANDLE_NONE)
+            fail (Error_On_Port(SYM_NOT_OPEN, ARG(source), -12));
+        if (file->is_dir)
+            fail ("TRANSFER can't send a directory");
+
+        in = file->id;
+        offset = file->offset;
+    }
+    else {
+        char *path = rebSpell("file-to-local/full", ARG(source));
+
+        uv_fs_t req;
+        int r = uv_fs_open(
+            uv_default_loop(), &req, path, UV_FS_O_RDONLY, 0, nullptr
+        );
+        uv_fs_req_cleanup(&req);
+        rebFree(path);
+        if (r < 0)
+            return RAISE(rebError_UV(r));
+
+        in = r;
+        offset = 0;
+    }
+
+    REBVAL *error = nullptr;
+    uint64_t sent = 0;
+
+    uint64_t total;
+  blockscope {
+    uv_fs_t req;
+    int r = uv_fs_fstat(uv_default_loop(), &req, in, nullptr);
+    total = req.statbuf.st_size;
+    uv_fs_req_cleanup(&req);
+    if (r < 0) {
+        error = rebError_UV(r);
+        goto finished;
+    }
+  }
+
+    total = (offset < total) ? total - offset : 0;
+    if (REF(part) and cast(uint64_t, VAL_INT64(ARG(part))) < total)
+        total = VAL_INT64(ARG(part));
+
+    while (sent < total) {
+        uint64_t chunk = total - sent;
+        if (chunk > TRANSFER_CHUNK_SIZE)
+            chunk = TRANSFER_CHUNK_SIZE;
+
+        int64_t n = Transfer_Chunk(sock, in, offset + sent, chunk);
+        if (n < 0) {
+            error = rebError_UV(n);
+            break;
+        }
+        if (n == 0)
+            break;  // file got shorter since the fstat()
+
+        sent += n;
+
+        if (REF(progress)) {  // trap errors so a FILE! still gets closed
+            REBVAL *result = rebEntrap(
+                rebRUN(ARG(progress)), rebI(sent), rebI(total)
+            );
+            if (result and rebUnboxLogic("error? @", result)) {
+                error = result;
+                break;
+            }
+            rebRelease(result);
+        }
+
+        if (GET_SIGNAL(SIG_HALT))
+            break;  // evaluator will notice and halt on return
+    }
+
+  finished:
+
+    if (file)
+        file->offset += sent;
+    else {
+        uv_fs_t req;
+        uv_fs_close(uv_default_loop(), &req, in, nullptr);
+        uv_fs_req_cleanup(&req);
+    }
+
+    if (error)
+        return RAISE(error);
+
+    return Init_Integer(OUT, sent);
+}
+
+
+//=//// HTTP REQUEST PARSING ///////////////////////////////////////////////=//
+//
+// The http-server scheme (see %ext-network-init.reb) keeps each connection
+// in a watch set, so its requests accrue in the port's `data`.  Finding the
+// request line, splitting up the headers and undoing chunked framing are
+// byte-at-a-time jobs that are slow in usermode, so PARSE-HTTP-REQUEST does
+// them here on that buffer in place.  Only the request's fields are copied.
+//
+// A request is taken off the head of the buffer only once it is complete,
+// body and all.  So when a client sends several requests without waiting for
+// the responses (pipelining), the ones after it stay in the buffer for the
+// next call.  An incomplete request is scanned again from the top when more
+// data arrives, which is cheap given the limit on header size.
+//
+// A request that can't be served gives the HTTP status code to answer with
+// instead (e.g. 400 Bad Request), after which the connection should close.
+//
+// https://tools.ietf.org/html/rfc7230
+//
+
+#define HTTP_MAX_HEADER_SIZE (64 * 1024)  // request line and headers, else 431
+#define HTTP_MAX_HEADERS 100  // else 431
+
+#define HTTP_INCOMPLETE 0  // status meaning "read more and try again"
+#define HTTP_OK 200
+
+typedef struct {
+    const Byte* name;
+    Size name_size;
+    const Byte* value;
+    Size value_size;
+} Http_Header;
+
+typedef struct {
+    const Byte* head;
+    const Byte* tail;
+    REBI64 limit;  // largest body allowed, -1 for no limit
+
+    const Byte* method;
+    Size method_size;
+    const Byte* target;
+    Size target_size;
+    bool http_1_1;  // else HTTP/1.0
+
+    Http_Header headers[HTTP_MAX_HEADERS];
+    REBLEN num_headers;
+
+    bool keep_alive;
+    bool chunked;
+    const Byte* body;  // start of the body (or of its first chunk)
+    Size body_size;  // size without chunk framing
+    Size request_size;  // everything taken off the buffer for this request
+} Http_Request;
+
+
+// tchar from https://tools.ietf.org/html/rfc7230#section-3.2.6
+//
+inline static bool Is_Http_Token_Char(Byte b) {
+    if (
+        (b >= 'a' and b <= 'z') or (b >= 'A' and b <= 'Z')
+        or (b >= '0' and b <= '9')
+    ){
+        return true;
+    }
+    return b != '\0' and strchr("!#$%&'*+-.^_`|~", b) != nullptr;
+}
+
+inline static Byte Http_Lower(Byte b)
+  { return (b >= 'A' and b <= 'Z') ? b + ('a' - 'A') : b; }
+
+static bool Http_Same(const Byte* bp, Size size, const char *lower)
+{
+    if (strlen(lower) != size)
+        return false;
+    for (; size != 0; --size, ++bp, ++lower) {
+        if (Http_Lower(*bp) != *lower)
+            return false;
+    }
+    return true;
+}
+
+
+static bool Http_Same_Name(const Http_Header* a, const Http_Header* b)
+{
+    if (a->name == nullptr or a->name_size != b->name_size)
+        return false;
+    Size i;
+    for (i = 0; i < a->name_size; ++i) {
+        if (Http_Lower(a->name[i]) != Http_Lower(b->name[i]))
+            return false;
+    }
+    return true;
+}
+
+
+// Gives the end of the line at bp (before its CR LF, or bare LF, which is
+// tolerated as RFC 7230 3.5 suggests), and the start of the line after it.
+// Returns nullptr if there's no LF yet.
+//
+static const Byte* Http_Line_End(
+    const Byte** next,
+    const Byte* bp,
+    const Byte* tail
+){
+    const Byte* lf = cast(const Byte*, memchr(bp, LF, tail - bp));
+    if (not lf)
+        return nullptr;
+    *next = lf + 1;
+    if (lf != bp and lf[-1] == CR)
+        return lf - 1;
+    return lf;
+}
+
+
+// Whether a comma-separated header value (e.g. of Connection) has a token.
+//
+static bool Http_Has_Token(const Http_Header* h, const char *lower)
+{
+    const Byte* bp = h->value;
+    const Byte* tail = h->value + h->value_size;
+    while (bp != tail) {
+        while (bp != tail and (*bp == ',' or *bp == ' ' or *bp == '\t'))
+            ++bp;
+        const Byte* start = bp;
+        while (bp != tail and *bp != ',' and *bp != ' ' and *bp != '\t')
+            ++bp;
+        if (bp != start and Http_Same(start, bp - start, lower))
+            return true;
+    }
+    return false;
+}
+
+
+// Checks the chunked body at bp, giving its unframed size and the end of its
+// trailer section.  If `out` isn't nullptr, the chunks' data is copied there.
+//
+// https://tools.ietf.org/html/rfc7230#section-4.1
+//
+static REBINT Scan_Http_Chunks(
+    Http_Request* r,
+    const Byte** end,
+    const Byte* bp,
+    Byte* out
+){
+    Size total = 0;
+
+    while (true) {
+        const Byte* next;
+        const Byte* eol = Http_Line_End(&next, bp, r->tail);
+        if (not eol)
+            return HTTP_INCOMPLETE;
+
+        uint64_t size = 0;
+        const Byte* hex = bp;
+        for (; bp != eol; ++bp) {
+            Byte b = Http_Lower(*bp);
+            if (b >= '0' and b <= '9')
+                size = (size << 4) + (b - '0');
+            else if (b >= 'a' and b <= 'f')
+                size = (size << 4) + (b - 'a' + 10);
+            else
+                break;
+            if (size > UINT32_MAX)
+                return 413;  // Payload Too Large
+        }
+        if (bp == hex or (bp != eol and *bp != ';' and *bp != ' '))
+            return 400;  // (anything after `;` is a chunk extension)
+        bp = next;
+
+        if (size == 0)
+            break;
+
+        total += cast(Size, size);
+        if (r->limit >= 0 and total > cast(uint64_t, r->limit))
+            return 413;  // Payload Too Large
+
+        if (cast(uint64_t, r->tail - bp) < size)
+            return HTTP_INCOMPLETE;
+        if (out) {
+            memcpy(out, bp, cast(Size, size));
+            out += size;
+        }
+        bp += size;
+
+        eol = Http_Line_End(&next, bp, r->tail);
+        if (not eol)
+            return HTTP_INCOMPLETE;
+        if (eol != bp)
+            return 400;  // data wasn't the size the chunk said
+        bp = next;
+    }
+
+    while (true) {  // trailer fields aren't used, just skipped
+        const Byte* next;
+        const Byte* eol = Http_Line_End(&next, bp, r->tail);
+        if (not eol)
+            return HTTP_INCOMPLETE;
+        bool empty = (eol == bp);
+        bp = next;
+        if (empty)
+            break;
+    }
+
+    *end = bp;
+    r->body_size = total;
+    return HTTP_OK;
+}
+
+
+// Headers that haven't ended yet may still be too big to ever be accepted.
+//
+static REBINT Http_Incomplete(Http_Request* r)
+{
+    if (r->tail - r->head > HTTP_MAX_HEADER_SIZE)
+        return 431;  // Request Header Fields Too Large
+    return HTTP_INCOMPLETE;
+}
+
+
+//
+//  Scan_Http_Request: C
+//
+// Find the parts of the request at the head of r->head, without copying.
+//
+static REBINT Scan_Http_Request(Http_Request* r)
+{
+    r->chunked = false;
+    r->body_size = 0;
+
+    const Byte* bp = r->head;
+    while (bp != r->tail and (*bp == CR or *bp == LF))
+        ++bp;  // "SHOULD ignore at least one empty line" before a request
+
+    const Byte* next;
+    const Byte* eol = Http_Line_End(&next, bp, r->tail);
+
+  //=//// REQUEST LINE, e.g. `GET /index.html HTTP/1.1` ////////////////////=//
+
+    if (not eol)
+        return Http_Incomplete(r);
+
+    r->method = bp;
+    while (bp != eol and Is_Http_Token_Char(*bp))
+        ++bp;
+    r->method_size = bp - r->method;
+    if (r->method_size == 0 or bp == eol or *bp != ' ')
+        return 400;
+    ++bp;
+
+    r->target = bp;
+    while (bp != eol and *bp > ' ' and *bp < 0x7F)  // no spaces, only ASCII
+        ++bp;
+    r->target_size = bp - r->target;
+    if (r->target_size == 0 or bp == eol or *bp != ' ')
+        return 400;
+    ++bp;
+
+    if (eol - bp != 8 or memcmp(bp, "HTTP/1.", 7) != 0) {
+        if (eol - bp >= 5 and memcmp(bp, "HTTP/", 5) == 0)
+            return 505;  // HTTP Version Not Supported
+        return 400;
+    }
+    if (bp[7] == '1')
+        r->http_1_1 = true;
+    else if (bp[7] == '0')
+        r->http_1_1 = false;
+    else
+        return 505;
+
+  //=//// HEADER FIELDS, e.g. `Content-Length: 1020` ///////////////////////=//
+
+    r->num_headers = 0;
+
+    const Http_Header* content_length = nullptr;
+    const Http_Header* transfer_encoding = nullptr;
+    const Http_Header* connection = nullptr;
+
+    while (true) {
+        bp = next;
+        eol = Http_Line_End(&next, bp, r->tail);
+        if (not eol)
+            return Http_Incomplete(r);
+        if (eol - r->head > HTTP_MAX_HEADER_SIZE)
+            return 431;  // Request Header Fields Too Large
+
+        if (eol == bp)
+            break;  // empty line ends the headers
+
+        if (*bp == ' ' or *bp == '\t')
+            return 400;  // obsolete line folding, RFC 7230 3.2.4 says reject
+
+        if (r->num_headers == HTTP_MAX_HEADERS)
+            return 431;
+        Http_Header* h = &r->headers[r->num_headers];
+
+        h->name = bp;
+        while (bp != eol and Is_Http_Token_Char(*bp))
+            ++bp;
+        h->name_size = bp - h->name;
+        if (h->name_size == 0 or bp == eol or *bp != ':')
+            return 400;  // (includes whitespace before the colon)
+        ++bp;
+
+        while (bp != eol and (*bp == ' ' or *bp == '\t'))
+            ++bp;
+        const Byte* value_tail = eol;
+        while (value_tail != bp and (
+            value_tail[-1] == ' ' or value_tail[-1] == '\t'
+        )){
+            --value_tail;
+        }
+        h->value = bp;
+        h->value_size = value_tail - bp;
+
+        bool ascii = true;
+        for (; bp != value_tail; ++bp) {
+            if (*bp < ' ' ? *bp != '\t' : *bp == 0x7F)
+                return 400;  // control characters aren't allowed
+            if (*bp >= 0x80)
+                ascii = false;
+        }
+        Length len;  // values will be TEXT!, so they have to be valid UTF-8
+        if (not ascii and Find_Invalid_Utf8(&len, h->value, h->value_size))
+            return 400;
+
+        if (Http_Same(h->name, h->name_size, "content-length")) {
+            if (
+                content_length
+                and (
+                    content_length->value_size != h->value_size
+                    or memcmp(content_length->value, h->value, h->value_size)
+                )
+            ){
+                return 400;  // differing lengths, RFC 7230 3.3.2
+            }
+            content_length = h;
+        }
+        else if (Http_Same(h->name, h->name_size, "transfer-encoding")) {
+            if (transfer_encoding)
+                return 501;  // a list of codings
+            transfer_encoding = h;
+        }
+        else if (Http_Same(h->name, h->name_size, "connection"))
+            connection = h;
+
+        ++r->num_headers;
+    }
+
+    const Byte* headers_end = next;
+
+    if (connection and Http_Has_Token(connection, "close"))
+        r->keep_alive = false;
+    else if (r->http_1_1)
+        r->keep_alive = true;
+    else
+        r->keep_alive = (
+            connection and Http_Has_Token(connection, "keep-alive")
+        );
+
+  //=//// BODY, FRAMED BY CONTENT-LENGTH OR TRANSFER-ENCODING //////////////=//
+
+    // A request with both could be read differently by a proxy in front of
+    // the server than by the server ("request smuggling"), so it's refused.
+    //
+    if (transfer_encoding and content_length)
+        return 400;
+
+    r->body = headers_end;
+
+    if (transfer_encoding) {
+        if (not Http_Same(
+            transfer_encoding->value, transfer_encoding->value_size, "chunked"
+        )){
+            return 501;  // Not Implemented, e.g. gzip
+        }
+        r->chunked = true;
+
+        const Byte* end;
+        REBINT status = Scan_Http_Chunks(r, &end, headers_end, nullptr);
+        if (status != HTTP_OK)
+            return status;
+        r->request_size = end - r->head;
+        return HTTP_OK;
+    }
+
+    r->chunked = false;
+
+    uint64_t size = 0;
+    if (content_length) {
+        const Byte* cp = content_length->value;
+        const Byte* tail = cp + content_length->value_size;
+        if (cp == tail)
+            return 400;
+        for (; cp != tail; ++cp) {
+            if (*cp < '0' or *cp > '9')
+                return 400;
+            size = size * 10 + (*cp - '0');
+            if (size > UINT32_MAX)
+                return 413;  // Payload Too Large
+        }
+        if (r->limit >= 0 and size > cast(uint64_t, r->limit))
+            return 413;
+    }
+
+    if (cast(uint64_t, r->tail - headers_end) < size)
+        return HTTP_INCOMPLETE;
+
+    r->body_size = cast(Size, size);
+    r->request_size = (headers_end - r->head) + size;
+    return HTTP_OK;
+}
+
+
+//
+//  export parse-http-request: native [
+//
+//  {Take one whole HTTP/1.x request off the head of a read buffer}
+//
+//      return: "Null if not all there yet, or INTEGER! status to refuse with"
+//          [<opt> object! integer!]
+//      buffer "Bytes of the request are removed, pipelined ones stay"
+//          [binary!]
+//      /limit "Largest body accepted (default is no limit), else gives 413"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(parse_http_request)
+//
+// The request is an object with these fields:
+//
+//     method: "GET"  ; TEXT!, case-sensitive per the RFC
+//     target: "/search?q=ren-c"  ; as sent, so still percent-encoded
+//     path: "/search"
+//     query: "q=ren-c"  ; null if no `?`
+//     version: 1.1
+//     headers: make map! ["host" "example.com" ...]  ; lowercase names
+//     body: null  ; BINARY! if sent, with any chunked framing removed
+//     keep-alive: true  ; false if the connection closes after responding
+//
+// A header that's sent more than once has its values joined with ", ".
+{
+    NETWORK_INCLUDE_PARAMS_OF_PARSE_HTTP_REQUEST;
+
+    REBVAL *buffer = ARG(buffer);
+
+    Http_Request r;
+    Size size;
+    r.head = VAL_BINARY_SIZE_AT(&size, buffer);
+    r.tail = r.head + size;
+    r.limit = REF(limit) ? VAL_INT64(ARG(limit)) : -1;
+
+    REBINT status = Scan_Http_Request(&r);
+    if (status == HTTP_INCOMPLETE)
+        return nullptr;
+    if (status != HTTP_OK)
+        return Init_Integer(OUT, status);
+
+    StackIndex base = TOP_INDEX;
+
+    REBLEN i;
+    for (i = 0; i < r.num_headers; ++i) {
+        Http_Header* h = &r.headers[i];
+        if (h->name == nullptr)
+            continue;  // joined onto an earlier field of the same name
+
+        Size value_size = h->value_size;
+        REBLEN n;
+        for (n = i + 1; n < r.num_headers; ++n) {
+            if (Http_Same_Name(&r.headers[n], h))
+                value_size += 2 + r.headers[n].value_size;
+        }
+
+        String(*) name = Make_String(h->name_size);
+        Byte* dp = STR_HEAD(name);
+        Size k;
+        for (k = 0; k < h->name_size; ++k)
+            dp[k] = Http_Lower(h->name[k]);
+        TERM_STR_LEN_SIZE(name, h->name_size, h->name_size);  // ASCII
+        Init_Text(PUSH(), name);
+
+        String(*) value = Make_String(value_size);
+        dp = STR_HEAD(value);
+        memcpy(dp, h->value, h->value_size);
+        dp += h->value_size;
+        for (n = i + 1; n < r.num_headers; ++n) {
+            Http_Header* dup = &r.headers[n];
+            if (not Http_Same_Name(dup, h))
+                continue;
+            memcpy(dp, ", ", 2);
+            memcpy(dp + 2, dup->value, dup->value_size);
+            dp += 2 + dup->value_size;
+            dup->name = nullptr;
+        }
+        Length len;
+        const Byte* bad = Find_Invalid_Utf8(&len, STR_HEAD(value), value_size);
+        assert(bad == nullptr);  // Scan_Http_Request() checked
+        UNUSED(bad);
+        TERM_STR_LEN_SIZE(value, len, value_size);
+        Init_Text(PUSH(), value);
+    }
+
+    REBMAP *map = Make_Map((TOP_INDEX - base) / 2);
+
+    StackIndex pair = base + 1;
+    for (; pair < TOP_INDEX; pair += 2) {
+        const bool strict = true;  // names are already lowercase
+        Find_Map_Entry(
+            map,
+            Data_Stack_At(pair),
+            SPECIFIED,
+            Data_Stack_At(pair + 1),
+            SPECIFIED,
+            strict
+        );
+    }
+    Drop_Data_Stack_To(base);
+
+    // OUT and SPARE hold the map and body while the object is made, as the
+    // data stack can move during an evaluation.
+    //
+    REBVAL *headers = Init_Map(OUT, map);
+
+    REBVAL *body = nullptr;
+    if (r.body_size != 0 or r.chunked) {
+        Binary(*) bin = Make_Binary(r.body_size);
+        if (r.chunked) {
+            const Byte* end;
+            REBINT rescan = Scan_Http_Chunks(&r, &end, r.body, BIN_HEAD(bin));
+            assert(rescan == HTTP_OK);
+            UNUSED(rescan);
+        }
+        else
+            memcpy(BIN_HEAD(bin), r.body, r.body_size);
+        TERM_BIN_LEN(bin, r.body_size);
+        body = Init_Binary(SPARE, bin);
+    }
+
+    const Byte* question = cast(
+        const Byte*, memchr(r.target, '?', r.target_size)
+    );
+    Size path_size = question ? question - r.target : r.target_size;
+    REBVAL *query = question
+        ? rebSizedText(cs_cast(question + 1), r.target_size - path_size - 1)
+        : nullptr;
+
+    REBVAL *request = rebValue(
+        "make object! [",
+            "method:", rebR(rebSizedText(cs_cast(r.method), r.method_size)),
+            "target:", rebR(rebSizedText(cs_cast(r.target), r.target_size)),
+            "path:", rebR(rebSizedText(cs_cast(r.target), path_size)),
+            "query:", rebQ(query),
+            "version:", r.http_1_1 ? "1.1" : "1.0",
+            "headers:", headers,
+            "body:", rebQ(body),
+            "keep-alive:", rebL(r.keep_alive),
+        "]"
+    );
+    rebRelease(query);
+
+    // Only now that nothing points into the buffer is the request removed.
+    //
+    Binary(*) bin = VAL_BINARY_ENSURE_MUTABLE(buffer);
+    Remove_Series_Units(bin, VAL_INDEX(buffer), r.request_size);
+
+    return request;
+}
+
+
+uv_timer_t wait_timer;
+
+void wait_timer_callback(uv_timer_t* handle) {
+    assert(handle->data != nullptr);
+    handle->data = nullptr;
+}
+
+
+uv_timer_t halt_poll_timer;
+
+void halt_poll_timer_callback(uv_timer_t* handle) {
+    //
+    // Doesn't actually do anything, just breaks the UV_RUN_ONCE loop
     // every half a second.  Theoretically we could do this with uv_signal_t
     // for SIGINT and a callback like:
     //
@@ -1162,6 +2852,28 @@ DECLARE_NATIVE(shutdown_p)
 }
 
 
+// Ports that gather events (e.g. the filesystem extension's WATCH ports) do
+// so in a BLOCK! in the port's `data`.  WAIT returns the first such port in
+// its list to have any.  (Network ports buffer a BINARY!, so aren't seen.)
+//
+static const REBVAL *Find_Port_With_Events(const REBVAL *ports)
+{
+    if (ports == nullptr)
+        return nullptr;
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ports);
+    for (; item != tail; ++item) {
+        if (not IS_PORT(item))
+            continue;
+        REBVAL *data = CTX_VAR(VAL_CONTEXT(item), STD_PORT_DATA);
+        if (IS_BLOCK(data) and VAL_LEN_AT(data) != 0)
+            return SPECIFIC(item);
+    }
+    return nullptr;
+}
+
+
 //
 //  export wait*: native [
 //
@@ -1169,7 +2881,8 @@ DECLARE_NATIVE(shutdown_p)
 //
 //      return: "NULL if timeout, PORT! that awoke or BLOCK! of ports if /ALL"
 //          [<opt> port! block!]
-//      value [<opt> any-number! time! port! block!]
+//      value "HANDLE! is a set from MAKE-WATCH-SET, gives BLOCK! of ready"
+//          [<opt> any-number! time! port! block! handle!]
 //  ]
 //
 DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
@@ -1180,8 +2893,11 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
 {
     NETWORK_INCLUDE_PARAMS_OF_WAIT_P;
 
+    Flush_All_Queued_Writes();  // a WAIT ends a burst of coalesced WRITEs
+
     REBLEN timeout = 0;  // in milliseconds
     REBVAL *ports = nullptr;
+    struct Reb_Watch_Set *watch = nullptr;
 
     Cell(const*) val;
     if (not IS_BLOCK(ARG(value)))
@@ -1195,6 +2911,10 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
         for (; val != tail; ++val) {  // find timeout
             if (IS_PORT(val))
                 ++num_pending;
+            else if (IS_HANDLE(val)) {
+                watch = Watch_Set_From_Handle(SPECIFIC(val));
+                ++num_pending;
+            }
 
             if (IS_INTEGER(val) or IS_DECIMAL(val) or IS_TIME(val))
                 break;
@@ -1228,11 +2948,23 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
             timeout = ALL_BITS; // wait for all windows
             break;
 
+          case REB_HANDLE:
+            watch = Watch_Set_From_Handle(SPECIFIC(val));
+            timeout = ALL_BITS;
+            break;
+
           default:
             fail (Error_Bad_Value(val));
         }
     }
 
+    if (watch and watch->ready)  // activity since the last WAIT, don't block
+        return Take_Ready_Ports(OUT, watch);
+
+    const REBVAL *woken = Find_Port_With_Events(ports);
+    if (woken)
+        return COPY(woken);
+
     const uint64_t repeat_ms = 0;  // do not repeat the timer
 
     if (timeout != ALL_BITS) {
@@ -1250,10 +2982,15 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
     //
     while (
         (timeout == ALL_BITS or wait_timer.data != nullptr)
+        and not (watch and watch->ready)
         and not GET_SIGNAL(SIG_HALT)
     ){
         int callbacks_left = uv_run(uv_default_loop(), UV_RUN_ONCE);
         UNUSED(callbacks_left);
+
+        woken = Find_Port_With_Events(ports);
+        if (woken)
+            break;
     }
 
     uv_timer_stop(&halt_poll_timer);
@@ -1278,5 +3015,11 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
         fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
     }
 
+    if (watch and watch->ready)
+        return Take_Ready_Ports(OUT, watch);
+
+    if (woken)
+        return COPY(woken);
+
     return nullptr;
 }
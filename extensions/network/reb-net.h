@@ -65,10 +65,48 @@ struct Reb_Sock_Port_State {
     uint32_t local_port_number;
     uint32_t remote_ip;
     uint32_t remote_port_number;
+    bool reuse_port;  // SO_REUSEPORT on a listening socket
+
+    // If the port is in a watch set (see WATCH-PORT) then the socket reads
+    // continuously into the port's `data`, and the first data, EOF or error
+    // since the last WAIT puts the port on the set's ready list.
+    //
+    struct Reb_Watch_Set *watch;
+    Context(*) watch_port_ctx;  // not GC-protected, see WATCH-PORT
+    struct Reb_Sock_Port_State *watch_prev;  // all ports in the set
+    struct Reb_Sock_Port_State *watch_next;
+    struct Reb_Sock_Port_State *next_ready;  // only ports that are ready
+    bool ready;
+    bool watch_reading;  // false once EOF or an error stops the reads
+
+    // With `modify port 'coalesce true`, WRITE doesn't wait for its data to
+    // be sent.  The copies are queued here and go out together as one
+    // vectored uv_write() when enough has built up, or at READ, WAIT or
+    // CLOSE.  A failure is reported by the next operation on the port.
+    //
+    bool coalesce;
+    REBVAL **queued;  // unmanaged BINARY! API handles, rebAlloc()'d array
+    REBLEN num_queued;
+    REBLEN queued_capacity;
+    Size queued_bytes;
+    REBLEN writes_in_flight;
+    REBVAL *write_error;
+    struct Reb_Sock_Port_State *next_flush;  // on list WAIT flushes
+    bool flush_listed;
 };
 
 typedef struct Reb_Sock_Port_State SOCKREQ;
 
+
+// A watch set is kept in a HANDLE!.  Lists are intrusive, through the
+// SOCKREQ of each port, so WAIT can collect the ready ports without looking
+// at the ones that are idle.
+//
+struct Reb_Watch_Set {
+    SOCKREQ *watched;  // doubly linked through watch_prev/watch_next
+    SOCKREQ *ready;  // singly linked through next_ready
+};
+
 inline static SOCKREQ *Sock_Of_Port(const REBVAL *port)
 {
     REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
@@ -85,6 +123,18 @@ typedef struct {
 } Reb_Write_Request;
 
 
+// A coalesced write: the queued BINARY!s of a port handed to one uv_write().
+// It's freed by its callback, nobody waits on it.
+//
+typedef struct {
+    uv_write_t req;  // make first member of struct so we can cast the address
+
+    SOCKREQ *sock;
+    REBVAL **binaries;
+    REBLEN num_binaries;
+} Reb_Write_Batch;
+
+
 // While many libuv functions let you give a `nullptr` for the callback, for
 // some reason the connect request doesn't allow it.
 //
@@ -106,6 +156,13 @@ typedef struct {
     // prevents multiple in-flight reads and is a design flaw, but translating
     // the R3-Alpha code for now just as a first step.
 
+    // READ/INTO gives a caller's BINARY! to append to instead of the port's
+    // data (nullptr if not used).  It's expected to be reused across reads,
+    // so its spare capacity is handed to libuv as-is.
+    //
+    Binary(*) into;
+    Length into_start;  // length before the READ, restored on error
+
     REBVAL *result;
 
 } Reb_Read_Request;
@@ -94,9 +94,23 @@
 SQLHENV henv = SQL_NULL_HANDLE;
 
 
+#define ODBC_PREPARED_CACHE_MAX_STATEMENTS 128
+#define ODBC_PREPARED_CACHE_MAX_SQL_BYTES (1024 * 1024)
+
+struct tagPREPARED {  // An HSTMT with SQL already prepared on it
+    SQLWCHAR *sql;  // malloc()'d, null terminated
+    REBLEN sql_len;  // in SQLWCHARs, not counting terminator
+    SQLHSTMT hstmt;
+};
+typedef struct tagPREPARED PREPARED;
+
 struct tagCONNECTION {  // indirection so SHUTDOWN* can find and kill open HDBC
     SQLHDBC hdbc;  // if SQL_NULL_HANDLE, cleanup already done
 
+    PREPARED prepared[ODBC_PREPARED_CACHE_MAX_STATEMENTS];  // most recent 1st
+    REBLEN num_prepared;
+    Size prepared_sql_size;
+
     struct tagCONNECTION *next;
 };
 typedef struct tagCONNECTION CONNECTION;
@@ -109,6 +123,14 @@ struct tagPARAMETER {  // For binding parameters
 };
 typedef struct tagPARAMETER PARAMETER;
 
+struct tagPARAMARRAY {  // For binding a parameter to an array of values
+    SQLSMALLINT c_type;  // SQL_C_DEFAULT if all values are BLANK!
+    SQLLEN max_size;  // longest TEXT! or BINARY! value, in bytes
+    char *buffer;
+    SQLLEN *lengths;  // length (or SQL_NULL_DATA) for each value
+};
+typedef struct tagPARAMARRAY PARAMARRAY;
+
 struct tagCOLUMN {  // For describing a single column
     REBVAL *title;  // a TEXT!
     SQLSMALLINT sql_type;
@@ -247,6 +269,202 @@ REBVAL *Error_ODBC_Core(
     Error_ODBC(SQL_HANDLE_DBC, hdbc)
 
 
+//=//// PREPARED STATEMENT CACHE /////////////////////////////////////////=//
+//
+// SQLPrepareW() costs a round trip for the server to parse and plan the SQL,
+// and services tend to run the same few statements over and over.  A
+// statement object only remembers the last SQL it prepared.  So when one is
+// asked to run different SQL, its HSTMT goes into a cache on the connection
+// (keyed by the SQL text), and it takes a matching HSTMT from there if it has
+// been prepared before.  Parameters are rebound for each execution anyway.
+//
+// The least recently used HSTMTs are freed when the cache exceeds its limits,
+// and all of them are freed when the connection is closed.  The memory is
+// malloc()'d, since the cleanup may happen at SHUTDOWN* with no API.
+//
+
+static void Free_Prepared(PREPARED *p) {
+    SQLFreeHandle(SQL_HANDLE_STMT, p->hstmt);
+    free(p->sql);
+}
+
+static void Clear_Prepared_Cache(CONNECTION *conn) {
+    REBLEN i;
+    for (i = 0; i < conn->num_prepared; ++i)
+        Free_Prepared(&conn->prepared[i]);
+
+    conn->num_prepared = 0;
+    conn->prepared_sql_size = 0;
+}
+
+
+// Remove a prepared HSTMT from the cache and return it, or SQL_NULL_HANDLE
+// if the SQL isn't in the cache.
+//
+static SQLHSTMT Take_Prepared(
+    CONNECTION *conn,
+    const SQLWCHAR *sql,
+    REBLEN sql_len  // in SQLWCHARs, not counting terminator
+){
+    REBLEN i;
+    for (i = 0; i < conn->num_prepared; ++i) {
+        PREPARED *p = &conn->prepared[i];
+        if (
+            p->sql_len != sql_len
+            or memcmp(p->sql, sql, sizeof(SQLWCHAR) * sql_len) != 0
+        ){
+            continue;
+        }
+
+        SQLHSTMT hstmt = p->hstmt;
+        conn->prepared_sql_size -= sizeof(SQLWCHAR) * (p->sql_len + 1);
+        free(p->sql);
+
+        memmove(
+            p,
+            p + 1,
+            sizeof(PREPARED) * (conn->num_prepared - i - 1)
+        );
+        --conn->num_prepared;
+        return hstmt;
+    }
+
+    return SQL_NULL_HANDLE;
+}
+
+
+// Give an HSTMT with `sql` prepared on it to the cache.  It is freed if it
+// can't be cached.
+//
+static void Cache_Prepared(
+    CONNECTION *conn,
+    const REBVAL *sql,
+    SQLHSTMT hstmt
+){
+    SQLFreeStmt(hstmt, SQL_CLOSE);
+    SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+
+    REBLEN len = rebSpellIntoWide(nullptr, 0, sql);
+    Size size = sizeof(SQLWCHAR) * (len + 1);
+
+    SQLWCHAR *copy = nullptr;
+    if (size <= ODBC_PREPARED_CACHE_MAX_SQL_BYTES)
+        copy = cast(SQLWCHAR*, malloc(size));
+    if (copy == nullptr) {
+        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        return;
+    }
+    rebSpellIntoWide(copy, len, sql);
+
+    while (
+        conn->num_prepared == ODBC_PREPARED_CACHE_MAX_STATEMENTS
+        or conn->prepared_sql_size + size > ODBC_PREPARED_CACHE_MAX_SQL_BYTES
+    ){
+        PREPARED *lru = &conn->prepared[conn->num_prepared - 1];
+        conn->prepared_sql_size -= sizeof(SQLWCHAR) * (lru->sql_len + 1);
+        Free_Prepared(lru);
+        --conn->num_prepared;
+    }
+
+    memmove(
+        &conn->prepared[1],
+        &conn->prepared[0],
+        sizeof(PREPARED) * conn->num_prepared
+    );
+    conn->prepared[0].sql = copy;
+    conn->prepared[0].sql_len = len;
+    conn->prepared[0].hstmt = hstmt;
+    ++conn->num_prepared;
+    conn->prepared_sql_size += size;
+}
+
+
+// Prepare `sql` for a statement object, and return the HSTMT to execute it
+// on.  That may not be the HSTMT the statement had before (see above), so the
+// statement's `hstmt` is updated to match.
+//
+static SQLHSTMT Prepare_Statement(
+    const REBVAL *statement,
+    SQLHSTMT hstmt,
+    const REBVAL *sql  // TEXT!
+){
+    CONNECTION *conn = nullptr;
+    REBVAL *hdbc_value = rebValue(
+        "ensure [<opt> handle!]",
+            "pick ensure object! pick", statement, "'database 'hdbc"
+    );
+    if (hdbc_value) {
+        conn = VAL_HANDLE_POINTER(CONNECTION, hdbc_value);
+        rebRelease(hdbc_value);
+        if (conn->hdbc == SQL_NULL_HANDLE)
+            conn = nullptr;  // closed, so let SQLPrepareW() report that
+    }
+
+    SQLWCHAR *sql_string = rebSpellWide(sql);
+
+    if (conn) {
+        REBVAL *old_sql = rebValue(
+            "ensure [<opt> text!] pick", statement, "'string"
+        );
+        SQLHSTMT cached = Take_Prepared(
+            conn, sql_string, rebSpellIntoWide(nullptr, 0, sql)
+        );
+
+        if (old_sql or cached != SQL_NULL_HANDLE) {
+            if (old_sql) {  // keep what the HSTMT has prepared for later
+                Cache_Prepared(conn, old_sql, hstmt);
+                rebRelease(old_sql);
+            }
+            else  // HSTMT has nothing prepared, so don't need it
+                SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+            rebElide(
+                "poke", statement, "'hstmt", "null",
+                "poke", statement, "'string", "null"
+            );
+
+            if (cached != SQL_NULL_HANDLE)
+                hstmt = cached;
+            else {
+                SQLRETURN rc = SQLAllocHandle(
+                    SQL_HANDLE_STMT, conn->hdbc, &hstmt
+                );
+                if (not SQL_SUCCEEDED(rc))
+                    rebJumps ("fail", Error_ODBC_Dbc(conn->hdbc));
+            }
+
+            REBVAL *hstmt_value = rebHandle(hstmt, sizeof(hstmt), nullptr);
+            rebElide("poke", statement, "'hstmt", rebR(hstmt_value));
+        }
+
+        if (cached != SQL_NULL_HANDLE) {
+            rebFree(sql_string);
+            rebElide("poke", statement, "'string", "(copy", sql, ")");
+            return hstmt;
+        }
+    }
+
+    SQLRETURN rc = SQLPrepareW(
+        hstmt,
+        sql_string,
+        SQL_NTS  // Null-Terminated String
+    );
+    if (not SQL_SUCCEEDED(rc))
+        rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+    rebFree(sql_string);
+
+    // Remember statement string handle, but keep a copy since it may be
+    // mutated by the user.
+    //
+    // !!! Could re-use value with existing series if read only
+    //
+    rebElide("poke", statement, "'string", "(copy", sql, ")");
+
+    return hstmt;
+}
+
+
 // These are the cleanup functions for the handles that will be called if the
 // GC notices no one is using them anymore (as opposed to being explicitly
 // called by a close operation).
@@ -255,6 +473,8 @@ static void force_connection_cleanup(CONNECTION *conn) {
     if (conn->hdbc == SQL_NULL_HANDLE)
         return;  // already cleared out by CLOSE-CONNECTION or SHUTDOWN*
 
+    Clear_Prepared_Cache(conn);  // HSTMTs must be freed before disconnecting
+
     SQLDisconnect(conn->hdbc);
     SQLFreeHandle(SQL_HANDLE_DBC, conn->hdbc);
     conn->hdbc = SQL_NULL_HANDLE;
@@ -453,6 +673,8 @@ DECLARE_NATIVE(open_connection)
     if (conn == nullptr)
         rebJumps ("fail {Could not allocation CONNECTION tracking object}");
     conn->hdbc = hdbc;
+    conn->num_prepared = 0;
+    conn->prepared_sql_size = 0;
     conn->next = all_connections;
     all_connections = conn;
 
@@ -505,26 +727,10 @@ DECLARE_NATIVE(open_statement)
 }
 
 
-// The buffer at *ParameterValuePtr SQLBindParameter binds to is deferred
-// buffer, and so is the StrLen_or_IndPtr. They need to be vaild over until
-// Execute or ExecDirect are called.
+// Pick the SQL_C_XXX type a Rebol value is given to ODBC as.
 //
-// Bound parameters are a Rebol value of incoming type.  These values inform
-// the dynamic allocation of a buffer for the parameter, pre-filling it with
-// the content of the value.
-//
-SQLRETURN ODBC_BindParameter(
-    SQLHSTMT hstmt,
-    PARAMETER *p,
-    SQLUSMALLINT number,  // parameter number
-    const REBVAL *v
-){
-    assert(number != 0);
-
-    p->length = 0;  // ignored for most types
-    p->column_size = 0;  // also ignored for most types
-    TRASH_POINTER_IF_DEBUG(p->buffer);  // required to be set by switch()
-
+static SQLSMALLINT ODBC_Param_C_Type(const REBVAL *v)
+{
     // We don't expose integer mappings for Rebol data types in libRebol to
     // use in a switch() statement, so no:
     //
@@ -536,7 +742,7 @@ SQLRETURN ODBC_BindParameter(
     //
     // https://forum.rebol.info/t/689/2
     //
-    SQLSMALLINT c_type = rebUnboxInteger("switch/type", rebQ(v), "[",
+    return rebUnboxInteger("switch/type", rebQ(v), "[",
         "quasi! [",
             "if find [~true~ ~false~]", rebQ(v), "[",
                 rebI(SQL_C_BIT),
@@ -594,86 +800,135 @@ SQLRETURN ODBC_BindParameter(
 
         "fail {Non-SQL-mappable type used in parameter binding}",
     "]");
+}
 
-    SQLSMALLINT sql_type;
 
+// The fixed-size parameter types are filled the same way whether a single
+// value is bound, or a column of values is bound as an array.
+//
+static SQLSMALLINT ODBC_Fixed_Param_SQL_Type(SQLSMALLINT c_type)
+{
     switch (c_type) {
-      case SQL_C_DEFAULT: {  // BLANK!
-        sql_type = SQL_NULL_DATA;
-        p->buffer_size = 0;
-        p->buffer = nullptr;
-        break; }
+      case SQL_C_BIT:
+        return SQL_BIT;
 
-      case SQL_C_BIT: {  // LOGIC!
-        sql_type = SQL_BIT;
-        p->buffer_size = sizeof(unsigned char);
-        p->buffer = rebAllocN(char, p->buffer_size);
-        *cast(unsigned char*, p->buffer) = rebUnboxLogic(v);
-        break; }
+      case SQL_C_ULONG:
+      case SQL_C_LONG:
+      case SQL_C_UBIGINT:  // !!! See notes RE: ODBC BIGINT
+      case SQL_C_SBIGINT:
+        return SQL_INTEGER;
 
-      case SQL_C_ULONG: {  // unsigned INTEGER! in 32-bit positive range
-        sql_type = SQL_INTEGER;
-        p->buffer_size = sizeof(SQLUINTEGER);
-        p->buffer = rebAllocN(char, p->buffer_size);
-        *cast(SQLUINTEGER*, p->buffer) = rebUnboxInteger(v);
-        break; }
+      case SQL_C_DOUBLE:
+        return SQL_DOUBLE;
 
-      case SQL_C_LONG: {  // signed INTEGER! in 32-bit negative range
-        sql_type = SQL_INTEGER;
-        p->buffer_size = sizeof(SQLINTEGER);  // use signed insertion
-        p->buffer = rebAllocN(char, p->buffer_size);
-        *cast(SQLINTEGER*, p->buffer) = rebUnboxInteger(v);
-        break; }
+      case SQL_C_TYPE_TIME:
+        return SQL_TYPE_TIME;
 
-      case SQL_C_UBIGINT: {  // unsigned INTEGER! above 32-bit positive range
-        sql_type = SQL_INTEGER;
-        p->buffer_size = sizeof(SQLUBIGINT);  // !!! See notes RE: ODBC BIGINT
-        p->buffer = rebAllocN(char, p->buffer_size);
-        *cast(SQLUBIGINT*, p->buffer) = rebUnboxInteger(v);
-        break; }
+      case SQL_C_TYPE_DATE:
+        return SQL_TYPE_DATE;
 
-      case SQL_C_SBIGINT: {  // signed INTEGER! below 32-bit negative range
-        sql_type = SQL_INTEGER;
-        p->buffer_size = sizeof(SQLBIGINT);  // !!! See notes RE: ODBC BIGINT
-        p->buffer = rebAllocN(char, p->buffer_size);
-        *cast(SQLBIGINT*, p->buffer) = rebUnboxInteger(v);
-        break; }
+      case SQL_C_TYPE_TIMESTAMP:
+        return SQL_TYPE_TIMESTAMP;
 
-      case SQL_C_DOUBLE: {  // DECIMAL!
-        sql_type = SQL_DOUBLE;
-        p->buffer_size = sizeof(SQLDOUBLE);
-        p->buffer = rebAllocN(char, p->buffer_size);
-        *cast(SQLDOUBLE*, p->buffer) = rebUnboxDecimal(v);
-        break; }
+      default:
+        break;
+    }
+    rebJumps ("panic {C type is not a fixed-size parameter type}");
+}
 
-      case SQL_C_TYPE_TIME: {  // // TIME! (fractions not preserved)
-        sql_type = SQL_TYPE_TIME;
-        p->buffer_size = sizeof(TIME_STRUCT);
-        p->buffer = rebAllocN(char, p->buffer_size);
+static SQLLEN ODBC_Fixed_Param_Size(SQLSMALLINT c_type)
+{
+    switch (c_type) {
+      case SQL_C_BIT:
+        return sizeof(unsigned char);
+
+      case SQL_C_ULONG:
+        return sizeof(SQLUINTEGER);
+
+      case SQL_C_LONG:
+        return sizeof(SQLINTEGER);  // use signed insertion
+
+      case SQL_C_UBIGINT:
+        return sizeof(SQLUBIGINT);
+
+      case SQL_C_SBIGINT:
+        return sizeof(SQLBIGINT);
+
+      case SQL_C_DOUBLE:
+        return sizeof(SQLDOUBLE);
+
+      case SQL_C_TYPE_TIME:
+        return sizeof(TIME_STRUCT);
+
+      case SQL_C_TYPE_DATE:
+        return sizeof(DATE_STRUCT);
+
+      case SQL_C_TYPE_TIMESTAMP:
+        return sizeof(TIMESTAMP_STRUCT);
+
+      default:
+        break;
+    }
+    rebJumps ("panic {C type is not a fixed-size parameter type}");
+}
+
+static void ODBC_Fill_Fixed_Param(
+    void *buffer,
+    SQLSMALLINT c_type,
+    const REBVAL *v
+){
+    switch (c_type) {
+      case SQL_C_BIT:  // LOGIC!
+        *cast(unsigned char*, buffer) = rebUnboxLogic(v);
+        break;
+
+      case SQL_C_ULONG:  // unsigned INTEGER! in 32-bit positive range
+        *cast(SQLUINTEGER*, buffer) = rebUnboxInteger(v);
+        break;
+
+      case SQL_C_LONG:  // signed INTEGER! in 32-bit negative range
+        *cast(SQLINTEGER*, buffer) = rebUnboxInteger(v);
+        break;
+
+      case SQL_C_UBIGINT:  // unsigned INTEGER! above 32-bit positive range
+        *cast(SQLUBIGINT*, buffer) = rebUnboxInteger(v);
+        break;
+
+      case SQL_C_SBIGINT:  // signed INTEGER! below 32-bit negative range
+        *cast(SQLBIGINT*, buffer) = rebUnboxInteger(v);
+        break;
 
-        TIME_STRUCT *time = cast(TIME_STRUCT*, p->buffer);
+      case SQL_C_DOUBLE:  // DECIMAL!
+        *cast(SQLDOUBLE*, buffer) = rebUnboxDecimal(v);
+        break;
+
+      case SQL_C_TYPE_TIME: {  // TIME! (fractions not preserved)
+        TIME_STRUCT *time = cast(TIME_STRUCT*, buffer);
         time->hour = rebUnboxInteger("pick", v, "'hour");
         time->minute = rebUnboxInteger("pick", v, "'minute");
         time->second = rebUnboxInteger("pick", v, "'second");
         break; }
 
       case SQL_C_TYPE_DATE: {  // DATE! with no time component
-        sql_type = SQL_TYPE_DATE;
-        p->buffer_size = sizeof(DATE_STRUCT);
-        p->buffer = rebAllocN(char, p->buffer_size);
-
-        DATE_STRUCT *date = cast(DATE_STRUCT*, p->buffer);
+        DATE_STRUCT *date = cast(DATE_STRUCT*, buffer);
         date->year = rebUnboxInteger("pick", v, "'year");
         date->month = rebUnboxInteger("pick", v, "'month");
         date->day = rebUnboxInteger("pick", v, "'day");
         break; }
 
-      case SQL_C_TYPE_TIMESTAMP: {  // DATE! with a time component
-        sql_type = SQL_TYPE_TIMESTAMP;
-        p->buffer_size = sizeof(TIMESTAMP_STRUCT);
-        p->buffer = rebAllocN(char, p->buffer_size);
+      case SQL_C_TYPE_TIMESTAMP: {  // DATE! (time component may be null)
+        TIMESTAMP_STRUCT *stamp = cast(TIMESTAMP_STRUCT*, buffer);
+        stamp->year = rebUnboxInteger("pick", v, "'year");
+        stamp->month = rebUnboxInteger("pick", v, "'month");
+        stamp->day = rebUnboxInteger("pick", v, "'day");
 
         REBVAL *time = rebValue("pick", v, "'time");
+        if (not time) {  // plain DATE! merged into a TIMESTAMP column
+            stamp->hour = stamp->minute = stamp->second = 0;
+            stamp->fraction = 0;
+            break;
+        }
+
         REBVAL *second_and_fraction = rebValue("pick", time, "'second");
 
         // !!! Although we write a `fraction` out, this appears to often
@@ -681,10 +936,6 @@ SQLRETURN ODBC_BindParameter(
         //
         // https://github.com/metaeducation/rebol-odbc/issues/1
         //
-        TIMESTAMP_STRUCT *stamp = cast(TIMESTAMP_STRUCT*, p->buffer);
-        stamp->year = rebUnboxInteger("pick", v, "'year");
-        stamp->month = rebUnboxInteger("pick", v, "'month");
-        stamp->day = rebUnboxInteger("pick", v, "'day");
         stamp->hour = rebUnboxInteger("pick", time, "'hour");
         stamp->minute = rebUnboxInteger("pick", time, "'minute");
         stamp->second = rebUnboxInteger(
@@ -700,6 +951,58 @@ SQLRETURN ODBC_BindParameter(
         rebRelease(time);
         break; }
 
+      default:
+        rebJumps ("panic {C type is not a fixed-size parameter type}");
+    }
+}
+
+
+// The buffer at *ParameterValuePtr SQLBindParameter binds to is deferred
+// buffer, and so is the StrLen_or_IndPtr. They need to be vaild over until
+// Execute or ExecDirect are called.
+//
+// Bound parameters are a Rebol value of incoming type.  These values inform
+// the dynamic allocation of a buffer for the parameter, pre-filling it with
+// the content of the value.
+//
+SQLRETURN ODBC_BindParameter(
+    SQLHSTMT hstmt,
+    PARAMETER *p,
+    SQLUSMALLINT number,  // parameter number
+    const REBVAL *v
+){
+    assert(number != 0);
+
+    p->length = 0;  // ignored for most types
+    p->column_size = 0;  // also ignored for most types
+    TRASH_POINTER_IF_DEBUG(p->buffer);  // required to be set by switch()
+
+    SQLSMALLINT c_type = ODBC_Param_C_Type(v);
+
+    SQLSMALLINT sql_type;
+
+    switch (c_type) {
+      case SQL_C_DEFAULT: {  // BLANK!
+        sql_type = SQL_NULL_DATA;
+        p->buffer_size = 0;
+        p->buffer = nullptr;
+        break; }
+
+      case SQL_C_BIT:  // LOGIC!
+      case SQL_C_ULONG:  // unsigned INTEGER! in 32-bit positive range
+      case SQL_C_LONG:  // signed INTEGER! in 32-bit negative range
+      case SQL_C_UBIGINT:  // unsigned INTEGER! above 32-bit positive range
+      case SQL_C_SBIGINT:  // signed INTEGER! below 32-bit negative range
+      case SQL_C_DOUBLE:  // DECIMAL!
+      case SQL_C_TYPE_TIME:  // TIME! (fractions not preserved)
+      case SQL_C_TYPE_DATE:  // DATE! with no time component
+      case SQL_C_TYPE_TIMESTAMP:  // DATE! with a time component
+        sql_type = ODBC_Fixed_Param_SQL_Type(c_type);
+        p->buffer_size = ODBC_Fixed_Param_Size(c_type);
+        p->buffer = rebAllocN(char, p->buffer_size);
+        ODBC_Fill_Fixed_Param(p->buffer, c_type, v);
+        break;
+
         // There's no guarantee that a database will interpret its CHARs
         // as UTF-8, so it might think it's something like a Latin1 string of
         // a longer length.  Hence using database features like "give me all
@@ -1161,6 +1464,253 @@ void ODBC_DescribeResults(
 }
 
 
+//=//// PARAMETER ARRAYS /////////////////////////////////////////////////=//
+//
+// Running an INSERT with SQLExecute() once per row means a round trip to the
+// server per row, which dominates bulk loads.  INSERT-ROWS-ODBC instead binds
+// each parameter to an array of values ("column-wise binding") and sets the
+// SQL_ATTR_PARAMSET_SIZE, so one SQLExecute() sends a whole batch of rows.
+// The driver writes a status per row into the SQL_ATTR_PARAM_STATUS_PTR.
+//
+// All the values in a parameter's array must share a C type.  Each column's
+// type is picked from the values in the batch: BLANK!s go along with any
+// type, mixed INTEGER! ranges widen to a BIGINT, and a DATE! with no time can
+// go in a TIMESTAMP.  TEXT! and BINARY! elements are as big as the biggest
+// value in the batch, so batches are also limited by the total buffer size.
+//
+// The statement attributes point at memory which only lives during one call,
+// so they are removed afterward.  A fail() could leave them set, so
+// INSERT-ODBC removes them before binding its single row.
+//
+
+#define ODBC_PARAMSET_MAX_ROWS 1024
+#define ODBC_PARAMSET_MAX_BYTES (4 * 1024 * 1024)  // for all parameter arrays
+
+
+static void Reset_Param_Arrays(SQLHSTMT hstmt)
+{
+    SQLSetStmtAttr(
+        hstmt, SQL_ATTR_PARAMSET_SIZE, cast(SQLPOINTER, cast(uintptr_t, 1)), 0
+    );
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, nullptr, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, nullptr, 0);
+}
+
+
+static bool Is_Integer_C_Type(SQLSMALLINT c_type)
+{
+    return c_type == SQL_C_LONG or c_type == SQL_C_ULONG
+        or c_type == SQL_C_SBIGINT or c_type == SQL_C_UBIGINT;
+}
+
+
+// Widen the C type of a parameter column so it can also hold a new value.
+//
+static SQLSMALLINT Merge_Param_C_Types(SQLSMALLINT column, SQLSMALLINT value)
+{
+    if (value == SQL_C_DEFAULT or value == column)  // BLANK! fits anything
+        return column;
+
+    if (column == SQL_C_DEFAULT)
+        return value;
+
+    if (Is_Integer_C_Type(column) and Is_Integer_C_Type(value))
+        return SQL_C_SBIGINT;  // !!! See notes RE: ODBC BIGINT
+
+    if (
+        (column == SQL_C_TYPE_DATE and value == SQL_C_TYPE_TIMESTAMP)
+        or (column == SQL_C_TYPE_TIMESTAMP and value == SQL_C_TYPE_DATE)
+    ){
+        return SQL_C_TYPE_TIMESTAMP;
+    }
+
+    rebJumps ("fail {Parameter values in a column must be of the same type}");
+}
+
+
+// Size of the variable-length part of a value, or 0 for fixed-size types.
+//
+static SQLLEN Variable_Param_Size(SQLSMALLINT c_type, const REBVAL *v)
+{
+    if (c_type == SQL_C_WCHAR)  // no terminator, see ODBC_BindParameter()
+        return sizeof(SQLWCHAR) * rebSpellIntoWide(nullptr, 0, v);
+
+    if (c_type == SQL_C_BINARY)
+        return cast(SQLLEN, rebBytesInto(nullptr, 0, v));
+
+    return 0;
+}
+
+
+static SQLLEN Param_Element_Size(PARAMARRAY *a)
+{
+    switch (a->c_type) {
+      case SQL_C_DEFAULT:  // all BLANK!, bound as a 1-byte VARCHAR
+        return 1;
+
+      case SQL_C_WCHAR:  // room for rebSpellIntoWide()'s terminator
+        return a->max_size + sizeof(SQLWCHAR);
+
+      case SQL_C_BINARY:
+        return a->max_size == 0 ? 1 : a->max_size;
+
+      default:
+        return ODBC_Fixed_Param_Size(a->c_type);
+    }
+}
+
+
+// Choose the C type and element size for each parameter over as many rows
+// (starting at `start`) as fit in the limits.  Returns how many rows.
+//
+static REBLEN Measure_Param_Batch(
+    PARAMARRAY *arrays,
+    REBLEN num_params,
+    const REBVAL *rows,
+    REBLEN start,
+    REBLEN num_rows
+){
+    REBLEN n;
+    for (n = 0; n < num_params; ++n) {
+        arrays[n].c_type = SQL_C_DEFAULT;
+        arrays[n].max_size = 0;
+    }
+
+    REBLEN count = 0;
+    while (start + count < num_rows and count < ODBC_PARAMSET_MAX_ROWS) {
+        REBVAL *row = rebValue(
+            "ensure block! pick", rows, rebI(start + count + 1)
+        );
+        rebElide(
+            "if", rebI(num_params), "!= length of", row, "[",
+                "fail [{Row has wrong number of parameters:} mold", row, "]",
+            "]"
+        );
+
+        SQLLEN row_size = 0;
+        for (n = 0; n < num_params; ++n) {
+            PARAMARRAY *a = &arrays[n];
+
+            REBVAL *v = rebValue("pick", row, rebI(n + 1));
+            SQLSMALLINT c_type = ODBC_Param_C_Type(v);
+            a->c_type = Merge_Param_C_Types(a->c_type, c_type);
+            SQLLEN size = Variable_Param_Size(c_type, v);
+            if (size > a->max_size)
+                a->max_size = size;
+            rebRelease(v);
+
+            row_size += Param_Element_Size(a) + sizeof(SQLLEN);
+        }
+        rebRelease(row);
+
+        ++count;
+        REBLEN batch_size = cast(REBLEN, row_size) * count;
+        if (count > 1 and batch_size > ODBC_PARAMSET_MAX_BYTES) {
+            --count;  // measurements may include this row, but that's safe
+            break;
+        }
+    }
+
+    return count;
+}
+
+
+// Allocate the arrays for a measured batch, fill them, and bind them.
+//
+static void Bind_Param_Batch(
+    SQLHSTMT hstmt,
+    PARAMARRAY *arrays,
+    REBLEN num_params,
+    const REBVAL *rows,
+    REBLEN start,
+    REBLEN count
+){
+    REBLEN n;
+    for (n = 0; n < num_params; ++n) {
+        PARAMARRAY *a = &arrays[n];
+        SQLLEN element_size = Param_Element_Size(a);
+
+        a->buffer = rebAllocN(char, element_size * count);
+        a->lengths = rebAllocN(SQLLEN, count);
+
+        REBLEN i;
+        for (i = 0; i < count; ++i) {
+            REBVAL *v = rebValue(
+                "pick pick", rows, rebI(start + i + 1), rebI(n + 1)
+            );
+            char *element = a->buffer + element_size * i;
+
+            if (rebUnboxLogic("blank? @", v))
+                a->lengths[i] = SQL_NULL_DATA;
+            else if (a->c_type == SQL_C_WCHAR) {
+                unsigned int num_wchars = rebSpellIntoWide(
+                    cast(SQLWCHAR*, element),
+                    cast(unsigned int, element_size / sizeof(SQLWCHAR)) - 1,
+                    v
+                );
+                a->lengths[i] = sizeof(SQLWCHAR) * num_wchars;
+            }
+            else if (a->c_type == SQL_C_BINARY)
+                a->lengths[i] = cast(SQLLEN, rebBytesInto(
+                    cast(unsigned char*, element), element_size, v
+                ));
+            else {
+                ODBC_Fill_Fixed_Param(element, a->c_type, v);
+                a->lengths[i] = 0;  // ignored for fixed-size types
+            }
+
+            rebRelease(v);
+        }
+
+        SQLSMALLINT c_type;
+        SQLSMALLINT sql_type;
+        SQLULEN column_size;
+        switch (a->c_type) {
+          case SQL_C_DEFAULT:
+            c_type = SQL_C_CHAR;
+            sql_type = SQL_VARCHAR;
+            column_size = 1;
+            break;
+
+          case SQL_C_WCHAR:
+            c_type = SQL_C_WCHAR;
+            sql_type = SQL_WVARCHAR;
+            column_size = a->max_size / sizeof(SQLWCHAR);
+            if (column_size == 0)
+                column_size = 1;
+            break;
+
+          case SQL_C_BINARY:
+            c_type = SQL_C_BINARY;
+            sql_type = SQL_VARBINARY;
+            column_size = element_size;
+            break;
+
+          default:
+            c_type = a->c_type;
+            sql_type = ODBC_Fixed_Param_SQL_Type(a->c_type);
+            column_size = 0;  // ignored for fixed-size types
+            break;
+        }
+
+        SQLRETURN rc = SQLBindParameter(
+            hstmt,  // StatementHandle
+            n + 1,  // ParameterNumber
+            SQL_PARAM_INPUT,  // InputOutputType
+            c_type,  // ValueType
+            sql_type,  // ParameterType
+            column_size,  // ColumnSize
+            0,  // DecimalDigits
+            a->buffer,  // ParameterValuePtr
+            element_size,  // BufferLength (of one element)
+            a->lengths  // StrLen_Or_IndPtr
+        );
+        if (not SQL_SUCCEEDED(rc))
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+    }
+}
+
+
 //
 //  export insert-odbc: native [
 //
@@ -1188,6 +1738,7 @@ DECLARE_NATIVE(insert_odbc)
 
     rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
     rc = SQLCloseCursor(hstmt);  // !!! check rc?
+    Reset_Param_Arrays(hstmt);  // in case INSERT-ROWS-ODBC failed
 
     //=//// MAKE SQL REQUEST FROM DIALECTED SQL BLOCK /////////////////////=//
     //
@@ -1209,6 +1760,10 @@ DECLARE_NATIVE(insert_odbc)
 
     if (get_catalog) {
         rc = ODBC_GetCatalog(hstmt, ARG(sql));
+
+        // The catalog query replaces whatever SQL was prepared on the HSTMT
+        //
+        rebElide("poke", statement, "'string", "null");
     }
     else {
         // Prepare/Execute statement, when first element in the block is a
@@ -1225,26 +1780,9 @@ DECLARE_NATIVE(insert_odbc)
         REBLEN sql_index = 1;
 
         if (not use_cache) {
-            SQLWCHAR *sql_string = rebSpellWide("first", ARG(sql));
-
-            rc = SQLPrepareW(
-                hstmt,
-                sql_string,
-                SQL_NTS  // Null-Terminated String
-            );
-            if (not SQL_SUCCEEDED(rc))
-                rebJumps ("fail", Error_ODBC_Stmt(hstmt));
-
-            rebFree(sql_string);
-
-            // Remember statement string handle, but keep a copy since it
-            // may be mutated by the user.
-            //
-            // !!! Could re-use value with existing series if read only
-            //
-            rebElide(
-                "poke", statement, "'string", "(copy first", ARG(sql), ")"
-            );
+            REBVAL *sql_string = rebValue("first", ARG(sql));
+            hstmt = Prepare_Statement(statement, hstmt, sql_string);
+            rebRelease(sql_string);
         }
 
         // The SQL string may contain ? characters, which indicates that it is
@@ -1406,6 +1944,166 @@ DECLARE_NATIVE(insert_odbc)
 }
 
 
+//
+//  export insert-rows-odbc: native [
+//
+//  {Execute a parameterized SQL statement for each row, in batches}
+//
+//      return: "Status of each row: OK, INFO, ERROR, UNUSED, or UNKNOWN"
+//          [block!]
+//      statement [object!]
+//      sql "SQL string with a ? for each parameter"
+//          [text!]
+//      rows "BLOCK! of rows, each a BLOCK! with a value for each ?"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(insert_rows_odbc)
+//
+// 'INFO rows succeeded with a warning.  'UNUSED rows weren't run, because the
+// driver stopped at an error earlier in their batch.  'UNKNOWN means that the
+// driver couldn't say.
+{
+    ODBC_INCLUDE_PARAMS_OF_INSERT_ROWS_ODBC;
+
+    REBVAL *statement = ARG(statement);
+    REBVAL *hstmt_value = rebValue(
+        "ensure handle! pick", statement, "'hstmt"
+    );
+    SQLHSTMT hstmt = VAL_HANDLE_POINTER(SQLHSTMT, hstmt_value);
+    rebRelease(hstmt_value);
+
+    SQLRETURN rc;
+
+    rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+    rc = SQLCloseCursor(hstmt);  // !!! check rc?
+
+    // Prepare the statement unless it's the one INSERT-ODBC (or a previous
+    // INSERT-ROWS-ODBC) already prepared.  See PREPARED STATEMENT CACHE.
+    //
+    bool use_cache = rebUnboxLogic(
+        "strict-equal?", ARG(sql),
+            "ensure [<opt> text!] pick", statement, "'string"
+    );
+
+    if (not use_cache)
+        hstmt = Prepare_Statement(statement, hstmt, ARG(sql));
+
+    REBLEN num_rows = rebUnbox("length of", ARG(rows));
+
+    REBVAL *statuses = rebValue("make block!", rebI(num_rows));
+    if (num_rows == 0)
+        return statuses;
+
+    REBLEN num_params = rebUnbox(
+        "length of ensure block! first", ARG(rows)
+    );
+
+    PARAMARRAY *arrays = nullptr;
+    if (num_params != 0)
+        arrays = rebAllocN(PARAMARRAY, num_params);
+
+    SQLUSMALLINT *row_statuses = rebAllocN(
+        SQLUSMALLINT, MIN(num_rows, ODBC_PARAMSET_MAX_ROWS)
+    );
+    SQLULEN num_processed;
+
+    rc = SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_PARAM_BIND_TYPE,
+        cast(SQLPOINTER, cast(uintptr_t, SQL_PARAM_BIND_BY_COLUMN)),
+        0
+    );
+    if (not SQL_SUCCEEDED(rc))
+        rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, row_statuses, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &num_processed, 0);
+
+    REBLEN start = 0;
+    while (start < num_rows) {
+        REBLEN count = Measure_Param_Batch(
+            arrays, num_params, ARG(rows), start, num_rows
+        );
+        Bind_Param_Batch(hstmt, arrays, num_params, ARG(rows), start, count);
+
+        rc = SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_PARAMSET_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, count)),
+            0
+        );
+        if (rc != SQL_SUCCESS)  // WITH_INFO would mean driver changed it
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+        num_processed = 0;
+        rc = SQLExecute(hstmt);
+
+        REBLEN n;
+        for (n = 0; n < num_params; ++n) {
+            rebFree(arrays[n].buffer);
+            rebFree(arrays[n].lengths);
+        }
+
+        switch (rc) {
+          case SQL_SUCCESS:
+          case SQL_SUCCESS_WITH_INFO:
+          case SQL_NO_DATA:  // UPDATE or DELETE affecting no rows
+            break;
+
+          case SQL_ERROR:  // some drivers report an error row this way
+            if (num_processed != 0)
+                break;
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+          default:
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+        }
+
+        REBLEN i;
+        for (i = 0; i < count; ++i) {
+            const char *status;
+            if (i >= num_processed)
+                status = "unused";
+            else switch (row_statuses[i]) {
+              case SQL_PARAM_SUCCESS:
+                status = "ok";
+                break;
+
+              case SQL_PARAM_SUCCESS_WITH_INFO:
+                status = "info";
+                break;
+
+              case SQL_PARAM_ERROR:
+                status = "error";
+                break;
+
+              case SQL_PARAM_UNUSED:
+                status = "unused";
+                break;
+
+              default:  // SQL_PARAM_DIAG_UNAVAILABLE
+                status = "unknown";
+                break;
+            }
+            rebElide("append", statuses, "as word!", rebT(status));
+        }
+
+        rc = SQLFreeStmt(hstmt, SQL_CLOSE);  // !!! check rc?
+        start += count;
+    }
+
+    rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+    Reset_Param_Arrays(hstmt);
+
+    if (arrays)
+        rebFree(arrays);
+    rebFree(row_statuses);
+
+    return statuses;
+}
+
+
 //
 // A query will fill a column's buffer with data.  This data can be
 // reinterpreted as a Rebol value.  Successive queries for records reuse the
@@ -1572,6 +2270,226 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
 }
 
 
+//=//// ROW ARRAY FETCHING ///////////////////////////////////////////////=//
+//
+// Fetching one row per SQLFetch() and then asking for each value with its
+// own SQLGetData() means several driver round trips per row, which dominates
+// exports of millions of rows.  So when it's possible, COPY-ODBC binds buffers
+// for each column with SQLBindCol() that hold many rows ("column-wise
+// binding"), and gets all of those rows with a single SQLFetch().
+//
+// The catch is that bound buffers are of fixed size.  The unbounded LONG
+// column types would truncate, so statements with them use the SQLGetData()
+// approach (which can grow its buffers).
+//
+// The bindings point at memory which only lives during one COPY-ODBC, so
+// they are removed afterward.  Because a fail() could happen while turning
+// a row into values, the SQLGetData() path also removes them before it runs.
+//
+
+#define ODBC_ROW_ARRAY_MAX_ROWS 1024
+#define ODBC_ROW_ARRAY_MAX_BYTES (4 * 1024 * 1024)  // for all column buffers
+
+
+static bool Can_Fetch_Row_Array(COLUMN *columns, SQLSMALLINT num_columns)
+{
+    SQLSMALLINT i;
+    for (i = 0; i < num_columns; ++i) {
+        switch (columns[i].sql_type) {
+          case SQL_LONGVARCHAR:
+          case SQL_WLONGVARCHAR:
+          case SQL_LONGVARBINARY:
+            return false;
+
+          default:
+            break;
+        }
+    }
+    return true;
+}
+
+
+static void Reset_Row_Binding(SQLHSTMT hstmt)
+{
+    SQLFreeStmt(hstmt, SQL_UNBIND);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, cast(SQLPOINTER, cast(uintptr_t, 1)), 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+}
+
+
+// Bound data that doesn't fit is truncated, reported only by its length.
+//
+static bool Is_Bound_Data_Truncated(COLUMN *col, SQLLEN length)
+{
+    if (length == SQL_NULL_DATA)
+        return false;
+    if (length == SQL_NO_TOTAL)
+        return true;
+
+    SQLULEN terminator;
+    if (col->c_type == SQL_C_CHAR)
+        terminator = 1;
+    else if (col->c_type == SQL_C_WCHAR)
+        terminator = sizeof(WCHAR);
+    else
+        terminator = 0;
+
+    return cast(SQLULEN, length) + terminator > col->buffer_size;
+}
+
+
+static void Copy_Odbc_Row_Arrays(
+    REBVAL *results,
+    SQLHSTMT hstmt,
+    COLUMN *columns,
+    SQLSMALLINT num_columns,
+    SQLLEN num_rows  // -1 for as many as available
+){
+    SQLULEN row_size = 0;
+    SQLSMALLINT i;
+    for (i = 0; i < num_columns; ++i)
+        row_size += columns[i].buffer_size + sizeof(SQLLEN);
+
+    SQLULEN array_size = ODBC_ROW_ARRAY_MAX_BYTES / row_size;
+    if (array_size > ODBC_ROW_ARRAY_MAX_ROWS)
+        array_size = ODBC_ROW_ARRAY_MAX_ROWS;
+    if (array_size == 0)
+        array_size = 1;
+
+    // Rows fetched beyond what /PART asked for would be lost to the next
+    // COPY-ODBC, so never fetch more than that.
+    //
+    if (num_rows != -1 and cast(SQLULEN, num_rows) < array_size)
+        array_size = num_rows;
+
+    char **buffers = rebAllocN(char*, num_columns);
+    SQLLEN **lengths = rebAllocN(SQLLEN*, num_columns);
+    for (i = 0; i < num_columns; ++i) {
+        buffers[i] = rebAllocN(char, columns[i].buffer_size * array_size);
+        lengths[i] = rebAllocN(SQLLEN, array_size);
+    }
+    SQLUSMALLINT *statuses = rebAllocN(SQLUSMALLINT, array_size);
+    SQLULEN rows_fetched = 0;
+
+    REBVAL *error = nullptr;
+    SQLRETURN rc;
+
+    Reset_Row_Binding(hstmt);  // e.g. a fail() left bindings for more columns
+
+    rc = SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_ROW_BIND_TYPE,
+        cast(SQLPOINTER, cast(uintptr_t, SQL_BIND_BY_COLUMN)),
+        0
+    );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_ROW_ARRAY_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, array_size)),
+            0
+        );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, statuses, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &rows_fetched, 0);
+
+    for (i = 0; SQL_SUCCEEDED(rc) and i < num_columns; ++i)
+        rc = SQLBindCol(
+            hstmt,
+            i + 1,  // column numbers are 1-based
+            columns[i].c_type,
+            buffers[i],
+            columns[i].buffer_size,  // size of one element of the array
+            lengths[i]
+        );
+
+    if (not SQL_SUCCEEDED(rc)) {
+        error = Error_ODBC_Stmt(hstmt);
+        goto cleanup;
+    }
+
+  blockscope {
+    SQLLEN row = 0;
+    while (row != num_rows) {
+        rc = SQLFetch(hstmt);  // fetches up to array_size rows
+        if (rc == SQL_NO_DATA)
+            break;
+        if (not SQL_SUCCEEDED(rc)) {  // SUCCESS_WITH_INFO is ignored
+            error = Error_ODBC_Stmt(hstmt);
+            goto cleanup;
+        }
+
+        SQLULEN n;
+        for (n = 0; n < rows_fetched; ++n) {
+            if (statuses[n] == SQL_ROW_ERROR) {
+                error = rebValue("make error! {Error fetching ODBC row}");
+                goto cleanup;
+            }
+
+            REBVAL *record = rebValue("make block!", rebI(num_columns));
+
+            for (i = 0; i < num_columns; ++i) {
+                COLUMN view = columns[i];  // same type info, this row's data
+                view.buffer = buffers[i] + (n * view.buffer_size);
+                view.length = lengths[i][n];
+
+                if (Is_Bound_Data_Truncated(&view, view.length)) {
+                    rebRelease(record);
+                    error = rebValue(
+                        "make error! [",
+                            "{ODBC column data truncated:}", view.title,
+                        "]"
+                    );
+                    goto cleanup;
+                }
+
+                REBVAL *temp = ODBC_Column_To_Rebol_Value(&view);
+                rebElide("append", record, rebQ(temp));  // Q: blank => NULL
+                rebRelease(temp);
+            }
+
+            rebElide("append", results, rebR(record));
+        }
+
+        row += rows_fetched;
+
+        if (num_rows != -1 and cast(SQLULEN, num_rows - row) < array_size) {
+            array_size = num_rows - row;
+            if (array_size == 0)
+                break;
+            rc = SQLSetStmtAttr(
+                hstmt,
+                SQL_ATTR_ROW_ARRAY_SIZE,
+                cast(SQLPOINTER, cast(uintptr_t, array_size)),
+                0
+            );
+            if (not SQL_SUCCEEDED(rc)) {
+                error = Error_ODBC_Stmt(hstmt);
+                goto cleanup;
+            }
+        }
+    }
+  }
+
+  cleanup:
+
+    Reset_Row_Binding(hstmt);
+
+    for (i = 0; i < num_columns; ++i) {
+        rebFree(buffers[i]);
+        rebFree(lengths[i]);
+    }
+    rebFree(buffers);
+    rebFree(lengths);
+    rebFree(statuses);
+
+    if (error)
+        rebJumps ("fail", rebR(error));
+}
+
+
 //
 //  export copy-odbc: native [
 //
@@ -1617,6 +2535,16 @@ DECLARE_NATIVE(copy_odbc)
         "make block!", rebI(num_rows == -1 ? 10 : num_rows)
     );
 
+    if (num_rows == 0)
+        return results;
+
+    if (Can_Fetch_Row_Array(columns, num_columns)) {
+        Copy_Odbc_Row_Arrays(results, hstmt, columns, num_columns, num_rows);
+        return results;
+    }
+
+    Reset_Row_Binding(hstmt);  // a fail() may have left stale row bindings
+
     SQLLEN row = 0;
     while (row != num_rows) {
 
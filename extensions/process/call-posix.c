@@ -24,6 +24,23 @@
 
 #include "reb-config.h"
 
+// fork() has to duplicate the page tables of the whole interpreter, which
+// gets slow with a large heap (and can fail outright if overcommit is off).
+// posix_spawn() doesn't: glibc implements it with CLONE_VM|CLONE_VFORK, and
+// the BSDs and OS X have it as a system call.  Since everything CALL does in
+// the child before exec()'ing can be expressed as posix_spawn() file actions,
+// it is used where available, with the fork() code kept as a fallback.
+//
+// (Android's bionic only has posix_spawn() from API level 28.)
+//
+#if !defined(CALL_USES_POSIX_SPAWN)
+    #if TO_ANDROID
+        #define CALL_USES_POSIX_SPAWN 0
+    #else
+        #define CALL_USES_POSIX_SPAWN 1
+    #endif
+#endif
+
 #if !defined(__cplusplus) && TO_LINUX
     //
     // See feature_test_macros(7), this definition is redundant under C++
@@ -50,6 +67,9 @@
 #include <signal.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+#if CALL_USES_POSIX_SPAWN
+    #include <spawn.h>
+#endif
 #if !defined(WIFCONTINUED) && TO_ANDROID
 // old version of bionic doesn't define WIFCONTINUED
 // https://android.googlesource.com/platform/bionic/+/c6043f6b27dc8961890fed12ddb5d99622204d6d%5E%21/#F0
@@ -109,6 +129,83 @@ inline static bool Set_Nonblocking_Fails(int fd) {
 }
 
 
+#if CALL_USES_POSIX_SPAWN
+
+// Arrange for the child's `fd` to be what one of /INPUT, /OUTPUT, or /ERROR
+// asked for.  (Same choices as the fork() branch makes in Call_Core().)
+//
+static int Add_Redirect_Action(
+    posix_spawn_file_actions_t *actions,
+    const REBVAL *arg,  // nulled if the refinement wasn't used
+    int fd,
+    int pipe_end,  // the child's end of the pipe, if TEXT! or BINARY!
+    int open_flags
+){
+    if (Is_Nulled(arg))
+        return 0;  // inherit from parent
+
+    if (IS_TEXT(arg) or IS_BINARY(arg) or IS_ACTION(arg))  // FD_CLOEXEC pipe
+        return posix_spawn_file_actions_adddup2(actions, pipe_end, fd);
+
+    if (IS_LOGIC(arg)) {
+        if (VAL_LOGIC(arg))
+            return 0;  // inherit from parent
+        return posix_spawn_file_actions_addopen(
+            actions, fd, "/dev/null", open_flags, 0
+        );
+    }
+
+    assert(IS_FILE(arg));
+
+    char *local_utf8 = rebSpell("file-to-local", arg);
+    int err = posix_spawn_file_actions_addopen(  // copies the path
+        actions, fd, local_utf8, open_flags, 0666
+    );
+    rebFree(local_utf8);
+    return err;
+}
+
+
+// Returns 0 on success, otherwise an errno.  Unlike the fork() branch, a
+// failure to exec() is reported here directly (glibc and the BSDs wait for
+// the exec() before returning), so nothing is written to the info pipe.
+//
+static int Spawn_Child_Process(
+    pid_t *pid_out,
+    char **argv,
+    const REBVAL *input,
+    const REBVAL *output,
+    const REBVAL *error,
+    int stdin_read,
+    int stdout_write,
+    int stderr_write
+){
+    posix_spawn_file_actions_t actions;
+    int err = posix_spawn_file_actions_init(&actions);
+    if (err != 0)
+        return err;
+
+    err = Add_Redirect_Action(
+        &actions, input, STDIN_FILENO, stdin_read, O_RDONLY
+    );
+    if (err == 0)
+        err = Add_Redirect_Action(
+            &actions, output, STDOUT_FILENO, stdout_write, O_CREAT | O_WRONLY
+        );
+    if (err == 0)
+        err = Add_Redirect_Action(
+            &actions, error, STDERR_FILENO, stderr_write, O_CREAT | O_WRONLY
+        );
+    if (err == 0)
+        err = posix_spawnp(pid_out, argv[0], &actions, nullptr, argv, environ);
+
+    posix_spawn_file_actions_destroy(&actions);
+    return err;
+}
+
+#endif
+
+
 //
 //  Call_Core: C
 //
@@ -177,7 +274,9 @@ Bounce Call_Core(Frame(*) frame_) {
     bool flag_wait = REF(wait) or (
         IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))
         or IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))
+        or IS_ACTION(ARG(output))
         or IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
+        or IS_ACTION(ARG(error))
     );  // I/O redirection implies /WAIT
 
     // We synthesize the argc and argv from the "command", and in the process
@@ -313,6 +412,8 @@ Bounce Call_Core(Frame(*) frame_) {
     char *errbuf = nullptr;
     size_t errbuf_used = 0;
 
+    REBVAL *callback_error = nullptr;  // from an ACTION! /OUTPUT or /ERROR
+
     int status = 0;
     int ret = 0;
     int non_errno_ret = 0; // "ret" above should be valid errno
@@ -340,12 +441,18 @@ Bounce Call_Core(Frame(*) frame_) {
             goto stdin_pipe_err;
     }
 
-    if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+    if (
+        IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))
+        or IS_ACTION(ARG(output))
+    ){
         if (Open_Pipe_Fails(stdout_pipe))
             goto stdout_pipe_err;
     }
 
-    if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+    if (
+        IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
+        or IS_ACTION(ARG(error))
+    ){
         if (Open_Pipe_Fails(stderr_pipe))
             goto stdout_pipe_err;
     }
@@ -353,17 +460,35 @@ Bounce Call_Core(Frame(*) frame_) {
     if (Open_Pipe_Fails(info_pipe))
         goto info_pipe_err;
 
+  #if CALL_USES_POSIX_SPAWN
+    ret = Spawn_Child_Process(
+        &forked_pid,
+        argv,
+        ARG(input),
+        ARG(output),
+        ARG(error),
+        stdin_pipe[R],
+        stdout_pipe[W],
+        stderr_pipe[W]
+    );
+    if (ret != 0)
+        goto error;
+  #else
     forked_pid = fork();  // can't declare here (gotos cross initialization)
 
     if (forked_pid < 0) {  // error
         ret = errno;
         goto error;
     }
+  #endif
 
     if (forked_pid == 0) {
 
     //=//// CHILD BRANCH OF FORK() ////////////////////////////////////////=//
 
+        // (Never reached if CALL_USES_POSIX_SPAWN, which does the equivalent
+        // of this with posix_spawn_file_actions_t in Spawn_Child_Process().)
+
         // In GDB if you want to debug the child you need to use:
         // `set follow-fork-mode child`:
         //
@@ -410,7 +535,10 @@ Bounce Call_Core(Frame(*) frame_) {
           inherit_stdout_from_parent:
             NOOP;  // it's the default
         }
-        else if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+        else if (
+            IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))
+            or IS_ACTION(ARG(output))
+        ){
             close(stdout_pipe[R]);
             if (dup2(stdout_pipe[W], STDOUT_FILENO) < 0)
                 goto child_error;
@@ -445,7 +573,10 @@ Bounce Call_Core(Frame(*) frame_) {
           inherit_stderr_from_parent:
             NOOP;  // it's the default
         }
-        else if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+        else if (
+            IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
+            or IS_ACTION(ARG(error))
+        ){
             close(stderr_pipe[R]);
             if (dup2(stderr_pipe[W], STDERR_FILENO) < 0)
                 goto child_error;
@@ -784,6 +915,18 @@ Bounce Call_Core(Frame(*) frame_) {
                         }
                         assert(*used < *capacity);
                     } while (nbytes == to_read);
+
+                    if (buffer == &outbuf and IS_ACTION(ARG(output)))
+                        callback_error = Send_Call_Output_Chunk(
+                            ARG(output), outbuf, &outbuf_used
+                        );
+                    else if (buffer == &errbuf and IS_ACTION(ARG(error)))
+                        callback_error = Send_Call_Output_Chunk(
+                            ARG(error), errbuf, &errbuf_used
+                        );
+
+                    if (callback_error)
+                        goto kill;
                 }
 
                 // A pipe can hangup and also have input (e.g. OS X sets both
@@ -815,7 +958,7 @@ Bounce Call_Core(Frame(*) frame_) {
 
   error:
 
-    if (ret == 0)
+    if (ret == 0 and not callback_error)
         non_errno_ret = -1024;  // !!! randomly picked
 
   cleanup:
@@ -922,6 +1065,13 @@ Bounce Call_Core(Frame(*) frame_) {
         rebElide("insert", ARG(output), output_val);
         rebRelease(output_val);
     }
+    else if (IS_ACTION(ARG(output))) {  // send anything read at child's exit
+        if (not callback_error)
+            callback_error = Send_Call_Output_Chunk(
+                ARG(output), outbuf, &outbuf_used
+            );
+        rebFree(outbuf);
+    }
     else
         assert(outbuf == nullptr);
 
@@ -935,12 +1085,22 @@ Bounce Call_Core(Frame(*) frame_) {
         rebElide("insert", ARG(error), error_val);
         rebRelease(error_val);
     }
+    else if (IS_ACTION(ARG(error))) {
+        if (not callback_error)
+            callback_error = Send_Call_Output_Chunk(
+                ARG(error), errbuf, &errbuf_used
+            );
+        rebFree(errbuf);
+    }
     else
         assert(errbuf == nullptr);
 
     if (inbuf != nullptr)
         rebFree(inbuf);
 
+    if (callback_error)
+        rebJumps("fail", rebR(callback_error));
+
     if (ret != 0)
         rebFail_OS (ret);
 
@@ -128,6 +128,7 @@ static bool Try_Init_Startupinfo_Sink(
     else switch (VAL_TYPE(arg)) {
       case REB_TEXT:  // write to pre-existing TEXT!
       case REB_BINARY:  // write to pre-existing BINARY!
+      case REB_ACTION:  // pass chunks to callback
         if (not CreatePipe(hread, hwrite, NULL, 0))
             return false;
 
@@ -211,7 +212,9 @@ Bounce Call_Core(Frame(*) frame_) {
         or (
             IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))
             or IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))
+            or IS_ACTION(ARG(output))
             or IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
+            or IS_ACTION(ARG(error))
         )  // I/O redirection implies /WAIT
     ){
         flag_wait = true;
@@ -314,6 +317,8 @@ Bounce Call_Core(Frame(*) frame_) {
     char *errbuf = nullptr;
     size_t errbuf_used = 0;
 
+    REBVAL *callback_error = nullptr;  // from an ACTION! /OUTPUT or /ERROR
+
     //=//// INPUT SOURCE SETUP ////////////////////////////////////////////=//
 
     if (not REF(input)) {  // get stdin normally (usually from user console)
@@ -573,6 +578,14 @@ Bounce Call_Core(Frame(*) frame_) {
                         }
                         count--;
                     }
+                    else if (IS_ACTION(ARG(output))) {
+                        outbuf_used += n;
+                        callback_error = Send_Call_Output_Chunk(
+                            ARG(output), outbuf, &outbuf_used
+                        );
+                        if (callback_error)
+                            goto kill;
+                    }
                     else {
                         outbuf_used += n;
                         if (outbuf_used >= outbuf_capacity) {
@@ -602,6 +615,14 @@ Bounce Call_Core(Frame(*) frame_) {
                         }
                         count--;
                     }
+                    else if (IS_ACTION(ARG(error))) {
+                        errbuf_used += n;
+                        callback_error = Send_Call_Output_Chunk(
+                            ARG(error), errbuf, &errbuf_used
+                        );
+                        if (callback_error)
+                            goto kill;
+                    }
                     else {
                         errbuf_used += n;
                         if (errbuf_used >= errbuf_capacity) {
@@ -717,6 +738,10 @@ Bounce Call_Core(Frame(*) frame_) {
         rebElide("insert", ARG(output), output_val);
         rebRelease(output_val);
     }
+    else if (IS_ACTION(ARG(output))) {  // chunks were sent as they were read
+        if (outbuf != nullptr)
+            rebFree(outbuf);
+    }
     else
         assert(outbuf == nullptr);
 
@@ -730,12 +755,19 @@ Bounce Call_Core(Frame(*) frame_) {
         rebElide("append", ARG(error), error_val);
         rebRelease(error_val);
     }
+    else if (IS_ACTION(ARG(error))) {
+        if (errbuf != nullptr)
+            rebFree(errbuf);
+    }
     else
         assert(errbuf == nullptr);
 
     if (inbuf != nullptr)
         rebFree(inbuf);
 
+    if (callback_error)
+        rebJumps("fail", rebR(callback_error));
+
     if (ret != 0)
         rebFail_OS (ret);
 
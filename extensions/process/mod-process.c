@@ -91,9 +91,9 @@
 //      /input "Redirects stdin (false=/dev/null, true=inherit)"
 //          [text! binary! file! logic!]
 //      /output "Redirects stdout (false=/dev/null, true=inherit)"
-//          [text! binary! file! logic!]
+//          [text! binary! file! logic! action!]
 //      /error "Redirects stderr (false=/dev/null, true=inherit)"
-//          [text! binary! file! logic!]
+//          [text! binary! file! logic! action!]
 //  ]
 //
 DECLARE_NATIVE(call_internal_p)
@@ -58,4 +58,33 @@ inline static void Fail_No_Process(const REBVAL *arg) {
 //
 #define BUF_SIZE_CHUNK 4096
 
+
+// /OUTPUT and /ERROR may also be an ACTION!, which is called with each chunk
+// of the child's output as a BINARY! as it arrives.  So memory use doesn't
+// grow with the amount of output, and it can be processed as it comes (e.g.
+// logs from a long-running child).  The buffer is emptied after each call.
+//
+// Errors in the callback are trapped and returned, so the caller can still
+// kill the child and close the pipes before failing with it.
+//
+inline static REBVAL *Send_Call_Output_Chunk(
+    const REBVAL *sink,
+    const char *buf,
+    size_t *used
+){
+    if (*used == 0)
+        return nullptr;
+
+    REBVAL *result = rebEntrap(
+        rebRUN(sink), rebR(rebSizedBinary(buf, *used))
+    );
+    *used = 0;
+
+    if (result and rebUnboxLogic("error? @", result))
+        return result;
+
+    rebRelease(result);
+    return nullptr;
+}
+
 Bounce Call_Core(Frame(*) frame_);
@@ -44,7 +44,218 @@ extern void Shutdown_Stdio(void);
 //
 extern void Write_IO(const REBVAL *data, REBLEN len);
 
-extern bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out);
+extern bool Read_Stdin_Chunk_Interrupted(
+    bool *eof,
+    Byte* buf,
+    Size capacity,
+    Size *actual
+);
+
+extern bool Stdout_Is_Terminal(void);
+extern int Write_Stdout_Bytes(const Byte* bp, Size size);
+
+
+//=//// STDOUT BUFFERING //////////////////////////////////////////////////=//
+//
+// When stdout isn't the smart console, Write_IO() hands its bytes here.  If
+// each PRINT became a write() then a script printing millions of lines does
+// millions of system calls, so output is gathered in a buffer:
+//
+// * LINE buffering (the default for a terminal) writes out at each newline,
+//   so interactive output appears as it would unbuffered.
+//
+// * FULL buffering (the default for a pipe or file) only writes when the
+//   buffer fills.
+//
+// Whatever is buffered is also flushed before reading stdin (so prompts are
+// seen), on HALT, on FLUSH-STDOUT, and at shutdown.
+//
+// !!! Output from a child process run with CALL shares the file descriptor
+// but not the buffer, so FLUSH-STDOUT before a CALL if ordering matters.
+//
+
+#define STDOUT_BUFFER_SIZE (64 * 1024)
+
+enum Reb_Stdout_Buffering {
+    STDOUT_UNBUFFERED,
+    STDOUT_LINE_BUFFERED,
+    STDOUT_FULLY_BUFFERED
+};
+
+static enum Reb_Stdout_Buffering Stdout_Buffering = STDOUT_UNBUFFERED;
+static Byte* Stdout_Buffer = nullptr;  // allocated on first buffered write
+static Size Stdout_Buffered = 0;  // bytes in Stdout_Buffer not yet written
+
+
+// Returns 0, or an OS error code if the write failed.  (Buffered data is
+// dropped either way, so a broken pipe isn't reported again on every PRINT.)
+//
+static int Flush_Stdout(void)
+{
+    if (Stdout_Buffered == 0)
+        return 0;
+
+    int err = Write_Stdout_Bytes(Stdout_Buffer, Stdout_Buffered);
+    Stdout_Buffered = 0;
+    return err;
+}
+
+
+//
+//  Buffer_Stdout_Bytes: C
+//
+void Buffer_Stdout_Bytes(const Byte* bp, Size size)
+{
+    int err;
+
+    if (Stdout_Buffering == STDOUT_UNBUFFERED) {
+        err = Write_Stdout_Bytes(bp, size);
+        goto check_error;
+    }
+
+    if (Stdout_Buffer == nullptr) {
+        Stdout_Buffer = TRY_ALLOC_N(Byte, STDOUT_BUFFER_SIZE);
+        if (Stdout_Buffer == nullptr) {  // degrade to unbuffered, vs. fail
+            Stdout_Buffering = STDOUT_UNBUFFERED;
+            err = Write_Stdout_Bytes(bp, size);
+            goto check_error;
+        }
+    }
+
+    if (Stdout_Buffered + size > STDOUT_BUFFER_SIZE) {
+        err = Flush_Stdout();
+        if (err != 0)
+            goto check_error;
+
+        if (size >= STDOUT_BUFFER_SIZE) {  // no point in copying it
+            err = Write_Stdout_Bytes(bp, size);
+            goto check_error;
+        }
+    }
+
+    memcpy(Stdout_Buffer + Stdout_Buffered, bp, size);
+    Stdout_Buffered += size;
+
+    if (
+        Stdout_Buffering == STDOUT_LINE_BUFFERED
+        and memchr(bp, LF, size) != nullptr
+    ){
+        err = Flush_Stdout();
+    }
+    else
+        err = 0;
+
+  check_error:
+
+    if (err != 0)
+        rebFail_OS (err);
+}
+
+
+//
+//  Flush_Stdout_May_Fail: C
+//
+void Flush_Stdout_May_Fail(void)
+{
+    int err = Flush_Stdout();
+    if (err != 0)
+        rebFail_OS (err);
+}
+
+
+
+//=//// STDIN BUFFERING ///////////////////////////////////////////////////=//
+//
+// When stdin isn't the smart console, it is read in large chunks into this
+// buffer.  READ-LINE, READ-CHAR, and READ-STDIN take bytes from it one at a
+// time, while READ-LINES splits all the lines it holds at once.  Since they
+// all share it, the natives can be mixed without losing any input.
+//
+
+#define STDIN_BUFFER_SIZE (64 * 1024)
+
+static Byte* Stdin_Buffer = nullptr;  // allocated on first read
+static Size Stdin_Head = 0;  // position of the next unread byte
+static Size Stdin_Tail = 0;  // end of the bytes read from the OS
+
+
+static void Ensure_Stdin_Buffer(void)
+{
+    if (Stdin_Buffer == nullptr) {
+        Stdin_Buffer = TRY_ALLOC_N(Byte, STDIN_BUFFER_SIZE);
+        if (Stdin_Buffer == nullptr)
+            fail (Error_No_Memory(STDIN_BUFFER_SIZE));
+    }
+}
+
+
+// Move any unread bytes to the front of the buffer, and read more after them.
+// Returns true if interrupted.  Does not read if the buffer is already full.
+//
+static bool Fill_Stdin_Buffer_Interrupted(bool *eof)
+{
+    Ensure_Stdin_Buffer();
+
+    Size unread = Stdin_Tail - Stdin_Head;
+    memmove(Stdin_Buffer, Stdin_Buffer + Stdin_Head, unread);
+    Stdin_Head = 0;
+    Stdin_Tail = unread;
+
+    *eof = false;
+    if (Stdin_Tail == STDIN_BUFFER_SIZE)
+        return false;
+
+    Size actual;
+    if (Read_Stdin_Chunk_Interrupted(
+        eof,
+        Stdin_Buffer + Stdin_Tail,
+        STDIN_BUFFER_SIZE - Stdin_Tail,
+        &actual
+    )){
+        return true;
+    }
+    Stdin_Tail += actual;
+    return false;
+}
+
+
+// Returns true if interrupted.
+//
+static bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out)
+{
+    if (Stdin_Head == Stdin_Tail) {
+        if (Fill_Stdin_Buffer_Interrupted(eof))
+            return true;
+        if (Stdin_Head == Stdin_Tail) {
+            assert(*eof);
+            return false;
+        }
+    }
+
+    *out = Stdin_Buffer[Stdin_Head];
+    ++Stdin_Head;
+    *eof = false;
+    return false;
+}
+
+
+//
+//  Take_Buffered_Stdin: C
+//
+// For the console port's READ, which reads the OS with Read_IO().  Gives any
+// bytes that were buffered, so they aren't skipped over.  Returns 0 if none.
+//
+size_t Take_Buffered_Stdin(Byte* buf, size_t size)
+{
+    Size unread = Stdin_Tail - Stdin_Head;
+    if (size > unread)
+        size = unread;
+    if (size != 0) {
+        memcpy(buf, Stdin_Buffer + Stdin_Head, size);
+        Stdin_Head += size;
+    }
+    return size;
+}
 
 
 extern Bounce Console_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
@@ -82,6 +293,10 @@ DECLARE_NATIVE(startup_p)
     //
     Startup_Stdio();
 
+    Stdout_Buffering = Stdout_Is_Terminal()
+        ? STDOUT_LINE_BUFFERED
+        : STDOUT_FULLY_BUFFERED;
+
     return rebNone();
 }
 
@@ -132,10 +347,13 @@ DECLARE_NATIVE(write_stdout)
     REBLEN remaining;
     while ((remaining = VAL_LEN_AT(v)) > 0) {
         //
-        // Yield to signals processing for cancellation requests.
+        // Yield to signals processing for cancellation requests.  (Flush
+        // first, so what was printed before a HALT is seen.)
         //
-        if (Do_Signals_Throws(FRAME))
+        if (Do_Signals_Throws(FRAME)) {
+            Flush_Stdout();
             fail (Error_No_Catch_For_Throw(FRAME));
+        }
 
         REBLEN part;
         if (remaining <= 1024)
@@ -152,6 +370,64 @@ DECLARE_NATIVE(write_stdout)
 }
 
 
+//
+//  export flush-stdout: native [
+//
+//  {Write out any standard output that is being held in a buffer}
+//
+//      return: <none>
+//  ]
+//
+DECLARE_NATIVE(flush_stdout)
+{
+    STDIO_INCLUDE_PARAMS_OF_FLUSH_STDOUT;
+
+    Flush_Stdout_May_Fail();
+    return NONE;
+}
+
+
+//
+//  export stdout-buffering: native [
+//
+//  {Set how standard output is buffered when not going to the smart console}
+//
+//      return: "The previous setting"
+//          [word!]
+//      mode "NONE, LINE (write at each newline), or FULL (when buffer fills)"
+//          [word!]
+//  ]
+//
+DECLARE_NATIVE(stdout_buffering)
+//
+// Defaults to LINE when stdout is a terminal, and FULL when it's redirected.
+{
+    STDIO_INCLUDE_PARAMS_OF_STDOUT_BUFFERING;
+
+    const char *old;
+    switch (Stdout_Buffering) {
+      case STDOUT_UNBUFFERED: old = "'none"; break;
+      case STDOUT_LINE_BUFFERED: old = "'line"; break;
+      default: old = "'full"; break;
+    }
+
+    REBVAL *mode = ARG(mode);
+    if (rebUnboxLogic("'none = @", mode))
+        Stdout_Buffering = STDOUT_UNBUFFERED;
+    else if (rebUnboxLogic("'line = @", mode))
+        Stdout_Buffering = STDOUT_LINE_BUFFERED;
+    else if (rebUnboxLogic("'full = @", mode))
+        Stdout_Buffering = STDOUT_FULLY_BUFFERED;
+    else
+        fail (PARAM(mode));
+
+    if (Stdout_Buffering != STDOUT_FULLY_BUFFERED)
+        Flush_Stdout_May_Fail();  // don't hold text that won't be flushed
+
+    return rebValue(old);
+}
+
+
 //
 //  export read-stdin: native [
 //
@@ -177,6 +453,8 @@ DECLARE_NATIVE(read_stdin)
 {
     STDIO_INCLUDE_PARAMS_OF_READ_STDIN;
 
+    Flush_Stdout_May_Fail();
+
   #ifdef REBOL_SMART_CONSOLE
     if (Term_IO) {
         if (rebRunThrows(
@@ -194,23 +472,28 @@ DECLARE_NATIVE(read_stdin)
     else  // we have a smart console but aren't using it (redirected to file?)
   #endif
     {
-        // For the moment, just do a terribly inefficient implementation that
-        // just APPENDs to a BINARY!.
-        //
         bool eof = false;
 
         Size max = VAL_UINT32(ARG(size));
         Binary(*) bin = Make_Binary(max);
-        REBLEN i = 0;
-        while (BIN_LEN(bin) < max) {
-            if (Read_Stdin_Byte_Interrupted(&eof, BIN_AT(bin, i))) {  // Ctrl-C
-                if (rebWasHalting())
-                    rebJumps(Lib(HALT));
-                fail ("Interruption of READ-STDIN for reason other than HALT?");
+        Size i = 0;
+        while (i < max) {
+            if (Stdin_Head == Stdin_Tail) {
+                if (Fill_Stdin_Buffer_Interrupted(&eof)) {  // Ctrl-C
+                    if (rebWasHalting())
+                        rebJumps(Lib(HALT));
+                    fail (
+                        "Interruption of READ-STDIN for reason other than HALT?"
+                    );
+                }
+                if (eof)
+                    break;
             }
-            if (eof)
-                break;
-            ++i;
+
+            Size n = MIN(max - i, Stdin_Tail - Stdin_Head);
+            memcpy(BIN_AT(bin, i), Stdin_Buffer + Stdin_Head, n);
+            Stdin_Head += n;
+            i += n;
         }
         TERM_BIN_LEN(bin, i);
 
@@ -238,6 +521,8 @@ DECLARE_NATIVE(read_line)
 {
     STDIO_INCLUDE_PARAMS_OF_READ_LINE;
 
+    Flush_Stdout_May_Fail();  // e.g. so a prompt written with PRIN is seen
+
     if (REF(hide))
         fail (
             "READ-LINE/HIDE not yet implemented:"
@@ -383,6 +668,117 @@ DECLARE_NATIVE(read_line)
 }
 
 
+// Add a line to the data stack, with any part of it that was already taken out
+// of the buffer.
+//
+static void Push_Stdin_Line(String(*) *partial, const Byte* bp, Size size)
+{
+    if (*partial) {
+        Append_UTF8_May_Fail(*partial, cs_cast(bp), size, STRMODE_NO_CR);
+        Init_Text(PUSH(), *partial);
+        *partial = nullptr;
+    }
+    else
+        Init_Text(PUSH(), Make_Sized_String_UTF8(cs_cast(bp), size));
+}
+
+
+//
+//  export read-lines: native [
+//
+//  {Read as many whole lines as are available from standard input}
+//
+//      return: "Block of TEXT! without newlines, null if no more input"
+//          [<opt> block!]
+//  ]
+//
+DECLARE_NATIVE(read_lines)
+//
+// READ-LINE is built for interactive use, going a byte at a time.  When stdin
+// is redirected, this takes every line in the 64K input buffer in one call,
+// finding them with memchr() (which C libraries vectorize).  It only waits on
+// more input if there isn't a whole line yet, so a script can process piped
+// input a batch at a time:
+//
+//     while [lines: read-lines] [for-each line lines [...]]
+//
+// At the end of input, a last line without a newline is included.
+{
+    STDIO_INCLUDE_PARAMS_OF_READ_LINES;
+
+    Flush_Stdout_May_Fail();
+
+  #ifdef REBOL_SMART_CONSOLE
+    if (Term_IO)  // interactive, so there's only ever one line available
+        return rebValue("let line: read-line", "if text? line [reduce [line]]");
+  #endif
+
+    Ensure_Stdin_Buffer();
+
+    StackIndex base = TOP_INDEX;
+    String(*) partial = nullptr;  // line too long to fit in the buffer
+    bool eof = false;
+
+    while (true) {
+        const Byte* bp = Stdin_Buffer + Stdin_Head;
+        const Byte* tail = Stdin_Buffer + Stdin_Tail;
+        const Byte* lf;
+        while (
+            bp != tail
+            and (lf = cast(const Byte*, memchr(bp, LF, tail - bp)))
+        ){
+            Push_Stdin_Line(&partial, bp, lf - bp);
+            bp = lf + 1;
+        }
+        Stdin_Head = bp - Stdin_Buffer;
+
+        if (TOP_INDEX != base)
+            break;  // don't wait on more input if we have lines to give
+
+        if (eof) {
+            if (partial or Stdin_Head != Stdin_Tail)
+                Push_Stdin_Line(&partial, bp, tail - bp);
+            Stdin_Head = Stdin_Tail;
+            break;
+        }
+
+        if (Stdin_Head == 0 and Stdin_Tail == STDIN_BUFFER_SIZE) {
+            //
+            // The buffer is full with no newline, so move it to the partial
+            // line.  Leave any incomplete UTF-8 character at the end for the
+            // next read to finish.
+            //
+            const Byte* cut = tail;
+            const Byte* lead = tail - 1;
+            while (lead != bp and (*lead & 0xC0) == 0x80 and tail - lead < 4)
+                --lead;
+            if (*lead >= 0x80 and trailingBytesForUTF8[*lead] >= tail - lead)
+                cut = lead;
+
+            if (partial)
+                Append_UTF8_May_Fail(
+                    partial, cs_cast(bp), cut - bp, STRMODE_NO_CR
+                );
+            else
+                partial = Make_Sized_String_UTF8(cs_cast(bp), cut - bp);
+            Stdin_Head = cut - Stdin_Buffer;
+        }
+
+        if (Fill_Stdin_Buffer_Interrupted(&eof)) {  // Ctrl-C
+            if (rebWasHalting())
+                rebJumps(Lib(HALT));
+
+            fail ("Interruption of READ-LINES for reason other than HALT?");
+        }
+    }
+
+    if (TOP_INDEX == base)
+        return nullptr;  // end of input
+
+    return Init_Block(OUT, Pop_Stack_Values(base));
+}
+
+
 //
 //  export read-char: native [
 //
@@ -406,6 +802,8 @@ DECLARE_NATIVE(read_char)
 {
     STDIO_INCLUDE_PARAMS_OF_READ_CHAR;
 
+    Flush_Stdout_May_Fail();
+
     int timeout_msec;
     if (not REF(timeout))
         timeout_msec = 0;
@@ -550,6 +948,17 @@ DECLARE_NATIVE(shutdown_p)
 {
     STDIO_INCLUDE_PARAMS_OF_SHUTDOWN_P;
 
+    Flush_Stdout();  // nowhere to report a failure to at this point
+    if (Stdout_Buffer) {
+        FREE_N(Byte, STDOUT_BUFFER_SIZE, Stdout_Buffer);
+        Stdout_Buffer = nullptr;
+    }
+    if (Stdin_Buffer) {
+        FREE_N(Byte, STDIN_BUFFER_SIZE, Stdin_Buffer);
+        Stdin_Buffer = nullptr;
+        Stdin_Head = Stdin_Tail = 0;
+    }
+
     // This shutdown does platform-specific teardown, freeing buffers that
     // may only be have been created for Windows, etc.
     //
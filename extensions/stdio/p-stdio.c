@@ -38,6 +38,9 @@
 //
 extern size_t Read_IO(Byte* buf, size_t size);
 
+extern void Flush_Stdout_May_Fail(void);  // see STDOUT BUFFERING, %mod-stdio.c
+extern size_t Take_Buffered_Stdin(Byte* buf, size_t size);  // STDIN BUFFERING
+
 
 #if defined(REBOL_SMART_CONSOLE)
     STD_TERM *Term_IO = nullptr;
@@ -320,12 +323,14 @@ Bounce Console_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         if (REF(part))
             fail (Error_Bad_Refines_Raw());
 
-        if (REF(seek))
+        if (REF(seek) or REF(into) or REF(mapped))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PARAM(string)); // handled in dispatcher
         UNUSED(PARAM(lines)); // handled in dispatcher
 
+        Flush_Stdout_May_Fail();  // make sure any prompt has been seen
+
       #if defined(REBOL_SMART_CONSOLE)
         if (Term_IO) {  // e.g. no redirection (Term_IO is null if so)
             REBVAL *result = Read_Line(Term_IO);
@@ -397,7 +402,9 @@ Bounce Console_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
 
             Byte* buf = BIN_AT(bin, orig_len);
 
-            size_t actual = Read_IO(buf, size);  // appends to tail
+            size_t actual = Take_Buffered_Stdin(buf, size);  // READ-LINE etc.
+            if (actual == 0)
+                actual = Read_IO(buf, size);  // appends to tail
 
             TERM_BIN_LEN(bin, orig_len + actual);
         }
@@ -27,12 +27,6 @@
 
 #include "sys-core.h"
 
-// Note: We are only using the limited facilities of stdin and fgetc().
-// Generally speaking, we avoid usage of other stdio functions in the system.
-// (Outside of printf() in debug builds).
-//
-#include <stdio.h>
-
 #include <fcntl.h>
 #include <errno.h>
 #include <unistd.h>
@@ -40,6 +34,8 @@
 
 #include "readline.h"
 
+extern void Buffer_Stdout_Bytes(const Byte* bp, Size size);  // %mod-stdio.c
+
 
 //
 //  Startup_Stdio: C
@@ -54,43 +50,31 @@ void Startup_Stdio(void)
 
 
 //
-//  Read_Stdin_Byte_Interrupted: C
+//  Read_Stdin_Chunk_Interrupted: C
 //
-bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
-    int byte_or_eof = fgetc(stdin);
-    if (byte_or_eof != -1) {
-        assert(byte_or_eof >= 0 and byte_or_eof < 256);
-        *out = byte_or_eof;
-        *eof = false;  // was not end of file
-        return false;  // was not interrupted
-    }
-
-    if (errno == EINTR) {
-        //
-        // When there's an interrupt, we need to clear the error or every read
-        // after this will think there's an interrupt.  Trust the caller will
-        // propagate the flag.
-        //
-        clearerr(stdin);
-
-      #if !defined(NDEBUG)
-        *out = 0xFF;  // bad UTF8 byte
-        *eof = false;  // bad eof status
-      #endif
-        return true;  // was interrupted
-    }
+// Reads what is available from stdin, up to `capacity` bytes, waiting for at
+// least one byte unless at end of file.  Returns true if interrupted (e.g. by
+// a SIGINT, which is how HALT is triggered).
+//
+// (This is buffered by %mod-stdio.c, it's not used by the smart console.)
+//
+bool Read_Stdin_Chunk_Interrupted(
+    bool *eof,
+    Byte* buf,
+    Size capacity,
+    Size *actual
+){
+    long total = read(STDIN_FILENO, buf, capacity);
+    if (total < 0) {
+        if (errno == EINTR)
+            return true;  // was interrupted
 
-    // -1 can happen on Ctrl-C or on end of file.
-    //
-    if (feof(stdin)) {
-      #if !defined(NDEBUG)
-        *out = 0xFF;  // bad UTF8 byte
-      #endif
-        *eof = true;  // was end of file
-        return false;  // was not interrupted
+        rebFail_OS (errno);
     }
 
-    return true;  // was interrupted
+    *actual = total;
+    *eof = (total == 0);
+    return false;  // was not interrupted
 }
 
 
@@ -165,13 +149,38 @@ void Write_IO(const REBVAL *data, REBLEN len)
             UNUSED(len_check);
         }
 
-        long total = write(STDOUT_FILENO, bp, size);
+        Buffer_Stdout_Bytes(bp, size);
+    }
+}
 
-        if (total < 0)
-            rebFail_OS(errno);
 
-        assert(cast(size_t, total) == size);
+//
+//  Stdout_Is_Terminal: C
+//
+bool Stdout_Is_Terminal(void)
+{
+    return STDOUT_FILENO >= 0 and isatty(STDOUT_FILENO);
+}
+
+
+//
+//  Write_Stdout_Bytes: C
+//
+// Unbuffered write of all the bytes.  Returns 0, or errno on failure.
+//
+int Write_Stdout_Bytes(const Byte* bp, Size size)
+{
+    while (size > 0) {
+        long total = write(STDOUT_FILENO, bp, size);
+        if (total < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno;
+        }
+        bp += total;
+        size -= total;
     }
+    return 0;
 }
 
 
@@ -41,6 +41,8 @@
 
 #include "readline.h"
 
+extern void Buffer_Stdout_Bytes(const Byte* bp, Size size);  // %mod-stdio.c
+
 static HANDLE Stdout_Handle = nullptr;
 static HANDLE Stdin_Handle = nullptr;
 
@@ -109,11 +111,20 @@ void Startup_Stdio(void)
 
 
 //
-//  Read_Stdin_Byte_Interrupted: C
+//  Read_Stdin_Chunk_Interrupted: C
+//
+// Reads what is available from stdin, up to `capacity` bytes, waiting for at
+// least one byte unless at end of file.  Returns true if the operation was
+// interrupted by a SIGINT.
 //
-// Returns true if the operation was interrupted by a SIGINT.
+// (This is buffered by %mod-stdio.c, it's not used by the smart console.)
 //
-bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
+bool Read_Stdin_Chunk_Interrupted(
+    bool *eof,
+    Byte* buf,
+    Size capacity,
+    Size *actual
+){
     //
     // We don't read bytes from the smart console--it uses UTF16 and should
     // be read with the terminal layer.  This is just for redirection or use
@@ -123,20 +134,22 @@ bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
     assert(Term_IO == nullptr);
   #endif
 
+    *actual = 0;
+
     // !!! See note in Detect_Handle_Piping(), that currently we don't have
     // a working mechanism to detect null.  Workaround uses num_read_attempts.
     //
     if (stdin_piping == Piped_To_NUL) {  // reads nothing forever, no eof
         *eof = true;  // but treat like it is an end of file
-        *out = 0xFF;  // unused, make it trash (0xFF is bad UTF-8)
         return false;  // not interrupted
     }
 
-    DWORD actual;
+    DWORD bytes_to_read = capacity;
+    DWORD total;
     bool ok;
     int num_zero_reads = 0;
     do {
-        // The `actual` will come back as 0 if the other end of a pipe called
+        // The `total` will come back as 0 if the other end of a pipe called
         // the WriteFile function with nNumberOfBytesToWrite set to zero.
         // WinAPI docs say "The behavior of a null write operation depends on
         // the underlying file system or communications technology."  Another
@@ -157,14 +170,27 @@ bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
         // We have to be careful of redirects of NUL to input, which will
         // always act like it wrote 0 bytes on the pipe.  Handled above.
         //
-        ok = ReadFile(Stdin_Handle, out, 1, &actual, nullptr);
+        ok = ReadFile(Stdin_Handle, buf, bytes_to_read, &total, nullptr);
+
+        // Some versions of Windows give ERROR_NOT_ENOUGH_MEMORY for a large
+        // ReadFile() on a console handle.  See notes in Read_IO().
+        //
+        if (
+            not ok
+            and GetLastError() == ERROR_NOT_ENOUGH_MEMORY
+            and bytes_to_read > 10 * 1024
+        ){
+            bytes_to_read -= 1024;
+            ok = true;
+            total = 0;
+            continue;
+        }
 
         if (++num_zero_reads == 128) {  // heuristic to detect NUL in piping
             *eof = true;  // treat it like an end of file
-            *out = 0xFF;  // unused, make it trash (0xFF is bad UTF-8)
             return false;  // not interrupted
         }
-    } while (ok and actual == 0);
+    } while (ok and total == 0);
 
     if (ok) {
         //
@@ -175,29 +201,22 @@ bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
         //
         // But if you are not redirecting I/O, Windows unfortunately does throw
         // in CR LF sequences from what you type in the console.  Filter those.
+        // (A typed line arrives in one read, so the pair isn't split.)
         //
-        if (*out != CR or stdin_piping == Piped_To_File) {
-            *eof = false;  // not end of file
-            return false;  // not interrupted
-        }
-
-        assert(stdin_piping == Not_Piped);
-
-        // Be robust if the console implementation does 0 byte WriteFile()
-        do {
-            ok = ReadFile(Stdin_Handle, out, 1, &actual, nullptr);
-        } while (ok and actual == 0);
-
-        if (ok and *out == LF) {
-            *eof = false;  // not end of file
-            return false;  // not interrupted
+        if (stdin_piping == Not_Piped) {
+            DWORD src;
+            DWORD dest = 0;
+            for (src = 0; src < total; ++src) {
+                if (buf[src] == CR and src + 1 < total and buf[src + 1] == LF)
+                    continue;
+                buf[dest++] = buf[src];
+            }
+            total = dest;
         }
 
-        DWORD last_error = GetLastError();
-        if (*out != LF or last_error == ERROR_HANDLE_EOF)
-            fail ("CR found not followed by LF in Windows typed input");
-
-        fail (rebError_OS(last_error));
+        *actual = total;
+        *eof = false;  // not end of file
+        return false;  // not interrupted
     }
 
     // If you are piping with something like `echo "hello" | r3 reader.r` then
@@ -210,7 +229,7 @@ bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
         *eof = true;  // was end of file
         return false;  // was not interrupted
     }
-    fail (rebError_OS(GetLastError()));
+    fail (rebError_OS(last_error));
 }
 
 
@@ -341,6 +360,31 @@ void Write_IO(const REBVAL *data, REBLEN len)
             bp = VAL_UTF8_SIZE_AT(&size, data);
         }
 
+        Buffer_Stdout_Bytes(bp, size);
+    }
+}
+
+
+//
+//  Stdout_Is_Terminal: C
+//
+bool Stdout_Is_Terminal(void)
+{
+    return Stdout_Handle != nullptr and stdout_piping == Not_Piped;
+}
+
+
+//
+//  Write_Stdout_Bytes: C
+//
+// Unbuffered write of all the bytes.  Returns 0, or GetLastError() on failure.
+//
+int Write_Stdout_Bytes(const Byte* bp, Size size)
+{
+    if (Stdout_Handle == nullptr)
+        return 0;
+
+    while (size > 0) {
         DWORD total_bytes;
         BOOL ok = WriteFile(
             Stdout_Handle,
@@ -350,11 +394,12 @@ void Write_IO(const REBVAL *data, REBLEN len)
             0
         );
         if (not ok)
-            rebFail_OS (GetLastError());
+            return GetLastError();
 
-        assert(total_bytes == size);
-        UNUSED(total_bytes);
+        bp += total_bytes;
+        size -= total_bytes;
     }
+    return 0;
 }
 
 
@@ -95,8 +95,11 @@ int tcc_set_lib_path_i(TCCState *s, const char *path)
 #define IDX_TCC_NATIVE_STATE \
     IDX_TCC_NATIVE_LINKNAME + 1 // will be a BLANK! until COMPILE happens
 
+#define IDX_TCC_NATIVE_SHIMS \
+    IDX_TCC_NATIVE_STATE + 1 // BLOCK! of TEXT! #defines and #undefs, or BLANK!
+
 #define IDX_TCC_NATIVE_MAX \
-    (IDX_TCC_NATIVE_STATE + 1)
+    (IDX_TCC_NATIVE_SHIMS + 1)
 
 
 // COMPILE replaces &Pending_Native_Dispatcher that user natives start with,
@@ -215,6 +218,32 @@ static void Process_Block_Helper(
 }
 
 
+// Settings in the config which must be applied before the output type is set
+// (and hence before anything is compiled).
+//
+static void Process_Compile_Options(TCCState *state, const REBVAL *config)
+{
+    // Sets options (same syntax as the TCC command line, minus commands like
+    // displaying the version or showing the TCC tool's help)
+    //
+    Process_Block_Helper(tcc_set_options_i, state, config, "options");
+
+    // Add include paths (same as `-I` in the options?)
+    //
+    Process_Block_Helper(tcc_add_include_path, state, config, "include-path");
+
+    // Though it is called `tcc_set_lib_path()`, it says it sets CONFIG_TCCDIR
+    // at runtime of the built code, presumably so libtcc1.a can be found.
+    //
+    // !!! This doesn't seem to help Windows find the libtcc1.a file, so it's
+    // not clear what the call does.  The higher-level COMPILE goes ahead and
+    // sets the runtime path as an ordinary lib directory on Windows for the
+    // moment, since this seems to be a no-op there.  :-/
+    //
+    Process_Text_Helper(tcc_set_lib_path_i, state, config, "runtime-path");
+}
+
+
 // libtcc breaks ISO C++ by passing function pointers as void*.  This helper
 // uses memcpy to circumvent, assuming they're the same size.
 //
@@ -249,6 +278,239 @@ static void cleanup(const REBVAL *val)
 }
 
 
+//=//// ON-DISK CACHE OF COMPILED CODE ///////////////////////////////////=//
+//
+// Compiling is most of the time COMPILE takes, and scripts tend to compile
+// the same natives on every run.  If the config has a `cache-dir`, the code
+// is compiled to an object file there, and the in-memory state is made from
+// that object.  Later runs find the object and skip compiling.  (Linking in
+// the libRebol symbols and relocating still happen every time, but those are
+// fast.)
+//
+// Files are named by a hash of the "key": the source, the settings that
+// affect compilation, and the interpreter's version and build.  (TCC is
+// built into this extension, so the build stands in for a TCC version.)  The
+// key is saved beside the object, and must match byte-for-byte before the
+// object is used, so a hash collision is just a cache miss.
+//
+// Note that a native's source includes its linkname, so MAKE-NATIVE must not
+// generate linknames that change from run to run.
+//
+
+// Get the local path of an object file compiled from `source`, compiling it
+// if it's not in the cache.  Returns nullptr if there's no cache (or the
+// object can't be written there).
+//
+static char *Cached_Object_Path_Alloc(
+    const REBVAL *config,
+    const REBVAL *source,  // TEXT!
+    const REBVAL *compilables  // just for error messages
+){
+    REBVAL *cache_dir = rebValue(
+        "ensure [<opt> text!] pick", config, "'cache-dir"
+    );
+    if (not cache_dir)
+        return nullptr;
+
+    REBVAL *key = rebValue(
+        "as binary! unspaced [",
+            "mold reduce [",
+                "system.version system.build",
+                "pick", config, "'options",
+                "pick", config, "'include-path",
+            "]",
+            "newline", source,
+        "]"
+    );
+
+    Size key_size;
+    const Byte* key_bytes = VAL_BINARY_SIZE_AT(&key_size, key);
+    uint32_t hash = Hash_Bytes(key_bytes, key_size);
+
+    REBVAL *base = rebValue(
+        "unspaced [",
+            rebR(cache_dir), "{tcc-} skip (as text! to-hex", rebI(hash), ") 8",
+        "]"
+    );
+    REBVAL *obj_path = rebValue("join", base, "{.o}");
+    REBVAL *key_path = rebValue("join", base, "{.key}");
+    rebRelease(base);
+
+    bool hit = rebDid(
+        "all [",
+            "exists? local-to-file", obj_path,
+            "exists? local-to-file", key_path,
+            "(read local-to-file", key_path, ") =", key,
+        "]"
+    );
+
+    if (not hit) {
+        TCCState *obj_state = tcc_new();
+        if (not obj_state)
+            fail ("TCC failed to create a TCC context");
+
+        DECLARE_LOCAL (handle);  // so GC frees the state if there's a fail()
+        Init_Handle_Cdata_Managed(handle, obj_state, 1, cleanup);
+        PUSH_GC_GUARD(handle);
+
+        void* opaque = cast(void*, EMPTY_BLOCK);  // see Error_Reporting_Hook
+        tcc_set_error_func(obj_state, opaque, &Error_Reporting_Hook);
+
+        Process_Compile_Options(obj_state, config);
+
+        if (tcc_set_output_type(obj_state, TCC_OUTPUT_OBJ) < 0)
+            fail ("TCC failed to set output to OBJ");
+
+        if (tcc_compile_string(obj_state, STR_UTF8(VAL_STRING(source))) < 0)
+            rebJumps ("fail [",
+                "{TCC failed to compile the code}", compilables,
+            "]");
+
+        char *obj_path_utf8 = rebSpell(obj_path);
+        int status = tcc_output_file(obj_state, obj_path_utf8);
+        rebFree(obj_path_utf8);
+
+        DROP_GC_GUARD(handle);
+
+        if (status < 0) {  // e.g. directory isn't writable, compile in memory
+            rebRelease(key_path);
+            rebRelease(obj_path);
+            rebRelease(key);
+            return nullptr;
+        }
+
+        // Write the key last, so an interrupted write is just a cache miss.
+        //
+        rebElide("write local-to-file", key_path, key);
+    }
+
+    char *result = rebSpell(obj_path);
+    rebRelease(key_path);
+    rebRelease(obj_path);
+    rebRelease(key);
+    return result;
+}
+
+
+//=//// DIRECT ARGUMENT ACCESS ///////////////////////////////////////////=//
+//
+// User natives normally get at their arguments through libRebol, e.g. with
+// `rebUnboxInteger(rebArgR("n"))`.  That goes through the variadic API
+// machinery (scanning the string, looking up the word...) on every access,
+// which can cost far more than the work a small numeric native does.
+//
+// So arguments typed as just one of [integer!] [decimal!] [binary!] get
+// accessor macros, which call these functions with the argument's frame
+// index.  Type checking already happened when the native was called, so
+// they can read the frame slot directly:
+//
+//     add-one: make-native [n [integer!]] {
+//         return rebInteger(arg_n + 1);
+//     }
+//
+// A BINARY! argument `data` gets `arg_data` (a pointer to the bytes at the
+// binary's index) and `arg_data_size`.  Names with characters that aren't
+// legal in C identifiers (other than `-`, which becomes `_`) get no macros.
+//
+
+static long long Tcc_Arg_Integer(void *frame_, int index)
+{
+    Frame(*) f = cast(Frame(*), frame_);
+    return VAL_INT64(FRM_ARG(f, index));
+}
+
+static double Tcc_Arg_Decimal(void *frame_, int index)
+{
+    Frame(*) f = cast(Frame(*), frame_);
+    return VAL_DECIMAL(FRM_ARG(f, index));
+}
+
+static const unsigned char *Tcc_Arg_Binary(void *frame_, int index)
+{
+    Frame(*) f = cast(Frame(*), frame_);
+    return VAL_BINARY_AT(FRM_ARG(f, index));
+}
+
+static long long Tcc_Arg_Binary_Size(void *frame_, int index)
+{
+    Frame(*) f = cast(Frame(*), frame_);
+    Size size;
+    VAL_BINARY_SIZE_AT(&size, FRM_ARG(f, index));
+    return size;
+}
+
+static const char Arg_Shim_Prototypes[] =
+    "long long Tcc_Arg_Integer(void *frame_, int index);\n"
+    "double Tcc_Arg_Decimal(void *frame_, int index);\n"
+    "const unsigned char *Tcc_Arg_Binary(void *frame_, int index);\n"
+    "long long Tcc_Arg_Binary_Size(void *frame_, int index);\n"
+    "\n";
+
+
+// Make the accessor macros for a user native's arguments, to be put around
+// its source in COMPILE*.  The spec is analyzed by TCC-SHIM-PARAMS, but the
+// frame index has to come from the keylist.
+//
+static void Make_Arg_Shims(Cell(*) out, Action(*) native, const REBVAL *spec)
+{
+    REBVAL *params = rebValue("tcc-shim-params", spec);  // [word name type]
+    if (rebUnboxLogic("empty?", params)) {
+        rebRelease(params);
+        Init_Blank(out);
+        return;
+    }
+
+    REBVAL *defines = rebValue("copy {}");
+    REBVAL *undefs = rebValue("copy {}");
+
+    REBLEN len = rebUnbox("length of", params);
+    REBLEN i;
+    for (i = 1; i <= len; i += 3) {
+        REBVAL *word = rebValue("pick", params, rebI(i));
+        REBVAL *name = rebValue("pick", params, rebI(i + 1));
+        REBVAL *type = rebValue("pick", params, rebI(i + 2));
+
+        REBLEN index = 1;
+        const REBKEY *tail;
+        const REBKEY *key = ACT_KEYS(&tail, native);
+        for (; key != tail; ++key, ++index) {
+            if (KEY_SYMBOL(key) == VAL_WORD_SYMBOL(word))
+                break;
+        }
+        assert(key != tail);  // spec words are all keys
+
+        rebElide(
+            "let add-shim: func [suffix accessor] [",
+                "append", defines, "unspaced [",
+                    "{#define arg_}", name, "suffix space",
+                    "accessor {(frame_, }", rebI(index), "{)} newline",
+                "]",
+                "append", undefs, "unspaced [",
+                    "{#undef arg_}", name, "suffix newline",
+                "]",
+            "]",
+            "switch @", type, "[",
+                "'integer! [add-shim {} {Tcc_Arg_Integer}]",
+                "'decimal! [add-shim {} {Tcc_Arg_Decimal}]",
+                "'binary! [",
+                    "add-shim {} {Tcc_Arg_Binary}",
+                    "add-shim {_size} {Tcc_Arg_Binary_Size}",
+                "]",
+            "]"
+        );
+
+        rebRelease(type);
+        rebRelease(name);
+        rebRelease(word);
+    }
+
+    REBVAL *block = rebValue("reduce [", rebR(defines), rebR(undefs), "]");
+    Copy_Cell(out, block);
+    rebRelease(block);
+    rebRelease(params);
+}
+
+
 //
 //  Pending_Native_Dispatcher: C
 //
@@ -320,7 +582,7 @@ DECLARE_NATIVE(make_native)
         paramlist,
         nullptr,  // no partials
         &Pending_Native_Dispatcher,  // will be replaced e.g. by COMPILE
-        IDX_TCC_NATIVE_MAX  // details len [source module linkname tcc_state]
+        IDX_TCC_NATIVE_MAX  // [source module linkname tcc_state shims]
     );
 
     assert(ACT_META(native) == nullptr);
@@ -356,12 +618,16 @@ DECLARE_NATIVE(make_native)
         }
     }
     else {
-        // Auto-generate a linker name based on the numeric value of the
-        // paramlist pointer.  Just "N_" followed by the hexadecimal value.
+        // Auto-generate a linker name, "N_" followed by a hexadecimal count
+        // of natives made so far.  (It used to be the address of the details
+        // array, but names must be the same on each run of a script for its
+        // compiled code to be found in the COMPILE cache.)
+
+        static REBI64 num_auto_linknames = 0;
+        ++num_auto_linknames;
 
-        intptr_t heapaddr = cast(intptr_t, details);
         REBVAL *linkname = rebValue(
-            "unspaced [{N_} as text! to-hex", rebI(heapaddr), "]"
+            "unspaced [{N_} as text! to-hex", rebI(num_auto_linknames), "]"
         );
 
         Copy_Cell(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME), linkname);
@@ -370,6 +636,8 @@ DECLARE_NATIVE(make_native)
 
     Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_STATE)); // no TCC_State, yet...
 
+    Make_Arg_Shims(ARR_AT(details, IDX_TCC_NATIVE_SHIMS), native, ARG(spec));
+
     Set_Action_Flag(native, IS_NATIVE);
     return Init_Activation(OUT, native, ANONYMOUS, UNBOUND);
 }
@@ -429,24 +697,7 @@ DECLARE_NATIVE(compile_p)
 
     REBVAL *config = ARG(config);
 
-    // Sets options (same syntax as the TCC command line, minus commands like
-    // displaying the version or showing the TCC tool's help)
-    //
-    Process_Block_Helper(tcc_set_options_i, state, config, "options");
-
-    // Add include paths (same as `-I` in the options?)
-    //
-    Process_Block_Helper(tcc_add_include_path, state, config, "include-path");
-
-    // Though it is called `tcc_set_lib_path()`, it says it sets CONFIG_TCCDIR
-    // at runtime of the built code, presumably so libtcc1.a can be found.
-    //
-    // !!! This doesn't seem to help Windows find the libtcc1.a file, so it's
-    // not clear what the call does.  The higher-level COMPILE goes ahead and
-    // sets the runtime path as an ordinary lib directory on Windows for the
-    // moment, since this seems to be a no-op there.  :-/
-    //
-    Process_Text_Helper(tcc_set_lib_path_i, state, config, "runtime-path");
+    Process_Compile_Options(state, config);
 
     // The output_type has to be set *before* you all tcc_output_file() or
     // tcc_relocate(), but has to be set *after* you've configured the
@@ -506,6 +757,8 @@ DECLARE_NATIVE(compile_p)
         DECLARE_MOLD (mo);  // Note: mold buffer is UTF-8
         Push_Mold(mo);
 
+        bool shim_prototypes = false;  // only added if a native needs them
+
         Cell(const*) tail;
         Cell(const*) item = VAL_ARRAY_AT(&tail, compilables);
         for (; item != tail; ++item) {
@@ -533,6 +786,15 @@ DECLARE_NATIVE(compile_p)
                 //
                 // https://forum.rebol.info/t/817
                 //
+                Cell(*) shims = ARR_AT(details, IDX_TCC_NATIVE_SHIMS);
+                if (IS_BLOCK(shims)) {  // see DIRECT ARGUMENT ACCESS
+                    if (not shim_prototypes) {
+                        Append_Ascii(mo->series, Arg_Shim_Prototypes);
+                        shim_prototypes = true;
+                    }
+                    Append_String(mo->series, ARR_AT(VAL_ARRAY(shims), 0));
+                }
+
                 Append_Ascii(mo->series, "const REBVAL *");
                 Append_String(mo->series, linkname);
                 Append_Ascii(mo->series, "(void *frame_)\n{");
@@ -540,6 +802,9 @@ DECLARE_NATIVE(compile_p)
                 Append_String(mo->series, source);
 
                 Append_Ascii(mo->series, "}\n\n");
+
+                if (IS_BLOCK(shims))
+                    Append_String(mo->series, ARR_AT(VAL_ARRAY(shims), 1));
             }
             else if (IS_TEXT(item)) {
                 //
@@ -571,18 +836,33 @@ DECLARE_NATIVE(compile_p)
             return Init_Text(OUT, Pop_Molded_String(mo));
         }
 
-        if (
-            tcc_compile_string(
-                state,
-                cs_cast(BIN_AT(mo->series, mo->base.size))
-            ) < 0
-        ){
+        // The source is taken out of the mold buffer, because making the
+        // cache key molds (which could move the buffer's memory).
+        //
+        DECLARE_LOCAL (source);
+        Init_Text(source, Pop_Molded_String(mo));
+        PUSH_GC_GUARD(source);
+
+        char *cached_utf8 = nullptr;
+        if (output_type == TCC_OUTPUT_MEMORY) {
+            cached_utf8 = Cached_Object_Path_Alloc(
+                config, source, compilables
+            );
+        }
+
+        if (cached_utf8) {
+            int status = tcc_add_file(state, cached_utf8);
+            rebFree(cached_utf8);
+            if (status < 0)
+                fail ("TCC failed to load cached object file");
+        }
+        else if (tcc_compile_string(state, STR_UTF8(VAL_STRING(source))) < 0) {
             rebJumps ("fail [",
                 "{TCC failed to compile the code}", compilables,
             "]");
         }
 
-        Drop_Mold(mo);  // discard the combined source (no longer needed)
+        DROP_GC_GUARD(source);  // combined source no longer needed
     }
 
   //=//// LINKING STEPS (Libraries) ///////////////////////////////////////=//
@@ -637,6 +917,19 @@ DECLARE_NATIVE(compile_p)
     }
 
     if (output_type == TCC_OUTPUT_MEMORY) {
+        Add_API_Symbol_Helper(
+            state, "Tcc_Arg_Integer", cast(CFUNC*, &Tcc_Arg_Integer)
+        );
+        Add_API_Symbol_Helper(
+            state, "Tcc_Arg_Decimal", cast(CFUNC*, &Tcc_Arg_Decimal)
+        );
+        Add_API_Symbol_Helper(
+            state, "Tcc_Arg_Binary", cast(CFUNC*, &Tcc_Arg_Binary)
+        );
+        Add_API_Symbol_Helper(
+            state, "Tcc_Arg_Binary_Size", cast(CFUNC*, &Tcc_Arg_Binary_Size)
+        );
+
         if (tcc_relocate_auto(state) < 0)
             fail ("TCC failed to relocate the code");
     }
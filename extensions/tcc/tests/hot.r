@@ -0,0 +1,57 @@
+REBOL [
+    Title: {Check HOT Tier-Up Against the Interpreted Version}
+    Description: {
+        HOT functions run interpreted until they have been called enough,
+        then get translated to C and compiled.  This runs the same numeric
+        kernel through both tiers and checks they agree, including after a
+        change in argument types (which should deoptimize) and an integer
+        overflow (which should be reported by the interpreter, as usual).
+
+        Pass "nobench" to skip the timing comparison.
+    }
+]
+
+body: [
+    if n < 0 [return -1]
+    if n <= 1 [return n]
+    i0: 0
+    i1: 1
+    while [n > 1] [
+        t: i1
+        i1: i0 + i1
+        i0: t
+        n: n - 1
+    ]
+    return i1
+]
+
+rebol-fib: func [n [integer!] <local> i0 i1 t] body
+hot-fib: hot/threshold [n [integer!] <local> i0 i1 t] body 10
+
+count-up i 100 [
+    assert [(hot-fib 30) = (rebol-fib 30)]
+]
+
+assert [error? sys.util.rescue [hot-fib 100]]  ; overflows, so interpreter
+
+scale: hot/threshold [x [integer! decimal!] k [decimal!]] [
+    x * k + 0.5
+] 10
+
+count-up i 20 [assert [(scale 2 1.5) = 3.5]]
+count-up i 20 [assert [(scale 2.5 2.0) = 5.5]]  ; deoptimizes, then recompiles
+
+if not find system.options.args "nobench" [
+    n: 10000
+    print ["=== Running benchmark," n "iterations ==="]
+
+    h: delta-time [
+        repeat n [hot-fib 30]
+    ]
+    r: delta-time [
+        repeat n [rebol-fib 30]
+    ]
+
+    print ["HOT time:" h]
+    print ["Rebol time:" r]
+]
@@ -29,6 +29,7 @@
 
 
 extern REBVAL *Get_Current_Datetime_Value(void);
+extern int64_t Get_Monotonic_Nanoseconds(void);
 
 //
 //  export now: native [
@@ -132,3 +133,24 @@ DECLARE_NATIVE(now)
 
     return OUT;
 }
+
+
+//
+//  export monotonic-nanoseconds: native [
+//
+//  "Reading of a high-resolution clock that never jumps, for timing"
+//
+//      return: "Nanoseconds since an arbitrary point, subtract two readings"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(monotonic_nanoseconds)
+//
+// NOW/PRECISE is wall-clock time, which can be adjusted while something is
+// being measured.  It also makes a DATE! with a time zone, which is more
+// work than the measurement should cost.  This just makes an INTEGER!.
+{
+    TIME_INCLUDE_PARAMS_OF_MONOTONIC_NANOSECONDS;
+
+    return Init_Integer(OUT, Get_Monotonic_Nanoseconds());
+}
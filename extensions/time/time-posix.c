@@ -155,3 +155,20 @@ REBVAL *Get_Current_Datetime_Value(void)
         rebI(zone),  // zone
     ")");
 }
+
+
+//
+//  Get_Monotonic_Nanoseconds: C
+//
+// A high resolution counter for measuring intervals.  Unlike the wall clock
+// it never jumps (e.g. when NTP adjusts the time), but its zero point is
+// arbitrary, so only differences between two readings mean anything.
+//
+int64_t Get_Monotonic_Nanoseconds(void)
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        rebJumps("fail {clock_gettime() failed for CLOCK_MONOTONIC}");
+
+    return cast(int64_t, ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
@@ -60,3 +60,25 @@ REBVAL *Get_Current_Datetime_Value(void)
         rebI(-tzone.Bias),  // zone
     ")");
 }
+
+
+//
+//  Get_Monotonic_Nanoseconds: C
+//
+// A high resolution counter for measuring intervals.  Unlike the wall clock
+// it never jumps (e.g. when the system time is synchronized), but its zero
+// point is arbitrary, so only differences between two readings mean anything.
+//
+int64_t Get_Monotonic_Nanoseconds(void)
+{
+    LARGE_INTEGER frequency;  // ticks per second, fixed at boot
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    // Split the multiply so it can't overflow int64_t for large uptimes
+    //
+    int64_t secs = counter.QuadPart / frequency.QuadPart;
+    int64_t rest = counter.QuadPart % frequency.QuadPart;
+    return secs * 1000000000 + (rest * 1000000000) / frequency.QuadPart;
+}
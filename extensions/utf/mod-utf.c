@@ -73,16 +73,76 @@ REBINT What_UTF(const Byte* bp, REBLEN len)
 }
 
 
+//=//// UTF-16 TRANSCODING ///////////////////////////////////////////////=//
+//
+// Both directions make two passes.  The first validates and works out the
+// exact size of the output, so it's allocated once with no slack; the second
+// writes it.  Text exported from Windows is mostly ASCII, so both passes
+// step over runs of it 8 bytes at a time, checking a whole 64-bit word with
+// one mask (the same word-at-a-time approach as the hashing and caseless
+// compares in the core).
+//
+
+// Bits that are zero in each 16-bit lane of a 64-bit word if the four code
+// units in it are ASCII.  Which byte of a lane is the high byte depends on
+// whether the data's endianness matches the CPU's.
+//
+inline static uint64_t Utf16_Non_Ascii_Mask(bool little_endian) {
+  #if defined(ENDIAN_LITTLE)
+    return little_endian ? 0xFF80FF80FF80FF80ULL : 0x80FF80FF80FF80FFULL;
+  #elif defined(ENDIAN_BIG)
+    return little_endian ? 0x80FF80FF80FF80FFULL : 0xFF80FF80FF80FF80ULL;
+  #else
+    #error "Unsupported CPU endian"
+  #endif
+}
+
+inline static Codepoint Utf16_Unit_At(const Byte* bp, bool little_endian) {
+    if (little_endian)
+        return bp[0] | (cast(Codepoint, bp[1]) << 8);
+    return (cast(Codepoint, bp[0]) << 8) | bp[1];
+}
+
+// Get the codepoint at `*bp`, advancing past it (two units if a surrogate
+// pair).  Fails on an unpaired surrogate or a zero code unit.
+//
+inline static Codepoint Utf16_Next_Codepoint(
+    const Byte** bp,
+    const Byte* tail,
+    bool little_endian
+){
+    Codepoint c = Utf16_Unit_At(*bp, little_endian);
+    *bp += 2;
+
+    if (c == 0)
+        fail (Error_Illegal_Zero_Byte_Raw());
+
+    if (c < UNI_SUR_HIGH_START or c > UNI_SUR_LOW_END)
+        return c;
+
+    if (c > UNI_SUR_HIGH_END or *bp == tail)  // low first, or high at end
+        fail ("Unpaired surrogate in UTF-16 data");
+
+    REBWCHAR units[2];
+    units[0] = c;
+    units[1] = Utf16_Unit_At(*bp, little_endian);
+    if (units[1] < UNI_SUR_LOW_START or units[1] > UNI_SUR_LOW_END)
+        fail ("Unpaired surrogate in UTF-16 data");
+    *bp += 2;
+
+    return Decode_UTF16_Pair(units);
+}
+
+
 //
-//  Decode_UTF16_Negative_If_ASCII: C
+//  Decode_UTF16: C
 //
 // src: source binary data
-// len: byte-length of source (not number of chars)
+// len: byte-length of source (not number of chars), an odd byte is ignored
 // little_endian: little endian encoded
 // crlf_to_lf: convert CRLF/CR to LF
 //
-// Returns length in chars (negative if all chars are ASCII).
-// No terminator is added.
+// A leading byte-order mark is dropped.
 //
 String(*) Decode_UTF16(
     const Byte* src,
@@ -90,60 +150,78 @@ String(*) Decode_UTF16(
     bool little_endian,
     bool crlf_to_lf
 ){
-    String(*) s = Make_String(len * 2);  // !!! conservative, 4 bytes per 2...
+    const Byte* tail = src + (len & ~cast(REBLEN, 1));
+    if (src != tail and Utf16_Unit_At(src, little_endian) == 0xFEFF)
+        src += 2;
 
-    bool expect_lf = false;
-    bool ascii = true;
-    Codepoint c;
+    uint64_t non_ascii = Utf16_Non_Ascii_Mask(little_endian);
 
-    REBLEN num_chars = 0;
+    // Counting pass: validate, and get the UTF-8 size and codepoint count
 
-    Utf8(*) dp = STR_HEAD(s);
+    Size size = 0;
+    REBLEN num_chars = 0;
 
-    for (; len > 0; len--, src++) {
-        //
-        // Combine bytes in big or little endian format
-        //
-        c = *src;
-        if (not little_endian)
-            c <<= 8;
-        if (--len <= 0)
-            break;
-
-        src++;
-
-        c |= little_endian ? (cast(Codepoint, *src) << 8) : *src;
-
-        if (crlf_to_lf) {
-            //
-            // Skip CR, but add LF (even if missing)
-            //
-            if (expect_lf and c != LF) {
-                expect_lf = false;
-                dp = WRITE_CHR(dp, LF);
-                ++num_chars;
-            }
-            if (c == CR) {
-                expect_lf = true;
+    const Byte* bp = src;
+    while (bp != tail) {
+        if (tail - bp >= 8) {
+            uint64_t w;
+            memcpy(&w, bp, 8);
+            if ((w & non_ascii) == 0 and (not crlf_to_lf or not memchr(bp, CR, 8))) {
+                bp += 8;  // (a zero unit is caught by the writing pass)
+                size += 4;
+                num_chars += 4;
                 continue;
             }
         }
 
-        // !!! "check for surrogate pair" ??
+        Codepoint c = Utf16_Next_Codepoint(&bp, tail, little_endian);
+        if (
+            crlf_to_lf and c == CR
+            and bp != tail and Utf16_Unit_At(bp, little_endian) == LF
+        ){
+            continue;  // CR LF becomes just the LF
+        }
+        size += Encoded_Size_For_Codepoint(c);  // a lone CR becomes LF
+        ++num_chars;
+    }
+
+    // Writing pass, into a string allocated at exactly the needed size
 
-        if (c > 127)
-            ascii = false;
+    String(*) s = Make_String(size);
+    Utf8(*) dp = STR_HEAD(s);
 
+    const REBLEN low = little_endian ? 0 : 1;  // offset of an ASCII unit's byte
+
+    bp = src;
+    while (bp != tail) {
+        if (tail - bp >= 8) {
+            uint64_t w;
+            memcpy(&w, bp, 8);
+            if ((w & non_ascii) == 0 and (not crlf_to_lf or not memchr(bp, CR, 8))) {
+                Byte* out = cast(Byte*, dp);
+                out[0] = bp[low];
+                out[1] = bp[2 + low];
+                out[2] = bp[4 + low];
+                out[3] = bp[6 + low];
+                if (not (out[0] and out[1] and out[2] and out[3]))
+                    fail (Error_Illegal_Zero_Byte_Raw());
+                dp = cast(Utf8(*), out + 4);
+                bp += 8;
+                continue;
+            }
+        }
+
+        Codepoint c = Utf16_Next_Codepoint(&bp, tail, little_endian);
+        if (crlf_to_lf and c == CR) {
+            if (bp != tail and Utf16_Unit_At(bp, little_endian) == LF)
+                continue;
+            c = LF;
+        }
         dp = WRITE_CHR(dp, c);
-        ++num_chars;
     }
 
-    // !!! The ascii flag should be preserved in the series node for faster
-    // operations on UTF-8
-    //
-    UNUSED(ascii);
-
-    TERM_STR_LEN_SIZE(s, num_chars, dp - STR_HEAD(s));
+    assert(cast(Size, dp - STR_HEAD(s)) == size);
+    TERM_STR_LEN_SIZE(s, num_chars, size);
     return s;
 }
 
@@ -215,42 +293,72 @@ DECLARE_NATIVE(encode_text)
 }
 
 
-static REBSER *Encode_Utf16(
+// Encoding to UTF-16 can't fail, but codepoints above 0xFFFF need a pair of
+// units.  So the first pass is only to count those, and is skipped when the
+// string is known to be ASCII.
+//
+static Binary(*) Encode_Utf16(
     Utf8(const*) data,
+    Size size,
     REBLEN len,
     bool little_endian
 ){
-    Utf8(const*) cp = data;
+    const Byte* bp = cast(const Byte*, data);
+    const Byte* tail = bp + size;
+
+    REBLEN units = len;
+    if (size != len) {  // not all ASCII, look for 4-byte UTF-8 sequences
+        const Byte* scan = bp;
+        for (; scan != tail; ++scan) {
+            if (*scan >= 0xF0)
+                ++units;
+        }
+    }
 
-    Binary(*) bin = Make_Binary(sizeof(uint16_t) * len);
-    uint16_t* up = cast(uint16_t*, BIN_HEAD(bin));
+    Binary(*) bin = Make_Binary(sizeof(uint16_t) * units);
+    Byte* out = BIN_HEAD(bin);
+
+    const REBLEN low = little_endian ? 0 : 1;  // which byte of a unit is low
+
+    while (bp != tail) {
+        if (tail - bp >= 8) {
+            uint64_t w;
+            memcpy(&w, bp, 8);
+            if ((w & 0x8080808080808080ULL) == 0) {  // 8 ASCII bytes
+                int i;
+                for (i = 0; i < 8; ++i) {
+                    out[low] = bp[i];
+                    out[1 - low] = 0;
+                    out += 2;
+                }
+                bp += 8;
+                continue;
+            }
+        }
 
-    REBLEN i = 0;
-    for (i = 0; i < len; ++i) {
         Codepoint c;
-        cp = NEXT_CHR(&c, cp);
-
-        // !!! TBD: handle large codepoints bigger than 0xffff, and encode
-        // as UTF16.
+        bp = cast(const Byte*, NEXT_CHR(&c, cast(Utf8(const*), bp)));
 
-      #if defined(ENDIAN_LITTLE)
-        if (little_endian)
-            up[i] = c;
-        else
-            up[i] = ((c & 0xff) << 8) | ((c & 0xff00) >> 8);
-      #elif defined(ENDIAN_BIG)
-        if (little_endian)
-            up[i] = ((c & 0xff) << 8) | ((c & 0xff00) >> 8);
+        REBWCHAR pair[2];
+        REBLEN n = 1;
+        if (c >= 0x10000) {
+            Encode_UTF16_Pair(c, pair);
+            n = 2;
+        }
         else
-            up[i] = c;
-      #else
-        #error "Unsupported CPU endian"
-      #endif
-    }
+            pair[0] = c;
 
-    up[i] = '\0'; // needs two bytes worth of NULL, not just one.
+        REBLEN i;
+        for (i = 0; i < n; ++i) {
+            out[low] = pair[i] & 0xFF;
+            out[1 - low] = pair[i] >> 8;
+            out += 2;
+        }
+    }
 
-    SET_SERIES_LEN(bin, len * sizeof(uint16_t));
+    assert(out == BIN_HEAD(bin) + sizeof(uint16_t) * units);
+    out[0] = out[1] = '\0';  // two bytes of terminator, for wide C strings
+    SET_SERIES_LEN(bin, sizeof(uint16_t) * units);
     return bin;
 }
 
@@ -296,15 +404,7 @@ DECLARE_NATIVE(decode_utf16le)
     const Byte* data = VAL_BINARY_SIZE_AT(&size, ARG(data));
 
     const bool little_endian = true;
-    Init_Text(OUT, Decode_UTF16(data, size, little_endian, false));
-
-    // Drop byte-order marker, if present
-    //
-    rebElide("if #\"^(FEFF)\" = first", OUT, "[",
-        "take", OUT,
-    "]");
-
-    return OUT;
+    return Init_Text(OUT, Decode_UTF16(data, size, little_endian, false));
 }
 
 
@@ -322,10 +422,11 @@ DECLARE_NATIVE(encode_utf16le)
     UTF_INCLUDE_PARAMS_OF_ENCODE_UTF16LE;
 
     REBLEN len;
-    Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, nullptr, ARG(text));
+    Size size;
+    Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, ARG(text));
 
     const bool little_endian = true;
-    Init_Binary(OUT, Encode_Utf16(utf8, len, little_endian));
+    Init_Binary(OUT, Encode_Utf16(utf8, size, len, little_endian));
 
     // !!! Should probably by default add a byte order mark, but given this
     // is weird "userspace" encoding it should be an option to the codec.
@@ -376,15 +477,7 @@ DECLARE_NATIVE(decode_utf16be)
     const Byte* data = VAL_BINARY_SIZE_AT(&size, ARG(data));
 
     const bool little_endian = false;
-    Init_Text(OUT, Decode_UTF16(data, size, little_endian, false));
-
-    // Drop byte-order marker, if present
-    //
-    rebElide(
-        "if #\"^(FEFF)\" = first", OUT, "[take", OUT, "]"
-    );
-
-    return OUT;
+    return Init_Text(OUT, Decode_UTF16(data, size, little_endian, false));
 }
 
 
@@ -402,10 +495,11 @@ DECLARE_NATIVE(encode_utf16be)
     UTF_INCLUDE_PARAMS_OF_ENCODE_UTF16BE;
 
     REBLEN len;
-    Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, nullptr, ARG(text));
+    Size size;
+    Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, ARG(text));
 
     const bool little_endian = false;
-    Init_Binary(OUT, Encode_Utf16(utf8, len, little_endian));
+    Init_Binary(OUT, Encode_Utf16(utf8, size, len, little_endian));
 
     // !!! Should probably by default add a byte order mark, but given this
     // is weird "userspace" encoding it should be an option to the codec.
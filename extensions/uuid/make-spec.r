@@ -19,7 +19,7 @@ depends: maybe switch system-config/os-base [
 
 libraries: maybe switch system-config/os-base [
     'Windows [
-        [%rpcrt4]
+        [%rpcrt4 %bcrypt]
     ]
 ]
 ldflags: maybe switch system-config/os-base [
@@ -28,17 +28,26 @@
 #if TO_WINDOWS
   #ifdef _MSC_VER
     #pragma comment(lib, "rpcrt4.lib")
+    #pragma comment(lib, "bcrypt.lib")
   #endif
 
     #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
     #include <windows.h>
     #include <rpc.h>  // for UuidCreate()
+    #include <bcrypt.h>  // for BCryptGenRandom()
 #elif TO_OSX
     #include <CoreFoundation/CFUUID.h>
+    #include <stdlib.h>  // arc4random_buf()
+    #include <sys/time.h>  // gettimeofday()
+    #include <unistd.h>  // getpid()
 #else
     #include <uuid.h>
+    #include "randutils.h"  // random_get_bytes(), from the bundled libuuid
+    #include <sys/time.h>  // gettimeofday()
+    #include <unistd.h>  // getpid()
 #endif
 
+#include <stdint.h>
 #include <string.h>  // memcpy
 
 // CoreFoundation has definitions that conflict with %sys-core.h, so the UUID
@@ -53,23 +62,12 @@
 #include "tmp-mod-uuid.h"
 
 
+// Get a UUID from the platform's own generator (the historical behavior).
 //
-//  generate: native [
-//
-//  "Generate a UUID"
-//
-//      return: [binary!]
-//  ]
-//
-DECLARE_NATIVE(generate)
+static void Generate_Platform_Uuid(unsigned char *bp)
 {
-    UUID_INCLUDE_PARAMS_OF_GENERATE;
-
   #if TO_WINDOWS
 
-    REBVAL *binary = rebUninitializedBinary_internal(16);
-    unsigned char* bp = rebBinaryHead_internal(binary);
-
     UUID uuid;  // uuid.data* is little endian, string form is big endian
     UuidCreate(&uuid);
 
@@ -86,50 +84,207 @@ DECLARE_NATIVE(generate)
 
     memcpy(bp + 8, uuid.Data4, 8);
 
-    return binary;
-
   #elif TO_OSX
 
     CFUUIDRef newId = CFUUIDCreate(NULL);
     CFUUIDBytes bytes = CFUUIDGetUUIDBytes(newId);
     CFRelease(newId);
 
-    unsigned char* buf = (unsigned char*)(rebMalloc(16));
-
-    buf[0] = bytes.byte0;
-    buf[1] = bytes.byte1;
-    buf[2] = bytes.byte2;
-    buf[3] = bytes.byte3;
-    buf[4] = bytes.byte4;
-    buf[5] = bytes.byte5;
-    buf[6] = bytes.byte6;
-    buf[7] = bytes.byte7;
-    buf[8] = bytes.byte8;
-    buf[9] = bytes.byte9;
-    buf[10] = bytes.byte10;
-    buf[11] = bytes.byte11;
-    buf[12] = bytes.byte12;
-    buf[13] = bytes.byte13;
-    buf[14] = bytes.byte14;
-    buf[15] = bytes.byte15;
-
-    return rebRepossess(buf, 16);
+    bp[0] = bytes.byte0;
+    bp[1] = bytes.byte1;
+    bp[2] = bytes.byte2;
+    bp[3] = bytes.byte3;
+    bp[4] = bytes.byte4;
+    bp[5] = bytes.byte5;
+    bp[6] = bytes.byte6;
+    bp[7] = bytes.byte7;
+    bp[8] = bytes.byte8;
+    bp[9] = bytes.byte9;
+    bp[10] = bytes.byte10;
+    bp[11] = bytes.byte11;
+    bp[12] = bytes.byte12;
+    bp[13] = bytes.byte13;
+    bp[14] = bytes.byte14;
+    bp[15] = bytes.byte15;
 
   #elif TO_LINUX
 
-    REBVAL *binary = rebUninitializedBinary_internal(16);
-    unsigned char* bp = rebBinaryHead_internal(binary);
-
     uuid_t uuid;
     uuid_generate(uuid);
 
     memcpy(bp, uuid, sizeof(uuid));
 
-    return binary;
-
   #else
 
+    UNUSED(bp);
     rebJumps ("fail {UUID is not implemented}");
 
   #endif
 }
+
+
+//=//// BUFFERED RANDOM BYTES /////////////////////////////////////////////=//
+//
+// Making many UUIDs one OS call at a time spends most of its time in the
+// calls.  So GENERATE/COUNT reads the OS's cryptographic random source a
+// pool at a time and hands out bytes from that.  Handed-out bytes are wiped
+// from the pool.  A forked child process throws away what it inherited, or
+// it would repeat its parent's UUIDs.
+//
+
+#define RANDOM_POOL_SIZE 4096
+
+static unsigned char Random_Pool[RANDOM_POOL_SIZE];
+static size_t Random_Pool_Left = 0;
+
+#if !TO_WINDOWS
+    static pid_t Random_Pool_Pid = 0;
+#endif
+
+static void Refill_Random_Pool(void)
+{
+  #if TO_WINDOWS
+    if (not BCRYPT_SUCCESS(BCryptGenRandom(
+        NULL,
+        Random_Pool,
+        RANDOM_POOL_SIZE,
+        BCRYPT_USE_SYSTEM_PREFERRED_RNG
+    ))){
+        rebJumps ("fail {BCryptGenRandom() failed}");
+    }
+  #elif TO_OSX
+    arc4random_buf(Random_Pool, RANDOM_POOL_SIZE);
+  #elif TO_LINUX
+    random_get_bytes(Random_Pool, RANDOM_POOL_SIZE);  // getrandom() or urandom
+  #else
+    rebJumps ("fail {No random source for UUIDs on this platform}");
+  #endif
+
+    Random_Pool_Left = RANDOM_POOL_SIZE;
+}
+
+static void Get_Random_Bytes(unsigned char *buf, size_t size)
+{
+    assert(size <= RANDOM_POOL_SIZE);
+
+  #if !TO_WINDOWS
+    if (Random_Pool_Pid != getpid()) {
+        Random_Pool_Pid = getpid();
+        Random_Pool_Left = 0;
+    }
+  #endif
+
+    if (size > Random_Pool_Left)
+        Refill_Random_Pool();
+
+    unsigned char *pool = Random_Pool + (RANDOM_POOL_SIZE - Random_Pool_Left);
+    memcpy(buf, pool, size);
+    memset(pool, 0, size);
+    Random_Pool_Left -= size;
+}
+
+
+//=//// UUID VERSIONS 4 AND 7 /////////////////////////////////////////////=//
+//
+// Version 4 is all random bits besides the version and variant.  Version 7
+// (RFC 9562) starts with 48 bits of Unix time in milliseconds, so UUIDs made
+// later sort later, and database indexes on them get appended to instead of
+// written all over.  The 12 bits after the version are a counter for UUIDs
+// made in the same millisecond, which starts at a random point with room to
+// count up.  If it runs out the time is advanced by a millisecond, so the
+// order holds even if the clock is set back.
+//
+
+static uint64_t Last_V7_Millis = 0;
+static unsigned int V7_Counter = 0;  // 12 bits
+
+static uint64_t Get_Unix_Millis(void)
+{
+  #if TO_WINDOWS
+    FILETIME ft;  // 100 nanosecond intervals since 1-Jan-1601
+    GetSystemTimeAsFileTime(&ft);
+    uint64_t t = (cast(uint64_t, ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    return (t - 116444736000000000ULL) / 10000;
+  #else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return cast(uint64_t, tv.tv_sec) * 1000 + tv.tv_usec / 1000;
+  #endif
+}
+
+static void Make_Uuid_V4(unsigned char *bp)
+{
+    Get_Random_Bytes(bp, 16);
+    bp[6] = 0x40 | (bp[6] & 0x0F);  // version 4
+    bp[8] = 0x80 | (bp[8] & 0x3F);  // RFC variant
+}
+
+static void Make_Uuid_V7(unsigned char *bp)
+{
+    Get_Random_Bytes(bp + 6, 10);
+
+    uint64_t millis = Get_Unix_Millis();
+    if (millis > Last_V7_Millis) {
+        Last_V7_Millis = millis;
+        V7_Counter = ((bp[6] << 8) | bp[7]) & 0x07FF;  // top half is headroom
+    }
+    else if (++V7_Counter > 0x0FFF) {
+        ++Last_V7_Millis;
+        V7_Counter = 0;
+    }
+
+    int i;
+    for (i = 0; i < 6; ++i)  // big endian
+        bp[i] = cast(unsigned char, Last_V7_Millis >> (8 * (5 - i)));
+
+    bp[6] = 0x70 | (V7_Counter >> 8);  // version 7
+    bp[7] = V7_Counter & 0xFF;
+    bp[8] = 0x80 | (bp[8] & 0x3F);  // RFC variant
+}
+
+
+//
+//  generate: native [
+//
+//  "Generate a UUID"
+//
+//      return: "16 bytes, or 16 bytes for each UUID with /COUNT"
+//          [binary!]
+//      /count "Make this many at once, back to back in one BINARY!"
+//          [integer!]
+//      /v7 "Make time-ordered version 7 UUIDs"
+//  ]
+//
+DECLARE_NATIVE(generate)
+//
+// Plain GENERATE uses the platform's UUID generator.  With /COUNT the UUIDs
+// are version 4 (or 7 with /V7) made from the buffered random pool.
+{
+    UUID_INCLUDE_PARAMS_OF_GENERATE;
+
+    const void *count_arg = rebArgR("count");
+    bool v7 = (rebArgR("v7") != NULL);
+
+    if (not count_arg and not v7) {
+        REBVAL *binary = rebUninitializedBinary_internal(16);
+        Generate_Platform_Uuid(rebBinaryHead_internal(binary));
+        return binary;
+    }
+
+    intptr_t count = count_arg ? rebUnboxInteger(count_arg) : 1;
+    if (count < 0)
+        rebJumps ("fail {GENERATE/COUNT can't be negative}");
+
+    REBVAL *binary = rebUninitializedBinary_internal(count * 16);
+    unsigned char *bp = rebBinaryHead_internal(binary);
+
+    intptr_t n;
+    for (n = 0; n < count; ++n, bp += 16) {
+        if (v7)
+            Make_Uuid_V7(bp);
+        else
+            Make_Uuid_V4(bp);
+    }
+
+    return binary;
+}
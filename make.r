@@ -910,6 +910,15 @@ targets: [
             ]
         ]
     ]
+    'bench [
+        rebmake/execution/run make rebmake/solution-class [
+            depends: flatten reduce [
+                vars
+                t-folders
+                bench-app
+            ]
+        ]
+    ]
     'all 'execution [
         rebmake/execution/run make rebmake/solution-class [
             depends: flatten reduce [
@@ -1427,6 +1436,20 @@ main: make libr3-core [
     ]
 ]
 
+; The C microbenchmarks use internals, so are compiled like the core (not
+; like %main.c, which only uses the API).
+;
+bench-main: make libr3-core [
+    name: 'bench-main
+
+    includes: copy libr3-core/includes
+    cflags: copy libr3-core/cflags
+
+    depends: reduce [
+        gen-obj/dir file-base/bench (join src-dir %main/)
+    ]
+]
+
 pthread: make rebmake/ext-dynamic-class [
     output: %pthread
     flags: [static]
@@ -1490,7 +1513,8 @@ for-each [category entries] file-base [
     switch kind of entries [
         word!  ; if bootstrap
         tuple! [  ; if generic-tuple enabled
-            assert [entries = 'main.c]  ; !!! anomaly, ignore it for now
+            ; !!! anomalies, ignore them for now
+            assert [any [entries = 'main.c, entries = 'bench-core.c]]
         ]
         block! [
             for-each entry entries [
@@ -1990,6 +2014,18 @@ app: make rebmake/application-class [
     definitions: app-config/definitions
 ]
 
+bench-app: make app [
+    name: 'r3-bench
+    output: %r3-bench
+    depends: compose [
+        (libr3-core)
+        (spread builtin-ext-objlibs)
+        (spread app-config/libraries)
+        (bench-main)
+    ]
+    post-build-commands: null  ; keep symbols, for use with profilers
+]
+
 ; Now that app is created, make it a dependency of all the dynamic libs
 ; See `accept` method handling of #application for pulling in import lib
 ;
@@ -2047,6 +2083,9 @@ clean: make rebmake/entry-class [
             file: join %r3 rebmake/target-platform/exe-suffix
         ]
         make rebmake/cmd-delete-class [file: %libr3.*]
+        make rebmake/cmd-delete-class [
+            file: join %r3-bench rebmake/target-platform/exe-suffix
+        ]
     ]
 ]
 
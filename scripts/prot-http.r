@@ -103,11 +103,147 @@ make-http-request: func [
     return result
 ]
 
+; Connections whose response said they could be kept alive are pooled when
+; the HTTP port is closed, keyed by scheme, host and port-id.  The next OPEN
+; to the same place takes the most recently used one.  Each key has a BLOCK!
+; of [connection idle-since] pairs, oldest first.
+;
+; The server may close an idle connection any time it likes, so a request
+; that fails on a reused connection is retried once on a new one.
+;
+connection-pool: make map! []
+
+pool-settings: make object! [
+    max-idle-per-host: 4  ; more than this and the oldest is closed
+    idle-timeout: 0:00:15  ; don't reuse connections idle longer than this
+]
+
+pool-key: lambda [spec [object!]] [
+    unspaced [spec.scheme "://" spec.host ":" spec.port-id]
+]
+
+take-pooled-connection: func [
+    return: [<opt> port!]
+    spec [object!]
+    <local> idle since conn
+][
+    idle: select connection-pool pool-key spec else [return null]
+    while [not empty? idle] [
+        since: take/last idle
+        conn: take/last idle
+        all [
+            pool-settings.idle-timeout > difference now/precise since
+            open? conn
+        ] then [
+            return conn
+        ]
+        close conn
+    ]
+    return null
+]
+
+release-connection: func [
+    {Put an HTTP port's connection in the pool instead of closing it}
+    return: <none>
+    port [port!]
+    <local> key idle
+][
+    key: pool-key port.spec
+    idle: select connection-pool key else [
+        connection-pool.(key): copy []
+    ]
+    while [(length of idle) >= (2 * pool-settings.max-idle-per-host)] [
+        close take idle
+        take idle
+    ]
+    port.state.connection.locals: null
+    append idle spread reduce [port.state.connection now/precise]
+]
+
+open-connection: func [
+    {Set PORT.STATE.CONNECTION to a pooled connection, or a new one}
+    return: <none>
+    port [port!]
+    <local> conn
+][
+    if conn: take-pooled-connection port.spec [
+        conn.locals: port
+        port.state.connection: conn
+        port.state.reused: true
+        return none
+    ]
+    port.state.connection: conn: make port! compose [
+        scheme: (
+            either port.spec.scheme = 'http [the 'tcp][the 'tls]
+        )
+        host: port.spec.host
+        port-id: port.spec.port-id
+        ref: join tcp:// spread reduce [host ":" port-id]
+    ]
+    conn.locals: port
+    open conn
+    connect conn
+    port.state.reused: false
+]
+
+keep-alive?: func [
+    {After a response is read, can its connection be used for another?}
+    return: [logic?]
+    port [port!]
+    <local> state info headers token
+][
+    state: port.state
+    info: state.info
+    headers: info.headers
+
+    if state.mode <> <ready> [return false]
+    if not empty? any [state.connection.data, #{}] [
+        return false  ; more data than the response framing accounted for
+    ]
+
+    ; HTTP/1.1 connections persist unless `Connection: close`, while HTTP/1.0
+    ; ones only persist if the server says `Connection: keep-alive`.
+    ;
+    token: any [
+        all [headers, headers.connection, lowercase form headers.connection]
+        ""
+    ]
+    if find/match info.response-line "HTTP/1.1" [
+        if token = "close" [return false]
+    ] else [
+        if token <> "keep-alive" [return false]
+    ]
+
+    ; The end of the body has to be known without the server closing.
+    ;
+    return did any [
+        port.spec.method = 'HEAD
+        find [no-content not-modified] info.response-parsed
+        headers.transfer-encoding = "chunked"
+        integer? headers.content-length
+    ]
+]
+
+retry-request: func [
+    {DO-REQUEST, but if a pooled connection turns out to be dead use a new one}
+    return: [<opt> binary! block!]
+    port [port!]
+][
+    return do-request port except e -> [
+        if not port.state.reused [return raise e]
+        net-log/C "pooled connection failed, retrying on a new one"
+        attempt [close port.state.connection]
+        port.state.mode: <ready>
+        open-connection port
+        do-request port except e -> [return raise e]
+    ]
+]
+
 do-request: function [
     {Synchronously process an HTTP request on a port}
 
     return: "Result of the request (BLOCK! for HEAD requests, BINARY! read...)"
-        [binary! block!]
+        [<opt> binary! block!]  ; null if body is left to READ-BODY-PART
     port [port!]
 ][
     spec: port.spec
@@ -125,24 +261,34 @@ do-request: function [
     ] spec.headers
 
     port.state.mode: <doing-request>
+    port.state.keep-alive: false
+    port.state.body-done: false
 
     info.headers: info.response-line: info.response-parsed: port.data:
     info.size: info.date: info.name: null
     req: (make-http-request spec.method any [spec.path %/]
         spec.headers spec.content)
 
-    write port.state.connection req
+    write port.state.connection req except e -> [return raise e]
     port.state.mode: <reading-headers>
 
     read port.state.connection  ; read some data from the TCP port
+    if empty? any [port.state.connection.data, #{}] [
+        return raise make-http-error "Server closed connection"
+    ]
     until [
         check-response port except e -> [return raise e]  ; see if it was enough
         ; if not it asks for more
-        (port.state.mode = <ready>) or (port.state.mode = <close>)
+        find [<ready> <close> <streaming>] port.state.mode
     ]
 
     net-log/C as text! req  ; Note: may contain CR (can't use TO TEXT!)
 
+    if port.state [
+        if port.state.mode = <streaming> [return null]
+        port.state.keep-alive: keep-alive? port
+    ]
+
     if port.state and (port.spec.method = 'HEAD) [
         ;
         ; !!! Is the name always guaranteed to be non-NULL?  The size and date
@@ -298,8 +444,9 @@ check-response: function [
         ]
 
         'ok [
-            if spec.method = 'HEAD [
-                state.mode: <ready>
+            case [
+                spec.method = 'HEAD [state.mode: <ready>]
+                state.streaming [start-streaming port]
             ] else [
                 read-body port
             ]
@@ -388,6 +535,7 @@ http-response-headers: context [
     Content-Length: null
     Transfer-Encoding: null
     Last-Modified: null
+    Connection: null
 ]
 
 do-redirect: func [
@@ -578,6 +726,131 @@ read-body: function [
     ]
 ]
 
+; With READ/PART on an OPEN'd HTTP port, the body of a successful response
+; isn't gathered in PORT.DATA.  Each READ/PART gives back the next piece of
+; it, so a large download can be written to a file (or fed to a streaming
+; decompressor) as it arrives:
+;
+;     port: open http://example.com/huge.iso
+;     while [data: read/part port 65536] [write/append %huge.iso data]
+;     close port
+;
+; Only what's asked for is read from the connection, so a slow consumer
+; leaves data in the OS socket buffer and TCP flow control slows the sender.
+;
+start-streaming: func [
+    return: <none>
+    port [port!]
+    <local> headers
+][
+    headers: port.state.info.headers
+    port.state.chunk-left: 0  ; 0 means next is a chunk size line
+    port.state.body-left: all [  ; ignored if chunked
+        integer? headers.content-length
+        headers.content-length
+    ]
+    port.state.mode: <streaming>
+]
+
+read-more: func [
+    {READ the connection, failing if the server closed it instead}
+    return: <none>
+    conn [port!]
+    <local> before
+][
+    before: length of any [conn.data, #{}]
+    read conn
+    if before = length of any [conn.data, #{}] [
+        fail make-http-error "Server closed connection"
+    ]
+]
+
+finish-streaming: func [
+    return: [<opt>]
+    port [port!]
+][
+    port.state.mode: <ready>
+    port.state.body-done: true
+    port.state.keep-alive: keep-alive? port
+    return null
+]
+
+read-body-part: function [
+    {Get up to LIMIT bytes more of a streaming body, null once it's done}
+    return: [<opt> binary!]
+    port [port!]
+    limit [integer!]
+][
+    state: port.state
+    headers: state.info.headers
+    conn: state.connection
+
+    if limit <= 0 [fail make-http-error "READ/PART needs a positive length"]
+
+    if headers.transfer-encoding = "chunked" [
+        if state.chunk-left = 0 [
+            while [didn't parse3 any [conn.data, #{}] [
+                copy chunk-size: some hex-digits, thru crlfbin
+                mk1: <here>, to <end>
+            ]][
+                read-more conn
+            ]
+            remove/part conn.data mk1
+
+            if odd? length of chunk-size [  ; see READ-BODY
+                insert chunk-size #0
+            ]
+            chunk-size: debin [be +] (debase/base as text! chunk-size 16)
+
+            if chunk-size = 0 [  ; trailer, then the blank line ending it
+                while [didn't parse3 conn.data [
+                    crlfbin (trailer: null) to <end>
+                        |
+                    copy trailer to crlf2bin to <end>
+                ]][
+                    read-more conn
+                ]
+                if trailer [
+                    append headers spread scan-net-header as binary! trailer
+                ]
+                clear conn.data
+                return finish-streaming port
+            ]
+            state.chunk-left: chunk-size
+        ]
+
+        if empty? conn.data [read-more conn]
+        data: take/part conn.data (min limit state.chunk-left)
+        state.chunk-left: state.chunk-left - length of data
+        if state.chunk-left = 0 [  ; the chunk's data is followed by CR LF
+            while [(length of conn.data) < 2] [read-more conn]
+            remove/part conn.data 2
+        ]
+        return data
+    ]
+
+    if state.body-left [
+        if state.body-left = 0 [return finish-streaming port]
+
+        if empty? any [conn.data, #{}] [read-more conn]
+        data: take/part conn.data (min limit state.body-left)
+        state.body-left: state.body-left - length of data
+        return data
+    ]
+
+    ; No framing: the body is everything until the server closes.
+    ;
+    if empty? any [conn.data, #{}] [
+        read conn
+        if empty? any [conn.data, #{}] [
+            state.mode: <close>
+            state.body-done: true
+            return null
+        ]
+    ]
+    return take/part conn.data limit
+]
+
 hex-digits: charset "1234567890abcdefABCDEF"
 sys.util.make-scheme [
     name: 'http
@@ -601,12 +874,37 @@ sys.util.make-scheme [
 
     actor: [
         read: func [
-            return: [binary!]
+            return: [<opt> binary! block!]
             port [port!]
+            /part "Stream the body of an OPEN'd port, null after its end"
+                [integer!]
             /lines
             /string
             <local> data
         ][
+            if part [
+                if not all [port.state, open? port] [
+                    cause-error 'Access 'not-open port.spec.ref
+                ]
+                if port.state.body-done [return null]
+                if port.state.mode = <ready> [  ; request not sent yet
+                    port.state.streaming: true
+                    data: retry-request port except e -> [
+                        port.state.streaming: false
+                        return raise e
+                    ]
+                    port.state.streaming: false
+                    if port.state.mode <> <streaming> [  ; e.g. 204, 304
+                        port.state.body-done: true
+                        return data
+                    ]
+                ]
+                if port.state.mode <> <streaming> [
+                    fail make-http-error "Port not ready"
+                ]
+                return read-body-part port part
+            ]
+
             let close?: false
             if port.state [
                 if not open? port [
@@ -620,7 +918,7 @@ sys.util.make-scheme [
                 close?: true
             ]
 
-            data: do-request port except e -> [return raise e]
+            data: retry-request port except e -> [return raise e]
             assert [find [<ready> <close>] port.state.mode]
 
             if close? [
@@ -669,7 +967,7 @@ sys.util.make-scheme [
             ]
 
             parse-write-dialect port value
-            data: do-request port except e -> [return raise e]
+            data: retry-request port except e -> [return raise e]
             assert [find [<ready> <close>] port.state.mode]
 
             if close? [
@@ -681,7 +979,6 @@ sys.util.make-scheme [
 
         open: func [
             port [port!]
-            <local> conn
         ][
             if port.state [return port]
             if not port.spec.host [
@@ -690,19 +987,15 @@ sys.util.make-scheme [
             port.state: make object! [
                 mode: ~inited~  ; original http confusingly called this "state"
                 connection: ~
+                reused: false  ; connection came from CONNECTION-POOL
+                keep-alive: false  ; can go back to the pool after response
+                streaming: false  ; leave successful body to READ-BODY-PART
+                body-left: null  ; Content-Length left to stream
+                chunk-left: 0  ; bytes left in current chunk when streaming
+                body-done: false  ; READ/PART reached the end of the body
                 info: make port.scheme.info [type: 'file]
             ]
-            port.state.connection: conn: make port! compose [
-                scheme: (
-                    either port.spec.scheme = 'http [the 'tcp][the 'tls]
-                )
-                host: port.spec.host
-                port-id: port.spec.port-id
-                ref: join tcp:// spread reduce [host ":" port-id]
-            ]
-            conn.locals: port
-            open conn
-            connect conn
+            open-connection port
             port.state.mode: <ready>
 
             return port
@@ -744,7 +1037,11 @@ sys.util.make-scheme [
                 ]
             ]
 
-            close state.connection
+            if state.keep-alive and (state.mode = <ready>) [
+                release-connection port
+            ] else [
+                close state.connection
+            ]
             port.state: null
             return port
         ]
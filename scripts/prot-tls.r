@@ -65,7 +65,6 @@ REBOL [
         https://tools.ietf.org/html/rfc7568
     }
     Todo: {
-        - cached sessions
         - automagic cert data lookup
         - add more cipher suites
         - server role support
@@ -395,6 +394,10 @@ parse-asn: func [
 ; dialect that is easily validated and transformed into a MAP!.  ISSUE!
 ; represents a state that can be final, and a TAG! represents a state that may
 ; move to the competed state.
+;
+; When a session is resumed, the server skips from <server-hello> right to its
+; ChangeCipherSpec and Finished, and the client answers with its own after.
+; (See SESSION CACHE below.)
 
 make-state-updater: func [
     return: [activation!]
@@ -435,10 +438,19 @@ make-state-updater: func [
 
 update-read-state: make-state-updater 'read [
     <client-hello>          -> <server-hello>
-    <server-hello>          -> <certificate>
+    <server-hello>          -> [
+                                <certificate>
+                                <new-session-ticket>  ; resumed session
+                                <change-cipher-spec>  ; resumed session
+                            ]
     <certificate>           -> [#server-hello-done <server-key-exchange>]
     <server-key-exchange>   -> #server-hello-done
-    <finished>              -> [<change-cipher-spec> #alert]
+    <finished>              -> [
+                                <new-session-ticket>
+                                <change-cipher-spec>
+                                #alert
+                            ]
+    <new-session-ticket>    -> <change-cipher-spec>
     <change-cipher-spec>    -> #encrypted-handshake
     #encrypted-handshake    -> #application
     #application            -> [#application #alert]
@@ -450,13 +462,62 @@ update-write-state: make-state-updater 'write [
     #server-hello-done      -> <client-key-exchange>
     <client-key-exchange>   -> <change-cipher-spec>
     <change-cipher-spec>    -> <finished>
-    #encrypted-handshake    -> #application
+    <finished>              -> #encrypted-handshake  ; resumed session
+    #encrypted-handshake    -> [#application <change-cipher-spec>]
     #application            -> [#application #alert]
     #alert                  -> <close-notify>
     <close-notify>          -> []
 ]
 
 
+=== SESSION CACHE ===
+
+; A full handshake costs the client an RSA encryption or a DH/ECDH key
+; agreement (and the server a private key operation), plus two round trips.
+; If the server agrees, a later connection can "resume" the session instead,
+; reusing its master secret (with fresh randoms, so fresh keys):
+;
+;     ClientHello (cached session ID and/or ticket) -->
+;                                   <-- ServerHello (same session ID)
+;                                   <-- [NewSessionTicket]
+;                                   <-- ChangeCipherSpec, Finished
+;     ChangeCipherSpec, Finished -->
+;
+; A session ID names the session in a cache the server keeps, while a ticket
+; is the session state itself, encrypted with a key only the server knows:
+;
+; https://tools.ietf.org/html/rfc5246#section-7.3
+; https://tools.ietf.org/html/rfc5077
+;
+; Sessions are remembered per host and port for as long as Rebol runs.  If a
+; server has forgotten one it just does a full handshake, which replaces it.
+
+session-cache: make map! []
+
+remember-session: func [
+    return: <none>
+    ctx [object!]
+][
+    if all [empty? ctx.session-id, not ctx.session-ticket] [
+        return none  ; server gave no way to resume this session
+    ]
+    session-cache.(ctx.session-key): make object! [
+        session-id: ctx.session-id
+        ticket: ctx.session-ticket
+        master-secret: ctx.master-secret
+        suite: ctx.suite
+        version: ctx.version
+    ]
+]
+
+forget-session: func [
+    return: <none>
+    ctx [object!]
+][
+    session-cache.(ctx.session-key): void
+]
+
+
 === TLS PROTOCOL CODE ===
 
 client-hello: func [
@@ -512,6 +573,27 @@ client-hello: func [
     random/seed now/time/precise
     repeat 28 [append ctx.client-random (random-secure 256) - 1]
 
+    ; Offer the session from the last connection to this host, if any.  When
+    ; there's only a ticket, a random session ID is sent with it...because the
+    ; server signals it accepted the ticket by echoing the ID back:
+    ;
+    ; https://tools.ietf.org/html/rfc5077#section-3.4
+    ;
+    ctx.cached-session: select session-cache ctx.session-key
+    ctx.session-ticket: all [ctx.cached-session, ctx.cached-session.ticket]
+    ctx.session-id: case [
+        not ctx.cached-session [#{}]
+        not empty? ctx.cached-session.session-id [
+            ctx.cached-session.session-id
+        ]
+        true [
+            let id: make binary! 32
+            repeat 32 [append id (random-secure 256) - 1]
+            id
+        ]
+    ]
+    ctx.resumed?: false
+
     let cs-data: make binary! map-each item cipher-suites [
         maybe match binary! item
     ]
@@ -520,7 +602,8 @@ client-hello: func [
       ClientHello:  ; https://tools.ietf.org/html/rfc5246#section-7.4.1.2
         max-ver-bytes               ; max supported version by client
         ctx.client-random           ; 4 bytes gmt unix time + 28 random bytes
-        #{00}                       ; session ID length
+        to-1bin length of ctx.session-id  ; session ID length
+        ctx.session-id              ; empty unless resuming a session
         to-2bin length of cs-data   ; cipher suites length
         cs-data                     ; cipher suites list
 
@@ -647,14 +730,23 @@ client-hello: func [
         change extension_length to-2bin (length of PointsFormat)
     ]
 
-    ; These extensions are commonly sent by OpenSSL or browsers, so turning
-    ; them on might be a good first step with a server rejecting ClientHello
-    ; that seems to work in curl/wget.
+    ; https://tools.ietf.org/html/rfc5077#section-3.2
+    ; Sending the ticket of the cached session asks to resume it.  An empty
+    ; one asks the server to send us a ticket for next time.
+    ;
+    let ticket: any [ctx.session-ticket, #{}]
+    emit ctx [
+        #{00 23}                    ; extension type (SessionTicket=35)
+        to-2bin length of ticket    ; extension length
+        ticket                      ; opaque ticket
+    ]
+
+    ; This extension is commonly sent by OpenSSL or browsers, so turning it
+    ; on might be a good first step with a server rejecting ClientHello that
+    ; seems to work in curl/wget.
     ;
     comment [
         emit ctx [
-            #{00 23 00 00}  ; SessionTicket TLS
-
             #{00 0f 00 01 01}  ; heartbeat
         ]
     ]
@@ -748,6 +840,18 @@ client-key-exchange: func [
     ;
     make-master-secret ctx ctx.pre-master-secret
 
+    make-record-ciphers ctx
+
+    append ctx.handshake-messages ssl-record
+]
+
+
+make-record-ciphers: func [
+    {Derive the keys from the master secret, and make the record ciphers}
+
+    return: <none>
+    ctx [object!]
+][
     make-key-block ctx
 
     ; update keys
@@ -768,13 +872,25 @@ client-key-exchange: func [
             ;
             ; Each encrypted message in TLS 1.1 and above carry a plaintext
             ; initialization vector, so the ctx does not use one for the whole
-            ; session.  Poison session vectors to make sure they're unused.
+            ; session.  (TLS-CIPHER takes BLANK! to mean that.)
             ;
-            ctx.client-iv: ctx.server-iv: ~per-message~
+            ctx.client-iv: ctx.server-iv: _
         ]
     ]
 
-    append ctx.handshake-messages ssl-record
+    ; The record layer (MAC, padding, encryption, sequence numbers) is done
+    ; natively.  Sequence numbers start at zero with the first record sent
+    ; after each side's ChangeCipherSpec, which is the first use of these.
+    ;
+    if ctx.crypt-method <> @aes [
+        fail ["Unsupported TLS crypt-method:" ctx.crypt-method]
+    ]
+    ctx.write-cipher: tls-cipher
+        ctx.hash-method ctx.client-mac-key ctx.client-crypt-key
+        ctx.ver-bytes ctx.client-iv
+    ctx.read-cipher: tls-cipher/decrypt
+        ctx.hash-method ctx.server-mac-key ctx.server-crypt-key
+        ctx.ver-bytes ctx.server-iv
 ]
 
 
@@ -796,13 +912,7 @@ encrypted-handshake-msg: func [
     ctx [object!]
     unencrypted [binary!]
 ][
-    let encrypted: encrypt-data/type ctx unencrypted #{16}
-    emit ctx [
-        #{16}                         ; protocol type (22=Handshake)
-        ctx.ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    emit ctx tls-seal ctx.write-cipher 22 unencrypted  ; 22=Handshake
     append ctx.handshake-messages unencrypted
 ]
 
@@ -812,13 +922,9 @@ application-data: func [
     ctx [object!]
     unencrypted [binary! text!]
 ][
-    let encrypted: encrypt-data ctx to binary! unencrypted
-    emit ctx [
-        #{17}                         ; protocol type (23=Application)
-        ctx.ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    ; TLS-SEAL splits data over 16K into multiple records.
+    ;
+    emit ctx tls-seal ctx.write-cipher 23 to binary! unencrypted  ; 23=App
 ]
 
 
@@ -826,13 +932,7 @@ alert-close-notify: func [
     return: <none>
     ctx [object!]
 ][
-    let encrypted: encrypt-data ctx #{0100} ; close notify
-    emit ctx [
-        #{15}                         ; protocol type (21=Alert)
-        ctx.ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    emit ctx tls-seal ctx.write-cipher 21 #{0100}  ; 21=Alert, close notify
 ]
 
 
@@ -870,109 +970,6 @@ finished: func [
 ]
 
 
-encrypt-data: func [
-    return: [binary!]
-    ctx [object!]
-    content [binary!]
-    /type
-        [binary!] "application data is default"
-][
-    type: default [#{17}]  ; #application
-
-    ; GenericBlockCipher: https://tools.ietf.org/html/rfc5246#section-6.2.3.2
-
-    if ctx.version > 1.0 [
-        ;
-        ; "The Initialization Vector (IV) SHOULD be chosen at random, and
-        ;  MUST be unpredictable.  Note that in versions of TLS prior to 1.1,
-        ;  there was no IV field, and the last ciphertext block of the
-        ;  previous record (the "CBC residue") was used as the IV.  This was
-        ;  changed to prevent the attacks described in [CBCATT].  For block
-        ;  ciphers, the IV length is SecurityParameters.record_iv_length,
-        ;  which is equal to the SecurityParameters.block_size."
-        ;
-        ctx.client-iv: copy #{}
-        repeat ctx.block-size [append ctx.client-iv (random-secure 256) - 1]
-    ]
-
-    ; Message Authentication Code
-    ; https://tools.ietf.org/html/rfc5246#section-6.2.3.1
-    ;
-    let MAC: checksum/key ctx.hash-method make binary! [
-        to-8bin ctx.seq-num-w               ; sequence number (64-bit int)
-        type                                ; msg type
-        ctx.ver-bytes                       ; version
-        to-2bin length of content           ; msg content length
-        content                             ; msg content
-    ] ctx.client-mac-key
-
-    let data: join content MAC
-
-    if ctx.block-size [
-        ; add the padding data in CBC mode
-        let padding: ctx.block-size - (
-            remainder (1 + (length of data)) ctx.block-size
-        )
-        let len: 1 + padding
-        append data head of insert/dup make binary! len to-1bin padding len
-    ]
-
-    switch ctx.crypt-method [
-        @aes [
-            ctx.encrypt-stream: default [
-                aes-key ctx.client-crypt-key ctx.client-iv
-            ]
-            data: aes-stream ctx.encrypt-stream data
-
-            if ctx.version > 1.0 [
-                ; encrypt-stream must be reinitialized each time with the
-                ; new initialization vector.
-                ;
-                ctx.encrypt-stream: null
-            ]
-        ]
-    ] else [
-        fail ["Unsupported TLS crypt-method:" ctx.crypt-method]
-    ]
-
-    ; TLS versions 1.1 and above include the client-iv in plaintext.
-    ;
-    if ctx.version > 1.0 [
-        insert data ctx.client-iv
-        unset in ctx 'client-iv  ; avoid accidental reuse
-    ]
-
-    return data
-]
-
-
-decrypt-data: func [
-    return: [binary!]
-    ctx [object!]
-    data [binary!]
-][
-    switch ctx.crypt-method [
-        @aes [
-            ctx.decrypt-stream: default [
-                aes-key/decrypt ctx.server-crypt-key ctx.server-iv
-            ]
-            data: aes-stream ctx.decrypt-stream data
-
-            ; TLS 1.1 and above must use a new initialization vector each time
-            ; so the decrypt stream has to get GC'd.
-            ;
-            if ctx.version > 1.0 [
-                ctx.decrypt-stream: null
-            ]
-        ]
-    ] else [
-        fail ["Unsupported TLS crypt-method:" ctx.crypt-method]
-    ]
-
-    return data
-]
-
-
 parse-protocol: func [
     return: [object!]
     data [binary!]
@@ -990,6 +987,7 @@ parse-protocol: func [
         type: select protocol-types data.1 else [
             fail ["unknown/invalid protocol type:" data.1]
         ]
+        type-byte: data.1  ; needed for record MAC
         version: select bytes-to-version copy/part at data 2 2
         size: debin [be +] copy/part at data 4 2
         messages: copy/part at data 6 size
@@ -1036,6 +1034,7 @@ parse-messages: func [
         0 #hello-request
         1 <client-hello>
         2 <server-hello>
+        4 <new-session-ticket>
         11 <certificate>
         12 <server-key-exchange>
         13 @certificate-request  ; not yet implemented
@@ -1082,27 +1081,10 @@ parse-messages: func [
     let data: proto.messages
 
     if ctx.encrypted? [
-        all [ctx.block-size, ctx.version > 1.0] then [
-            ;
-            ; Grab the server's initialization vector, which will be new for
-            ; each message.
-            ;
-            ctx.server-iv: take/part data ctx.block-size
-        ]
-
-        change data decrypt-data ctx data
-        debug ["decrypting..."]
-
-        if ctx.block-size [
-            ; deal with padding in CBC mode
-            data: copy/part data (
-                ((length of data) - 1) - (last data)
-            )
-            debug ["depadding..."]
-            if ctx.version > 1.0 [
-                unset in ctx 'server-iv  ; avoid reuse in TLS 1.1 and above
-            ]
-        ]
+        ;
+        ; Checks and removes the padding and MAC, so what's left is content.
+        ;
+        proto.messages: data: tls-open ctx.read-cipher proto.type-byte data
         debug ["data:" data]
     ]
     debug [ctx.seq-num-r ctx.seq-num-w "READ <--" proto.type]
@@ -1110,7 +1092,8 @@ parse-messages: func [
     if proto.type <> #handshake [
         if proto.type = #alert [
             if proto.messages.1 > 1 [
-                ; fatal alert level
+                ; fatal alert level, session can't be resumed (RFC 5246 7.2)
+                forget-session ctx
                 fail [select alert-descriptions data.2 else ["unknown"]]
             ]
         ]
@@ -1224,6 +1207,50 @@ parse-messages: func [
                         ]
 
                         ctx.server-random: msg-obj.server-random
+
+                        ; If the server echoed the session ID we offered, it
+                        ; is resuming that session (from its cache, or from
+                        ; the ticket).  Then the next thing it sends is its
+                        ; Finished, so the ciphers are needed now.
+                        ;
+                        ctx.resumed?: did all [
+                            not empty? ctx.session-id
+                            ctx.session-id = msg-obj.session-id
+                        ]
+                        if ctx.resumed? [
+                            let cached: ctx.cached-session
+                            if any [
+                                cached.suite <> ctx.suite
+                                cached.version <> ctx.version
+                            ][
+                                fail "Server resumed TLS session differently"
+                            ]
+                            ctx.master-secret: cached.master-secret
+                            make-record-ciphers ctx
+                        ] else [
+                            ctx.session-id: msg-obj.session-id
+                            ctx.session-ticket: null  ; may get a new one
+                        ]
+                        msg-obj
+                    ]
+
+                    <new-session-ticket> [
+                        ; https://tools.ietf.org/html/rfc5077#section-3.3
+                        ;
+                        let msg-obj: context [
+                            type: msg-type
+                            length: len
+                            lifetime-hint: grab-int 'bin 4  ; seconds, 0=any
+                            ticket-length: grab-int 'bin 2
+                            ticket: grab 'bin ticket-length
+                        ]
+
+                        ; An empty ticket means the server changed its mind.
+                        ;
+                        ctx.session-ticket: all [
+                            not empty? msg-obj.ticket
+                            msg-obj.ticket
+                        ]
                         msg-obj
                     ]
 
@@ -1432,6 +1459,8 @@ parse-messages: func [
 
                         debug "FINISHED MAC verify: OK"
 
+                        remember-session ctx
+
                         context [
                             type: msg-type
                             length: len
@@ -1442,27 +1471,7 @@ parse-messages: func [
 
                 append ctx.handshake-messages copy/part data len + 4
 
-                let skip-amount: either ctx.encrypted? [
-                    let mac: copy/part skip data len + 4 ctx.hash-size
-
-                    let mac-check: checksum/key ctx.hash-method make binary! [
-                        to-8bin ctx.seq-num-r   ; 64-bit sequence number
-                        #{16}                   ; msg type
-                        ctx.ver-bytes           ; version
-                        to-2bin len + 4         ; msg content length
-                        copy/part data len + 4
-                    ] ctx.server-mac-key
-
-                    if mac <> mac-check [
-                        fail "Bad handshake record MAC"
-                    ]
-
-                    4 + ctx.hash-size
-                ][
-                    4
-                ]
-
-                data: skip data (len + skip-amount)
+                data: skip data (len + 4)
             ]
         ]
 
@@ -1474,22 +1483,9 @@ parse-messages: func [
         ]
 
         #application [
-            append result let msg-obj: context [
+            append result context [
                 type: 'app-data
-                content: copy/part data (length of data) - ctx.hash-size
-            ]
-            let len: length of msg-obj.content
-            let mac: copy/part skip data len ctx.hash-size
-            let mac-check: checksum/key ctx.hash-method make binary! [
-                to-8bin ctx.seq-num-r   ; sequence number (64-bit int in R3)
-                #{17}                   ; msg type
-                ctx.ver-bytes           ; version
-                to-2bin len             ; msg content length
-                msg-obj.content         ; content
-            ] ctx.server-mac-key
-
-            if mac <> mac-check [
-                fail "Bad application record MAC"
+                content: data  ; TLS-OPEN already checked and removed the MAC
             ]
         ]
     ]
@@ -1672,7 +1668,15 @@ do-commands: func [
         #application [
             return none  ; at one point returned FALSE, wasn't used
         ]
-        ; Note: Even if state is <finished>, it seems to still want to READ.
+        <finished> [
+            ; The server's Finished came first in a resumed session, so the
+            ; handshake is over.  Otherwise, it's what still needs to be READ.
+            ;
+            if ctx.resumed? [
+                update-write-state ctx #encrypted-handshake
+                return none
+            ]
+        ]
     ]
     perform-read tls-port
 ]
@@ -1877,6 +1881,14 @@ sys.util.make-scheme [
                 ; Used by https://en.wikipedia.org/wiki/Server_Name_Indication
                 host-name: port.spec.host
 
+                ; See SESSION CACHE
+                ;
+                session-key: unspaced [port.spec.host ":" port.spec.port-id]
+                cached-session: null
+                session-id: null
+                session-ticket: null
+                resumed?: false
+
                 mode: null
 
                 suite: null
@@ -1962,8 +1974,8 @@ sys.util.make-scheme [
                 ecdh-keypair: null
                 ecdh-pub: null
 
-                encrypt-stream: null
-                decrypt-stream: null
+                write-cipher: null  ; TLS-CIPHER handles, made with key block
+                read-cipher: null
 
                 connection: null
             ]
@@ -1990,10 +2002,10 @@ sys.util.make-scheme [
             do-commands port [<client-hello>]
 
             if port.state.resp.1.type = #handshake [
-                do-commands port [
-                    <client-key-exchange>
-                    <change-cipher-spec>
-                    <finished>
+                do-commands port either port.state.resumed? [
+                    [<change-cipher-spec> <finished>]
+                ][
+                    [<client-key-exchange> <change-cipher-spec> <finished>]
                 ]
             ]
             return port
@@ -2022,27 +2034,10 @@ sys.util.make-scheme [
             ; data one at a time.  It keeps the progressive state of the
             ; encryption process in the -stream variables, which under the
             ; hood are memory-allocated items stored as a HANDLE!.
+            ; The record cipher handles are GC'd, which frees their state.
             ;
-            ; Calling the encryption functions with BLANK! as the data to
-            ; input will assume you are done, and will free the handle.
-            ;
-            ; !!! Is there a good reason for not doing this with an ordinary
-            ; OBJECT! containing a BINARY! ?
-            ;
-            if port.state.suite [
-                switch port.state.crypt-method [
-                    @aes [
-                        if port.state.encrypt-stream [
-                            port.state.encrypt-stream: null  ; will be GC'd
-                        ]
-                        if port.state.decrypt-stream [
-                            port.state.decrypt-stream: null  ; will be GC'd
-                        ]
-                    ]
-                ] else [
-                    fail ["Unknown TLS crypt-method" port.state.crypt-method]
-                ]
-            ]
+            port.state.write-cipher: null
+            port.state.read-cipher: null
 
             debug "TLS/TCP port closed"
             port.state: null
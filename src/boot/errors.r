@@ -70,6 +70,9 @@ Syntax: [
     no-header:          [{script is missing a REBOL header:} :arg1]
     bad-header:         [{script header is not valid:} :arg1]
     bad-compress:       [{compressed script body is not valid:} :arg1]
+    bad-rebin:          {REBIN serialized data is corrupt or a newer version}
+    bad-json:           [{invalid JSON at byte} :arg1]
+    bad-csv:            [{invalid CSV at byte} :arg1]
     malconstruct:       [{invalid construction spec:} :arg1]
     bad-char:           [{invalid character in:} :arg1]
     needs:              [{this script needs} :arg1 :arg2 {or better to run correctly}]
@@ -145,10 +145,12 @@ intersect: generic [
         logic! integer! char! tuple!  ; math
         any-array! any-string! bitset!  ; sets
         binary!  ; ???
+        map!  ; hashed set of keys, reusable across calls on ANY-ARRAY!
     ]
     /case "Uses case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /sorted "ANY-ARRAY! inputs are SORTed; merge them to a sorted result"
 ]
 
 union: generic [
@@ -172,6 +174,7 @@ union: generic [
     /case "Use case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /sorted "ANY-ARRAY! inputs are SORTed; merge them to a sorted result"
 ]
 
 difference: generic [
@@ -198,6 +201,7 @@ difference: generic [
     /case "Uses case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /sorted "ANY-ARRAY! inputs are SORTed; merge them to a sorted result"
 ]
 
 exclude: generic [
@@ -206,11 +210,12 @@ exclude: generic [
     return: [any-array! any-string! binary! bitset!]
     data "original data"
         [any-array! any-string! binary! bitset!]
-    exclusions "data to exclude from series"
-        [any-array! any-string! binary! bitset!]
+    exclusions "data to exclude from series (MAP! keys for ANY-ARRAY!)"
+        [any-array! any-string! binary! bitset! map!]
     /case "Uses case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /sorted "ANY-ARRAY! inputs are SORTed; merge them to a sorted result"
 ]
 
 
@@ -243,6 +248,7 @@ unique: generic [
     /case "Use case-sensitive comparison (except bitsets)"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /sorted "ANY-ARRAY! inputs are SORTed; merge them to a sorted result"
 ]
 
 absolute: generic [
@@ -411,6 +417,7 @@ copy: generic [
     /part "Limits to a given length or position"
         [any-number! any-series! pair!]
     /deep "Also copies series values within the block"
+    /shared "With /DEEP, copy each series once, keeping aliases (and cycles)"
     ; Once had /TYPES, but that is disabled for now
 ]
 
@@ -533,6 +540,9 @@ sort: generic [
         [any-number! any-series!]
     /all "Compare all fields"
     /reverse "Reverse sort order"
+    /stable "Keep equal items in their original order (implied by /SKIP)"
+    /key "Sort by what a function returns for each item, calling it once per item"
+        [<unrun> action!]
 ]
 
 ; Port actions:
@@ -572,6 +582,12 @@ close: generic [
     port [port!]  ; !!! See Extend_Generics_Someday() for why LIBRARY! works
 ]
 
+flush: generic [
+    {Write out any data a port is holding in a buffer}
+    return: [port!]
+    port [port!]
+]
+
 read: generic [
     {Read from a file, URL, or other port.}
     return: "null on (some) failures (REVIEW as part of port model review)" [
@@ -589,6 +605,9 @@ read: generic [
         [any-number!]
     /string "Convert UTF and line terminators to standard text string"
     /lines "Convert to block of strings (implies /string)"
+    /into "Append data to this buffer instead of the port's (network ports)"
+        [binary!]
+    /mapped "Memory-map the file instead of copying it (gives read-only data)"
 ]
 
 write: generic [
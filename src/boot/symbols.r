@@ -135,6 +135,17 @@ postpone
 crc32
 adler32
 
+; Element types of numbers packed in BINARY! (PACK-NUMBERS, etc.)
+int8
+int16
+int32
+int64
+uint8
+uint16
+uint32
+float32
+float64
+
 ; Codec actions
 identify
 decode
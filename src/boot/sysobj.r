@@ -63,6 +63,7 @@ state: make object! [
         extension: 2.2.2 ; execute only
     ]
     last-error: null ; used by WHY?
+    startup-timings: null  ; [phase seconds ...] pairs, see Startup_Core()
 ]
 
 modules: []
@@ -128,11 +129,15 @@ options: make object! [  ; Options supplied to REBOL during startup
     cgi: false
     no-window: false
     verbose: false
+    startup-profile: false  ; print system.state.startup-timings after boot
 
     binary-base: 16    ; Default base for FORMed binary values (64, 16, 2)
     decimal-digits: 15 ; Max number of decimal digits to print.
+    gc-growth: 0       ; If not 0, percent of live memory to allow before
+                       ; next automatic recycle (instead of fixed ballast)
     module-paths: [%./]
     default-suffix: %.reb ; Used by IMPORT if no suffix is provided
+    module-cache: null  ; Directory for scanned modules, see IMPORT*
     file-types: copy [
         %.reb %.r3 %.r rebol
     ]
@@ -336,12 +341,61 @@ standard: make object! [
         ;
         local-id: null
 
+        ; Set this to true on listening sockets to let several processes (or
+        ; several ports in one process) listen on the same port-id.  The
+        ; kernel then spreads incoming connections across them, e.g. for a
+        ; prefork server.  Uses SO_REUSEPORT, so not available on Windows.
+        ;
+        reuse-port: false
+
         ; This should be set to a function that takes a PORT! on listening
         ; sockets...it will be called when a new connection is made.
         ;
         accept: null
     ]
 
+    port-spec-file: make port-spec-head [
+        ; Size of a buffer that collects WRITEs to an OPEN'd file, to make
+        ; fewer (and larger) writes to the OS.  0 means every WRITE goes
+        ; straight to the OS.  The buffer is written out when it fills, on
+        ; FLUSH, and before any other operation on the port (READ, CLOSE...)
+        ;
+        buffer-size: 0
+
+        ; With a buffer, also write it out after any WRITE with a newline in
+        ; it.  This suits logs, so each line is in the file soon after it's
+        ; written, while still batching lines written close together.
+        ;
+        flush-on-newline: false
+    ]
+
+    port-spec-watch: make port-spec-head [
+        ; Watch everything under a directory, not just its own entries.
+        ; (Not supported by libuv on Linux, where this is ignored.)
+        ;
+        recursive: false
+
+        ; Poll with stat() at this interval (a TIME!, or INTEGER! of msec)
+        ; instead of asking the OS for notifications, e.g. for network
+        ; filesystems which can't provide them.
+        ;
+        interval: null
+    ]
+
+    port-spec-task: make port-spec-head [
+        ; DEFLATE, INFLATE, CRC32, or ADLER32
+        ;
+        job: null
+
+        ; ZLIB or GZIP, as with the /ENVELOPE of DEFLATE and INFLATE
+        ;
+        envelope: null
+
+        ; BINARY! (held while the job runs) or TEXT! (encoded as UTF-8)
+        ;
+        input: null
+    ]
+
     port-spec-signal: make port-spec-head [
         mask: [all]
     ]
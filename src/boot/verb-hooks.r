@@ -0,0 +1,33 @@
+REBOL [
+    System: "REBOL [R3] Language Interpreter and Run-time Environment"
+    Title: "Direct handlers for hot generic verbs"
+    Rights: {
+        Copyright 2023 Ren-C Open Source Contributors
+        REBOL is a trademark of REBOL Technologies
+    }
+    License: {
+        Licensed under the Apache License, Version 2.0
+        See: http://www.apache.org/licenses/LICENSE-2.0
+    }
+    Purpose: {
+        Generics are normally dispatched to a type's REBTYPE() function, which
+        switches on the verb.  For the verbs listed here, %make-boot.r makes
+        a (datatype x verb) table of the given C functions, and every type of
+        that class calls the function directly.  See Run_Generic_Dispatch().
+
+        Each entry is a class from the class column of %types.r, then a block
+        of verbs and the C function that fully handles the verb for that
+        class.  The REBTYPE() should call the same function for the verb, as
+        other code (e.g. for ports) calls REBTYPE()s directly.
+    }
+]
+
+array [
+    pick* Array_Pick_P
+    poke* Array_Poke_P
+]
+
+string [
+    pick* String_Pick_P
+    poke* String_Poke_P
+]
@@ -1451,6 +1451,201 @@ double RL_rebUnboxDecimal(
 }
 
 
+//=//// BULK UNBOXING AND BOXING ///////////////////////////////////////////=//
+//
+// Moving a large BLOCK! of numbers between C and Rebol one rebUnboxXXX() or
+// rebInteger() at a time pays for an API call (and for unboxing, a variadic
+// evaluation) per item.  These do the whole block at once.
+//
+// The unboxing routines evaluate their variadic input to a BLOCK!, and check
+// the type of every item before writing any of them.  They return the number
+// of items, which is the number written if it is not more than `buf_len`.
+// So passing a nullptr buffer and 0 length finds out how big a buffer the
+// block needs.
+//
+// LOGIC! is isotopic and can't be put in a BLOCK!, so logic arrays use the
+// WORD!s `true` and `false`.
+//
+
+static Cell(const*) Run_Va_Block_Of_Kind_May_Fail(
+    REBVAL *out,
+    REBLEN *len_out,
+    Cell(const*) *tail_out,
+    enum Reb_Kind kind,  // REB_0 for the `true` and `false` words
+    const void *p, va_list *vaptr
+){
+    Run_Va_May_Fail(out, p, vaptr);  // calls va_end()
+
+    if (not IS_BLOCK(out))
+        fail ("Bulk rebUnboxXXXsInto() routines need a BLOCK!");
+
+    Cell(const*) head = VAL_ARRAY_LEN_AT(len_out, out);
+    *tail_out = head + *len_out;
+
+    Cell(const*) item = head;
+    for (; item != *tail_out; ++item) {
+        if (kind == REB_0) {
+            if (
+                not IS_WORD(item)
+                or (
+                    VAL_WORD_ID(item) != SYM_TRUE
+                    and VAL_WORD_ID(item) != SYM_FALSE
+                )
+            ){
+                fail ("rebUnboxLogicsInto() needs `true` and `false` words");
+            }
+        }
+        else if (kind == REB_DECIMAL) {
+            if (not IS_DECIMAL(item) and not IS_INTEGER(item))
+                fail ("rebUnboxDecimalsInto() needs DECIMAL! or INTEGER!");
+        }
+        else if (VAL_TYPE(item) != kind)
+            fail ("rebUnboxIntegersInto() needs INTEGER! items");
+    }
+
+    return head;
+}
+
+
+//
+//  rebUnboxIntegersInto: RL_API
+//
+size_t RL_rebUnboxIntegersInto(
+    int64_t *buf,
+    size_t buf_len,
+    const void *p, va_list *vaptr
+){
+    ENTER_API;
+
+    DECLARE_LOCAL (block);
+    REBLEN len;
+    Cell(const*) tail;
+    Cell(const*) item = Run_Va_Block_Of_Kind_May_Fail(
+        block, &len, &tail, REB_INTEGER, p, vaptr
+    );
+
+    if (len <= buf_len) {
+        for (; item != tail; ++item, ++buf)
+            *buf = VAL_INT64(item);
+    }
+    return len;
+}
+
+
+//
+//  rebUnboxDecimalsInto: RL_API
+//
+size_t RL_rebUnboxDecimalsInto(
+    double *buf,
+    size_t buf_len,
+    const void *p, va_list *vaptr
+){
+    ENTER_API;
+
+    DECLARE_LOCAL (block);
+    REBLEN len;
+    Cell(const*) tail;
+    Cell(const*) item = Run_Va_Block_Of_Kind_May_Fail(
+        block, &len, &tail, REB_DECIMAL, p, vaptr
+    );
+
+    if (len <= buf_len) {
+        for (; item != tail; ++item, ++buf) {
+            if (IS_INTEGER(item))
+                *buf = cast(double, VAL_INT64(item));
+            else
+                *buf = VAL_DECIMAL(item);
+        }
+    }
+    return len;
+}
+
+
+//
+//  rebUnboxLogicsInto: RL_API
+//
+size_t RL_rebUnboxLogicsInto(
+    bool *buf,
+    size_t buf_len,
+    const void *p, va_list *vaptr
+){
+    ENTER_API;
+
+    DECLARE_LOCAL (block);
+    REBLEN len;
+    Cell(const*) tail;
+    Cell(const*) item = Run_Va_Block_Of_Kind_May_Fail(
+        block, &len, &tail, REB_0, p, vaptr
+    );
+
+    if (len <= buf_len) {
+        for (; item != tail; ++item, ++buf)
+            *buf = (VAL_WORD_ID(item) == SYM_TRUE);
+    }
+    return len;
+}
+
+
+//
+//  rebIntegers: RL_API
+//
+// Makes a BLOCK! of INTEGER!s from a C array.
+//
+REBVAL *RL_rebIntegers(const int64_t *values, size_t count)
+{
+    ENTER_API;
+
+    Array(*) a = Make_Array(count);
+    Cell(*) dest = ARR_HEAD(a);
+    size_t n;
+    for (n = 0; n < count; ++n, ++dest)
+        Init_Integer(dest, values[n]);
+    SET_SERIES_LEN(a, count);
+
+    return Init_Block(Alloc_Value(), a);
+}
+
+
+//
+//  rebDecimals: RL_API
+//
+// Makes a BLOCK! of DECIMAL!s from a C array.
+//
+REBVAL *RL_rebDecimals(const double *values, size_t count)
+{
+    ENTER_API;
+
+    Array(*) a = Make_Array(count);
+    Cell(*) dest = ARR_HEAD(a);
+    size_t n;
+    for (n = 0; n < count; ++n, ++dest)
+        Init_Decimal(dest, values[n]);
+    SET_SERIES_LEN(a, count);
+
+    return Init_Block(Alloc_Value(), a);
+}
+
+
+//
+//  rebLogics: RL_API
+//
+// Makes a BLOCK! of `true` and `false` WORD!s from a C array.
+//
+REBVAL *RL_rebLogics(const bool *values, size_t count)
+{
+    ENTER_API;
+
+    Array(*) a = Make_Array(count);
+    Cell(*) dest = ARR_HEAD(a);
+    size_t n;
+    for (n = 0; n < count; ++n, ++dest)
+        Init_Word(dest, values[n] ? Canon(TRUE) : Canon(FALSE));
+    SET_SERIES_LEN(a, count);
+
+    return Init_Block(Alloc_Value(), a);
+}
+
+
 //
 //  rebUnboxChar: RL_API
 //
@@ -2321,6 +2516,67 @@ void RL_rebRelease(const REBVAL *v)
 }
 
 
+//
+//  rebEnterScope: RL_API
+//
+// Code that makes many API calls in a loop can bracket each iteration with
+// rebEnterScope() and rebLeaveScope(), instead of a rebRelease() for every
+// handle it gets.  This is like the frame freeing its handles when it ends,
+// but for a section of C code.
+//
+// A scope is entered by putting a marker handle in the list of handles owned
+// by the top frame.  New handles are put at the head of that list, so all of
+// the ones made since the marker are before it.  Scopes nest.
+//
+// Handles in the scope which are released individually, or rebUnmanage()'d,
+// are taken out of the list.  So they won't be freed again, and the latter
+// will outlive the scope.  But any other handle made in the scope (including
+// one you meant to return!) is invalid after rebLeaveScope().
+//
+void RL_rebEnterScope(void)
+{
+    ENTER_API;
+
+    REBVAL *marker = Init_Blank(Alloc_Value());
+    Set_Subclass_Flag(API, Singular_From_Cell(marker), SCOPE);
+}
+
+
+//
+//  rebLeaveScope: RL_API
+//
+// Frees all the handles made since the matching rebEnterScope().  This must
+// be called in the same frame as the rebEnterScope(), e.g. not from inside
+// a native that was called after it.
+//
+// (If a fail() happens in the scope, the handles and the marker are freed
+// when the frame is unwound, so there's no need to leave the scope.)
+//
+void RL_rebLeaveScope(void)
+{
+    ENTER_API;
+
+    Frame(*) f = TOP_FRAME;
+
+    Node* n = f->alloc_value_list;
+    while (true) {
+        if (n == f)
+            fail ("rebLeaveScope() without rebEnterScope() in this frame");
+        if (Get_Subclass_Flag(API, ARR(n), SCOPE))
+            break;
+        n = LINK(ApiNext, ARR(n));
+    }
+
+    while (true) {
+        Array(*) a = ARR(f->alloc_value_list);  // freeing moves the head
+        bool is_marker = Get_Subclass_Flag(API, a, SCOPE);
+        Free_Value(SPECIFIC(ARR_SINGLE(a)));
+        if (is_marker)
+            break;
+    }
+}
+
+
 //
 //  rebZdeflateAlloc: RL_API
 //
@@ -52,6 +52,8 @@
 
 #include "sys-core.h"
 
+#include <time.h>  // clock() for startup timings
+
 #define EVAL_DOSE 10000
 
 
@@ -672,6 +674,12 @@ static void Init_Contexts_Object(void)
 void Startup_Signals(void)
 {
     Trace_Level = 0;
+    Trace_Logging = false;
+    Profile_Calls = false;
+    Alloc_Sample_Countdown = 0;
+    Count_Lines = false;
+    Typecheck_Fast_Count = 0;
+    Typecheck_Slow_Count = 0;
     TG_Jump_List = nullptr;
 
   #if !defined(NDEBUG)
@@ -682,9 +690,14 @@ void Startup_Signals(void)
     Eval_Dose = EVAL_DOSE;
     Eval_Countdown = Eval_Dose;
     Eval_Signals = 0;
+    PG_Breakpoint_Hook = nullptr;
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
 
+  #if REBOL_TIMER_SIGNALS
+    Startup_Signal_Timer();
+  #endif
+
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
 
@@ -717,6 +730,63 @@ void Startup_Signals(void)
 }
 
 
+//=//// STARTUP TIMINGS ///////////////////////////////////////////////////=//
+//
+// Each phase of Startup_Core() notes how much processor time it took, using
+// standard C clock() (as the GC's sweep slices do).  Most of the phases run
+// before there's a system object to put them in, so they're kept in a small
+// static table and published as SYSTEM.STATE.STARTUP-TIMINGS at the end of
+// boot.  That's a block of `phase seconds` pairs, which LOAD-EXTENSION and
+// the host add to (the r3 executable will print it for --startup-profile).
+//
+
+#define MAX_STARTUP_PHASES 16
+
+static struct {
+    const char* label;
+    clock_t ticks;
+} Startup_Phases[MAX_STARTUP_PHASES];
+
+static REBLEN Num_Startup_Phases;
+static clock_t Startup_Phase_Clock;
+
+
+//
+//  Note_Startup_Phase: C
+//
+// Record the time since the last phase was noted as being spent in `label`.
+//
+static void Note_Startup_Phase(const char* label)
+{
+    clock_t now = clock();
+    assert(Num_Startup_Phases < MAX_STARTUP_PHASES);
+    Startup_Phases[Num_Startup_Phases].label = label;
+    Startup_Phases[Num_Startup_Phases].ticks = now - Startup_Phase_Clock;
+    ++Num_Startup_Phases;
+    Startup_Phase_Clock = now;
+}
+
+
+//
+//  Publish_Startup_Timings: C
+//
+static void Publish_Startup_Timings(void)
+{
+    REBVAL *timings = rebValue("system.state.startup-timings: copy []");
+
+    REBLEN i;
+    for (i = 0; i < Num_Startup_Phases; ++i) {
+        double secs = cast(double, Startup_Phases[i].ticks) / CLOCKS_PER_SEC;
+        rebElide(
+            "append", timings, "to word!", rebT(Startup_Phases[i].label),
+            "append", timings, rebR(rebDecimal(secs))
+        );
+    }
+
+    rebRelease(timings);
+}
+
+
 #if !defined(NDEBUG)
     //
     // The C language initializes global variables to zero:
@@ -757,6 +827,9 @@ void Startup_Core(void)
     Startup_Trash_Debug();
   #endif
 
+    Num_Startup_Phases = 0;  // startup can run again after a shutdown
+    Startup_Phase_Clock = clock();
+
 //=//// INITIALIZE TICK COUNT /////////////////////////////////////////////=//
 
     // The timer tick starts at 1, not 0.  This has allowed a signed timer
@@ -802,6 +875,7 @@ void Startup_Core(void)
     PG_Boot_Level = BOOT_LEVEL_FULL;
     PG_Mem_Usage = 0;
     PG_Mem_Limit = 0;
+    PG_Segments_Released = 0;
     Reb_Opts = TRY_ALLOC(REB_OPTS);
     memset(Reb_Opts, 0, sizeof(REB_OPTS));
     TG_Jump_List = nullptr;
@@ -819,6 +893,8 @@ void Startup_Core(void)
     Startup_Scanner();
     Startup_String();
 
+    Note_Startup_Phase("pools");
+
 //=//// INITIALIZE API ////////////////////////////////////////////////////=//
 
     // The API is one means by which variables can be made whose lifetime is
@@ -828,6 +904,8 @@ void Startup_Core(void)
 
     Init_Char_Cases();
     Startup_CRC();             // For word hashing
+    Startup_Utf8();
+    Startup_Enbase();
     Set_Random(0);
     Startup_Interning();
 
@@ -855,6 +933,7 @@ void Startup_Core(void)
 //=//// CREATE GLOBAL OBJECTS /////////////////////////////////////////////=//
 
     Init_Root_Vars();    // Special REBOL values per program
+    Startup_Scan_Fragment_Cache();
 
     Init_Action_Spec_Tags(); // Note: uses MOLD_BUF, not available until here
 
@@ -862,6 +941,8 @@ void Startup_Core(void)
 
     Startup_Lib();  // establishes Lib_Context and Lib_Context_Value
 
+    Note_Startup_Phase("symbols");
+
   #if !defined(NDEBUG)
     Assert_Pointer_Detection_Working();  // uses root series/values to test
   #endif
@@ -874,7 +955,14 @@ void Startup_Core(void)
     // %tmp-boot-block.c which gets embedded into the executable.  This
     // includes the type list, word list, error message templates, system
     // object, mezzanines, etc.
+    //
+    // (BOOT_BLOCK_UNCOMPRESSED builds skip the inflate, the text is already
+    // in the executable with a '\0' terminator.)
 
+  #if BOOT_BLOCK_UNCOMPRESSED
+    size_t utf8_size = Boot_Block_Size;
+    const Byte* utf8 = Boot_Block_Uncompressed;
+  #else
     size_t utf8_size;
     const int max = -1;  // trust size in gzip data
     Byte* utf8 = Decompress_Alloc_Core(
@@ -884,6 +972,9 @@ void Startup_Core(void)
         max,
         SYM_GZIP
     );
+  #endif
+
+    Note_Startup_Phase("decompress");
 
     // The boot code contains portions that are supposed to be interned to the
     // SYS.UTIL context instead of the LIB context.  But the Base and Mezzanine
@@ -900,13 +991,17 @@ void Startup_Core(void)
     );
     PUSH_GC_GUARD(boot_array); // managed, so must be guarded
 
+  #if !BOOT_BLOCK_UNCOMPRESSED
     rebFree(utf8); // don't need decompressed text after it's scanned
+  #endif
 
     BOOT_BLK *boot =
         cast(BOOT_BLK*, ARR_HEAD(VAL_ARRAY_KNOWN_MUTABLE(ARR_HEAD(boot_array))));
 
     // ID_OF_SYMBOL(), VAL_WORD_ID() and Canon(XXX) now available
 
+    Note_Startup_Phase("scan");
+
     PG_Boot_Phase = BOOT_LOADED;
 
 //=//// CREATE BASIC VALUES ///////////////////////////////////////////////=//
@@ -981,6 +1076,8 @@ void Startup_Core(void)
 
     assert(TOP_INDEX == 0 and TOP_FRAME == BOTTOM_FRAME);
 
+    Note_Startup_Phase("natives");
+
 //=//// RUN MEZZANINE CODE NOW THAT ERROR HANDLING IS INITIALIZED /////////=//
 
     // By this point, the Lib_Context contains basic definitions for things
@@ -1022,6 +1119,8 @@ void Startup_Core(void)
         "do", &boot->base  // ENSURE not available yet (but returns blank)
     );
 
+    Note_Startup_Phase("base");
+
   //=//// SYSTEM.UTIL STARTUP /////////////////////////////////////////////=//
 
     // The SYSTEM.UTIL context contains supporting Rebol code for implementing
@@ -1063,6 +1162,8 @@ void Startup_Core(void)
         "sys.util.import*", Lib_Context_Value, Sys_Util_Module
     );
 
+    Note_Startup_Phase("sys");
+
     // !!! It was a stated goal at one point that it should be possible to
     // protect the entire system object and still run the interpreter.  That
     // was commented out in R3-Alpha
@@ -1087,6 +1188,17 @@ void Startup_Core(void)
         "do", SPECIFIC(&boot->mezz)
     );
 
+    // Sections like %mezz-help.r are only function definitions, and most
+    // runs never call any of them.  Their words are given stubs that run
+    // the section the first time one of them is called.
+    //
+    rebElide(
+        "bind/only/set", SPECIFIC(&boot->mezz_lazy), Lib_Context_Value,
+        "sys.util.define-lazy", SPECIFIC(&boot->mezz_lazy)
+    );
+
+    Note_Startup_Phase("mezz");
+
   //=//// MAKE USER CONTEXT ////////////////////////////////////////////////=//
 
     // None of the above code should have needed the "user" context, which is
@@ -1109,6 +1221,9 @@ void Startup_Core(void)
     rebUnmanage(User_Context_Value);
     User_Context = VAL_CONTEXT(User_Context_Value);
 
+    Note_Startup_Phase("user");
+    Publish_Startup_Timings();
+
   //=//// FINISH UP ///////////////////////////////////////////////////////=//
 
     assert(TOP_INDEX == 0 and TOP_FRAME == BOTTOM_FRAME);
@@ -1159,6 +1274,11 @@ void Shutdown_Core(bool clean)
     // call exit().
     //
     Shutdown_Extension_Loader();
+    Shutdown_Profiling();  // releases API handle, see Shutdown_Api()
+    Shutdown_Trace_Log();
+  #if REBOL_TIMER_SIGNALS
+    Shutdown_Signal_Timer();
+  #endif
 
   #if !defined(NDEBUG)
     Check_Memory_Debug(); // old R3-Alpha check, call here to keep it working
@@ -1182,6 +1302,7 @@ void Shutdown_Core(bool clean)
 
     Shutdown_Natives();
     Shutdown_Action_Spec_Tags();
+    Shutdown_Scan_Fragment_Cache();
     Shutdown_Root_Vars();
 
     Shutdown_Datatypes();
@@ -96,7 +96,10 @@ void Bind_Values_Inner_Loop(
           }
         }
         else if (flags & BIND_DEEP) {
-            if (ANY_ARRAYLIKE(v)) {
+            if (
+                ANY_ARRAYLIKE(v)
+                and Not_Subclass_Flag(ARRAY, VAL_ARRAY(v), NO_BINDABLES)
+            ){
                 Cell(const*) sub_tail;
                 Cell(*) sub_at = VAL_ARRAY_AT_MUTABLE_HACK(
                     &sub_tail,
@@ -196,7 +199,10 @@ void Unbind_Values_Core(
         ){
             Unbind_Any_Word(v);
         }
-        else if (ANY_ARRAYLIKE(v) and deep) {
+        else if (
+            deep and ANY_ARRAYLIKE(v)
+            and Not_Subclass_Flag(ARRAY, VAL_ARRAY(v), NO_BINDABLES)
+        ){
             Cell(const*) sub_tail;
             Cell(*) sub_at = VAL_ARRAY_AT_MUTABLE_HACK(&sub_tail, v);
             Unbind_Values_Core(sub_at, sub_tail, context, true);
@@ -227,6 +233,38 @@ REBLEN Try_Bind_Word(Cell(const*) context, REBVAL *word)
 }
 
 
+//
+//  Make_Let_Summary: C
+//
+// Summarize the run of LETs that starts at `let` and goes until the chain
+// reaches something that isn't a LET.  See LET_SUMMARY_MIN_RUN.
+//
+Binary(*) Make_Let_Summary(Array(*) let)
+{
+    Binary(*) bin = Make_Binary(sizeof(struct Reb_Let_Summary));
+    struct Reb_Let_Summary *summary = LET_SUMMARY(bin);
+    memset(summary->bits, 0, sizeof(summary->bits));
+
+    REBLEN run = 0;
+    while (true) {
+        Add_Let_Summary_Symbol(summary, INODE(LetSymbol, let));
+        ++run;
+
+        Array(*) next = NextVirtual(let);
+        if (not next or not IS_LET(next))
+            break;
+        let = next;
+    }
+    assert(run >= LET_SUMMARY_MIN_RUN - 1);
+    UNUSED(run);
+
+    summary->last = let;
+    TERM_BIN_LEN(bin, sizeof(struct Reb_Let_Summary));
+    Manage_Series(bin);
+    return bin;
+}
+
+
 //
 //  Make_Let_Patch: C
 //
@@ -239,6 +277,8 @@ REBLEN Try_Bind_Word(Cell(const*) context, REBVAL *word)
 //    or a context pointer that represents the specifying frame for the chain.
 //    So we can simply point to the existing specifier...whether it is a let,
 //    a use, a frame context, or nullptr.
+//// 2. Only runs of LET_SUMMARY_MIN_RUN or more LETs get a summary, so a lone
+//    LET (the common case) costs no more than it did before summaries.
 //
 Array(*) Make_Let_Patch(
     Symbol(const*) symbol,
@@ -249,6 +289,7 @@ Array(*) Make_Let_Patch(
             | NODE_FLAG_MANAGED
             | SERIES_FLAG_LINK_NODE_NEEDS_MARK  // link to next virtual bind
             | SERIES_FLAG_INFO_NODE_NEEDS_MARK  // inode of symbol
+            | SERIES_FLAG_MISC_NODE_NEEDS_MARK  // summary of LET run
     );
 
     Finalize_None(VAL(ARR_SINGLE(let)));  // start variable as unset
@@ -259,7 +300,20 @@ Array(*) Make_Let_Patch(
     }
     mutable_LINK(NextLet, let) = specifier;  // linked list, see [1]
 
-    node_MISC(LetReserved, let) = nullptr;  // not currently used
+    Binary(*) summary = nullptr;
+    if (specifier and IS_LET(specifier)) {  // extending a run of LETs
+        summary = MISC(LetSummary, specifier);
+        if (
+            not summary
+            and NextVirtual(specifier)
+            and IS_LET(NextVirtual(specifier))  // run now long enough, see [2]
+        ){
+            summary = Make_Let_Summary(specifier);
+        }
+        if (summary)
+            Add_Let_Summary_Symbol(LET_SUMMARY(summary), symbol);
+    }
+    mutable_MISC(LetSummary, let) = summary;
 
     mutable_INODE(LetSymbol, let) = symbol;  // surrogate for context "key"
 
@@ -708,14 +762,21 @@ static void Clonify_And_Bind_Relative(
             would_need_deep = true;
         }
         else if (ANY_ARRAYLIKE(v)) {
+            Array(const*) original = VAL_ARRAY(v);
             series = Copy_Array_At_Extra_Shallow(
-                VAL_ARRAY(v),
+                original,
                 0, // !!! what if VAL_INDEX() is nonzero?
                 VAL_SPECIFIER(v),
                 0,
                 NODE_FLAG_MANAGED
             );
 
+            // Cloning the copy's cells only copies series, it doesn't add
+            // anything bindable, so the copy can be skipped by BIND too.
+            //
+            if (Get_Subclass_Flag(ARRAY, original, NO_BINDABLES))
+                Set_Subclass_Flag(ARRAY, ARR(series), NO_BINDABLES);
+
             INIT_VAL_NODE1(v, series);  // copies args
             INIT_SPECIFIER(v, UNBOUND);  // copied w/specifier--not relative
 
@@ -924,6 +985,8 @@ void Rebind_Values_Deep(
         else if (Is_Isotope(v))
             NOOP;
         else if (ANY_ARRAYLIKE(v)) {
+            if (Get_Subclass_Flag(ARRAY, VAL_ARRAY(v), NO_BINDABLES))
+                continue;  // no words or actions in it, see flag definition
             Cell(const*) sub_tail;
             Cell(*) sub_at = VAL_ARRAY_AT_MUTABLE_HACK(&sub_tail, v);
             Rebind_Values_Deep(sub_at, sub_tail, from, to, binder);
@@ -1268,6 +1331,8 @@ void Bind_Nonspecifically(Cell(*) head, Cell(const*) tail, Context(*) context)
     Cell(*) v = head;
     for (; v != tail; ++v) {
         if (ANY_ARRAYLIKE(v)) {
+            if (Get_Subclass_Flag(ARRAY, VAL_ARRAY(v), NO_BINDABLES))
+                continue;
             Cell(const*) sub_tail;
             Cell(*) sub_head = VAL_ARRAY_AT_MUTABLE_HACK(&sub_tail, v);
             Bind_Nonspecifically(sub_head, sub_tail, context);
@@ -70,6 +70,13 @@ bool Expand_Context_Keylist_Core(Context(*) context, REBLEN delta)
 
     if (Get_Subclass_Flag(KEYLIST, keylist, SHARED)) {
         //
+        // If keys are being added, Append_Context_Core() will move the
+        // context to the successor keylist for each key--which may already
+        // exist, see SHAPE_CACHE_SIZE.  Copying here would be wasted.
+        //
+        if (delta != 0)
+            return true;
+
         // INIT_CTX_KEYLIST_SHARED was used to set the flag that indicates
         // this keylist is shared with one or more other contexts.  Can't
         // expand the shared copy without impacting the others, so break away
@@ -134,6 +141,238 @@ void Expand_Context(Context(*) context, REBLEN delta)
 }
 
 
+inline static uint32_t Keylist_Index_Hash(Symbol(const*) symbol) {
+    uintptr_t bits = cast(uintptr_t, symbol) >> 4;  // stubs are aligned
+    return cast(uint32_t, bits ^ (bits >> 16)) * 2654435761u;
+}
+
+
+//
+//  Add_Keylist_Index_Key: C
+//
+// Put key `n` (1-based) in the index, unless the symbol's already in it.
+// (Lookups want the first position, in case a symbol occurs twice.)
+//
+static void Add_Keylist_Index_Key(
+    uint32_t *index,
+    Keylist(const*) keylist,
+    REBLEN n
+){
+    const REBKEY *keys = SER_HEAD(const REBKEY, keylist);
+    Symbol(const*) symbol = KEY_SYMBOL(&keys[n - 1]);
+
+    uint32_t mask = index[0] - 1;
+    uint32_t slot = Keylist_Index_Hash(symbol) & mask;
+    while (index[slot + 1] != 0) {
+        if (KEY_SYMBOL(&keys[index[slot + 1] - 1]) == symbol)
+            return;
+        slot = (slot + 1) & mask;
+    }
+    index[slot + 1] = n;
+}
+
+
+//
+//  Index_Keylist: C
+//
+// Build the hash index for a keylist, see KEYLIST_FLAG_INDEXED.  If there's
+// not enough memory then the keylist just goes without, since the index is
+// only an accelerator for the linear search.
+//
+static void Index_Keylist(Keylist(*) keylist)
+{
+    assert(Not_Subclass_Flag(KEYLIST, keylist, INDEXED));
+
+    REBLEN used = SER_USED(keylist);
+
+    uint32_t slots = 64;
+    while (slots < used * 2)  // keep load factor at or under 1/2
+        slots *= 2;
+
+    uint32_t *index = TRY_ALLOC_N(uint32_t, slots + 1);
+    if (not index)
+        return;
+    memset(index, 0, sizeof(uint32_t) * (slots + 1));
+    index[0] = slots;
+
+    REBLEN n;
+    for (n = 1; n <= used; ++n)
+        Add_Keylist_Index_Key(index, keylist, n);
+
+    keylist->misc.keylist_index = index;
+    Set_Subclass_Flag(KEYLIST, keylist, INDEXED);
+}
+
+
+//
+//  Free_Keylist_Index: C
+//
+void Free_Keylist_Index(Keylist(*) keylist)
+{
+    assert(Get_Subclass_Flag(KEYLIST, keylist, INDEXED));
+
+    uint32_t *index = keylist->misc.keylist_index;
+    FREE_N(uint32_t, index[0] + 1, index);
+    Clear_Subclass_Flag(KEYLIST, keylist, INDEXED);
+}
+
+
+//
+//  Find_Keylist_Index: C
+//
+// Returns the position of the first key with exactly this symbol, or 0.
+//
+static REBLEN Find_Keylist_Index(
+    Keylist(const*) keylist,
+    Symbol(const*) symbol
+){
+    const uint32_t *index = keylist->misc.keylist_index;
+    const REBKEY *keys = SER_HEAD(const REBKEY, keylist);
+
+    uint32_t mask = index[0] - 1;
+    uint32_t slot = Keylist_Index_Hash(symbol) & mask;
+    while (index[slot + 1] != 0) {
+        REBLEN n = index[slot + 1];
+        if (KEY_SYMBOL(&keys[n - 1]) == symbol)
+            return n;
+        slot = (slot + 1) & mask;
+    }
+    return 0;
+}
+
+
+//
+//  Shape_Cache_Entry: C
+//
+static struct Reb_Shape_Cache_Entry *Shape_Cache_Entry(
+    const void *from,
+    option(Symbol(const*)) symbol
+){
+    uintptr_t bits = (cast(uintptr_t, from) ^ cast(uintptr_t, symbol)) >> 4;
+    uint32_t hash = cast(uint32_t, bits ^ (bits >> 16)) * 2654435761u;
+    return &TG_Shape_Cache[(hash >> 8) & (SHAPE_CACHE_SIZE - 1)];
+}
+
+
+//
+//  Successor_Keylist: C
+//
+// Get the keylist that is `keylist` with `symbol` added on the end.  Neither
+// keylist is ever extended in place (they're marked shared), so once such a
+// keylist has been made it can be reused for as long as it's cached.
+//
+static Keylist(*) Successor_Keylist(
+    Keylist(*) keylist,
+    Symbol(const*) symbol
+){
+    assert(Get_Subclass_Flag(KEYLIST, keylist, SHARED));
+
+    struct Reb_Shape_Cache_Entry *entry = Shape_Cache_Entry(keylist, symbol);
+    if (entry->from == keylist and entry->symbol == symbol)
+        return entry->to;
+
+    Keylist(*) successor = cast(Raw_Keylist*, Copy_Series_At_Len_Extra(
+        keylist,
+        0,
+        SER_USED(keylist),
+        1,
+        SERIES_MASK_KEYLIST
+    ));
+    EXPAND_SERIES_TAIL(successor, 1);
+    Init_Key(SER_LAST(REBKEY, successor), symbol);
+
+    // Same ancestry as a copy made by Expand_Context_Keylist_Core().
+    //
+    if (LINK(Ancestor, keylist) == keylist)
+        mutable_LINK(Ancestor, successor) = successor;
+    else
+        mutable_LINK(Ancestor, successor) = LINK(Ancestor, keylist);
+
+    Manage_Series(successor);
+    Set_Subclass_Flag(KEYLIST, successor, SHARED);  // cached, so shareable
+
+    entry->from = keylist;
+    entry->symbol = symbol;
+    entry->to = successor;
+    return successor;
+}
+
+
+//
+//  Shape_For_Spec: C
+//
+// An object made from a spec with no parent has collected a new keylist.  If
+// the last object made from that same spec had the same keys, return its
+// keylist to share instead (the new one will just be GC'd).  Otherwise the
+// new keylist is remembered for next time, and returned.
+//
+// The keys are compared, since the spec block could have been changed since.
+//
+static Keylist(*) Shape_For_Spec(Cell(const*) head, Keylist(*) keylist)
+{
+    struct Reb_Shape_Cache_Entry *entry = Shape_Cache_Entry(head, nullptr);
+
+    if (entry->from == head and entry->symbol == nullptr) {
+        Keylist(*) shape = entry->to;
+        REBLEN len = SER_USED(keylist);
+        if (
+            SER_USED(shape) == len
+            and 0 == memcmp(
+                SER_HEAD(REBKEY, shape),
+                SER_HEAD(REBKEY, keylist),
+                sizeof(REBKEY) * len
+            )
+        ){
+            return shape;
+        }
+    }
+
+    entry->from = head;
+    entry->symbol = nullptr;
+    entry->to = keylist;
+    return keylist;
+}
+
+
+//
+//  Reuse_Shape_For_Spec: C
+//
+// Before collecting keys for an object made from a spec with no parent, see
+// if the keylist that Shape_For_Spec() remembered for that spec still fits.
+// The spec may have been changed since, so its top-level SET-WORD!s are
+// walked and checked against the keys in order.  That is only a pointer
+// compare per SET-WORD!, versus collecting with a binder and allocating a
+// keylist that Shape_For_Spec() would then just throw away.
+//
+// (A spec with duplicate SET-WORD!s never matches, and gets collected.)
+//
+static option(Keylist(*)) Reuse_Shape_For_Spec(
+    Cell(const*) head,
+    Cell(const*) tail
+){
+    struct Reb_Shape_Cache_Entry *entry = Shape_Cache_Entry(head, nullptr);
+    if (entry->from != head or entry->symbol != nullptr)
+        return nullptr;
+
+    Keylist(*) shape = entry->to;
+    const REBKEY *key = SER_HEAD(REBKEY, shape);
+    const REBKEY *key_tail = key + SER_USED(shape);
+
+    Cell(const*) v = head;
+    for (; v != tail; ++v) {
+        if (CELL_HEART(v) != REB_SET_WORD)  // same test as Collect_Inner_Loop
+            continue;
+        if (key == key_tail or KEY_SYMBOL(key) != VAL_WORD_SYMBOL(v))
+            return nullptr;
+        ++key;
+    }
+    if (key != key_tail)
+        return nullptr;
+
+    return shape;
+}
+
+
 // Append a word to the context word list. Expands the list if necessary.
 // Returns the value cell for the word, which is reset.
 //
@@ -146,6 +385,8 @@ static REBVAR* Append_Context_Core(
     Symbol(const*) symbol,
     option(Cell(*)) any_word  // binding modified (Note: quoted words allowed)
 ) {
+    Invalidate_Virtual_Cache();  // new key might now override in a USE
+
     if (CTX_TYPE(context) == REB_MODULE) {
         //
         // !!! In order to make MODULE more friendly to the idea of very
@@ -222,13 +463,33 @@ static REBVAR* Append_Context_Core(
 
     // Add the key to key list
     //
-    // !!! This doesn't seem to consider the shared flag of the keylist (?)
-    // though the callsites seem to pre-expand with consideration for that.
-    // Review why this is expanding when the callers are expanding.  Should
-    // also check that redundant keys aren't getting added here.
+    // A shared keylist can't be changed, so the context moves to the keylist
+    // that other contexts with these keys got when they added this key (if
+    // there is one, else a new one to be found by the next such context).
+    //
+    // !!! Review why this is expanding when the callers are expanding.
+    // Should also check that redundant keys aren't getting added here.
     //
-    EXPAND_SERIES_TAIL(keylist, 1);  // updates the used count
-    Init_Key(SER_LAST(REBKEY, keylist), symbol);
+    if (Get_Subclass_Flag(KEYLIST, keylist, SHARED)) {
+        keylist = Successor_Keylist(keylist, symbol);
+        INIT_CTX_KEYLIST_SHARED(context, keylist);
+    }
+    else {
+        EXPAND_SERIES_TAIL(keylist, 1);  // updates the used count
+        Init_Key(SER_LAST(REBKEY, keylist), symbol);
+
+        if (Get_Subclass_Flag(KEYLIST, keylist, INDEXED)) {  // keep current
+            REBLEN used = SER_USED(keylist);
+            if (used * 2 > keylist->misc.keylist_index[0]) {
+                Free_Keylist_Index(keylist);
+                Index_Keylist(keylist);  // bigger, may fail (won't index)
+            }
+            else
+                Add_Keylist_Index_Key(
+                    keylist->misc.keylist_index, keylist, used
+                );
+        }
+    }
 
     // Add a slot to the var list
     //
@@ -605,12 +866,13 @@ Context(*) Make_Context_Detect_Managed(
 ) {
     assert(kind != REB_MODULE);
 
-    Keylist(*) keylist = Collect_Keylist_Managed(
-        head,
-        tail,
-        parent,
-        COLLECT_ONLY_SET_WORDS
-    );
+    option(Keylist(*)) reused = nullptr;
+    if (head and not parent)
+        reused = Reuse_Shape_For_Spec(unwrap(head), unwrap(tail));
+
+    Keylist(*) keylist = reused
+        ? unwrap(reused)
+        : Collect_Keylist_Managed(head, tail, parent, COLLECT_ONLY_SET_WORDS);
 
     REBLEN len = SER_USED(keylist);
     Array(*) varlist = Make_Array_Core(
@@ -629,9 +891,18 @@ Context(*) Make_Context_Detect_Managed(
     // else, so it could probably be inlined here and it would be more
     // obvious what's going on.
     //
-    if (not parent) {
-        INIT_CTX_KEYLIST_UNIQUE(context, keylist);
+    if (reused)
+        INIT_CTX_KEYLIST_SHARED(context, keylist);
+    else if (not parent) {
         mutable_LINK(Ancestor, keylist) = keylist;
+
+        Keylist(*) shape = head  // same spec as last time, same keys? share
+            ? Shape_For_Spec(unwrap(head), keylist)
+            : keylist;
+        if (shape != keylist)
+            INIT_CTX_KEYLIST_SHARED(context, shape);
+        else
+            INIT_CTX_KEYLIST_UNIQUE(context, keylist);
     }
     else {
         if (keylist == CTX_KEYLIST(unwrap(parent))) {
@@ -805,6 +1076,60 @@ Array(*) Context_To_Array(Cell(const*) context, REBINT mode)
 }
 
 
+//
+//  Field_Cache_Entry: C
+//
+static struct Reb_Field_Cache_Entry *Field_Cache_Entry(
+    Keylist(const*) keylist,
+    Symbol(const*) symbol
+){
+    uintptr_t bits = (cast(uintptr_t, keylist) ^ cast(uintptr_t, symbol)) >> 4;
+    uint32_t hash = cast(uint32_t, bits ^ (bits >> 16)) * 2654435761u;
+    return &TG_Field_Cache[(hash >> 8) & (FIELD_CACHE_SIZE - 1)];
+}
+
+
+//
+//  Remember_Field: C
+//
+static void Remember_Field(
+    struct Reb_Field_Cache_Entry *entry,
+    Keylist(const*) keylist,
+    Symbol(const*) symbol,
+    bool strict,
+    REBLEN index
+){
+    entry->keylist = keylist;
+    entry->symbol = symbol;
+    entry->strict = strict;
+    entry->index = index;
+}
+
+
+//
+//  Is_First_Key_For_Symbol: C
+//
+// Searches skip keys whose variables are hidden in the context, but another
+// context sharing the same keylist might not have them hidden.  So a position
+// can only be cached for the keylist if no earlier key matches.
+//
+bool Is_First_Key_For_Symbol(
+    Keylist(const*) keylist,
+    Symbol(const*) symbol,
+    bool strict,
+    REBLEN index
+){
+    const REBKEY *keys = SER_HEAD(const REBKEY, keylist);
+    REBLEN n;
+    for (n = 1; n < index; ++n) {
+        Symbol(const*) key_symbol = KEY_SYMBOL(&keys[n - 1]);
+        if (strict ? key_symbol == symbol : Are_Synonyms(symbol, key_symbol))
+            return false;
+    }
+    return true;
+}
+
+
 //
 //  Find_Symbol_In_Context: C
 //
@@ -814,6 +1139,11 @@ Array(*) Context_To_Array(Cell(const*) context, REBINT mode)
 // Note that since contexts like FRAME! can have multiple keys with the same
 // name, the VAL_FRAME_PHASE() of the context has to be taken into account.
 //
+// 1. Objects made the same way share a keylist, so a PICK or path access of
+//    the same field in each of them finds the position in the field cache.
+//    See FIELD_CACHE_SIZE.  (If the key was hidden in this context, a later
+//    key of the same name might be visible, so fall through to searching.)
+//
 REBLEN Find_Symbol_In_Context(
     Cell(const*) context,
     Symbol(const*) symbol,
@@ -828,6 +1158,57 @@ REBLEN Find_Symbol_In_Context(
         return MOD_VAR(c, symbol, strict) ? INDEX_ATTACHED : 0;
     }
 
+    struct Reb_Field_Cache_Entry *entry = nullptr;
+
+    enum Reb_Kind heart = CELL_HEART(context);
+    if (ANY_CONTEXT_KIND(heart) and heart != REB_FRAME) {  // frames have lenses
+        Context(*) c = VAL_CONTEXT(context);
+        Keylist(*) keylist = CTX_KEYLIST(c);
+
+        entry = Field_Cache_Entry(keylist, symbol);
+        if (
+            entry->keylist == keylist
+            and entry->symbol == symbol
+            and entry->strict == strict
+            and Not_Cell_Flag(CTX_VAR(c, entry->index), VAR_MARKED_HIDDEN)
+        ){
+            return entry->index;  // found in this keylist before, see [1]
+        }
+
+        if (
+            SER_USED(keylist) >= KEYLIST_INDEX_MIN_KEYS
+            and Not_Subclass_Flag(KEYLIST, keylist, INDEXED)
+        ){
+            Index_Keylist(keylist);
+        }
+
+        if (Get_Subclass_Flag(KEYLIST, keylist, INDEXED)) {
+            REBLEN n;
+            if (strict)
+                n = Find_Keylist_Index(keylist, symbol);
+            else {  // first position of any synonym
+                n = 0;
+                Symbol(const*) synonym = symbol;
+                do {
+                    REBLEN i = Find_Keylist_Index(keylist, synonym);
+                    if (i != 0 and (n == 0 or i < n))
+                        n = i;
+                } while ((synonym = LINK(Synonym, synonym)) != symbol);
+            }
+
+            if (n == 0)
+                return 0;
+
+            // A hidden key is skipped by the enumeration below, which would
+            // then find any later occurrence.  Let it do that.
+            //
+            if (Not_Cell_Flag(CTX_VAR(c, n), VAR_MARKED_HIDDEN)) {
+                Remember_Field(entry, keylist, symbol, strict, n);
+                return n;
+            }
+        }
+    }
+
     EVARS e;
     Init_Evars(&e, context);
 
@@ -842,6 +1223,12 @@ REBLEN Find_Symbol_In_Context(
         }
 
         Shutdown_Evars(&e);
+
+        if (entry) {  // only if not after a hidden key, see [1]
+            Keylist(*) keylist = CTX_KEYLIST(VAL_CONTEXT(context));
+            if (Is_First_Key_For_Symbol(keylist, symbol, strict, e.index))
+                Remember_Field(entry, keylist, symbol, strict, e.index);
+        }
         return e.index;
     }
 
@@ -167,6 +167,9 @@ ATTRIBUTE_NO_RETURN void Fail_Core(const void *p)
     if (error != Error_No_Memory(1020))  // static global, review
         Force_Location_Of_Error(error, TOP_FRAME);
 
+    if (Trace_Logging)  // see TRACE-LOG
+        Trace_Log_Fail(TOP_FRAME, error);
+
   #if DEBUG_HAS_PROBE
     if (PG_Probe_Failures) {  // see R3_PROBE_FAILURES environment variable
         static bool probing = false;
@@ -287,6 +290,43 @@ const REBVAL *Find_Error_For_Sym(enum Reb_Symbol_Id id_sym)
 }
 
 
+// Fill in the file and line information of an error from the stack, looking
+// for arrays with ARRAY_HAS_FILE_LINE.  Information already there is kept,
+// since the first frame to set it is the closest to the error.
+//
+static void Set_File_Line_Of_Error(ERROR_VARS *vars, Frame(*) where)
+{
+    if (not Is_Nulled(&vars->line))
+        return;
+
+    Frame(*) f = where;
+    for (; f != BOTTOM_FRAME; f = f->prior) {
+        if (FRM_IS_VARIADIC(f)) {
+            //
+            // !!! We currently skip any calls from C (e.g. rebValue()) and look
+            // for calls from Rebol files for the file and line.  However,
+            // rebValue() might someday supply its C code __FILE__ and __LINE__,
+            // which might be interesting to put in the error instead.
+            //
+            continue;
+        }
+        if (Not_Subclass_Flag(ARRAY, FRM_ARRAY(f), HAS_FILE_LINE_UNMASKED))
+            continue;
+        break;
+    }
+
+    if (f != BOTTOM_FRAME) {  // found a frame with file and line information
+        String(const*) file = LINK(Filename, FRM_ARRAY(f));
+        LineNumber line = FRM_ARRAY(f)->misc.line;
+
+        if (file)
+            Init_File(&vars->file, file);
+        if (line != 0)
+            Init_Integer(&vars->line, line);
+    }
+}
+
+
 //
 //  Set_Location_Of_Error: C
 //
@@ -304,6 +344,8 @@ void Set_Location_Of_Error(
     Context(*) error,
     Frame(*) where  // must be valid and executing on the stack
 ) {
+    Finish_Lazy_Location_Of_Error(error);  // a NEAR from RAISE is kept
+
     while (Get_Frame_Flag(where, BLAME_PARENT))  // e.g. Apply_Only_Throws()
         where = where->prior;
 
@@ -348,34 +390,68 @@ void Set_Location_Of_Error(
     if (Is_Nulled(&vars->nearest))
         Init_Near_For_Frame(&vars->nearest, where);
 
-    // Try to fill in the file and line information of the error from the
-    // stack, looking for arrays with ARRAY_HAS_FILE_LINE.
-    //
-    f = where;
-    for (; f != BOTTOM_FRAME; f = f->prior) {
-        if (FRM_IS_VARIADIC(f)) {
-            //
-            // !!! We currently skip any calls from C (e.g. rebValue()) and look
-            // for calls from Rebol files for the file and line.  However,
-            // rebValue() might someday supply its C code __FILE__ and __LINE__,
-            // which might be interesting to put in the error instead.
-            //
-            continue;
-        }
-        if (Not_Subclass_Flag(ARRAY, FRM_ARRAY(f), HAS_FILE_LINE_UNMASKED))
-            continue;
-        break;
-    }
+    Set_File_Line_Of_Error(vars, where);
+}
 
-    if (f != BOTTOM_FRAME) {  // found a frame with file and line information
-        String(const*) file = LINK(Filename, FRM_ARRAY(f));
-        LineNumber line = FRM_ARRAY(f)->misc.line;
 
-        if (file)
-            Init_File(&vars->file, file);
-        if (line != 0)
-            Init_Integer(&vars->line, line);
+//
+//  Set_Lazy_Location_Of_Error: C
+//
+// The cheap part of Set_Location_Of_Error(), for definitional errors that
+// will often be trapped and discarded.  NEAR is just a BLOCK! at the frame's
+// position (no copying), file and line are filled in, and WHERE is left null.
+// If the error escapes as an abrupt failure, Force_Location_Of_Error() makes
+// the WHERE from the stack at that point.  NEAR becomes the usual excerpt
+// when the error is molded or the location is forced.
+//
+void Set_Lazy_Location_Of_Error(
+    Context(*) error,
+    Frame(*) where  // must be valid and executing on the stack
+){
+    while (Get_Frame_Flag(where, BLAME_PARENT))  // e.g. Apply_Only_Throws()
+        where = where->prior;
+
+    ERROR_VARS *vars = ERR_VARS(error);
+
+    if (Is_Nulled(&vars->nearest) and not FRM_IS_VARIADIC(where)) {
+        Init_Array_Cell_At_Core(
+            &vars->nearest,
+            REB_BLOCK,
+            FRM_ARRAY(where),
+            FRM_INDEX(where),
+            FEED_SPECIFIER(where->feed)
+        );
+        Set_Subclass_Flag(VARLIST, CTX_VARLIST(error), ERROR_LOCATION_LAZY);
     }
+
+    Set_File_Line_Of_Error(vars, where);
+}
+
+
+//
+//  Finish_Lazy_Location_Of_Error: C
+//
+// Turn the NEAR position left by Set_Lazy_Location_Of_Error() into the same
+// excerpt (with `**` at the error point) that Init_Near_For_Frame() makes.
+//
+void Finish_Lazy_Location_Of_Error(Context(*) error)
+{
+    if (Not_Subclass_Flag(VARLIST, CTX_VARLIST(error), ERROR_LOCATION_LAZY))
+        return;
+    Clear_Subclass_Flag(VARLIST, CTX_VARLIST(error), ERROR_LOCATION_LAZY);
+
+    ERROR_VARS *vars = ERR_VARS(error);
+    if (not IS_BLOCK(&vars->nearest))  // overwritten since, e.g. `e.near: 10`
+        return;
+
+    DECLARE_LOCAL (position);
+    Copy_Cell(position, SPECIFIC(&vars->nearest));
+    Init_Near_For_Array_At(
+        &vars->nearest,
+        VAL_ARRAY(position),
+        VAL_INDEX(position),
+        VAL_SPECIFIER(position)
+    );
 }
 
 
@@ -1407,6 +1483,8 @@ static void Mold_Value_Limit(REB_MOLD *mo, Cell(*) v, REBLEN limit)
 //
 void MF_Error(REB_MOLD *mo, noquote(Cell(const*)) v, bool form)
 {
+    Finish_Lazy_Location_Of_Error(VAL_CONTEXT(v));  // error is being looked at
+
     // Protect against recursion. !!!!
     //
     if (not form) {
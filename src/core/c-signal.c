@@ -72,6 +72,9 @@
 //
 bool Do_Signals_Throws(Frame(*) frame_)
 {
+  #if REBOL_TIMER_SIGNALS
+    Eval_Poll = 0;  // before processing, so SET_SIGNAL() in here re-polls
+  #else
     if (Eval_Countdown >= 0) {  // natural countdown or invocation
         //
         // Periodic reconciliation of total evaluation cycles.  Avoids needing
@@ -101,6 +104,7 @@ bool Do_Signals_Throws(Frame(*) frame_)
   #endif
 
     Eval_Countdown = Eval_Dose;
+  #endif
 
     bool thrown = false;
 
@@ -119,6 +123,14 @@ bool Do_Signals_Throws(Frame(*) frame_)
         Recycle();
     }
 
+    if (filtered_sigs & SIG_SWEEP)  // clears itself once sweep is finished
+        Sweep_Pending_Series(GC_Sweep_Budget);
+
+    if (filtered_sigs & SIG_SAMPLE) {
+        CLR_SIGNAL(SIG_SAMPLE);
+        Take_Stack_Sample();
+    }
+
     if (filtered_sigs & SIG_HALT) {
         //
         // Early in the booting process, it's not possible to handle Ctrl-C.
@@ -157,3 +169,60 @@ bool Do_Signals_Throws(Frame(*) frame_)
     Eval_Sigmask = saved_sigmask;
     return thrown;
 }
+
+
+#if REBOL_TIMER_SIGNALS
+
+#include <sys/time.h>  // setitimer()
+
+#define SIGNAL_TIMER_USECS 10000  // poll signals 100 times per CPU second
+
+static struct sigaction Old_Signal_Timer_Action;
+
+
+static void Handle_Signal_Timer(int sig)
+{
+    UNUSED(sig);
+    Eval_Poll = 1;  // only a sig_atomic_t store is safe in a handler
+}
+
+
+//
+//  Startup_Signal_Timer: C
+//
+// SIGVTALRM counts user CPU time, so an idle or blocked interpreter is not
+// woken up by it.  (SIGPROF is left for SAMPLE-STACK.)
+//
+void Startup_Signal_Timer(void)
+{
+    Eval_Poll = 0;
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &Handle_Signal_Timer;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;  // don't make blocking I/O see EINTR
+    if (sigaction(SIGVTALRM, &action, &Old_Signal_Timer_Action) != 0)
+        panic ("Could not install SIGVTALRM handler for signal polling");
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = SIGNAL_TIMER_USECS;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_VIRTUAL, &timer, nullptr) != 0)
+        panic ("Could not arm ITIMER_VIRTUAL for signal polling");
+}
+
+
+//
+//  Shutdown_Signal_Timer: C
+//
+void Shutdown_Signal_Timer(void)
+{
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_VIRTUAL, &timer, nullptr);
+    sigaction(SIGVTALRM, &Old_Signal_Timer_Action, nullptr);
+}
+
+#endif
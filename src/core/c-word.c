@@ -106,45 +106,104 @@ REBINT Get_Hash_Prime_May_Fail(REBLEN minimum)
 }
 
 
-// Removals from linear probing lists can be complex, because the same
-// overflow slot may be visited through different initial hashes:
-//
-// http://stackoverflow.com/a/279812/211160
-//
-// Since it's not enough to simply NULL out the spot when an interned string
-// is GC'd, a special pointer signaling "deletedness" is used.  It does not
-// cause a linear probe to terminate, but it is reused on insertions.
+// The symbol table is a power-of-two sized open addressing table, using
+// linear probing with "Robin Hood" insertion:
+//
+// https://programming.guide/robin-hood-hashing.html
+//
+// Each slot's symbol has its caseless hash stored in a parallel series, so
+// probing can skip spelling comparisons on mismatched hashes, and expansion
+// never has to rehash spellings.  An entry's distance from its "home" slot
+// (the hash masked to the table size) is computable from its stored hash.
+// Insertion displaces any entry that is closer to home than the one being
+// inserted, which keeps probe lengths even and lets a search stop as soon as
+// it reaches an entry closer to home than the search has gone.
+//
+// Removal shifts the following entries back instead of using a "deleted"
+// marker, so the table never fills up with tombstones.
+//
+inline static REBLEN Symbol_Home_Distance(
+    REBLEN hash,
+    REBLEN slot,
+    REBLEN num_slots
+){
+    return (slot - hash) & (num_slots - 1);
+}
+
+
+// Place a symbol in the table, starting at `slot` (`dist` from its home),
+// displacing entries that are closer to their home than it is.
 //
-#define DELETED_SYMBOL &PG_Deleted_Symbol
+static void Insert_Symbol_Robin_Hood(
+    Symbol(*) *symbols_by_hash,
+    REBLEN *hashes,
+    REBLEN num_slots,
+    Symbol(*) symbol,
+    REBLEN hash,
+    REBLEN slot,
+    REBLEN dist
+){
+    while (symbols_by_hash[slot]) {
+        REBLEN their_dist = Symbol_Home_Distance(hashes[slot], slot, num_slots);
+        if (their_dist < dist) {  // take from the rich, give to the poor
+            Symbol(*) temp_symbol = symbols_by_hash[slot];
+            symbols_by_hash[slot] = symbol;
+            symbol = temp_symbol;
+
+            REBLEN temp_hash = hashes[slot];
+            hashes[slot] = hash;
+            hash = temp_hash;
+
+            dist = their_dist;
+        }
+        slot = (slot + 1) & (num_slots - 1);
+        ++dist;
+    }
+    symbols_by_hash[slot] = symbol;
+    hashes[slot] = hash;
+}
 
 
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Double the size of the symbol table.  Entries are reinserted using their
+// stored hashes, so no spellings need to be hashed again.
+//
+// !!! This is done all at once.  Spreading it out would mean every lookup
+// (and everything that walks the table, like the GC's patch marking) would
+// have to consult two tables while it was in progress.  Since the table
+// doubles, the cost is amortized to a reinsertion per symbol interned.
 //
 static void Expand_Word_Table(void)
 {
-    // The only full list of symbol words available is the old hash table.
-    // Hold onto it while creating the new hash table.
-
     REBLEN old_num_slots = SER_USED(PG_Symbols_By_Hash);
     Symbol(*) *old_symbols_by_hash = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
+    REBLEN *old_hashes = SER_HEAD(REBLEN, PG_Symbol_Hashes);
 
-    REBLEN num_slots = Get_Hash_Prime_May_Fail(old_num_slots + 1);
+    REBLEN num_slots = old_num_slots * 2;
+    if (num_slots < old_num_slots) {  // overflowed
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, old_num_slots);
+        fail (Error_Size_Limit_Raw(temp));
+    }
     assert(SER_WIDE(PG_Symbols_By_Hash) == sizeof(Symbol(*)));
 
+    TRACEPOINT2(symbols__expand, old_num_slots, num_slots);
+
     REBSER *ser = Make_Series_Core(
         num_slots, FLAG_FLAVOR(CANONTABLE) | SERIES_FLAG_POWER_OF_2
     );
     Clear_Series(ser);
     SET_SERIES_LEN(ser, num_slots);
 
-    // Rehash all the symbols:
+    REBSER *hashes_ser = Make_Series_Core(
+        num_slots, FLAG_FLAVOR(HASHLIST) | SERIES_FLAG_POWER_OF_2
+    );
+    SET_SERIES_LEN(hashes_ser, num_slots);  // only read for occupied slots
 
     Symbol(*) *new_symbols_by_hash = SER_HEAD(Symbol(*), ser);
+    REBLEN *new_hashes = SER_HEAD(REBLEN, hashes_ser);
 
     REBLEN old_slot;
     for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
@@ -152,31 +211,23 @@ static void Expand_Word_Table(void)
         if (not symbol)
             continue;
 
-        if (symbol == DELETED_SYMBOL) {  // clean out deleted symbol entries
-            --PG_Num_Symbol_Slots_In_Use;
-          #if !defined(NDEBUG)
-            --PG_Num_Symbol_Deleteds;  // keep track for shutdown assert
-          #endif
-            continue;
-        }
-
-        REBLEN skip;
-        REBLEN slot = First_Hash_Candidate_Slot(
-            &skip,
-            Hash_String(symbol),
-            num_slots
+        REBLEN hash = old_hashes[old_slot];
+        Insert_Symbol_Robin_Hood(
+            new_symbols_by_hash,
+            new_hashes,
+            num_slots,
+            symbol,
+            hash,
+            hash & (num_slots - 1),
+            0
         );
-
-        while (new_symbols_by_hash[slot]) {  // skip occupied slots
-            slot += skip;
-            if (slot >= num_slots)
-                slot -= num_slots;
-        }
-        new_symbols_by_hash[slot] = symbol;
     }
 
     Free_Unmanaged_Series(PG_Symbols_By_Hash);
     PG_Symbols_By_Hash = ser;
+
+    Free_Unmanaged_Series(PG_Symbol_Hashes);
+    PG_Symbol_Hashes = hashes_ser;
 }
 
 
@@ -204,75 +255,60 @@ Symbol(const*) Intern_UTF8_Managed_Core(
     const Byte* utf8,
     size_t size
 ){
-    // The hashing technique used is called "linear probing":
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // For the hash search to be guaranteed to terminate, the table must be
-    // large enough that we are able to find a NULL if there's a miss.  (It's
-    // actually kept larger than that, but to be on the right side of theory,
-    // the table is always checked for expansion needs *before* the search.)
+    // For the search to be guaranteed to terminate, the table must have an
+    // empty slot.  (It's kept a good deal emptier than that, since probe
+    // lengths grow quickly as the table fills.)  Check for expansion needs
+    // *before* the search, so the slot the search ends on can be used.
     //
     REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
-    if (PG_Num_Symbol_Slots_In_Use > num_slots / 2) {
+    if (PG_Num_Symbol_Slots_In_Use >= num_slots - (num_slots / 4)) {
         Expand_Word_Table();
         num_slots = SER_USED(PG_Symbols_By_Hash);  // got larger
     }
 
     Symbol(*) *symbols_by_hash = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
+    REBLEN *hashes = SER_HEAD(REBLEN, PG_Symbol_Hashes);
 
-    REBLEN skip; // how many slots to skip when occupied candidates found
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_Scan_UTF8_Caseless_May_Fail(utf8, size),
-        num_slots
-    );
+    REBLEN hash = Hash_Scan_UTF8_Caseless_May_Fail(utf8, size);
+    REBLEN slot = hash & (num_slots - 1);
+    REBLEN dist = 0;  // how far the search is from the home slot
 
-    // The hash table only indexes the canon form of each spelling.  So when
-    // testing a slot to see if it's a match (or a collision that needs to
-    // be skipped to try again) the search uses a comparison that is
-    // case-insensitive...but reports if synonyms via > 0 results.
+    // All spellings are in the table, and alternate casings of a spelling
+    // have the same caseless hash.  So when testing a slot to see if it's a
+    // match, the search uses a comparison that is case-insensitive...but
+    // reports if synonyms via > 0 results.
     //
     Symbol(*) synonym = nullptr;
-    Symbol(*) *deleted_slot = nullptr;
     Symbol(*) symbol;
     while ((symbol = symbols_by_hash[slot])) {
-        if (symbol == DELETED_SYMBOL) {
-            deleted_slot = &symbols_by_hash[slot];
-            goto next_candidate_slot;
-        }
-
-      blockscope {
-        REBINT cmp = Compare_UTF8(STR_HEAD(symbol), utf8, size);
-        if (cmp == 0) {
-            assert(not preallocated);
-            return symbol;  // was a case-sensitive match
+        if (Symbol_Home_Distance(hashes[slot], slot, num_slots) < dist)
+            break;  // we'd have displaced this entry, so no more candidates
+
+        if (hashes[slot] == hash) {
+            REBINT cmp = Compare_UTF8(STR_HEAD(symbol), utf8, size);
+            if (cmp == 0) {
+                assert(not preallocated);
+                return symbol;  // was a case-sensitive match
+            }
+
+            // The > 0 result means that the canon word that was found is an
+            // alternate casing ("synonym") for the string we're interning.
+            // The synonyms are attached to the canon form with a circular
+            // list.
+            //
+            if (cmp > 0)
+                synonym = symbol;  // save for linking into synonyms list
         }
-        if (cmp < 0)
-            goto next_candidate_slot;  // wasn't an alternate casing
 
-        // The > 0 result means that the canon word that was found is an
-        // alternate casing ("synonym") for the string we're interning.  The
-        // synonyms are attached to the canon form with a circular list.
-        //
-        synonym = symbol;  // save for linking into synonyms list
-        goto next_candidate_slot;
-      }
-
-        goto new_interning;  // no synonym matched, make new synonym for canon
-
-      next_candidate_slot:  // https://en.wikipedia.org/wiki/Linear_probing
-
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
+        slot = (slot + 1) & (num_slots - 1);
+        ++dist;
     }
 
   new_interning: {
 
     Binary(*) s = BIN(Make_Series_Into(
         preallocated ? unwrap(preallocated) : Alloc_Stub(),
-        size + 1,  // if small, fits in a REBSER node (no data allocation)
+        Symbol_Hash_Offset(size) + sizeof(uint32_t),  // see Hash_Symbol()
         FLAG_FLAVOR(SYMBOL) | SERIES_FLAG_FIXED_SIZE | NODE_FLAG_MANAGED
     ));
 
@@ -324,12 +360,28 @@ Symbol(const*) Intern_UTF8_Managed_Core(
     }
   }
 
+  blockscope {  // lets STR_AT() and STR_LEN() treat bytes as codepoints
+    REBLEN i;
+    for (i = 0; i < size; ++i) {
+        if (utf8[i] >= 0x80)
+            break;
+    }
+    if (i == size)
+        Set_Subclass_Flag(SYMBOL, s, ALL_ASCII);
+  }
+
     // The incoming string isn't always null terminated, e.g. if you are
     // interning `foo` in `foo: bar + 1` it would be colon-terminated.
     //
     memcpy(BIN_HEAD(s), utf8, size);
     TERM_BIN_LEN(s, size);
 
+    // Cache the caseless hash past the terminator, so hashing a WORD! for a
+    // MAP! key or set operation doesn't have to rehash the spelling.  If the
+    // spelling is small, this still fits in the REBSER node.
+    //
+    *cast(uint32_t*, BIN_HEAD(s) + Symbol_Hash_Offset(size)) = hash;
+
     // The UTF-8 series can be aliased with AS to become an ANY-STRING! or a
     // BINARY!.  If it is, then it should not be modified.
     //
@@ -376,16 +428,10 @@ Symbol(const*) Intern_UTF8_Managed_Core(
     //
     mutable_MISC(Hitch, s) = s;
 
-    if (deleted_slot) {
-        *deleted_slot = SYM(s);  // reuse the deleted slot
-      #if !defined(NDEBUG)
-        --PG_Num_Symbol_Deleteds;  // note slot usage count stays constant
-      #endif
-    }
-    else {
-        symbols_by_hash[slot] = SYM(s);
-        ++PG_Num_Symbol_Slots_In_Use;
-    }
+    Insert_Symbol_Robin_Hood(  // search ended where it can go
+        symbols_by_hash, hashes, num_slots, SYM(s), hash, slot, dist
+    );
+    ++PG_Num_Symbol_Slots_In_Use;
 
     return SYM(s);
   }
@@ -450,44 +496,32 @@ void GC_Kill_Interning(String(*) intern)
 
     REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
     Symbol(*) *symbols_by_hash = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
+    REBLEN *hashes = SER_HEAD(REBLEN, PG_Symbol_Hashes);
 
-    REBLEN skip;
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_String(intern),
-        num_slots
-    );
+    REBLEN slot = Hash_Symbol(SYM(intern)) & (num_slots - 1);
 
-    // We *will* find the canon form in the hash table.
+    // We *will* find the interning in the hash table.
     //
-    while (symbols_by_hash[slot] != intern) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
-    }
+    while (symbols_by_hash[slot] != intern)
+        slot = (slot + 1) & (num_slots - 1);
 
-    // This canon form must be removed from the hash table.  Ripple the
-    // collision slots back until a NULL is found, to reduce search times.
+    // Shift entries after it back a slot, until reaching an empty slot or an
+    // entry that is already in its home slot.  This maintains the Robin Hood
+    // invariant without needing a "deleted" marker.
     //
-    REBLEN previous_slot = slot;
-    while (symbols_by_hash[slot]) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
-        symbols_by_hash[previous_slot] = symbols_by_hash[slot];
+    REBLEN next = (slot + 1) & (num_slots - 1);
+    while (
+        symbols_by_hash[next]
+        and Symbol_Home_Distance(hashes[next], next, num_slots) != 0
+    ){
+        symbols_by_hash[slot] = symbols_by_hash[next];
+        hashes[slot] = hashes[next];
+        slot = next;
+        next = (next + 1) & (num_slots - 1);
     }
+    symbols_by_hash[slot] = nullptr;
 
-    // Signal that the hash slot is "deleted" via a special pointer.
-    // See notes on DELETED_SLOT for why the final slot in the collision
-    // chain can't just be left NULL:
-    //
-    // http://stackoverflow.com/a/279812/211160
-    //
-    symbols_by_hash[previous_slot] = DELETED_SYMBOL;
-
-  #if !defined(NDEBUG)
-    ++PG_Num_Symbol_Deleteds;  // total use same (PG_Num_Symbols_Or_Deleteds)
-  #endif
+    --PG_Num_Symbol_Slots_In_Use;
 }
 
 
@@ -504,24 +538,19 @@ void GC_Kill_Interning(String(*) intern)
 void Startup_Interning(void)
 {
     PG_Num_Symbol_Slots_In_Use = 0;
-  #if !defined(NDEBUG)
-    PG_Num_Symbol_Deleteds = 0;
-  #endif
 
-    // Start hash table out at a fixed size.  When collisions occur, it
-    // causes a skipping pattern that continues until it finds the desired
-    // slot.  The method is known as linear probing:
+    // Start hash table out at a fixed size, which must be a power of 2 (see
+    // notes on Insert_Symbol_Robin_Hood()).
     //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // It must always be at least as big as the total number of words, in order
-    // for it to uniquely be able to locate each symbol pointer.  But to
-    // reduce long probing chains, it should be significantly larger than that.
+    // It must always be bigger than the total number of words, in order to
+    // be able to locate each symbol pointer and end searches on empty slots.
     // R3-Alpha used a heuristic of 4 times as big as the number of words.
 
     REBLEN n;
   #if defined(NDEBUG)
-    n = Get_Hash_Prime_May_Fail(WORD_TABLE_SIZE * 4);  // *4 reduces rehashing
+    n = 1;
+    while (n < WORD_TABLE_SIZE * 4)  // *4 reduces rehashing
+        n *= 2;
   #else
     n = 1; // forces exercise of rehashing logic in debug build
   #endif
@@ -531,6 +560,11 @@ void Startup_Interning(void)
     );
     Clear_Series(PG_Symbols_By_Hash);  // all slots start as nullptr
     SET_SERIES_LEN(PG_Symbols_By_Hash, n);
+
+    ensureNullptr(PG_Symbol_Hashes) = Make_Series_Core(
+        n, FLAG_FLAVOR(HASHLIST) | SERIES_FLAG_POWER_OF_2
+    );
+    SET_SERIES_LEN(PG_Symbol_Hashes, n);  // only read for occupied slots
 }
 
 
@@ -601,6 +635,16 @@ void Startup_Symbols(void)
 
     if (0 != strcmp("parse-reject", STR_UTF8(Canon(PARSE_REJECT))))
         panic (Canon(PARSE_REJECT));
+
+    // Verbs in %verb-hooks.r can go straight to a C function for some types,
+    // skipping the REBTYPE() switch.  Index them so Run_Generic_Dispatch()
+    // only needs the verb's SymId to know whether to look.
+    //
+    memset(PG_Verb_Hook_Indices, VERB_HOOK_0, sizeof(PG_Verb_Hook_Indices));
+
+    REBLEN hook;
+    for (hook = VERB_HOOK_0 + 1; hook < VERB_HOOK_MAX; ++hook)
+        PG_Verb_Hook_Indices[Verb_Hook_Syms[hook]] = cast(Byte, hook);
 }
 
 
@@ -626,7 +670,7 @@ void Shutdown_Symbols(void)
 void Shutdown_Interning(void)
 {
   #if !defined(NDEBUG)
-    if (PG_Num_Symbol_Slots_In_Use - PG_Num_Symbol_Deleteds != 0) {
+    if (PG_Num_Symbol_Slots_In_Use != 0) {
         //
         // !!! There needs to be a more user-friendly output for this,
         // and to detect if it really was an API problem or something else
@@ -635,7 +679,7 @@ void Shutdown_Interning(void)
         //
         printf(
             "!!! %d leaked canons found in shutdown\n",
-            cast(int, PG_Num_Symbol_Slots_In_Use - PG_Num_Symbol_Deleteds)
+            cast(int, PG_Num_Symbol_Slots_In_Use)
         );
         printf("!!! LIKELY rebUnmanage() without a rebRelease() in API\n");
 
@@ -644,7 +688,7 @@ void Shutdown_Interning(void)
         REBLEN slot;
         for (slot = 0; slot < SER_USED(PG_Symbols_By_Hash); ++slot) {
             Symbol(*) symbol = *SER_AT(Symbol(*), PG_Symbols_By_Hash, slot);
-            if (symbol and symbol != DELETED_SYMBOL)
+            if (symbol)
                 panic (symbol);
         }
     }
@@ -652,4 +696,7 @@ void Shutdown_Interning(void)
 
     Free_Unmanaged_Series(PG_Symbols_By_Hash);
     PG_Symbols_By_Hash = nullptr;
+
+    Free_Unmanaged_Series(PG_Symbol_Hashes);
+    PG_Symbol_Hashes = nullptr;
 }
@@ -89,6 +89,8 @@ ATTRIBUTE_NO_RETURN void Panic_Core(
 
     panicking = true;
 
+    Dump_Trace_Log();  // only if TRACE-LOG/CRASH gave a file
+
     // Delivering a panic should not rely on printf()/etc. in release build.
 
     char buf[PANIC_BUF_SIZE + 1];
@@ -0,0 +1,1343 @@
+//
+//  File: %d-profile.c
+//  Summary: "Sampling profiler producing collapsed stacks for flamegraphs"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// TRACE prints every evaluator step, which makes it far too slow to say
+// where the time in a real program goes.  This instead arms a CPU timer
+// (SIGPROF) whose handler does nothing but SET_SIGNAL(SIG_SAMPLE).  The
+// next evaluator tick then reaches Do_Signals_Throws(), which walks the
+// frame stack and counts the stack it saw.  So between samples, the cost is
+// only the Eval_Countdown check the evaluator was paying already.
+//
+// Stacks are tallied in a small C hash table keyed by the bytes of the
+// collapsed stack (no series, so sampling never allocates GC'd memory or
+// disturbs a mold in progress).  SAMPLE-STACK/STOP renders them in the
+// "collapsed" format used by flamegraph tools:
+//
+//     main@%script.r:10;process@%script.r:3;parse 57
+//
+// Each frame is the label of a running action, plus the file and line of
+// the array it was invoked from when that array has file/line information.
+//
+// PROFILE-CALLS is the deterministic counterpart: while it is on, every
+// Begin_Action_Core() pushes a record and Drop_Action() pops it, crediting
+// the action with a call, its time with and without its callees, and the
+// stubs allocated meanwhile.  When it is off the only cost is the test of
+// the Profile_Calls flag in those two places.
+//
+
+#include "sys-core.h"
+
+#if REBOL_SAMPLING_PROFILER
+    #include <signal.h>
+    #include <sys/time.h>  // setitimer()
+#endif
+
+
+struct Stack_Sample {
+    Byte* stack;  // collapsed stack, not terminated (nullptr if slot unused)
+    Size size;
+    uint32_t hash;
+    REBI64 count;
+    REBI64 bytes;  // only used by SAMPLE-ALLOCS
+};
+
+static bool Sampling;
+
+static struct Stack_Sample *Samples;
+static REBLEN Samples_Capacity;  // always a power of 2 (or 0)
+static REBLEN Samples_Used;
+
+static Byte* Sample_Buffer;  // reused to build each stack before lookup
+static Size Sample_Buffer_Size;
+
+
+#define SAMPLE_SEPARATOR ';'
+
+
+//
+//  Free_Sample_Table: C
+//
+static void Free_Sample_Table(
+    struct Stack_Sample **table,
+    REBLEN *capacity,
+    REBLEN *used
+){
+    REBLEN i;
+    for (i = 0; i < *capacity; ++i) {
+        if ((*table)[i].stack)
+            FREE_N(Byte, (*table)[i].size, (*table)[i].stack);
+    }
+    if (*capacity != 0)
+        FREE_N(struct Stack_Sample, *capacity, *table);
+
+    *table = nullptr;
+    *capacity = 0;
+    *used = 0;
+}
+
+
+//
+//  Free_Stack_Samples: C
+//
+static void Free_Stack_Samples(void)
+{
+    Free_Sample_Table(&Samples, &Samples_Capacity, &Samples_Used);
+
+    if (Sample_Buffer_Size != 0)
+        FREE_N(Byte, Sample_Buffer_Size, Sample_Buffer);
+    Sample_Buffer = nullptr;
+    Sample_Buffer_Size = 0;
+}
+
+
+//
+//  Find_Sample_Slot: C
+//
+// Linear probe for the stack, returning the slot that has it or the unused
+// slot where it should go.  Table must have at least one unused slot.
+//
+static struct Stack_Sample *Find_Sample_Slot(
+    struct Stack_Sample *table,
+    REBLEN capacity,
+    const Byte* stack,
+    Size size,
+    uint32_t hash
+){
+    REBLEN mask = capacity - 1;
+    REBLEN i = hash & mask;
+    for (; table[i].stack; i = (i + 1) & mask) {
+        if (
+            table[i].hash == hash
+            and table[i].size == size
+            and memcmp(table[i].stack, stack, size) == 0
+        ){
+            break;
+        }
+    }
+    return &table[i];
+}
+
+
+//
+//  Expand_Sample_Table: C
+//
+static bool Expand_Sample_Table(
+    struct Stack_Sample **table_inout,
+    REBLEN *capacity_inout
+){
+    REBLEN old_capacity = *capacity_inout;
+    struct Stack_Sample *old_table = *table_inout;
+
+    REBLEN capacity = old_capacity == 0 ? 64 : old_capacity * 2;
+    struct Stack_Sample *table = TRY_ALLOC_N(struct Stack_Sample, capacity);
+    if (not table)
+        return false;
+    memset(table, 0, sizeof(struct Stack_Sample) * capacity);
+
+    REBLEN i;
+    for (i = 0; i < old_capacity; ++i) {
+        struct Stack_Sample *old = &old_table[i];
+        if (not old->stack)
+            continue;
+        *Find_Sample_Slot(
+            table, capacity, old->stack, old->size, old->hash
+        ) = *old;
+    }
+
+    if (old_capacity != 0)
+        FREE_N(struct Stack_Sample, old_capacity, old_table);
+    *table_inout = table;
+    *capacity_inout = capacity;
+    return true;
+}
+
+
+//
+//  Take_Stack_Sample: C
+//
+// Called from Do_Signals_Throws() when SIG_SAMPLE is set.  The collapsed
+// stack is written backwards into Sample_Buffer, since the frame walk starts
+// at the leaf and flamegraph tools want the root first.
+//
+void Take_Stack_Sample(void)
+{
+    if (not Sampling)
+        return;  // timer fired just before it was disarmed
+
+    char line[24];
+
+    Size needed = 0;
+    Frame(*) f = TOP_FRAME;
+    for (; f != BOTTOM_FRAME; f = f->prior) {
+        if (not Is_Action_Frame(f) or Is_Action_Frame_Fulfilling(f))
+            continue;
+        needed += strsize(Frame_Label_Or_Anonymous_UTF8(f)) + 1;
+        String(const*) file = FRM_FILE(f);
+        if (file)
+            needed += STR_SIZE(file) + 1 + sizeof(line);
+    }
+    if (needed == 0)
+        return;  // nothing but top-level evaluation running
+
+    if (needed > Sample_Buffer_Size) {
+        Byte* buffer = TRY_ALLOC_N(Byte, needed);
+        if (not buffer)
+            return;  // drop the sample rather than fail in a signal
+        if (Sample_Buffer_Size != 0)
+            FREE_N(Byte, Sample_Buffer_Size, Sample_Buffer);
+        Sample_Buffer = buffer;
+        Sample_Buffer_Size = needed;
+    }
+
+    Byte* tail = Sample_Buffer + Sample_Buffer_Size;
+    Byte* pos = tail;
+
+    for (f = TOP_FRAME; f != BOTTOM_FRAME; f = f->prior) {
+        if (not Is_Action_Frame(f) or Is_Action_Frame_Fulfilling(f))
+            continue;
+
+        if (pos != tail)
+            *--pos = SAMPLE_SEPARATOR;
+
+        String(const*) file = FRM_FILE(f);
+        if (file) {
+            int len = snprintf(line, sizeof(line), ":%lu", cast(
+                unsigned long, FRM_LINE(f)
+            ));
+            pos -= len;
+            memcpy(pos, line, len);
+            pos -= STR_SIZE(file);
+            memcpy(pos, STR_UTF8(file), STR_SIZE(file));
+            *--pos = '@';
+        }
+
+        const char* label = Frame_Label_Or_Anonymous_UTF8(f);
+        Size label_size = strsize(label);
+        pos -= label_size;
+        memcpy(pos, label, label_size);
+    }
+
+    Size size = tail - pos;
+    uint32_t hash = cast(uint32_t, Hash_Bytes(pos, size));
+
+    if ((Samples_Used + 1) * 2 > Samples_Capacity) {  // keep load under 1/2
+        if (not Expand_Sample_Table(&Samples, &Samples_Capacity))
+            return;
+    }
+
+    struct Stack_Sample *slot = Find_Sample_Slot(
+        Samples, Samples_Capacity, pos, size, hash
+    );
+    if (not slot->stack) {
+        Byte* stack = TRY_ALLOC_N(Byte, size);
+        if (not stack)
+            return;
+        memcpy(stack, pos, size);
+        slot->stack = stack;
+        slot->size = size;
+        slot->hash = hash;
+        slot->count = 0;
+        ++Samples_Used;
+    }
+    ++slot->count;
+}
+
+
+#if REBOL_SAMPLING_PROFILER
+
+static void Handle_Sample_Signal(int sig)
+{
+    UNUSED(sig);
+    SET_SIGNAL(SIG_SAMPLE);
+}
+
+static struct sigaction Old_Sample_Action;
+
+
+//
+//  Arm_Sample_Timer: C
+//
+// A zero rate disarms the timer and puts back the old SIGPROF handler.
+//
+static bool Arm_Sample_Timer(REBINT rate)
+{
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+
+    if (rate == 0) {
+        setitimer(ITIMER_PROF, &timer, nullptr);
+        sigaction(SIGPROF, &Old_Sample_Action, nullptr);
+        return true;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &Handle_Sample_Signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;  // don't make blocking I/O see EINTR
+    if (sigaction(SIGPROF, &action, &Old_Sample_Action) != 0)
+        return false;
+
+    long usec = 1000000 / rate;
+    timer.it_interval.tv_sec = usec / 1000000;
+    timer.it_interval.tv_usec = usec % 1000000;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        sigaction(SIGPROF, &Old_Sample_Action, nullptr);
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+
+//
+//  sample-stack: native [
+//
+//  {Sample the frame stack on a CPU timer, for use with flamegraph tools}
+//
+//      return: "With /STOP, one `root;...;leaf count` line per stack seen"
+//          [<opt> text!]
+//      /rate "Samples per second of CPU time when starting (default 1000)"
+//          [integer!]
+//      /stop "Stop sampling and return the collapsed stacks gathered"
+//  ]
+//
+DECLARE_NATIVE(sample_stack)
+{
+    INCLUDE_PARAMS_OF_SAMPLE_STACK;
+
+    if (REF(stop)) {
+        if (REF(rate))
+            fail (Error_Bad_Refines_Raw());
+
+        if (not Sampling)
+            return nullptr;
+
+      #if REBOL_SAMPLING_PROFILER
+        Arm_Sample_Timer(0);
+      #endif
+        Sampling = false;
+        CLR_SIGNAL(SIG_SAMPLE);
+
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        REBLEN i;
+        for (i = 0; i < Samples_Capacity; ++i) {
+            struct Stack_Sample *s = &Samples[i];
+            if (not s->stack)
+                continue;
+            Append_Utf8(mo->series, cs_cast(s->stack), s->size);
+            Append_Codepoint(mo->series, ' ');
+            Append_Int(mo->series, cast(REBINT, s->count));
+            Append_Codepoint(mo->series, '\n');
+        }
+
+        Free_Stack_Samples();
+        return Init_Text(OUT, Pop_Molded_String(mo));
+    }
+
+    if (Sampling)
+        fail ("SAMPLE-STACK is already running, use SAMPLE-STACK/STOP");
+
+    REBINT rate = REF(rate) ? VAL_INT32(ARG(rate)) : 1000;
+    if (rate <= 0 or rate > 1000000)
+        fail (PARAM(rate));
+
+  #if REBOL_SAMPLING_PROFILER
+    Free_Stack_Samples();
+    Sampling = true;  // set before the first signal can arrive
+    if (not Arm_Sample_Timer(rate)) {
+        Sampling = false;
+        fail ("Could not arm the SIGPROF timer for SAMPLE-STACK");
+    }
+    return nullptr;
+  #else
+    fail ("SAMPLE-STACK needs a build with REBOL_SAMPLING_PROFILER");
+  #endif
+}
+
+
+
+//=//// PER-ACTION CALL PROFILING /////////////////////////////////////////=//
+//
+// Counts are kept per action identity (its details array), in a C table
+// whose entries index into a managed BLOCK! of the actions seen.  That
+// block is held by an API handle so neither the actions nor their labels
+// can be GC'd and have their addresses reused while profiling.
+//
+// Recursive calls each add their whole time to the inclusive total, as in
+// gprof.  The exclusive totals always add up to the time spent.
+//
+
+struct Call_Profile {
+    Array(*) identity;  // nullptr if slot unused
+    REBLEN index;  // of the action in Profiled_Actions
+    REBI64 calls;
+    clock_t inclusive;
+    clock_t exclusive;
+    REBI64 stubs;
+};
+
+struct Call_Record {
+    Frame(*) frame;
+    struct Call_Profile *profile;
+    clock_t start;
+    clock_t callees;
+    REBI64 stubs_start;
+};
+
+static struct Call_Profile *Call_Profiles;
+static REBLEN Call_Profiles_Capacity;  // always a power of 2 (or 0)
+static REBLEN Call_Profiles_Used;
+
+static struct Call_Record *Call_Records;  // parallels the action frames
+static REBLEN Call_Records_Capacity;
+static REBLEN Call_Records_Used;
+
+static REBVAL *Profiled_Actions;  // API handle to BLOCK!, or nullptr
+
+
+//
+//  Free_Call_Profiles: C
+//
+static void Free_Call_Profiles(void)
+{
+    if (Call_Profiles_Capacity != 0)
+        FREE_N(struct Call_Profile, Call_Profiles_Capacity, Call_Profiles);
+    Call_Profiles = nullptr;
+    Call_Profiles_Capacity = 0;
+    Call_Profiles_Used = 0;
+
+    if (Call_Records_Capacity != 0)
+        FREE_N(struct Call_Record, Call_Records_Capacity, Call_Records);
+    Call_Records = nullptr;
+    Call_Records_Capacity = 0;
+    Call_Records_Used = 0;
+
+    if (Profiled_Actions) {
+        rebRelease(Profiled_Actions);
+        Profiled_Actions = nullptr;
+    }
+}
+
+
+//
+//  Find_Call_Profile_Slot: C
+//
+static struct Call_Profile *Find_Call_Profile_Slot(
+    struct Call_Profile *table,
+    REBLEN capacity,
+    Array(*) identity
+){
+    REBLEN mask = capacity - 1;
+    REBLEN i = (cast(uintptr_t, identity) >> 4) & mask;
+    for (; table[i].identity; i = (i + 1) & mask) {
+        if (table[i].identity == identity)
+            break;
+    }
+    return &table[i];
+}
+
+
+//
+//  Expand_Call_Profiles: C
+//
+// Records point at their profile, so those pointers are fixed up too.
+//
+static void Expand_Call_Profiles(void)
+{
+    REBLEN capacity = Call_Profiles_Capacity == 0
+        ? 256
+        : Call_Profiles_Capacity * 2;
+    struct Call_Profile *table = TRY_ALLOC_N(struct Call_Profile, capacity);
+    if (not table)
+        fail (Error_No_Memory(sizeof(struct Call_Profile) * capacity));
+    memset(table, 0, sizeof(struct Call_Profile) * capacity);
+
+    REBLEN i;
+    for (i = 0; i < Call_Records_Used; ++i) {
+        struct Call_Profile *old = Call_Records[i].profile;
+        Call_Records[i].profile = Find_Call_Profile_Slot(
+            table, capacity, old->identity
+        );
+        *Call_Records[i].profile = *old;  // may write the same slot twice
+    }
+    for (i = 0; i < Call_Profiles_Capacity; ++i) {
+        struct Call_Profile *old = &Call_Profiles[i];
+        if (old->identity)
+            *Find_Call_Profile_Slot(table, capacity, old->identity) = *old;
+    }
+
+    if (Call_Profiles_Capacity != 0)
+        FREE_N(struct Call_Profile, Call_Profiles_Capacity, Call_Profiles);
+    Call_Profiles = table;
+    Call_Profiles_Capacity = capacity;
+}
+
+
+//
+//  Profile_Call_Begin: C
+//
+// Called by Begin_Action_Core() when Profile_Calls is set.
+//
+void Profile_Call_Begin(Frame(*) f)
+{
+    Array(*) identity = ACT_IDENTITY(f->u.action.original);
+
+    if ((Call_Profiles_Used + 1) * 2 > Call_Profiles_Capacity)
+        Expand_Call_Profiles();
+
+    struct Call_Profile *profile = Find_Call_Profile_Slot(
+        Call_Profiles, Call_Profiles_Capacity, identity
+    );
+    if (not profile->identity) {
+        Array(*) a = VAL_ARRAY_KNOWN_MUTABLE(Profiled_Actions);
+        profile->index = ARR_LEN(a);
+        Init_Action(
+            Alloc_Tail_Array(a),
+            f->u.action.original,
+            f->label,
+            UNBOUND
+        );
+        profile->identity = identity;
+        profile->calls = 0;
+        profile->inclusive = 0;
+        profile->exclusive = 0;
+        profile->stubs = 0;
+        ++Call_Profiles_Used;
+    }
+
+    if (Call_Records_Used == Call_Records_Capacity) {
+        REBLEN capacity = Call_Records_Capacity == 0
+            ? 64
+            : Call_Records_Capacity * 2;
+        struct Call_Record *records = TRY_ALLOC_N(struct Call_Record, capacity);
+        if (not records)
+            fail (Error_No_Memory(sizeof(struct Call_Record) * capacity));
+        if (Call_Records_Capacity != 0) {
+            memcpy(
+                records,
+                Call_Records,
+                sizeof(struct Call_Record) * Call_Records_Used
+            );
+            FREE_N(struct Call_Record, Call_Records_Capacity, Call_Records);
+        }
+        Call_Records = records;
+        Call_Records_Capacity = capacity;
+    }
+
+    struct Call_Record *r = &Call_Records[Call_Records_Used++];
+    r->frame = f;
+    r->profile = profile;
+    r->callees = 0;
+    r->stubs_start = GC_Stubs_Made;
+    r->start = clock();  // last, so the bookkeeping above isn't counted
+}
+
+
+//
+//  Profile_Call_End: C
+//
+// Called by Drop_Action() when Profile_Calls is set.  Frames that began
+// before profiling was switched on have no record, so nothing is done.  If
+// a frame went away without a Drop_Action(), its record is dropped when a
+// frame beneath it ends.
+//
+void Profile_Call_End(Frame(*) f)
+{
+    clock_t now = clock();
+
+    REBLEN n = Call_Records_Used;
+    while (n != 0 and Call_Records[n - 1].frame != f)
+        --n;
+    if (n == 0)
+        return;
+
+    struct Call_Record *r = &Call_Records[n - 1];
+    clock_t elapsed = now - r->start;
+
+    struct Call_Profile *profile = r->profile;
+    ++profile->calls;
+    profile->inclusive += elapsed;
+    profile->exclusive += elapsed - r->callees;
+    profile->stubs += GC_Stubs_Made - r->stubs_start;
+
+    Call_Records_Used = n - 1;
+    if (Call_Records_Used != 0)
+        Call_Records[Call_Records_Used - 1].callees += elapsed;
+}
+
+
+//
+//  profile-calls: native [
+//
+//  {Count calls, time, and allocations of every action (see PROFILE-REPORT)}
+//
+//      return: <none>
+//      /off "Stop counting (counts are kept until the next PROFILE-CALLS)"
+//  ]
+//
+DECLARE_NATIVE(profile_calls)
+{
+    INCLUDE_PARAMS_OF_PROFILE_CALLS;
+
+    if (REF(off)) {
+        Profile_Calls = false;
+        Call_Records_Used = 0;  // frames still running are not credited
+        return NONE;
+    }
+
+    Profile_Calls = false;
+    Free_Call_Profiles();
+    Profiled_Actions = Init_Block(Alloc_Value(), Make_Array(64));
+    Profile_Calls = true;
+    return NONE;
+}
+
+
+//
+//  Compare_Call_Profiles: C
+//
+static int Compare_Call_Profiles(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    const struct Call_Profile *p1 = *cast(struct Call_Profile* const*, v1);
+    const struct Call_Profile *p2 = *cast(struct Call_Profile* const*, v2);
+
+    if (p1->exclusive != p2->exclusive)
+        return p1->exclusive > p2->exclusive ? -1 : 1;
+    if (p1->calls != p2->calls)
+        return p1->calls > p2->calls ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  profile-report: native [
+//
+//  {Counts from PROFILE-CALLS, costliest (by exclusive time) first}
+//
+//      return: "[action calls inclusive exclusive stubs] per action called"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(profile_report)
+{
+    INCLUDE_PARAMS_OF_PROFILE_REPORT;
+
+    bool was_profiling = Profile_Calls;
+    Profile_Calls = false;  // don't count the report's own calls
+
+    REBLEN num = 0;
+    struct Call_Profile **sorted = nullptr;
+    if (Call_Profiles_Used != 0) {
+        sorted = TRY_ALLOC_N(struct Call_Profile*, Call_Profiles_Used);
+        if (not sorted) {
+            Profile_Calls = was_profiling;
+            fail (Error_No_Memory(
+                sizeof(struct Call_Profile*) * Call_Profiles_Used
+            ));
+        }
+        REBLEN i;
+        for (i = 0; i < Call_Profiles_Capacity; ++i) {
+            if (Call_Profiles[i].identity)
+                sorted[num++] = &Call_Profiles[i];
+        }
+        reb_qsort_r(
+            sorted, num, sizeof(struct Call_Profile*),
+            nullptr, &Compare_Call_Profiles
+        );
+    }
+
+    StackIndex base = TOP_INDEX;
+
+    REBLEN i;
+    for (i = 0; i < num; ++i) {
+        struct Call_Profile *p = sorted[i];
+        Array(*) row = Make_Array(5);
+        Copy_Cell(
+            Alloc_Tail_Array(row),
+            SPECIFIC(ARR_AT(VAL_ARRAY(Profiled_Actions), p->index))
+        );
+        Init_Integer(Alloc_Tail_Array(row), p->calls);
+        Init_Decimal(
+            Alloc_Tail_Array(row),
+            cast(REBDEC, p->inclusive) / CLOCKS_PER_SEC
+        );
+        Init_Decimal(
+            Alloc_Tail_Array(row),
+            cast(REBDEC, p->exclusive) / CLOCKS_PER_SEC
+        );
+        Init_Integer(Alloc_Tail_Array(row), p->stubs);
+        Init_Block(PUSH(), row);
+    }
+
+    if (sorted)
+        FREE_N(struct Call_Profile*, Call_Profiles_Used, sorted);
+
+    Profile_Calls = was_profiling;
+    return Init_Block(OUT, Pop_Stack_Values(base));
+}
+
+
+
+//=//// ALLOCATION SAMPLING ///////////////////////////////////////////////=//
+//
+// While SAMPLE-ALLOCS is on, every Nth series made by Make_Series_Into()
+// calls Sample_Alloc().  That credits a "site": the innermost running action
+// plus the file and line it was called from (when the calling array has
+// them), together with the flavor of series made.  When off, the cost is
+// the test of Alloc_Sample_Countdown in Make_Series_Into().
+//
+// Sites are tallied in the same kind of C table as the stack samples, keyed
+// by the flavor byte followed by `label@file:line`.  Nothing is allocated
+// from the GC'd pools while sampling, so allocations aren't perturbed.
+//
+
+static REBLEN Alloc_Sample_Every;  // 0 if SAMPLE-ALLOCS isn't running
+
+static struct Stack_Sample *Alloc_Samples;
+static REBLEN Alloc_Samples_Capacity;  // always a power of 2 (or 0)
+static REBLEN Alloc_Samples_Used;
+
+
+//
+//  Flavor_Name: C
+//
+const char *Flavor_Name(Flavor flavor)
+{
+    switch (flavor) {
+      case FLAVOR_ARRAY: return "array";
+      case FLAVOR_USE: return "use";
+      case FLAVOR_HITCH: return "hitch";
+      case FLAVOR_PARTIALS: return "partials";
+      case FLAVOR_LIBRARY: return "library";
+      case FLAVOR_HANDLE: return "handle";
+      case FLAVOR_FEED: return "feed";
+      case FLAVOR_API: return "api";
+      case FLAVOR_INSTRUCTION_SPLICE: return "splice";
+      case FLAVOR_PAIRLIST: return "pairlist";
+      case FLAVOR_VARLIST: return "varlist";
+      case FLAVOR_DETAILS: return "details";
+      case FLAVOR_LET: return "let";
+      case FLAVOR_PATCH: return "patch";
+      case FLAVOR_DATASTACK: return "datastack";
+      case FLAVOR_PLUG: return "plug";
+      case FLAVOR_KEYLIST: return "keylist";
+      case FLAVOR_POINTER: return "pointer";
+      case FLAVOR_HASHLIST: return "hashlist";
+      case FLAVOR_BOOKMARKLIST: return "bookmarklist";
+      case FLAVOR_BINARY: return "binary";
+      case FLAVOR_STRING: return "string";
+      case FLAVOR_SYMBOL: return "symbol";
+      default: return "other";
+    }
+}
+
+
+//
+//  Sample_Alloc: C
+//
+// Called by Make_Series_Into() when Alloc_Sample_Countdown reaches zero.
+//
+void Sample_Alloc(REBSER *s)
+{
+    Alloc_Sample_Countdown = Alloc_Sample_Every;
+
+    Frame(*) f = TOP_FRAME;
+    for (; f != BOTTOM_FRAME; f = f->prior) {
+        if (Is_Action_Frame(f) and not Is_Action_Frame_Fulfilling(f))
+            break;
+    }
+
+    const char* label = f == BOTTOM_FRAME
+        ? "(top)"
+        : Frame_Label_Or_Anonymous_UTF8(f);
+    String(const*) file = f == BOTTOM_FRAME ? nullptr : FRM_FILE(f);
+
+    char key[256];  // long labels or file paths are cut off
+    key[0] = cast(char, SER_FLAVOR(s));
+    int len;
+    if (file)
+        len = snprintf(
+            key + 1, sizeof(key) - 1, "%s@%s:%lu",
+            label, STR_UTF8(file), cast(unsigned long, FRM_LINE(f))
+        );
+    else
+        len = snprintf(key + 1, sizeof(key) - 1, "%s", label);
+    if (len < 0)
+        return;
+    Size size = 1 + MIN(cast(Size, len), sizeof(key) - 2);
+
+    uint32_t hash = cast(uint32_t, Hash_Bytes(cb_cast(key), size));
+
+    if ((Alloc_Samples_Used + 1) * 2 > Alloc_Samples_Capacity) {
+        if (not Expand_Sample_Table(&Alloc_Samples, &Alloc_Samples_Capacity))
+            return;
+    }
+
+    struct Stack_Sample *slot = Find_Sample_Slot(
+        Alloc_Samples, Alloc_Samples_Capacity, cb_cast(key), size, hash
+    );
+    if (not slot->stack) {
+        Byte* copy = TRY_ALLOC_N(Byte, size);
+        if (not copy)
+            return;
+        memcpy(copy, key, size);
+        slot->stack = copy;
+        slot->size = size;
+        slot->hash = hash;
+        slot->count = 0;
+        slot->bytes = 0;
+        ++Alloc_Samples_Used;
+    }
+    ++slot->count;
+    slot->bytes += sizeof(Stub);
+    if (GET_SERIES_FLAG(s, DYNAMIC))
+        slot->bytes += SER_TOTAL(s);
+}
+
+
+//
+//  Compare_Alloc_Samples: C
+//
+static int Compare_Alloc_Samples(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    const struct Stack_Sample *s1 = *cast(struct Stack_Sample* const*, v1);
+    const struct Stack_Sample *s2 = *cast(struct Stack_Sample* const*, v2);
+
+    if (s1->bytes != s2->bytes)
+        return s1->bytes > s2->bytes ? -1 : 1;
+    if (s1->count != s2->count)
+        return s1->count > s2->count ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  sample-allocs: native [
+//
+//  {Record where every Nth series is allocated, to see what uses memory}
+//
+//      return: "With /STOP, [site kind count bytes] per site, most bytes first"
+//          [<opt> block!]
+//      /every "Sample one in this many allocations when starting (default 100)"
+//          [integer!]
+//      /stop "Stop sampling and return estimates (samples times N)"
+//  ]
+//
+DECLARE_NATIVE(sample_allocs)
+//
+// Each row's site is a TEXT! like "append@%script.r:10" (just the action's
+// label if it was called from an array without file and line).  The kind is
+// a WORD! for the flavor of series, e.g. ARRAY, STRING, BINARY, VARLIST.
+// Summing rows by site or by kind gives totals for either one.
+{
+    INCLUDE_PARAMS_OF_SAMPLE_ALLOCS;
+
+    if (REF(stop)) {
+        if (REF(every))
+            fail (Error_Bad_Refines_Raw());
+
+        if (Alloc_Sample_Every == 0)
+            return nullptr;
+
+        REBLEN every = Alloc_Sample_Every;
+        Alloc_Sample_Countdown = 0;  // don't sample the report's own series
+        Alloc_Sample_Every = 0;
+
+        REBLEN num = 0;
+        struct Stack_Sample **sorted = nullptr;
+        if (Alloc_Samples_Used != 0) {
+            sorted = TRY_ALLOC_N(struct Stack_Sample*, Alloc_Samples_Used);
+            if (not sorted) {
+                Size size = sizeof(struct Stack_Sample*) * Alloc_Samples_Used;
+                Free_Sample_Table(
+                    &Alloc_Samples, &Alloc_Samples_Capacity, &Alloc_Samples_Used
+                );
+                fail (Error_No_Memory(size));
+            }
+            REBLEN i;
+            for (i = 0; i < Alloc_Samples_Capacity; ++i) {
+                if (Alloc_Samples[i].stack)
+                    sorted[num++] = &Alloc_Samples[i];
+            }
+            reb_qsort_r(
+                sorted, num, sizeof(struct Stack_Sample*),
+                nullptr, &Compare_Alloc_Samples
+            );
+        }
+
+        StackIndex base = TOP_INDEX;
+
+        REBLEN i;
+        for (i = 0; i < num; ++i) {
+            struct Stack_Sample *s = sorted[i];
+            const char *kind = Flavor_Name(cast(Flavor, s->stack[0]));
+            Array(*) row = Make_Array(4);
+            Init_Text(
+                Alloc_Tail_Array(row),
+                Make_Sized_String_UTF8(cs_cast(s->stack + 1), s->size - 1)
+            );
+            Init_Word(
+                Alloc_Tail_Array(row),
+                Intern_UTF8_Managed(cb_cast(kind), strsize(kind))
+            );
+            Init_Integer(Alloc_Tail_Array(row), s->count * every);
+            Init_Integer(Alloc_Tail_Array(row), s->bytes * every);
+            Init_Block(PUSH(), row);
+        }
+
+        if (sorted)
+            FREE_N(struct Stack_Sample*, Alloc_Samples_Used, sorted);
+        Free_Sample_Table(
+            &Alloc_Samples, &Alloc_Samples_Capacity, &Alloc_Samples_Used
+        );
+
+        return Init_Block(OUT, Pop_Stack_Values(base));
+    }
+
+    if (Alloc_Sample_Every != 0)
+        fail ("SAMPLE-ALLOCS is already running, use SAMPLE-ALLOCS/STOP");
+
+    REBINT every = REF(every) ? VAL_INT32(ARG(every)) : 100;
+    if (every <= 0)
+        fail (PARAM(every));
+
+    Free_Sample_Table(
+        &Alloc_Samples, &Alloc_Samples_Capacity, &Alloc_Samples_Used
+    );
+    Alloc_Sample_Every = every;
+    Alloc_Sample_Countdown = every;
+    return nullptr;
+}
+
+
+//=//// PER-LINE EXPRESSION COUNTS ////////////////////////////////////////=//
+//
+// While COUNT-LINES is on, Evaluator_Executor() calls Count_Line() each time
+// it starts an expression.  If the array being evaluated came from the
+// scanner (so it has a file and line), the count for that array and index
+// is incremented.  Counts are kept per array in a C table, with a vector
+// of counts per index, and each array counted is also put in a managed
+// BLOCK! (held by an API handle) so it can't be GC'd while counting.
+//
+// Only at report time are indices turned into lines.  Arrays only record
+// the line of their opening bracket, so the line of each value after that
+// is worked out from the newline markers between values.  Those don't say
+// how many lines were skipped, so blank and comment lines between values
+// make later lines read early...until the next nested array, which has its
+// exact line and resynchronizes the count.
+//
+// For the lcov report, nested arrays that were never evaluated are walked
+// too, so every line of a loaded script that holds a value shows up, with
+// zero counts for code that never ran.
+//
+
+struct Line_Counts {
+    Array(const*) array;  // nullptr if slot unused
+    REBLEN len;  // of counts, grows if the array does
+    REBI64 *counts;
+};
+
+static struct Line_Counts *Line_Counts_Table;
+static REBLEN Line_Counts_Capacity;  // always a power of 2 (or 0)
+static REBLEN Line_Counts_Used;
+static struct Line_Counts *Last_Line_Counts;  // cache for runs in one array
+
+static REBVAL *Counted_Arrays;  // API handle to BLOCK!, or nullptr
+
+
+static struct Line_Counts *Find_Line_Counts_Slot(
+    struct Line_Counts *table,
+    REBLEN capacity,
+    Array(const*) array
+){
+    REBLEN mask = capacity - 1;
+    REBLEN i = (cast(uintptr_t, array) >> 4) & mask;
+    for (; table[i].array; i = (i + 1) & mask) {
+        if (table[i].array == array)
+            break;
+    }
+    return &table[i];
+}
+
+static void Free_Line_Counts(void)
+{
+    REBLEN i;
+    for (i = 0; i < Line_Counts_Capacity; ++i) {
+        if (Line_Counts_Table[i].array)
+            FREE_N(
+                REBI64, Line_Counts_Table[i].len, Line_Counts_Table[i].counts
+            );
+    }
+    if (Line_Counts_Capacity != 0)
+        FREE_N(struct Line_Counts, Line_Counts_Capacity, Line_Counts_Table);
+    Line_Counts_Table = nullptr;
+    Line_Counts_Capacity = 0;
+    Line_Counts_Used = 0;
+    Last_Line_Counts = nullptr;
+
+    if (Counted_Arrays) {
+        rebRelease(Counted_Arrays);
+        Counted_Arrays = nullptr;
+    }
+}
+
+static void Expand_Line_Counts(void)
+{
+    REBLEN capacity = Line_Counts_Capacity == 0
+        ? 256
+        : Line_Counts_Capacity * 2;
+    struct Line_Counts *table = TRY_ALLOC_N(struct Line_Counts, capacity);
+    if (not table)
+        fail (Error_No_Memory(sizeof(struct Line_Counts) * capacity));
+    memset(table, 0, sizeof(struct Line_Counts) * capacity);
+
+    REBLEN i;
+    for (i = 0; i < Line_Counts_Capacity; ++i) {
+        struct Line_Counts *old = &Line_Counts_Table[i];
+        if (old->array)
+            *Find_Line_Counts_Slot(table, capacity, old->array) = *old;
+    }
+
+    if (Line_Counts_Capacity != 0)
+        FREE_N(struct Line_Counts, Line_Counts_Capacity, Line_Counts_Table);
+    Line_Counts_Table = table;
+    Line_Counts_Capacity = capacity;
+    Last_Line_Counts = nullptr;
+}
+
+static REBI64 *Grow_Line_Counts(struct Line_Counts *lc, REBLEN len)
+{
+    REBI64 *counts = TRY_ALLOC_N(REBI64, len);
+    if (not counts)
+        fail (Error_No_Memory(sizeof(REBI64) * len));
+    memset(counts, 0, sizeof(REBI64) * len);
+    if (lc->counts) {
+        memcpy(counts, lc->counts, sizeof(REBI64) * lc->len);
+        FREE_N(REBI64, lc->len, lc->counts);
+    }
+    lc->counts = counts;
+    lc->len = len;
+    return counts;
+}
+
+
+//
+//  Count_Line: C
+//
+// Called by Evaluator_Executor() at the start of each expression when
+// Count_Lines is set.
+//
+void Count_Line(Frame(*) f)
+{
+    if (FRM_IS_VARIADIC(f))
+        return;
+
+    Array(const*) a = FRM_ARRAY(f);
+    if (Not_Subclass_Flag(ARRAY, a, HAS_FILE_LINE_UNMASKED))
+        return;
+    if (NOT_SERIES_FLAG(a, MANAGED))
+        return;  // can't be put in Counted_Arrays
+
+    struct Line_Counts *lc = Last_Line_Counts;
+    if (not lc or lc->array != a) {
+        if ((Line_Counts_Used + 1) * 2 > Line_Counts_Capacity)
+            Expand_Line_Counts();
+
+        lc = Find_Line_Counts_Slot(
+            Line_Counts_Table, Line_Counts_Capacity, a
+        );
+        if (not lc->array) {
+            lc->array = a;
+            lc->len = 0;
+            lc->counts = nullptr;
+            Grow_Line_Counts(lc, ARR_LEN(a) + 1);
+            Init_Block(
+                Alloc_Tail_Array(VAL_ARRAY_KNOWN_MUTABLE(Counted_Arrays)),
+                a
+            );
+            ++Line_Counts_Used;
+        }
+        Last_Line_Counts = lc;
+    }
+
+    REBLEN index = FRM_INDEX(f);
+    if (index >= lc->len)
+        Grow_Line_Counts(lc, ARR_LEN(a) + 1);  // array was appended to
+    ++lc->counts[index];
+}
+
+
+struct Line_Hit {
+    String(const*) file;
+    LineNumber line;
+    REBI64 count;
+};
+
+static struct Line_Hit *Line_Hits;
+static REBLEN Line_Hits_Capacity;
+static REBLEN Line_Hits_Used;
+
+static void Add_Line_Hit(String(const*) file, LineNumber line, REBI64 count)
+{
+    if (Line_Hits_Used == Line_Hits_Capacity) {
+        REBLEN capacity = Line_Hits_Capacity == 0
+            ? 1024
+            : Line_Hits_Capacity * 2;
+        struct Line_Hit *hits = TRY_ALLOC_N(struct Line_Hit, capacity);
+        if (not hits)
+            fail (Error_No_Memory(sizeof(struct Line_Hit) * capacity));
+        if (Line_Hits_Capacity != 0) {
+            memcpy(hits, Line_Hits, sizeof(struct Line_Hit) * Line_Hits_Used);
+            FREE_N(struct Line_Hit, Line_Hits_Capacity, Line_Hits);
+        }
+        Line_Hits = hits;
+        Line_Hits_Capacity = capacity;
+    }
+    struct Line_Hit *hit = &Line_Hits[Line_Hits_Used++];
+    hit->file = file;
+    hit->line = line;
+    hit->count = count;
+}
+
+static void Free_Line_Hits(void)
+{
+    if (Line_Hits_Capacity != 0)
+        FREE_N(struct Line_Hit, Line_Hits_Capacity, Line_Hits);
+    Line_Hits = nullptr;
+    Line_Hits_Capacity = 0;
+    Line_Hits_Used = 0;
+}
+
+// Add a hit for each value in the array, with its count if the array was
+// evaluated.  With `deep`, nested arrays from the same file that were never
+// evaluated are walked too (ones that were get their own call), up to a
+// depth that only matters if code was modified to contain itself.
+//
+static void Add_Array_Line_Hits(Array(const*) a, REBLEN deep)
+{
+    String(const*) file = LINK(Filename, a);
+    LineNumber line = a->misc.line;
+
+    struct Line_Counts *lc = Line_Counts_Capacity == 0
+        ? nullptr
+        : Find_Line_Counts_Slot(Line_Counts_Table, Line_Counts_Capacity, a);
+    if (lc and not lc->array)
+        lc = nullptr;
+
+    REBLEN index = 0;
+    Cell(const*) tail = ARR_TAIL(a);
+    Cell(const*) item = ARR_HEAD(a);
+    for (; item != tail; ++item, ++index) {
+        if (Get_Cell_Flag(item, NEWLINE_BEFORE))
+            ++line;
+
+        Array(const*) nested = nullptr;
+        if (ANY_ARRAY_KIND(CELL_HEART(item))) {
+            nested = VAL_ARRAY(item);
+            if (
+                Not_Subclass_Flag(ARRAY, nested, HAS_FILE_LINE_UNMASKED)
+                or LINK(Filename, nested) != file
+            ){
+                nested = nullptr;
+            }
+            else if (nested->misc.line > line)
+                line = nested->misc.line;  // exact, resynchronize
+        }
+
+        REBI64 count = (lc and index < lc->len) ? lc->counts[index] : 0;
+        if (lc or deep)
+            Add_Line_Hit(file, line, count);
+
+        if (deep and nested) {
+            struct Line_Counts *nested_lc = Find_Line_Counts_Slot(
+                Line_Counts_Table, Line_Counts_Capacity, nested
+            );
+            if (not nested_lc->array)
+                Add_Array_Line_Hits(nested, deep - 1);
+        }
+    }
+}
+
+static int Compare_Line_Hits(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    const struct Line_Hit *h1 = cast(const struct Line_Hit*, v1);
+    const struct Line_Hit *h2 = cast(const struct Line_Hit*, v2);
+
+    if (h1->file != h2->file) {
+        int diff = strcmp(STR_UTF8(h1->file), STR_UTF8(h2->file));
+        if (diff != 0)
+            return diff;
+        return h1->file < h2->file ? -1 : 1;
+    }
+    if (h1->line != h2->line)
+        return h1->line < h2->line ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  count-lines: native [
+//
+//  {Count the expressions evaluated on each line of scanned code}
+//
+//      return: "With /STOP, [file line count] rows (or lcov text with /LCOV)"
+//          [<opt> block! text!]
+//      /stop "Stop counting and return the counts gathered"
+//      /lcov "With /STOP, an lcov tracefile, including lines never run"
+//  ]
+//
+DECLARE_NATIVE(count_lines)
+//
+// The count for a line is how many times an expression starting on it was
+// evaluated, so a line with two expressions that runs once counts 2.
+{
+    INCLUDE_PARAMS_OF_COUNT_LINES;
+
+    if (not REF(stop)) {
+        if (REF(lcov))
+            fail (Error_Bad_Refines_Raw());
+        if (Count_Lines)
+            fail ("COUNT-LINES is already running, use COUNT-LINES/STOP");
+
+        Free_Line_Counts();
+        Counted_Arrays = Init_Block(Alloc_Value(), Make_Array(64));
+        Count_Lines = true;
+        return nullptr;
+    }
+
+    if (not Count_Lines)
+        return nullptr;
+    Count_Lines = false;
+
+    REBLEN deep = REF(lcov) ? 64 : 0;
+    REBLEN i;
+    for (i = 0; i < Line_Counts_Capacity; ++i) {
+        if (Line_Counts_Table[i].array)
+            Add_Array_Line_Hits(Line_Counts_Table[i].array, deep);
+    }
+
+    if (Line_Hits_Used != 0)
+        reb_qsort_r(
+            Line_Hits, Line_Hits_Used, sizeof(struct Line_Hit),
+            nullptr, &Compare_Line_Hits
+        );
+
+    // Merge hits on the same line (one per value, several per line)
+    //
+    REBLEN num = 0;
+    for (i = 0; i < Line_Hits_Used; ++i) {
+        if (
+            num != 0
+            and Line_Hits[num - 1].file == Line_Hits[i].file
+            and Line_Hits[num - 1].line == Line_Hits[i].line
+        ){
+            Line_Hits[num - 1].count += Line_Hits[i].count;
+        }
+        else
+            Line_Hits[num++] = Line_Hits[i];
+    }
+
+    if (REF(lcov)) {
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        Byte buf[MAX_INT_LEN + 1];
+        REBLEN start = 0;
+        while (start < num) {
+            String(const*) file = Line_Hits[start].file;
+            Append_Ascii(mo->series, "SF:");
+            Append_Utf8(mo->series, STR_UTF8(file), STR_SIZE(file));
+            Append_Codepoint(mo->series, '\n');
+
+            REBLEN hit = 0;
+            REBLEN n;
+            for (n = start; n < num and Line_Hits[n].file == file; ++n) {
+                Append_Ascii(mo->series, "DA:");
+                Append_Int(mo->series, Line_Hits[n].line);
+                Append_Codepoint(mo->series, ',');
+                Form_Integer(buf, Line_Hits[n].count);
+                Append_Ascii(mo->series, s_cast(buf));
+                Append_Codepoint(mo->series, '\n');
+                if (Line_Hits[n].count != 0)
+                    ++hit;
+            }
+
+            Append_Ascii(mo->series, "LF:");
+            Append_Int(mo->series, n - start);
+            Append_Ascii(mo->series, "\nLH:");
+            Append_Int(mo->series, hit);
+            Append_Ascii(mo->series, "\nend_of_record\n");
+            start = n;
+        }
+
+        Free_Line_Hits();
+        Free_Line_Counts();
+        return Init_Text(OUT, Pop_Molded_String(mo));
+    }
+
+    StackIndex base = TOP_INDEX;
+    for (i = 0; i < num; ++i) {
+        Array(*) row = Make_Array(3);
+        Init_File(Alloc_Tail_Array(row), Line_Hits[i].file);
+        Init_Integer(Alloc_Tail_Array(row), Line_Hits[i].line);
+        Init_Integer(Alloc_Tail_Array(row), Line_Hits[i].count);
+        Init_Block(PUSH(), row);
+    }
+
+    Free_Line_Hits();
+    Free_Line_Counts();
+    return Init_Block(OUT, Pop_Stack_Values(base));
+}
+
+
+//
+//  Shutdown_Profiling: C
+//
+void Shutdown_Profiling(void)
+{
+  #if REBOL_SAMPLING_PROFILER
+    if (Sampling)
+        Arm_Sample_Timer(0);
+  #endif
+    Sampling = false;
+    Free_Stack_Samples();
+
+    Profile_Calls = false;
+    Free_Call_Profiles();
+
+    Alloc_Sample_Countdown = 0;
+    Alloc_Sample_Every = 0;
+    Free_Sample_Table(
+        &Alloc_Samples, &Alloc_Samples_Capacity, &Alloc_Samples_Used
+    );
+
+    Count_Lines = false;
+    Free_Line_Hits();
+    Free_Line_Counts();
+}
@@ -93,8 +93,6 @@ void Collapsify_Array(Array(*) array, REBSPC *specifier, REBLEN limit)
 //
 REBVAL *Init_Near_For_Frame(Cell(*) out, Frame(*) f)
 {
-    StackIndex base = TOP_INDEX;
-
     if (FRM_IS_VARIADIC(f)) {
         //
         // A variadic feed may not be able to be reified, if the data is
@@ -105,30 +103,61 @@ REBVAL *Init_Near_For_Frame(Cell(*) out, Frame(*) f)
         Reify_Variadic_Feed_As_Array_Feed(f->feed, truncated);
     }
 
-    // Get at most 6 values out of the array.  Ideally 3 before and after
-    // the error point.  If truncating either the head or tail of the
-    // values, put ellipses.
-
     // !!! We may be running a function where the value for the function was a
     // "head" value not in the array.  These cases could substitute the symbol
     // for the currently executing function.  Reconsider when such cases
     // appear and can be studied.
 
-    REBINT start = FRM_INDEX(f) - 3;
+    // !!! This code can be called on an executing frame, such as when an
+    // error happens in that frame.  Or it can be called on a pending frame
+    // when examining a backtrace...where the function hasn't been called
+    // yet.  This needs some way of differentiation, consider it.
+    //
+    /*
+    if (Is_Action_Frame(f) and Is_Action_Frame_Fulfilling(f)) {
+        ???
+    }
+    */
+
+    return Init_Near_For_Array_At(out, FRM_ARRAY(f), FRM_INDEX(f), f_specifier);
+}
+
+
+//
+//  Init_Near_For_Array_At: C
+//
+// Makes the NEAR block for an execution position in an array, where `index`
+// is just past the value being evaluated (e.g. FRM_INDEX() of a frame).  This
+// is split out from Init_Near_For_Frame() so errors can hold onto just the
+// position, and make the block later only if someone looks at it.
+//
+REBVAL *Init_Near_For_Array_At(
+    Cell(*) out,
+    Array(const*) array,
+    REBLEN index,
+    REBSPC *specifier
+){
+    StackIndex base = TOP_INDEX;
+
+    // Get at most 6 values out of the array.  Ideally 3 before and after
+    // the error point.  If truncating either the head or tail of the
+    // values, put ellipses.
+
+    REBINT start = index - 3;
     if (start > 0)
         Init_Word(PUSH(), Canon(ELLIPSIS_1));
     else if (start < 0)
         start = 0;
 
     REBLEN count = 0;
-    Cell(const*) tail = ARR_TAIL(FRM_ARRAY(f));
-    Cell(const*) item = ARR_AT(FRM_ARRAY(f), start);
+    Cell(const*) tail = ARR_TAIL(array);
+    Cell(const*) item = ARR_AT(array, start);
     for (; item != tail and count < 6; ++item, ++count) {
         assert(not Is_Void(item));  // can't be in arrays, API won't splice
         assert(not Is_Isotope(item));  // can't be in arrays, API won't splice
-        Derelativize(PUSH(), item, f_specifier);
+        Derelativize(PUSH(), item, specifier);
 
-        if (count == FRM_INDEX(f) - start - 1) {
+        if (count == index - start - 1) {
             //
             // Leave a marker at the point of the error, currently `**`.
             //
@@ -143,17 +172,6 @@ REBVAL *Init_Near_For_Frame(Cell(*) out, Frame(*) f)
     if (item != tail)
         Init_Word(PUSH(), Canon(ELLIPSIS_1));
 
-    // !!! This code can be called on an executing frame, such as when an
-    // error happens in that frame.  Or it can be called on a pending frame
-    // when examining a backtrace...where the function hasn't been called
-    // yet.  This needs some way of differentiation, consider it.
-    //
-    /*
-    if (Is_Action_Frame(f) and Is_Action_Frame_Fulfilling(f)) {
-        ???
-    }
-    */
-
     Array(*) near = Pop_Stack_Values_Core(base, NODE_FLAG_MANAGED);
 
     // Simplify overly-deep blocks embedded in the where so they show (...)
@@ -29,15 +29,135 @@
 #include "sys-core.h"
 
 
+// Tallies for STATS/CENSUS, indexed by whether the node is managed.
+//
+struct Census_Tally {
+    REBI64 count[2];
+    REBI64 bytes[2];
+};
+
+static void Add_Census_Row(
+    const char *kind,
+    bool managed,
+    const struct Census_Tally *tally
+){
+    Array(*) row = Make_Array(4);
+    Init_Word(
+        Alloc_Tail_Array(row),
+        Intern_UTF8_Managed(cb_cast(kind), strsize(kind))
+    );
+    Init_Logic(Alloc_Tail_Array(row), managed);
+    Init_Integer(Alloc_Tail_Array(row), tally->count[managed]);
+    Init_Integer(Alloc_Tail_Array(row), tally->bytes[managed]);
+    Init_Block(PUSH(), row);
+}
+
+
+//
+//  Census_Series: C
+//
+// One pass over the stub pool, tallying each live node and its dynamic data
+// (if any) by flavor.  Varlists are split out by the type of their context,
+// since "how much is held by OBJECT!s vs. FRAME!s" is usually the question.
+// Nothing is allocated until the pass is over, so this is safe to call on a
+// big heap (the time is proportional to the number of stubs).
+//
+// Pushes `[kind managed count bytes]` rows, and returns how many.
+//
+REBLEN Census_Series(void)
+{
+    struct Census_Tally flavors[FLAVOR_MAX];
+    struct Census_Tally varlists[REB_MAX];
+    struct Census_Tally pairings;
+    memset(flavors, 0, sizeof(flavors));
+    memset(varlists, 0, sizeof(varlists));
+    memset(&pairings, 0, sizeof(pairings));
+
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        Byte* stub = cast(Byte*, seg + 1);
+
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            Byte nodebyte = *stub;
+            if (nodebyte & NODE_BYTEMASK_0x40_STALE)
+                continue;
+
+            bool managed = did (nodebyte & NODE_BYTEMASK_0x20_MANAGED);
+
+            if (nodebyte & NODE_BYTEMASK_0x01_CELL) {  // a "pairing"
+                pairings.count[managed] += 1;
+                pairings.bytes[managed] += sizeof(Stub);
+                continue;
+            }
+
+            REBSER *s = SER(cast(void*, stub));
+            Flavor flavor = SER_FLAVOR(s);
+            struct Census_Tally *tally = &flavors[flavor];
+            if (
+                flavor == FLAVOR_VARLIST
+                and NOT_SERIES_FLAG(s, INACCESSIBLE)
+            ){
+                Byte heart = HEART_BYTE_UNCHECKED(
+                    CTX_ARCHETYPE(cast(Context(*), s))
+                );
+                if (heart != REB_0 and heart < REB_MAX)
+                    tally = &varlists[heart];
+            }
+
+            tally->count[managed] += 1;
+            tally->bytes[managed] += sizeof(Stub) + SER_TOTAL_IF_DYNAMIC(s);
+        }
+    }
+
+    REBLEN rows = 0;
+    int managed;
+    for (managed = 1; managed >= 0; --managed) {
+        REBLEN i;
+        for (i = 0; i < FLAVOR_MAX; ++i) {
+            if (flavors[i].count[managed] == 0)
+                continue;
+            Add_Census_Row(
+                i == FLAVOR_VARLIST ? "varlist" : Flavor_Name(cast(Flavor, i)),
+                did managed,
+                &flavors[i]
+            );
+            ++rows;
+        }
+        for (i = 1; i < REB_MAX; ++i) {
+            if (varlists[i].count[managed] == 0)
+                continue;
+            Symbol(const*) name = Canon_Symbol(SYM_FROM_KIND(i));
+            Add_Census_Row(
+                STR_UTF8(name),
+                did managed,
+                &varlists[i]
+            );
+            ++rows;
+        }
+        if (pairings.count[managed] != 0) {
+            Add_Census_Row("pairing", did managed, &pairings);
+            ++rows;
+        }
+    }
+    return rows;
+}
+
+
 //
 //  stats: native [
 //
 //  {Provides status and statistics information about the interpreter.}
 //
-//      return: [<opt> time! integer! object!]
+//      return: [<opt> time! integer! object! block!]
 //      /show "Print formatted results to console"
 //      /profile "Returns profiler object"
 //      /evals "Number of values evaluated by interpreter"
+//      /segments "Memory pool segments in use and given back (any build)"
+//      /pools "Block of per-pool usage objects (any build)"
+//      /gc "Recycling counts and ballast decisions (any build)"
+//      /typechecks "Parameter typechecks by kind bitset vs. full (any build)"
+//      /census "[kind managed count bytes] rows for live series (any build)"
 //      /pool "Dump all series in pool"
 //          [integer!]
 //  ]
@@ -46,10 +166,88 @@ DECLARE_NATIVE(stats)
 {
     INCLUDE_PARAMS_OF_STATS;
 
+  #if REBOL_TIMER_SIGNALS
+    REBI64 num_evals = 0;  // evaluator steps don't count down, see config
+
+    if (REF(evals))
+        fail ("STATS/EVALS not available with REBOL_TIMER_SIGNALS");
+  #else
     REBI64 num_evals = Total_Eval_Cycles + Eval_Dose - Eval_Countdown;
 
     if (REF(evals))
         return Init_Integer(OUT, num_evals);
+  #endif
+
+    if (REF(gc)) {
+        return rebValue("make object! [",
+            "minor-recycles:", rebI(GC_Minor_Count),
+            "major-recycles:", rebI(GC_Major_Count),
+            "ballast:", rebI(GC_Ballast),
+            "adapted-ballast:", rebI(GC_Adapted_Ballast),
+            "ballast-grows:", rebI(GC_Ballast_Grows),
+            "ballast-shrinks:", rebI(GC_Ballast_Shrinks),
+            "memory:", rebI(PG_Mem_Usage),
+        "]");
+    }
+
+    if (REF(typechecks)) {
+        return rebValue("make object! [",
+            "fast:", rebI(Typecheck_Fast_Count),
+            "slow:", rebI(Typecheck_Slow_Count),
+        "]");
+    }
+
+    if (REF(census)) {
+        StackIndex base = TOP_INDEX;
+        Census_Series();
+        return Init_Block(OUT, Pop_Stack_Values(base));
+    }
+
+    if (REF(pools)) {  // SYSTEM_POOL isn't a real pool, it only tracks size
+        StackIndex base = TOP_INDEX;
+
+        PoolID pool_id;
+        for (pool_id = 0; pool_id < SYSTEM_POOL; ++pool_id) {
+            Pool* pool = &Mem_Pools[pool_id];
+
+            REBI64 num_segments = 0;
+            Segment* seg = pool->segments;
+            for (; seg != nullptr; seg = seg->next)
+                ++num_segments;
+
+            REBVAL *obj = rebValue("make object! [",
+                "wide:", rebI(pool->wide),
+                "segments:", rebI(num_segments),
+                "units-per-segment:", rebI(pool->num_units_per_segment),
+                "used:", rebI(pool->has - pool->free),
+                "free:", rebI(pool->free),
+                "high-water:", rebI(pool->high_water),
+                "allocations:", rebI(pool->num_allocs),
+            "]");
+            Copy_Cell(PUSH(), obj);
+            rebRelease(obj);
+        }
+
+        return Init_Block(OUT, Pop_Stack_Values(base));
+    }
+
+    if (REF(segments)) {
+        REBI64 num_segments = 0;
+        REBI64 segment_bytes = 0;
+        PoolID pool_id;
+        for (pool_id = 0; pool_id < MAX_POOLS; ++pool_id) {
+            Segment* seg = Mem_Pools[pool_id].segments;
+            for (; seg != nullptr; seg = seg->next) {
+                ++num_segments;
+                segment_bytes += seg->size;
+            }
+        }
+        return rebValue("make object! [",
+            "segments:", rebI(num_segments),
+            "segment-bytes:", rebI(segment_bytes),
+            "segments-released:", rebI(PG_Segments_Released),
+        "]");
+    }
 
     if (REF(profile)) {
       #if DEBUG_COLLECT_STATS
@@ -63,6 +261,9 @@ DECLARE_NATIVE(stats)
             "made-blocks:", rebI(PG_Reb_Stats->Blocks),
             "made-objects:", rebI(PG_Reb_Stats->Objects),
             "recycles:", rebI(PG_Reb_Stats->Recycle_Counter),
+            "minor-recycles:", rebI(GC_Minor_Count),
+            "major-recycles:", rebI(GC_Major_Count),
+            "tenured-series:", rebI(GC_Num_Tenured),
         "]");
       #else
         fail (Error_Debug_Only_Raw());
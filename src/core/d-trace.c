@@ -37,6 +37,8 @@
 
 #include "sys-core.h"
 
+#include <stdio.h>  // fopen() in Dump_Trace_Log(), even in release builds
+
 
 //
 //  Trace_Value: C
@@ -97,6 +99,7 @@ DECLARE_NATIVE(trace)
 // the backtrace is stored structurally, vs trying to implement in C.
 //
 // Currently TRACE only applies to PARSE.
+// TRACE-LOG is a lower-overhead record of calls that can stay on in use.
 {
     INCLUDE_PARAMS_OF_TRACE;
 
@@ -112,3 +115,304 @@ DECLARE_NATIVE(trace)
 
     return nullptr;
 }
+
+
+
+//=//// BINARY TRACE LOG //////////////////////////////////////////////////=//
+//
+// TRACE-LOG writes fixed-size records into a ring buffer instead of printing
+// anything, so it is cheap enough to leave on in a running system and look
+// at the last N events after something goes wrong.  Records are only made
+// for action calls and returns and for failures, from Begin_Action_Core(),
+// Drop_Action() and Fail_Core() when Trace_Logging is set.
+//
+// Labels are copied into the record (truncated) rather than being stored as
+// a symbol ID, since only built-in words have SymIds and a Symbol* could be
+// GC'd before the log is dumped.  The array pointer is just an identity to
+// tell positions in different arrays apart; it is never dereferenced.
+//
+// The dump format is little-endian, a 16 byte header then the records from
+// oldest to newest:
+//
+//     header: "R3TL" version:4 record-size:4 count:4
+//     record: tick:8 array:8 index:4 line:4 kind:1 label:15
+//
+// %scripts/decode-trace-log.reb turns that back into text.
+//
+
+#define TRACE_LOG_VERSION 1
+#define TRACE_LOG_HEADER_SIZE 16
+#define TRACE_RECORD_SIZE 40
+#define TRACE_LABEL_SIZE 15
+
+enum Reb_Trace_Event {
+    TRACE_EVENT_CALL = 1,
+    TRACE_EVENT_RETURN = 2,
+    TRACE_EVENT_FAIL = 3
+};
+
+struct Trace_Record {
+    uint64_t tick;
+    uintptr_t array;  // identity only, 0 if variadic feed
+    uint32_t index;
+    uint32_t line;
+    Byte kind;  // enum Reb_Trace_Event
+    char label[TRACE_LABEL_SIZE];  // NUL-padded, not always NUL-terminated
+};
+
+static struct Trace_Record *Trace_Ring;
+static REBLEN Trace_Ring_Capacity;
+static uint64_t Trace_Ring_Count;  // total records ever added, may wrap ring
+static char *Trace_Crash_Path;  // local path for Dump_Trace_Log(), or null
+
+
+static void Add_Trace_Record(
+    Byte kind,
+    Frame(*) f,
+    option(Symbol(const*)) label
+){
+    struct Trace_Record *r = &Trace_Ring[
+        Trace_Ring_Count % Trace_Ring_Capacity
+    ];
+
+  #if DEBUG_COUNT_TICKS
+    r->tick = TG_tick;
+  #elif REBOL_TIMER_SIGNALS
+    r->tick = Trace_Ring_Count;  // evaluator steps aren't counted, see config
+  #else
+    r->tick = Total_Eval_Cycles + Eval_Dose - Eval_Countdown;
+  #endif
+
+    if (FRM_IS_VARIADIC(f)) {
+        r->array = 0;
+        r->index = 0;
+        r->line = 0;
+    }
+    else {
+        r->array = cast(uintptr_t, FRM_ARRAY(f));
+        r->index = FRM_INDEX(f);
+        r->line = FRM_LINE(f);
+    }
+
+    r->kind = kind;
+    memset(r->label, 0, TRACE_LABEL_SIZE);
+    if (label) {
+        Size size = STR_SIZE(unwrap(label));
+        memcpy(
+            r->label,
+            STR_UTF8(unwrap(label)),
+            size < TRACE_LABEL_SIZE ? size : TRACE_LABEL_SIZE
+        );
+    }
+
+    ++Trace_Ring_Count;
+}
+
+
+//
+//  Trace_Log_Call: C
+//
+void Trace_Log_Call(Frame(*) f)
+  { Add_Trace_Record(TRACE_EVENT_CALL, f, f->label); }
+
+
+//
+//  Trace_Log_Return: C
+//
+void Trace_Log_Return(Frame(*) f)
+  { Add_Trace_Record(TRACE_EVENT_RETURN, f, f->label); }
+
+
+//
+//  Trace_Log_Fail: C
+//
+// The label of a failure record is the error's ID, if it has one.
+//
+void Trace_Log_Fail(Frame(*) f, Context(*) error)
+{
+    ERROR_VARS *vars = ERR_VARS(error);
+    Add_Trace_Record(
+        TRACE_EVENT_FAIL,
+        f,
+        IS_WORD(&vars->id) ? VAL_WORD_SYMBOL(&vars->id) : nullptr
+    );
+}
+
+
+static void Write_LE(Byte* out, uint64_t value, REBLEN size)
+{
+    REBLEN i;
+    for (i = 0; i < size; ++i) {
+        out[i] = cast(Byte, value & 0xFF);
+        value >>= 8;
+    }
+}
+
+static REBLEN Num_Trace_Records(void)
+{
+    if (Trace_Ring_Count < Trace_Ring_Capacity)
+        return cast(REBLEN, Trace_Ring_Count);
+    return Trace_Ring_Capacity;
+}
+
+static void Serialize_Trace_Header(Byte* out)
+{
+    memcpy(out, "R3TL", 4);
+    Write_LE(out + 4, TRACE_LOG_VERSION, 4);
+    Write_LE(out + 8, TRACE_RECORD_SIZE, 4);
+    Write_LE(out + 12, Num_Trace_Records(), 4);
+}
+
+// The Nth record that's still in the ring, with 0 being the oldest.
+//
+static void Serialize_Trace_Record(Byte* out, REBLEN n)
+{
+    REBLEN num = Num_Trace_Records();
+    const struct Trace_Record *r = &Trace_Ring[
+        (Trace_Ring_Count - num + n) % Trace_Ring_Capacity
+    ];
+
+    Write_LE(out, r->tick, 8);
+    Write_LE(out + 8, r->array, 8);
+    Write_LE(out + 16, r->index, 4);
+    Write_LE(out + 20, r->line, 4);
+    out[24] = r->kind;
+    memcpy(out + 25, r->label, TRACE_LABEL_SIZE);
+}
+
+
+static void Free_Trace_Log(void)
+{
+    if (Trace_Ring) {
+        FREE_N(struct Trace_Record, Trace_Ring_Capacity, Trace_Ring);
+        Trace_Ring = nullptr;
+    }
+    Trace_Ring_Capacity = 0;
+    Trace_Ring_Count = 0;
+
+    if (Trace_Crash_Path) {
+        FREE_N(char, strsize(Trace_Crash_Path) + 1, Trace_Crash_Path);
+        Trace_Crash_Path = nullptr;
+    }
+}
+
+
+//
+//  Dump_Trace_Log: C
+//
+// Called by Panic_Core(), so this can't allocate series or evaluate.  Does
+// nothing unless TRACE-LOG/CRASH gave a file.
+//
+void Dump_Trace_Log(void)
+{
+    if (not Trace_Ring or not Trace_Crash_Path)
+        return;
+
+    FILE *out = fopen(Trace_Crash_Path, "wb");
+    if (not out)
+        return;
+
+    Byte buf[TRACE_LOG_HEADER_SIZE + TRACE_RECORD_SIZE];
+    Serialize_Trace_Header(buf);
+    fwrite(buf, 1, TRACE_LOG_HEADER_SIZE, out);
+
+    REBLEN num = Num_Trace_Records();
+    REBLEN n;
+    for (n = 0; n < num; ++n) {
+        Serialize_Trace_Record(buf, n);
+        fwrite(buf, 1, TRACE_RECORD_SIZE, out);
+    }
+    fclose(out);
+}
+
+
+//
+//  trace-log: native [
+//
+//  {Log calls, returns, and failures as binary records in a ring buffer}
+//
+//      return: "With /DUMP, the log (see %scripts/decode-trace-log.reb)"
+//          [<opt> binary!]
+//      mode "TRUE starts a new log, FALSE stops adding to it"
+//          [<end> logic!]
+//      /size "How many records the ring keeps when starting (default 65536)"
+//          [integer!]
+//      /crash "File to write the log to if the interpreter panics"
+//          [file!]
+//      /dump "Return the records logged so far, oldest first"
+//  ]
+//
+DECLARE_NATIVE(trace_log)
+{
+    INCLUDE_PARAMS_OF_TRACE_LOG;
+
+    REBVAL *mode = ARG(mode);
+
+    if (not Is_Nulled(mode) and not VAL_LOGIC(mode)) {
+        if (REF(size) or REF(crash))
+            fail (Error_Bad_Refines_Raw());
+        Trace_Logging = false;
+    }
+    else if (not Is_Nulled(mode)) {
+        REBINT size = REF(size) ? VAL_INT32(ARG(size)) : 65536;
+        if (size <= 0)
+            fail (PARAM(size));
+
+        char *path = nullptr;
+        if (REF(crash)) {
+            char *spelled = rebSpell("file-to-local/full", ARG(crash));
+            Size size = strsize(spelled) + 1;
+            path = TRY_ALLOC_N(char, size);
+            if (path)
+                memcpy(path, spelled, size);
+            rebFree(spelled);
+            if (not path)
+                fail (Error_No_Memory(size));
+        }
+
+        Trace_Logging = false;
+        Free_Trace_Log();
+
+        Trace_Ring = TRY_ALLOC_N(struct Trace_Record, size);
+        if (not Trace_Ring) {
+            if (path)
+                FREE_N(char, strsize(path) + 1, path);
+            fail (Error_No_Memory(sizeof(struct Trace_Record) * size));
+        }
+        Trace_Ring_Capacity = size;
+        Trace_Crash_Path = path;
+        Trace_Logging = true;
+    }
+    else if (not REF(dump))
+        fail ("TRACE-LOG needs a LOGIC! mode, or /DUMP");
+
+    if (not REF(dump))
+        return nullptr;
+
+    if (not Trace_Ring)
+        return nullptr;
+
+    REBLEN num = Num_Trace_Records();
+    Size total = TRACE_LOG_HEADER_SIZE + num * TRACE_RECORD_SIZE;
+    Binary(*) bin = Make_Binary(total);
+    Byte* out = BIN_HEAD(bin);
+    Serialize_Trace_Header(out);
+    out += TRACE_LOG_HEADER_SIZE;
+
+    REBLEN n;
+    for (n = 0; n < num; ++n, out += TRACE_RECORD_SIZE)
+        Serialize_Trace_Record(out, n);
+
+    TERM_BIN_LEN(bin, total);
+    return Init_Binary(OUT, bin);
+}
+
+
+//
+//  Shutdown_Trace_Log: C
+//
+void Shutdown_Trace_Log(void)
+{
+    Trace_Logging = false;
+    Free_Trace_Log();
+}
@@ -1137,6 +1137,14 @@ Bounce Action_Executor(Frame(*) f)
   //    they use.  It starts the function phase again from its top, and
   //    reuses the frame already allocated.
   //
+  //    It is explicit because doing this implicitly for a call in tail
+  //    position (e.g. `return f n - 1`) would overwrite the caller's args,
+  //    and FUNC and LAMBDA varlists are managed as soon as the body is
+  //    bound to them...so a closure may still be looking at the old ones.
+  //    Splicing the caller out from under the callee instead would mean
+  //    freeing the evaluator frame whose feed the callee is still using
+  //    (e.g. for <variadic> args), in the middle of the frame stack.
+  //
   // 2. Since dispatchers run arbitrary code to pick how (and if) they want
   //    to change the phase on each redo, we have no easy way to tell if a
   //    phase is "earlier" or "later".
@@ -1196,6 +1204,78 @@ Bounce Action_Executor(Frame(*) f)
 }}
 
 
+//=//// SPARE VARLISTS ////////////////////////////////////////////////////=//
+//
+// When nothing managed a frame's varlist during the call (no FRAME! value
+// escaped through BINDING OF, REFRAMER, etc.) it is freed when the frame is.
+// Small functions called in tight loops would thus go through the stub and
+// data pools for every call.  Instead, a few clean varlists are kept per
+// parameter count, and Push_Action() takes one of those when it can.
+//
+// Only varlists that came through Drop_Action() without being managed are
+// kept.  They're not tracked by the GC--the stale cells aren't seen by it,
+// and Push_Action() erases them before use.
+//
+
+//
+//  Free_Action_Varlist: C
+//
+// Called by Free_Frame_Internal(), varlist is unmanaged.
+//
+void Free_Action_Varlist(Array(*) varlist)
+{
+    assert(NOT_SERIES_FLAG(varlist, MANAGED));
+
+    if (
+        GET_SERIES_FLAG(varlist, INACCESSIBLE)  // e.g. vars stolen by ENCLOSE
+        or ARR_LEN(varlist) > SPARE_VARLIST_ARGS  // (length includes rootvar)
+        or Get_Subclass_Flag(VARLIST, varlist, FRAME_HAS_BEEN_INVOKED)
+        or (SER_INFO(varlist) & ~(  // Drop_Action() clears all but these
+            SERIES_INFO_0_IS_FALSE | FLAG_USED_BYTE(255)
+        ))
+    ){
+        GC_Kill_Series(varlist);
+        return;
+    }
+
+    REBLEN num_args = ARR_LEN(varlist) - 1;  // minus rootvar
+    if (TG_Num_Spare_Varlists[num_args] == SPARE_VARLISTS_EACH) {
+        GC_Kill_Series(varlist);
+        return;
+    }
+
+    assert(IS_VARLIST(varlist));
+    assert(GET_SERIES_FLAG(varlist, DYNAMIC));
+    assert(NOT_SERIES_FLAG(varlist, POWER_OF_2));  // small, came from a pool
+
+  #if !defined(NDEBUG)
+    Cell(*) tail = ARR_TAIL(varlist);
+    Cell(*) cell = ARR_HEAD(varlist);
+    for (; cell != tail; ++cell)
+        USED(Erase_Cell(cell));  // don't leave dangling pointers around
+  #endif
+
+    TG_Spare_Varlists[num_args][TG_Num_Spare_Varlists[num_args]++] = varlist;
+}
+
+
+//
+//  Free_Spare_Varlists: C
+//
+// Give spare varlists back to the pools (done when shutting down).
+//
+void Free_Spare_Varlists(void)
+{
+    REBLEN num_args;
+    for (num_args = 0; num_args < SPARE_VARLIST_ARGS; ++num_args) {
+        while (TG_Num_Spare_Varlists[num_args] != 0) {
+            REBLEN n = --TG_Num_Spare_Varlists[num_args];
+            GC_Kill_Series(TG_Spare_Varlists[num_args][n]);
+        }
+    }
+}
+
+
 //
 //  Push_Action: C
 //
@@ -1232,18 +1312,34 @@ void Push_Action(
 
     assert(f->varlist == nullptr);
 
-    Stub* s = Prep_Stub(
-        Alloc_Stub(),  // not preallocated
-        SERIES_MASK_VARLIST
-            | SERIES_FLAG_FIXED_SIZE // FRAME!s don't expand ATM
+    bool spare = (
+        num_args < SPARE_VARLIST_ARGS
+        and TG_Num_Spare_Varlists[num_args] != 0
     );
+
+    Stub* s;
+    if (spare) {  // see Free_Action_Varlist()
+        s = TG_Spare_Varlists[num_args][--TG_Num_Spare_Varlists[num_args]];
+        s->leader.bits = NODE_FLAG_NODE  // same as Prep_Stub(), keep data
+            | SERIES_MASK_VARLIST
+            | SERIES_FLAG_FIXED_SIZE;
+        TOUCH_STUB_IF_DEBUG(s);
+    }
+    else
+        s = Prep_Stub(
+            Alloc_Stub(),  // not preallocated
+            SERIES_MASK_VARLIST
+                | SERIES_FLAG_FIXED_SIZE // FRAME!s don't expand ATM
+        );
     SER_INFO(s) = SERIES_INFO_MASK_NONE;
     INIT_BONUS_KEYSOURCE(ARR(s), f);  // maps varlist back to f
     mutable_MISC(VarlistMeta, s) = nullptr;
     mutable_LINK(Patches, s) = nullptr;
     f->varlist = ARR(s);
 
-    if (not Did_Series_Data_Alloc(s, num_args + 1 + 1)) {  // +rootvar, +end
+    if (spare)  // data allocation was kept, and is big enough
+        assert(s->content.dynamic.rest >= num_args + 1 + 1);
+    else if (not Did_Series_Data_Alloc(s, num_args + 1 + 1)) {  // +root, +end
         SET_SERIES_FLAG(s, INACCESSIBLE);
         GC_Kill_Series(s);  // ^-- needs non-null data unless INACCESSIBLE
         f->varlist = nullptr;
@@ -1333,6 +1429,18 @@ void Begin_Action_Core(
     f->label_utf8 = cast(const char*, Frame_Label_Or_Anonymous_UTF8(f));
   #endif
 
+    if (Profile_Calls)  // see PROFILE-CALLS
+        Profile_Call_Begin(f);
+
+    if (Trace_Logging)  // see TRACE-LOG
+        Trace_Log_Call(f);
+
+    TRACEPOINT2(
+        action__entry,
+        label ? STR_UTF8(unwrap(label)) : nullptr,
+        f
+    );
+
     if (enfix) {
         //
         // While ST_ACTION_FULFILLING_ARG_FROM_OUT is set only during the first
@@ -1358,6 +1466,18 @@ void Begin_Action_Core(
 void Drop_Action(Frame(*) f) {
     assert(not f->label or IS_SYMBOL(unwrap(f->label)));
 
+    if (Profile_Calls)  // see PROFILE-CALLS
+        Profile_Call_End(f);
+
+    if (Trace_Logging)  // see TRACE-LOG
+        Trace_Log_Return(f);
+
+    TRACEPOINT2(
+        action__return,
+        f->label ? STR_UTF8(unwrap(f->label)) : nullptr,
+        f
+    );
+
     Clear_Executor_Flag(ACTION, f, RUNNING_ENFIX);
     Clear_Executor_Flag(ACTION, f, FULFILL_ONLY);
 
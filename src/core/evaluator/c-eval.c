@@ -399,10 +399,19 @@ Bounce Evaluator_Executor(Frame(*) f)
         goto finished;
     }
 
+    if (Count_Lines)  // see COUNT-LINES
+        Count_Line(f);
+
     f_current = Lookback_While_Fetching_Next(f);
     f_current_gotten = f_next_gotten;
     f_next_gotten = nullptr;
 
+    if (Get_Cell_Flag(f_current, BREAKPOINT)) {  // see SET-BREAKPOINT
+        if (PG_Breakpoint_Hook and PG_Breakpoint_Hook(SPARE, f))
+            goto return_thrown;
+        FRESHEN(SPARE);
+    }
+
 } evaluate: ;  // meaningful semicolon--subsequent macro may declare things
 
     // ^-- doesn't advance expression index: `reeval x` starts with `reeval`
@@ -765,6 +774,15 @@ Bounce Evaluator_Executor(Frame(*) f)
     //    existence or have their caching states changed.  But INDEX_ATTACHED
     //    and the various complexities involved with that means we have to
     //    flush here if the symbols match.
+    //
+    // 3. It's tempting to "compile" hot bodies so that `x: x + 1` becomes one
+    //    fused step, with arities and enfix decisions worked out in advance.
+    //    But nothing in a body's array is stable enough to precompute from:
+    //    any word (including `+`) may be rebound or redefined as enfix by
+    //    code the body itself runs, arrays have no write barrier to notify a
+    //    compiled form that it's stale, and feeds may be variadic so there's
+    //    no way to peek past f_next.  The f_next_gotten cache is the safe
+    //    form of that idea: one lookup reused between lookahead and dispatch.
 
     set_void_in_spare: ///////////////////////////////////////////////////////
 
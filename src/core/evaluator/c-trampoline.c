@@ -169,7 +169,7 @@ Bounce Trampoline_From_Top_Maybe_Root(void)
     ++Total_Eval_Cycles_Doublecheck;
   #endif
 
-    if (--Eval_Countdown <= 0) {
+    if (Eval_Step_Polls_Signals()) {
         //
         // Doing signals covers several things that may cause interruptions:
         //
@@ -336,6 +336,14 @@ Bounce Trampoline_From_Top_Maybe_Root(void)
     //    to a problem of how to express wanting TRAMPOLINE_KEEPALIVE to be
     //    applicable to throw situations as well--not all want it.  For now
     //    we conflate Just_Use_Out with the intent of keepalive on throw.
+    //
+    // 4. A CONTINUE in `for-each x data [if x > 10 [continue] ...]` has the
+    //    IF's branch and the loop's body frames between it and the loop that
+    //    catches it.  Evaluator and array frames keep no state that needs
+    //    cleaning up on a throw--their executors just return THROWN--so it's
+    //    cheaper to drop them here than to bounce through each one (paying
+    //    for the signal poll and the call).  Anything else still gets its
+    //    executor called, so loops, CATCH, and UNWIND targets see the throw.
 
     if (r == BOUNCE_THROWN) {
       thrown:
@@ -378,6 +386,20 @@ Bounce Trampoline_From_Top_Maybe_Root(void)
         Drop_Frame(FRAME);  // restores to baseline
         FRAME = TOP_FRAME;
 
+        while (  // skip frames that have nothing to clean up, see [4]
+            (
+                FRAME->executor == &Evaluator_Executor
+                or FRAME->executor == &Array_Executor
+                or FRAME->executor == &Delegated_Executor
+            )
+            and Not_Frame_Flag(FRAME, ROOT_FRAME)
+            and Not_Frame_Flag(FRAME, TRAMPOLINE_KEEPALIVE)
+            and FRAME != TG_Unwind_Frame
+        ){
+            Drop_Frame(FRAME);
+            FRAME = TOP_FRAME;
+        }
+
         if (FRAME->executor == &Just_Use_Out_Executor) {
             if (Get_Frame_Flag(FRAME, TRAMPOLINE_KEEPALIVE))
                 FRAME = FRAME->prior;  // don't let it be aborted, see [3]
@@ -126,31 +126,91 @@ Array(*) Copy_Values_Len_Extra_Shallow_Core(
 }
 
 
+//=//// ITERATIVE DEEP COPY //////////////////////////////////////////////=//
 //
-//  Clonify: C
-//
-// Clone the series embedded in a value *if* it's in the given set of types
-// (and if "cloning" makes sense for them, e.g. they are not simple scalars).
+// Deep copies used to recurse on the C stack once per nested array, so a
+// deeply nested structure could overflow it.  Now the copied arrays whose
+// cells still need cloning are kept on a worklist (a FLAVOR_POINTER series),
+// and a nullptr is pushed under each array's children to count the depth.
+// A cycle copied without sharing grows the depth forever, so there's still
+// a limit on it--but it's set by CLONE_MAX_DEPTH and not by the C stack.
 //
-// Note: The resulting clones will be managed.  The model for lists only
-// allows the topmost level to contain unmanaged values...and we *assume* the
-// values we are operating on here live inside of an array.
+// In the "shared" mode (COPY/DEEP/SHARED), each series is copied only once.
+// A hash table from originals to copies is kept, so values that referred to
+// the same series in the original refer to the same copy.  That also makes
+// it possible to copy cyclic structures.
 //
-void Clonify(
-    Cell(*) v,
-    Flags flags,
-    REBU64 deep_types
+
+#define CLONE_MAX_DEPTH 100000
+
+typedef struct {
+    Flags flags;
+    REBU64 deep_types;
+    REBSER *work;  // copied arrays to clonify (and depth markers), or nullptr
+    REBLEN depth;
+    REBSER *shared;  // (original, copy) pointer pairs, if sharing
+    REBLEN num_shared;
+} Clone_State;
+
+
+static REBLEN Shared_Slot(REBSER *shared, const REBSER *original)
+{
+    REBLEN mask = SER_USED(shared) / 2 - 1;  // capacity is a power of 2
+    uintptr_t bits = cast(uintptr_t, original);
+    REBLEN slot = cast(REBLEN, (bits >> 4) * 2654435761u) & mask;
+
+    while (true) {
+        const void *key = *SER_AT(const void*, shared, slot * 2);
+        if (key == nullptr or key == original)
+            return slot;
+        slot = (slot + 1) & mask;
+    }
+}
+
+static REBSER *Make_Shared_Table(REBLEN capacity)
+{
+    REBSER *shared = Make_Series_Core(capacity * 2, FLAG_FLAVOR(POINTER));
+    SET_SERIES_USED(shared, capacity * 2);
+    memset(SER_DATA(shared), 0, capacity * 2 * sizeof(void*));
+    return shared;
+}
+
+static void Remember_Shared_Copy(
+    Clone_State *cs,
+    const REBSER *original,
+    REBSER *copy
 ){
-    if (C_STACK_OVERFLOWING(&deep_types))
-        Fail_Stack_Overflow();
+    REBLEN capacity = SER_USED(cs->shared) / 2;
+    if ((cs->num_shared + 1) * 2 > capacity) {  // keep it at most half full
+        REBSER *bigger = Make_Shared_Table(capacity * 2);
+        REBLEN i;
+        for (i = 0; i < capacity; ++i) {
+            const void *key = *SER_AT(const void*, cs->shared, i * 2);
+            if (key == nullptr)
+                continue;
+            REBLEN slot = Shared_Slot(bigger, cast(const REBSER*, key));
+            *SER_AT(const void*, bigger, slot * 2) = key;
+            *SER_AT(void*, bigger, slot * 2 + 1)
+                = *SER_AT(void*, cs->shared, i * 2 + 1);
+        }
+        Free_Unmanaged_Series(cs->shared);
+        cs->shared = bigger;
+    }
 
-    assert(flags & NODE_FLAG_MANAGED);
+    REBLEN slot = Shared_Slot(cs->shared, original);
+    *SER_AT(const void*, cs->shared, slot * 2) = original;
+    *SER_AT(void*, cs->shared, slot * 2 + 1) = copy;
+    ++cs->num_shared;
+}
 
-    // !!! Could theoretically do what COPY does and generate a new hijackable
-    // identity.  There's no obvious use for this; hence not implemented.
-    //
-    assert(not (deep_types & FLAGIT_KIND(REB_ACTION)));
 
+// Clone the series embedded in a value *if* it's in the given set of types
+// (and if "cloning" makes sense for them, e.g. they are not simple scalars).
+// If the copy is an array whose cells have to be cloned in turn, it goes on
+// the worklist instead of being recursed into.
+//
+static void Clonify_Shallow(Clone_State *cs, Cell(*) v)
+{
   #if DEBUG_UNREADABLE_TRASH
     if (IS_TRASH(v))  // running code below would assert
         return;
@@ -161,92 +221,198 @@ void Clonify(
     //
     enum Reb_Kind heart = CELL_HEART(v);
 
-    if (deep_types & FLAGIT_KIND(heart) & TS_SERIES_OBJ) {
+    if (not (cs->deep_types & FLAGIT_KIND(heart) & TS_SERIES_OBJ)) {
         //
-        // Objects and series get shallow copied at minimum
+        // We're not copying the value, so inherit the const bit from the
+        // original value's point of view, if applicable.
         //
-        REBSER *series;
-        bool would_need_deep;
+        if (Not_Cell_Flag(v, EXPLICITLY_MUTABLE))
+            v->header.bits |= (cs->flags & ARRAY_FLAG_CONST_SHALLOW);
+        return;
+    }
 
-        if (ANY_CONTEXT_KIND(heart)) {
-            INIT_VAL_CONTEXT_VARLIST(
-                v,
-                CTX_VARLIST(Copy_Context_Shallow_Managed(VAL_CONTEXT(v)))
-            );
-            series = CTX_VARLIST(VAL_CONTEXT(v));
-            would_need_deep = true;
-        }
-        else if (ANY_ARRAYLIKE(v)) {
-            series = Copy_Array_At_Extra_Shallow(
-                VAL_ARRAY(v),
-                0,  // index
-                VAL_SPECIFIER(v),
-                0,  // extra
-                NODE_FLAG_MANAGED
-            );
+    // Objects and series get shallow copied at minimum.  When sharing, a
+    // series that was already copied just gets pointed at its copy.
+    //
+    const REBSER *original;
+    if (ANY_CONTEXT_KIND(heart))
+        original = CTX_VARLIST(VAL_CONTEXT(v));
+    else if (ANY_ARRAYLIKE(v))
+        original = VAL_ARRAY(v);
+    else if (ANY_SERIES_KIND(heart))
+        original = VAL_SERIES(v);
+    else
+        return;
 
-            // Despite their immutability, new instances of PATH! need to be
-            // able to bind their word components differently from the path
-            // they are copied from...which requires new cells.  (Also any
-            // nested blocks or groups need to be copied deeply.)
-            //
-            if (ANY_SEQUENCE_KIND(heart))
-                Freeze_Array_Shallow(ARR(series));
-
-            INIT_VAL_NODE1(v, series);
-            INIT_SPECIFIER(v, UNBOUND);  // copying w/specifier makes specific
-            would_need_deep = true;
-        }
-        else if (ANY_SERIES_KIND(heart)) {
-            series = Copy_Series_Core(
-                VAL_SERIES(v),
-                NODE_FLAG_MANAGED
-            );
-            INIT_VAL_NODE1(v, series);
-            would_need_deep = false;
-        }
-        else {
-            series = nullptr;
-            would_need_deep = false;
+    if (cs->shared) {
+        REBLEN slot = Shared_Slot(cs->shared, original);
+        REBSER *copy = cast(REBSER*, *SER_AT(void*, cs->shared, slot * 2 + 1));
+        if (*SER_AT(const void*, cs->shared, slot * 2) == original) {
+            if (ANY_CONTEXT_KIND(heart))
+                INIT_VAL_CONTEXT_VARLIST(v, ARR(copy));
+            else {
+                INIT_VAL_NODE1(v, copy);
+                if (ANY_ARRAYLIKE(v))
+                    INIT_SPECIFIER(v, UNBOUND);
+            }
+            return;
         }
+    }
+
+    REBSER *series;
+    bool would_need_deep;
 
-        // If we're going to copy deeply, we go back over the shallow
-        // copied series and "clonify" the values in it.
+    if (ANY_CONTEXT_KIND(heart)) {
+        INIT_VAL_CONTEXT_VARLIST(
+            v,
+            CTX_VARLIST(Copy_Context_Shallow_Managed(VAL_CONTEXT(v)))
+        );
+        series = CTX_VARLIST(VAL_CONTEXT(v));
+        would_need_deep = true;
+    }
+    else if (ANY_ARRAYLIKE(v)) {
+        series = Copy_Array_At_Extra_Shallow(
+            VAL_ARRAY(v),
+            0,  // index
+            VAL_SPECIFIER(v),
+            0,  // extra
+            NODE_FLAG_MANAGED
+        );
+
+        // Despite their immutability, new instances of PATH! need to be
+        // able to bind their word components differently from the path
+        // they are copied from...which requires new cells.  (Also any
+        // nested blocks or groups need to be copied deeply.)
         //
-        if (would_need_deep and (deep_types & FLAGIT_KIND(heart))) {
-            Cell(const*) sub_tail = ARR_TAIL(ARR(series));
-            Cell(*) sub = ARR_HEAD(ARR(series));
-            for (; sub != sub_tail; ++sub)
-                Clonify(sub, flags, deep_types);
-        }
+        if (ANY_SEQUENCE_KIND(heart))
+            Freeze_Array_Shallow(ARR(series));
+
+        INIT_VAL_NODE1(v, series);
+        INIT_SPECIFIER(v, UNBOUND);  // copying w/specifier makes specific
+        would_need_deep = true;
     }
     else {
-        // We're not copying the value, so inherit the const bit from the
-        // original value's point of view, if applicable.
-        //
-        if (Not_Cell_Flag(v, EXPLICITLY_MUTABLE))
-            v->header.bits |= (flags & ARRAY_FLAG_CONST_SHALLOW);
+        series = Copy_Series_Core(
+            VAL_SERIES(v),
+            NODE_FLAG_MANAGED
+        );
+        INIT_VAL_NODE1(v, series);
+        would_need_deep = false;
+    }
+
+    if (cs->shared)
+        Remember_Shared_Copy(cs, original, series);
+
+    // If we're going to copy deeply, the shallow copied series has to have
+    // its values "clonified" too.
+    //
+    if (
+        would_need_deep
+        and (cs->deep_types & FLAGIT_KIND(heart))
+        and SER_USED(series) != 0
+    ){
+        if (cs->work == nullptr)
+            cs->work = Make_Series_Core(16, FLAG_FLAVOR(POINTER));
+        Push_Pointer_To_Series(cs->work, series);
     }
 }
 
 
+// Clonify the cells of everything on the worklist, which will push any
+// arrays they copy in turn.
+//
+static void Clonify_Worklist(Clone_State *cs)
+{
+    if (cs->work == nullptr)
+        return;
+
+    while (SER_USED(cs->work) != 0) {
+        REBLEN used = SER_USED(cs->work);
+        Array(*) a = cast(Array(*), *SER_AT(void*, cs->work, used - 1));
+        SET_SERIES_USED(cs->work, used - 1);
+
+        if (a == nullptr) {  // all of an array's children are done
+            --cs->depth;
+            continue;
+        }
+
+        if (++cs->depth > CLONE_MAX_DEPTH)  // e.g. cycle, and not /SHARED
+            Fail_Stack_Overflow();
+        Push_Pointer_To_Series(cs->work, nullptr);  // marks this level
+
+        Cell(const*) tail = ARR_TAIL(a);
+        Cell(*) item = ARR_HEAD(a);
+        for (; item != tail; ++item)
+            Clonify_Shallow(cs, item);
+    }
+}
+
+
+static void Free_Clone_State(Clone_State *cs)
+{
+    if (cs->work)
+        Free_Unmanaged_Series(cs->work);
+    if (cs->shared)
+        Free_Unmanaged_Series(cs->shared);
+}
+
+
+//
+//  Clonify: C
+//
+// Clone the series embedded in a value *if* it's in the given set of types
+// (and if "cloning" makes sense for them, e.g. they are not simple scalars).
+//
+// Note: The resulting clones will be managed.  The model for lists only
+// allows the topmost level to contain unmanaged values...and we *assume* the
+// values we are operating on here live inside of an array.
+//
+void Clonify(
+    Cell(*) v,
+    Flags flags,
+    REBU64 deep_types
+){
+    assert(flags & NODE_FLAG_MANAGED);
+
+    // !!! Could theoretically do what COPY does and generate a new hijackable
+    // identity.  There's no obvious use for this; hence not implemented.
+    //
+    assert(not (deep_types & FLAGIT_KIND(REB_ACTION)));
+
+    Clone_State cs;
+    cs.flags = flags;
+    cs.deep_types = deep_types;
+    cs.work = nullptr;
+    cs.depth = 0;
+    cs.shared = nullptr;
+    cs.num_shared = 0;
+
+    Clonify_Shallow(&cs, v);
+    Clonify_Worklist(&cs);
+    Free_Clone_State(&cs);
+}
+
+
 //
-//  Copy_Array_Core_Managed: C
+//  Copy_Array_Shared_Managed: C
 //
-// Copy a block, copy specified values, deeply if indicated.
+// Copy a block, copy specified values, deeply if indicated.  If `shared`,
+// then any series that is reached more than once is only copied once (see
+// ITERATIVE DEEP COPY above).
 //
 // To avoid having to do a second deep walk to add managed bits on all series,
 // the resulting array will already be deeply under GC management, and hence
 // cannot be freed with Free_Unmanaged_Series().
 //
-Array(*) Copy_Array_Core_Managed(
+Array(*) Copy_Array_Shared_Managed(
     Array(const*) original,
     REBLEN index,
     REBSPC *specifier,
     REBLEN tail,
     REBLEN extra,
     Flags flags,
-    REBU64 deep_types
+    REBU64 deep_types,
+    bool shared
 ){
     if (index > tail) // !!! should this be asserted?
         index = tail;
@@ -255,6 +421,7 @@ Array(*) Copy_Array_Core_Managed(
         return Make_Array_Core(extra, flags | NODE_FLAG_MANAGED);
 
     assert(index <= tail and tail <= ARR_LEN(original));
+    assert(not (deep_types & FLAGIT_KIND(REB_ACTION)));  // see Clonify()
 
     REBLEN len = tail - index;
 
@@ -270,14 +437,30 @@ Array(*) Copy_Array_Core_Managed(
     Cell(const*) src = ARR_AT(original, index);
     Cell(*) dest = ARR_HEAD(copy);
     REBLEN count = 0;
-    for (; count < len; ++count, ++dest, ++src) {
-        Clonify(
-            Derelativize(dest, src, specifier),
-            flags | NODE_FLAG_MANAGED,
-            deep_types
-        );
+    for (; count < len; ++count, ++dest, ++src)
+        Derelativize(dest, src, specifier);
+
+    if (deep_types == 0 and not (flags & ARRAY_FLAG_CONST_SHALLOW))
+        return copy;  // nothing to clonify
+
+    Clone_State cs;
+    cs.flags = flags | NODE_FLAG_MANAGED;
+    cs.deep_types = deep_types;
+    cs.work = nullptr;
+    cs.depth = 0;
+    cs.num_shared = 0;
+    cs.shared = shared ? Make_Shared_Table(16) : nullptr;
+
+    if (cs.shared and index == 0 and tail == ARR_LEN(original))
+        Remember_Shared_Copy(&cs, original, copy);  // inner references too
+
+    dest = ARR_HEAD(copy);
+    for (count = 0; count < len; ++count, ++dest) {
+        Clonify_Shallow(&cs, dest);
+        Clonify_Worklist(&cs);
     }
 
+    Free_Clone_State(&cs);
     return copy;
 }
 
@@ -59,6 +59,36 @@ static const deci deci_minus_one = {1u, 0u, 0u, 1u, 0};
 
 static const uint32_t min_int64_t_as_deci[] = {0u, 0x80000000u, 0u};
 
+// Where the compiler has a 128-bit integer, a whole significand fits in one.
+// Additions and comparisons of decis with the same exponent (e.g. MONEY!
+// amounts that all have cents), and multiplications whose exact product
+// doesn't need rounding, can be done directly with it.  Anything else goes
+// on to the general multi-word code below each fast path.
+//
+#if defined(__SIZEOF_INT128__)
+    #define DECI_USE_INT128 1
+
+    typedef __uint128_t deci_u128;
+
+    #define DECI_U128_1E26 \
+        (cast(deci_u128, 10000000000000u) * 10000000000000u)
+
+    inline static deci_u128 deci_significand(const deci *d) {
+        return (cast(deci_u128, d->m2) << 64)
+            | (cast(deci_u128, d->m1) << 32)
+            | d->m0;
+    }
+
+    inline static void set_deci_significand(deci *d, deci_u128 m) {
+        assert(m < DECI_U128_1E26);
+        d->m0 = MASK32(m);
+        d->m1 = MASK32(m >> 32);
+        d->m2 = MASK32(m >> 64);
+    }
+#else
+    #define DECI_USE_INT128 0
+#endif
+
 /*
     Compare significand a and significand b;
     -1 means a < b;
@@ -421,6 +451,14 @@ inline static void make_comparable(
 }
 
 bool deci_is_equal(deci a, deci b) {
+  #if DECI_USE_INT128
+    if (a.e == b.e) {
+        deci_u128 ma = deci_significand(&a);
+        deci_u128 mb = deci_significand(&b);
+        return ma == mb and (a.s == b.s or ma == 0);
+    }
+  #endif
+
     int32_t ea = a.e, eb = b.e, ta, tb;
 
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
@@ -471,6 +509,14 @@ bool deci_is_lesser_or_equal(deci a, deci b) {
     if (!a.s && b.s)
         return m_is_zero(3, sa) and m_is_zero(3, sb);
 
+  #if DECI_USE_INT128
+    if (a.e == b.e) {
+        deci_u128 ma = deci_significand(&a);
+        deci_u128 mb = deci_significand(&b);
+        return a.s ? ma >= mb : ma <= mb;
+    }
+  #endif
+
     make_comparable (sa, &ea, &ta, sb, &eb, &tb);
 
     /* round */
@@ -485,6 +531,32 @@ bool deci_is_lesser_or_equal(deci a, deci b) {
 
 deci deci_add(deci a, deci b) {
     deci c;
+
+  #if DECI_USE_INT128
+    if (a.e == b.e) {  // no decimal shift, so no truncation to round
+        deci_u128 ma = deci_significand(&a);
+        deci_u128 mb = deci_significand(&b);
+        c.e = a.e;
+        if (a.s != b.s) {
+            if (ma >= mb) {
+                c.s = a.s;
+                set_deci_significand(&c, ma - mb);
+            }
+            else {
+                c.s = b.s;
+                set_deci_significand(&c, mb - ma);
+            }
+            return c;
+        }
+        deci_u128 sum = ma + mb;  // can't overflow, significands < 1e26
+        if (sum < DECI_U128_1E26) {  // else needs normalizing, see below
+            c.s = a.s;
+            set_deci_significand(&c, sum);
+            return c;
+        }
+    }
+  #endif
+
     uint32_t sc[4];
     int32_t ea = a.e, eb = b.e, ta, tb, tc, test;
 
@@ -992,6 +1064,29 @@ deci deci_multiply(const deci a, const deci b) {
     /* compute the sign */
     c.s = (!a.s && b.s) || (a.s && !b.s);
 
+  #if DECI_USE_INT128
+    blockscope {
+        deci_u128 ma = deci_significand(&a);
+        deci_u128 mb = deci_significand(&b);
+        if ((ma >> 64) == 0 and (mb >> 64) == 0) {  // product fits in 128
+            deci_u128 product = ma * mb;
+            if (product < DECI_U128_1E26) {  // no shift, so no rounding
+                set_deci_significand(&c, product);
+                sc[0] = c.m0;
+                sc[1] = c.m1;
+                sc[2] = c.m2;
+                sc[3] = 0;
+                m_ldexp (sc, &f, a.e + b.e, 0);
+                c.m0 = sc[0];
+                c.m1 = sc[1];
+                c.m2 = sc[2];
+                c.e = f;
+                return c;
+            }
+        }
+    }
+  #endif
+
     /* multiply sa by sb yielding "double significand" sc */
     m_multiply (sc, 3, sa, 3, sb);
 
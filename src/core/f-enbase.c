@@ -21,9 +21,37 @@
 //
 //=////////////////////////////////////////////////////////////////////////=//
 //
+// On x86-64, base-64 and base-16 use SSSE3 for runs that have no whitespace
+// or padding in them.  The base-64 method is Wojciech Muła's (as also used
+// by Lemire's simdutf):
+//
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+// http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+//
+// Decoding a 16-character block checks that every character is in the
+// alphabet, and if any is not then the scalar loop takes that block.  So the
+// scalar code still defines what is accepted (and what the errors are).
+//
 
 #include "sys-core.h"
 
+// The SSSE3 paths are compiled for that instruction set with a target
+// attribute, and only taken if detected at runtime (like %s-utf8.c does).
+//
+#if defined(__x86_64__) || defined(_M_X64)
+  #if defined(__GNUC__) || defined(__clang__)
+    #include <immintrin.h>
+    #define ENBASE_SSSE3 1
+    #define ENBASE_SSSE3_TARGET __attribute__((target("ssse3")))
+  #elif defined(_MSC_VER)
+    #include <intrin.h>
+    #define ENBASE_SSSE3 1
+    #define ENBASE_SSSE3_TARGET
+  #endif
+#endif
+
+static bool enbase_ssse3 = false;  // set by Startup_Enbase() if CPU supports
+
 
 //
 // Base-64 binary decoder table.
@@ -166,6 +194,211 @@ static const Byte Enbase64[64] =
 };
 
 
+#if defined(ENBASE_SSSE3)
+
+// Decode 16 base-64 characters into 12 bytes, or return false (writing
+// nothing) if any of them isn't in the alphabet.
+//
+ENBASE_SSSE3_TARGET
+static bool Decode_Base64_Block_Ssse3(Byte* out, const Byte* src)
+{
+    __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+
+    __m128i hi = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F));
+    __m128i lo = _mm_and_si128(in, _mm_set1_epi8(0x0F));
+
+    // Bit H of entry L says if (H << 4 | L) is in the alphabet.  Bytes with
+    // the high bit set get no bit position, so they never match.
+    //
+    const __m128i mask_lut = _mm_setr_epi8(
+        cast(char, 0xA8), cast(char, 0xF8), cast(char, 0xF8), cast(char, 0xF8),
+        cast(char, 0xF8), cast(char, 0xF8), cast(char, 0xF8), cast(char, 0xF8),
+        cast(char, 0xF8), cast(char, 0xF8), cast(char, 0xF0), 0x54,
+        0x50, 0x50, 0x50, 0x54
+    );
+    const __m128i bitpos_lut = _mm_setr_epi8(
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, cast(char, 0x80),
+        0, 0, 0, 0, 0, 0, 0, 0
+    );
+    __m128i bits = _mm_and_si128(
+        _mm_shuffle_epi8(mask_lut, lo),
+        _mm_shuffle_epi8(bitpos_lut, hi)
+    );
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128())) != 0)
+        return false;
+
+    // Map characters to 6-bit values by adding an amount that depends on the
+    // high nibble, except that '/' shares its nibble with '+'.
+    //
+    const __m128i shift_lut = _mm_setr_epi8(
+        0, 0, 19, 4, -65, -65, -71, -71,
+        0, 0, 0, 0, 0, 0, 0, 0
+    );
+    __m128i shift = _mm_add_epi8(
+        _mm_shuffle_epi8(shift_lut, hi),
+        _mm_and_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('/')), _mm_set1_epi8(-3))
+    );
+    __m128i values = _mm_add_epi8(in, shift);
+
+    // Pack four 6-bit values per 32-bit lane into 24 bits, then gather the
+    // three bytes of each lane in big-endian order.
+    //
+    __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    packed = _mm_shuffle_epi8(packed, _mm_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+    ));
+
+    _mm_storel_epi64(cast(__m128i*, out), packed);
+    uint32_t last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+    memcpy(out + 8, &last, 4);
+    return true;
+}
+
+
+// Decode 16 hex digits (either case) into 8 bytes, or return false (writing
+// nothing) if any of them isn't a hex digit.
+//
+ENBASE_SSSE3_TARGET
+static bool Decode_Base16_Block_Ssse3(Byte* out, const Byte* src)
+{
+    __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+
+    __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+    __m128i alpha = _mm_sub_epi8(
+        _mm_or_si128(in, _mm_set1_epi8(0x20)),  // lowercase
+        _mm_set1_epi8('a')
+    );
+
+    // unsigned x <= k is max(x, k) == k
+    //
+    __m128i is_digit = _mm_cmpeq_epi8(
+        _mm_max_epu8(digit, _mm_set1_epi8(9)), _mm_set1_epi8(9)
+    );
+    __m128i is_alpha = _mm_cmpeq_epi8(
+        _mm_max_epu8(alpha, _mm_set1_epi8(5)), _mm_set1_epi8(5)
+    );
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF)
+        return false;
+
+    __m128i values = _mm_or_si128(
+        _mm_and_si128(is_digit, digit),
+        _mm_andnot_si128(is_digit, _mm_add_epi8(alpha, _mm_set1_epi8(10)))
+    );
+
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+    _mm_storel_epi64(cast(__m128i*, out), _mm_packus_epi16(pairs, pairs));
+    return true;
+}
+
+
+// Encode groups of 3 bytes as 4 characters, 4 groups at a time (loading 16
+// bytes, so there must be 4 readable bytes past the last group it does).
+// Returns how many groups were done, the caller does the rest.
+//
+ENBASE_SSSE3_TARGET
+static REBLEN Encode_Base64_Groups_Ssse3(
+    Byte* out,
+    const Byte* src,
+    REBLEN groups,
+    const Byte* src_end
+){
+    REBLEN done = 0;
+    for (; groups - done >= 4 and src_end - src >= 16; done += 4) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+        ));
+        __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+        __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+        __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(t1, t3);
+
+        // 0..25 => 'A' offset, 26..51 => 'a' offset, 52..61 => '0' offset,
+        // 62 => '+' offset, 63 => '/' offset...picked from a 16-entry table.
+        //
+        __m128i slot = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        slot = _mm_or_si128(slot, _mm_and_si128(less, _mm_set1_epi8(13)));
+        const __m128i offset_lut = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+            '/' - 63, 'A', 0, 0
+        );
+        __m128i chars = _mm_add_epi8(
+            _mm_shuffle_epi8(offset_lut, slot),
+            indices
+        );
+
+        _mm_storeu_si128(cast(__m128i*, out), chars);
+        out += 16;
+        src += 12;
+    }
+    return done;
+}
+
+
+// Encode bytes as hex, 16 at a time.  Returns how many bytes were done.
+//
+ENBASE_SSSE3_TARGET
+static REBLEN Encode_Base16_Ssse3(Byte* out, const Byte* src, REBLEN len)
+{
+    const __m128i digits = _mm_loadu_si128(cast(const __m128i*, Hex_Digits));
+
+    REBLEN done = 0;
+    for (; len - done >= 16; done += 16) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, src + done));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0F));
+        __m128i lo = _mm_and_si128(in, _mm_set1_epi8(0x0F));
+        hi = _mm_shuffle_epi8(digits, hi);
+        lo = _mm_shuffle_epi8(digits, lo);
+        _mm_storeu_si128(cast(__m128i*, out), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(cast(__m128i*, out + 16), _mm_unpackhi_epi8(hi, lo));
+        out += 32;
+    }
+    return done;
+}
+
+static bool Cpu_Has_Ssse3(void) {
+  #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+  #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+  #endif
+}
+
+#endif
+
+
+//
+//  Startup_Enbase: C
+//
+void Startup_Enbase(void)
+{
+  #if defined(ENBASE_SSSE3)
+    enbase_ssse3 = Cpu_Has_Ssse3();
+  #endif
+}
+
+
+// Make room for `n` ASCII bytes at the tail of a string, which the caller
+// fills in.  (One expansion, instead of one Append_Codepoint() per char.)
+//
+static Byte* Append_Ascii_Space(String(*) s, REBLEN n)
+{
+    Size old_size = STR_SIZE(s);
+    Length old_len = STR_LEN(s);
+    EXPAND_SERIES_TAIL(s, n);
+    TERM_STR_LEN_SIZE(s, old_len + n, old_size + n);
+    return BIN_AT(s, old_size);
+}
+
+
 //
 //  Decode_Base2: C
 //
@@ -224,6 +457,18 @@ static Binary(*) Decode_Base16(const Byte* *src, REBLEN len, Byte delim)
 
     for (; len > 0; cp++, len--) {
 
+      #if defined(ENBASE_SSSE3)
+        if (enbase_ssse3 and not (count & 1)) {
+            while (len >= 16 and Decode_Base16_Block_Ssse3(bp, cp)) {
+                bp += 8;
+                cp += 16;
+                len -= 16;
+            }
+            if (len == 0)
+                break;
+        }
+      #endif
+
         if (delim && *cp == delim) break;
 
         Byte lex = Lex_Map[*cp];
@@ -265,6 +510,18 @@ static Binary(*) Decode_Base64(const Byte* *src, REBLEN len, Byte delim)
 
     for (; len > 0; cp++, len--) {
 
+      #if defined(ENBASE_SSSE3)
+        if (enbase_ssse3 and flip == 0) {
+            while (len >= 16 and Decode_Base64_Block_Ssse3(bp, cp)) {
+                bp += 12;
+                cp += 16;
+                len -= 16;
+            }
+            if (len == 0)
+                break;
+        }
+      #endif
+
         // Check for terminating delimiter (optional):
         if (delim && *cp == delim) break;
 
@@ -395,28 +652,49 @@ void Form_Base2(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
 //
 // Base16 encode a range of arbitrary bytes into a byte-sized ASCII series.
 //
+// With `brk`, there's a newline before the data and after every 32 bytes,
+// and the output ends with a newline (when it's at least 32 bytes).
+//
 void Form_Base16(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
 {
     if (len == 0)
         return;
 
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor"):
-    //
-    //     len * 2 + len / 32 + 32
+    bool lines = brk and len >= 32;
+    REBLEN per_line = brk ? 32 : len;
+    REBLEN total = 2 * len;
+    if (lines)
+        total += 1 + len / 32 + (len % 32 != 0 ? 1 : 0);
 
-    if (brk and len >= 32)
-        Append_Codepoint(mo->series, LF);
+    Byte* out = Append_Ascii_Space(mo->series, total);
 
-    REBLEN count;
-    for (count = 1; count <= len; count++) {
-        Form_Hex2(mo, *src++);
-        if (brk and ((count % 32) == 0))
-            Append_Codepoint(mo->series, LF);
+    if (lines)
+        *out++ = LF;
+
+    REBLEN i = 0;
+    while (i < len) {
+        REBLEN n = MIN(per_line, len - i);
+        REBLEN done = 0;
+
+      #if defined(ENBASE_SSSE3)
+        if (enbase_ssse3)
+            done = Encode_Base16_Ssse3(out, src + i, n);
+      #endif
+
+        for (; done < n; ++done) {
+            Byte b = src[i + done];
+            out[2 * done] = Hex_Digits[b >> 4];
+            out[2 * done + 1] = Hex_Digits[b & 0xF];
+        }
+        out += 2 * n;
+        i += n;
+
+        if (brk and n == 32)
+            *out++ = LF;
     }
 
-    if (brk and (len >= 32) and *BIN_LAST(mo->series) != LF)
-        Append_Codepoint(mo->series, LF);
+    if (lines and len % 32 != 0)
+        *out++ = LF;
 }
 
 
@@ -425,56 +703,72 @@ void Form_Base16(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
 //
 // Base64 encode a range of arbitrary bytes into a byte-sized ASCII series.
 //
-// !!! Strongly parallels this code, may have originated from it:
-// http://web.mit.edu/freebsd/head/contrib/wpa/src/utils/base64.c
+// With `brk`, there's a newline after every 64 characters, plus one before
+// and after the data if it is long enough.  (These thresholds are from the
+// R3-Alpha code this replaced, and are kept so molded output is unchanged.)
 //
 void Form_Base64(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
 {
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor") and preallocate size for that.  Now
-    // it appends one character at a time and relies upon the mold buffer's
-    // natural expansion.  Review if it needs the optimization.
-
-    String(*) s = mo->series;
-
-    REBINT loop = cast(int, len / 3) - 1;
-    if (brk and 4 * loop > 64)
-        Append_Codepoint(s, LF);
-
-    REBINT x;
-    for (x = 0; x <= 3 * loop; x += 3) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x] & 0x3) << 4) + (src[x + 1] >> 4)]
-        );
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x + 1] & 0xF) << 2) + (src[x + 2] >> 6)]
-        );
-        Append_Codepoint(s, Enbase64[(src[x + 2] % 0x40)]);
-        if ((x + 3) % 48 == 0 && brk)
-            Append_Codepoint(s, LF);
-    }
+    REBLEN groups = len / 3;
+    REBLEN rem = len % 3;
+
+    bool lead = brk and groups >= 18;
+    bool trail = brk and groups >= 17 and not (rem == 0 and groups % 16 == 0);
+    REBLEN per_line = brk ? 16 : groups;  // in groups of 3 bytes
+
+    REBLEN total = 4 * groups + (rem != 0 ? 4 : 0);
+    if (brk)
+        total += groups / 16;
+    if (lead)
+        ++total;
+    if (trail)
+        ++total;
+
+    Byte* out = Append_Ascii_Space(mo->series, total);
+    const Byte* src_end = src + len;
+
+    if (lead)
+        *out++ = LF;
+
+    REBLEN g = 0;
+    while (g < groups) {
+        REBLEN n = MIN(per_line, groups - g);
+        REBLEN done = 0;
+
+      #if defined(ENBASE_SSSE3)
+        if (enbase_ssse3)
+            done = Encode_Base64_Groups_Ssse3(out, src, n, src_end);
+      #endif
+
+        for (; done < n; ++done) {
+            const Byte* p = src + 3 * done;
+            Byte* o = out + 4 * done;
+            o[0] = Enbase64[p[0] >> 2];
+            o[1] = Enbase64[((p[0] & 0x3) << 4) + (p[1] >> 4)];
+            o[2] = Enbase64[((p[1] & 0xF) << 2) + (p[2] >> 6)];
+            o[3] = Enbase64[p[2] & 0x3F];
+        }
+        src += 3 * n;
+        out += 4 * n;
+        g += n;
 
-    if ((len % 3) != 0) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
+        if (brk and n == 16)
+            *out++ = LF;
+    }
 
-        if (len - x == 1) {
-            Append_Codepoint(s, Enbase64[((src[x] & 0x3) << 4)]);
-            Append_Codepoint(s, '=');
+    if (rem != 0) {
+        *out++ = Enbase64[src[0] >> 2];
+        if (rem == 1) {
+            *out++ = Enbase64[(src[0] & 0x3) << 4];
+            *out++ = '=';
         }
         else {
-            Append_Codepoint(
-                s,
-                Enbase64[((src[x] & 0x3) << 4) | (src[x + 1] >> 4)]
-            );
-            Append_Codepoint(s, Enbase64[(src[x + 1] & 0xF) << 2]);
+            *out++ = Enbase64[((src[0] & 0x3) << 4) | (src[1] >> 4)];
+            *out++ = Enbase64[(src[1] & 0xF) << 2];
         }
-
-        Append_Codepoint(s, '=');
+        *out++ = '=';
     }
 
-    if (brk and x > 49 and *BIN_LAST(s) != LF)
-        Append_Codepoint(s, LF);
+    if (trail)
+        *out++ = LF;
 }
@@ -31,6 +31,8 @@
 
 #include "sys-core.h"
 
+#include <time.h>  // clock() for startup timings
+
 // Building Rebol as a library may still entail a desire to ship that library
 // with built-in extensions (e.g. building libr3.js wants to have JavaScript
 // natives as an extension).  So there is no meaning to "built-in extensions"
@@ -113,9 +115,11 @@ DECLARE_NATIVE(builtin_extensions)
 //
 //  "Extension module loader (for DLLs or built-in extensions)"
 //
-//      return: [module!]
+//      return: "Null if /LAZY only made stubs for the extension's exports"
+//          [<opt> module!]
 //      where "Path to extension file or block of builtin extension details"
 //          [file! block!]  ; !!! Should it take a LIBRARY! instead?
+//      /lazy "Defer builtin extensions with `Options: [lazy]` to first use"
 //  ]
 //
 DECLARE_NATIVE(load_extension)
@@ -135,9 +139,18 @@ DECLARE_NATIVE(load_extension)
 // the extension mechanism work in the WebAssembly build with so-called
 // "side modules", so that extra bits of native code functionality can be
 // pulled into web sessions that want them.
+//
+// Most runs of the interpreter only use one or two extensions, yet starting
+// them all at boot means running every init script and STARTUP* (seeding
+// random number generators and such).  So /LAZY lets the boot code ask for
+// builtin extensions to only put stubs in lib for their exports, with the
+// real load done when one of them is first called.  (See LAZY-EXTENSION in
+// %sys-base.r for which extensions qualify.)
 {
     INCLUDE_PARAMS_OF_LOAD_EXTENSION;
 
+    clock_t start = clock();  // for SYSTEM.STATE.STARTUP-TIMINGS
+
     // See IDX_COLLATOR_MAX for collated block contents, which include init
     // and shutdown functions, as well as Rebol script source, plus Dispatcher
     // functions for each native.
@@ -183,17 +196,6 @@ DECLARE_NATIVE(load_extension)
         dispatchers_handle
     );
 
-    // !!! used to use STD_EXT_CTX, now this would go in META OF
-
-    Context(*) module_ctx = Alloc_Context_Core(REB_MODULE, 1, NODE_FLAG_MANAGED);
-
-    PG_Next_Native_Dispatcher = dispatchers;
-    PG_Currently_Loading_Module = module_ctx;
-
-    DECLARE_LOCAL (module);
-    Init_Context_Cell(module, REB_MODULE, module_ctx);
-    PUSH_GC_GUARD(module);  // !!! Is GC guard unnecessary due to references?
-
     size_t script_size;
     Byte* script_utf8 = Decompress_Alloc_Core(
         &script_size,
@@ -233,6 +235,25 @@ DECLARE_NATIVE(load_extension)
             Init_Text(script, STR(bin));
     }
 
+    if (REF(lazy) and IS_BLOCK(ARG(where))) {
+        if (rebUnboxLogic("sys.util.lazy-extension", script, ARG(where))) {
+            rebRelease(script);
+            DROP_GC_GUARD(details);
+            return nullptr;  // loaded when one of its exports is called
+        }
+    }
+
+    // !!! used to use STD_EXT_CTX, now this would go in META OF
+
+    Context(*) module_ctx = Alloc_Context_Core(REB_MODULE, 1, NODE_FLAG_MANAGED);
+
+    PG_Next_Native_Dispatcher = dispatchers;
+    PG_Currently_Loading_Module = module_ctx;
+
+    DECLARE_LOCAL (module);
+    Init_Context_Cell(module, REB_MODULE, module_ctx);
+    PUSH_GC_GUARD(module);  // !!! Is GC guard unnecessary due to references?
+
     // !!! We currently are pushing all extensions into the lib context so
     // they are seen by every module.  This is an interim step to keep things
     // running, but a better strategy is needed.
@@ -256,6 +277,19 @@ DECLARE_NATIVE(load_extension)
 
     rebElide("append system.extensions", CTX_ARCHETYPE(module_ctx));
 
+    // Extensions are almost always loaded during startup, so the time taken
+    // by each is kept with the core's own boot phases.
+    //
+    double secs = cast(double, clock() - start) / CLOCKS_PER_SEC;
+    rebElide(
+        "if system.state.startup-timings [",
+            "append system.state.startup-timings",
+                "any [select maybe meta-of", CTX_ARCHETYPE(module_ctx), "'name",
+                    "'extension]",
+            "append system.state.startup-timings", rebR(rebDecimal(secs)),
+        "]"
+    );
+
     // !!! If modules are to be "unloadable", they would need some kind of
     // finalizer to clean up their resources.  There are shutdown actions
     // defined in a couple of extensions, but no protocol by which the
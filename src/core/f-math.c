@@ -241,6 +241,103 @@ REBINT Emit_Integer(Byte* buf, REBI64 val)
 /* this is appropriate for 64-bit IEEE754 binary floating point format */
 #define MAX_DIGITS 17
 
+// Integers up to 2^53 and powers of ten up to 10^22 are exact in a double.
+// IEEE multiply and divide are correctly rounded, so m * 10^k and m / 10^k
+// give exactly what strtod() would with m and k in that range.  (This is the
+// "fast path" from Clinger's 1990 paper on reading floating point numbers.)
+//
+#define MAX_EXACT_DECIMAL_INT 9007199254740992.0  // 2^53
+#define MAX_EXACT_POWER_OF_TEN 22
+
+#if FAST_DECIMAL_CONVERSION
+    static const REBDEC Exact_Powers_Of_Ten[MAX_EXACT_POWER_OF_TEN + 1] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+#endif
+
+
+//
+//  Try_Exact_Decimal: C
+//
+// Make `mantissa * 10^exponent` if it can be done with a single correctly
+// rounded operation.  Returns false if it can't (caller should use strtod()).
+//
+bool Try_Exact_Decimal(REBDEC *out, REBU64 mantissa, REBINT exponent)
+{
+  #if FAST_DECIMAL_CONVERSION
+    if (mantissa <= cast(REBU64, MAX_EXACT_DECIMAL_INT)) {
+        if (exponent >= 0 and exponent <= MAX_EXACT_POWER_OF_TEN) {
+            *out = cast(REBDEC, mantissa) * Exact_Powers_Of_Ten[exponent];
+            return true;
+        }
+        if (exponent < 0 and exponent >= -MAX_EXACT_POWER_OF_TEN) {
+            *out = cast(REBDEC, mantissa) / Exact_Powers_Of_Ten[-exponent];
+            return true;
+        }
+    }
+  #else
+    UNUSED(out);
+    UNUSED(mantissa);
+    UNUSED(exponent);
+  #endif
+    return false;
+}
+
+
+#if FAST_DECIMAL_CONVERSION
+
+//
+//  Exact_Shortest_Digits: C
+//
+// Write the shortest digits that read back as positive `d` (what dtoa() mode
+// 0 gives) if they are some m / 10^k with m and k in the exact ranges.  The
+// decimal point position is in `e` as with dtoa().  Returns 0 if d is out of
+// range, else the number of digits written to `sig` (which is not terminated).
+//
+// Each k is tried in turn, so the first that works has the fewest digits.
+//
+static REBINT Exact_Shortest_Digits(Byte* sig, int *e, REBDEC d)
+{
+    if (not (d > 0.0) or d >= MAX_EXACT_DECIMAL_INT)  // rejects NaN too
+        return 0;
+
+    REBINT k;
+    for (k = 0; k <= MAX_EXACT_POWER_OF_TEN; ++k) {
+        REBDEC scaled = d * Exact_Powers_Of_Ten[k];
+        if (scaled >= MAX_EXACT_DECIMAL_INT)
+            return 0;
+
+        REBU64 m = cast(REBU64, scaled);
+        if (scaled - cast(REBDEC, m) >= 0.5)
+            ++m;
+
+        if (cast(REBDEC, m) / Exact_Powers_Of_Ten[k] != d)
+            continue;
+
+        while (m % 10 == 0) {  // only possible for k = 0, e.g. 1000.0
+            m /= 10;
+            --k;
+        }
+
+        Byte buf[MAX_DIGITS];
+        REBINT n = 0;
+        for (; m != 0; m /= 10)
+            buf[n++] = '0' + m % 10;
+
+        REBINT i;
+        for (i = 0; i < n; ++i)
+            sig[i] = buf[n - 1 - i];
+
+        *e = n - k;
+        return n;
+    }
+
+    return 0;
+}
+
+#endif
+
 //
 //  Emit_Decimal: C
 //
@@ -259,9 +356,19 @@ REBINT Emit_Decimal(
     if (decimal_digits < MIN_DIGITS) decimal_digits = MIN_DIGITS;
     else if (decimal_digits > MAX_DIGITS) decimal_digits = MAX_DIGITS;
 
-    sig = (Byte* ) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
-
-    digits_obtained = rve - sig;
+  #if FAST_DECIMAL_CONVERSION
+    Byte exact[MAX_DIGITS];
+    digits_obtained = Exact_Shortest_Digits(exact, &e, fabs(d));
+    if (digits_obtained != 0) {  // mode 0 dtoa() ignores decimal_digits
+        sig = exact;
+        sgn = (d < 0.0) ? 1 : 0;
+    }
+    else
+  #endif
+    {
+        sig = (Byte* ) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
+        digits_obtained = rve - sig;
+    }
 
     /* handle sign */
     if (sgn) *cp++ = '-';
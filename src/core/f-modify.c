@@ -154,33 +154,47 @@ REBLEN Modify_Array(
 
     tail_idx = (sym == SYM_APPEND) ? 0 : size + dst_idx;
 
-    REBLEN dup_index = 0;
-    for (; dup_index < cast(REBLEN, dups); ++dup_index) {  // dups checked > 0
-        REBLEN index = 0;
-        for (; index < ilen; ++index, ++dst_idx) {
-            Derelativize(
-                ARR_HEAD(dst_arr) + dst_idx,
-                src_rel + index,
-                specifier
-            );
+    // The first copy of the source has to be derelativized cell by cell, as
+    // the specifier may affect the binding of any of them.  Any further dups
+    // are copies of that, so they are made by doubling up what's been copied
+    // so far with memcpy().
+    //
+    Cell(*) dest = ARR_AT(dst_arr, dst_idx);
 
-            if (dup_index == 0 and index == 0 and head_newline) {
-                Set_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
+    REBLEN index = 0;
+    for (; index < ilen; ++index)
+        Derelativize(dest + index, src_rel + index, specifier);
 
-                // The array flag is not cleared until the loop actually
-                // makes a value that will carry on the bit.
-                //
-                Clear_Subclass_Flag(ARRAY, dst_arr, NEWLINE_AT_TAIL);
-                continue;
-            }
+    if (ilen != 0 and head_newline) {
+        Set_Cell_Flag(dest, NEWLINE_BEFORE);
 
-            if (dup_index > 0 and index == 0 and tail_newline) {
-                Set_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
-            }
+        // The array flag is not cleared until the loop actually makes a
+        // value that will carry on the bit.
+        //
+        Clear_Subclass_Flag(ARRAY, dst_arr, NEWLINE_AT_TAIL);
+    }
+
+    REBLEN done = ilen;
+    while (done < size) {
+        REBLEN chunk = MIN(done, size - done);
+        memcpy(dest + done, dest, chunk * sizeof(Cell));
+        done += chunk;
+    }
+
+    if (ilen != 0) {  // first cell of each later dup may need a newline
+        bool newline = tail_newline or Get_Cell_Flag(src_rel, NEWLINE_BEFORE);
+        REBLEN dup_index = 1;
+        for (; dup_index < cast(REBLEN, dups); ++dup_index) {
+            if (newline)
+                Set_Cell_Flag(dest + dup_index * ilen, NEWLINE_BEFORE);
+            else
+                Clear_Cell_Flag(dest + dup_index * ilen, NEWLINE_BEFORE);
         }
     }
 
-    // The above loop only puts on (dups - 1) NEWLINE_BEFORE flags.  The
+    dst_idx += size;
+
+    // The above only puts on (dups - 1) NEWLINE_BEFORE flags.  The
     // last one might have to be the array flag if at tail.
     //
     if (tail_newline) {
@@ -550,10 +564,12 @@ REBLEN Modify_String_Or_Binary(
         if (IS_NONSYMBOL_STRING(dst_ser)) {
             bookmark = LINK(Bookmarks, dst_ser);
 
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {  // only INSERT
-                BMK_INDEX(bookmark) += src_len_total;
-                BMK_OFFSET(bookmark) += src_size_total;
-            }
+            if (bookmark)  // only INSERT will move any
+                Update_Bookmarks_For_Change(
+                    STR(dst_ser), dst_idx, dst_off,
+                    0, 0,
+                    src_len_total, src_size_total
+                );
             dst_ser->misc.length = dst_len_old + src_len_total;
         }
     }
@@ -674,17 +690,19 @@ REBLEN Modify_String_Or_Binary(
         }
 
         // CHANGE can do arbitrary changes to what index maps to what offset
-        // in the region of interest.  The manipulations here would be
-        // complicated--but just assume that the start of the change is as
-        // good a cache as any to be relevant for the next operation.
+        // in the region of interest.  Bookmarks after it are shifted, and
+        // the last access bookmark moves to the start of the change if it
+        // was inside it.
         //
         if (IS_NONSYMBOL_STRING(dst_ser)) {
             bookmark = LINK(Bookmarks, dst_ser);
 
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {
-                BMK_INDEX(bookmark) = dst_idx;
-                BMK_OFFSET(bookmark) = dst_off;
-            }
+            if (bookmark)
+                Update_Bookmarks_For_Change(
+                    STR(dst_ser), dst_idx, dst_off,
+                    part, part_size,
+                    src_len_total, src_size_total
+                );
             dst_ser->misc.length = dst_len_old + src_len_total - part;
         }
     }
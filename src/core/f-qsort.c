@@ -1,234 +1,653 @@
-/* This file was downloaded from
- * https://raw.github.com/android/platform_bionic/master/libc/upstream-freebsd/lib/libc/stdlib/qsort.c
- */
-
-
-// "The qsort_r() function is identical to qsort() except that the comparison
-// function takes a third argument. A pointer is passed to the comparison
-// function via [thunk]. In this way, the comparison function does not
-// need to use global variables to pass through arbitrary arguments, and
-// is therefore reentrant and safe to use in threads."
-//
-// This file can declare either qsort or qsort_r, and we'd like the latter.
-// Note that `qsort_r` is part of no portability standard, and this version
-// (used by Android) puts the "thunk" as the next to last parameter instead
-// of the last one.  :-/
-//
-#define I_AM_QSORT_R
-
-
-/*-
- * Copyright (c) 1992, 1993
- *  The Regents of the University of California.  All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions
- * are met:
- * 1. Redistributions of source code must retain the above copyright
- *    notice, this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in the
- *    documentation and/or other materials provided with the distribution.
- * 3. Neither the name of the University nor the names of its contributors
- *    may be used to endorse or promote products derived from this software
- *    without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS ``AS IS'' AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE
- * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
- * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
- * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
- * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
- * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
- * SUCH DAMAGE.
- */
-
-#if defined(LIBC_SCCS) && !defined(lint)
-static char sccsid[] = "@(#)qsort.c 8.1 (Berkeley) 6/4/93";
-#endif /* LIBC_SCCS and not lint */
-
-/* commented out by L.M.
-#include <sys/cdefs.h>
-__FBSDID("$FreeBSD$");
-*/
-
-#include <stdlib.h>
-
-// When qsort_r is defined, it will actually wind up being named reb_qsort_r.
-// Define this after including <stdlib.h> to avoid the prototype being
-// declared as extern "C"
-//
-#define qsort_r reb_qsort_r
-
-#ifdef I_AM_QSORT_R
-typedef int      cmp_t(void *, const void *, const void *);
-#else
-typedef int      cmp_t(const void *, const void *);
-#endif
-#ifdef _MSC_VER
-#define __inline__
-#else
-#define __inline__ inline
-#endif
+//
+//  File: %f-qsort.c
+//  Summary: "sorting of fixed-size records in memory"
+//  Section: functional
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// These sort `n` records of `es` bytes each in place, using a comparison
+// function which gets `thunk` as its first argument.  (This is the argument
+// order of BSD's qsort_r(), which this file had historically contained.)
+//
+// reb_qsort_r() is a "pattern-defeating quicksort", after Orson Peters:
+//
+// https://github.com/orlp/pdqsort
+//
+// It is an introsort that behaves as quicksort on random input, but also:
+//
+// * Notices when a partition step moved nothing, and tries a short insertion
+//   sort...so input that is already (or nearly) sorted takes linear time.
+//
+// * Puts runs of elements equal to an earlier pivot in place in one pass,
+//   so input with many duplicates takes linear time too.
+//
+// * Swaps a few elements around after a badly unbalanced partition to break
+//   up adversarial patterns, and falls back on heapsort if bad partitions
+//   keep happening...so it is never worse than O(n log n).
+//
+// It is not stable.  reb_stable_sort_r() is a merge sort which is, and which
+// is also linear on input that's already sorted.  reb_parallel_sort_r() uses
+// reb_qsort_r() on chunks in several threads, and merges them.
+//
+// Except in the parallel sort, records are only ever swapped in place, so
+// every record is in the array whenever the comparison function runs.  That
+// matters for SORT/COMPARE, whose comparator can run arbitrary code...which
+// includes the garbage collector, that wouldn't see a cell being held only
+// in temporary memory.
+//
 
-static __inline__ char  *med3(char *, char *, char *, cmp_t *, void *);
-static __inline__ void   swapfunc(char *, char *, int, int);
+#include "sys-core.h"
 
-#if !defined(min)
-    #define min(a, b)   (a) < (b) ? a : b
+#if REBOL_PARALLEL_SORT
+    #include <pthread.h>
+    #include <unistd.h>  // sysconf()
 #endif
 
-/*
- * Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
- */
-#define swapcode(TYPE, parmi, parmj, n) {       \
-    long i = (n) / sizeof (TYPE);           \
-    TYPE *pi = (TYPE *) (parmi);        \
-    TYPE *pj = (TYPE *) (parmj);        \
-    do {                        \
-        TYPE    t = *pi;        \
-        *pi++ = *pj;                \
-        *pj++ = t;              \
-        } while (--i > 0);              \
-}
 
-#define SWAPINIT(a, es) swaptype = ((char *)a - (char *)0) % sizeof(long) || \
-    es % sizeof(long) ? 2 : es == sizeof(long)? 0 : 1;
+#define PDQ_INSERTION_SORT_MAX 24  // sort small ranges by insertion
+#define PDQ_NINTHER_MIN 128  // use median of 3 medians above this size
+#define PDQ_PARTIAL_INSERTION_MOVES 8  // give up on "nearly sorted" after
 
-static __inline__ void
-swapfunc(char *a, char *b, int n, int swaptype)
+#define MERGE_RUN_LEN 16  // runs insertion sorted before merging
+
+#define PARALLEL_SORT_MAX_THREADS 16
+
+// All the algorithms are written in terms of "less than", where only a
+// positive comparison result is trusted.  SORT/COMPARE with a comparator
+// returning LOGIC! gives -1 for equal items both ways around, so that is the
+// only reliable answer it gives.
+//
+#define LESS(a,b) \
+    (cmp(thunk, (b), (a)) > 0)
+
+
+inline static void Swap_Records(char *a, char *b, size_t es)
 {
-    if(swaptype <= 1)
-        swapcode(long, a, b, n)
-    else
-        swapcode(char, a, b, n)
+    for (; es >= sizeof(uintptr_t); es -= sizeof(uintptr_t)) {
+        uintptr_t temp;
+        memcpy(&temp, a, sizeof(uintptr_t));
+        memcpy(a, b, sizeof(uintptr_t));
+        memcpy(b, &temp, sizeof(uintptr_t));
+        a += sizeof(uintptr_t);
+        b += sizeof(uintptr_t);
+    }
+    for (; es != 0; --es, ++a, ++b) {
+        char temp = *a;
+        *a = *b;
+        *b = temp;
+    }
 }
 
-#define swap(a, b)                  \
-    if (swaptype == 0) {                \
-        long t = *(long *)(a);          \
-        *(long *)(a) = *(long *)(b);        \
-        *(long *)(b) = t;           \
-    } else                      \
-        swapfunc((char*)a, (char*)b, es, swaptype)
 
-#define vecswap(a, b, n)    if ((n) > 0) swapfunc(a, b, n, swaptype)
+static void Insertion_Sort(
+    char *begin,
+    char *end,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    char *i;
+    for (i = begin + es; i < end; i += es) {
+        char *j;
+        for (j = i; j > begin and LESS(j, j - es); j -= es)
+            Swap_Records(j - es, j, es);
+    }
+}
 
-#ifdef I_AM_QSORT_R
-#define CMP(t, x, y) (cmp((t), (x), (y)))
-#else
-#define CMP(t, x, y) (cmp((x), (y)))
-#endif
 
-static __inline__ char *
-med3(char *a, char *b, char *c, cmp_t *cmp, void *thunk
-#ifndef I_AM_QSORT_R
+// Insertion sort that gives up if it has to move elements too many times.
+// Returns whether the range was sorted.
+//
+static bool Partial_Insertion_Sort(
+    char *begin,
+    char *end,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    size_t moves = 0;
 
-/* commented out by L.M.
-__unused
-*/
+    char *i;
+    for (i = begin + es; i < end; i += es) {
+        char *j;
+        for (j = i; j > begin and LESS(j, j - es); j -= es) {
+            Swap_Records(j - es, j, es);
+            ++moves;
+        }
+        if (moves > PDQ_PARTIAL_INSERTION_MOVES)
+            return false;
+    }
+    return true;
+}
 
-#endif
-)
+
+// Order three records so that *a <= *b <= *c.
+//
+static void Sort_3(
+    char *a,
+    char *b,
+    char *c,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    if (LESS(b, a))
+        Swap_Records(a, b, es);
+    if (LESS(c, b)) {
+        Swap_Records(b, c, es);
+        if (LESS(b, a))
+            Swap_Records(a, b, es);
+    }
+}
+
+
+static void Sift_Down(
+    char *base,
+    size_t root,
+    size_t n,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    while (true) {
+        size_t child = 2 * root + 1;
+        if (child >= n)
+            return;
+        if (
+            child + 1 < n
+            and LESS(base + child * es, base + (child + 1) * es)
+        ){
+            ++child;
+        }
+        if (not LESS(base + root * es, base + child * es))
+            return;
+        Swap_Records(base + root * es, base + child * es, es);
+        root = child;
+    }
+}
+
+
+static void Heap_Sort(
+    char *base,
+    size_t n,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    size_t i;
+    for (i = n / 2; i-- > 0; )
+        Sift_Down(base, i, n, es, thunk, cmp);
+
+    for (i = n - 1; i > 0; --i) {
+        Swap_Records(base, base + i * es, es);
+        Sift_Down(base, 0, i, es, thunk, cmp);
+    }
+}
+
+
+// Partition around the pivot at `begin`: records less than it go to its
+// left, and records greater or equal go to its right.  Returns the pivot's
+// new position, and whether no records had to be swapped.
+//
+static char *Partition_Right(
+    bool *already_partitioned,
+    char *begin,
+    char *end,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    char *lo = begin + es;
+    char *hi = end - es;
+
+    while (lo <= hi and LESS(lo, begin))
+        lo += es;
+    while (lo <= hi and not LESS(hi, begin))
+        hi -= es;
+
+    *already_partitioned = (lo > hi);
+
+    while (lo < hi) {
+        Swap_Records(lo, hi, es);
+        lo += es;
+        hi -= es;
+        while (lo <= hi and LESS(lo, begin))
+            lo += es;
+        while (lo <= hi and not LESS(hi, begin))
+            hi -= es;
+    }
+
+    char *pivot = lo - es;
+    Swap_Records(begin, pivot, es);
+    return pivot;
+}
+
+
+// Like Partition_Right(), but records equal to the pivot go to its left.
+//
+static char *Partition_Left(
+    char *begin,
+    char *end,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp
+){
+    char *lo = begin + es;
+    char *hi = end - es;
+
+    while (lo <= hi and not LESS(begin, lo))
+        lo += es;
+    while (lo <= hi and LESS(begin, hi))
+        hi -= es;
+
+    while (lo < hi) {
+        Swap_Records(lo, hi, es);
+        lo += es;
+        hi -= es;
+        while (lo <= hi and not LESS(begin, lo))
+            lo += es;
+        while (lo <= hi and LESS(begin, hi))
+            hi -= es;
+    }
+
+    char *pivot = lo - es;
+    Swap_Records(begin, pivot, es);
+    return pivot;
+}
+
+
+// Unless `leftmost`, the record just before `begin` is known to be no
+// greater than any record in the range (it was a pivot, or is part of a
+// sorted range to the left).
+//
+static void Pdq_Sort(
+    char *begin,
+    char *end,
+    size_t es,
+    void *thunk,
+    cmp_t *cmp,
+    int bad_allowed,
+    bool leftmost
+){
+    while (true) {
+        size_t n = (end - begin) / es;
+        if (n <= PDQ_INSERTION_SORT_MAX) {
+            Insertion_Sort(begin, end, es, thunk, cmp);
+            return;
+        }
+
+        // Choose a pivot as the median of 3 records (or, for bigger ranges,
+        // the median of 3 such medians), and move it to `begin`.
+        //
+        char *mid = begin + (n / 2) * es;
+        char *last = end - es;
+        if (n > PDQ_NINTHER_MIN) {
+            Sort_3(begin, mid, last, es, thunk, cmp);
+            Sort_3(begin + es, mid - es, last - es, es, thunk, cmp);
+            Sort_3(begin + 2 * es, mid + es, last - 2 * es, es, thunk, cmp);
+            Sort_3(mid - es, mid, mid + es, es, thunk, cmp);
+            Swap_Records(begin, mid, es);
+        }
+        else
+            Sort_3(mid, begin, last, es, thunk, cmp);
+
+        // If the pivot is equal to the record before the range, every record
+        // equal to it belongs at the start of the range, so those can all be
+        // put there at once and only the greater records need more sorting.
+        //
+        if (not leftmost and not LESS(begin - es, begin)) {
+            begin = Partition_Left(begin, end, es, thunk, cmp) + es;
+            continue;
+        }
+
+        bool already_partitioned;
+        char *pivot = Partition_Right(
+            &already_partitioned, begin, end, es, thunk, cmp
+        );
+
+        size_t l_size = (pivot - begin) / es;
+        size_t r_size = (end - pivot) / es - 1;
+
+        if (l_size < n / 8 or r_size < n / 8) {  // highly unbalanced
+            if (--bad_allowed == 0) {
+                Heap_Sort(begin, n, es, thunk, cmp);
+                return;
+            }
+
+            if (l_size >= PDQ_INSERTION_SORT_MAX) {
+                Swap_Records(begin, begin + (l_size / 4) * es, es);
+                Swap_Records(pivot - es, pivot - (l_size / 4) * es, es);
+            }
+            if (r_size >= PDQ_INSERTION_SORT_MAX) {
+                Swap_Records(pivot + es, pivot + (1 + r_size / 4) * es, es);
+                Swap_Records(end - es, end - (r_size / 4) * es, es);
+            }
+        }
+        else if (
+            already_partitioned
+            and Partial_Insertion_Sort(begin, pivot, es, thunk, cmp)
+            and Partial_Insertion_Sort(pivot + es, end, es, thunk, cmp)
+        ){
+            return;
+        }
+
+        // Recurse into the smaller side, and loop on the bigger one, so the
+        // C stack depth stays logarithmic.
+        //
+        if (l_size < r_size) {
+            Pdq_Sort(begin, pivot, es, thunk, cmp, bad_allowed, leftmost);
+            begin = pivot + es;
+            leftmost = false;
+        }
+        else {
+            Pdq_Sort(pivot + es, end, es, thunk, cmp, bad_allowed, false);
+            end = pivot;
+        }
+    }
+}
+
+
+//
+//  reb_qsort_r: C
+//
+// Unstable in-place sort, see notes at top of file.
+//
+void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp)
 {
-    return CMP(thunk, a, b) < 0 ?
-           (CMP(thunk, b, c) < 0 ? b : (CMP(thunk, a, c) < 0 ? c : a ))
-              :(CMP(thunk, b, c) > 0 ? b : (CMP(thunk, a, c) < 0 ? a : c ));
+    int bad_allowed = 1;  // floor(log2(n)) bad partitions before heapsort
+    size_t i;
+    for (i = n; i > 1; i >>= 1)
+        ++bad_allowed;
+
+    char *begin = cast(char*, a);
+    Pdq_Sort(begin, begin + n * es, es, thunk, cmp, bad_allowed, true);
 }
 
-#ifdef I_AM_QSORT_R
-void
-qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp)
-#else
-#define thunk NULL
-void
-qsort(void *a, size_t n, size_t es, cmp_t *cmp)
-#endif
+
+//
+//  reb_stable_sort_r: C
+//
+// Stable in-place sort: records that compare equal keep their order.
+//
+// The merge sort is done on an array of pointers to the records (so the
+// comparison function sees every record in place), then the records are
+// moved according to it.  This needs memory for 2 pointers a record, plus
+// one record, and may fail if that can't be allocated.
+//
+void reb_stable_sort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp)
 {
-    char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
-    size_t d, r;
-    int cmp_result;
-    int swaptype, swap_cnt;
-
-loop:   SWAPINIT(a, es);
-    swap_cnt = 0;
-    if (n < 7) {
-        for (pm = (char *)a + es; pm < (char *)a + n * es; pm += es)
-            for (pl = pm;
-                 pl > (char *)a && CMP(thunk, pl - es, pl) > 0;
-                 pl -= es)
-                swap(pl, pl - es);
+    if (n < 2)
         return;
-    }
-    pm = (char *)a + (n / 2) * es;
-    if (n > 7) {
-        pl = (char *)a;
-        pn = (char *)a + (n - 1) * es;
-        if (n > 40) {
-            d = (n / 8) * es;
-            pl = med3(pl, pl + d, pl + 2 * d, cmp, thunk);
-            pm = med3(pm - d, pm, pm + d, cmp, thunk);
-            pn = med3(pn - 2 * d, pn - d, pn, cmp, thunk);
+
+    // An unmanaged series is freed automatically if the comparison fails.
+    //
+    REBSER *scratch = Make_Series_Core(
+        2 * n * sizeof(char*) + es,
+        FLAG_FLAVOR(BINARY)
+    );
+    char **src = cast(char**, SER_DATA(scratch));
+    char **dst = src + n;
+    char *hold = cast(char*, dst + n);
+
+    char *base = cast(char*, a);
+    size_t i;
+    for (i = 0; i < n; ++i)
+        src[i] = base + i * es;
+
+    // Insertion sort short runs, which is stable if equal records are never
+    // moved past each other.
+    //
+    for (i = 0; i < n; i += MERGE_RUN_LEN) {
+        size_t run_end = MIN(i + MERGE_RUN_LEN, n);
+        size_t j;
+        for (j = i + 1; j < run_end; ++j) {
+            size_t k;
+            for (k = j; k > i and LESS(src[k], src[k - 1]); --k) {
+                char *temp = src[k - 1];
+                src[k - 1] = src[k];
+                src[k] = temp;
+            }
         }
-        pm = med3(pl, pm, pn, cmp, thunk);
-    }
-    swap(a, pm);
-    pa = pb = (char *)a + es;
-
-    pc = pd = (char *)a + (n - 1) * es;
-    for (;;) {
-        while (pb <= pc && (cmp_result = CMP(thunk, pb, a)) <= 0) {
-            if (cmp_result == 0) {
-                swap_cnt = 1;
-                swap(pa, pb);
-                pa += es;
+    }
+
+    // Merge runs of doubling width.  Ties go to the left run, to be stable.
+    // Runs that are already in order relative to each other (as in sorted
+    // input) are just copied.
+    //
+    size_t width;
+    for (width = MERGE_RUN_LEN; width < n; width *= 2) {
+        size_t lo;
+        for (lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = MIN(lo + width, n);
+            size_t hi = MIN(lo + 2 * width, n);
+
+            if (mid == hi or not LESS(src[mid], src[mid - 1])) {
+                memcpy(dst + lo, src + lo, (hi - lo) * sizeof(char*));
+                continue;
+            }
+
+            size_t l = lo;
+            size_t r = mid;
+            size_t k = lo;
+            while (l < mid and r < hi) {
+                if (LESS(src[r], src[l]))
+                    dst[k++] = src[r++];
+                else
+                    dst[k++] = src[l++];
             }
-            pb += es;
+            while (l < mid)
+                dst[k++] = src[l++];
+            while (r < hi)
+                dst[k++] = src[r++];
         }
-        while (pb <= pc && (cmp_result = CMP(thunk, pc, a)) >= 0) {
-            if (cmp_result == 0) {
-                swap_cnt = 1;
-                swap(pc, pd);
-                pd -= es;
+
+        char **temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // src[i] now points at the record that belongs at position i.  Follow the
+    // cycles of that permutation, holding one record aside per cycle.  (No
+    // comparisons happen in this phase, so nothing can see `hold`.)
+    //
+    for (i = 0; i < n; ++i) {
+        char *here = base + i * es;
+        if (src[i] == here)
+            continue;
+
+        memcpy(hold, here, es);
+
+        size_t k = i;
+        while (true) {
+            char *from = src[k];
+            src[k] = base + k * es;  // mark as placed
+            if (from == here) {
+                memcpy(base + k * es, hold, es);
+                break;
             }
-            pc -= es;
+            memcpy(base + k * es, from, es);
+            k = (from - base) / es;
         }
-        if (pb > pc)
-            break;
-        swap(pb, pc);
-        swap_cnt = 1;
-        pb += es;
-        pc -= es;
-    }
-    if (swap_cnt == 0) {  /* Switch to insertion sort */
-        for (pm = (char *)a + es; pm < (char *)a + n * es; pm += es)
-            for (pl = pm;
-                 pl > (char *)a && CMP(thunk, pl - es, pl) > 0;
-                 pl -= es)
-                swap(pl, pl - es);
+    }
+
+    Free_Unmanaged_Series(scratch);
+}
+
+
+// One unit of work for reb_parallel_sort_r(): either sorting a chunk of the
+// records in place, or merging two adjacent sorted chunks from `src` into
+// the same positions in `dst`.
+//
+struct Reb_Sort_Task {
+    char *src;
+    char *dst;  // nullptr if this is a sort task
+    size_t lo;
+    size_t mid;
+    size_t hi;
+    size_t es;
+    void *thunk;
+    cmp_t *cmp;
+};
+
+
+static void Run_Sort_Task(struct Reb_Sort_Task *t)
+{
+    size_t es = t->es;
+    void *thunk = t->thunk;
+    cmp_t *cmp = t->cmp;
+
+    if (not t->dst) {
+        reb_qsort_r(t->src + t->lo * es, t->hi - t->lo, es, thunk, cmp);
         return;
     }
 
-    pn = (char *)a + n * es;
-    r = min(pa - (char *)a, pb - pa);
-    vecswap((char*)a, (char *)(pb - r), r);
-    // !!! Ren-C: pn - pd - es => (long)(pn - pd - ps) for -Wsign-compare
-    r = min(pd - pc, (long)(pn - pd - es));
-    vecswap(pb, pn - r, r);
-    if ((r = pb - pa) > es)
-#ifdef I_AM_QSORT_R
-        qsort_r(a, r / es, es, thunk, cmp);
-#else
-        qsort(a, r / es, es, cmp);
+    char *l = t->src + t->lo * es;
+    char *l_end = t->src + t->mid * es;
+    char *r = l_end;
+    char *r_end = t->src + t->hi * es;
+    char *out = t->dst + t->lo * es;
+
+    while (l < l_end and r < r_end) {
+        if (LESS(r, l)) {
+            memcpy(out, r, es);
+            r += es;
+        }
+        else {
+            memcpy(out, l, es);
+            l += es;
+        }
+        out += es;
+    }
+    memcpy(out, l, l_end - l);
+    out += l_end - l;
+    memcpy(out, r, r_end - r);
+}
+
+
+#if REBOL_PARALLEL_SORT
+    static void *Sort_Thread(void *t) {
+        Run_Sort_Task(cast(struct Reb_Sort_Task*, t));
+        return nullptr;
+    }
 #endif
-    if ((r = pd - pc) > es) {
-        /* Iterate rather than recurse to save stack space */
-        a = pn - r;
-        n = r / es;
-        goto loop;
+
+
+// Run the tasks concurrently (the last one on the calling thread), and wait
+// for them all to finish.  Any task a thread can't be started for is just
+// run on the calling thread.
+//
+static void Run_Sort_Tasks(struct Reb_Sort_Task *tasks, size_t num_tasks)
+{
+  #if REBOL_PARALLEL_SORT
+    pthread_t threads[PARALLEL_SORT_MAX_THREADS];
+    bool started[PARALLEL_SORT_MAX_THREADS];
+
+    size_t i;
+    for (i = 0; i < num_tasks - 1; ++i)
+        started[i] = (
+            0 == pthread_create(&threads[i], nullptr, &Sort_Thread, &tasks[i])
+        );
+
+    Run_Sort_Task(&tasks[num_tasks - 1]);
+
+    for (i = 0; i < num_tasks - 1; ++i) {
+        if (started[i])
+            pthread_join(threads[i], nullptr);
+        else
+            Run_Sort_Task(&tasks[i]);
     }
-/*      qsort(pn - r, r / es, es, cmp);*/
+  #else
+    size_t i;
+    for (i = 0; i < num_tasks; ++i)
+        Run_Sort_Task(&tasks[i]);
+  #endif
+}
+
+
+//
+//  reb_parallel_sort_r: C
+//
+// Unstable sort which splits the records into a chunk per CPU, sorts the
+// chunks concurrently with reb_qsort_r(), then merges pairs of chunks
+// concurrently until one is left.  This needs memory for a copy of the
+// records, and runs on just the calling thread unless the interpreter was
+// built with REBOL_PARALLEL_SORT.
+//
+// The comparison function is called from other threads, so it must not
+// fail(), allocate, or evaluate anything.  Records are moved in and out of
+// temporary memory, so none may be a cell the GC must be able to see...this
+// is only safe because no GC can happen during such a comparison.
+//
+void reb_parallel_sort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp)
+{
+    size_t num_chunks = 1;
+  #if REBOL_PARALLEL_SORT
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > 1)
+        num_chunks = MIN(cast(size_t, cpus), PARALLEL_SORT_MAX_THREADS);
+  #endif
+    if (num_chunks == 1 or n < num_chunks * MERGE_RUN_LEN) {
+        reb_qsort_r(a, n, es, thunk, cmp);
+        return;
+    }
+
+    size_t bounds[PARALLEL_SORT_MAX_THREADS + 1];
+    size_t i;
+    for (i = 0; i <= num_chunks; ++i)
+        bounds[i] = n * i / num_chunks;
+
+    struct Reb_Sort_Task tasks[PARALLEL_SORT_MAX_THREADS];
+    for (i = 0; i < num_chunks; ++i) {
+        tasks[i].src = cast(char*, a);
+        tasks[i].dst = nullptr;
+        tasks[i].lo = bounds[i];
+        tasks[i].mid = bounds[i];
+        tasks[i].hi = bounds[i + 1];
+        tasks[i].es = es;
+        tasks[i].thunk = thunk;
+        tasks[i].cmp = cmp;
+    }
+    Run_Sort_Tasks(tasks, num_chunks);
+
+    REBSER *scratch = Make_Series_Core(n * es, FLAG_FLAVOR(BINARY));
+    char *src = cast(char*, a);
+    char *dst = cast(char*, SER_DATA(scratch));
+
+    size_t width;  // in chunks
+    for (width = 1; width < num_chunks; width *= 2) {
+        size_t num_tasks = 0;
+        for (i = 0; i < num_chunks; i += 2 * width) {
+            struct Reb_Sort_Task *t = &tasks[num_tasks++];
+            t->src = src;
+            t->dst = dst;
+            t->lo = bounds[i];
+            t->mid = bounds[MIN(i + width, num_chunks)];
+            t->hi = bounds[MIN(i + 2 * width, num_chunks)];
+        }
+        Run_Sort_Tasks(tasks, num_tasks);
+
+        char *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != a)
+        memcpy(a, src, n * es);
+
+    Free_Unmanaged_Series(scratch);
 }
@@ -24,94 +24,102 @@
 
 #include "sys-core.h"
 
-/*  This program by D E Knuth is in the public domain and freely copyable.
- *  It is explained in Seminumerical Algorithms, 3rd edition, Section 3.6
- *  (or in the errata to the 2nd edition --- see
- *      http://www-cs-faculty.stanford.edu/~knuth/taocp.html
- *  in the changes to Volume 2 on pages 171 and following).             */
-
-/*  N.B. The MODIFICATIONS introduced in the 9th printing (2002) are
-        included here; there's no backwards compatibility with the original. */
-
-/*  This version also adopts Brendan McKay's suggestion to
-        accommodate naive users who forget to call Set_Random (seed).           */
+// The generator is xoshiro256** by David Blackman and Sebastiano Vigna,
+// which replaced the lagged-Fibonacci generator from Knuth's TAOCP that R3
+// used originally.  That generator needed a 1009-entry buffer refilled in
+// batches plus ~1K of lag state, and a warmup pass on every reseed.  The
+// xoshiro state is four 64-bit words, each draw is a handful of shifts and
+// rotates, and the quality is better (it passes BigCrush):
+//
+// https://prng.di.unimi.it/
+//
+// The state is kept in a struct instead of loose statics, so that if there
+// are ever multiple interpreter instances each can have its own generator.
+// For now there is just the one.
+//
+// Note: Changing generators changes which sequence a given RANDOM/SEED will
+// produce.  Only the property that the same seed gives the same sequence is
+// promised.
+//
 
-/*  If you find any bugs, please report them immediately to
- *               taocp@cs.stanford.edu
- *  (and you will be rewarded if the bug is genuine). Thanks!           */
+typedef struct {
+    REBU64 s[4];
+} Random_State;
 
-/************ see the book for explanations and caveats! *******************/
-/************ in particular, you need two's complement arithmetic **********/
+static Random_State PG_Random_State;  // all zero means "never seeded"
 
-/* Modified by Ladislav Mecir for REBOL to generate 62-bit numbers */
+#define MM ((REBI64)1 << 62)  // Random_Int() gives numbers modulo 2^62
 
-#define KK 100                              /* the long lag */
-#define LL  37                              /* the short lag */
-#define MM ((REBI64)1<<62)                  /* the modulus, 2^62 */
-#define mod_diff(x,y) (((x)-(y))&(MM-1))    /* subtraction mod MM */
+inline static REBU64 Rotl64(REBU64 x, int k)
+  { return (x << k) | (x >> (64 - k)); }
 
-static REBI64 ran_x[KK];                    /* the generator state */
+// splitmix64, recommended by the xoshiro authors for expanding a 64-bit
+// seed into the full state (it can't produce an all-zero state).
+//
+static REBU64 Splitmix64(REBU64 *x)
+{
+    REBU64 z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
 
-void ran_array(REBI64 aa[], int n)
+static void Seed_Random_State(Random_State *r, REBU64 seed)
 {
-    int i,j;
-    for (j=0;j<KK;j++) aa[j]=ran_x[j];
-    for (;j<n;j++) aa[j]=mod_diff(aa[j-KK],aa[j-LL]);
-    for (i=0;i<LL;i++,j++) ran_x[i]=mod_diff(aa[j-KK],aa[j-LL]);
-    for (;i<KK;i++,j++) ran_x[i]=mod_diff(aa[j-KK],ran_x[i-LL]);
+    r->s[0] = Splitmix64(&seed);
+    r->s[1] = Splitmix64(&seed);
+    r->s[2] = Splitmix64(&seed);
+    r->s[3] = Splitmix64(&seed);
 }
 
-/* the following routines are from exercise 3.6--15 */
-/* after calling Set_Random, get new randoms by, e.g., "x=ran_arr_next()" */
+static REBU64 Next_Random_U64(Random_State *r)
+{
+    REBU64 *s = r->s;
+    if ((s[0] | s[1] | s[2] | s[3]) == 0)
+        Seed_Random_State(r, 314159);  // user forgot to initialize
+
+    REBU64 result = Rotl64(s[1] * 5, 7) * 9;
+    REBU64 t = s[1] << 17;
 
-#define QUALITY 1009 /* recommended quality level for high-res use */
-static REBI64 ran_arr_buf[QUALITY];
-static REBI64 ran_arr_dummy=-1, ran_arr_started=-1;
-static REBI64 *ran_arr_ptr=&ran_arr_dummy;  /* the next random number, or -1 */
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = Rotl64(s[3], 45);
 
-#define TT  70      /* guaranteed separation between streams */
-#define is_odd(x)   ((x)&1)         /* units bit of x */
+    return result;
+}
 
 //
 //  Set_Random: C
 //
 void Set_Random(REBI64 seed)
 {
-    int t,j;
-    REBI64 x[KK+KK-1];                  /* the preparation buffer */
-    REBI64 ss=(seed+2)&(MM-2);
-    for (j=0;j<KK;j++) {
-        x[j]=ss;                        /* bootstrap the buffer */
-        ss<<=1; if (ss>=MM) ss-=MM-2;   /* cyclic shift 61 bits */
-    }
-    x[1]++;             /* make x[1] (and only x[1]) odd */
-    for (ss=seed&(MM-1),t=TT-1; t;) {
-        for (j=KK-1;j>0;j--) x[j+j]=x[j], x[j+j-1]=0; /* "square" */
-        for (j=KK+KK-2;j>=KK;j--)
-            x[j-(KK-LL)]=mod_diff(x[j-(KK-LL)],x[j]),
-            x[j-KK]=mod_diff(x[j-KK],x[j]);
-        if (is_odd(ss)) {               /* "multiply by z" */
-            for (j=KK;j>0;j--)  x[j]=x[j-1];
-            x[0]=x[KK];         /* shift the buffer cyclically */
-            x[LL]=mod_diff(x[LL],x[KK]);
-        }
-        if (ss) ss>>=1; else t--;
-    }
-    for (j=0;j<LL;j++) ran_x[j+KK-LL]=x[j];
-    for (;j<KK;j++) ran_x[j-LL]=x[j];
-    for (j=0;j<10;j++) ran_array(x,KK+KK-1); /* warm things up */
-    ran_arr_ptr=&ran_arr_started;
+    Seed_Random_State(&PG_Random_State, cast(REBU64, seed));
 }
 
-#define ran_arr_next() (*ran_arr_ptr>=0? *ran_arr_ptr++: ran_arr_cycle())
-static REBI64 ran_arr_cycle(void)
+//
+//  Random_Fill: C
+//
+// Fill a buffer with random bytes, eight at a time.  This is the bulk form
+// of Random_Int(), so callers filling large buffers don't pay a call and a
+// 62-bit truncation for every byte.
+//
+void Random_Fill(Byte* buf, Size size, bool secure)
 {
-    if (ran_arr_ptr==&ran_arr_dummy)
-        Set_Random(314159L); /* the user forgot to initialize */
-    ran_array(ran_arr_buf,QUALITY);
-    ran_arr_buf[KK]=-1;
-    ran_arr_ptr=ran_arr_buf+1;
-    return ran_arr_buf[0];
+    if (secure)
+        Random_Int(true);  // fails with the same message
+
+    for (; size >= sizeof(REBU64); size -= sizeof(REBU64)) {
+        REBU64 u = Next_Random_U64(&PG_Random_State);
+        memcpy(buf, &u, sizeof(REBU64));
+        buf += sizeof(REBU64);
+    }
+    if (size != 0) {
+        REBU64 u = Next_Random_U64(&PG_Random_State);
+        memcpy(buf, &u, size);
+    }
 }
 
 //
@@ -121,7 +129,7 @@ static REBI64 ran_arr_cycle(void)
 //
 REBI64 Random_Int(bool secure)
 {
-    REBI64 tmp = ran_arr_next();
+    REBI64 tmp = cast(REBI64, Next_Random_U64(&PG_Random_State) >> 2);
 
     if (secure) {
         fail (
@@ -180,3 +188,38 @@ REBDEC Random_Dec(REBDEC r, bool secure)
     if (s < 0.0) s += 1.8446744073709552e19;
     return (s * t) * r;
 }
+
+
+//
+//  random-bytes: native [
+//
+//  {Make a BINARY! of random bytes, or overwrite a BINARY! with them}
+//
+//      return: [binary!]
+//      target "Size of new BINARY!, or BINARY! to fill from index to tail"
+//          [integer! binary!]
+//      /secure "Returns a cryptographically secure random number"
+//  ]
+//
+DECLARE_NATIVE(random_bytes)
+{
+    INCLUDE_PARAMS_OF_RANDOM_BYTES;
+
+    REBVAL *target = ARG(target);
+
+    if (IS_BINARY(target)) {
+        Size size;
+        Byte* bp = VAL_BINARY_SIZE_AT_ENSURE_MUTABLE(&size, target);
+        Random_Fill(bp, size, REF(secure));
+        return COPY(target);
+    }
+
+    REBI64 size = VAL_INT64(target);
+    if (size < 0)
+        fail (Error_Out_Of_Range(target));
+
+    Binary(*) bin = Make_Binary(cast(Size, size));
+    Random_Fill(BIN_HEAD(bin), cast(Size, size), REF(secure));
+    TERM_BIN_LEN(bin, cast(Size, size));
+    return Init_Binary(OUT, bin);
+}
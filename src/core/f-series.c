@@ -233,7 +233,8 @@ Bounce Series_Common_Action_Maybe_Unhandled(
                     : ARG(value2),
                 sop_flags,
                 REF(case),
-                REF(skip) ? Int32s(ARG(skip), 1) : 1
+                REF(skip) ? Int32s(ARG(skip), 1) : 1,
+                REF(sorted)
             )
         ); }
 
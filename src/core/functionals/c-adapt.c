@@ -42,6 +42,11 @@
 // More complete control of execution and manipulating the return result is
 // possible with the ENCLOSE operation, but at a greater performance cost.
 //
+// An ADAPT of an ADAPT is fused when it is made: the new prelude runs first,
+// then the adaptee's prelude, and then control goes to the adaptee's adaptee.
+// So layered adaptations still run in one dispatch, with one type check of
+// the arguments after all the preludes are done.
+//
 
 #include "sys-core.h"
 
@@ -170,5 +175,42 @@ DECLARE_NATIVE(adapt_p)  // see extended definition ADAPT in %base-defs.r
     );
     Copy_Cell(ARR_AT(details, IDX_ADAPTER_ADAPTEE), adaptee);
 
+    // If the adaptee is itself an adaptation, run both preludes as GROUP!s
+    // in one block and skip straight to the inner adaptee.  The adaptation
+    // reused the adaptee's paramlist, so the inner prelude's relative words
+    // resolve in this frame as well.  (This means a later HIJACK of the inner
+    // adaptation is not seen by this one.)
+    //
+    Action(*) inner = VAL_ACTION(adaptee);
+    if (ACT_DISPATCHER(inner) == &Adapter_Dispatcher) {
+        Array(*) inner_details = ACT_DETAILS(inner);
+        assert(ACT_KEYLIST(inner) == ACT_KEYLIST(adaptation));
+
+        Array(*) fused = Make_Array_Core(2, NODE_FLAG_MANAGED);
+        SET_SERIES_LEN(fused, 2);
+
+        Cell(*) outer_group = Copy_Cell(
+            ARR_AT(fused, 0),
+            ARR_AT(details, IDX_ADAPTER_PRELUDE)
+        );
+        mutable_HEART_BYTE(outer_group) = REB_GROUP;
+
+        Cell(*) inner_group = Copy_Cell(
+            ARR_AT(fused, 1),
+            ARR_AT(inner_details, IDX_ADAPTER_PRELUDE)
+        );
+        mutable_HEART_BYTE(inner_group) = REB_GROUP;
+
+        Init_Relative_Block(
+            ARR_AT(details, IDX_ADAPTER_PRELUDE),
+            adaptation,
+            fused
+        );
+        Copy_Cell(
+            ARR_AT(details, IDX_ADAPTER_ADAPTEE),
+            DETAILS_AT(inner_details, IDX_ADAPTER_ADAPTEE)
+        );
+    }
+
     return Init_Activation(OUT, adaptation, VAL_ACTION_LABEL(adaptee), UNBOUND);
 }
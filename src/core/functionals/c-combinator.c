@@ -52,26 +52,27 @@ enum {
 enum {
     IDX_COMBINATOR_PARAM_RETURN = 1,
     IDX_COMBINATOR_PARAM_REMAINDER,
+    IDX_COMBINATOR_PARAM_PENDING,
     IDX_COMBINATOR_PARAM_STATE,
     IDX_COMBINATOR_PARAM_INPUT
 };
 
 // !!! With a native UPARSE, these would come from INCLUDE_PARAMS_OF_UPARSE.
-// Until that happens, this could get out of sync with the index positions of
-// the usermode function.
+// Until that happens, this has to be kept in sync by hand with the order of
+// the parameters and locals of the usermode PARSE* in %uparse.r.
 //
 enum {
     IDX_UPARSE_PARAM_RETURN = 1,
-    IDX_UPARSE_PARAM_FURTHEST,
     IDX_UPARSE_PARAM_PENDING,
-    IDX_UPARSE_PARAM_SERIES,
+    IDX_UPARSE_PARAM_INPUT,
     IDX_UPARSE_PARAM_RULES,
     IDX_UPARSE_PARAM_COMBINATORS,
     IDX_UPARSE_PARAM_CASE,
-    IDX_UPARSE_PARAM_FULLY,
     IDX_UPARSE_PARAM_PART,  // Note: Fake /PART at time of writing!
     IDX_UPARSE_PARAM_VERBOSE,
-    IDX_UPARSE_PARAM_LOOPS
+    IDX_UPARSE_PARAM_PROFILE,
+    IDX_UPARSE_PARAM_LOOPS,  // first <local>
+    IDX_UPARSE_PARAM_FURTHEST
 };
 
 
@@ -104,35 +105,26 @@ Bounce Combinator_Dispatcher(Frame(*) f)
 
     REBVAL *r = Value_From_Bounce(b);
 
-    if (r == nullptr or Is_Nulled(r))
-        return r;  // did not advance, don't update furthest
+    if (r == nullptr or Is_Raised(r))
+        return r;  // did not match, don't update furthest
 
     // This particular parse succeeded, but did the furthest point exceed the
-    // previously measured furthest point?  This only is a question that
-    // matters if there was a request to know the furthest point...
+    // previously measured furthest point?  PARSE* keeps that position in one
+    // of its locals.
     //
     REBVAL *state = FRM_ARG(f, IDX_COMBINATOR_PARAM_STATE);
     assert(IS_FRAME(state));  // combinators *must* have this as the UPARSE.
-    Frame(*) frame_ = CTX_FRAME_MAY_FAIL(VAL_CONTEXT(state));
-    REBVAL *furthest_word = FRM_ARG(frame_, IDX_UPARSE_PARAM_FURTHEST);
-    if (Is_Nulled(furthest_word))
-        return r;
-
-    REBVAL *furthest_var = Lookup_Mutable_Word_May_Fail(
-        furthest_word,
-        SPECIFIED
-    );
-
-    REBVAL *remainder_word = FRM_ARG(f, IDX_COMBINATOR_PARAM_REMAINDER);
-    const REBVAL *remainder_var = Lookup_Word_May_Fail(
-        remainder_word,
-        SPECIFIED
-    );
+    REBVAR *furthest = CTX_VAR(VAL_CONTEXT(state), IDX_UPARSE_PARAM_FURTHEST);
 
-    assert(VAL_SERIES(remainder_var) == VAL_SERIES(furthest_var));
-
-    if (VAL_INDEX(remainder_var) > VAL_INDEX(furthest_var))
-        Copy_Cell(furthest_var, remainder_var);
+    REBVAL *remainder = FRM_ARG(f, IDX_COMBINATOR_PARAM_REMAINDER);
+    if (
+        ANY_SERIES(furthest)
+        and ANY_SERIES(remainder)
+        and VAL_SERIES(remainder) == VAL_SERIES(furthest)
+        and VAL_INDEX(remainder) > VAL_INDEX(furthest)
+    ){
+        Copy_Cell(furthest, remainder);
+    }
 
     return r;
 }
@@ -163,7 +155,8 @@ Bounce Combinator_Dispatcher(Frame(*) f)
 //             [return: [<opt> <void> any-value!]]",
 //         ]))
 //
-//         remainder: [<opt> any-series!]
+//         @remainder [any-series!]
+//         @pending [<opt> block!]
 //
 //         state [frame!]
 //         input [any-series!]
@@ -202,6 +195,7 @@ Array(*) Expanded_Combinator_Spec(const REBVAL *original)
 
     const Byte utf8[] =
         "@remainder [any-series!]\n"
+        "@pending [<opt> block!]\n"
         "state [frame!]\n"
         "input [any-series!]\n";
 
@@ -400,11 +394,16 @@ DECLARE_NATIVE(opt_combinator)
 //  {Match a TEXT! value as an array item or at current position of bin/string}
 //
 //      return: "The rule series matched against (not input value)"
-//          [<opt> text!]
+//          [text!]
 //      value [text!]
 //  ]
 //
 DECLARE_NATIVE(text_x_combinator)
+//
+// This and the other "leaf" combinators (ones that don't call parsers) are
+// installed in DEFAULT-COMBINATORS over the usermode versions in %uparse.r,
+// as the cost of running them in usermode is mostly function call overhead.
+// Like the usermode combinators, failure to match is a raised error.
 {
     INCLUDE_PARAMS_OF_TEXT_X_COMBINATOR;
 
@@ -414,19 +413,19 @@ DECLARE_NATIVE(text_x_combinator)
     Value(*) v = ARG(value);
     Value(*) input = ARG(input);
 
+    Init_Nulled(ARG(pending));
+
     if (ANY_ARRAY(input)) {
         Cell(const*) tail;
         Cell(const*) at = VAL_ARRAY_AT(&tail, input);
-        if (at == tail)  // no item to match against
-            return nullptr;
-        if (Cmp_Value(at, v, true) != 0)  // not case-insensitive equal
-            return nullptr;
-
-        ++VAL_INDEX_UNBOUNDED(input);
-        Set_Var_May_Fail(ARG(remainder), SPECIFIED, input);
+        if (at == tail or Cmp_Value(at, v, false) != 0)
+            return RAISE("Value at parse position does not match TEXT!");
 
         Derelativize(OUT, at, VAL_SPECIFIER(input));
-        return OUT;  // Note: returns item in array, not rule, when an array!
+
+        ++VAL_INDEX_UNBOUNDED(input);
+        Copy_Cell(ARG(remainder), input);
+        return Proxy_Multi_Returns(frame_);  // item in array, not rule
     }
 
     assert(ANY_STRING(input) or IS_BINARY(input));
@@ -441,16 +440,68 @@ DECLARE_NATIVE(text_x_combinator)
         1  // skip
     );
     if (index == NOT_FOUND)
-        return nullptr;
+        return RAISE("String at parse position does not match TEXT!");
 
     assert(cast(REBLEN, index) == VAL_INDEX(input));  // asked for AM_FIND_MATCH
     VAL_INDEX_UNBOUNDED(input) += len;
-    Set_Var_May_Fail(ARG(remainder), SPECIFIED, input);
+    Copy_Cell(ARG(remainder), input);
 
     // If not an array, we have return the rule on match since there's
     // no isolated value to capture.
 
-    return COPY(v);
+    Copy_Cell(OUT, v);
+    return Proxy_Multi_Returns(frame_);
+}
+
+
+//
+//  bitset!-combinator: native/combinator [
+//
+//  {Match a character or byte in a BITSET!, or an array item equal to it}
+//
+//      return: "The matched input value"
+//          [char! integer! bitset!]
+//      value [bitset!]
+//  ]
+//
+DECLARE_NATIVE(bitset_x_combinator)
+{
+    INCLUDE_PARAMS_OF_BITSET_X_COMBINATOR;
+
+    UNUSED(ARG(state));
+
+    Value(*) v = ARG(value);
+    Value(*) input = ARG(input);
+
+    Init_Nulled(ARG(pending));
+
+    REBLEN index = VAL_INDEX(input);
+    if (index >= VAL_LEN_HEAD(input))
+        return RAISE("BITSET! did not match at parse position");
+
+    if (ANY_ARRAY(input)) {
+        Cell(const*) at = VAL_ARRAY_ITEM_AT(input);
+        if (Cmp_Value(at, v, false) != 0)
+            return RAISE("BITSET! did not match at parse position");
+        Derelativize(OUT, at, VAL_SPECIFIER(input));
+    }
+    else if (ANY_STRING(input)) {
+        Codepoint c = GET_CHAR_AT(VAL_STRING(input), index);
+        if (not Check_Bit(VAL_BITSET(v), c, false))
+            return RAISE("BITSET! did not match at parse position");
+        Init_Char_Unchecked(OUT, c);
+    }
+    else {
+        assert(IS_BINARY(input));
+        Byte b = *VAL_BINARY_AT(input);
+        if (not Check_Bit(VAL_BITSET(v), b, false))
+            return RAISE("BITSET! did not match at parse position");
+        Init_Integer(OUT, b);
+    }
+
+    ++VAL_INDEX_UNBOUNDED(input);
+    Copy_Cell(ARG(remainder), input);
+    return Proxy_Multi_Returns(frame_);
 }
 
 
@@ -741,6 +792,74 @@ static bool Combinator_Param_Hook(
 }
 
 
+// Only steps whose arguments are all taken literally from the rules can be
+// cached: making a parser for a normal argument runs PARSIFY, which may have
+// effects.  Skippable and endable arguments are left out as well, since what
+// they take depends on rule cells past those consumed (which the cache entry
+// does not keep copies of).
+//
+struct Combinator_Cacheable_State {
+    bool has_value;  // /VALUE given, so a VALUE parameter takes it
+    bool cacheable;
+};
+
+static bool Combinator_Cacheable_Hook(
+    const REBKEY *key,
+    const REBPAR *param,
+    Flags flags,
+    void *opaque
+){
+    UNUSED(flags);
+
+    struct Combinator_Cacheable_State *s
+        = cast(struct Combinator_Cacheable_State*, opaque);
+
+    option(SymId) symid = KEY_SYM(key);
+    if (symid == SYM_INPUT or symid == SYM_REMAINDER or symid == SYM_STATE)
+        return true;
+
+    if (symid == SYM_VALUE and s->has_value)
+        return true;
+
+    if (GET_PARAM_FLAG(param, REFINEMENT))
+        return true;
+
+    if (
+        VAL_PARAM_CLASS(param) != PARAM_CLASS_HARD
+        or GET_PARAM_FLAG(param, SKIPPABLE)
+        or GET_PARAM_FLAG(param, ENDABLE)
+    ){
+        s->cacheable = false;
+        return false;  // no need to look at the rest
+    }
+
+    return true;
+}
+
+
+//
+//  Combinatorize_Cache_Slot: C
+//
+// Find where in TG_Combinator_Cache the parser for a step would be kept.  The
+// slot is picked from the rule position, combinator, and parse state, but the
+// entry there may be for some other step...callers must check all the fields.
+//
+static struct Reb_Combinator_Cache_Entry *Combinatorize_Cache_Slot(
+    Array(const*) rules,
+    REBLEN index,
+    Action(*) combinator,
+    Context(*) state
+){
+    uintptr_t bits = cast(uintptr_t, rules) >> 4;
+    bits ^= cast(uintptr_t, combinator) >> 6;
+    bits ^= cast(uintptr_t, state) >> 8;
+    bits += index * 31;
+    return &TG_Combinator_Cache[
+        (bits ^ (bits >> 8)) & (COMBINATOR_CACHE_SIZE - 1)
+    ];
+}
+
+
 //
 //  combinatorize: native [
 //
@@ -789,14 +908,63 @@ DECLARE_NATIVE(combinatorize)
     if (REF(path))
         fail ("PATH! mechanics in COMBINATORIZE not supported ATM");
 
+    USED(REF(state));
+    USED(REF(value));
+
+    // A loop like `some ["a" "b"]` asks for the same parsers on each trip.
+    // If this step's arguments all come literally from the rules, look for
+    // a parser made before from the same (unchanged) rule cells.
+    //
+    struct Combinator_Cacheable_State cs;
+    cs.has_value = REF(value);
+    cs.cacheable = true;
+    For_Each_Unspecialized_Param(act, &Combinator_Cacheable_Hook, &cs);
+
+    Array(const*) rules = VAL_ARRAY(ARG(rules));
+    REBLEN index = VAL_INDEX(ARG(rules));
+    REBSPC *specifier = VAL_SPECIFIER(ARG(rules));
+    Context(*) state = VAL_CONTEXT(ARG(state));
+
+    struct Reb_Combinator_Cache_Entry *entry = nullptr;
+    if (cs.cacheable) {
+        entry = Combinatorize_Cache_Slot(rules, index, act, state);
+        if (
+            entry->rules == rules
+            and entry->index == index
+            and entry->specifier == specifier
+            and entry->combinator == act
+            and entry->state == state
+            and entry->has_value == REF(value)
+            and (
+                not REF(value)
+                or 0 == memcmp(&entry->value, ARG(value), sizeof(RawCell))
+            )
+            and index + entry->num_cells <= ARR_LEN(rules)
+            and 0 == memcmp(
+                entry->cells,
+                ARR_AT(rules, index),
+                entry->num_cells * sizeof(RawCell)
+            )
+        ){
+            Copy_Cell(ARG(advanced), ARG(rules));
+            VAL_INDEX_UNBOUNDED(ARG(advanced)) += entry->num_cells;
+
+            Activatify(Init_Action(
+                OUT,
+                entry->parser,
+                VAL_ACTION_LABEL(ARG(c)),
+                VAL_ACTION_BINDING(ARG(c))
+            ));
+            return Proxy_Multi_Returns(frame_);
+        }
+    }
+
     struct Combinator_Param_State s;
     s.ctx = Make_Context_For_Action(ARG(c), TOP_INDEX, nullptr);
     s.frame_ = frame_;
 
     PUSH_GC_GUARD(s.ctx);  // Combinator_Param_Hook may call evaluator
 
-    USED(REF(state));
-    USED(REF(value));
     For_Each_Unspecialized_Param(act, &Combinator_Param_Hook, &s);
 
     // Set the advanced parameter to how many rules were consumed (the hook
@@ -807,6 +975,27 @@ DECLARE_NATIVE(combinatorize)
     Action(*) parser = Make_Action_From_Exemplar(s.ctx);
     DROP_GC_GUARD(s.ctx);
 
+    if (entry) {
+        REBLEN num_cells = VAL_INDEX(ARG(advanced)) - index;
+        if (num_cells <= COMBINATOR_CACHE_MAX_CELLS) {
+            entry->rules = rules;
+            entry->index = index;
+            entry->specifier = specifier;
+            entry->combinator = act;
+            entry->state = state;
+            entry->has_value = REF(value);
+            if (REF(value))
+                memcpy(&entry->value, ARG(value), sizeof(RawCell));
+            entry->num_cells = num_cells;
+            memcpy(
+                entry->cells,
+                ARR_AT(rules, index),
+                num_cells * sizeof(RawCell)
+            );
+            entry->parser = parser;
+        }
+    }
+
     Activatify(Init_Action(  // note: MAKE ACTION! copies the context, this won't
         OUT,
         parser,
@@ -0,0 +1,673 @@
+//
+//  File: %c-memoize.c
+//  Summary: "Function generator that remembers results for given arguments"
+//  Section: datatypes
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2026 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the GNU Lesser General Public License (LGPL), Version 3.0.
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// MEMOIZE makes a variant of an action which remembers what it returned for
+// the arguments it was called with.  Calling it again with equal arguments
+// gives back the remembered result without running the action:
+//
+//     >> slow-price: func [item [word!]] [wait 1, return 10]
+//
+//     >> price: memoize :slow-price
+//
+//     >> price 'apple  ; takes a second
+//     == 10
+//
+//     >> price 'apple  ; immediate
+//     == 10
+//
+// /LIMIT caps how many results are kept, dropping the least recently used
+// one to make room for a new one.  /TTL gives a number of seconds after which
+// a result is considered stale and the action is run again.
+//
+// Arguments are compared with strict equality (so case matters in strings).
+// Series arguments are copied when a result is remembered, so changing the
+// series passed in doesn't change what the remembered result is keyed on.
+// Calls with arguments that can't be compared by value (e.g. OBJECT!s, whose
+// fields may change) or that aren't stable just run the action each time.
+// Raised errors are not remembered.
+//
+//=//// NOTES //////////////////////////////////////////////////////////////=//
+//
+// * The results live in a BLOCK! in the details, as records of the argument
+//   values followed by the ^META of the result.  The first cell of that
+//   block is a BINARY! holding the C index: hash slots for finding records,
+//   a least-recently-used list, and the time each record was stored.
+//
+// * While the action runs, the arguments (as they were at the call) and the
+//   hash are held in the frame's SPARE cell.  They are only put in the cache
+//   when the action returns, so a call that fails or throws leaves nothing
+//   behind.  A recursive call that remembers the same arguments first just
+//   has its record updated.
+//
+// * Time is measured with C's time(), so /TTL is only accurate to a second.
+//
+
+#include "sys-core.h"
+
+#include <time.h>  // time() for /TTL
+
+enum {
+    IDX_MEMOIZER_ACTION = 1,  // The ACTION! whose results are remembered
+    IDX_MEMOIZER_CACHE,  // BLOCK! of [index-binary records...]
+    IDX_MEMOIZER_MAX
+};
+
+#define MEMOIZER_INITIAL_CAPACITY 16
+
+struct Memo_Index {
+    REBLEN wide;  // cells per record, the arguments and then the result
+    REBLEN limit;  // most records kept (0 if no limit)
+    REBDEC ttl;  // seconds a record is good for (0 if forever)
+    REBLEN capacity;  // records there is room for in this index
+    REBLEN num_slots;  // hash slots, a power of 2 at least twice capacity
+    REBLEN count;  // records in use
+    REBLEN newest;  // most recently used record (0 if none)
+    REBLEN oldest;  // least recently used record (0 if none)
+    REBLEN free;  // first of a list of evicted records to reuse (0 if none)
+};
+
+struct Memo_Record {  // record numbers are 1-based, 0 is "none"
+    uint32_t hash;
+    REBLEN newer;  // also links records on the free list
+    REBLEN older;
+    REBI64 stored;  // time() when the result was stored
+};
+
+inline static struct Memo_Record *Memo_Records(struct Memo_Index *idx)
+  { return cast(struct Memo_Record*, idx + 1); }
+
+inline static REBLEN *Memo_Slots(struct Memo_Index *idx)
+  { return cast(REBLEN*, Memo_Records(idx) + idx->capacity + 1); }
+
+inline static struct Memo_Index *Memo_Index_Of(Array(*) cache) {
+    Binary(*) bin = VAL_BINARY_KNOWN_MUTABLE(ARR_HEAD(cache));
+    return cast(struct Memo_Index*, BIN_HEAD(bin));
+}
+
+inline static Cell(*) Memo_Record_At(
+    Array(*) cache,
+    struct Memo_Index *idx,
+    REBLEN n
+){
+    return ARR_AT(cache, 1 + (n - 1) * idx->wide);
+}
+
+
+// Arguments and refinements are part of the key.  Locals and anything that
+// was specialized are not.
+//
+inline static bool Is_Memo_Key_Param(const REBPAR *param) {
+    if (Is_Specialized(param))
+        return false;
+    return (
+        VAL_PARAM_CLASS(param) != PARAM_CLASS_RETURN
+        and VAL_PARAM_CLASS(param) != PARAM_CLASS_OUTPUT
+    );
+}
+
+
+// Stable word isotopes (like ~null~) are allowed, and are stored as QUASI!
+// words.  So plain QUASI! arguments aren't, to keep the two apart.
+//
+static bool Is_Memo_Key_Cacheable(const REBVAL *arg)
+{
+    if (Is_Isotope(arg))
+        return HEART_BYTE(arg) == REB_WORD;
+
+    if (QUOTE_BYTE(arg) == QUASI_2)
+        return false;
+
+    switch (CELL_HEART(arg)) {
+      case REB_VOID:
+      case REB_BITSET:
+      case REB_PARAMETER:
+      case REB_HANDLE:  // Hash_Value() can't hash these
+      case REB_FRAME:
+      case REB_MODULE:
+      case REB_ERROR:
+      case REB_PORT:
+      case REB_OBJECT:
+      case REB_MAP:  // hashed by identity, but compared by (mutable) fields
+        return false;
+
+      default:
+        return true;
+    }
+}
+
+
+// `key` is either another stored key, or an argument (whose isotopes have
+// not been made QUASI! yet).
+//
+static bool Memo_Key_Equal(Cell(const*) stored, Cell(const*) key)
+{
+    Byte quote_byte = QUOTE_BYTE(key);
+    if (quote_byte == ISOTOPE_0)
+        quote_byte = QUASI_2;
+
+    if (QUOTE_BYTE(stored) != quote_byte)
+        return false;
+    if (HEART_BYTE(stored) != HEART_BYTE(key))
+        return false;  // Cmp_Value() would say 1 = 1.0
+
+    if (quote_byte == QUASI_2)  // only words, see Is_Memo_Key_Cacheable()
+        return VAL_WORD_SYMBOL(stored) == VAL_WORD_SYMBOL(key);
+
+    return 0 == Cmp_Value(stored, key, true);
+}
+
+
+//
+//  Make_Memo_Index: C
+//
+// Make the BINARY! index for records numbered up to `capacity`, copying over
+// any records from an older index.
+//
+static Binary(*) Make_Memo_Index(
+    struct Memo_Index *old,
+    REBLEN wide,
+    REBLEN limit,
+    REBDEC ttl,
+    REBLEN capacity
+){
+    REBLEN num_slots = 1;
+    while (num_slots < capacity * 2)
+        num_slots *= 2;
+
+    Size size = sizeof(struct Memo_Index)
+        + (capacity + 1) * sizeof(struct Memo_Record)
+        + num_slots * sizeof(REBLEN);
+
+    Binary(*) bin = Make_Binary(size);
+    memset(BIN_HEAD(bin), 0, size);
+    TERM_BIN_LEN(bin, size);
+
+    struct Memo_Index *idx = cast(struct Memo_Index*, BIN_HEAD(bin));
+    idx->wide = wide;
+    idx->limit = limit;
+    idx->ttl = ttl;
+    idx->capacity = capacity;
+    idx->num_slots = num_slots;
+
+    if (not old)
+        return bin;
+
+    assert(old->capacity <= capacity);
+    idx->count = old->count;
+    idx->newest = old->newest;
+    idx->oldest = old->oldest;
+    idx->free = old->free;
+    memcpy(
+        Memo_Records(idx),
+        Memo_Records(old),
+        (old->capacity + 1) * sizeof(struct Memo_Record)
+    );
+
+    // Only the records in use are in the slots, and they're all on the
+    // least-recently-used list.
+    //
+    struct Memo_Record *records = Memo_Records(idx);
+    REBLEN *slots = Memo_Slots(idx);
+    REBLEN mask = num_slots - 1;
+    REBLEN n = idx->newest;
+    for (; n != 0; n = records[n].older) {
+        REBLEN slot = records[n].hash & mask;
+        while (slots[slot] != 0)
+            slot = (slot + 1) & mask;
+        slots[slot] = n;
+    }
+    return bin;
+}
+
+
+// Find the hash slot holding a record whose keys equal the `wide - 1` cells
+// at `keys`, or the empty slot where such a record would go.
+//
+static REBLEN Memo_Find_Slot(
+    Array(*) cache,
+    struct Memo_Index *idx,
+    uint32_t hash,
+    const REBKEY *key_tail,
+    const REBKEY *key,
+    const REBPAR *param,  // nullptr if keys are stored keys (not args)
+    Cell(const*) keys
+){
+    struct Memo_Record *records = Memo_Records(idx);
+    REBLEN *slots = Memo_Slots(idx);
+    REBLEN mask = idx->num_slots - 1;
+
+    REBLEN slot = hash & mask;
+    for (; slots[slot] != 0; slot = (slot + 1) & mask) {
+        REBLEN n = slots[slot];
+        if (records[n].hash != hash)
+            continue;
+
+        Cell(const*) stored = Memo_Record_At(cache, idx, n);
+        Cell(const*) k = keys;
+        if (param) {  // walking a frame's arguments, skip the non-keys
+            const REBKEY *key_at = key;
+            const REBPAR *param_at = param;
+            for (; key_at != key_tail; ++key_at, ++param_at, ++k) {
+                if (not Is_Memo_Key_Param(param_at))
+                    continue;
+                if (not Memo_Key_Equal(stored, k))
+                    goto next_slot;
+                ++stored;
+            }
+        }
+        else {
+            REBLEN i;
+            for (i = 1; i < idx->wide; ++i, ++stored, ++k) {
+                if (not Memo_Key_Equal(stored, k))
+                    goto next_slot;
+            }
+        }
+        return slot;
+
+      next_slot: {}
+    }
+    return slot;
+}
+
+
+static void Memo_Unlink(struct Memo_Index *idx, REBLEN n)
+{
+    struct Memo_Record *records = Memo_Records(idx);
+    if (records[n].newer)
+        records[records[n].newer].older = records[n].older;
+    else
+        idx->newest = records[n].older;
+    if (records[n].older)
+        records[records[n].older].newer = records[n].newer;
+    else
+        idx->oldest = records[n].newer;
+}
+
+
+static void Memo_Link_Newest(struct Memo_Index *idx, REBLEN n)
+{
+    struct Memo_Record *records = Memo_Records(idx);
+    records[n].newer = 0;
+    records[n].older = idx->newest;
+    if (idx->newest)
+        records[idx->newest].newer = n;
+    else
+        idx->oldest = n;
+    idx->newest = n;
+}
+
+
+// Empty the hash slot, shifting back any records after it that are out of
+// their home slot (linear probing has no tombstones).  The record's cells are
+// blanked so they don't keep values alive, and it goes on the free list.
+//
+static void Memo_Remove(Array(*) cache, struct Memo_Index *idx, REBLEN slot)
+{
+    struct Memo_Record *records = Memo_Records(idx);
+    REBLEN *slots = Memo_Slots(idx);
+    REBLEN mask = idx->num_slots - 1;
+
+    REBLEN n = slots[slot];
+    REBLEN hole = slot;
+    REBLEN at = slot;
+    while (true) {
+        at = (at + 1) & mask;
+        if (slots[at] == 0)
+            break;
+        REBLEN home = records[slots[at]].hash & mask;
+        bool stays = (hole <= at)
+            ? (hole < home and home <= at)
+            : (hole < home or home <= at);
+        if (stays)
+            continue;
+        slots[hole] = slots[at];
+        hole = at;
+    }
+    slots[hole] = 0;
+
+    Memo_Unlink(idx, n);
+    --idx->count;
+
+    Cell(*) cell = Memo_Record_At(cache, idx, n);
+    REBLEN i;
+    for (i = 0; i < idx->wide; ++i, ++cell)
+        Init_Blank(cell);
+
+    records[n].newer = idx->free;
+    idx->free = n;
+}
+
+
+//
+//  Memo_Store: C
+//
+// Remember `result` for the stored-form `keys`, evicting the least recently
+// used record if at the limit.
+//
+static void Memo_Store(
+    Array(*) cache,
+    uint32_t hash,
+    Cell(const*) keys,
+    const REBVAL *result
+){
+    struct Memo_Index *idx = Memo_Index_Of(cache);
+
+    REBLEN slot = Memo_Find_Slot(
+        cache, idx, hash, nullptr, nullptr, nullptr, keys
+    );
+    REBLEN n = Memo_Slots(idx)[slot];
+
+    if (n == 0) {  // not stored yet (by a recursion of the same call)
+        if (idx->limit and idx->count >= idx->limit) {
+            REBLEN oldest_slot = Memo_Find_Slot(
+                cache, idx, Memo_Records(idx)[idx->oldest].hash,
+                nullptr, nullptr, nullptr,
+                Memo_Record_At(cache, idx, idx->oldest)
+            );
+            Memo_Remove(cache, idx, oldest_slot);
+        }
+
+        if (idx->free) {
+            n = idx->free;
+            idx->free = Memo_Records(idx)[n].newer;
+        }
+        else {
+            n = (ARR_LEN(cache) - 1) / idx->wide + 1;
+            if (n > idx->capacity) {
+                Binary(*) bin = Make_Memo_Index(
+                    idx, idx->wide, idx->limit, idx->ttl, idx->capacity * 2
+                );
+                Init_Binary(ARR_HEAD(cache), bin);
+                idx = Memo_Index_Of(cache);
+            }
+            REBLEN i;
+            for (i = 0; i < idx->wide; ++i)
+                Init_Blank(Alloc_Tail_Array(cache));
+        }
+
+        // The index may have grown, and the eviction may have shifted slots.
+        //
+        slot = Memo_Find_Slot(
+            cache, idx, hash, nullptr, nullptr, nullptr, keys
+        );
+        assert(Memo_Slots(idx)[slot] == 0);
+        Memo_Slots(idx)[slot] = n;
+        Memo_Records(idx)[n].hash = hash;
+        ++idx->count;
+
+        Cell(*) cell = Memo_Record_At(cache, idx, n);
+        REBLEN i;
+        for (i = 1; i < idx->wide; ++i, ++cell, ++keys)
+            Copy_Cell(cell, keys);
+    }
+    else
+        Memo_Unlink(idx, n);
+
+    Memo_Link_Newest(idx, n);
+    Memo_Records(idx)[n].stored = cast(REBI64, time(nullptr));
+
+    Cell(*) stored_result = Memo_Record_At(cache, idx, n) + idx->wide - 1;
+    Copy_Cell(stored_result, result);
+    Meta_Quotify(SPECIFIC(stored_result));
+}
+
+
+//
+//  Memoizer_Dispatcher: C
+//
+// 1. If the action runs, this frame's varlist is handed to a new frame that
+//    runs it (as with CHAIN).  This dispatcher is then the executor for the
+//    frame left behind, which gets called back with the result.  See notes
+//    in Chainer_Dispatcher().
+//
+// 2. Arguments are copied before the action runs, because it may change
+//    them (or the series they hold) as it goes.
+//
+Bounce Memoizer_Dispatcher(Frame(*) f)
+{
+    Frame(*) frame_ = f;  // for RETURN macros
+
+    if (THROWING)  // this routine is both dispatcher and executor, see [1]
+        return THROWN;
+
+    enum {
+        ST_MEMOIZER_INITIAL_ENTRY = STATE_0,
+        ST_MEMOIZER_RUNNING_ACTION
+    };
+
+    switch (STATE) {
+      case ST_MEMOIZER_INITIAL_ENTRY: goto initial_entry;
+      case ST_MEMOIZER_RUNNING_ACTION: goto action_finished;
+      default: assert(false);
+    }
+
+  initial_entry: {  //////////////////////////////////////////////////////////
+
+    Action(*) phase = FRM_PHASE(f);
+    Array(*) details = ACT_DETAILS(phase);
+    assert(ARR_LEN(details) == IDX_MEMOIZER_MAX);
+
+    REBVAL *memoized = DETAILS_AT(details, IDX_MEMOIZER_ACTION);
+    Array(*) cache = VAL_ARRAY_KNOWN_MUTABLE(
+        ARR_AT(details, IDX_MEMOIZER_CACHE)
+    );
+    struct Memo_Index *idx = Memo_Index_Of(cache);
+
+    const REBKEY *key_tail;
+    const REBKEY *key_head = ACT_KEYS(&key_tail, phase);
+    const REBPAR *param_head = ACT_PARAMS_HEAD(phase);
+    REBVAL *arg_head = FRM_ARGS_HEAD(f);
+
+    uint32_t hash = 0;
+
+  blockscope {
+    const REBKEY *key = key_head;
+    const REBPAR *param = param_head;
+    REBVAL *arg = arg_head;
+    for (; key != key_tail; ++key, ++param, ++arg) {
+        if (not Is_Memo_Key_Param(param))
+            continue;
+        if (not Is_Memo_Key_Cacheable(arg))
+            goto run_uncached;
+        hash = hash * 31 + Hash_Value(arg);
+    }
+  }
+
+  blockscope {
+    REBLEN slot = Memo_Find_Slot(
+        cache, idx, hash, key_tail, key_head, param_head, arg_head
+    );
+    REBLEN n = Memo_Slots(idx)[slot];
+    if (n != 0) {
+        struct Memo_Record *record = &Memo_Records(idx)[n];
+        if (
+            idx->ttl != 0
+            and difftime(time(nullptr), cast(time_t, record->stored))
+                >= idx->ttl
+        ){
+            Memo_Remove(cache, idx, slot);  // stale, run the action again
+        }
+        else {
+            Memo_Unlink(idx, n);
+            Memo_Link_Newest(idx, n);
+
+            Cell(const*) result = Memo_Record_At(cache, idx, n) + idx->wide - 1;
+            Copy_Cell(OUT, SPECIFIC(result));
+            return Meta_Unquotify(OUT);
+        }
+    }
+  }
+
+  blockscope {  // hold arguments and hash until the action returns, see [2]
+    Array(*) pending = Make_Array_Core(
+        2 + idx->wide - 1,
+        NODE_FLAG_MANAGED
+    );
+    Init_Block(SPARE, pending);  // GC-safe now
+
+    Init_Block(Alloc_Tail_Array(pending), cache);
+    Init_Integer(Alloc_Tail_Array(pending), hash);
+
+    const REBKEY *key = key_head;
+    const REBPAR *param = param_head;
+    REBVAL *arg = arg_head;
+    for (; key != key_tail; ++key, ++param, ++arg) {
+        if (not Is_Memo_Key_Param(param))
+            continue;
+
+        enum Reb_Kind heart = CELL_HEART(arg);
+        if (
+            not Is_Isotope(arg)
+            and ANY_SERIES_KIND(heart)
+            and not (
+                ANY_ARRAY_KIND(heart)
+                    ? Is_Array_Frozen_Deep(VAL_ARRAY(arg))
+                    : Is_Series_Frozen(VAL_SERIES(arg))
+            )
+        ){
+            REBVAL *copy = rebValue("copy/deep", rebQ(arg));
+            Copy_Cell(Alloc_Tail_Array(pending), copy);
+            rebRelease(copy);
+        }
+        else {
+            Cell(*) stored = Copy_Cell(Alloc_Tail_Array(pending), arg);
+            if (QUOTE_BYTE(stored) == ISOTOPE_0)
+                mutable_QUOTE_BYTE(stored) = QUASI_2;
+        }
+    }
+  }
+
+    Frame(*) sub = Push_Downshifted_Frame(OUT, f);  // steals varlist, see [1]
+    f->executor = &Memoizer_Dispatcher;
+
+    INIT_FRM_PHASE(sub, VAL_ACTION(memoized));
+    INIT_FRM_BINDING(sub, VAL_ACTION_BINDING(memoized));
+
+    sub->u.action.original = VAL_ACTION(memoized);
+    sub->label = VAL_ACTION_LABEL(memoized);
+  #if !defined(NDEBUG)
+    sub->label_utf8 = sub->label
+        ? STR_UTF8(unwrap(sub->label))
+        : "(anonymous)";
+  #endif
+
+    STATE = ST_MEMOIZER_RUNNING_ACTION;
+    return CATCH_CONTINUE_SUBFRAME(sub);
+
+} run_uncached: {  ///////////////////////////////////////////////////////////
+
+    REBVAL *memoized = DETAILS_AT(
+        ACT_DETAILS(FRM_PHASE(f)),
+        IDX_MEMOIZER_ACTION
+    );
+
+    INIT_FRM_PHASE(f, VAL_ACTION(memoized));
+    INIT_FRM_BINDING(f, VAL_ACTION_BINDING(memoized));
+
+    return BOUNCE_REDO_UNCHECKED;  // arguments were checked already
+
+} action_finished: {  ////////////////////////////////////////////////////////
+
+    if (Is_Raised(OUT))
+        return OUT;  // failures are not remembered
+
+    Array(*) pending = VAL_ARRAY_KNOWN_MUTABLE(SPARE);
+    Array(*) cache = VAL_ARRAY_KNOWN_MUTABLE(ARR_AT(pending, 0));
+    uint32_t hash = cast(uint32_t, VAL_INT64(ARR_AT(pending, 1)));
+
+    Memo_Store(cache, hash, ARR_AT(pending, 2), OUT);
+
+    return OUT;
+}}
+
+
+//
+//  memoize: native [
+//
+//  {Make a variant of an action that remembers results for its arguments}
+//
+//      return: [activation!]
+//      action "Action whose results are to be remembered"
+//          [<unrun> action!]
+//      /limit "Most results to keep, dropping the least recently used"
+//          [integer!]
+//      /ttl "Seconds a result is good for"
+//          [integer! decimal!]
+//  ]
+//
+DECLARE_NATIVE(memoize)
+{
+    INCLUDE_PARAMS_OF_MEMOIZE;
+
+    REBVAL *memoized = ARG(action);
+    mutable_QUOTE_BYTE(memoized) = UNQUOTED_1;  // remove isotope status
+
+    REBLEN limit = 0;
+    if (REF(limit)) {
+        if (VAL_INT64(ARG(limit)) < 1)
+            fail (PARAM(limit));
+        limit = VAL_UINT32(ARG(limit));
+    }
+
+    REBDEC ttl = 0;
+    if (REF(ttl)) {
+        ttl = IS_INTEGER(ARG(ttl))
+            ? cast(REBDEC, VAL_INT64(ARG(ttl)))
+            : VAL_DECIMAL(ARG(ttl));
+        if (ttl <= 0)
+            fail (PARAM(ttl));
+    }
+
+    Action(*) memoizer = Make_Action(
+        ACT_PARAMLIST(VAL_ACTION(memoized)),  // same interface as memoized
+        ACT_PARTIALS(VAL_ACTION(memoized)),
+        &Memoizer_Dispatcher,
+        IDX_MEMOIZER_MAX  // details array capacity => [action, cache]
+    );
+
+    REBLEN wide = 1;  // the result, plus a cell per key argument
+    const REBKEY *tail;
+    const REBKEY *key = ACT_KEYS(&tail, memoizer);
+    const REBPAR *param = ACT_PARAMS_HEAD(memoizer);
+    for (; key != tail; ++key, ++param) {
+        if (Is_Memo_Key_Param(param))
+            ++wide;
+    }
+
+    REBLEN capacity = MEMOIZER_INITIAL_CAPACITY;
+    if (limit and limit < capacity)
+        capacity = limit;
+
+    Array(*) cache = Make_Array_Core(
+        1 + capacity * wide,
+        NODE_FLAG_MANAGED
+    );
+    Init_Binary(
+        Alloc_Tail_Array(cache),
+        Make_Memo_Index(nullptr, wide, limit, ttl, capacity)
+    );
+
+    Array(*) details = ACT_DETAILS(memoizer);
+    Copy_Cell(ARR_AT(details, IDX_MEMOIZER_ACTION), memoized);
+    Init_Block(ARR_AT(details, IDX_MEMOIZER_CACHE), cache);
+
+    return Init_Activation(OUT, memoizer, VAL_ACTION_LABEL(memoized), UNBOUND);
+}
@@ -433,6 +433,37 @@ bool Specialize_Action_Throws(
         }
     }
 
+    // Specializing a specialization would otherwise cost a dispatcher hop
+    // per layer on each call, with each hop only passing control on to the
+    // action in its exemplar.  Since the new exemplar holds the values fixed
+    // by all the layers, aim it at the innermost action directly.  (AUGMENT
+    // uses the same dispatcher, but its exemplar has a wider keylist than the
+    // action it runs, so stop there.)
+    //
+    // !!! This means a later HIJACK of an inner layer is not seen by the
+    // specializations already made of it.
+    //
+  blockscope {
+    Action(*) phase = unspecialized;
+    Context(*) binding = VAL_ACTION_BINDING(specializee);
+    while (
+        ACT_DISPATCHER(phase) == &Specializer_Dispatcher
+        and ACT_KEYLIST(CTX_FRAME_ACTION(ACT_EXEMPLAR(phase)))
+            == ACT_KEYLIST(phase)
+    ){
+        Context(*) inner = ACT_EXEMPLAR(phase);
+        phase = CTX_FRAME_ACTION(inner);
+        binding = CTX_FRAME_BINDING(inner);
+    }
+    if (phase != unspecialized)
+        INIT_VAL_FRAME_ROOTVAR(
+            CTX_ROOTVAR(exemplar),
+            CTX_VARLIST(exemplar),
+            phase,
+            binding
+        );
+  }
+
     Action(*) specialized = Make_Action(
         CTX_VARLIST(exemplar),
         partials,
@@ -114,6 +114,67 @@ Bounce Typeset_Checker_Dispatcher(Frame(*) frame_)
 }
 
 
+//
+//  Cache_Parameter_Fast_Kinds: C
+//
+// Gather the kinds that a parameter's types array accepts just by testing
+// the kind: TYPE-WORD!s, and TYPECHECKER functions.  (Typecheck_Value() has
+// its shortcuts for the same cases.)  Words are looked up now, and ones that
+// don't resolve to one of those contribute nothing--they are left to the
+// slow path, which looks them up each time.
+//
+uintptr_t Cache_Parameter_Fast_Kinds(REBPAR *param)
+{
+    uintptr_t bits = 0;
+
+    Array(const*) array = try_unwrap(VAL_PARAMETER_ARRAY(param));
+    if (array) {
+        Cell(const*) tail = ARR_TAIL(array);
+        Cell(const*) item = ARR_HEAD(array);
+        for (; item != tail; ++item) {
+            Cell(const*) test;
+            if (IS_WORD(item)) {
+                test = try_unwrap(Lookup_Word(item, SPECIFIED));
+                if (not test)
+                    continue;
+            }
+            else
+                test = item;
+
+            REBU64 kinds;
+            if (IS_TYPE_WORD(test))
+                kinds = FLAGIT_KIND(VAL_TYPE_KIND(test));
+            else if (IS_ACTION(test) or Is_Activation(test)) {
+                Action(*) action = VAL_ACTION(test);
+                Dispatcher* dispatcher = ACT_DISPATCHER(action);
+                if (
+                    dispatcher != &Typeset_Checker_Dispatcher
+                    and dispatcher != &Datatype_Checker_Dispatcher
+                ){
+                    continue;  // e.g. EVEN?, must be run each time
+                }
+                Value(*) type = DETAILS_AT(
+                    ACT_DETAILS(action),
+                    IDX_TYPECHECKER_TYPE
+                );
+                if (dispatcher == &Typeset_Checker_Dispatcher)
+                    kinds = Typesets[VAL_INT32(type)];
+                else
+                    kinds = FLAGIT_KIND(VAL_TYPE_KIND(type));
+            }
+            else
+                continue;
+
+            bits |= cast(uintptr_t, kinds);  // high kinds drop off on 32-bit
+        }
+    }
+
+    VAL_PARAMETER_FAST_KINDS(param) = bits;
+    SET_PARAM_FLAG(param, FAST_KINDS_CACHED);
+    return bits;
+}
+
+
 //
 //  typechecker: native [
 //
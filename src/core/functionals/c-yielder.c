@@ -27,6 +27,16 @@
 // between the generators and other code, as well as the question of when to
 // garbage-collect a generator.  Really this is just a proof-of-concept to
 // show the unplugging and replugging of stacks.
+//
+// Fine-grained generators often YIELD only from the top level of their body:
+//
+//     g: generator [yield 1 yield 2]  ; top level, takes the cheaper path
+//     g: generator [repeat 2 [yield 1]]  ; in REPEAT's frame, not top level
+//
+// For a top-level YIELD there is nothing on the data stack or in the mold buffer to
+// be saved aside, and the only frames between YIELD and the yielder are
+// evaluator frames.  The YIELD frame is then remembered by pointer in a
+// HANDLE!, instead of giving it a managed FRAME! context on every yield.
 
 #include "sys-core.h"
 
@@ -34,6 +44,7 @@
 enum {
     IDX_YIELDER_BODY = 1,  // Push_Continuation_Details_0() uses details[0]
     IDX_YIELDER_MODE = 2,  // can't be frame spare (that's reset each call!)
+        // (FRAME! or HANDLE! of the YIELD frame while suspended)
     IDX_YIELDER_LAST_YIELDER_CONTEXT = 3,  // frame stack fragment to resume
     IDX_YIELDER_LAST_YIELD_RESULT = 4,  // so that `z: yield 1 + 2` is useful
     IDX_YIELDER_PLUG = 5,  // saved if you YIELD, captures data stack etc.
@@ -91,7 +102,7 @@ Bounce Yielder_Dispatcher(Frame(*) f)
         fail ("Yielder called again after raising an error");
     }
 
-    if (IS_FRAME(mode))  // we were suspended by YIELD, and want to resume
+    if (IS_FRAME(mode) or IS_HANDLE(mode))  // suspended by YIELD, resume
         goto resume_body;
 
     assert(IS_BLANK(mode));  // set by the YIELDER creation routine
@@ -120,10 +131,12 @@ Bounce Yielder_Dispatcher(Frame(*) f)
 
 } resume_body: {  ////////////////////////////////////////////////////////////
 
-    assert(IS_FRAME(mode));
-
     Frame(*) yielder_frame = f;  // alias for clarity
-    Frame(*) yield_frame = CTX_FRAME_IF_ON_STACK(VAL_CONTEXT(mode));
+    Frame(*) yield_frame;
+    if (IS_HANDLE(mode))  // top-level YIELD, see notes at top of file
+        yield_frame = cast(Frame(*), VAL_HANDLE_VOID_POINTER(mode));
+    else
+        yield_frame = CTX_FRAME_IF_ON_STACK(VAL_CONTEXT(mode));
     assert(yield_frame != nullptr);
 
     // The YIELD binding pointed to the context varlist we used in the
@@ -154,18 +167,11 @@ Bounce Yielder_Dispatcher(Frame(*) f)
 
     // With variables extracted, we no longer need the varlist for this
     // invocation (wrong identity) so we free it, if it isn't GC-managed,
-    // as it wouldn't get freed otherwise.
+    // as it wouldn't get freed otherwise.  (It may be kept as a spare for
+    // the next call of an action with as many parameters.)
     //
-/*    if (NOT_SERIES_FLAG(yielder_frame->varlist, MANAGED)) {
-        //
-        // We only want to kill off this one frame; but the GC will think
-        // that we want to kill the whole stack of frames if we don't
-        // zero out the keylist node.
-        //
-        LINK(yielder_frame->varlist).custom.node = nullptr;
-
-        GC_Kill_Series(SER(yielder_frame->varlist));  // Note: no tracking
-    } */
+    if (NOT_SERIES_FLAG(yielder_frame->varlist, MANAGED))
+        Free_Action_Varlist(yielder_frame->varlist);
 
     // When the last yielder dropped from the frame stack, it should have
     // decayed its keysource from a REBFRM* to the action that was
@@ -376,6 +382,19 @@ DECLARE_NATIVE(yield)
 
     Array(*) yielder_details = ACT_DETAILS(yielder_phase);
 
+    // See if this is a top-level YIELD (notes at top of file).  This has to
+    // be checked before Unplug_Stack() changes the frame stack.
+    //
+    bool top_level = (
+        TOP_INDEX == yielder_frame->baseline.stack_base
+        and STR_SIZE(STR(MOLD_BUF)) == yielder_frame->baseline.mold_buf_size
+    );
+    Frame(*) temp = yield_frame->prior;
+    for (; top_level and temp != yielder_frame; temp = temp->prior) {
+        if (temp == nullptr or Is_Action_Frame(temp))
+            top_level = false;
+    }
+
     // Evaluations will frequently use the f->out to accrue state, perhaps
     // preloading with something (like NULL) that is expected to be there.
     // But we're interrupting the frame and returning what YIELD had instead
@@ -394,11 +413,18 @@ DECLARE_NATIVE(yield)
     // The garbage collector should notice it is there, and mark it live up
     // until the nullptr that we put at the root.
     //
+    // A top-level YIELD frame is found again by pointer.  Its varlist stays
+    // unmanaged (so it is never swept), and can be reused once it drops.
+    //
     Cell(*) mode = ARR_AT(yielder_details, IDX_YIELDER_MODE);
     assert(Is_Quasi_Void(mode));  // should be signal for "currently running"
-    Init_Frame(mode, Context_For_Frame_May_Manage(yield_frame), ANONYMOUS);
-    ASSERT_SERIES_MANAGED(VAL_CONTEXT(mode));
-    assert(CTX_FRAME_IF_ON_STACK(VAL_CONTEXT(mode)) == yield_frame);
+    if (top_level)
+        Init_Handle_Cdata(mode, yield_frame, 1);
+    else {
+        Init_Frame(mode, Context_For_Frame_May_Manage(yield_frame), ANONYMOUS);
+        ASSERT_SERIES_MANAGED(VAL_CONTEXT(mode));
+        assert(CTX_FRAME_IF_ON_STACK(VAL_CONTEXT(mode)) == yield_frame);
+    }
 
     // We store the frame chain into the yielder, as a FRAME! value.  The
     // GC of the ACTION's details will keep it alive.
@@ -173,6 +173,98 @@ Bounce Func_Dispatcher(Frame(*) f)
 }}
 
 
+//
+//  Copy_Or_Share_Body_Managed: C
+//
+// The body of a FUNC is deep copied, with the words for its arguments and
+// locals bound relative to the new action.  Code that makes many functions
+// from one body (e.g. closures generated in a loop) pays for a new copy and
+// the GC load that follows each time.
+//
+// If the body is deeply frozen, the copy can't be told apart from any other
+// copy of it made for an action with the same keys in the same order, since
+// relative words just hold the index to look up in whatever frame is used
+// as their specifier.  So that copy is frozen too and kept in TG_Body_Cache.
+// A later action with matching keys adopts the keylist of the action the
+// copy was made for (which makes Action_Is_Base_Of() accept frames of one
+// for values relative to the other) and gets the same copy.
+//
+// !!! A body that isn't frozen is still copied every time.  Arrays have no
+// write barrier, so nothing could say it hasn't changed since the last copy.
+//
+static Array(*) Copy_Or_Share_Body_Managed(
+    bool *shared,
+    const REBVAL *body,
+    Action(*) a
+){
+    *shared = false;
+
+    Array(const*) source = VAL_ARRAY(body);
+    if (not Is_Array_Frozen_Deep(source))
+        return Copy_And_Bind_Relative_Deep_Managed(
+            body,  // new copy has locals bound relatively to the new action
+            a,
+            VAR_VISIBILITY_ALL  // we created exemplar, see all!
+        );
+
+    REBLEN index = VAL_INDEX(body);
+    REBSPC *specifier = VAL_SPECIFIER(body);
+
+    uintptr_t hash = (cast(uintptr_t, source) >> 4)
+        ^ (cast(uintptr_t, specifier) >> 3)
+        ^ index;
+    struct Reb_Body_Cache_Entry *entry
+        = &TG_Body_Cache[hash & (BODY_CACHE_SIZE - 1)];
+
+    if (
+        entry->source == source
+        and entry->index == index
+        and entry->specifier == specifier
+        and ACT_NUM_PARAMS(entry->action) == ACT_NUM_PARAMS(a)
+    ){
+        const REBKEY *key_tail;
+        const REBKEY *key = ACT_KEYS(&key_tail, a);
+        const REBKEY *other = ACT_KEYS_HEAD(entry->action);
+        const REBPAR *param = ACT_PARAMS_HEAD(a);
+        const REBPAR *other_param = ACT_PARAMS_HEAD(entry->action);
+        for (; key != key_tail; ++key, ++other, ++param, ++other_param) {
+            if (KEY_SYMBOL(key) != KEY_SYMBOL(other))
+                break;
+            if (  // hidden keys aren't bound, see Did_Advance_Evars()
+                Get_Cell_Flag(param, VAR_MARKED_HIDDEN)
+                != Get_Cell_Flag(other_param, VAR_MARKED_HIDDEN)
+            ){
+                break;
+            }
+        }
+
+        if (key == key_tail) {
+            Keylist(*) keylist = ACT_KEYLIST(entry->action);
+            Set_Subclass_Flag(KEYLIST, keylist, SHARED);
+            INIT_BONUS_KEYSOURCE(ACT_PARAMLIST(a), keylist);
+
+            *shared = true;
+            return entry->copy;
+        }
+    }
+
+    Array(*) copy = Copy_And_Bind_Relative_Deep_Managed(
+        body,
+        a,
+        VAR_VISIBILITY_ALL
+    );
+    Freeze_Array_Deep(copy);  // copies that are shared can't diverge
+
+    entry->source = source;
+    entry->index = index;
+    entry->specifier = specifier;
+    entry->action = a;
+    entry->copy = copy;
+
+    return copy;
+}
+
+
 //
 //  Make_Interpreted_Action_May_Fail: C
 //
@@ -226,6 +318,11 @@ Bounce Func_Dispatcher(Frame(*) f)
 //    made these optimizations give diminishing returns, so they were all
 //    eliminated (though they set useful precedent for varying dispatchers).
 //
+// 2. The copy for a frozen body may be shared with other actions, so it is
+//    also frozen and its file and line come from the first spec it was made
+//    for.  Only the copy is shared: each action still gets its own details
+//    (and the CONST bit on the body cell in them).
+//
 Action(*) Make_Interpreted_Action_May_Fail(
     const REBVAL *spec,
     const REBVAL *body,
@@ -253,15 +350,17 @@ Action(*) Make_Interpreted_Action_May_Fail(
     assert(ACT_META(a) == nullptr);
     mutable_ACT_META(a) = meta;
 
-    Array(*) copy = Copy_And_Bind_Relative_Deep_Managed(
-        body,  // new copy has locals bound relatively to the new action
-        a,
-        VAR_VISIBILITY_ALL // we created exemplar, see all!
-    );
+    bool shared;
+    Array(*) copy = Copy_Or_Share_Body_Managed(&shared, body, a);  // see [2]
 
     // Favor the spec first, then the body, for file and line information.
     //
-    if (Get_Subclass_Flag(ARRAY, VAL_ARRAY(spec), HAS_FILE_LINE_UNMASKED)) {
+    if (shared) {
+        // leave file and line as the first action's spec had them, see [2]
+    }
+    else if (
+        Get_Subclass_Flag(ARRAY, VAL_ARRAY(spec), HAS_FILE_LINE_UNMASKED)
+    ){
         mutable_LINK(Filename, copy) = LINK(Filename, VAL_ARRAY(spec));
         copy->misc.line = VAL_ARRAY(spec)->misc.line;
         Set_Subclass_Flag(ARRAY, copy, HAS_FILE_LINE_UNMASKED);
@@ -39,6 +39,16 @@
 
 #include "sys-core.h"
 
+// String literals are scanned for their special bytes 16 at a time on x86-64
+// (where SSE2 is always available), see Skip_Plain_Quote_Bytes()
+//
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+    #include <emmintrin.h>
+    #define SCAN_SSE2 1
+#else
+    #define SCAN_SSE2 0
+#endif
+
 inline static bool Is_Dot_Or_Slash(char c)
   { return c == '/' or c == '.'; }
 
@@ -398,6 +408,71 @@ static const Byte* Scan_UTF8_Char_Escapable(Codepoint *out, const Byte* bp)
 }
 
 
+//
+//  Skip_Plain_Quote_Bytes: C
+//
+// Most of a string literal is bytes that need no processing, and can be
+// copied to the mold buffer in bulk.  This returns the first byte at or after
+// `cp` which is NUL, `^`, CR, LF, or one of the two `stop` bytes (the closing
+// quote, or the braces if it's a braced string).
+//
+// The SSE2 loads are 16-byte aligned.  So while they may read past the NUL
+// at the end of the source, they can't cross into an unmapped page.
+//
+ATTRIBUTE_NO_SANITIZE_ADDRESS
+static const Byte* Skip_Plain_Quote_Bytes(
+    const Byte* cp,
+    Byte stop1,
+    Byte stop2
+){
+  #if SCAN_SSE2
+    const __m128i nul = _mm_setzero_si128();
+    const __m128i caret = _mm_set1_epi8('^');
+    const __m128i cr = _mm_set1_epi8(CR);
+    const __m128i lf = _mm_set1_epi8(LF);
+    const __m128i s1 = _mm_set1_epi8(cast(char, stop1));
+    const __m128i s2 = _mm_set1_epi8(cast(char, stop2));
+
+    uintptr_t misalign = cast(uintptr_t, cp) & 15;
+    const __m128i* p = cast(const __m128i*, cp - misalign);
+    unsigned int skip = 0xFFFF << misalign;  // ignore bytes before cp
+
+    while (true) {
+        __m128i chunk = _mm_load_si128(p);
+        __m128i hits = _mm_or_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(chunk, nul),
+                _mm_cmpeq_epi8(chunk, caret)
+            ),
+            _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, cr),
+                    _mm_cmpeq_epi8(chunk, lf)
+                ),
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, s1),
+                    _mm_cmpeq_epi8(chunk, s2)
+                )
+            )
+        );
+        unsigned int mask = _mm_movemask_epi8(hits) & skip;
+        if (mask != 0)
+            return cast(const Byte*, p) + __builtin_ctz(mask);
+        skip = 0xFFFF;
+        ++p;
+    }
+  #else
+    while (
+        *cp != '\0' and *cp != '^' and *cp != CR and *cp != LF
+        and *cp != stop1 and *cp != stop2
+    ){
+        ++cp;
+    }
+    return cp;
+  #endif
+}
+
+
 //
 //  Scan_Quote_Push_Mold: C
 //
@@ -413,17 +488,39 @@ static const Byte* Scan_Quote_Push_Mold(
     Push_Mold(mo);
 
     Codepoint term; // pick termination
-    if (*src == '{')
+    Byte stop;  // other byte interrupting a bulk copy (braces nest)
+    if (*src == '{') {
         term = '}';
+        stop = '{';
+    }
     else {
         assert(*src == '"');
         term = '"';
+        stop = '"';
     }
     ++src;
 
     REBINT nest = 0;
     REBLEN lines = 0;
     while (*src != term or nest > 0) {
+        const Byte* plain = Skip_Plain_Quote_Bytes(src, cast(Byte, term), stop);
+        if (plain != src) {
+            Size size = plain - src;
+            Length len;
+            if (Find_Invalid_Utf8(&len, src, size))
+                return nullptr;
+
+            String(*) s = mo->series;
+            Length old_len = STR_LEN(s);
+            Size old_size = STR_SIZE(s);
+            EXPAND_SERIES_TAIL(s, size);
+            memcpy(BIN_AT(s, old_size), src, size);
+            TERM_STR_LEN_SIZE(s, old_len + len, old_size + size);
+
+            src = plain;
+            continue;
+        }
+
         Codepoint c = *src;
 
         switch (c) {
@@ -800,6 +897,157 @@ static Context(*) Error_Mismatch(SCAN_LEVEL *level, char wanted, char seen) {
 }
 
 
+//=//// VARIADIC FRAGMENT CACHE ///////////////////////////////////////////=//
+//
+// C code using the API tends to pass the same string literals over and over,
+// e.g. `rebValue("append", block, "[x y]")` in a loop.  Scanning those again
+// each time means interning the words and making the arrays again, so the
+// values a fragment scans to are cached by the fragment's address.
+//
+// * The address alone can't be trusted--it may be a buffer that is reused,
+//   as with the temporary strings made for reb.Value() calls in JavaScript.
+//   So the fragment's bytes are kept and compared.  This is still much
+//   cheaper than a scan, and means no "this is a literal" marker is needed.
+//
+// * Only fragments that start and end at the top level of the scan and
+//   between tokens are cached, e.g. not "[x" or "foo/" or "'".  Scanning
+//   such a fragment on its own gives the same values as scanning it as part
+//   of the feed.
+//
+// * Words may have been attached to the feed's module, so that is part of
+//   the key.  (If none of the values refer to the module it doesn't matter
+//   if it is freed and the address is reused.)
+//
+// * The cached values are copied deeply when they are used, so that code
+//   which modifies a block or string that came from a fragment does not
+//   change what later calls get.
+//
+
+#define SCAN_FRAGMENT_CACHE_SIZE 256  // must be a power of 2
+#define SCAN_FRAGMENT_MAX_SIZE 1024  // longer fragments are not cached
+
+struct Reb_Scan_Fragment {
+    const Byte* utf8;  // the address the fragment was at (nullptr if unused)
+    Byte* copy;  // the fragment's bytes when it was cached, with terminator
+    Size size;
+    Context(*) context;  // module words were attached to, or nullptr
+};
+
+static struct Reb_Scan_Fragment Scan_Fragments[SCAN_FRAGMENT_CACHE_SIZE];
+
+static REBVAL *Root_Scan_Fragments;  // BLOCK! holding the arrays of values
+
+inline static REBLEN Scan_Fragment_Slot(const Byte* utf8) {
+    uintptr_t i = cast(uintptr_t, utf8);
+    return ((i >> 2) ^ (i >> 11)) & (SCAN_FRAGMENT_CACHE_SIZE - 1);
+}
+
+inline static Array(*) Scan_Fragment_Values(REBLEN slot) {
+    Cell(*) cell = ARR_AT(VAL_ARRAY_KNOWN_MUTABLE(Root_Scan_Fragments), slot);
+    return VAL_ARRAY_KNOWN_MUTABLE(cell);
+}
+
+
+// A level is at a point where a fragment can be cached (or taken from the
+// cache) if it is the top level, with no `'` or `~` or `@` etc. waiting for
+// the next value.
+//
+inline static bool Is_Scan_Fragment_Boundary(Frame(*) f) {
+    SCAN_LEVEL *level = &f->u.scan;
+    return level->mode == '\0'
+        and level->quotes_pending == 0
+        and level->prefix_pending == TOKEN_0
+        and not level->quasi_pending;
+}
+
+
+static option(Array(*)) Try_Get_Cached_Scan_Fragment(
+    const Byte* utf8,
+    Context(*) context
+){
+    if (not Root_Scan_Fragments)
+        return nullptr;  // boot or shutdown
+
+    REBLEN slot = Scan_Fragment_Slot(utf8);
+    struct Reb_Scan_Fragment *frag = &Scan_Fragments[slot];
+
+    if (frag->utf8 != utf8 or frag->context != context)
+        return nullptr;
+
+    // strncmp() stops at the terminator of a shorter string, so it won't
+    // read past the end of `utf8` if the content there has changed.
+    //
+    if (
+        strncmp(cs_cast(frag->copy), cs_cast(utf8), frag->size) != 0
+        or utf8[frag->size] != '\0'
+    ){
+        return nullptr;
+    }
+
+    return Scan_Fragment_Values(slot);
+}
+
+
+// Called when the scanner reaches the end of a fragment that it started to
+// scan at a boundary, with the values it pushed on the stack.
+//
+static void Cache_Scan_Fragment(
+    Frame(*) f,
+    const Byte* utf8,
+    const Byte* end,
+    StackIndex base
+){
+    if (not Root_Scan_Fragments)
+        return;  // boot or shutdown
+
+    if (not Is_Scan_Fragment_Boundary(f))
+        return;  // e.g. ended inside a BLOCK!, or on a pending `'`
+
+    if (Get_Executor_Flag(SCAN, f, NEWLINE_PENDING))
+        return;  // would need to apply to the value after the fragment
+
+    Size size = end - utf8;
+    if (size == 0 or size > SCAN_FRAGMENT_MAX_SIZE)
+        return;
+
+    REBLEN slot = Scan_Fragment_Slot(utf8);
+    struct Reb_Scan_Fragment *frag = &Scan_Fragments[slot];
+
+    if (frag->copy)
+        FREE_N(Byte, frag->size + 1, frag->copy);
+
+    frag->copy = TRY_ALLOC_N(Byte, size + 1);
+    if (not frag->copy) {
+        frag->utf8 = nullptr;
+        return;  // just don't cache it
+    }
+    memcpy(frag->copy, utf8, size + 1);  // includes the terminator
+    frag->size = size;
+    frag->utf8 = utf8;
+    frag->context = try_unwrap(f->feed->context);
+
+    REBLEN len = TOP_INDEX - base;
+    Array(*) a = Copy_Values_Len_Shallow_Core(
+        Data_Stack_At(base + 1),
+        SPECIFIED,
+        len,
+        NODE_FLAG_MANAGED
+    );
+    Init_Block(
+        ARR_AT(VAL_ARRAY_KNOWN_MUTABLE(Root_Scan_Fragments), slot),
+        a
+    );
+
+    // The values on the stack are going into the result of this scan, where
+    // they might be modified...so the cache gets its own copies.
+    //
+    Cell(const*) tail = ARR_TAIL(a);
+    Cell(*) v = ARR_HEAD(a);
+    for (; v != tail; ++v)
+        Clonify(v, NODE_FLAG_MANAGED, TS_STD_SERIES);
+}
+
+
 //
 //  Prescan_Token: C
 //
@@ -1030,6 +1278,32 @@ static enum Reb_Token Maybe_Locate_Token_May_Push_Mold(
             break; }
 
           case DETECTED_AS_UTF8: {  // String segment, scan it ordinarily.
+            if (Is_Scan_Fragment_Boundary(f)) {  // ...unless it's cached
+                const Byte* utf8 = cast(const Byte*, f->feed->p);
+                option(Array(*)) cached = Try_Get_Cached_Scan_Fragment(
+                    utf8,
+                    try_unwrap(f->feed->context)
+                );
+                if (cached) {
+                    Cell(const*) tail = ARR_TAIL(unwrap(cached));
+                    Cell(const*) v = ARR_HEAD(unwrap(cached));
+                    for (; v != tail; ++v) {
+                        Copy_Cell(PUSH(), SPECIFIC(v));
+                        Clonify(TOP, NODE_FLAG_MANAGED, TS_STD_SERIES);
+                        if (Get_Executor_Flag(SCAN, f, NEWLINE_PENDING)) {
+                            Clear_Executor_Flag(SCAN, f, NEWLINE_PENDING);
+                            Set_Cell_Flag(TOP, NEWLINE_BEFORE);
+                        }
+                    }
+                    break;
+                }
+
+                if (Not_Executor_Flag(SCAN, f, NEWLINE_PENDING)) {
+                    ss->fragment = utf8;  // cache it if it ends at a boundary
+                    ss->fragment_base = TOP_INDEX;
+                }
+            }
+
             ss->begin = cast(const Byte*, f->feed->p);  // breaks the loop...
 
             // If we're using a va_list, we start the scan with no C string
@@ -1344,6 +1618,10 @@ static enum Reb_Token Maybe_Locate_Token_May_Push_Mold(
             // to check if there's a variadic pointer in effect to see if
             // there's more content yet to come.
             //
+            if (ss->fragment) {
+                Cache_Scan_Fragment(f, ss->fragment, cp, ss->fragment_base);
+                ss->fragment = nullptr;
+            }
             ss->begin = nullptr;
             TRASH_POINTER_IF_DEBUG(ss->end);
             goto acquisition_loop;
@@ -1850,6 +2128,9 @@ void Init_Scan_Level(
     level->start_line_head = ss->line_head = ss->begin;
     level->start_line = ss->line = line;
     level->mode = '\0';
+
+    ss->fragment = nullptr;
+    TRASH_IF_DEBUG(ss->fragment_base);
 }
 
 
@@ -2139,6 +2420,17 @@ Bounce Scanner_Executor(Frame(*) f) {
 
       case TOKEN_GROUP_BEGIN:
       case TOKEN_BLOCK_BEGIN: {
+        //
+        // !!! It has been suggested that nested arrays could be left
+        // unscanned--just remembering their byte range--and only have their
+        // contents scanned the first time they're accessed.  But there is no
+        // read barrier on arrays to hang that on: Cell_Array() and the
+        // series accessors hand out raw cell pointers everywhere (including
+        // to extensions through the API), and an array's length has to be
+        // known the moment the cell exists.  The source UTF-8 would also
+        // have to be kept alive by every such array.  Making the scan of a
+        // child cheap is what's done instead (see Skip_Plain_Quote_Bytes()).
+        //
         Frame(*) subframe = Make_Frame(
             f->feed,
             FRAME_FLAG_TRAMPOLINE_KEEPALIVE  // we want accrued stack
@@ -2175,6 +2467,8 @@ Bounce Scanner_Executor(Frame(*) f) {
         );
         Drop_Frame(SUBFRAME);
 
+        Flag_Array_If_No_Bindables(a);  // lets BIND skip e.g. data blocks
+
         // Tag array with line where the beginning bracket/group/etc. was found
         //
         a->misc.line = ss->line;
@@ -2346,6 +2640,11 @@ Bounce Scanner_Executor(Frame(*) f) {
             ss->end--;  // put ':' back on end but not beginning
             break;
         }
+        if (len > 10 and bp[4] == '-' and (bp[10] == 'T' or bp[10] == 't')) {
+            if (ep != Scan_Date(PUSH(), bp, len))  // ISO-8601 `2023-06-01T12:34`
+                return DROP(), RAISE(Error_Syntax(ss, level->token));
+            break;
+        }
         if (ep != Scan_Time(PUSH(), bp, len))
             return DROP(), RAISE(Error_Syntax(ss, level->token));
         break;
@@ -2946,6 +3245,14 @@ Bounce Scanner_Executor(Frame(*) f) {
 //    an array, vs. using the va_arg() stack.  So vaptr is nullptr to signal
 //    the `p` pointer is this packed array, vs. the first item of a va_list.)
 //
+// !!! Large inputs of many top-level values could in principle be split at
+// top-level delimiters and the pieces scanned on several threads.  But the
+// scanner can't run off the main thread: every value it makes allocates from
+// the unsynchronized series pools (and is tracked by the GC's manuals list),
+// and every word is interned into the global symbol table.  Thread-local
+// pools and a lock-free intern table would be needed first.  (Compare with
+// the parallel SORT in %f-qsort.c, which only has to move cells around.)
+//
 Array(*) Scan_UTF8_Managed(
     String(const*) file,
     const Byte* utf8,
@@ -3008,6 +3315,44 @@ void Shutdown_Scanner(void)
 }
 
 
+//
+//  Startup_Scan_Fragment_Cache: C
+//
+// The arrays of cached values live in an API handle so the GC sees them, so
+// this has to be after Startup_Api().
+//
+void Startup_Scan_Fragment_Cache(void)
+{
+    Array(*) a = Make_Array(SCAN_FRAGMENT_CACHE_SIZE);
+    REBLEN n;
+    for (n = 0; n < SCAN_FRAGMENT_CACHE_SIZE; ++n) {
+        Init_Block(Alloc_Tail_Array(a), EMPTY_ARRAY);
+        Scan_Fragments[n].utf8 = nullptr;
+        Scan_Fragments[n].copy = nullptr;
+    }
+
+    ensureNullptr(Root_Scan_Fragments) = Init_Block(Alloc_Value(), a);
+}
+
+
+//
+//  Shutdown_Scan_Fragment_Cache: C
+//
+void Shutdown_Scan_Fragment_Cache(void)
+{
+    REBLEN n;
+    for (n = 0; n < SCAN_FRAGMENT_CACHE_SIZE; ++n) {
+        struct Reb_Scan_Fragment *frag = &Scan_Fragments[n];
+        if (frag->copy)
+            FREE_N(Byte, frag->size + 1, frag->copy);
+        frag->copy = nullptr;
+        frag->utf8 = nullptr;
+    }
+
+    rebReleaseAndNull(&Root_Scan_Fragments);
+}
+
+
 //
 //  transcode: native [
 //
@@ -3020,6 +3365,7 @@ void Shutdown_Scanner(void)
 //      source "If BINARY!, must be UTF-8 encoded"
 //          [text! binary!]
 //      /one "Translate one value and give back next position"
+//      /partial "With /ONE, input may be cut off: null if value may be too"
 //      /file "File to be associated with BLOCK!s and GROUP!s in source"
 //          [file! url!]
 //      /line "Line number for start of scan, word variable will be updated"
@@ -3079,6 +3425,9 @@ DECLARE_NATIVE(transcode)
   //
   //    !!! Should the base name and extension be stored, or whole path?
 
+    if (REF(partial) and not REF(one))
+        fail (Error_Bad_Refines_Raw());
+
     if (IS_BINARY(source))  // scanner needs data to end in '\0', see [1]
         TERM_BIN(m_cast(Binary(*), VAL_BINARY(source)));
 
@@ -3153,8 +3502,28 @@ DECLARE_NATIVE(transcode)
     // if the source data is "[1]" then the scanner will push BLOCK! [1]
     //
     // Return a block of the results, so [1] and [[1]] in those cases.
+    //
+    // 1. With /PARTIAL the caller will append more input and try again from
+    //    the same position if we return null.  A value is only trusted if
+    //    something is seen after it (`abc` might be the start of `abcdef`).
+    //    Errors might be from truncation if they are "missing" errors (like
+    //    an unclosed block or string) or if they are on the last line, since
+    //    other tokens can't continue across a newline.
 
     if (Is_Raised(OUT)) {
+        if (REF(partial)) {  // might just need more input, see [1]
+            ERROR_VARS *vars = ERR_VARS(VAL_CONTEXT(OUT));
+            if (
+                (
+                    IS_WORD(&vars->id)
+                    and VAL_WORD_ID(&vars->id) == SYM_SCAN_MISSING
+                )
+                or not memchr(ss->line_head, LF, (bp + size) - ss->line_head)
+            ){
+                Drop_Frame(SUBFRAME);
+                return nullptr;
+            }
+        }
         Drop_Frame(SUBFRAME);
         return OUT;  // the raised error
     }
@@ -3162,6 +3531,14 @@ DECLARE_NATIVE(transcode)
     if (REF(one)) {
         if (TOP_INDEX == STACK_BASE)
             Init_Nulled(OUT);
+        else if (
+            REF(partial)
+            and (ss->begin == nullptr or ss->begin == bp + size)  // see [1]
+        ){
+            DROP();
+            Drop_Frame(SUBFRAME);
+            return nullptr;
+        }
         else {
             Move_Cell(OUT, TOP);
             DROP();
@@ -3173,6 +3550,7 @@ DECLARE_NATIVE(transcode)
             flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
 
         Array(*) a = Pop_Stack_Values_Core(STACK_BASE, flags);
+        Flag_Array_If_No_Bindables(a);
 
         a->misc.line = ss->line;
         mutable_LINK(Filename, a) = ss->file;
@@ -548,13 +548,25 @@ const Byte* Scan_Decimal(
 
     const Byte* bp = cp;
 
+    bool negative = (*cp == '-');
     if (*cp == '+' || *cp == '-')
         *ep++ = *cp++;
 
     bool digit_present = false;
 
+    // Digits are also gathered into an integer as they are copied, so the
+    // common case of a short decimal can skip strtod() (see Try_Exact_Decimal)
+    //
+    REBU64 mantissa = 0;
+    REBINT num_significant = 0;  // up to 19 fit in REBU64 without overflow
+    REBINT exponent = 0;
+
     while (IS_LEX_NUMBER(*cp) || *cp == '\'') {
         if (*cp != '\'') {
+            if (mantissa != 0 or *cp != '0') {
+                ++num_significant;
+                mantissa = mantissa * 10 + (*cp - '0');
+            }
             *ep++ = *cp++;
             digit_present = true;
         }
@@ -569,6 +581,11 @@ const Byte* Scan_Decimal(
 
     while (IS_LEX_NUMBER(*cp) || *cp == '\'') {
         if (*cp != '\'') {
+            if (mantissa != 0 or *cp != '0') {
+                ++num_significant;
+                mantissa = mantissa * 10 + (*cp - '0');
+            }
+            --exponent;
             *ep++ = *cp++;
             digit_present = true;
         }
@@ -583,13 +600,18 @@ const Byte* Scan_Decimal(
         *ep++ = *cp++;
         digit_present = false;
 
+        bool negative_exponent = (*cp == '-');
         if (*cp == '-' || *cp == '+')
             *ep++ = *cp++;
 
+        REBINT e = 0;
         while (IS_LEX_NUMBER(*cp)) {
+            if (e < 10000)  // big enough to be out of range, won't overflow
+                e = e * 10 + (*cp - '0');
             *ep++ = *cp++;
             digit_present = true;
         }
+        exponent += negative_exponent ? -e : e;
 
         if (not digit_present)
             return_NULL;
@@ -609,8 +631,17 @@ const Byte* Scan_Decimal(
 
     Reset_Unquoted_Header_Untracked(TRACK(out), CELL_MASK_DECIMAL);
 
-    char *se;
-    VAL_DECIMAL(out) = strtod(s_cast(buf), &se);
+    if (
+        num_significant <= 19
+        and Try_Exact_Decimal(&VAL_DECIMAL(out), mantissa, exponent)
+    ){
+        if (negative)
+            VAL_DECIMAL(out) = -VAL_DECIMAL(out);
+    }
+    else {
+        char *se;
+        VAL_DECIMAL(out) = strtod(s_cast(buf), &se);
+    }
 
     // !!! TBD: need check for NaN, and INF
 
@@ -644,6 +675,25 @@ const Byte* Scan_Integer(
          }
     }
 
+    // Plain digits (the usual case) can be gathered without copying to a
+    // buffer for CHR_TO_INT().  Up to 18 of them can't overflow.
+    //
+    if (len <= 18) {
+        const Byte* tail = cp + len;
+        const Byte* dp = cp;
+        if (*dp == '-' or *dp == '+')
+            ++dp;
+        if (dp != tail) {
+            REBI64 n = 0;
+            for (; dp != tail and *dp >= '0' and *dp <= '9'; ++dp)
+                n = (n * 10) + (*dp - '0');
+            if (dp == tail) {
+                Init_Integer(out, *cp == '-' ? -n : n);
+                return tail;
+            }
+        }
+    }
+
     Byte buf[MAX_NUM_LEN + 4];
     if (len > MAX_NUM_LEN)
         return_NULL; // prevent buffer overflow
@@ -715,6 +765,205 @@ const Byte* Scan_Integer(
 }
 
 
+//=//// ISO-8601 FAST PATH /////////////////////////////////////////////////=//
+//
+// Logs and CSV files have timestamps like `2023-06-01T12:34:56.789Z` by the
+// million.  Those are fixed width, so instead of a Grab_Int() per field the
+// first 16 bytes are loaded as two 64-bit words, and all of the digits in a
+// word are checked and converted at once ("SWAR", SIMD Within A Register).
+//
+// The accepted form is `YYYY-MM-DD`, then optionally `T` (or `/` or space)
+// and `HH:MM` with optional `:SS` and `.fraction`, then an optional zone of
+// `Z` or `+hh:mm` / `-hh:mm` / `+hhmm`.  Anything else returns nullptr and
+// Scan_Date() tries the general scanner, so this only has to be right about
+// what it accepts.  (`T` and `Z` are only understood here.)
+//
+
+// Bytes are combined explicitly so this is the same on big-endian machines;
+// compilers turn it into a single load on little-endian ones.
+//
+inline static uint64_t Load_Le64(const Byte* bp) {
+    return cast(uint64_t, bp[0])
+        | (cast(uint64_t, bp[1]) << 8)
+        | (cast(uint64_t, bp[2]) << 16)
+        | (cast(uint64_t, bp[3]) << 24)
+        | (cast(uint64_t, bp[4]) << 32)
+        | (cast(uint64_t, bp[5]) << 40)
+        | (cast(uint64_t, bp[6]) << 48)
+        | (cast(uint64_t, bp[7]) << 56);
+}
+
+// A byte b is '0'..'9' iff neither b + 0x46 (overflows 0x7F if b > '9') nor
+// b - 0x30 (wraps if b < '0') has its high bit set.  Carries or borrows into
+// the next byte only happen when a byte has already failed the test.
+//
+inline static bool Swar_Are_Digits(uint64_t w, uint64_t digit_mask) {
+    uint64_t d = w & digit_mask;
+    uint64_t over = d + (0x4646464646464646 & digit_mask);
+    uint64_t under = d - (0x3030303030303030 & digit_mask);
+    return ((over | under) & 0x8080808080808080 & digit_mask) == 0;
+}
+
+// After this, byte i holds the two digit number made by bytes i and i + 1.
+//
+inline static uint64_t Swar_Digit_Pairs(uint64_t w, uint64_t digit_mask) {
+    uint64_t v = (w & digit_mask) - (0x3030303030303030 & digit_mask);
+    return (v * 10) + (v >> 8);  // 9 * 10 + 9 fits in a byte, no carries
+}
+
+#define SWAR_BYTE(w,i) \
+    cast(REBINT, ((w) >> ((i) * 8)) & 0xFF)
+
+#define ISO_DIGIT_PAIR(bp) \
+    (((bp)[0] - '0') * 10 + ((bp)[1] - '0'))
+
+static bool Is_Iso_Digit_Pair(const Byte* bp, const Byte* end) {
+    return end - bp >= 2
+        and bp[0] >= '0' and bp[0] <= '9'
+        and bp[1] >= '0' and bp[1] <= '9';
+}
+
+static const Byte* Scan_Iso_8601_Date(
+    Cell(*) out,
+    const Byte* cp,
+    REBLEN len
+){
+    if (len < 10)
+        return nullptr;
+
+    const Byte* end = cp + len;
+
+    Byte head[16];  // zero padding is never a digit or separator
+    memset(head, 0, sizeof(head));
+    memcpy(head, cp, len < 16 ? len : 16);
+
+    uint64_t w = Load_Le64(head);  // "YYYY-MM-"
+    if (
+        not Swar_Are_Digits(w, 0x00FFFF00FFFFFFFF)
+        or (w & 0xFF0000FF00000000) != 0x2D00002D00000000  // the two '-'
+    ){
+        return nullptr;
+    }
+    uint64_t pairs = Swar_Digit_Pairs(w, 0x00FFFF00FFFFFFFF);
+    REBINT year = SWAR_BYTE(pairs, 0) * 100 + SWAR_BYTE(pairs, 2);
+    REBINT month = SWAR_BYTE(pairs, 5);
+
+    w = Load_Le64(head + 8);  // "DDTHH:MM", or just "DD"
+    if (not Swar_Are_Digits(w, 0x000000000000FFFF))
+        return nullptr;
+    REBINT day = SWAR_BYTE(Swar_Digit_Pairs(w, 0x000000000000FFFF), 0);
+
+    if (month < 1 or month > 12 or day < 1 or day > Month_Max_Days[month - 1])
+        return nullptr;
+
+    if (month == 2 and day == 29) {
+        if ((year % 4) != 0 or ((year % 100) == 0 and (year % 400) != 0))
+            return nullptr;  // not a leap year
+    }
+
+    REBI64 nanoseconds = NO_DATE_TIME;
+    REBINT tz = NO_DATE_ZONE;
+
+    cp += 10;
+    if (cp == end)
+        goto finished;
+
+    if (*cp != 'T' and *cp != 't' and *cp != '/' and *cp != ' ')
+        return nullptr;
+
+    if (
+        len < 16
+        or not Swar_Are_Digits(w, 0xFFFF00FFFF000000)
+        or (w & 0x0000FF0000000000) != 0x00003A0000000000  // the ':'
+    ){
+        return nullptr;
+    }
+
+  blockscope {
+    pairs = Swar_Digit_Pairs(w, 0xFFFF00FFFF000000);
+    REBINT hour = SWAR_BYTE(pairs, 3);
+    REBINT minute = SWAR_BYTE(pairs, 6);
+    REBINT second = 0;
+    REBI64 fraction = 0;
+
+    cp += 6;
+    if (cp != end and *cp == ':') {
+        if (not Is_Iso_Digit_Pair(cp + 1, end))
+            return nullptr;
+        second = ISO_DIGIT_PAIR(cp + 1);
+        cp += 3;
+
+        if (cp != end and (*cp == '.' or *cp == ',')) {
+            ++cp;
+            REBINT digits = 0;
+            REBI64 scale = SEC_SEC;
+            for (; cp != end and *cp >= '0' and *cp <= '9'; ++cp, ++digits) {
+                if (digits == 9)
+                    return nullptr;  // beyond nanoseconds, let Scan_Time() say
+                scale /= 10;
+                fraction += (*cp - '0') * scale;
+            }
+            if (digits == 0)
+                return nullptr;
+        }
+    }
+
+    if (hour > 23 or minute > 59 or second > 59)
+        return nullptr;
+
+    nanoseconds = HOUR_TIME(hour) + MIN_TIME(minute) + SEC_TIME(second)
+        + fraction;
+  }
+
+    if (cp == end)
+        goto finished;
+
+    if (*cp == 'Z' or *cp == 'z') {
+        tz = 0;
+        ++cp;
+    }
+    else if (*cp == '+' or *cp == '-') {
+        bool negative = (*cp == '-');
+        ++cp;
+        if (not Is_Iso_Digit_Pair(cp, end))
+            return nullptr;
+        REBINT h = ISO_DIGIT_PAIR(cp);
+        cp += 2;
+        if (cp != end and *cp == ':')
+            ++cp;
+        if (not Is_Iso_Digit_Pair(cp, end))
+            return nullptr;
+        REBINT m = ISO_DIGIT_PAIR(cp);
+        cp += 2;
+
+        if (h > 15 or m > 59 or m % ZONE_MINS != 0)
+            return nullptr;
+
+        tz = (h * 60 + m) / ZONE_MINS;
+        if (negative)
+            tz = -tz;
+    }
+
+    if (cp != end)
+        return nullptr;
+
+  finished:
+
+    Reset_Unquoted_Header_Untracked(TRACK(out), CELL_MASK_DATE);
+    PAYLOAD(Time, out).nanoseconds = nanoseconds;
+    VAL_YEAR(out) = year;
+    VAL_MONTH(out) = month;
+    VAL_DAY(out) = day;
+    VAL_DATE(out).zone = NO_DATE_ZONE;  // Adjust_Date_Zone() requires this
+
+    Adjust_Date_Zone_Core(out, tz);
+
+    VAL_DATE(out).zone = tz;
+
+    return end;
+}
+
+
 //
 //  Scan_Date: C
 //
@@ -725,6 +974,10 @@ const Byte* Scan_Date(
     const Byte* cp,
     REBLEN len
 ) {
+    const Byte* iso = Scan_Iso_8601_Date(out, cp, len);
+    if (iso)
+        return iso;
+
     const Byte* end = cp + len;
 
     // Skip spaces:
@@ -60,6 +60,8 @@
 // approaches used.
 //
 
+#include <time.h>  // clock() for sweep slices
+
 #include "sys-core.h"
 
 #include "sys-int-funcs.h"
@@ -86,6 +88,11 @@
 
 static REBI64 mark_count = 0;
 
+#define CELL_MASK_NODES_TO_MARK \
+    (CELL_FLAG_FIRST_IS_NODE | CELL_FLAG_SECOND_IS_NODE)
+
+static bool sweep_incrementally = false;  // see Defer_Sweep()
+
 #define ASSERT_NO_GC_MARKS_PENDING() \
     assert(SER_USED(GC_Mark_Stack) == 0)
 
@@ -352,6 +359,13 @@ static void Queue_Mark_Cell_Deep(Cell(const*) cv)
 // Processing continues until all reachable items from the mark stack are
 // known to be marked.
 //
+//////////////////////////////////////////////////////////////////////////////
+//
+// 1. Most cells in a typical array (INTEGER!, DECIMAL!, CHAR!...) have no
+//    nodes in them.  Filtering those out here saves a call per cell, which
+//    adds up since marking is the bulk of a recycle's time.  The debug build
+//    still runs Queue_Mark_Cell_Deep() on them to check their invariants.
+//
 static void Propagate_All_GC_Marks(void)
 {
     assert(not in_mark);
@@ -404,6 +418,15 @@ static void Propagate_All_GC_Marks(void)
             }
           #endif
 
+          #if defined(NDEBUG)  // debug build checks every cell, see [1]
+            if (
+                not (v->header.bits & CELL_MASK_NODES_TO_MARK)
+                and not IS_BINDABLE_KIND(CELL_HEART(v))
+            ){
+                continue;  // e.g. INTEGER!, no node references to follow
+            }
+          #endif
+
             Queue_Mark_Cell_Deep(v);
         }
 
@@ -744,10 +767,12 @@ static void Mark_Frame_Stack_Deep(void)
             singular = LINK(Splice, singular);
         } while (singular);
 
-        // !!! This used to mark f->feed->p; but we probably do not need to.
-        // All variadics are reified as arrays in the GC (we could avoid this
-        // using va_copy, but probably not worth it).  All values in feed
-        // should be covered in terms of GC protection.
+        // Variadic feeds are *not* reified as arrays to be marked.  Whatever
+        // has already been fetched lives in the feed's cells marked here, and
+        // what the va_list has yet to give is API handles or C locals that
+        // the caller is keeping alive.  So a GC during an API call costs no
+        // allocation for the feed (reifying only happens for debug dumps and
+        // for the NEAR of an error raised mid-feed, see Init_Near_For_Frame())
 
         // If ->gotten is set, it usually shouldn't need markeding because
         // it's fetched via f->value and so would be kept alive by it.  Any
@@ -884,12 +909,15 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Sweep_Stub_Segment: C
+//
+// Scans all series nodes (REBSER structs) in one segment of the STUB_POOL.
+// If a series had its lifetime management delegated to the garbage collector
+// with Manage_Series(), then if it didn't get "marked" as live during the
+// marking phase then free it.
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the STUB_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Free units (including the ones just freed) are appended to the pool's free
+// list, which the sweep rebuilds in segment order.  See Start_Sweep().
 //
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -903,102 +931,332 @@ static void Mark_Frame_Stack_Deep(void)
 //    cells a size greater than REBSER size require doing pairings in a
 //    different pool.
 //
-static Count Sweep_Series(void)
+// 3. An incremental recycle marks the series that were unmanaged when it ran
+//    (see Mark_Root_Series()), so that any which become managed before their
+//    segment is swept are not mistaken for garbage.
+//
+static Count Sweep_Stub_Segment(Segment* seg)
 {
     Count sweep_count = 0;
 
-  blockscope {
-    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    Pool* pool = &Mem_Pools[STUB_POOL];
+    Count n = pool->num_units_per_segment;
+    Byte* stub = cast(Byte*, seg + 1);  // byte beats strict alias, see [1]
+
+    for (; n > 0; --n, stub += sizeof(Stub)) {
+        switch (*stub >> 4) {
+          case 0:
+          case 1:  // 0x1
+          case 2:  // 0x2
+          case 3:  // 0x2 + 0x1
+          case 4:  // 0x4
+          case 5:  // 0x4 + 0x1
+          case 6:  // 0x4 + 0x2
+          case 7:  // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (stub);
 
-    for (; seg != nullptr; seg = seg->next) {
-        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
-        Byte* stub = cast(Byte*, seg + 1);  // byte beats strict alias, see [1]
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-        for (; n > 0; --n, stub += sizeof(Stub)) {
-            switch (*stub >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
+          case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            break;
+
+          case 9:
+            // 0x8 + 0x1: marked but not managed.  Marking asserts nodes
+            // are managed, so only an incremental recycle does this.
+            //
+            if (not sweep_incrementally)
                 panic (stub);
+            *stub &= ~NODE_BYTEMASK_0x10_MARKED;  // see [3]
+            break;
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+          case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            if (*stub & NODE_BYTEMASK_0x01_CELL) {
+                assert(not (*stub & NODE_BYTEMASK_0x02_ROOT));
+                Free_Pooled(STUB_POOL, stub);  // Free_Pairing manual
+            }
+            else {
+                REBSER *s = cast(REBSER*, stub);
+                GC_Kill_Series(s);
+            }
+            ++sweep_count;
+            break;
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+          case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark...unless it is tenured,
+            // in which case the mark is kept for the next minor GC.
+            //
+            if (
+                not (*stub & NODE_BYTEMASK_0x01_CELL)
+                and GET_SERIES_FLAG(cast(REBSER*, stub), TENURED)
+            ){
+                break;  // mark_count was adjusted when it was tenured
+            }
+            *stub &= ~NODE_BYTEMASK_0x10_MARKED;
+          #if !defined(NDEBUG)
+            --mark_count;
+          #endif
+            break;
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (stub);
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
 
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*stub & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*stub & NODE_BYTEMASK_0x02_ROOT));
-                    Free_Pooled(STUB_POOL, stub);  // Free_Pairing manual
-                }
-                else {
-                    REBSER *s = cast(REBSER*, stub);
-                    GC_Kill_Series(s);
-                }
-                ++sweep_count;
-                break;
+          case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(*stub == FREED_SERIES_BYTE);
+            break;
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *stub &= ~NODE_BYTEMASK_0x10_MARKED;
-              #if !defined(NDEBUG)
-                --mark_count;
-              #endif
-                break;
+          case 13:
+          case 14:
+          case 15:
+            panic (stub);  // 0x8 + 0x4 + ... reserved for UTF-8
+        }
+
+        if (*stub == FREED_SERIES_BYTE) {  // was free, or just got freed
+            PoolUnit* unit = cast(PoolUnit*, stub);
+            unit->next_if_free = nullptr;
+            if (pool->last)
+                pool->last->next_if_free = unit;
+            else
+                pool->first = unit;
+            pool->last = unit;
+            ++pool->free;
+        }
+    }
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+    return sweep_count;
+}
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*stub == FREED_SERIES_BYTE);
-                break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (stub);  // 0x8 + 0x4 + ... reserved for UTF-8
+//
+//  Start_Sweep: C
+//
+// The sweep rebuilds the STUB_POOL's free list as it goes, so units end up
+// on it only once their segment has been swept.  That way nothing allocated
+// while a sweep is pending can be in a segment the sweep has yet to visit.
+//
+static void Start_Sweep(void)
+{
+    Pool* pool = &Mem_Pools[STUB_POOL];
+    assert(pool->unswept == nullptr);
+
+    pool->first = nullptr;
+    pool->last = nullptr;
+    pool->free = 0;
+    pool->unswept = pool->segments;  // new segments get added at the head
+}
+
+
+//
+//  Sweep_Pending_Segment: C
+//
+// Sweep the next segment of the STUB_POOL that a recycle left unswept.  This
+// is what Try_Alloc_Pooled() does before growing the pool, so a lazy sweep
+// gets paid for by the allocations that need the space.  Returns how many
+// nodes were freed.
+//
+REBLEN Sweep_Pending_Segment(void)
+{
+    Pool* pool = &Mem_Pools[STUB_POOL];
+    assert(pool->unswept);
+
+    Segment* seg = pool->unswept;
+    Count sweep_count = Sweep_Stub_Segment(seg);
+    pool->unswept = seg->next;  // Free_Pooled() links units again if null
+
+    if (pool->unswept == nullptr)
+        CLR_SIGNAL(SIG_SWEEP);
+
+    return sweep_count;
+}
+
+
+//
+//  Sweep_Pending_Series: C
+//
+// Sweep segments of the STUB_POOL that a recycle left unswept, stopping once
+// `budget_usecs` microseconds of processor time are spent (or finishing them
+// all if the budget is 0).  Returns how many nodes were freed.
+//
+// !!! clock() is used because it is standard C and available everywhere the
+// interpreter builds.  It measures processor time, not wall-clock time, but
+// sweeping doesn't block on anything so those should be close.
+//
+REBLEN Sweep_Pending_Series(REBI64 budget_usecs)
+{
+    Pool* pool = &Mem_Pools[STUB_POOL];
+
+    clock_t deadline = 0;
+    if (budget_usecs != 0)
+        deadline = clock() + cast(clock_t,
+            (budget_usecs * CLOCKS_PER_SEC) / 1000000
+        );
+
+    Count sweep_count = 0;
+
+    while (pool->unswept) {
+        sweep_count += Sweep_Pending_Segment();
+
+        if (budget_usecs != 0 and clock() >= deadline)
+            break;
+    }
+
+    // Not SET_SIGNAL(), that would make the evaluator come back on the very
+    // next step.  Let the normal Eval_Countdown bring it back.  (A purely
+    // lazy sweep has no slices, only allocations advance it.)
+    //
+    if (pool->unswept and GC_Sweep_Budget != 0)
+        Eval_Signals |= SIG_SWEEP;
+
+    return sweep_count;
+}
+
+
+//
+//  Clear_Deferred_Sweep_Marks: C
+//
+// Series that were unmanaged when an incremental sweep was deferred got a
+// mark, and if they were managed after their segment was swept they still
+// have it.  That mark would keep the next recycle from marking through
+// them, so it has to be cleared before marking starts.
+//
+static void Clear_Deferred_Sweep_Marks(void)
+{
+    assert(Mem_Pools[STUB_POOL].unswept == nullptr);
+
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Byte* stub = cast(Byte*, seg + 1);
+        Length n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            if ((*stub >> 4) != 11 or (*stub & NODE_BYTEMASK_0x01_CELL))
+                continue;
+            if (GET_SERIES_FLAG(cast(REBSER*, stub), TENURED))
+                continue;
+            *stub &= ~NODE_BYTEMASK_0x10_MARKED;
+        }
+    }
+
+  #if !defined(NDEBUG)
+    mark_count = 0;  // marks set by Defer_Sweep() weren't counted
+  #endif
+
+    sweep_incrementally = false;
+}
+
+
+//
+//  Kill_Unmarked_Symbols: C
+//
+// The symbol hash table doesn't keep symbols alive, so an unmarked symbol
+// that was left for a later sweep slice could be found by an intern of the
+// same spelling and put back into use.  Free them all before deferring.
+//
+static Count Kill_Unmarked_Symbols(void)
+{
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    Symbol(*) *psym = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
+    Symbol(*) *psym_tail = SER_TAIL(Symbol(*), PG_Symbols_By_Hash);
+    for (; psym != psym_tail; ++psym) {  // can't kill while walking table
+        if (*psym == nullptr)
+            continue;
+        if (GET_SERIES_FLAG(*psym, MARKED))
+            continue;
+        if (SER_FULL(GC_Mark_Stack))
+            Extend_Series_If_Necessary(GC_Mark_Stack, 8);
+        *SER_AT(Symbol(*), GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = *psym;
+        SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) + 1);
+    }
+
+    Count sweep_count = SER_USED(GC_Mark_Stack);
+
+    while (SER_USED(GC_Mark_Stack) != 0) {
+        SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1);
+        Symbol(*) symbol = *SER_AT(
+            Symbol(*), GC_Mark_Stack, SER_USED(GC_Mark_Stack)
+        );
+        GC_Kill_Series(m_cast(Raw_Symbol*, symbol));
+    }
+
+    return sweep_count;
+}
+
+
+//
+//  Defer_Sweep: C
+//
+// Set up the sweep so that Sweep_Pending_Series() can do it a slice at a
+// time while the evaluator runs.
+//
+// Marking has to finish in one go, since there is no write barrier to catch
+// an evaluation storing a reference to an unmarked series into one that was
+// already marked.  But once marking is done, garbage stays garbage...so the
+// only hazard is series that get managed between slices.  All series which
+// are unmanaged right now are marked, so anything managed later survives
+// (the sweep clears the mark, and the next recycle judges it).
+//
+static Count Defer_Sweep(void)
+{
+    Start_Sweep();
+    sweep_incrementally = true;
+
+    Count sweep_count = Kill_Unmarked_Symbols();
+
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Byte* stub = cast(Byte*, seg + 1);
+        Length n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            if (
+                (*stub >> 4) == 8  // unmanaged and unmarked
+                and not (*stub & NODE_BYTEMASK_0x01_CELL)
+            ){
+                *stub |= NODE_BYTEMASK_0x10_MARKED;  // not in mark_count
             }
         }
     }
-  }
+
+    if (GC_Sweep_Budget != 0)
+        Eval_Signals |= SIG_SWEEP;  // see Sweep_Pending_Series()
+
+    return sweep_count;
+}
+
+
+//
+//  Sweep_Series: C
+//
+// Sweep all of the STUB_POOL, and the PAIR_POOL if it is separate.
+//
+static Count Sweep_Series(void)
+{
+    Start_Sweep();
+    Count sweep_count = Sweep_Pending_Series(0);
 
   #if UNUSUAL_CELL_SIZE  // pairing pool is separate in this case, see [2]
   blockscope {
@@ -1106,6 +1364,227 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 #endif
 
 
+//=//// GENERATIONAL COLLECTION ///////////////////////////////////////////=//
+//
+// A classic nursery needs a write barrier to notice when an old series gets
+// a reference to a young one.  Cells are written through too many routes in
+// the core for that to be retrofitted reliably.  So the old generation is
+// limited to series that *can't* be written to: frozen arrays, binaries and
+// strings, plus symbols (immutable by construction).
+//
+// After the marking phase of a major recycle, the surviving series which
+// qualify are flagged SERIES_FLAG_TENURED and keep their mark.  Minor
+// recycles then stop marking when they hit a tenured series, so large bodies
+// of static data are not walked again until the next major.  Everything
+// else is effectively the nursery.
+//
+// 1. A series may only be tenured if everything it references is tenured
+//    too (or is never swept, like the canon symbols).  Otherwise a minor
+//    recycle would not reach the referent and would free it.
+//
+// 2. Children are usually tenured before the arrays that contain them, but
+//    the order of stubs in the pool is arbitrary.  A few passes get most of
+//    the nesting; anything left over just gets marked each time, as before.
+//
+
+#define MAX_TENURE_PASSES 8
+
+static bool Is_Node_Tenurable_Referent(const Node* node)  // see [1]
+{
+    if (node == nullptr)
+        return true;
+
+    if (Is_Node_A_Cell(node))
+        return false;  // pairings are never tenured
+
+    const Byte* p = cast(const Byte*, node);
+    if (
+        p >= cast(const Byte*, &PG_Symbol_Canons[1])
+        and p < cast(const Byte*, &PG_Symbol_Canons[ALL_SYMS_MAX])
+    ){
+        return true;  // canon symbols are marked by every recycle
+    }
+
+    if (node == &PG_Inaccessible_Series)
+        return true;
+
+    return GET_SERIES_FLAG(SER(m_cast(Node*, node)), TENURED);
+}
+
+static bool Is_Series_Tenurable(REBSER *s)
+{
+    Flavor flavor = SER_FLAVOR(s);
+    if (
+        flavor != FLAVOR_ARRAY
+        and flavor != FLAVOR_BINARY
+        and flavor != FLAVOR_STRING
+        and flavor != FLAVOR_SYMBOL
+    ){
+        return false;  // contexts, keylists, etc. are mutable or complex
+    }
+
+    if (GET_SERIES_FLAG(s, INFO_NODE_NEEDS_MARK))
+        return false;
+
+    if (flavor != FLAVOR_SYMBOL and NOT_SERIES_INFO(s, FROZEN_SHALLOW))
+        return false;  // could be modified to point at something new
+
+    if (
+        GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK)
+        and not Is_Node_Tenurable_Referent(s->link.any.node)
+    ){
+        return false;
+    }
+
+    if (
+        GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK)
+        and not Is_Node_Tenurable_Referent(s->misc.any.node)
+    ){
+        return false;
+    }
+
+    if (flavor != FLAVOR_ARRAY)
+        return true;
+
+    Cell(const*) tail = ARR_TAIL(ARR(s));
+    Cell(const*) v = ARR_HEAD(ARR(s));
+    for (; v != tail; ++v) {
+        if (IS_TRASH(v))
+            continue;
+
+        if (
+            IS_BINDABLE_KIND(CELL_HEART(v))
+            and not Is_Node_Tenurable_Referent(BINDING(v))
+        ){
+            return false;
+        }
+
+        if (
+            (v->header.bits & CELL_FLAG_FIRST_IS_NODE)
+            and not Is_Node_Tenurable_Referent(VAL_NODE1(v))
+        ){
+            return false;
+        }
+
+        if (
+            (v->header.bits & CELL_FLAG_SECOND_IS_NODE)
+            and not Is_Node_Tenurable_Referent(VAL_NODE2(v))
+        ){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+//
+//  Tenure_Marked_Series: C
+//
+// Run after a major recycle's marking phase, before the sweep.
+//
+static void Tenure_Marked_Series(void)
+{
+    Count pass;
+    for (pass = 0; pass < MAX_TENURE_PASSES; ++pass) {  // see [2]
+        Count tenured = 0;
+
+        Segment* seg = Mem_Pools[STUB_POOL].segments;
+        for (; seg != nullptr; seg = seg->next) {
+            Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+            Byte* stub = cast(Byte*, seg + 1);
+
+            for (; n > 0; --n, stub += sizeof(Stub)) {
+                if ((*stub >> 4) != 11)  // managed and marked (see sweep)
+                    continue;
+                if (*stub & (NODE_BYTEMASK_0x01_CELL | NODE_BYTEMASK_0x02_ROOT))
+                    continue;
+
+                REBSER *s = cast(REBSER*, stub);
+                if (GET_SERIES_FLAG(s, TENURED))
+                    continue;
+
+                if (not Is_Series_Tenurable(s))
+                    continue;
+
+                SET_SERIES_FLAG(s, TENURED);
+                ++tenured;
+              #if !defined(NDEBUG)
+                --mark_count;  // sweep won't clear the mark
+              #endif
+            }
+        }
+
+        if (tenured == 0)
+            break;
+
+        GC_Num_Tenured += tenured;
+    }
+}
+
+
+//
+//  Untenure_All_Series: C
+//
+// A major recycle has to be able to free formerly static data, so it starts
+// by dropping all the sticky marks.
+//
+static void Untenure_All_Series(void)
+{
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        Byte* stub = cast(Byte*, seg + 1);
+
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            if (*stub & (NODE_BYTEMASK_0x40_STALE | NODE_BYTEMASK_0x01_CELL))
+                continue;
+
+            REBSER *s = cast(REBSER*, stub);
+            if (NOT_SERIES_FLAG(s, TENURED))
+                continue;
+
+            CLEAR_SERIES_FLAG(s, TENURED);
+            CLEAR_SERIES_FLAG(s, MARKED);
+        }
+    }
+
+    GC_Num_Tenured = 0;
+}
+
+
+//
+//  Adapt_Ballast: C
+//
+// Instead of always allowing the same number of bytes to be allocated before
+// the next automatic recycle, allow a percentage of what survived this one.
+// Programs with little live data then recycle less often, and programs with
+// a lot of it don't let garbage pile up in proportion to MEM_BALLAST.
+//
+// !!! PG_Mem_Usage counts all memory from Try_Alloc_Mem(), including pool
+// segments that are free.  It's a rough measure of the heap, but it's what
+// the system already tracks.
+//
+static void Adapt_Ballast(REBINT growth_percent)
+{
+    REBI64 live = PG_Mem_Usage;
+    REBI64 ballast = (live / 100) * growth_percent;
+
+    if (ballast < MEM_BALLAST / 8)
+        ballast = MEM_BALLAST / 8;  // don't thrash on tiny heaps
+    if (ballast > INT32_MAX / 2)
+        ballast = INT32_MAX / 2;  // GC_Ballast is a REBINT
+
+    if (ballast > GC_Adapted_Ballast)
+        ++GC_Ballast_Grows;
+    else if (ballast < GC_Adapted_Ballast)
+        ++GC_Ballast_Shrinks;
+
+    GC_Adapted_Ballast = cast(REBINT, ballast);
+    GC_Ballast = GC_Adapted_Ballast;
+}
+
+
 //
 //  Recycle_Core: C
 //
@@ -1140,14 +1619,56 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     GC_Recycling = true;
   #endif
 
+    // A previous recycle may have left part of its sweep to be done later.
+    // The marks it left have to be gone before this one can start.
+    //
+    REBLEN pending_count = 0;
+    if (Mem_Pools[STUB_POOL].unswept)
+        pending_count = Sweep_Pending_Series(0);
+    if (sweep_incrementally)
+        Clear_Deferred_Sweep_Marks();
+
     ASSERT_NO_GC_MARKS_PENDING();
 
+    // Shared function bodies, keylist shapes and cached lookups in keylists
+    // are remembered without keeping anything alive, so forget them all
+    // before anything they point to can be swept.
+    //
+    memset(TG_Body_Cache, 0, sizeof(TG_Body_Cache));
+    memset(TG_Shape_Cache, 0, sizeof(TG_Shape_Cache));
+    memset(TG_Field_Cache, 0, sizeof(TG_Field_Cache));
+    memset(TG_Pick_Cache, 0, sizeof(TG_Pick_Cache));
+    memset(TG_Compose_Cache, 0, sizeof(TG_Compose_Cache));
+    memset(TG_Combinator_Cache, 0, sizeof(TG_Combinator_Cache));
+
+    // A minor recycle leaves the tenured series marked, so marking does not
+    // descend into them.  Shutdown and sweeplist requests must see everything.
+    //
+    bool major = (
+        shutdown
+        or sweeplist != nullptr
+        or GC_Generational == 0
+        or GC_Minors_Since_Major >= GC_Generational
+    );
+    if (major) {
+        if (GC_Num_Tenured != 0)
+            Untenure_All_Series();
+        GC_Minors_Since_Major = 0;
+        ++GC_Major_Count;
+    }
+    else {
+        ++GC_Minors_Since_Major;
+        ++GC_Minor_Count;
+    }
+
   #if DEBUG_COLLECT_STATS
     PG_Reb_Stats->Recycle_Counter++;
     PG_Reb_Stats->Recycle_Series = Mem_Pools[STUB_POOL].free;
     PG_Reb_Stats->Mark_Count = 0;
   #endif
 
+    TRACEPOINT2(gc__begin, major, shutdown);
+
     if (not shutdown)
         Mark_Symbol_Series();
 
@@ -1192,7 +1713,7 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         Symbol(*) *psym = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
         Symbol(*) *psym_tail = SER_TAIL(Symbol(*), PG_Symbols_By_Hash);
         for (; psym != psym_tail; ++psym) {
-            if (*psym == nullptr or *psym == &PG_Deleted_Symbol)
+            if (*psym == nullptr)
                 continue;
             REBSER *patch = MISC(Hitch, *psym);
             for (; patch != *psym; patch = SER(node_MISC(Hitch, patch))) {
@@ -1227,6 +1748,9 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    if (major and not shutdown and GC_Generational != 0)
+        Tenure_Marked_Series();
+
     // Note: We do not need to mark the PG_Inaccessible_Series, because it is
     // not subject to GC and no one should mark it.  Make sure that's true.
     //
@@ -1241,9 +1765,13 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         sweep_count = Fill_Sweeplist(sweeplist);
     #endif
     }
+    else if ((GC_Sweep_Budget != 0 or GC_Lazy_Sweep) and not shutdown)
+        sweep_count = Defer_Sweep();
     else
         sweep_count = Sweep_Series();
 
+    sweep_count += pending_count;
+
     // Unmark the Lib() fixed patches
     //
     for (REBLEN i = 1; i < LIB_SYMS_MAX; ++i) {
@@ -1269,7 +1797,8 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     }
 
    #if !defined(NDEBUG)
-     assert(mark_count == 0);  // should balance out
+     if (not sweep_incrementally)
+        assert(mark_count == 0);  // should balance out
    #endif
 
   #if DEBUG_COLLECT_STATS
@@ -1291,8 +1820,16 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // Reverted to the R3-Alpha state, accommodating a comment "do not adjust
     // task variables or boot strings in shutdown when they are being freed."
     //
-    if (not shutdown)
-        GC_Ballast = TG_Ballast;
+    if (not shutdown) {
+        REBINT growth = 0;
+        if (PG_Boot_Phase >= BOOT_DONE and TG_Ballast != 0)  // 0 is torture
+            growth = Get_System_Int(SYS_OPTIONS, OPTIONS_GC_GROWTH, 0);
+
+        if (growth > 0)
+            Adapt_Ballast(growth);
+        else
+            GC_Ballast = TG_Ballast;
+    }
 
     ASSERT_NO_GC_MARKS_PENDING();
 
@@ -1300,6 +1837,8 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     GC_Recycling = false;
   #endif
 
+    TRACEPOINT2(gc__end, sweep_count, major);
+
   #if !defined(NDEBUG)
     //
     // This might be an interesting feature for release builds, but using
@@ -1400,6 +1939,31 @@ void Startup_GC(void)
     assert(not GC_Recycling);
 
     GC_Ballast = MEM_BALLAST;
+    GC_Adapted_Ballast = MEM_BALLAST;  // see system.options.gc-growth
+    GC_Ballast_Grows = 0;
+    GC_Ballast_Shrinks = 0;
+
+    GC_Generational = 0;  // opt-in, see RECYCLE/GENERATIONAL
+    GC_Minors_Since_Major = 0;
+    GC_Num_Tenured = 0;
+    GC_Minor_Count = 0;
+    GC_Major_Count = 0;
+
+    GC_Sweep_Budget = 0;  // atomic sweeps, see RECYCLE/SLICE
+    GC_Lazy_Sweep = false;  // see RECYCLE/LAZY
+
+    // Entries are only valid with the current epoch, which is never zero
+    // (the GC frees the LETs and USEs that the entries are keyed on).
+    //
+    memset(TG_Virtual_Cache, 0, sizeof(TG_Virtual_Cache));
+    TG_Virtual_Cache_Epoch = 1;
+
+    memset(TG_Body_Cache, 0, sizeof(TG_Body_Cache));  // see BODY_CACHE_SIZE
+    memset(TG_Shape_Cache, 0, sizeof(TG_Shape_Cache));  // see SHAPE_CACHE_SIZE
+    memset(TG_Field_Cache, 0, sizeof(TG_Field_Cache));
+    memset(TG_Pick_Cache, 0, sizeof(TG_Pick_Cache));
+    memset(TG_Compose_Cache, 0, sizeof(TG_Compose_Cache));
+    memset(TG_Combinator_Cache, 0, sizeof(TG_Combinator_Cache));
 
     // Temporary series and values protected from GC. Holds node pointers.
     //
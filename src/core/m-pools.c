@@ -171,6 +171,143 @@ void Free_Mem(void *mem, size_t size)
 }
 
 
+#if TO_WINDOWS
+    #undef IS_ERROR  // windows has its own meaning for this.
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+#endif
+
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)  // typical x86-64 and ARM64 size
+#define OS_PAGE_SIZE 4096  // only used for rounding, larger pages are fine
+
+
+//
+//  Try_Alloc_Big_Mem: C
+//
+// Pool segments and series data too large for a pool come from here, so
+// they can be mapped from the OS directly (preferring huge pages) if that
+// was requested at startup.  Walking gigabytes of series then needs far
+// fewer TLB entries.  See R3_HUGE_PAGES in Startup_Pools().
+//
+// The mapped length is cached just ahead of the memory handed back, with 0
+// meaning it was an ordinary allocation.  That way Free_Big_Mem() can undo
+// whatever actually happened, including fallbacks when huge pages were not
+// available.
+//
+void *Try_Alloc_Big_Mem(size_t size)
+{
+    if (not PG_Huge_Pages or size < HUGE_MIN_ALLOC) {
+        char *p = TRY_ALLOC_N(char, size + ALIGN_SIZE);
+        if (not p)
+            return nullptr;
+        *cast(REBI64*, p) = 0;  // not mapped
+        return p + ALIGN_SIZE;
+    }
+
+    size_t len = size + ALIGN_SIZE;
+    void *mapped = nullptr;
+
+  #if TO_WINDOWS
+    SIZE_T large = GetLargePageMinimum();  // 0 if not supported
+    if (large != 0) {
+        size_t large_len = (len + large - 1) / large * large;
+        if (large_len - len <= len / 8) {  // don't waste more than 1/8th
+            mapped = VirtualAlloc(
+                nullptr,
+                large_len,
+                MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                PAGE_READWRITE
+            );
+            if (mapped)
+                len = large_len;
+        }
+    }
+    if (not mapped) {  // needs SeLockMemoryPrivilege, so often not allowed
+        len = (len + OS_PAGE_SIZE - 1) / OS_PAGE_SIZE * OS_PAGE_SIZE;
+        mapped = VirtualAlloc(
+            nullptr, len, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE
+        );
+    }
+  #else
+    #if defined(MAP_HUGETLB)
+    size_t huge_len = (len + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE
+        * HUGE_PAGE_SIZE;
+    if (huge_len - len <= len / 8) {  // don't waste more than 1/8th
+        void *p = mmap(
+            nullptr,
+            huge_len,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+            -1,
+            0
+        );
+        if (p != MAP_FAILED) {  // fails if no huge pages are reserved
+            mapped = p;
+            len = huge_len;
+        }
+    }
+    #endif
+    if (not mapped) {
+        len = (len + OS_PAGE_SIZE - 1) / OS_PAGE_SIZE * OS_PAGE_SIZE;
+        void *p = mmap(
+            nullptr,
+            len,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0
+        );
+        if (p != MAP_FAILED) {
+            mapped = p;
+          #if defined(MADV_HUGEPAGE)
+            madvise(mapped, len, MADV_HUGEPAGE);  // transparent huge pages
+          #endif
+        }
+    }
+  #endif
+
+    if (not mapped) {  // fall back on an ordinary allocation
+        char *p = TRY_ALLOC_N(char, size + ALIGN_SIZE);
+        if (not p)
+            return nullptr;
+        *cast(REBI64*, p) = 0;
+        return p + ALIGN_SIZE;
+    }
+
+    PG_Mem_Usage += size;  // mirror Try_Alloc_Mem() accounting
+
+    *cast(REBI64*, mapped) = len;
+    return cast(char*, mapped) + ALIGN_SIZE;
+}
+
+
+//
+//  Free_Big_Mem: C
+//
+// Release memory from Try_Alloc_Big_Mem(), which needs the same `size`.
+//
+void Free_Big_Mem(void *mem, size_t size)
+{
+    char *p = cast(char*, mem) - ALIGN_SIZE;
+    REBI64 len = *cast(REBI64*, p);
+
+    if (len == 0) {
+        FREE_N(char, size + ALIGN_SIZE, p);
+        return;
+    }
+
+  #if TO_WINDOWS
+    VirtualFree(p, 0, MEM_RELEASE);
+  #else
+    munmap(p, cast(size_t, len));
+  #endif
+
+    PG_Mem_Usage -= size;
+}
+
+
 /***********************************************************************
 **
 **  MEMORY POOLS
@@ -255,6 +392,16 @@ void Startup_Pools(REBINT scale)
     }
   #endif
 
+    // Mapping big allocations from the OS is opt-in, as huge pages can be a
+    // loss for small heaps (and need setup from the system administrator).
+    //
+    PG_Huge_Pages = false;
+  blockscope {
+    const char *env_huge_pages = getenv("R3_HUGE_PAGES");
+    if (env_huge_pages and atoi(env_huge_pages) != 0)
+        PG_Huge_Pages = true;
+  }
+
     REBINT unscale = 1;
     if (scale == 0)
         scale = 1;
@@ -291,6 +438,9 @@ void Startup_Pools(REBINT scale)
             Mem_Pools[n].num_units_per_segment = 2;
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
+        Mem_Pools[n].unswept = nullptr;
+        Mem_Pools[n].high_water = 0;
+        Mem_Pools[n].num_allocs = 0;
     }
 
     // For pool lookup. Maps size to pool index. (See Find_Pool below)
@@ -392,7 +542,7 @@ void Shutdown_Pools(void)
         Segment* seg = pool->segments;
         while (seg) {
             Segment* next = seg->next;
-            FREE_N(char, mem_size, cast(char*, seg));
+            Free_Big_Mem(seg, mem_size);
             seg = next;
         }
     }
@@ -445,7 +595,7 @@ bool Try_Fill_Pool(Pool* pool)
     REBLEN num_units = pool->num_units_per_segment;
     REBLEN mem_size = pool->wide * num_units + sizeof(Segment);
 
-    Segment* seg = cast(Segment*, TRY_ALLOC_N(char, mem_size));
+    Segment* seg = cast(Segment*, Try_Alloc_Big_Mem(mem_size));
     if (seg == nullptr)
         return false;
 
@@ -485,6 +635,157 @@ bool Try_Fill_Pool(Pool* pool)
 }
 
 
+static int Compare_Segment_Addresses(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+    uintptr_t a1 = i_cast(uintptr_t, *cast(Segment* const*, v1));
+    uintptr_t a2 = i_cast(uintptr_t, *cast(Segment* const*, v2));
+    return a1 < a2 ? -1 : (a1 > a2 ? 1 : 0);
+}
+
+// Index of the last segment (sorted by address) starting at or before `p`.
+//
+static Count Find_Segment_Index(Segment** segs, Count num_segs, void* p)
+{
+    Count lo = 0;
+    Count hi = num_segs;
+    while (hi - lo > 1) {
+        Count mid = (lo + hi) / 2;
+        if (cast(Byte*, segs[mid]) <= cast(Byte*, p))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+//
+//  Shrink_Pool: C
+//
+// Release any segments of a pool whose units are all on the free list.
+// Returns the number of segments released.
+//
+// Whether a unit is free can't be read from the unit itself (a series data
+// unit can start with any byte), so the free list is what's authoritative.
+// Each free unit is tallied against its segment, found by binary search of
+// the segments sorted by address.
+//
+Count Shrink_Pool(PoolID pool_id)
+{
+    Pool* pool = &Mem_Pools[pool_id];
+
+    if (pool->unswept)  // sweep is rebuilding the free list, can't trust it
+        return 0;
+
+    if (pool->free < pool->num_units_per_segment)
+        return 0;  // can't possibly have a segment with no units in use
+
+    Count num_segs = 0;
+    Segment* seg;
+    for (seg = pool->segments; seg != nullptr; seg = seg->next)
+        ++num_segs;
+
+    Segment** segs = TRY_ALLOC_N(Segment*, num_segs);
+    if (segs == nullptr)
+        return 0;
+    Count* counts = TRY_ALLOC_N_ZEROFILL(Count, num_segs);
+    if (counts == nullptr) {
+        FREE_N(Segment*, num_segs, segs);
+        return 0;
+    }
+
+    Count i = 0;
+    for (seg = pool->segments; seg != nullptr; seg = seg->next)
+        segs[i++] = seg;
+
+    reb_qsort_r(
+        segs, num_segs, sizeof(Segment*), nullptr, &Compare_Segment_Addresses
+    );
+
+  #if !defined(NDEBUG)
+    Size units_size = pool->wide * pool->num_units_per_segment;
+  #endif
+
+    PoolUnit* unit = pool->first;
+    for (; unit != nullptr; unit = unit->next_if_free) {
+        Count i_seg = Find_Segment_Index(segs, num_segs, unit);
+        assert(cast(Byte*, unit) >= cast(Byte*, segs[i_seg] + 1));
+        assert(cast(Byte*, unit) < cast(Byte*, segs[i_seg] + 1) + units_size);
+        ++counts[i_seg];
+    }
+
+    Count num_released = 0;
+    for (i = 0; i < num_segs; ++i)
+        if (counts[i] == pool->num_units_per_segment)
+            ++num_released;
+
+    if (num_released != 0) {
+        //
+        // Drop the units of the released segments from the free list,
+        // leaving the others in the order they were in.
+        //
+        PoolUnit* first = nullptr;
+        PoolUnit* last = nullptr;
+        for (unit = pool->first; unit != nullptr; unit = unit->next_if_free) {
+            Count i_seg = Find_Segment_Index(segs, num_segs, unit);
+            if (counts[i_seg] == pool->num_units_per_segment)
+                continue;
+
+            if (last)
+                last->next_if_free = unit;
+            else
+                first = unit;
+            last = unit;
+        }
+        if (last)
+            last->next_if_free = nullptr;
+        pool->first = first;
+        pool->last = last;
+
+        // Unlink the released segments and give their memory back.
+        //
+        Segment** link = &pool->segments;
+        while (*link) {
+            seg = *link;
+            Count i_seg = Find_Segment_Index(segs, num_segs, seg);
+            assert(segs[i_seg] == seg);
+            if (counts[i_seg] != pool->num_units_per_segment) {
+                link = &seg->next;
+                continue;
+            }
+            *link = seg->next;
+            pool->free -= pool->num_units_per_segment;
+            pool->has -= pool->num_units_per_segment;
+            Free_Big_Mem(seg, seg->size);
+        }
+    }
+
+    FREE_N(Count, num_segs, counts);
+    FREE_N(Segment*, num_segs, segs);
+
+    PG_Segments_Released += num_released;
+    return num_released;
+}
+
+
+//
+//  Shrink_Pools: C
+//
+// Run Shrink_Pool() on all the pools, see RECYCLE/SHRINK.
+//
+Count Shrink_Pools(void)
+{
+    Count num_released = 0;
+
+    PoolID pool_id;
+    for (pool_id = 0; pool_id < MAX_POOLS; ++pool_id)
+        num_released += Shrink_Pool(pool_id);
+
+    return num_released;
+}
+
+
 #if DEBUG_FANCY_PANIC
 
 //
@@ -637,6 +938,104 @@ void Free_Pairing(REBVAL *paired) {
 }
 
 
+//
+//  Alloc_Frame_Scratch: C
+//
+// Get memory that will be freed automatically when the frame is dropped,
+// whether it finishes normally or is unwound by a fail().  The memory is
+// bump-allocated from chunks owned by the frame, so it's cheap to get and
+// there's no way to free individual allocations.
+//
+void *Alloc_Frame_Scratch(Frame(*) f, Size size)
+{
+    size = ALIGN(size, ALIGN_SIZE);
+
+    ScratchChunk* chunk = f->scratch;
+    if (chunk == nullptr or chunk->size - chunk->used < size) {
+        Size chunk_size = size > SCRATCH_CHUNK_SIZE ? size : SCRATCH_CHUNK_SIZE;
+        chunk = cast(ScratchChunk*, TRY_ALLOC_N(
+            char, ALIGN(sizeof(ScratchChunk), ALIGN_SIZE) + chunk_size
+        ));
+        if (chunk == nullptr)
+            fail (Error_No_Memory(chunk_size));
+
+        chunk->size = chunk_size;
+        chunk->used = 0;
+
+        if (f->scratch and size > SCRATCH_CHUNK_SIZE) {  // keep current chunk
+            chunk->prior = f->scratch->prior;
+            f->scratch->prior = chunk;
+            chunk->used = size;
+            return cast(char*, chunk) + ALIGN(sizeof(ScratchChunk), ALIGN_SIZE);
+        }
+
+        chunk->prior = f->scratch;
+        f->scratch = chunk;
+    }
+
+    char *p = cast(char*, chunk) + ALIGN(sizeof(ScratchChunk), ALIGN_SIZE)
+        + chunk->used;
+    chunk->used += size;
+    return p;
+}
+
+
+//
+//  Free_Frame_Scratch: C
+//
+// Release all of a frame's scratch chunks, done by Drop_Frame().
+//
+void Free_Frame_Scratch(Frame(*) f)
+{
+    ScratchChunk* chunk = f->scratch;
+    while (chunk) {
+        ScratchChunk* prior = chunk->prior;
+        FREE_N(
+            char,
+            ALIGN(sizeof(ScratchChunk), ALIGN_SIZE) + chunk->size,
+            cast(char*, chunk)
+        );
+        chunk = prior;
+    }
+    f->scratch = nullptr;
+}
+
+
+//
+//  Make_Scratch_Series: C
+//
+// Make an unmanaged series whose stub and data both come from the frame's
+// scratch memory.  It's not in the STUB_POOL (so the GC never sees it) and
+// not in GC_Manuals, which means it must not be referenced from anything the
+// GC marks, and it must not be freed with Free_Unmanaged_Series().  It is
+// SERIES_FLAG_FIXED_SIZE, so it is never reallocated.
+//
+REBSER *Make_Scratch_Series(Frame(*) f, REBLEN capacity, Flags flags)
+{
+    assert(not (flags & NODE_FLAG_MANAGED));
+
+    size_t wide = Wide_For_Flavor(cast(Flavor, FLAVOR_BYTE(flags)));
+    if (cast(REBU64, capacity) * wide > INT32_MAX)
+        fail (Error_No_Memory(cast(REBU64, capacity) * wide));
+
+    Stub* s = Prep_Stub(
+        Alloc_Frame_Scratch(f, sizeof(Stub)),
+        flags | SERIES_FLAG_DYNAMIC | SERIES_FLAG_FIXED_SIZE
+    );
+    SER_INFO(s) = SERIES_INFO_MASK_NONE;
+
+    s->content.dynamic.data = cast(char*,
+        Alloc_Frame_Scratch(f, capacity * wide)
+    );
+    if (IS_SER_BIASED(s))
+        s->content.dynamic.bonus.bias = 0;
+    s->content.dynamic.rest = capacity;
+    s->content.dynamic.used = 0;
+
+    return s;
+}
+
+
 //
 //  Free_Unbiased_Series_Data: C
 //
@@ -674,7 +1073,7 @@ void Free_Unbiased_Series_Data(char *unbiased, Size total)
         mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
     }
     else {
-        FREE_N(char, total, unbiased);
+        Free_Big_Mem(unbiased, total);
         Mem_Pools[SYSTEM_POOL].has -= total;
         Mem_Pools[SYSTEM_POOL].free++;
     }
@@ -701,8 +1100,12 @@ void Free_Unbiased_Series_Data(char *unbiased, Size total)
 // If the series has enough space within it, then it will be used,
 // otherwise the series data will be reallocated.
 //
-// When expanded at the head, if bias space is available, it will
-// be used (if it provides enough space).
+// When expanded anywhere in the front half, if bias space is available, it
+// will be used (if it provides enough space) by sliding the part before the
+// index back into the bias--which moves less than sliding the rest forward.
+// When such expansions have to move data anyway, they leave some bias for
+// the next one--so repeated INSERTs near the head of a big series (e.g. a
+// block used as a queue) don't each have to move the whole thing.
 //
 // !!! It seems the original intent of this routine was
 // to be used with a group of other routines that were "Noterm"
@@ -734,17 +1137,26 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     if (delta == 0)
         return;
 
+    TRACEPOINT3(series__expand, s, SER_USED(s), delta);
+
     REBLEN used_old = SER_USED(s);
 
     Byte wide = SER_WIDE(s);
 
     const bool was_dynamic = GET_SERIES_FLAG(s, DYNAMIC);
 
-    if (was_dynamic and index == 0 and SER_BIAS(s) >= delta) {
+    bool near_head = (index <= used_old - index);
+
+    if (was_dynamic and near_head and SER_BIAS(s) >= delta) {
 
     //=//// HEAD INSERTION OPTIMIZATION ///////////////////////////////////=//
 
         s->content.dynamic.data -= wide * delta;
+        memmove(
+            s->content.dynamic.data,
+            s->content.dynamic.data + wide * delta,
+            wide * index
+        );
         s->content.dynamic.used += delta;
         s->content.dynamic.rest += delta;
         SER_SUB_BIAS(s, delta);
@@ -760,8 +1172,9 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
             // !!! The unsettable feature is currently not implemented,
             // but when it is this will be useful.
             //
-            for (index = 0; index < delta; index++)
-                Erase_Cell(ARR_AT(ARR(s), index));
+            REBLEN n;
+            for (n = 0; n < delta; ++n)
+                Erase_Cell(ARR_AT(ARR(s), index + n));
         }
       #endif
         ASSERT_SERIES_TERM_IF_NEEDED(s);
@@ -774,6 +1187,13 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     REBLEN extra = delta * wide;
     REBLEN size = SER_USED(s) * wide;
 
+    // Expansions near the head leave bias for the next one, if the space is
+    // there.  (It's kept small, like the bias left by head removals, so a
+    // later removal doesn't have to call Unbias_Series().)  Varlists can't
+    // be biased, see IS_SER_BIASED().
+    //
+    bool leave_bias = near_head and index < used_old and not IS_VARLIST(s);
+
     // + wide for terminator
     if ((size + extra + wide) <= SER_REST(s) * SER_WIDE(s)) {
         //
@@ -782,12 +1202,25 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
         // separately with TERM_SERIES (in case it reaches an implicit
         // termination that is not a full-sized cell).
 
+        REBLEN bias = 0;
+        if (leave_bias and was_dynamic and SER_BIAS(s) < MAX_SERIES_BIAS / 2)
+            bias = MIN(
+                (SER_REST(s) - used_old - delta - 1) / 2,
+                MAX_SERIES_BIAS / 2 - SER_BIAS(s)
+            );
+
         UNPOISON_SERIES_TAIL(s);
         memmove(
-            SER_DATA(s) + start + extra,
+            SER_DATA(s) + wide * bias + start + extra,
             SER_DATA(s) + start,
             size - start
         );
+        if (bias != 0) {  // suffix moved first, it's further forward
+            memmove(SER_DATA(s) + wide * bias, SER_DATA(s), start);
+            s->content.dynamic.data += wide * bias;
+            s->content.dynamic.rest -= bias;
+            SER_ADD_BIAS(s, bias);
+        }
         Set_Series_Used_Internal(s, used_old + delta);
         POISON_SERIES_TAIL(s);
 
@@ -891,6 +1324,17 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     if (n_found >= MAX_EXPAND_LIST)
         Prior_Expand[n_available] = s;
 
+    REBLEN bias = 0;
+    if (leave_bias) {
+        bias = MIN(
+            (s->content.dynamic.rest - used_old - delta - 1) / 2,
+            MAX_SERIES_BIAS / 2
+        );
+        s->content.dynamic.data += wide * bias;
+        s->content.dynamic.rest -= bias;
+        SER_SET_BIAS(s, bias);
+    }
+
     // Copy the series up to the expansion point
     //
     memcpy(s->content.dynamic.data, data_old, start);
@@ -908,7 +1352,7 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
         //
         // We have to de-bias the data pointer before we can free it.
         //
-        assert(SER_BIAS(s) == 0); // should be reset
+        assert(SER_BIAS(s) == bias);  // should be reset
         Free_Unbiased_Series_Data(data_old - (wide * bias_old), size_old);
     }
 
@@ -916,7 +1360,10 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     PG_Reb_Stats->Series_Expanded++;
   #endif
 
-    assert(NOT_SERIES_FLAG(s, MARKED));
+    assert(
+        NOT_SERIES_FLAG(s, MARKED)
+        or Mem_Pools[STUB_POOL].unswept  // survivor, mark not yet cleared
+    );
     TERM_SERIES_IF_NECESSARY(s);  // code will not copy terminator over
 }
 
@@ -1125,6 +1572,11 @@ void Decay_Series(REBSER *s)
         //
         break;
 
+      case FLAVOR_KEYLIST:
+        if (Get_Subclass_Flag(KEYLIST, s, INDEXED))
+            Free_Keylist_Index(cast(Raw_Keylist*, s));
+        break;
+
       case FLAVOR_HANDLE: {
         Cell(*) v = ARR_SINGLE(ARR(s));
         assert(CELL_HEART_UNCHECKED(v) == REB_HANDLE);
@@ -1147,7 +1599,10 @@ void Decay_Series(REBSER *s)
         if (Prior_Expand[n] == s) Prior_Expand[n] = 0;
     }
 
-    if (GET_SERIES_FLAG(s, DYNAMIC)) {
+    if (GET_SERIES_INFO(s, EXTERNAL_DATA)) {
+        Release_External_Data(s);  // e.g. munmap(), not a pool free
+    }
+    else if (GET_SERIES_FLAG(s, DYNAMIC)) {
         Byte wide = SER_WIDE(s);
         REBLEN bias = SER_BIAS(s);
         REBLEN total = (bias + SER_REST(s)) * wide;
@@ -1203,6 +1658,9 @@ void GC_Kill_Series(REBSER *s)
     //
     TOUCH_STUB_IF_DEBUG(s);
 
+    if (IS_LET(s) or IS_USE(s))  // address could be reused for a new chain
+        Invalidate_Virtual_Cache();
+
     if (NOT_SERIES_FLAG(s, INACCESSIBLE))
         Decay_Series(s);
 
@@ -54,6 +54,15 @@ void Extend_Series_If_Necessary(REBSER *s, REBLEN delta)
 // middle of a UTF-8 codepoint, hence a string series aliased as a binary
 // could only have its copy used in a BINARY!.
 //
+// !!! It has been suggested that copies could share the source's data until
+// one side is modified ("copy-on-write").  But there's no write barrier to
+// fault in a private copy: the series accessors hand out raw data pointers
+// (including to extensions through the API), and plenty of internal code
+// writes through them without going through Ensure_Mutable().  The stub also
+// has no spare field to reference-count shared data, so the GC would need a
+// new way to know when it can be freed.  Code that only reads an input
+// should take it as-is (possibly CONST) instead of COPYing it.
+//
 REBSER *Copy_Series_Core(const REBSER *s, Flags flags)
 {
     assert(not IS_SER_ARRAY(s));
@@ -214,6 +223,28 @@ void Remove_Series_Units(REBSER *s, Size byteoffset, REBLEN quantity)
         return;
     }
 
+    // Removals in the front half of a dynamic series slide the part before
+    // the removal forward and add it to the bias, instead of sliding the
+    // (bigger) part after it back.  Only do it while that stays under the
+    // bias limits that make a head removal call Unbias_Series().
+    //
+    if (
+        is_dynamic
+        and IS_SER_BIASED(s)
+        and byteoffset <= used_old - (byteoffset + quantity)
+        and SER_BIAS(s) + quantity < MAX_SERIES_BIAS
+        and SER_BIAS(s) + quantity <= SER_REST(s) - quantity
+    ){
+        Byte* head = SER_DATA(s);
+        memmove(head + (quantity * SER_WIDE(s)), head, start);
+
+        s->content.dynamic.data += SER_WIDE(s) * quantity;
+        s->content.dynamic.rest -= quantity;
+        SER_ADD_BIAS(s, quantity);
+        s->content.dynamic.used -= quantity;
+        return;
+    }
+
     REBLEN total = SER_USED(s) * SER_WIDE(s);
 
     Byte* data = SER_DATA(s) + start;
@@ -284,6 +315,105 @@ void Unbias_Series(REBSER *s, bool keep)
 }
 
 
+//=//// EXTERNAL DATA ////////////////////////////////////////////////////=//
+//
+// Series normally own their data, allocated from the pools.  A BINARY! may
+// instead wrap data from elsewhere--e.g. a memory-mapped file, which can be
+// read without first copying it all into memory.  Such series are rare and
+// there may be only a few alive, so the release functions are kept in a
+// simple list searched when a series with SERIES_INFO_EXTERNAL_DATA dies.
+//
+
+struct Reb_External_Data {
+    REBSER *series;
+    void *base;  // start of the span, may be before the series head
+    Size size;  // may be larger than the series length (e.g. page rounding)
+    EXTERNAL_RELEASER *releaser;
+    struct Reb_External_Data *next;
+};
+
+static struct Reb_External_Data *External_Data_List = nullptr;
+
+
+//
+//  Make_Binary_External: C
+//
+// Make a managed, frozen BINARY! series of `len` bytes at `data`, which lie
+// inside a span of `size` bytes at `base`.  The releaser is called with
+// (base, size) when the GC frees the series.
+//
+// The byte at `data[len]` must be inside the span and be 0, so the series is
+// terminated like any other (and can be aliased AS TEXT!).
+//
+Binary(*) Make_Binary_External(
+    Byte* data,
+    Size len,
+    void *base,
+    Size size,
+    EXTERNAL_RELEASER *releaser
+){
+    assert(data >= cast(Byte*, base));
+    assert(data + len < cast(Byte*, base) + size);
+    assert(data[len] == '\0');
+
+    if (len > INT32_MAX)
+        fail (Error_No_Memory(len));
+
+    struct Reb_External_Data *ext = TRY_ALLOC(struct Reb_External_Data);
+    if (not ext)
+        fail (Error_No_Memory(sizeof(struct Reb_External_Data)));
+
+    Binary(*) bin = Make_Binary_Core(0, NODE_FLAG_MANAGED);
+    assert(NOT_SERIES_FLAG(bin, DYNAMIC));  // nothing to free
+
+    SET_SERIES_FLAG(bin, DYNAMIC);
+    SET_SERIES_FLAG(bin, FIXED_SIZE);  // Expand_Series() can't realloc this
+    bin->content.dynamic.data = cast(char*, data);
+    bin->content.dynamic.bonus.bias = 0;
+    bin->content.dynamic.rest = len + 1;
+    bin->content.dynamic.used = len;
+
+    SET_SERIES_INFO(bin, EXTERNAL_DATA);
+    Freeze_Series(bin);
+
+    ext->series = bin;
+    ext->base = base;
+    ext->size = size;
+    ext->releaser = releaser;
+    ext->next = External_Data_List;
+    External_Data_List = ext;
+
+    return bin;
+}
+
+
+//
+//  Release_External_Data: C
+//
+// Called by Decay_Series() in lieu of freeing the data from the pools.
+//
+void Release_External_Data(REBSER *s)
+{
+    assert(GET_SERIES_INFO(s, EXTERNAL_DATA));
+
+    struct Reb_External_Data **link = &External_Data_List;
+    for (; *link != nullptr; link = &(*link)->next) {
+        struct Reb_External_Data *ext = *link;
+        if (ext->series != s)
+            continue;
+
+        *link = ext->next;
+        (ext->releaser)(ext->base, ext->size);
+        FREE(struct Reb_External_Data, ext);
+
+        s->content.dynamic.data = nullptr;
+        return;
+    }
+
+    panic (s);  // flagged series with no registered releaser
+}
+
+
 //
 //  Reset_Array: C
 //
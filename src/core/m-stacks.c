@@ -116,11 +116,19 @@ void Shutdown_Feeds(void) {
 //    API handles for things that come into existence at boot and aren't freed
 //    until shutdown, as they attach to this frame.
 //
+// 3. Frames are handed out from this chunk in LIFO order before falling back
+//    on FRAME_POOL, see Alloc_Frame().
+//
 void Startup_Frame_Stack(void)
 {
     assert(TG_Top_Frame == nullptr);
     assert(TG_Bottom_Frame == nullptr);
 
+    TG_Frame_Chunk = TRY_ALLOC_N(struct Reb_Frame, FRAME_CHUNK_COUNT);  // [3]
+    if (TG_Frame_Chunk == nullptr)
+        panic ("Could not allocate frame chunk");
+    TG_Frame_Chunk_Top = 0;
+
     Frame(*) f = Make_End_Frame(FRAME_MASK_NONE);  // ensure f->prior, see [1]
     Push_Frame(nullptr, f);  // global API handles attach here, see [2]
 
@@ -159,6 +167,22 @@ void Shutdown_Frame_Stack(void)
     TG_Top_Frame = nullptr;
     TG_Bottom_Frame = nullptr;
 
+    if (TG_Frame_Chunk_Top != 0) {  // frames in the chunk weren't all freed
+      #if DEBUG_COUNT_TICKS
+        printf(
+            "** FRAME LEAKED at tick %lu\n",
+            cast(unsigned long, TG_Frame_Chunk[TG_Frame_Chunk_Top - 1].tick)
+        );
+      #else
+        assert(!"** FRAME LEAKED but DEBUG_COUNT_TICKS not enabled");
+      #endif
+    }
+    FREE_N(struct Reb_Frame, FRAME_CHUNK_COUNT, TG_Frame_Chunk);
+    TG_Frame_Chunk = nullptr;
+
+    Free_Spare_Varlists();  // before the pools check for leaked stubs
+    Free_Spare_Loop_Each_States();
+
   #if !defined(NDEBUG)
   blockscope {
     Segment* seg = Mem_Pools[FRAME_POOL].segments;
@@ -286,6 +310,16 @@ void Expand_Data_Stack_May_Fail(REBLEN amount)
         == cast(int, len_old)
     );
 
+    // Grow by at least the current length.  Pushes like the ones from a
+    // REDUCE or COMPOSE of a huge block come in one at a time, and growing
+    // by a fixed basis would copy the whole stack every STACK_EXPAND_BASIS
+    // pushes.  Doubling means N pushes copy it only O(log N) times.  (Near
+    // the limit, fall back on the requested amount so the last bit of the
+    // stack can still be used before an overflow error.)
+    //
+    if (amount < len_old and SER_REST(DS_Array) + len_old < STACK_LIMIT)
+        amount = len_old;
+
     // If adding in the requested amount would overflow the stack limit, then
     // give a data stack overflow error.
     //
@@ -0,0 +1,640 @@
+//
+//  File: %n-csv.c
+//  Summary: "native CSV/TSV reader and writer (the CSV and TSV codecs)"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// DECODE-CSV reads RFC 4180 data: fields separated by a delimiter (comma by
+// default), rows ended by CRLF, LF or CR, and fields in double quotes able to
+// contain delimiters, line breaks, and quotes written twice (`""`).  Blank
+// lines are skipped.  By default each row is a BLOCK! of TEXT!:
+//
+//     >> decode-csv {name,qty^/"Smith, J",3^/}
+//     == [["name" "qty"] ["Smith, J" "3"]]
+//
+// /TYPES converts the columns (INTEGER! and DECIMAL!, with an empty field as
+// BLANK!), /HEADER takes the first row as names and gives each row as a MAP!,
+// and /COLUMNS gives the data column by column.  Numeric columns then come
+// back as BINARY! of packed INT64 or FLOAT64 (see %n-packed.c), which is the
+// form PACKED-REDUCE and friends work on without a cell per number.
+//
+// For files too big to decode at once, /NEXT reads one row and gives back
+// the position after it, and /PARTIAL says the data may be cut off.  So a
+// file port can be read a chunk at a time, only ever holding the unread
+// tail:
+//
+//     buf: copy #{}
+//     while [chunk: read/part port 65536] [
+//         append buf chunk
+//         while [[row pos]: decode-csv/next/partial buf] [
+//             ... process row ...
+//             buf: pos
+//         ]
+//         buf: copy buf  ; drop what was consumed
+//     ]
+//     ; then /NEXT without /PARTIAL for any last row lacking a line break
+//
+// Unquoted fields are scanned 8 bytes at a time, testing a 64-bit word at
+// once for the delimiter and line break bytes.  Quoted fields only need the
+// next quote found, which is memchr() (vectorized in C libraries).  UTF-8 is
+// checked with Find_Invalid_Utf8(), which also gives the codepoint count the
+// TEXT! needs.
+//
+
+#include "sys-core.h"
+
+
+typedef struct {
+    const Byte* head;  // for the byte offset in errors
+    const Byte* at;
+    const Byte* tail;
+    Byte delimiter;
+    bool partial;  // data may be cut off, incomplete rows aren't decoded
+    Cell(const*) types;  // BLOCK! items (or nullptr) for column conversions
+    Cell(const*) types_tail;
+} Csv_Decoder;
+
+
+static Context(*) Error_Bad_Csv(Csv_Decoder* d) {
+    DECLARE_LOCAL (offset);
+    Init_Integer(offset, d->at - d->head + 1);
+    return Error_Bad_Csv_Raw(offset);
+}
+
+
+// Nonzero if any byte of `w` is the delimiter, CR or LF (`delimiters` has
+// the delimiter in every byte).  False positives may happen in bytes after a
+// true one, which the byte-at-a-time check that follows sorts out.
+//
+inline static uint64_t Csv_Special_Bytes(uint64_t w, uint64_t delimiters) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint64_t d = w ^ delimiters;
+    uint64_t cr = w ^ (ones * CR);
+    uint64_t lf = w ^ (ones * LF);
+    return (
+        ((d - ones) & ~d)
+        | ((cr - ones) & ~cr)
+        | ((lf - ones) & ~lf)
+    ) & 0x8080808080808080ULL;
+}
+
+
+// The type a column is to be converted to: REB_INTEGER, REB_DECIMAL, or
+// REB_TEXT (including for columns past the end of /TYPES).
+//
+static enum Reb_Kind Csv_Column_Kind(Csv_Decoder* d, REBLEN column)
+{
+    if (not d->types or column >= cast(REBLEN, d->types_tail - d->types))
+        return REB_TEXT;
+
+    Cell(const*) t = d->types + column;
+    if (IS_DATATYPE(t)) {
+        enum Reb_Kind kind = VAL_TYPE_KIND(t);
+        if (kind == REB_INTEGER or kind == REB_DECIMAL or kind == REB_TEXT)
+            return kind;
+    }
+    else if (IS_WORD(t)) {
+        switch (VAL_WORD_ID(t)) {
+          case SYM_INTEGER_X: return REB_INTEGER;
+          case SYM_DECIMAL_X: return REB_DECIMAL;
+          case SYM_TEXT_X: return REB_TEXT;
+          default: break;
+        }
+    }
+    else if (IS_BLANK(t))
+        return REB_TEXT;
+
+    fail (Error_Bad_Value(t));
+}
+
+
+// Push the field whose bytes are `size` at `bp`.  If it was quoted and had
+// quotes written twice, `doubled` says how many, and they are undoubled.
+//
+static void Push_Csv_Field(
+    Csv_Decoder* d,
+    const Byte* bp,
+    Size size,
+    REBLEN doubled,
+    REBLEN column
+){
+    enum Reb_Kind kind = Csv_Column_Kind(d, column);
+
+    if (kind != REB_TEXT) {
+        if (size == 0) {
+            Init_Blank(PUSH());
+            return;
+        }
+
+        Cell(*) out = PUSH();
+        if (doubled == 0 and size <= MAX_NUM_LEN) {
+            Byte buf[MAX_NUM_LEN + 1];  // terminated, as the scanners expect
+            memcpy(buf, bp, size);
+            buf[size] = '\0';
+            if (kind == REB_INTEGER ? (
+                Scan_Integer(out, buf, size) != nullptr
+            ) : (
+                Scan_Decimal(out, buf, size, true) != nullptr
+            )){
+                return;
+            }
+        }
+        d->at = bp;
+        fail (Error_Bad_Csv(d));  // not a number of the column's type
+    }
+
+    Length len;
+    if (Find_Invalid_Utf8(&len, bp, size))
+        fail (Error_Bad_Utf8_Raw());
+
+    String(*) s = Make_String(size - doubled);
+    Byte* dp = STR_HEAD(s);
+    if (doubled == 0)
+        memcpy(dp, bp, size);
+    else {
+        const Byte* tail = bp + size;
+        while (bp != tail) {  // copy up to and including each quote...
+            const Byte* q = cast(const Byte*, memchr(bp, '"', tail - bp));
+            const Byte* run_tail = q ? q + 1 : tail;
+            memcpy(dp, bp, run_tail - bp);
+            dp += run_tail - bp;
+            bp = q ? q + 2 : tail;  // ...then skip the quote doubling it
+        }
+    }
+    TERM_STR_LEN_SIZE(s, len - doubled, size - doubled);
+    Init_Text(PUSH(), s);
+}
+
+
+//
+//  Decode_Csv_Row: C
+//
+// Push the fields of the row at d->at, and advance past its line break.
+// Returns false if there's no row (only blank lines were left), or if the
+// decoder is partial and the row might not be complete, in which case
+// nothing is pushed and d->at is unchanged.
+//
+static bool Decode_Csv_Row(Csv_Decoder* d)
+{
+    while (d->at != d->tail and (*d->at == CR or *d->at == LF))
+        ++d->at;  // skip blank lines
+
+    if (d->at == d->tail)
+        return false;
+
+    const Byte* row_start = d->at;
+    StackIndex base = TOP_INDEX;
+    REBLEN column = 0;
+
+    const uint64_t delimiters = 0x0101010101010101ULL * d->delimiter;
+
+    while (true) {
+        if (d->at != d->tail and *d->at == '"') {  // quoted field
+            const Byte* start = d->at + 1;
+            const Byte* cp = start;
+            REBLEN doubled = 0;
+            const Byte* q;
+            while (true) {
+                q = cast(const Byte*, memchr(cp, '"', d->tail - cp));
+                if (not q or (q + 1 == d->tail and d->partial))
+                    goto incomplete;  // (a last quote may be half of a "")
+                if (q + 1 != d->tail and q[1] == '"') {
+                    ++doubled;
+                    cp = q + 2;
+                    continue;
+                }
+                break;
+            }
+            d->at = q + 1;
+            if (
+                d->at != d->tail
+                and *d->at != d->delimiter and *d->at != CR and *d->at != LF
+            ){
+                fail (Error_Bad_Csv(d));  // text after the closing quote
+            }
+            Push_Csv_Field(d, start, q - start, doubled, column);
+        }
+        else {  // unquoted field, up to a delimiter or line break
+            const Byte* start = d->at;
+            const Byte* cp = start;
+            while (cp != d->tail) {
+                if (d->tail - cp >= 8) {
+                    uint64_t w;
+                    memcpy(&w, cp, 8);
+                    if (not Csv_Special_Bytes(w, delimiters)) {
+                        cp += 8;
+                        continue;
+                    }
+                }
+                if (*cp == d->delimiter or *cp == CR or *cp == LF)
+                    break;
+                ++cp;
+            }
+            d->at = cp;
+            if (cp == d->tail and d->partial)
+                goto incomplete;  // more of the field may be coming
+            Push_Csv_Field(d, start, cp - start, 0, column);
+        }
+
+        ++column;
+
+        if (d->at == d->tail) {
+            if (d->partial)
+                goto incomplete;  // e.g. trailing delimiter, may be more
+            return true;
+        }
+        if (*d->at == d->delimiter) {
+            ++d->at;
+            if (d->at == d->tail and not d->partial) {
+                Push_Csv_Field(d, d->at, 0, 0, column);  // empty last field
+                return true;
+            }
+            continue;
+        }
+        if (*d->at == CR) {
+            ++d->at;
+            if (d->at != d->tail and *d->at == LF)
+                ++d->at;  // (a lone LF left by a cut is a skipped blank line)
+        }
+        else
+            ++d->at;  // LF
+        return true;
+    }
+
+  incomplete:
+    Drop_Data_Stack_To(base);
+    d->at = row_start;
+    return false;
+}
+
+
+// Take all the rows on the data stack since `base` and make them the columns
+// of the result instead, as BLOCK!s for TEXT! columns, and as packed BINARY!
+// for numeric ones.  Rows must all have the same number of fields.
+//
+static void Pop_Csv_Columns(Csv_Decoder* d, StackIndex base, Cell(*) out)
+{
+    REBLEN num_rows = TOP_INDEX - base;
+    REBLEN num_columns = 0;
+    if (num_rows != 0)
+        num_columns = VAL_LEN_AT(Data_Stack_At(base + 1));
+
+    StackIndex columns_base = TOP_INDEX;
+
+    REBLEN c;
+    for (c = 0; c < num_columns; ++c) {
+        enum Reb_Kind kind = Csv_Column_Kind(d, c);
+
+        if (kind == REB_TEXT) {
+            Array(*) a = Make_Array(num_rows);
+            StackIndex row;
+            for (row = base + 1; row <= columns_base; ++row) {
+                Copy_Cell(
+                    Alloc_Tail_Array(a),
+                    SPECIFIC(VAL_ARRAY_ITEM_AT(Data_Stack_At(row)) + c)
+                );
+            }
+            Init_Block(PUSH(), a);
+            continue;
+        }
+
+        Binary(*) bin = Make_Binary(num_rows * 8);
+        Byte* bp = BIN_HEAD(bin);
+        StackIndex row;
+        for (row = base + 1; row <= columns_base; ++row, bp += 8) {
+            Cell(const*) field = VAL_ARRAY_ITEM_AT(Data_Stack_At(row)) + c;
+            if (IS_BLANK(field))
+                fail (Error_Bad_Value(field));  // packed numbers can't be empty
+            if (kind == REB_INTEGER) {
+                int64_t i = VAL_INT64(field);
+                memcpy(bp, &i, 8);
+            }
+            else {
+                double f = VAL_DECIMAL(field);
+                memcpy(bp, &f, 8);
+            }
+        }
+        TERM_BIN_LEN(bin, num_rows * 8);
+        Init_Binary(PUSH(), bin);
+    }
+
+    Array(*) columns = Pop_Stack_Values(columns_base);
+    Drop_Data_Stack_To(base);
+    Init_Block(out, columns);
+}
+
+
+// Pair each value in `values` with the name at the same position, as a MAP!.
+//
+static REBMAP *Make_Csv_Map(Array(const*) names, Cell(const*) values)
+{
+    REBLEN n = ARR_LEN(names);
+    REBMAP *map = Make_Map(n);
+    REBLEN i;
+    for (i = 0; i < n; ++i) {
+        const bool strict = true;
+        Find_Map_Entry(
+            map, ARR_AT(names, i), SPECIFIED, values + i, SPECIFIED, strict
+        );
+    }
+    return map;
+}
+
+
+//
+//  identify-csv?: native [
+//
+//  {Codec for identifying CSV (the first line has a delimiter, no NUL bytes)}
+//
+//      return: [logic?]
+//      data [binary!]
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//  ]
+//
+DECLARE_NATIVE(identify_csv_q)
+{
+    INCLUDE_PARAMS_OF_IDENTIFY_CSV_Q;
+
+    Size size;
+    const Byte* bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+    const Byte* tail = bp + size;
+
+    Byte delimiter = REF(delimiter) ? VAL_CHAR(ARG(delimiter)) : ',';
+
+    bool found = false;
+    for (; bp != tail and *bp != CR and *bp != LF; ++bp) {
+        if (*bp == '\0')
+            return Init_False(OUT);
+        if (*bp == delimiter)
+            found = true;
+    }
+    return Init_Logic(OUT, found);
+}
+
+
+//
+//  decode-csv: native [
+//
+//  {Codec for decoding CSV (RFC 4180) into a BLOCK! of rows}
+//
+//      return: "Null with /NEXT if no row left (or may be cut off if /PARTIAL)"
+//          [<opt> block! map!]
+//      @rest "Position after what was decoded"
+//          [binary! text!]
+//      data "If BINARY!, must be UTF-8 encoded"
+//          [binary! text!]
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//      /types "Column types: INTEGER!, DECIMAL!, or TEXT! (or BLANK!)"
+//          [block!]
+//      /header "Take first row as the column names, rows become MAP!s"
+//      /columns "Give back columns instead of rows (map of them if /HEADER)"
+//      /next "Decode just one row and give back the position after it"
+//      /partial "With /NEXT, the data may be cut off (null if row may be)"
+//  ]
+//
+DECLARE_NATIVE(decode_csv)
+{
+    INCLUDE_PARAMS_OF_DECODE_CSV;
+
+    REBVAL *data = ARG(data);
+
+    if (REF(partial) and not REF(next))
+        fail (Error_Bad_Refines_Raw());
+    if (REF(next) and (REF(header) or REF(columns)))
+        fail (Error_Bad_Refines_Raw());
+
+    Size size;
+    const Byte* bp = VAL_BYTES_AT(&size, data);
+
+    Csv_Decoder d;
+    d.head = d.at = bp;
+    d.tail = bp + size;
+    d.partial = REF(partial);
+    d.types = nullptr;
+    d.types_tail = nullptr;
+
+    if (REF(delimiter)) {
+        Codepoint c = VAL_CHAR(ARG(delimiter));
+        if (c >= 0x80 or c == '"' or c == CR or c == LF)
+            fail (PARAM(delimiter));
+        d.delimiter = cast(Byte, c);
+    }
+    else
+        d.delimiter = ',';
+
+    option(Array(*)) names = nullptr;
+    if (REF(header)) {  // names aren't converted by /TYPES
+        StackIndex base = TOP_INDEX;
+        if (Decode_Csv_Row(&d))
+            names = Pop_Stack_Values(base);  // unmanaged, so no GC guard
+
+    }
+
+    if (REF(types))
+        d.types = VAL_ARRAY_AT(&d.types_tail, ARG(types));
+
+    if (REF(next)) {
+        StackIndex base = TOP_INDEX;
+        if (Decode_Csv_Row(&d))
+            Init_Block(OUT, Pop_Stack_Values(base));
+        else
+            Init_Nulled(OUT);
+    }
+    else {
+        StackIndex base = TOP_INDEX;
+        while (true) {
+            StackIndex row_base = TOP_INDEX;
+            if (not Decode_Csv_Row(&d))
+                break;
+            REBLEN num_fields = TOP_INDEX - row_base;
+            if (
+                (names and num_fields != ARR_LEN(unwrap(names)))
+                or (
+                    REF(columns) and row_base != base
+                    and num_fields != VAL_LEN_AT(Data_Stack_At(base + 1))
+                )
+            ){
+                fail (Error_Bad_Csv(&d));  // rows must be the same width
+            }
+            Array(*) row = Pop_Stack_Values(row_base);
+            if (names and not REF(columns)) {
+                REBMAP *map = Make_Csv_Map(unwrap(names), ARR_HEAD(row));
+                Free_Unmanaged_Series(row);
+                Init_Map(PUSH(), map);
+            }
+            else
+                Init_Block(PUSH(), row);
+        }
+
+        if (REF(columns)) {
+            Pop_Csv_Columns(&d, base, OUT);
+            if (names) {
+                if (VAL_LEN_AT(OUT) != ARR_LEN(unwrap(names)))
+                    fail (Error_Bad_Csv(&d));  // (only if no rows)
+                REBMAP *map = Make_Csv_Map(
+                    unwrap(names), VAL_ARRAY_ITEM_AT(OUT)
+                );
+                Init_Map(OUT, map);
+            }
+        }
+        else
+            Init_Block(OUT, Pop_Stack_Values(base));
+    }
+
+    if (names)
+        Free_Unmanaged_Series(unwrap(names));  // map keys were copied
+
+    REBVAL *rest = ARG(rest);
+    Copy_Cell(rest, data);
+    if (IS_BINARY(data))
+        VAL_INDEX_UNBOUNDED(rest) = d.at - BIN_HEAD(VAL_BINARY(data));
+    else
+        VAL_INDEX_RAW(rest) += Num_Codepoints_For_Bytes(bp, d.at);
+
+    if (Is_Nulled(OUT))
+        return nullptr;  // don't proxy multi-returns
+
+    return Proxy_Multi_Returns(frame_);
+}
+
+
+// Append a field, quoted if it has the delimiter, a quote, or a line break
+// in it (with its quotes doubled).
+//
+static void Encode_Csv_Utf8(
+    String(*) s,
+    const Byte* utf8,
+    Size size,
+    Length len,
+    Byte delimiter
+){
+    const Byte* tail = utf8 + size;
+
+    bool quote = false;
+    Size quotes = 0;
+    const Byte* bp = utf8;
+    for (; bp != tail; ++bp) {
+        if (*bp == '"') {
+            quote = true;
+            ++quotes;
+        }
+        else if (*bp == delimiter or *bp == CR or *bp == LF)
+            quote = true;
+    }
+
+    Size extra = quote ? quotes + 2 : 0;
+
+    Size old_size = STR_SIZE(s);
+    Length old_len = STR_LEN(s);
+    EXPAND_SERIES_TAIL(s, size + extra);
+
+    Byte* dp = BIN_AT(s, old_size);
+    if (not quote)
+        memcpy(dp, utf8, size);
+    else {
+        *dp++ = '"';
+        for (bp = utf8; bp != tail; ++bp) {
+            if (*bp == '"')
+                *dp++ = '"';
+            *dp++ = *bp;
+        }
+        *dp++ = '"';
+    }
+
+    TERM_STR_LEN_SIZE(s, old_len + len + extra, old_size + size + extra);
+}
+
+
+//
+//  encode-csv: native [
+//
+//  {Codec for encoding a BLOCK! of rows (each a BLOCK!) as CSV}
+//
+//      return: [binary!]
+//      rows [block!]
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//  ]
+//
+DECLARE_NATIVE(encode_csv)
+//
+// Rows end in CRLF, as RFC 4180 says.  Fields can be any string, ISSUE! or
+// word (written as text), INTEGER! or DECIMAL!, and BLANK! is an empty field.
+{
+    INCLUDE_PARAMS_OF_ENCODE_CSV;
+
+    Byte delimiter = ',';
+    if (REF(delimiter)) {
+        Codepoint c = VAL_CHAR(ARG(delimiter));
+        if (c >= 0x80 or c == '"' or c == CR or c == LF)
+            fail (PARAM(delimiter));
+        delimiter = cast(Byte, c);
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+    String(*) s = mo->series;
+
+    Cell(const*) rows_tail;
+    Cell(const*) row = VAL_ARRAY_AT(&rows_tail, ARG(rows));
+    for (; row != rows_tail; ++row) {
+        if (not IS_BLOCK(row))
+            fail (Error_Invalid_Type(VAL_TYPE(row)));
+
+        Cell(const*) tail;
+        Cell(const*) head = VAL_ARRAY_AT(&tail, row);
+        Cell(const*) field = head;
+        for (; field != tail; ++field) {
+            if (field != head)
+                Append_Codepoint(s, delimiter);
+
+            enum Reb_Kind kind = VAL_TYPE(field);
+            if (kind == REB_BLANK)
+                continue;
+
+            if (kind == REB_INTEGER) {
+                Byte buf[60];
+                REBINT n = Emit_Integer(buf, VAL_INT64(field));
+                Append_Ascii_Len(s, s_cast(buf), n);
+            }
+            else if (kind == REB_DECIMAL) {
+                Byte buf[60];
+                REBINT n = Emit_Decimal(
+                    buf, VAL_DECIMAL(field), 0, '.', mo->digits
+                );
+                Append_Ascii_Len(s, s_cast(buf), n);
+            }
+            else if (
+                ANY_STRING_KIND(kind) or kind == REB_ISSUE or ANY_WORD_KIND(kind)
+            ){
+                REBLEN len;
+                Size size;
+                Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, field);
+                Encode_Csv_Utf8(s, utf8, size, len, delimiter);
+            }
+            else
+                fail (Error_Invalid_Type(kind));
+        }
+        Append_Ascii(s, "\r\n");
+    }
+
+    return Init_Binary(OUT, Pop_Molded_Binary(mo));
+}
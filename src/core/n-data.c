@@ -619,6 +619,62 @@ DECLARE_NATIVE(collect_words)
 }
 
 
+//
+//  Pick_Object_Var_Cached: C
+//
+// Fast path for a step of a TUPLE! that picks a WORD! out of an OBJECT!,
+// which doesn't need to go through the PICK* dispatch.  The position is
+// checked against what this step of this tuple saw last, see PICK_CACHE_SIZE.
+//
+// Returns nullptr for anything PICK* should handle (like raising an error).
+//
+static const REBVAR *Pick_Object_Var_Cached(
+    const Node* site,
+    REBLEN step,
+    const REBVAL *object,
+    Symbol(const*) symbol
+){
+    Context(*) c = VAL_CONTEXT(object);
+    Keylist(*) keylist = CTX_KEYLIST(c);
+
+    uintptr_t bits = (cast(uintptr_t, site) >> 4) + step;
+    uint32_t hash = cast(uint32_t, bits ^ (bits >> 16)) * 2654435761u;
+    struct Reb_Pick_Cache_Entry *entry
+        = &TG_Pick_Cache[(hash >> 8) & (PICK_CACHE_SIZE - 1)];
+
+    REBLEN n;
+    if (
+        entry->site == site
+        and entry->step == step
+        and entry->keylist == keylist
+        and entry->symbol == symbol
+    ){
+        n = entry->index;
+    }
+    else {
+        const bool strict = false;  // same as TRY_VAL_CONTEXT_VAR()
+        n = Find_Symbol_In_Context(object, symbol, strict);
+        if (n == 0)
+            return nullptr;
+
+        if (Is_First_Key_For_Symbol(keylist, symbol, strict, n)) {
+            entry->site = site;
+            entry->step = step;
+            entry->keylist = keylist;
+            entry->symbol = symbol;
+            entry->index = n;
+        }
+    }
+
+    const REBVAR *var = CTX_VAR(c, n);
+    if (Get_Cell_Flag(var, VAR_MARKED_HIDDEN))
+        return nullptr;  // a later key may be visible, let PICK* search
+    if (Is_Isotope(var) or Is_Void(var))
+        return nullptr;
+    return var;
+}
+
+
 //
 //  Get_Var_Push_Refinements_Throws: C
 //
@@ -689,6 +745,7 @@ bool Get_Var_Push_Refinements_Throws(
     }
 
     StackIndex base = TOP_INDEX;
+    const Node* site = nullptr;  // array to key pick caching on, if any
 
     if (ANY_SEQUENCE(var)) {
         if (Not_Cell_Flag(var, SEQUENCE_HAS_NODE))  // byte compressed
@@ -713,6 +770,7 @@ bool Get_Var_Push_Refinements_Throws(
             goto get_source;
 
           case FLAVOR_ARRAY:
+            site = node1;
             break;
 
           default:
@@ -784,9 +842,21 @@ bool Get_Var_Push_Refinements_Throws(
     PUSH_GC_GUARD(temp);
 
     while (stackindex != TOP_INDEX + 1) {
+        StackValue(*) picker = Data_Stack_At(stackindex);
+        if (site and IS_OBJECT(out) and IS_WORD(picker)) {
+            const REBVAR *slot = Pick_Object_Var_Cached(
+                site, stackindex - base, out, VAL_WORD_SYMBOL(picker)
+            );
+            if (slot) {
+                Copy_Cell(out, slot);
+                ++stackindex;
+                continue;
+            }
+        }
+
         Move_Cell(temp, out);
         Quotify(temp, 1);
-        const void *ins = rebQ(cast(REBVAL*, Data_Stack_At(stackindex)));
+        const void *ins = rebQ(cast(REBVAL*, picker));
         if (rebRunThrows(
             out,  // <-- output cell
             Canon(PICK_P), temp, ins
@@ -1845,30 +1915,32 @@ bool Try_As_String(
                 if (Get_Cell_Flag(v, CONST))
                     fail (Error_Alias_Constrains_Raw());
 
-            bool all_ascii = true;
-            REBLEN num_codepoints = 0;
-
-            index = 0;
-
-            Size bytes_left = BIN_LEN(bin);
-            const Byte* bp = BIN_HEAD(bin);
-            for (; bytes_left > 0; --bytes_left, ++bp) {
-                if (bp < at_ptr)
-                    ++index;
+            // A codepoint can't straddle `at_ptr` (it's not a continuation
+            // byte), so the parts before and after can be checked apart to
+            // get the index along with the length.
+            //
+            const Byte* head = BIN_HEAD(bin);
+            Size size = BIN_LEN(bin);
+            Length num_before;
+            Length num_after;
+            if (
+                Find_Invalid_Utf8(&num_before, head, at_ptr - head)
+                or Find_Invalid_Utf8(&num_after, at_ptr, size - (at_ptr - head))
+            ){
+                fail (Error_Bad_Utf8_Raw());
+            }
+            index = num_before;
+            REBLEN num_codepoints = num_before + num_after;
 
-                Codepoint c = *bp;
-                if (c < 0x80)
-                    Validate_Ascii_Byte(bp, strmode, BIN_HEAD(bin));
-                else {
-                    bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
-                    if (bp == NULL)  // !!! Should Back_Scan() fail?
-                        fail (Error_Bad_Utf8_Raw());
+            if (memchr(head, '\0', size))
+                fail (Error_Illegal_Zero_Byte_Raw());
 
-                    all_ascii = false;
-                }
-
-                ++num_codepoints;
+            if (strmode != STRMODE_ALL_CODEPOINTS) {
+                const Byte* cr = cast(const Byte*, memchr(head, CR, size));
+                if (cr)
+                    Validate_Ascii_Byte(cr, strmode, head);  // fails
             }
+
             mutable_SER_FLAVOR(m_cast(Binary(*), bin)) = FLAVOR_STRING;
             str = STR(bin);
 
@@ -1880,8 +1952,6 @@ bool Try_As_String(
             mutable_LINK(Bookmarks, m_cast(Binary(*), bin)) = nullptr;
 
             // !!! TBD: cache index/offset
-
-            UNUSED(all_ascii);  // TBD: maintain cache
         }
         else {
             // !!! It's a string series, but or mapping acceleration is
@@ -0,0 +1,299 @@
+//
+//  File: %n-heap.c
+//  Summary: "native functions for priority queues kept in a BLOCK!"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2026 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A priority queue kept sorted with FIND and INSERT costs O(n) per insert,
+// as everything after the insertion point has to be moved.  These natives
+// instead keep an ordinary BLOCK! as a binary min-heap: the record with the
+// smallest key is always first, and pushing or popping a record only moves
+// O(log n) of them.
+//
+//     >> timers: copy []
+//     >> heap-push/skip timers [10:00 backup] 2
+//     >> heap-push/skip timers [9:30 email] 2
+//     >> heap-pop/skip timers 2
+//     == [9:30 email]
+//
+// Records are /SKIP values long (default 1), and ordered by their first
+// value with Cmp_Value(), so the key comes first.  The smallest record is
+// simply the FIRST of the block.  Other than that, the order of records is
+// only what the heap needs, and the block shouldn't be changed other than
+// through these natives (or changing a key and calling HEAP-UPDATE).
+//
+// (This is done on BLOCK! vs. as a datatype of its own, so the heap gets
+// all the operations and GC handling of an array for free.)
+//
+
+#include "sys-core.h"
+
+
+typedef struct {
+    Cell(*) head;  // first record
+    REBLEN num_records;
+    REBLEN skip;
+    bool strict;
+} Heap;
+
+
+static REBLEN Heap_Skip(const REBVAL *skip)  // INTEGER! or nulled
+{
+    if (Is_Nulled(skip))
+        return 1;
+    if (VAL_INT32(skip) <= 0)
+        fail (Error_Out_Of_Range(skip));
+    return VAL_INT32(skip);
+}
+
+
+static void Init_Heap(
+    Heap* h,
+    const REBVAL *heap,
+    const REBVAL *skip,
+    bool strict
+){
+    h->skip = Heap_Skip(skip);
+
+    Cell(const*) tail;
+    h->head = VAL_ARRAY_AT_ENSURE_MUTABLE(&tail, heap);
+    REBLEN len = tail - h->head;
+    if (len % h->skip != 0)
+        fail (Error_Block_Skip_Wrong_Raw());
+    h->num_records = len / h->skip;
+    h->strict = strict;
+}
+
+
+inline static bool Heap_Less(Heap* h, REBLEN i, REBLEN j) {
+    return Cmp_Value(
+        h->head + i * h->skip,
+        h->head + j * h->skip,
+        h->strict
+    ) < 0;
+}
+
+
+// Cells are swapped as raw bits, as when SORT swaps records.
+//
+static void Swap_Heap_Records(Heap* h, REBLEN i, REBLEN j)
+{
+    Cell(*) a = h->head + i * h->skip;
+    Cell(*) b = h->head + j * h->skip;
+
+    REBLEN n;
+    for (n = 0; n < h->skip; ++n, ++a, ++b) {
+        Reb_Cell temp;
+        memcpy(&temp, a, sizeof(Reb_Cell));
+        memcpy(a, b, sizeof(Reb_Cell));
+        memcpy(b, &temp, sizeof(Reb_Cell));
+    }
+}
+
+
+static REBLEN Sift_Up(Heap* h, REBLEN i)
+{
+    while (i > 0) {
+        REBLEN parent = (i - 1) / 2;
+        if (not Heap_Less(h, i, parent))
+            break;
+        Swap_Heap_Records(h, i, parent);
+        i = parent;
+    }
+    return i;
+}
+
+
+static void Sift_Down(Heap* h, REBLEN i)
+{
+    while (true) {
+        REBLEN child = 2 * i + 1;
+        if (child >= h->num_records)
+            break;
+        if (child + 1 < h->num_records and Heap_Less(h, child + 1, child))
+            ++child;  // the smaller of the two children
+        if (not Heap_Less(h, child, i))
+            break;
+        Swap_Heap_Records(h, i, child);
+        i = child;
+    }
+}
+
+
+//
+//  heapify: native [
+//
+//  {Arrange a block as a heap, so its first record has the smallest key}
+//
+//      return: [block!]
+//      heap [block!]
+//      /skip "Size of each record, with the key first (default 1)"
+//          [integer!]
+//      /case "Keys are compared case-sensitively"
+//  ]
+//
+DECLARE_NATIVE(heapify)
+{
+    INCLUDE_PARAMS_OF_HEAPIFY;
+
+    Heap h;
+    Init_Heap(&h, ARG(heap), ARG(skip), REF(case));
+
+    REBLEN i = h.num_records / 2;
+    while (i != 0)
+        Sift_Down(&h, --i);
+
+    return COPY(ARG(heap));
+}
+
+
+//
+//  heap-push: native [
+//
+//  {Add a record to a heap}
+//
+//      return: [block!]
+//      heap [block!]
+//      value "The record (a BLOCK! of its values if /SKIP is more than 1)"
+//          [element?]
+//      /skip "Size of each record, with the key first (default 1)"
+//          [integer!]
+//      /case "Keys are compared case-sensitively"
+//  ]
+//
+DECLARE_NATIVE(heap_push)
+{
+    INCLUDE_PARAMS_OF_HEAP_PUSH;
+
+    REBVAL *heap = ARG(heap);
+    REBVAL *value = ARG(value);
+    REBLEN skip = Heap_Skip(ARG(skip));
+    Array(*) arr = VAL_ARRAY_ENSURE_MUTABLE(heap);
+
+    if (skip == 1)
+        Copy_Cell(Alloc_Tail_Array(arr), value);
+    else {
+        REBLEN len;
+        Cell(const*) item = IS_BLOCK(value)
+            ? VAL_ARRAY_LEN_AT(&len, value)
+            : nullptr;
+        if (not item or len != skip)
+            fail (Error_Bad_Value(value));  // must be a whole record
+
+        REBSPC *specifier = VAL_SPECIFIER(value);
+        for (; len != 0; --len, ++item)
+            Derelativize(Alloc_Tail_Array(arr), item, specifier);
+    }
+
+    Heap h;
+    Init_Heap(&h, heap, ARG(skip), REF(case));  // (after any expansion)
+    Sift_Up(&h, h.num_records - 1);
+
+    return COPY(heap);
+}
+
+
+//
+//  heap-pop: native [
+//
+//  {Remove the record with the smallest key from a heap}
+//
+//      return: "Null if the heap is empty, BLOCK! if /SKIP is more than 1"
+//          [<opt> element?]
+//      heap [block!]
+//      /skip "Size of each record, with the key first (default 1)"
+//          [integer!]
+//      /case "Keys are compared case-sensitively"
+//  ]
+//
+DECLARE_NATIVE(heap_pop)
+{
+    INCLUDE_PARAMS_OF_HEAP_POP;
+
+    REBVAL *heap = ARG(heap);
+
+    Heap h;
+    Init_Heap(&h, heap, ARG(skip), REF(case));
+
+    if (h.num_records == 0)
+        return nullptr;
+
+    REBSPC *specifier = VAL_SPECIFIER(heap);
+    if (h.skip == 1)
+        Derelativize(OUT, h.head, specifier);
+    else
+        Init_Block(OUT, Copy_Values_Len_Shallow(h.head, specifier, h.skip));
+
+    Swap_Heap_Records(&h, 0, h.num_records - 1);  // last record to the top
+    --h.num_records;
+
+    Array(*) arr = VAL_ARRAY_KNOWN_MUTABLE(heap);
+    Remove_Series_Units(arr, ARR_LEN(arr) - h.skip, h.skip);
+    Sift_Down(&h, 0);
+
+    return OUT;
+}
+
+
+//
+//  heap-update: native [
+//
+//  {Restore a heap's order after the key of one of its records is changed}
+//
+//      return: [block!]
+//      heap [block!]
+//      position "The record, as a position in the heap (e.g. from FIND)"
+//          [block!]
+//      /skip "Size of each record, with the key first (default 1)"
+//          [integer!]
+//      /case "Keys are compared case-sensitively"
+//  ]
+//
+DECLARE_NATIVE(heap_update)
+//
+// This is how to do a "decrease key" (or increase), e.g.:
+//
+//     pos: back find timers 'email  ; the key is before it in the record
+//     pos.1: 9:15
+//     heap-update/skip timers pos 2
+{
+    INCLUDE_PARAMS_OF_HEAP_UPDATE;
+
+    REBVAL *heap = ARG(heap);
+    REBVAL *position = ARG(position);
+
+    Heap h;
+    Init_Heap(&h, heap, ARG(skip), REF(case));
+
+    if (VAL_ARRAY(position) != VAL_ARRAY(heap))
+        fail (Error_Bad_Value(position));  // not a position in this heap
+
+    REBIDX offset = VAL_INDEX_RAW(position) - VAL_INDEX_RAW(heap);
+    if (
+        offset < 0
+        or cast(REBLEN, offset) % h.skip != 0
+        or cast(REBLEN, offset) / h.skip >= h.num_records
+    ){
+        fail (Error_Out_Of_Range(position));
+    }
+
+    REBLEN i = Sift_Up(&h, cast(REBLEN, offset) / h.skip);
+    Sift_Down(&h, i);
+
+    return COPY(heap);
+}
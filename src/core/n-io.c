@@ -51,8 +51,8 @@ DECLARE_NATIVE(form)
 //
 //  "Converts value to a REBOL-readable string"
 //
-//      return: "Returns null if input is void"
-//          [<opt> text!]
+//      return: "Returns null if input is void, the port if /STREAM"
+//          [<opt> text! port!]
 //      @truncated "Whether the mold was truncated"
 //          [logic!]
 //      value [<maybe> element?]
@@ -61,6 +61,8 @@ DECLARE_NATIVE(form)
 //      /flat "No indentation"
 //      /limit "Limit to a certain length"
 //          [integer!]
+//      /stream "WRITE the mold to an open port in chunks as it is produced"
+//          [port!]
 //  ]
 //
 DECLARE_NATIVE(mold)
@@ -78,6 +80,11 @@ DECLARE_NATIVE(mold)
         SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
         mo->limit = Int32(ARG(limit));
     }
+    if (REF(stream)) {
+        if (REF(limit))  // truncation happens at the end, after flushes
+            fail (Error_Bad_Refines_Raw());
+        mo->sink = ARG(stream);
+    }
 
     Push_Mold(mo);
 
@@ -86,6 +93,14 @@ DECLARE_NATIVE(mold)
 
     Mold_Value(mo, v);
 
+    if (REF(stream)) {  // memory use is bounded by MOLD_SINK_CHUNK size
+        Flush_Mold_Sink(mo, 0);
+        Drop_Mold(mo);
+        Init_Logic(ARG(truncated), false);
+        Copy_Cell(OUT, ARG(stream));
+        return Proxy_Multi_Returns(frame_);
+    }
+
     String(*) popped = Pop_Molded_String(mo);  // sets MOLD_FLAG_TRUNCATED
 
     Init_Logic(ARG(truncated), did (mo->opts & MOLD_FLAG_WAS_TRUNCATED));
@@ -0,0 +1,888 @@
+//
+//  File: %n-json.c
+//  Summary: "native JSON encoder and decoder (the JSON codec)"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// DECODE 'JSON and ENCODE 'JSON, without going through PARSE.  The mapping
+// is:
+//
+//     object - MAP! (keys are TEXT!, compared case-sensitively)
+//     array - BLOCK!
+//     string - TEXT!
+//     number - INTEGER! if it has no fraction or exponent and fits, else
+//         DECIMAL!
+//     true, false, null - the WORD!s TRUE, FALSE and NULL
+//
+// Encoding takes those back, and also accepts OBJECT! as an object, any
+// ANY-STRING! or ISSUE! as a string, BLANK! as null, and LOGIC! and NULL
+// (e.g. as the values of object fields) as true/false/null.
+//
+// Strings are where the time goes in most JSON, so both directions step over
+// plain runs of string bytes 8 at a time, testing a 64-bit word at once for
+// the bytes that need attention (quote, backslash, or control characters).
+// Decoded strings are only checked for valid UTF-8 if they have bytes with
+// the high bit set, and that check is Find_Invalid_Utf8() which is itself
+// vectorized where the CPU allows.  Numbers use the same converters as the
+// scanner (with its exact fast path for short decimals).
+//
+// Encoding writes straight into the mold buffer.  Each string is measured
+// first, so its escaped form is written in place with no intermediate copy.
+//
+// For very large arrays, DECODE-JSON/NEXT decodes one element at a time and
+// gives back the position after it, so the whole array never has to be held
+// in memory as Rebol values.
+//
+
+#include "sys-core.h"
+
+
+typedef struct {
+    const Byte* head;  // for the byte offset in errors
+    const Byte* at;
+    const Byte* tail;
+} Json_Decoder;
+
+
+static Context(*) Error_Bad_Json(Json_Decoder* d) {
+    DECLARE_LOCAL (offset);
+    Init_Integer(offset, d->at - d->head + 1);
+    return Error_Bad_Json_Raw(offset);
+}
+
+
+// Nonzero if any byte in `w` is a quote, a backslash, or below 0x20: the
+// bytes that end or interrupt a plain run in a JSON string.  (The tests can
+// give false positives in bytes after a true one, which is fine, as a hit
+// just means looking at those bytes one at a time.)
+//
+inline static uint64_t Json_Special_Bytes(uint64_t w) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint64_t quote = w ^ (ones * '"');
+    uint64_t backslash = w ^ (ones * '\\');
+    return (
+        ((quote - ones) & ~quote)
+        | ((backslash - ones) & ~backslash)
+        | ((w - ones * 0x20) & ~w)
+    ) & 0x8080808080808080ULL;
+}
+
+inline static bool Is_Json_Special_Byte(Byte b)
+  { return b == '"' or b == '\\' or b < 0x20; }
+
+
+inline static void Json_Skip_Whitespace(Json_Decoder* d) {
+    while (
+        d->at != d->tail
+        and (*d->at == ' ' or *d->at == '\n' or *d->at == '\r' or *d->at == '\t')
+    ){
+        ++d->at;
+    }
+}
+
+
+// Returns -1 if the 4 bytes at `bp` aren't all hex digits.
+//
+static REBINT Json_Hex4(const Byte* bp) {
+    REBINT n = 0;
+    REBLEN i;
+    for (i = 0; i < 4; ++i) {
+        Byte b = bp[i];
+        n <<= 4;
+        if (b >= '0' and b <= '9')
+            n += b - '0';
+        else if ((b | 0x20) >= 'a' and (b | 0x20) <= 'f')
+            n += (b | 0x20) - 'a' + 10;
+        else
+            return -1;
+    }
+    return n;
+}
+
+
+static void Decode_Json_Value(Json_Decoder* d);
+
+
+//
+//  Decode_Json_String: C
+//
+// Pushes a TEXT! for the string at d->at (which is on its opening quote).
+//
+// The closing quote is found first.  Escapes only ever make the text shorter
+// (`\u00E9` is 6 bytes for a 2-byte character, a surrogate pair is 12 bytes
+// for 4), so the size of the quoted span is enough to decode into.
+//
+static void Decode_Json_String(Json_Decoder* d)
+{
+    const uint64_t high_bits = 0x8080808080808080ULL;
+
+    const Byte* start = d->at + 1;
+    const Byte* cp = start;
+    bool escaped = false;
+    bool ascii = true;
+
+    while (true) {
+        if (d->tail - cp >= 8) {
+            uint64_t w;
+            memcpy(&w, cp, 8);
+            if (w & high_bits)
+                ascii = false;  // may be past the closing quote, no harm
+            if (not Json_Special_Bytes(w)) {
+                cp += 8;
+                continue;
+            }
+        }
+
+        if (cp == d->tail) {
+            d->at = cp;
+            fail (Error_Bad_Json(d));  // no closing quote
+        }
+
+        Byte b = *cp;
+        if (b == '"')
+            break;
+        if (b < 0x20) {
+            d->at = cp;
+            fail (Error_Bad_Json(d));  // control characters must be escaped
+        }
+        if (b >= 0x80)
+            ascii = false;
+        if (b == '\\') {
+            escaped = true;
+            if (++cp == d->tail)
+                continue;  // will fail as unterminated
+        }
+        ++cp;
+    }
+
+    Size raw_size = cp - start;
+    Length raw_len = raw_size;
+    if (not ascii and Find_Invalid_Utf8(&raw_len, start, raw_size))
+        fail (Error_Bad_Utf8_Raw());
+
+    String(*) s = Make_String(raw_size);
+
+    if (not escaped) {
+        memcpy(STR_HEAD(s), start, raw_size);
+        TERM_STR_LEN_SIZE(s, raw_len, raw_size);
+        Init_Text(PUSH(), s);
+        d->at = cp + 1;
+        return;
+    }
+
+    Byte* dp = STR_HEAD(s);
+    Length len = raw_len;  // adjusted for each escape as it's decoded
+
+    const Byte* bp = start;
+    while (true) {
+        const Byte* esc = cast(const Byte*, memchr(bp, '\\', cp - bp));
+        if (not esc)
+            esc = cp;
+        memcpy(dp, bp, esc - bp);
+        dp += esc - bp;
+        if (esc == cp)
+            break;
+
+        bp = esc + 1;  // the escape letter (always present, see above)
+        Codepoint c;
+        switch (*bp++) {
+          case '"': c = '"'; break;
+          case '\\': c = '\\'; break;
+          case '/': c = '/'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'n': c = '\n'; break;
+          case 'r': c = '\r'; break;
+          case 't': c = '\t'; break;
+
+          case 'u': {
+            REBINT unit = (cp - bp >= 4) ? Json_Hex4(bp) : -1;
+            if (unit < 0)
+                goto bad_escape;
+            bp += 4;
+            c = unit;
+
+            if (c >= UNI_SUR_LOW_START and c <= UNI_SUR_LOW_END)
+                goto bad_escape;  // low surrogate with no high one before it
+
+            if (c >= UNI_SUR_HIGH_START and c <= UNI_SUR_HIGH_END) {
+                REBWCHAR units[2];
+                units[0] = c;
+                REBINT low = (cp - bp >= 6 and bp[0] == '\\' and bp[1] == 'u')
+                    ? Json_Hex4(bp + 2)
+                    : -1;
+                if (
+                    low < cast(REBINT, UNI_SUR_LOW_START)
+                    or low > cast(REBINT, UNI_SUR_LOW_END)
+                ){
+                    goto bad_escape;
+                }
+                units[1] = low;
+                bp += 6;
+                c = Decode_UTF16_Pair(units);
+            }
+
+            if (c == 0)
+                fail (Error_Illegal_Zero_Byte_Raw());
+            break; }
+
+          default:
+          bad_escape:
+            d->at = esc;
+            fail (Error_Bad_Json(d));
+        }
+
+        Size size = Encoded_Size_For_Codepoint(c);
+        Encode_UTF8_Char(dp, c, size);
+        dp += size;
+
+        len -= (bp - esc) - 1;  // the escape's characters were counted
+    }
+
+    Size size = dp - STR_HEAD(s);
+    TERM_STR_LEN_SIZE(s, len, size);
+    Init_Text(PUSH(), s);
+    d->at = cp + 1;
+}
+
+
+// Pushes an INTEGER! or DECIMAL! for the number at d->at.
+//
+static void Decode_Json_Number(Json_Decoder* d)
+{
+    const Byte* start = d->at;
+    const Byte* cp = start;
+    bool integral = true;
+
+    if (*cp == '-')
+        ++cp;
+
+    if (cp != d->tail and *cp == '0')
+        ++cp;  // no leading zeros in JSON
+    else if (cp != d->tail and *cp >= '1' and *cp <= '9') {
+        do { ++cp; } while (cp != d->tail and *cp >= '0' and *cp <= '9');
+    }
+    else
+        goto bad_number;
+
+    if (cp != d->tail and *cp == '.') {
+        integral = false;
+        ++cp;
+        if (cp == d->tail or *cp < '0' or *cp > '9')
+            goto bad_number;
+        do { ++cp; } while (cp != d->tail and *cp >= '0' and *cp <= '9');
+    }
+
+    if (cp != d->tail and (*cp == 'e' or *cp == 'E')) {
+        integral = false;
+        ++cp;
+        if (cp != d->tail and (*cp == '+' or *cp == '-'))
+            ++cp;
+        if (cp == d->tail or *cp < '0' or *cp > '9')
+            goto bad_number;
+        do { ++cp; } while (cp != d->tail and *cp >= '0' and *cp <= '9');
+    }
+
+  blockscope {
+    REBLEN len = cp - start;
+    d->at = cp;
+
+    Cell(*) out = PUSH();
+
+    if (integral and Scan_Integer(out, start, len))
+        return;  // else too big for INTEGER!, so it's a DECIMAL!
+
+    // The token is copied so the scanner sees it terminated (it would take
+    // a following comma as a decimal point).  Longer ones than it accepts
+    // are valid JSON, and go straight to strtod(), which stops at the end.
+    //
+    if (len <= MAX_NUM_LEN) {
+        Byte buf[MAX_NUM_LEN + 1];
+        memcpy(buf, start, len);
+        buf[len] = '\0';
+        if (not Scan_Decimal(out, buf, len, true))
+            fail (Error_Bad_Json(d));
+    }
+    else {
+        REBDEC dec = strtod(s_cast(start), nullptr);
+        if (fabs(dec) == HUGE_VAL)
+            fail (Error_Overflow_Raw());
+        Init_Decimal(out, dec);
+    }
+    return;
+  }
+
+  bad_number:
+    d->at = start;
+    fail (Error_Bad_Json(d));
+}
+
+
+// Pushes the WORD! for `true`, `false` or `null` at d->at.
+//
+static void Decode_Json_Literal(
+    Json_Decoder* d,
+    const char* spelling,
+    Symbol(const*) symbol
+){
+    Size size = strsize(spelling);
+    if (
+        cast(Size, d->tail - d->at) < size
+        or memcmp(d->at, spelling, size) != 0
+    ){
+        fail (Error_Bad_Json(d));
+    }
+    d->at += size;
+    Init_Word(PUSH(), symbol);
+}
+
+
+static void Decode_Json_Array(Json_Decoder* d)
+{
+    StackIndex base = TOP_INDEX;
+
+    ++d->at;  // skip [
+    Json_Skip_Whitespace(d);
+    if (d->at != d->tail and *d->at == ']')
+        ++d->at;
+    else while (true) {
+        Decode_Json_Value(d);
+        Json_Skip_Whitespace(d);
+        if (d->at != d->tail and *d->at == ',') {
+            ++d->at;
+            continue;
+        }
+        if (d->at != d->tail and *d->at == ']') {
+            ++d->at;
+            break;
+        }
+        fail (Error_Bad_Json(d));
+    }
+
+    Array(*) a = Pop_Stack_Values(base);
+    Init_Block(PUSH(), a);
+}
+
+
+// The keys and values are gathered on the data stack, so the MAP! can be
+// made knowing how many pairs it will hold.  A key that's repeated in the
+// object takes the last value given for it.
+//
+static void Decode_Json_Object(Json_Decoder* d)
+{
+    StackIndex base = TOP_INDEX;
+
+    ++d->at;  // skip {
+    Json_Skip_Whitespace(d);
+    if (d->at != d->tail and *d->at == '}')
+        ++d->at;
+    else while (true) {
+        Json_Skip_Whitespace(d);
+        if (d->at == d->tail or *d->at != '"')
+            fail (Error_Bad_Json(d));
+        Decode_Json_String(d);
+
+        Json_Skip_Whitespace(d);
+        if (d->at == d->tail or *d->at != ':')
+            fail (Error_Bad_Json(d));
+        ++d->at;
+
+        Decode_Json_Value(d);
+
+        Json_Skip_Whitespace(d);
+        if (d->at != d->tail and *d->at == ',') {
+            ++d->at;
+            continue;
+        }
+        if (d->at != d->tail and *d->at == '}') {
+            ++d->at;
+            break;
+        }
+        fail (Error_Bad_Json(d));
+    }
+
+    REBMAP *map = Make_Map((TOP_INDEX - base) / 2);
+
+    StackIndex pair = base + 1;
+    for (; pair < TOP_INDEX; pair += 2) {
+        const bool strict = true;
+        Find_Map_Entry(
+            map,
+            Data_Stack_At(pair),
+            SPECIFIED,
+            Data_Stack_At(pair + 1),
+            SPECIFIED,
+            strict
+        );
+    }
+
+    Drop_Data_Stack_To(base);
+    Init_Map(PUSH(), map);
+}
+
+
+//
+//  Decode_Json_Value: C
+//
+// Pushes the decoded value to the data stack.
+//
+static void Decode_Json_Value(Json_Decoder* d)
+{
+    if (C_STACK_OVERFLOWING(&d))
+        Fail_Stack_Overflow();
+
+    Json_Skip_Whitespace(d);
+    if (d->at == d->tail)
+        fail (Error_Bad_Json(d));
+
+    switch (*d->at) {
+      case '{':
+        Decode_Json_Object(d);
+        break;
+
+      case '[':
+        Decode_Json_Array(d);
+        break;
+
+      case '"':
+        Decode_Json_String(d);
+        break;
+
+      case 't':
+        Decode_Json_Literal(d, "true", Canon(TRUE));
+        break;
+
+      case 'f':
+        Decode_Json_Literal(d, "false", Canon(FALSE));
+        break;
+
+      case 'n':
+        Decode_Json_Literal(d, "null", Canon(NULL));
+        break;
+
+      default:
+        if (*d->at == '-' or (*d->at >= '0' and *d->at <= '9'))
+            Decode_Json_Number(d);
+        else
+            fail (Error_Bad_Json(d));
+    }
+}
+
+
+// Bytes added to a string byte when it's escaped (0 if it isn't)
+//
+inline static Size Json_Escape_Extra(Byte b) {
+    if (not Is_Json_Special_Byte(b))
+        return 0;
+    switch (b) {
+      case '"': case '\\': case '\b': case '\f': case '\n': case '\r': case '\t':
+        return 1;  // e.g. \n
+    }
+    return 5;  // \u00XX
+}
+
+
+//
+//  Encode_Json_Utf8: C
+//
+// Append the UTF-8 as a quoted JSON string.  One pass over it counts the
+// bytes the escapes add, so the mold buffer is expanded once and the plain
+// runs between escapes are copied straight in.
+//
+static void Encode_Json_Utf8(
+    String(*) s,
+    const Byte* utf8,
+    Size size,
+    Length len
+){
+    const Byte* tail = utf8 + size;
+
+    Size extra = 0;
+    const Byte* bp = utf8;
+    while (bp != tail) {
+        if (tail - bp >= 8) {
+            uint64_t w;
+            memcpy(&w, bp, 8);
+            if (not Json_Special_Bytes(w)) {
+                bp += 8;
+                continue;
+            }
+        }
+        extra += Json_Escape_Extra(*bp);
+        ++bp;
+    }
+
+    Size old_size = STR_SIZE(s);
+    Length old_len = STR_LEN(s);
+    EXPAND_SERIES_TAIL(s, size + extra + 2);
+
+    Byte* dp = BIN_AT(s, old_size);
+    *dp++ = '"';
+
+    const Byte* run = utf8;
+    bp = utf8;
+    while (bp != tail) {
+        if (tail - bp >= 8) {
+            uint64_t w;
+            memcpy(&w, bp, 8);
+            if (not Json_Special_Bytes(w)) {
+                bp += 8;
+                continue;
+            }
+        }
+
+        Byte b = *bp;
+        if (not Is_Json_Special_Byte(b)) {
+            ++bp;
+            continue;
+        }
+
+        memcpy(dp, run, bp - run);
+        dp += bp - run;
+
+        *dp++ = '\\';
+        switch (b) {
+          case '"': *dp++ = '"'; break;
+          case '\\': *dp++ = '\\'; break;
+          case '\b': *dp++ = 'b'; break;
+          case '\f': *dp++ = 'f'; break;
+          case '\n': *dp++ = 'n'; break;
+          case '\r': *dp++ = 'r'; break;
+          case '\t': *dp++ = 't'; break;
+          default:
+            *dp++ = 'u';
+            *dp++ = '0';
+            *dp++ = '0';
+            *dp++ = "0123456789abcdef"[b >> 4];
+            *dp++ = "0123456789abcdef"[b & 0xF];
+        }
+
+        run = ++bp;
+    }
+    memcpy(dp, run, bp - run);
+    dp += bp - run;
+    *dp++ = '"';
+
+    // The escaped characters and what replaces them are all ASCII, so the
+    // length grows by as much as the size does.
+    //
+    assert(dp == BIN_AT(s, old_size + size + extra + 2));
+    TERM_STR_LEN_SIZE(s, old_len + len + extra + 2, old_size + size + extra + 2);
+}
+
+
+static void Encode_Json_Value(REB_MOLD *mo, Cell(const*) v);
+
+
+// Encode a key of a MAP! or OBJECT! and the colon after it.
+//
+static void Encode_Json_Key(REB_MOLD *mo, Cell(const*) key)
+{
+    enum Reb_Kind heart = CELL_HEART(key);
+    if (
+        QUOTE_BYTE(key) != UNQUOTED_1
+        or not (
+            ANY_STRING_KIND(heart) or heart == REB_ISSUE or ANY_WORD_KIND(heart)
+        )
+    ){
+        fail (Error_Invalid_Type(VAL_TYPE(key)));
+    }
+
+    REBLEN len;
+    Size size;
+    Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, key);
+    Encode_Json_Utf8(mo->series, utf8, size, len);
+    Append_Codepoint(mo->series, ':');
+}
+
+
+//
+//  Encode_Json_Value: C
+//
+static void Encode_Json_Value(REB_MOLD *mo, Cell(const*) v)
+{
+    if (C_STACK_OVERFLOWING(&v))
+        Fail_Stack_Overflow();
+
+    String(*) s = mo->series;
+    enum Reb_Kind heart = CELL_HEART(v);
+    Byte quote_byte = QUOTE_BYTE(v);
+
+    // TRUE, FALSE and NULL are taken as words, quasiforms or isotopes, so
+    // that LOGIC! and NULL fields of objects come out as JSON literals.
+    //
+    if (
+        heart == REB_WORD
+        and (
+            quote_byte == UNQUOTED_1
+            or quote_byte == QUASI_2
+            or quote_byte == ISOTOPE_0
+        )
+    ){
+        switch (VAL_WORD_ID(v)) {
+          case SYM_TRUE:
+            Append_Ascii(s, "true");
+            return;
+
+          case SYM_FALSE:
+            Append_Ascii(s, "false");
+            return;
+
+          case SYM_NULL:
+            Append_Ascii(s, "null");
+            return;
+
+          default:
+            break;
+        }
+    }
+
+    if (quote_byte == ISOTOPE_0) {
+        if (Is_Void(v)) {  // e.g. an unset object field
+            Append_Ascii(s, "null");
+            return;
+        }
+        fail (Error_Bad_Isotope(v));
+    }
+
+    if (quote_byte != UNQUOTED_1)
+        fail (Error_Invalid_Type(VAL_TYPE(v)));
+
+    switch (heart) {
+      case REB_BLANK:
+        Append_Ascii(s, "null");
+        break;
+
+      case REB_INTEGER: {
+        Byte buf[60];
+        REBINT n = Emit_Integer(buf, VAL_INT64(v));
+        Append_Ascii_Len(s, s_cast(buf), n);
+        break; }
+
+      case REB_DECIMAL: {
+        if (not FINITE(VAL_DECIMAL(v)))
+            fail (Error_Overflow_Raw());  // no NaN or infinity in JSON
+        Byte buf[60];
+        REBINT n = Emit_Decimal(buf, VAL_DECIMAL(v), 0, '.', mo->digits);
+        Append_Ascii_Len(s, s_cast(buf), n);
+        break; }
+
+      case REB_BLOCK: {
+        Append_Codepoint(s, '[');
+        Cell(const*) tail;
+        Cell(const*) head = VAL_ARRAY_AT(&tail, v);
+        Cell(const*) item = head;
+        for (; item != tail; ++item) {
+            if (item != head)
+                Append_Codepoint(s, ',');
+            Encode_Json_Value(mo, item);
+        }
+        Append_Codepoint(s, ']');
+        break; }
+
+      case REB_MAP: {
+        Append_Codepoint(s, '{');
+        bool first = true;
+        Array(const*) pairlist = MAP_PAIRLIST(VAL_MAP(v));
+        Cell(const*) tail = ARR_TAIL(pairlist);
+        Cell(const*) key = ARR_HEAD(pairlist);
+        for (; key != tail; key += 2) {
+            if (Is_Void(key + 1))
+                continue;  // removed key, or hole
+            if (not first)
+                Append_Codepoint(s, ',');
+            first = false;
+            Encode_Json_Key(mo, key);
+            Encode_Json_Value(mo, key + 1);
+        }
+        Append_Codepoint(s, '}');
+        break; }
+
+      case REB_OBJECT: {
+        Append_Codepoint(s, '{');
+        bool first = true;
+        EVARS e;
+        Init_Evars(&e, v);
+        while (Did_Advance_Evars(&e)) {
+            if (not first)
+                Append_Codepoint(s, ',');
+            first = false;
+
+            Symbol(const*) symbol = KEY_SYMBOL(e.key);
+            Encode_Json_Utf8(
+                s, STR_HEAD(symbol), STR_SIZE(symbol), STR_LEN(symbol)
+            );
+            Append_Codepoint(s, ':');
+            Encode_Json_Value(mo, e.var);
+        }
+        Shutdown_Evars(&e);
+        Append_Codepoint(s, '}');
+        break; }
+
+      default:
+        if (ANY_STRING_KIND(heart) or heart == REB_ISSUE) {
+            REBLEN len;
+            Size size;
+            Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, v);
+            Encode_Json_Utf8(s, utf8, size, len);
+            break;
+        }
+        fail (Error_Invalid_Type(VAL_TYPE(v)));
+    }
+}
+
+
+//
+//  identify-json?: native [
+//
+//  {Codec for identifying JSON (an object or array at the top level)}
+//
+//      return: [logic?]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(identify_json_q)
+{
+    INCLUDE_PARAMS_OF_IDENTIFY_JSON_Q;
+
+    Size size;
+    const Byte* bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    Json_Decoder d;
+    d.head = d.at = bp;
+    d.tail = bp + size;
+    Json_Skip_Whitespace(&d);
+
+    return Init_Logic(
+        OUT,
+        d.at != d.tail and (*d.at == '{' or *d.at == '[')
+    );
+}
+
+
+//
+//  decode-json: native [
+//
+//  {Codec for decoding JSON into MAP!, BLOCK!, TEXT!, INTEGER! and DECIMAL!}
+//
+//      return: "Null with /NEXT when there are no more elements"
+//          [<opt> element?]
+//      @rest "Position after what was decoded"
+//          [binary! text!]
+//      data "If BINARY!, must be UTF-8 encoded"
+//          [binary! text!]
+//      /next "Decode one element of an array, at its [ or after an element"
+//  ]
+//
+DECLARE_NATIVE(decode_json)
+//
+// /NEXT is for arrays too big to want all at once.  Start at the array's
+// opening bracket, and pass back each position it gives:
+//
+//     pos: data
+//     while [[item pos]: decode-json/next pos] [...]
+//
+{
+    INCLUDE_PARAMS_OF_DECODE_JSON;
+
+    REBVAL *data = ARG(data);
+
+    Size size;
+    const Byte* bp = VAL_BYTES_AT(&size, data);
+
+    Json_Decoder d;
+    d.head = d.at = bp;
+    d.tail = bp + size;
+
+    bool done = false;
+
+    if (REF(next)) {
+        Json_Skip_Whitespace(&d);
+        if (d.at == d.tail)
+            fail (Error_Bad_Json(&d));
+
+        if (*d.at == '[') {  // first element, or the array is empty
+            ++d.at;
+            Json_Skip_Whitespace(&d);
+            if (d.at != d.tail and *d.at == ']') {
+                ++d.at;
+                done = true;
+            }
+        }
+        else if (*d.at == ',')  // element after the one last decoded
+            ++d.at;
+        else if (*d.at == ']') {  // no more elements
+            ++d.at;
+            done = true;
+        }
+        else
+            fail (Error_Bad_Json(&d));
+
+        if (done)
+            Init_Nulled(OUT);
+        else {
+            Decode_Json_Value(&d);
+            Move_Cell(OUT, TOP);
+            DROP();
+        }
+    }
+    else {
+        Decode_Json_Value(&d);
+        Json_Skip_Whitespace(&d);
+        if (d.at != d.tail)
+            fail (Error_Bad_Json(&d));  // more after the value
+
+        Move_Cell(OUT, TOP);
+        DROP();
+    }
+
+    REBVAL *rest = ARG(rest);
+    Copy_Cell(rest, data);
+    if (IS_BINARY(data))
+        VAL_INDEX_UNBOUNDED(rest) = d.at - BIN_HEAD(VAL_BINARY(data));
+    else
+        VAL_INDEX_RAW(rest) += Num_Codepoints_For_Bytes(bp, d.at);
+
+    if (Is_Nulled(OUT))
+        return nullptr;  // don't proxy multi-returns
+
+    return Proxy_Multi_Returns(frame_);
+}
+
+
+//
+//  encode-json: native [
+//
+//  {Codec for encoding MAP!, OBJECT!, BLOCK!, strings and numbers as JSON}
+//
+//      return: [binary!]
+//      value [<opt> element?]
+//  ]
+//
+DECLARE_NATIVE(encode_json)
+{
+    INCLUDE_PARAMS_OF_ENCODE_JSON;
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    Encode_Json_Value(mo, ARG(value));  // null is an isotope, gives "null"
+
+    return Init_Binary(OUT, Pop_Molded_Binary(mo));
+}
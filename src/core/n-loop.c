@@ -688,19 +688,58 @@ struct Loop_Each_State {
     REBSPC *specifier;  // specifier (if applicable)
 };
 
+//
+//  Free_Spare_Loop_Each_States: C
+//
+// Give back the states kept for reuse by Shutdown_Loop_Each().
+//
+void Free_Spare_Loop_Each_States(void)
+{
+    while (TG_Num_Spare_Loop_Each_States != 0) {
+        struct Loop_Each_State *les = cast(struct Loop_Each_State*,
+            TG_Spare_Loop_Each_States[--TG_Num_Spare_Loop_Each_States]
+        );
+        FREE(struct Loop_Each_State, les);
+    }
+}
+
+
 //
 //  Init_Loop_Each: C
 //
+// 1. Loops are often nested, so running an inner loop allocating its state
+//    each time adds up.  Shutdown_Loop_Each() keeps some states for reuse.
+//
+// 2. A TUPLE! or PATH! that isn't compressed is already an array, so it can
+//    be walked in place.  Compressed forms are turned into a BLOCK!, rather
+//    than worry about figuring out how to iterate them.  Review as part of
+//    an overall vetting of "generic iteration" (is a poor substitute for).
+//
+// 3. Contexts and maps are walked directly in their varlist and pairlist, so
+//    enumerating them doesn't make e.g. a block of the keys.
+//
 void Init_Loop_Each(Value(*) iterator, Value(*) data)
 {
-    struct Loop_Each_State *les = TRY_ALLOC(struct Loop_Each_State);
+    struct Loop_Each_State *les;
+    if (TG_Num_Spare_Loop_Each_States != 0)  // see [1]
+        les = cast(struct Loop_Each_State*,
+            TG_Spare_Loop_Each_States[--TG_Num_Spare_Loop_Each_States]
+        );
+    else {
+        les = TRY_ALLOC(struct Loop_Each_State);
+        if (les == nullptr)
+            fail (Error_No_Memory(sizeof(struct Loop_Each_State)));
+    }
 
-    // !!! Temporarily turn any sequences into a BLOCK!, rather than worry
-    // about figuring out how to iterate optimized series.  Review as part of
-    // an overall vetting of "generic iteration" (is a poor substitute for).
-    //
     assert(not Is_Api_Value(data));  // we will free API handles
-    if (ANY_SEQUENCE(data)) {
+    if (
+        ANY_SEQUENCE(data)  // see [2]
+        and not (
+            Get_Cell_Flag(data, SEQUENCE_HAS_NODE)
+            and not Is_Node_A_Cell(VAL_NODE1(data))
+            and SER_FLAVOR(SER(VAL_NODE1(data))) == FLAVOR_ARRAY
+        )
+    ){
         data = rebValue(Canon(AS), Canon(BLOCK_X), rebQ(data));
         rebUnmanage(data);
     }
@@ -725,7 +764,13 @@ void Init_Loop_Each(Value(*) iterator, Value(*) data)
             if (ANY_ARRAY(data))
                 les->specifier = VAL_SPECIFIER(data);
         }
-        else if (ANY_CONTEXT(data)) {
+        else if (ANY_SEQUENCE(data)) {  // array in place, see [2]
+            les->series = ARR(VAL_NODE1(data));
+            les->u.eser.index = 0;
+            les->u.eser.len = VAL_SEQUENCE_LEN(data);  // frozen
+            les->specifier = VAL_SEQUENCE_SPECIFIER(data);
+        }
+        else if (ANY_CONTEXT(data)) {  // see [3]
             les->series = CTX_VARLIST(VAL_CONTEXT(data));
             Init_Evars(&les->u.evars, data);
         }
@@ -757,6 +802,24 @@ void Init_Loop_Each(Value(*) iterator, Value(*) data)
 }
 
 
+//
+//  Limit_Loop_Each: C
+//
+// Stop a series enumeration `len` units after its current position, as for
+// a /PART that was applied with Part_Len_May_Modify_Index().
+//
+static void Limit_Loop_Each(Value(const*) iterator, REBLEN len)
+{
+    struct Loop_Each_State *les;
+    les = VAL_HANDLE_POINTER(struct Loop_Each_State, iterator);
+
+    assert(ANY_SERIES(les->data));
+    if (les->u.eser.index + len < les->u.eser.len)
+        les->u.eser.len = les->u.eser.index + len;
+    les->more_data = (les->u.eser.index < les->u.eser.len);
+}
+
+
 //
 //  Loop_Each_Throws: C
 //
@@ -868,11 +931,11 @@ static bool Try_Loop_Each_Next(Value(const*) iterator, Context(*) vars_ctx)
                 ++les->u.eser.index;
                 if (les->u.eser.index == les->u.eser.len)
                     les->more_data = false;
-                if (not Is_Nulled(val))
+                if (not Is_Void(val))  // void values are removed keys
                     break;
                 if (not les->more_data)
                     return false;
-            } while (Is_Nulled(val));
+            } while (Is_Void(val));
 
             if (var)
                 Copy_Cell(var, key);
@@ -964,7 +1027,10 @@ void Shutdown_Loop_Each(Value(*) iterator)
     if (Is_Api_Value(les->data))  // free data last (used above)
         rebRelease(les->data);
 
-    FREE(struct Loop_Each_State, les);
+    if (TG_Num_Spare_Loop_Each_States < SPARE_LOOP_EACH_STATES)
+        TG_Spare_Loop_Each_States[TG_Num_Spare_Loop_Each_States++] = les;
+    else
+        FREE(struct Loop_Each_State, les);
     Init_Trash(iterator);
 }
 
@@ -983,6 +1049,8 @@ void Shutdown_Loop_Each(Value(*) iterator)
 //           action!]  ; experimental
 //      body "Block to evaluate each time"
 //          [<const> block! meta-block!]
+//      /part "Only traverse a given length or up to a position in the series"
+//          [any-number! any-series!]
 //  ]
 //
 DECLARE_NATIVE(for_each)
@@ -1016,6 +1084,13 @@ DECLARE_NATIVE(for_each)
     if (IS_BLANK(data))  // same response as to empty series
         return VOID;
 
+    REBLEN len = 0;  // only meaningful with /PART
+    if (REF(part)) {  // walk a window of the series without COPY/PART of it
+        if (not ANY_SERIES(data))
+            fail (PARAM(part));
+        len = Part_Len_May_Modify_Index(data, ARG(part));
+    }
+
     Context(*) pseudo_vars_ctx = Virtual_Bind_Deep_To_New_Context(
         ARG(body),  // may be updated, will still be GC safe
         ARG(vars)
@@ -1025,6 +1100,9 @@ DECLARE_NATIVE(for_each)
     Init_Loop_Each(iterator, data);
     Set_Frame_Flag(frame_, NOTIFY_ON_ABRUPT_FAILURE);  // to clean up iterator
 
+    if (REF(part))
+        Limit_Loop_Each(iterator, len);
+
     goto next_iteration;
 
 } next_iteration: {  /////////////////////////////////////////////////////////
@@ -1542,17 +1620,27 @@ DECLARE_NATIVE(remove_each)
 //          [<maybe> blank! any-series! any-sequence! action! any-context!]
 //      body "Block to evaluate each time (result will be kept literally)"
 //          [<const> block!]
+//      <local> result  ; frame must be compatible with MAP
 //  ]
 //
 DECLARE_NATIVE(map_each)
 //
 // MAP-EACH lacks the planned flexibility of MAP.  The syntax of FOR and MAP
 // are intended to be generic to work with generators or a dialect.
+//
+// !!! A MAP-EACH/PARALLEL that split the data across threads has been asked
+// for, for bodies only calling natives without side effects.  But there is
+// no evaluating on more than one thread: the "TG_" globals are not actually
+// thread-local (see TVAR), and series allocation, the GC and symbol interning
+// are all unsynchronized.  "Pure" natives would still allocate (e.g. every
+// TO TEXT! makes a series), so it would need something like V8's isolates--
+// an interpreter instance per thread, with results copied between them.
 {
     INCLUDE_PARAMS_OF_MAP_EACH;
 
     UNUSED(PARAM(vars));
     UNUSED(PARAM(body));
+    UNUSED(PARAM(result));
 
     // The theory is that MAP would use a dialect on BLOCK! arguments for data
     // by default, like [1 thru 10].  But you could give it an arbitrary
@@ -1584,6 +1672,7 @@ DECLARE_NATIVE(map_each)
 //          [<maybe> blank! quoted! action!]
 //      :body "Block to evaluate each time"
 //          [<const> block! meta-block!]
+//      <local> result
 //  ]
 //
 DECLARE_NATIVE(map)
@@ -1598,12 +1687,18 @@ DECLARE_NATIVE(map)
 // 3. MAP and MAP-EACH always return blocks except in cases of BREAK, e.g.
 //    there's no way to detect from the outside if the body never ran.  Review
 //    if variants would be useful (e.g. COLLECT* is NULL if nothing collected)
+//
+// 4. Results go straight into the array that is returned, instead of being
+//    pushed to the data stack and copied out at the end.  When the length of
+//    the data is known, that array is made big enough up front for one value
+//    per iteration.  (Splices or generators just make it expand as usual.)
 {
     INCLUDE_PARAMS_OF_MAP;
 
     Value(*) vars = ARG(vars);  // transformed to context on initial_entry
     Value(*) data = ARG(data);
     Value(*) body = ARG(body);  // bound to vars context on initial_entry
+    Value(*) result = ARG(result);  // block being collected into, see [4]
 
     Value(*) iterator = ARG(return);  // reuse to hold Loop_Each_State
 
@@ -1649,6 +1744,19 @@ DECLARE_NATIVE(map)
     );
     Init_Object(ARG(vars), pseudo_vars_ctx);  // keep GC safe
 
+    REBLEN capacity = 0;  // unknown for a generator
+    if (ANY_SERIES(data) or ANY_PATH(data)) {
+        REBLEN len = ANY_SERIES(data)
+            ? VAL_LEN_AT(data)
+            : VAL_SEQUENCE_LEN(data);
+        Count num_vars = CTX_LEN(pseudo_vars_ctx);
+        capacity = (len + num_vars - 1) / num_vars;  // one value per run
+    }
+    else if (ANY_CONTEXT(data))
+        capacity = CTX_LEN(VAL_CONTEXT(data));  // one key per run
+
+    Init_Block(result, Make_Array_Core(capacity, NODE_FLAG_MANAGED));
+
     Init_Loop_Each(iterator, data);
     Set_Frame_Flag(frame_, NOTIFY_ON_ABRUPT_FAILURE);  // to clean up iterator
 
@@ -1680,12 +1788,14 @@ DECLARE_NATIVE(map)
     if (Is_Void(SPARE))
         goto next_iteration;  // okay to skip
 
+    Array(*) a = VAL_ARRAY_KNOWN_MUTABLE(result);
+
     if (Is_Splice(SPARE)) {
         Quasify_Isotope(SPARE);
         Cell(const*) tail;
         Cell(const*) v = VAL_ARRAY_AT(&tail, SPARE);
         for (; v != tail; ++v)
-            Derelativize(PUSH(), v, VAL_SPECIFIER(SPARE));
+            Derelativize(Alloc_Tail_Array(a), v, VAL_SPECIFIER(SPARE));
     }
     else if (Is_Isotope(SPARE)) {
         Init_Error(SPARE, Error_Bad_Isotope(SPARE));
@@ -1696,7 +1806,7 @@ DECLARE_NATIVE(map)
         fail (Error_Need_Non_Null_Raw());
     }
     else
-        Copy_Cell(PUSH(), SPARE);  // non nulls added to result
+        Copy_Cell(Alloc_Tail_Array(a), SPARE);  // non nulls added to result
 
     goto next_iteration;
 
@@ -1705,18 +1815,14 @@ DECLARE_NATIVE(map)
     Shutdown_Loop_Each(iterator);
 
     if (THROWING)
-        return THROWN;  // automatically drops to baseline
+        return THROWN;
 
     if (not Is_Fresh(OUT)) {  // only modifies on break
         assert(Is_Nulled(OUT));  // BREAK, so *must* return null
-        Drop_Data_Stack_To(STACK_BASE);
         return nullptr;
     }
 
-    return Init_Block(  // always returns block unless break, see [3]
-        OUT,
-        Pop_Stack_Values(STACK_BASE)
-    );
+    return COPY(result);  // always returns block unless break, see [3]
 }}
 
 
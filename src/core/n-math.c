@@ -909,6 +909,269 @@ DECLARE_NATIVE(minimum)
 }
 
 
+// What the items of a block passed to SUM, PRODUCT, etc. have in common.
+// Blocks of just INTEGER! and DECIMAL! are done with C math in a loop, and
+// anything else goes through the same natives a loop in usermode would use.
+//
+enum Reb_Numbers_Kind {
+    NUMBERS_INTEGER,  // all INTEGER!
+    NUMBERS_DECIMAL,  // all INTEGER! or DECIMAL!, at least one DECIMAL!
+    NUMBERS_OTHER
+};
+
+static enum Reb_Numbers_Kind Numbers_Kind(
+    Cell(const*) item,
+    Cell(const*) tail
+){
+    enum Reb_Numbers_Kind kind = NUMBERS_INTEGER;
+    for (; item != tail; ++item) {
+        if (IS_INTEGER(item))
+            continue;
+        if (not IS_DECIMAL(item))
+            return NUMBERS_OTHER;
+        kind = NUMBERS_DECIMAL;
+    }
+    return kind;
+}
+
+inline static REBDEC Number_As_Decimal(Cell(const*) v) {
+    return IS_INTEGER(v) ? cast(REBDEC, VAL_INT64(v)) : VAL_DECIMAL(v);
+}
+
+
+// Fold the items with an action that takes two arguments (e.g. ADD), for
+// blocks that aren't just INTEGER! and DECIMAL!.  OUT must hold the first.
+//
+static void Fold_Numbers_Generic(
+    Frame(*) frame_,
+    Symbol(const*) action,
+    Cell(const*) item,
+    Cell(const*) tail,
+    REBSPC *specifier
+){
+    for (; item != tail; ++item) {
+        Derelativize(SPARE, item, specifier);
+        REBVAL *result = rebValue(action, rebQ(OUT), rebQ(SPARE));
+        Copy_Cell(OUT, result);
+        rebRelease(result);
+    }
+}
+
+
+// Shared by SUM and MEAN.  Integer sums have the overflow checking of ADD.
+//
+static void Sum_Numbers(
+    Frame(*) frame_,
+    Cell(const*) item,
+    Cell(const*) tail,
+    REBSPC *specifier
+){
+    switch (Numbers_Kind(item, tail)) {
+      case NUMBERS_INTEGER: {
+        REBI64 sum = 0;
+        for (; item != tail; ++item) {
+            if (REB_I64_ADD_OF(sum, VAL_INT64(item), &sum))
+                fail (Error_Overflow_Raw());
+        }
+        Init_Integer(OUT, sum);
+        break; }
+
+      case NUMBERS_DECIMAL: {
+        REBDEC sum = 0.0;
+        for (; item != tail; ++item)
+            sum += Number_As_Decimal(item);
+        Init_Decimal(OUT, sum);
+        break; }
+
+      case NUMBERS_OTHER:  // (empty blocks are NUMBERS_INTEGER)
+        Derelativize(OUT, item, specifier);
+        Fold_Numbers_Generic(frame_, Canon(ADD), item + 1, tail, specifier);
+        break;
+    }
+}
+
+
+//
+//  sum: native [
+//
+//  "Returns the sum of the values in a block (0 if empty)"
+//
+//      return: [any-scalar!]
+//      values [block!]
+//  ]
+//
+DECLARE_NATIVE(sum)
+{
+    INCLUDE_PARAMS_OF_SUM;
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(values));
+
+    Sum_Numbers(frame_, item, tail, VAL_SPECIFIER(ARG(values)));
+    return OUT;
+}
+
+
+//
+//  product: native [
+//
+//  "Returns the product of the values in a block (1 if empty)"
+//
+//      return: [any-scalar!]
+//      values [block!]
+//  ]
+//
+DECLARE_NATIVE(product)
+{
+    INCLUDE_PARAMS_OF_PRODUCT;
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(values));
+
+    switch (Numbers_Kind(item, tail)) {
+      case NUMBERS_INTEGER: {
+        REBI64 product = 1;
+        for (; item != tail; ++item) {
+            if (REB_I64_MUL_OF(product, VAL_INT64(item), &product))
+                fail (Error_Overflow_Raw());
+        }
+        return Init_Integer(OUT, product); }
+
+      case NUMBERS_DECIMAL: {
+        REBDEC product = 1.0;
+        for (; item != tail; ++item)
+            product *= Number_As_Decimal(item);
+        return Init_Decimal(OUT, product); }
+
+      case NUMBERS_OTHER:  // (empty blocks are NUMBERS_INTEGER)
+        break;
+    }
+
+    REBSPC *specifier = VAL_SPECIFIER(ARG(values));
+    Derelativize(OUT, item, specifier);
+    Fold_Numbers_Generic(frame_, Canon(MULTIPLY), item + 1, tail, specifier);
+    return OUT;
+}
+
+
+// Shared by MAX-OF and MIN-OF.  The item itself is returned, so the type of
+// the winner is kept when comparing INTEGER! with DECIMAL!.  Ties go to the
+// first, as with MAXIMUM and MINIMUM.
+//
+static Bounce Extreme_Of_Numbers(Frame(*) frame_, bool maximum)
+{
+    INCLUDE_PARAMS_OF_MAX_OF;  // MIN-OF has the same parameters
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(values));
+    REBSPC *specifier = VAL_SPECIFIER(ARG(values));
+
+    if (item == tail)
+        return nullptr;
+
+    Cell(const*) best = item;
+
+    switch (Numbers_Kind(item, tail)) {
+      case NUMBERS_INTEGER: {
+        REBI64 best_int = VAL_INT64(best);
+        for (++item; item != tail; ++item) {
+            REBI64 i = VAL_INT64(item);
+            if (maximum ? i > best_int : i < best_int) {
+                best_int = i;
+                best = item;
+            }
+        }
+        break; }
+
+      case NUMBERS_DECIMAL: {
+        REBDEC best_dec = Number_As_Decimal(best);
+        for (++item; item != tail; ++item) {
+            REBDEC d = Number_As_Decimal(item);
+            if (maximum ? d > best_dec : d < best_dec) {
+                best_dec = d;
+                best = item;
+            }
+        }
+        break; }
+
+      case NUMBERS_OTHER:
+        Derelativize(OUT, item, specifier);
+        Fold_Numbers_Generic(
+            frame_,
+            maximum ? Canon(MAXIMUM) : Canon(MINIMUM),
+            item + 1,
+            tail,
+            specifier
+        );
+        return OUT;
+    }
+
+    return Derelativize(OUT, best, specifier);
+}
+
+
+//
+//  max-of: native [
+//
+//  "Returns the greatest of the values in a block (null if empty)"
+//
+//      return: [<opt> any-scalar! date! any-series!]
+//      values [block!]
+//  ]
+//
+DECLARE_NATIVE(max_of)
+{
+    return Extreme_Of_Numbers(frame_, true);
+}
+
+
+//
+//  min-of: native [
+//
+//  "Returns the least of the values in a block (null if empty)"
+//
+//      return: [<opt> any-scalar! date! any-series!]
+//      values [block!]
+//  ]
+//
+DECLARE_NATIVE(min_of)
+{
+    return Extreme_Of_Numbers(frame_, false);
+}
+
+
+//
+//  mean: native [
+//
+//  "Returns the arithmetic mean of the values in a block (null if empty)"
+//
+//      return: [<opt> any-scalar!]
+//      values [block!]
+//  ]
+//
+DECLARE_NATIVE(mean)
+{
+    INCLUDE_PARAMS_OF_MEAN;
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(values));
+
+    if (item == tail)
+        return nullptr;
+
+    REBLEN count = tail - item;
+    Sum_Numbers(frame_, item, tail, VAL_SPECIFIER(ARG(values)));
+
+    if (IS_DECIMAL(OUT))
+        return Init_Decimal(OUT, VAL_DECIMAL(OUT) / count);
+
+    REBVAL *mean = rebValue(Canon(DIVIDE), rebQ(OUT), rebI(count));
+    Copy_Cell(OUT, mean);
+    rebRelease(mean);
+    return OUT;
+}
+
+
 inline static REBVAL *Init_Zeroed_Hack(Cell(*) out, enum Reb_Kind kind) {
     //
     // !!! This captures of a dodgy behavior of R3-Alpha, which was to assume
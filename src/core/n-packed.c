@@ -0,0 +1,828 @@
+//
+//  File: %n-packed.c
+//  Summary: "native functions for numbers packed in BINARY!"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2026 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A BLOCK! of INTEGER! or DECIMAL! takes a whole cell per number, and the GC
+// has to look at every one.  These natives work on numbers packed into a
+// BINARY! instead, as C integers or floats of a given type:
+//
+//     >> data: pack-numbers 'int16 [1 2 3 -4]
+//     == #{0100020003000CFF}  ; (on a little-endian machine)
+//
+//     >> packed-reduce 'int16 'add data
+//     == 2
+//
+//     >> unpack-numbers 'int16 packed-arithmetic 'int16 'multiply data 10
+//     == [10 20 30 -40]
+//
+// The element types are INT8, INT16, INT32, INT64, UINT8, UINT16, UINT32,
+// FLOAT32 and FLOAT64.  Elements are in the machine's byte order (use ENBIN
+// and DEBIN, or PACK-RECORD and UNPACK-RECORD, for data with a particular
+// byte order).
+//
+//=//// NOTES //////////////////////////////////////////////////////////////=//
+//
+// * The loops over the data are written once per element type, so each is a
+//   simple loop over C values that compilers can vectorize.  Elements are
+//   read and written with memcpy(), since a BINARY! at an arbitrary index
+//   need not be aligned for the element type.
+//
+// * Integer results that don't fit in the element type are errors, as with
+//   INTEGER! math.  Integer division truncates, as in C.
+//
+// * This is not a VECTOR! datatype: the binary doesn't know its element type,
+//   so each native is told it.
+//
+
+#include "sys-core.h"
+
+#include <float.h>  // FLT_MAX, for f32 fields of PACK-RECORD
+
+enum Reb_Packed_Kind {
+    PACKED_INT8,
+    PACKED_INT16,
+    PACKED_INT32,
+    PACKED_INT64,
+    PACKED_UINT8,
+    PACKED_UINT16,
+    PACKED_UINT32,
+    PACKED_FLOAT32,
+    PACKED_FLOAT64
+};
+
+// Run the statements given with `elem` as a typedef for the C type of the
+// packed kind.  Each case compiles to its own loop over that type.
+//
+#define SWITCH_PACKED_KIND(kind, ...) \
+    switch (kind) { \
+      case PACKED_INT8: { typedef int8_t elem; __VA_ARGS__ } break; \
+      case PACKED_INT16: { typedef int16_t elem; __VA_ARGS__ } break; \
+      case PACKED_INT32: { typedef int32_t elem; __VA_ARGS__ } break; \
+      case PACKED_INT64: { typedef int64_t elem; __VA_ARGS__ } break; \
+      case PACKED_UINT8: { typedef uint8_t elem; __VA_ARGS__ } break; \
+      case PACKED_UINT16: { typedef uint16_t elem; __VA_ARGS__ } break; \
+      case PACKED_UINT32: { typedef uint32_t elem; __VA_ARGS__ } break; \
+      case PACKED_FLOAT32: { typedef float elem; __VA_ARGS__ } break; \
+      case PACKED_FLOAT64: { typedef double elem; __VA_ARGS__ } break; \
+      default: assert(false); \
+    }
+
+#define Is_Packed_Float(kind) \
+    ((kind) == PACKED_FLOAT32 or (kind) == PACKED_FLOAT64)
+
+
+static enum Reb_Packed_Kind Packed_Kind_From_Word(
+    Size *wide,
+    const REBVAL *word
+){
+    switch (VAL_WORD_ID(word)) {
+      case SYM_INT8: *wide = 1; return PACKED_INT8;
+      case SYM_INT16: *wide = 2; return PACKED_INT16;
+      case SYM_INT32: *wide = 4; return PACKED_INT32;
+      case SYM_INT64: *wide = 8; return PACKED_INT64;
+      case SYM_UINT8: *wide = 1; return PACKED_UINT8;
+      case SYM_UINT16: *wide = 2; return PACKED_UINT16;
+      case SYM_UINT32: *wide = 4; return PACKED_UINT32;
+      case SYM_FLOAT32: *wide = 4; return PACKED_FLOAT32;
+      case SYM_FLOAT64: *wide = 8; return PACKED_FLOAT64;
+      default: break;
+    }
+    fail (word);
+}
+
+
+// Range of values an integer kind can hold.
+//
+static void Packed_Int_Limits(
+    REBI64 *min,
+    REBI64 *max,
+    enum Reb_Packed_Kind kind
+){
+    switch (kind) {
+      case PACKED_INT8: *min = INT8_MIN; *max = INT8_MAX; break;
+      case PACKED_INT16: *min = INT16_MIN; *max = INT16_MAX; break;
+      case PACKED_INT32: *min = INT32_MIN; *max = INT32_MAX; break;
+      case PACKED_INT64: *min = INT64_MIN; *max = INT64_MAX; break;
+      case PACKED_UINT8: *min = 0; *max = UINT8_MAX; break;
+      case PACKED_UINT16: *min = 0; *max = UINT16_MAX; break;
+      case PACKED_UINT32: *min = 0; *max = UINT32_MAX; break;
+      default: assert(false);
+    }
+}
+
+
+// Data of a BINARY! at its index, which has to hold a whole number of
+// elements.
+//
+static const Byte* Packed_Data_At(
+    REBLEN *count,
+    const REBVAL *binary,
+    Size wide
+){
+    Size size;
+    const Byte* data = VAL_BINARY_SIZE_AT(&size, binary);
+    if (size % wide != 0)
+        fail (Error_Bad_Value(binary));
+    *count = size / wide;
+    return data;
+}
+
+
+//
+//  pack-numbers: native [
+//
+//  {Make a BINARY! of numbers packed as C integers or floats of a given type}
+//
+//      return: [binary!]
+//      type "INT8, INT16, INT32, INT64, UINT8, UINT16, UINT32, FLOAT32, FLOAT64"
+//          [word!]
+//      values [block!]
+//  ]
+//
+DECLARE_NATIVE(pack_numbers)
+{
+    INCLUDE_PARAMS_OF_PACK_NUMBERS;
+
+    Size wide;
+    enum Reb_Packed_Kind kind = Packed_Kind_From_Word(&wide, ARG(type));
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(values));
+
+    REBLEN count = tail - item;
+    Binary(*) bin = Make_Binary(count * wide);
+    Byte* bp = BIN_HEAD(bin);
+
+    REBI64 min = 0;
+    REBI64 max = 0;
+    if (not Is_Packed_Float(kind))
+        Packed_Int_Limits(&min, &max, kind);
+
+    for (; item != tail; ++item, bp += wide) {
+        if (Is_Packed_Float(kind)) {
+            REBDEC d;
+            if (IS_INTEGER(item))
+                d = cast(REBDEC, VAL_INT64(item));
+            else if (IS_DECIMAL(item))
+                d = VAL_DECIMAL(item);
+            else
+                fail (Error_Bad_Value(item));
+
+            SWITCH_PACKED_KIND(kind,
+                elem e = cast(elem, d);
+                memcpy(bp, &e, sizeof(elem));
+            );
+            continue;
+        }
+
+        if (not IS_INTEGER(item))
+            fail (Error_Bad_Value(item));
+
+        REBI64 i = VAL_INT64(item);
+        if (i < min or i > max)
+            fail (Error_Out_Of_Range(item));
+
+        SWITCH_PACKED_KIND(kind,
+            elem e = cast(elem, i);
+            memcpy(bp, &e, sizeof(elem));
+        );
+    }
+
+    TERM_BIN_LEN(bin, count * wide);
+    return Init_Binary(OUT, bin);
+}
+
+
+//
+//  unpack-numbers: native [
+//
+//  {Make a BLOCK! of the numbers packed in a BINARY! (see PACK-NUMBERS)}
+//
+//      return: [block!]
+//      type "INT8, INT16, INT32, INT64, UINT8, UINT16, UINT32, FLOAT32, FLOAT64"
+//          [word!]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(unpack_numbers)
+{
+    INCLUDE_PARAMS_OF_UNPACK_NUMBERS;
+
+    Size wide;
+    enum Reb_Packed_Kind kind = Packed_Kind_From_Word(&wide, ARG(type));
+
+    REBLEN count;
+    const Byte* bp = Packed_Data_At(&count, ARG(data), wide);
+
+    Array(*) a = Make_Array(count);
+    Cell(*) dest = ARR_HEAD(a);
+
+    REBLEN n;
+    for (n = 0; n < count; ++n, bp += wide, ++dest) {
+        SWITCH_PACKED_KIND(kind,
+            elem e;
+            memcpy(&e, bp, sizeof(elem));
+            if (Is_Packed_Float(kind))
+                Init_Decimal(dest, cast(REBDEC, e));
+            else
+                Init_Integer(dest, cast(REBI64, e));
+        );
+    }
+
+    SET_SERIES_LEN(a, count);
+    return Init_Block(OUT, a);
+}
+
+
+//
+//  packed-arithmetic: native [
+//
+//  {Do math on each number packed in a BINARY! (see PACK-NUMBERS)}
+//
+//      return: [binary!]
+//      type "INT8, INT16, INT32, INT64, UINT8, UINT16, UINT32, FLOAT32, FLOAT64"
+//          [word!]
+//      operator "ADD, SUBTRACT, MULTIPLY or DIVIDE"
+//          [word!]
+//      value1 [binary!]
+//      value2 "Packed numbers of the same count, or one number for all"
+//          [binary! integer! decimal!]
+//  ]
+//
+DECLARE_NATIVE(packed_arithmetic)
+{
+    INCLUDE_PARAMS_OF_PACKED_ARITHMETIC;
+
+    Size wide;
+    enum Reb_Packed_Kind kind = Packed_Kind_From_Word(&wide, ARG(type));
+    bool is_float = Is_Packed_Float(kind);
+
+    Option(SymId) op = VAL_WORD_ID(ARG(operator));
+    if (
+        op != SYM_ADD and op != SYM_SUBTRACT
+        and op != SYM_MULTIPLY and op != SYM_DIVIDE
+    ){
+        fail (PARAM(operator));
+    }
+
+    REBLEN count;
+    const Byte* a = Packed_Data_At(&count, ARG(value1), wide);
+
+    const Byte* b = nullptr;  // stays null if value2 is a single number
+    REBI64 b_int = 0;
+    REBDEC b_dec = 0;
+    if (IS_BINARY(ARG(value2))) {
+        REBLEN count2;
+        b = Packed_Data_At(&count2, ARG(value2), wide);
+        if (count2 != count)
+            fail (Error_Bad_Value(ARG(value2)));
+    }
+    else if (IS_INTEGER(ARG(value2))) {
+        b_int = VAL_INT64(ARG(value2));
+        b_dec = cast(REBDEC, b_int);
+    }
+    else if (is_float)
+        b_dec = VAL_DECIMAL(ARG(value2));
+    else
+        fail (PARAM(value2));  // no rounding DECIMAL! for integer elements
+
+    REBI64 min = 0;
+    REBI64 max = 0;
+    if (not is_float)
+        Packed_Int_Limits(&min, &max, kind);
+
+    Binary(*) bin = Make_Binary(count * wide);
+    Byte* out = BIN_HEAD(bin);
+
+    // Integers are done in 64-bits and range checked, so an overflow only
+    // has to be checked for in 64-bit math on INT64 elements.
+    //
+    REBLEN n;
+    SWITCH_PACKED_KIND(kind,
+        for (n = 0; n < count; ++n) {
+            elem x;
+            memcpy(&x, a + n * sizeof(elem), sizeof(elem));
+
+            elem r;
+            if (is_float) {
+                REBDEC y = b_dec;
+                if (b) {
+                    elem e;
+                    memcpy(&e, b + n * sizeof(elem), sizeof(elem));
+                    y = cast(REBDEC, e);
+                }
+                switch (op) {
+                  case SYM_ADD: r = cast(elem, x + y); break;
+                  case SYM_SUBTRACT: r = cast(elem, x - y); break;
+                  case SYM_MULTIPLY: r = cast(elem, x * y); break;
+                  default: r = cast(elem, x / y); break;
+                }
+            }
+            else {
+                REBI64 y = b_int;
+                if (b) {
+                    elem e;
+                    memcpy(&e, b + n * sizeof(elem), sizeof(elem));
+                    y = cast(REBI64, e);
+                }
+                REBI64 i;
+                switch (op) {
+                  case SYM_ADD:
+                    if (REB_I64_ADD_OF(cast(REBI64, x), y, &i))
+                        fail (Error_Overflow_Raw());
+                    break;
+                  case SYM_SUBTRACT:
+                    if (REB_I64_SUB_OF(cast(REBI64, x), y, &i))
+                        fail (Error_Overflow_Raw());
+                    break;
+                  case SYM_MULTIPLY:
+                    if (REB_I64_MUL_OF(cast(REBI64, x), y, &i))
+                        fail (Error_Overflow_Raw());
+                    break;
+                  default:
+                    if (y == 0)
+                        fail (Error_Zero_Divide_Raw());
+                    if (y == -1 and cast(REBI64, x) == INT64_MIN)
+                        fail (Error_Overflow_Raw());
+                    i = cast(REBI64, x) / y;
+                    break;
+                }
+                if (i < min or i > max)
+                    fail (Error_Overflow_Raw());
+                r = cast(elem, i);
+            }
+            memcpy(out + n * sizeof(elem), &r, sizeof(elem));
+        }
+    );
+
+    TERM_BIN_LEN(bin, count * wide);
+    return Init_Binary(OUT, bin);
+}
+
+
+//
+//  packed-reduce: native [
+//
+//  {Sum, maximum or minimum of the numbers packed in a BINARY!}
+//
+//      return: "Null if there are no numbers (unless the operator is ADD)"
+//          [<opt> integer! decimal!]
+//      type "INT8, INT16, INT32, INT64, UINT8, UINT16, UINT32, FLOAT32, FLOAT64"
+//          [word!]
+//      operator "ADD, MAXIMUM or MINIMUM"
+//          [word!]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(packed_reduce)
+{
+    INCLUDE_PARAMS_OF_PACKED_REDUCE;
+
+    Size wide;
+    enum Reb_Packed_Kind kind = Packed_Kind_From_Word(&wide, ARG(type));
+    bool is_float = Is_Packed_Float(kind);
+
+    Option(SymId) op = VAL_WORD_ID(ARG(operator));
+    if (op != SYM_ADD and op != SYM_MAXIMUM and op != SYM_MINIMUM)
+        fail (PARAM(operator));
+
+    REBLEN count;
+    const Byte* data = Packed_Data_At(&count, ARG(data), wide);
+
+    if (count == 0) {
+        if (op != SYM_ADD)
+            return nullptr;
+        return is_float ? Init_Decimal(OUT, 0.0) : Init_Integer(OUT, 0);
+    }
+
+    REBLEN n;
+    if (op == SYM_ADD) {
+        if (is_float) {
+            REBDEC sum = 0.0;
+            SWITCH_PACKED_KIND(kind,
+                for (n = 0; n < count; ++n) {
+                    elem e;
+                    memcpy(&e, data + n * sizeof(elem), sizeof(elem));
+                    sum += e;
+                }
+            );
+            return Init_Decimal(OUT, sum);
+        }
+
+        REBI64 sum = 0;
+        if (kind == PACKED_INT64) {  // only one that can overflow 64 bits
+            for (n = 0; n < count; ++n) {
+                int64_t e;
+                memcpy(&e, data + n * sizeof(int64_t), sizeof(int64_t));
+                if (REB_I64_ADD_OF(sum, e, &sum))
+                    fail (Error_Overflow_Raw());
+            }
+        }
+        else SWITCH_PACKED_KIND(kind,
+            for (n = 0; n < count; ++n) {
+                elem e;
+                memcpy(&e, data + n * sizeof(elem), sizeof(elem));
+                sum += e;
+            }
+        );
+        return Init_Integer(OUT, sum);
+    }
+
+    bool maximum = (op == SYM_MAXIMUM);
+    SWITCH_PACKED_KIND(kind,
+        elem best;
+        memcpy(&best, data, sizeof(elem));
+        for (n = 1; n < count; ++n) {
+            elem e;
+            memcpy(&e, data + n * sizeof(elem), sizeof(elem));
+            if (maximum ? e > best : e < best)
+                best = e;
+        }
+        if (is_float)
+            Init_Decimal(OUT, cast(REBDEC, best));
+        else
+            Init_Integer(OUT, cast(REBI64, best));
+    );
+    return OUT;
+}
+
+
+//
+//  packed-dot: native [
+//
+//  {Dot product of two BINARY!s of the same count of packed numbers}
+//
+//      return: [integer! decimal!]
+//      type "INT8, INT16, INT32, INT64, UINT8, UINT16, UINT32, FLOAT32, FLOAT64"
+//          [word!]
+//      value1 [binary!]
+//      value2 [binary!]
+//  ]
+//
+DECLARE_NATIVE(packed_dot)
+{
+    INCLUDE_PARAMS_OF_PACKED_DOT;
+
+    Size wide;
+    enum Reb_Packed_Kind kind = Packed_Kind_From_Word(&wide, ARG(type));
+
+    REBLEN count;
+    const Byte* a = Packed_Data_At(&count, ARG(value1), wide);
+    REBLEN count2;
+    const Byte* b = Packed_Data_At(&count2, ARG(value2), wide);
+    if (count2 != count)
+        fail (Error_Bad_Value(ARG(value2)));
+
+    REBLEN n;
+    if (Is_Packed_Float(kind)) {
+        REBDEC dot = 0.0;
+        SWITCH_PACKED_KIND(kind,
+            for (n = 0; n < count; ++n) {
+                elem x;
+                memcpy(&x, a + n * sizeof(elem), sizeof(elem));
+                elem y;
+                memcpy(&y, b + n * sizeof(elem), sizeof(elem));
+                dot += cast(REBDEC, x) * y;
+            }
+        );
+        return Init_Decimal(OUT, dot);
+    }
+
+    // Products of 32-bit or smaller elements fit in 64 bits, but the sum of
+    // them (or any INT64 product) may not.
+    //
+    REBI64 dot = 0;
+    SWITCH_PACKED_KIND(kind,
+        for (n = 0; n < count; ++n) {
+            elem x;
+            memcpy(&x, a + n * sizeof(elem), sizeof(elem));
+            elem y;
+            memcpy(&y, b + n * sizeof(elem), sizeof(elem));
+            REBI64 product;
+            if (REB_I64_MUL_OF(cast(REBI64, x), cast(REBI64, y), &product))
+                fail (Error_Overflow_Raw());
+            if (REB_I64_ADD_OF(dot, product, &dot))
+                fail (Error_Overflow_Raw());
+        }
+    );
+    return Init_Integer(OUT, dot);
+}
+
+
+//=//// RECORDS ////////////////////////////////////////////////////////////=//
+//
+// ENBIN and DEBIN make a settings block and a BINARY! per integer, so a
+// protocol record with many fields is a lot of COPY/PART and DEBIN calls.
+// PACK-RECORD and UNPACK-RECORD take a spec of the whole record, like:
+//
+//     [u16be u32le f64be bytes 12]
+//
+// ...and read or write all the fields straight to or from the bytes at the
+// binary's index, in the byte order each field names.  Integer fields are
+// INTEGER! (so a u64 over 63 bits is out of range), floating point fields
+// are DECIMAL!, and `bytes N` is a BINARY! of exactly N bytes.  Port buffers
+// are BINARY!, so this works on them too.
+//
+
+struct Record_Field {
+    const char *name;
+    Byte size;  // 0 means the size is the INTEGER! after it in the spec
+    char kind;  // 'u'nsigned, 's'igned, 'f'loating point, or 'b'ytes
+    bool little;
+};
+
+static const struct Record_Field Record_Fields[] = {
+    {"u8", 1, 'u', true}, {"s8", 1, 's', true},
+    {"u16le", 2, 'u', true}, {"u16be", 2, 'u', false},
+    {"s16le", 2, 's', true}, {"s16be", 2, 's', false},
+    {"u32le", 4, 'u', true}, {"u32be", 4, 'u', false},
+    {"s32le", 4, 's', true}, {"s32be", 4, 's', false},
+    {"u64le", 8, 'u', true}, {"u64be", 8, 'u', false},
+    {"s64le", 8, 's', true}, {"s64be", 8, 's', false},
+    {"f32le", 4, 'f', true}, {"f32be", 4, 'f', false},
+    {"f64le", 8, 'f', true}, {"f64be", 8, 'f', false},
+    {"bytes", 0, 'b', false},
+    {nullptr, 0, '\0', false}
+};
+
+
+// Get the field at `*at` in a record spec, and step past it.
+//
+static const struct Record_Field *Next_Record_Field(
+    Size *size_out,
+    Cell(const*) *at,
+    Cell(const*) tail
+){
+    Cell(const*) item = *at;
+    if (not IS_WORD(item))
+        fail (Error_Bad_Value(item));
+
+    const char *spelling = STR_UTF8(VAL_WORD_SYMBOL(item));
+    const struct Record_Field *field = Record_Fields;
+    for (; field->name; ++field) {
+        if (0 == strcmp(field->name, spelling))
+            break;
+    }
+    if (not field->name)
+        fail (Error_Bad_Value(item));
+
+    ++item;
+    if (field->kind != 'b')
+        *size_out = field->size;
+    else {
+        if (item == tail or not IS_INTEGER(item) or VAL_INT64(item) < 0)
+            fail ("BYTES in a record spec must be followed by a size");
+        *size_out = VAL_INT64(item);
+        ++item;
+    }
+
+    *at = item;
+    return field;
+}
+
+
+static Size Record_Spec_Size(const REBVAL *spec)
+{
+    Cell(const*) tail;
+    Cell(const*) at = VAL_ARRAY_AT(&tail, spec);
+
+    Size total = 0;
+    while (at != tail) {
+        Size size;
+        Next_Record_Field(&size, &at, tail);
+        total += size;
+    }
+    return total;
+}
+
+
+//
+//  unpack-record: native [
+//
+//  {Decode a record of fixed-width fields from a BINARY!}
+//
+//      return: "INTEGER!, DECIMAL!, or BINARY! for each field"
+//          [block!]
+//      @rest "The binary after the record"
+//          [binary!]
+//      spec "Fields, e.g. [u8 s16le u32be f64le bytes 12]"
+//          [block!]
+//      binary "Record starts at the index"
+//          [binary!]
+//  ]
+//
+DECLARE_NATIVE(unpack_record)
+{
+    INCLUDE_PARAMS_OF_UNPACK_RECORD;
+
+    Size bin_size;
+    const Byte* bp = VAL_BINARY_SIZE_AT(&bin_size, ARG(binary));
+
+    Size total = Record_Spec_Size(ARG(spec));
+    if (total > bin_size)
+        fail (Error_Index_Out_Of_Range_Raw());
+
+    Cell(const*) tail;
+    Cell(const*) at = VAL_ARRAY_AT(&tail, ARG(spec));
+
+    StackIndex base = TOP_INDEX;
+
+    while (at != tail) {
+        Size size;
+        const struct Record_Field *field = Next_Record_Field(&size, &at, tail);
+
+        if (field->kind == 'b') {
+            Binary(*) bin = Make_Binary(size);
+            memcpy(BIN_HEAD(bin), bp, size);
+            TERM_BIN_LEN(bin, size);
+            Init_Binary(PUSH(), bin);
+            bp += size;
+            continue;
+        }
+
+        uint64_t u = 0;
+        Size i;
+        for (i = 0; i < size; ++i) {
+            Byte b = bp[field->little ? i : size - 1 - i];
+            u |= cast(uint64_t, b) << (8 * i);
+        }
+        bp += size;
+
+        switch (field->kind) {
+          case 'u':
+            if (u > INT64_MAX)
+                fail (Error_Out_Of_Range(ARG(binary)));
+            Init_Integer(PUSH(), u);
+            break;
+
+          case 's':
+            if (size < 8 and (u >> (8 * size - 1)))
+                u |= UINT64_MAX << (8 * size);  // sign extend
+            Init_Integer(PUSH(), cast(REBI64, u));
+            break;
+
+          case 'f':
+            if (size == 4) {
+                uint32_t bits = cast(uint32_t, u);
+                float f;
+                memcpy(&f, &bits, 4);
+                Init_Decimal(PUSH(), f);
+            }
+            else {
+                double d;
+                memcpy(&d, &u, 8);
+                Init_Decimal(PUSH(), d);
+            }
+            break;
+
+          default:
+            assert(false);
+        }
+    }
+
+    Copy_Cell(ARG(rest), ARG(binary));
+    VAL_INDEX_UNBOUNDED(ARG(rest)) += total;
+
+    Init_Block(OUT, Pop_Stack_Values(base));
+    return Proxy_Multi_Returns(frame_);
+}
+
+
+//
+//  pack-record: native [
+//
+//  {Encode values as a record of fixed-width fields in a BINARY!}
+//
+//      return: "New binary, or with /INTO the position after the record"
+//          [binary!]
+//      spec "Fields, e.g. [u8 s16le u32be f64le bytes 12]"
+//          [block!]
+//      values "One value per field (pre-REDUCE'd)"
+//          [block!]
+//      /into "Write over this binary at its index, extending it if needed"
+//          [binary!]
+//  ]
+//
+DECLARE_NATIVE(pack_record)
+{
+    INCLUDE_PARAMS_OF_PACK_RECORD;
+
+    Size total = Record_Spec_Size(ARG(spec));
+
+    Binary(*) bin;
+    Size offset;
+    if (REF(into)) {
+        bin = VAL_BINARY_ENSURE_MUTABLE(ARG(into));
+        offset = VAL_INDEX(ARG(into));
+        if (offset + total > BIN_LEN(bin))
+            EXPAND_SERIES_TAIL(bin, offset + total - BIN_LEN(bin));
+    }
+    else {
+        bin = Make_Binary(total);
+        offset = 0;
+        SET_SERIES_LEN(bin, total);
+    }
+    Byte* bp = BIN_AT(bin, offset);
+
+    Cell(const*) tail;
+    Cell(const*) at = VAL_ARRAY_AT(&tail, ARG(spec));
+
+    Cell(const*) values_tail;
+    Cell(const*) value = VAL_ARRAY_AT(&values_tail, ARG(values));
+
+    for (; at != tail; ++value) {
+        Size size;
+        const struct Record_Field *field = Next_Record_Field(&size, &at, tail);
+
+        if (value == values_tail)
+            fail ("PACK-RECORD spec has more fields than there are values");
+
+        if (field->kind == 'b') {
+            if (not IS_BINARY(value))
+                fail (Error_Bad_Value(value));
+            Size value_size;
+            const Byte* data = VAL_BINARY_SIZE_AT(&value_size, value);
+            if (value_size != size)
+                fail (Error_Bad_Value(value));
+            memmove(bp, data, size);  // could be from the same binary
+            bp += size;
+            continue;
+        }
+
+        uint64_t u;
+        if (field->kind == 'f') {
+            double d;
+            if (IS_DECIMAL(value))
+                d = VAL_DECIMAL(value);
+            else if (IS_INTEGER(value))
+                d = cast(double, VAL_INT64(value));
+            else
+                fail (Error_Bad_Value(value));
+
+            if (size == 4) {
+                if (d > FLT_MAX or d < -FLT_MAX)  // C says casting is UB
+                    fail (Error_Out_Of_Range(value));
+                float f = cast(float, d);
+                uint32_t bits;
+                memcpy(&bits, &f, 4);
+                u = bits;
+            }
+            else
+                memcpy(&u, &d, 8);
+        }
+        else {
+            if (not IS_INTEGER(value))
+                fail (Error_Bad_Value(value));
+            REBI64 i = VAL_INT64(value);
+
+            bool fits;
+            if (field->kind == 'u')
+                fits = i >= 0
+                    and (size == 8 or i < (cast(REBI64, 1) << (8 * size)));
+            else if (size == 8)
+                fits = true;
+            else {
+                REBI64 limit = cast(REBI64, 1) << (8 * size - 1);
+                fits = i >= -limit and i < limit;
+            }
+            if (not fits)
+                fail (Error_Out_Of_Range(value));
+
+            u = cast(uint64_t, i);
+        }
+
+        Size n;
+        for (n = 0; n < size; ++n)
+            bp[field->little ? n : size - 1 - n] = cast(Byte, u >> (8 * n));
+        bp += size;
+    }
+
+    if (value != values_tail)
+        fail ("PACK-RECORD was given more values than its spec has fields");
+
+    TERM_BIN(bin);
+
+    if (not REF(into))
+        return Init_Binary(OUT, bin);
+
+    Copy_Cell(OUT, ARG(into));
+    VAL_INDEX_UNBOUNDED(OUT) += total;
+    return OUT;
+}
@@ -0,0 +1,371 @@
+//
+//  File: %n-records.c
+//  Summary: "native GROUP-BY and JOIN-BY on blocks of records"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2026 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A block of records is either flat, with /SKIP values per record, or has a
+// BLOCK! or OBJECT! per record.  The key of a record is picked by position
+// (1-based, in a flat record or a BLOCK!) or by field name (in an OBJECT!):
+//
+//     >> select group-by/skip [a 1 b 2 a 3] 1 2 'a
+//     == [a 1 a 3]
+//
+//     >> join-by/skip [1 "one" 2 "two"] [2 #two 1 #one 1 #uno] 1 2
+//     == [1 "one" 1 #one 1 "one" 1 #uno 2 "two" 2 #two]
+//
+// This is what a MAP! and a FOR-EACH loop can do, but without running any
+// code per record.  The records are grouped in one pass, using Hash_Value()
+// and Cmp_Value() on the keys in a hash table made as frame scratch memory
+// (see Make_Scratch_Series()).  The only series made besides the results is
+// one array holding each distinct key, so grouping a big dataset doesn't
+// leave garbage per record for the GC.
+//
+
+#include "sys-core.h"
+
+
+typedef struct {
+    Cell(const*) head;  // first cell of first record
+    REBSPC *specifier;
+    REBLEN skip;  // cells per record
+    REBLEN num_records;
+    REBLEN index;  // 0-based position of the key, if not picked by name
+    option(Symbol(const*)) field;  // key is this field of OBJECT! records
+    const REBVAL *picker;  // the key argument, for errors
+} Record_Spec;
+
+
+// Get the records block, record size and key argument ready for use.
+//
+static void Init_Record_Spec(
+    Record_Spec* r,
+    const REBVAL *records,
+    Cell(const*) skip,  // INTEGER! or nulled
+    const REBVAL *key
+){
+    r->skip = 1;
+    if (not Is_Nulled(skip)) {
+        if (not IS_INTEGER(skip) or VAL_INT32(skip) <= 0)
+            fail (Error_Bad_Value(skip));
+        r->skip = VAL_INT32(skip);
+    }
+
+    REBLEN len;
+    r->head = VAL_ARRAY_LEN_AT(&len, records);
+    r->specifier = VAL_SPECIFIER(records);
+    if (len % r->skip != 0)
+        fail (Error_Block_Skip_Wrong_Raw());
+    r->num_records = len / r->skip;
+
+    r->picker = key;
+    if (IS_WORD(key)) {
+        if (r->skip != 1)
+            fail (Error_Bad_Pick_Raw(key));  // names are for OBJECT! records
+        r->field = VAL_WORD_SYMBOL(key);
+        r->index = 0;
+    }
+    else {
+        REBINT n = VAL_INT32(key);
+        if (n <= 0 or (r->skip != 1 and cast(REBLEN, n) > r->skip))
+            fail (Error_Bad_Pick_Raw(key));
+        r->field = nullptr;
+        r->index = n - 1;
+    }
+}
+
+
+// Find the key of record `n`, and the specifier it should be used with.
+//
+static Cell(const*) Record_Key(
+    REBSPC **specifier_out,
+    const Record_Spec* r,
+    REBLEN n
+){
+    Cell(const*) record = r->head + n * r->skip;
+    *specifier_out = r->specifier;
+
+    Cell(const*) key;
+    if (r->field) {
+        if (not IS_OBJECT(record))
+            fail (Error_Bad_Pick_Raw(r->picker));
+        option(Value(*)) var = Select_Symbol_In_Context(
+            record,
+            unwrap(r->field)
+        );
+        if (not var)
+            fail (Error_Bad_Pick_Raw(r->picker));
+        key = unwrap(var);
+        *specifier_out = SPECIFIED;
+    }
+    else if (r->skip == 1 and IS_BLOCK(record)) {
+        REBLEN len;
+        Cell(const*) at = VAL_ARRAY_LEN_AT(&len, record);
+        if (r->index >= len)
+            fail (Error_Bad_Pick_Raw(r->picker));
+        key = at + r->index;
+        *specifier_out = Derive_Specifier(r->specifier, record);
+    }
+    else if (r->skip == 1 and r->index != 0)
+        fail (Error_Bad_Pick_Raw(r->picker));  // record is a lone value
+    else
+        key = record + r->index;
+
+    if (Is_Isotope(key) or Is_Void(key))
+        fail (Error_Bad_Pick_Raw(r->picker));  // e.g. unset OBJECT! field
+
+    return key;
+}
+
+
+typedef struct {
+    REBLEN num_groups;
+    Array(*) keys;  // first key seen for each group, unmanaged
+    REBSER *hashlist;  // of the keys, frame scratch memory
+    REBLEN *starts;  // records of group g are order[starts[g]...starts[g+1]]
+    REBLEN *order;  // record numbers, by group and in order within a group
+} Record_Groups;
+
+
+//
+//  Group_Records: C
+//
+// Hash the keys of the records, in one pass finding what group each record
+// is in, and a count of each group.  Then use the counts to list the records
+// of each group together (a counting sort, which keeps them in order).
+//
+static void Group_Records(
+    Record_Groups* g,
+    Frame(*) f,
+    const Record_Spec* r,
+    bool cased
+){
+    REBLEN n = r->num_records;
+
+    g->keys = Make_Array(n);
+    g->hashlist = Make_Scratch_Hash_Series(f, n);
+    g->num_groups = 0;
+
+    REBLEN *group_of = cast(REBLEN*,
+        Alloc_Frame_Scratch(f, sizeof(REBLEN) * n)
+    );
+    g->starts = cast(REBLEN*,
+        Alloc_Frame_Scratch(f, sizeof(REBLEN) * (n + 1))
+    );
+    g->order = cast(REBLEN*, Alloc_Frame_Scratch(f, sizeof(REBLEN) * n));
+
+    REBLEN *counts = g->starts + 1;  // so the sums below give the starts
+
+    REBLEN i;
+    for (i = 0; i < n; ++i) {
+        REBSPC *specifier;
+        Cell(const*) key = Record_Key(&specifier, r, i);
+
+        REBINT slot = Find_Key_Hashed(
+            g->keys, g->hashlist, key, specifier, 1, cased, 2  // add if new
+        );
+        REBLEN group;
+        if (slot < 0) {  // key was new, and was added
+            group = g->num_groups++;
+            counts[group] = 0;
+        }
+        else
+            group = HASHLIST_INDEX(Hashlist_Slots(g->hashlist), slot) - 1;
+
+        group_of[i] = group;
+        ++counts[group];
+    }
+
+    g->starts[0] = 0;
+    for (i = 0; i < g->num_groups; ++i)
+        g->starts[i + 1] += g->starts[i];
+
+    REBLEN *cursors = cast(REBLEN*,
+        Alloc_Frame_Scratch(f, sizeof(REBLEN) * g->num_groups)
+    );
+    memcpy(cursors, g->starts, sizeof(REBLEN) * g->num_groups);
+    for (i = 0; i < n; ++i)
+        g->order[cursors[group_of[i]]++] = i;
+}
+
+
+// Push the fields of record `n`.  A BLOCK! record gives its items if it is
+// to be spliced, and otherwise gives itself (as does an OBJECT!).
+//
+static void Push_Record_Fields(const Record_Spec* r, REBLEN n, bool splice)
+{
+    Cell(const*) record = r->head + n * r->skip;
+
+    if (splice and r->skip == 1 and IS_BLOCK(record)) {
+        Cell(const*) tail;
+        Cell(const*) item = VAL_ARRAY_AT(&tail, record);
+        REBSPC *specifier = Derive_Specifier(r->specifier, record);
+        for (; item != tail; ++item)
+            Derelativize(PUSH(), item, specifier);
+        return;
+    }
+
+    REBLEN i;
+    for (i = 0; i < r->skip; ++i)
+        Derelativize(PUSH(), record + i, r->specifier);
+}
+
+
+// JOIN-BY's KEY and /SKIP take either one value for both blocks, or a BLOCK!
+// of two values: one for the left block and one for the right.
+//
+static Cell(const*) Left_Or_Right(const REBVAL *arg, REBLEN which)
+{
+    if (not IS_BLOCK(arg))
+        return arg;
+
+    REBLEN len;
+    Cell(const*) at = VAL_ARRAY_LEN_AT(&len, arg);
+    if (len != 2 or not (IS_INTEGER(at + which) or IS_WORD(at + which)))
+        fail (Error_Bad_Value(arg));
+    return at + which;
+}
+
+
+//
+//  group-by: native [
+//
+//  {Gather records with equal keys, as a MAP! of each key to its records}
+//
+//      return: [map!]
+//      records "Flat records of /SKIP values, or BLOCK! or OBJECT! records"
+//          [block!]
+//      key "Position of the key in a record, or name of an OBJECT! field"
+//          [integer! word!]
+//      /skip "Size of each flat record (default 1)"
+//          [integer!]
+//      /case "Keys are compared case-sensitively"
+//  ]
+//
+DECLARE_NATIVE(group_by)
+//
+// The records of each key are in the order they were in RECORDS, and the
+// keys are in the order they were first seen.
+{
+    INCLUDE_PARAMS_OF_GROUP_BY;
+
+    Record_Spec r;
+    Init_Record_Spec(&r, ARG(records), ARG(skip), ARG(key));
+
+    Record_Groups g;
+    Group_Records(&g, frame_, &r, REF(case));
+
+    REBMAP *map = Make_Map(g.num_groups);
+
+    DECLARE_LOCAL (group);
+    REBLEN i;
+    for (i = 0; i < g.num_groups; ++i) {
+        StackIndex base = TOP_INDEX;
+
+        REBLEN j;
+        for (j = g.starts[i]; j < g.starts[i + 1]; ++j)
+            Push_Record_Fields(&r, g.order[j], false);
+
+        Init_Block(group, Pop_Stack_Values(base));
+        Find_Map_Entry(
+            map, ARR_AT(g.keys, i), SPECIFIED, group, SPECIFIED, REF(case)
+        );
+    }
+
+    Free_Unmanaged_Series(g.keys);
+    return Init_Map(OUT, map);
+}
+
+
+//
+//  join-by: native [
+//
+//  {Join records of two blocks that have equal keys (an inner hash join)}
+//
+//      return: [block!]
+//      left "Flat records of /SKIP values, or BLOCK! or OBJECT! records"
+//          [block!]
+//      right "Records to join to each LEFT record with the same key"
+//          [block!]
+//      key "Key position or OBJECT! field name (or [left right] keys)"
+//          [integer! word! block!]
+//      /skip "Size of flat records (or [left right] sizes)"
+//          [integer! block!]
+//      /case "Keys are compared case-sensitively"
+//  ]
+//
+DECLARE_NATIVE(join_by)
+//
+// Each joined record is the fields of a LEFT record and then those of a
+// RIGHT one, for every pair with equal keys.  They come in the order of the
+// LEFT records, and for each one in the order of the RIGHT ones.  If LEFT
+// has BLOCK! records then each joined record is a new BLOCK!, otherwise the
+// result is flat.  An OBJECT! counts as one field (itself).
+{
+    INCLUDE_PARAMS_OF_JOIN_BY;
+
+    Cell(const*) left_skip = ARG(skip);
+    Cell(const*) right_skip = ARG(skip);
+    if (REF(skip)) {
+        left_skip = Left_Or_Right(ARG(skip), 0);
+        right_skip = Left_Or_Right(ARG(skip), 1);
+    }
+
+    Record_Spec left;
+    Init_Record_Spec(
+        &left, ARG(left), left_skip, SPECIFIC(Left_Or_Right(ARG(key), 0))
+    );
+
+    Record_Spec right;
+    Init_Record_Spec(
+        &right, ARG(right), right_skip, SPECIFIC(Left_Or_Right(ARG(key), 1))
+    );
+
+    Record_Groups g;  // only the RIGHT records need to be hashed
+    Group_Records(&g, frame_, &right, REF(case));
+
+    StackIndex base = TOP_INDEX;
+
+    REBLEN i;
+    for (i = 0; i < left.num_records; ++i) {
+        REBSPC *specifier;
+        Cell(const*) key = Record_Key(&specifier, &left, i);
+
+        REBINT slot = Find_Key_Hashed(
+            g.keys, g.hashlist, key, specifier, 1, REF(case), 1  // no add
+        );
+        if (slot < 0)
+            continue;  // no RIGHT records with this key
+
+        REBLEN group = HASHLIST_INDEX(Hashlist_Slots(g.hashlist), slot) - 1;
+
+        bool nested = left.skip == 1 and IS_BLOCK(left.head + i);
+
+        REBLEN j;
+        for (j = g.starts[group]; j < g.starts[group + 1]; ++j) {
+            StackIndex record_base = TOP_INDEX;
+            Push_Record_Fields(&left, i, nested);
+            Push_Record_Fields(&right, g.order[j], nested);
+            if (nested)
+                Init_Block(PUSH(), Pop_Stack_Values(record_base));
+        }
+    }
+
+    Free_Unmanaged_Series(g.keys);
+    return Init_Block(OUT, Pop_Stack_Values(base));
+}
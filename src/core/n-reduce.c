@@ -333,6 +333,59 @@ bool Match_For_Compose(noquote(Cell(const*)) group, const REBVAL *label) {
 }
 
 
+//
+//  Array_Has_Compose_Groups: C
+//
+// COMPOSE/DEEP would otherwise push a composer frame for every array nested
+// in the template, only to find most have nothing to compose and keep them
+// as they were.  A plain C walk to see if there are any GROUP!s at all is
+// much cheaper than that.  Deeply frozen arrays can't change, so the answer
+// for them is remembered in TG_Compose_Cache (see COMPOSE_CACHE_SIZE).
+//
+// (Any GROUP! counts, without checking a label: this only rules out work.
+// Very deep nesting--or an array that contains itself--is answered with a
+// `true` to leave it to the frames, rather than recursing on the C stack.)
+//
+static bool Array_Has_Compose_Groups(Array(const*) a, REBLEN depth)
+{
+    if (depth > 32)
+        return true;
+
+    struct Reb_Compose_Cache_Entry *entry = nullptr;
+    if (Is_Array_Frozen_Deep(a)) {
+        uintptr_t bits = cast(uintptr_t, a) >> 4;
+        entry = &TG_Compose_Cache[
+            (bits ^ (bits >> 8)) & (COMPOSE_CACHE_SIZE - 1)
+        ];
+        if (entry->array == a)
+            return entry->has_groups;
+    }
+
+    bool has_groups = false;
+    Cell(const*) tail = ARR_TAIL(a);
+    Cell(const*) at = ARR_HEAD(a);
+    for (; at != tail; ++at) {
+        if (ANY_GROUP_KIND(CELL_HEART(at))) {
+            has_groups = true;
+            break;
+        }
+        if (
+            ANY_ARRAYLIKE(at)
+            and Array_Has_Compose_Groups(ARR(VAL_NODE1(at)), depth + 1)
+        ){
+            has_groups = true;
+            break;
+        }
+    }
+
+    if (entry) {
+        entry->array = a;
+        entry->has_groups = has_groups;
+    }
+    return has_groups;
+}
+
+
 // This is a helper common to the Composer_Executor() and the COMPOSE native
 // which will push a frame that does composing to the trampoline stack.
 //
@@ -565,7 +618,7 @@ Bounce Composer_Executor(Frame(*) f)
     }
 
     if (not match) {
-        if (deep) {
+        if (deep and Array_Has_Compose_Groups(ARR(VAL_NODE1(at)), 0)) {
             // compose/deep [does [(1 + 2)] nested] => [does [3] nested]
 
             Push_Composer_Frame(OUT, main_frame, at, f_specifier);
@@ -574,6 +627,7 @@ Bounce Composer_Executor(Frame(*) f)
         }
 
         // compose [[(1 + 2)] (3 + 4)] => [[(1 + 2)] 7]  ; non-deep
+        // compose/deep [[a b] (3 + 4)] => [[a b] 7]  ; nothing to compose
         //
         Derelativize(PUSH(), at, f_specifier);  // keep newline flag
         goto handle_next_item;
@@ -0,0 +1,544 @@
+//
+//  File: %n-serialize.c
+//  Summary: "binary serialization of loaded values (the REBIN codec)"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// SAVE and LOAD of data go through MOLD and the scanner, which means every
+// word is re-interned and every number re-parsed each time the data is read.
+// The REBIN format stores the same information already broken down:
+//
+//     "RBIN" version-byte
+//     symbol-count, then (size, UTF-8 bytes) for each symbol
+//     value
+//
+// Each value is a heart byte and a flags byte (plus a quote byte if it's not
+// plain), followed by the payload for that heart:
+//
+//     INTEGER!, DECIMAL!, PERCENT! - 8 bytes, little-endian
+//     ANY-STRING!, BINARY! - size, then the bytes
+//     ANY-WORD! - index into the symbol table
+//     ANY-ARRAY! - length, then that many values
+//
+// Sizes, lengths and indices are LEB128 varints.  Any other kind of value is
+// written as REBIN_MOLDED and the text of its MOLD, and is scanned on load...
+// so whatever SAVE and LOAD can round-trip, this can too.  As with LOAD,
+// words come back unbound, and series come back at their head (series that
+// were at an index save only the part from that index).
+//
+// Loading is then one intern per distinct symbol, and bulk copies for the
+// series data.
+//
+// !!! The format is not designed to be memory-mapped and used in place, as
+// strings and arrays need to be series nodes that the GC can manage.
+//
+
+#include "sys-core.h"
+
+#define REBIN_VERSION 1
+
+#define REBIN_MOLDED 0xFF  // heart byte value for "stored as MOLD text"
+
+#define REBIN_FLAG_NEWLINE_BEFORE 0x01
+#define REBIN_FLAG_QUOTED 0x02  // a quote byte follows the flags
+#define REBIN_FLAG_NEWLINE_AT_TAIL 0x04  // for arrays
+
+
+// Symbol to index mapping used while encoding.  Binders can't be used here,
+// since a failure (e.g. from a stack overflow on a cyclic block) would leave
+// their indices on the symbols.  This table is just an unmanaged binary, that
+// gets freed automatically if there's a failure.
+//
+typedef struct {
+    Symbol(const*) symbol;
+    REBLEN index;
+} Rebin_Symbol_Entry;
+
+typedef struct {
+    Binary(*) body;  // encoded values
+    Binary(*) symbols;  // encoded symbol table entries
+    REBLEN num_symbols;
+    Binary(*) table;  // Rebin_Symbol_Entry hash table, open addressing
+    REBLEN table_capacity;  // power of 2
+} Rebin_Encoder;
+
+
+static Byte* Rebin_Reserve(Binary(*) bin, Size size) {
+    Size old_size = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, size);
+    return BIN_AT(bin, old_size);
+}
+
+static void Rebin_Write_Varint(Binary(*) bin, REBU64 n) {
+    Byte buf[10];
+    Size size = 0;
+    do {
+        Byte b = n & 0x7F;
+        n >>= 7;
+        buf[size++] = n ? (b | 0x80) : b;
+    } while (n);
+    memcpy(Rebin_Reserve(bin, size), buf, size);
+}
+
+static void Rebin_Write_U64(Binary(*) bin, REBU64 n) {
+    Byte* bp = Rebin_Reserve(bin, 8);
+    int i;
+    for (i = 0; i < 8; ++i, n >>= 8)
+        bp[i] = n & 0xFF;
+}
+
+static void Rebin_Write_Bytes(Binary(*) bin, const Byte* data, Size size) {
+    Rebin_Write_Varint(bin, size);
+    memcpy(Rebin_Reserve(bin, size), data, size);
+}
+
+
+static Rebin_Symbol_Entry* Rebin_Table_Slot(
+    Binary(*) table,
+    REBLEN capacity,
+    Symbol(const*) symbol
+){
+    Rebin_Symbol_Entry* entries = cast(Rebin_Symbol_Entry*, BIN_HEAD(table));
+    REBLEN i = (cast(uintptr_t, symbol) >> 4) & (capacity - 1);
+    while (entries[i].symbol and entries[i].symbol != symbol)
+        i = (i + 1) & (capacity - 1);
+    return &entries[i];
+}
+
+static Binary(*) Make_Rebin_Table(REBLEN capacity) {
+    Size size = capacity * sizeof(Rebin_Symbol_Entry);
+    Binary(*) table = Make_Binary(size);
+    memset(BIN_HEAD(table), 0, size);  // null symbol means unused slot
+    TERM_BIN_LEN(table, size);
+    return table;
+}
+
+
+//
+//  Rebin_Symbol_Index: C
+//
+// Gives the index of the symbol in the table, adding it if not there yet.
+//
+static REBLEN Rebin_Symbol_Index(Rebin_Encoder* e, Symbol(const*) symbol)
+{
+    Rebin_Symbol_Entry* slot = Rebin_Table_Slot(
+        e->table, e->table_capacity, symbol
+    );
+    if (slot->symbol)
+        return slot->index;
+
+    slot->symbol = symbol;
+    slot->index = e->num_symbols;
+    Rebin_Write_Bytes(e->symbols, STR_HEAD(symbol), STR_SIZE(symbol));
+    ++e->num_symbols;
+
+    if (e->num_symbols * 2 > e->table_capacity) {  // keep it half empty
+        REBLEN capacity = e->table_capacity * 2;
+        Binary(*) table = Make_Rebin_Table(capacity);
+        Rebin_Symbol_Entry* old = cast(Rebin_Symbol_Entry*, BIN_HEAD(e->table));
+        REBLEN i;
+        for (i = 0; i < e->table_capacity; ++i) {
+            if (old[i].symbol)
+                *Rebin_Table_Slot(table, capacity, old[i].symbol) = old[i];
+        }
+        Free_Unmanaged_Series(e->table);
+        e->table = table;
+        e->table_capacity = capacity;
+    }
+
+    return e->num_symbols - 1;
+}
+
+
+//
+//  Encode_Rebin_Cell: C
+//
+static void Encode_Rebin_Cell(Rebin_Encoder* e, Cell(const*) v)
+{
+    if (C_STACK_OVERFLOWING(&v))
+        Fail_Stack_Overflow();
+
+    Binary(*) body = e->body;
+    enum Reb_Kind heart = CELL_HEART(v);
+
+    Byte flags = 0;
+    if (Get_Cell_Flag(v, NEWLINE_BEFORE))
+        flags |= REBIN_FLAG_NEWLINE_BEFORE;
+
+    bool native = (
+        heart == REB_BLANK
+        or heart == REB_INTEGER
+        or heart == REB_DECIMAL
+        or heart == REB_PERCENT
+        or heart == REB_BINARY
+        or ANY_STRING_KIND(heart)
+        or ANY_WORD_KIND(heart)
+        or ANY_ARRAY_KIND(heart)
+    );
+
+    if (not native) {  // MOLD handles the quoting
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+        Mold_Value(mo, v);
+
+        Byte* bp = Rebin_Reserve(body, 2);
+        bp[0] = REBIN_MOLDED;
+        bp[1] = flags;
+        Rebin_Write_Bytes(
+            body,
+            BIN_AT(mo->series, mo->base.size),
+            STR_SIZE(mo->series) - mo->base.size
+        );
+        Drop_Mold(mo);
+        return;
+    }
+
+    if (ANY_ARRAY_KIND(heart) and Get_Subclass_Flag(
+        ARRAY, VAL_ARRAY(v), NEWLINE_AT_TAIL
+    )){
+        flags |= REBIN_FLAG_NEWLINE_AT_TAIL;
+    }
+
+    Byte quote_byte = QUOTE_BYTE(v);
+    if (quote_byte != UNQUOTED_1)
+        flags |= REBIN_FLAG_QUOTED;
+
+    Byte* bp = Rebin_Reserve(body, (flags & REBIN_FLAG_QUOTED) ? 3 : 2);
+    bp[0] = heart;
+    bp[1] = flags;
+    if (flags & REBIN_FLAG_QUOTED)
+        bp[2] = quote_byte;
+
+    if (heart == REB_BLANK)
+        return;
+
+    if (heart == REB_INTEGER) {
+        Rebin_Write_U64(body, cast(REBU64, VAL_INT64(v)));
+        return;
+    }
+
+    if (heart == REB_DECIMAL or heart == REB_PERCENT) {
+        REBDEC d = VAL_DECIMAL(v);
+        REBU64 bits;
+        memcpy(&bits, &d, sizeof(bits));
+        Rebin_Write_U64(body, bits);
+        return;
+    }
+
+    if (heart == REB_BINARY) {
+        Size size;
+        const Byte* data = VAL_BINARY_SIZE_AT(&size, v);
+        Rebin_Write_Bytes(body, data, size);
+        return;
+    }
+
+    if (ANY_STRING_KIND(heart)) {
+        Size size;
+        Utf8(const*) utf8 = VAL_UTF8_SIZE_AT(&size, v);
+        Rebin_Write_Bytes(body, cast(const Byte*, utf8), size);
+        return;
+    }
+
+    if (ANY_WORD_KIND(heart)) {
+        Rebin_Write_Varint(body, Rebin_Symbol_Index(e, VAL_WORD_SYMBOL(v)));
+        return;
+    }
+
+    assert(ANY_ARRAY_KIND(heart));
+
+    REBLEN len;
+    Cell(const*) item = VAL_ARRAY_LEN_AT(&len, v);
+    Rebin_Write_Varint(body, len);
+    for (; len != 0; --len, ++item)
+        Encode_Rebin_Cell(e, item);
+}
+
+
+//
+//  encode-rebin: native [
+//
+//  {Codec for encoding loadable data in the binary REBIN format}
+//
+//      return: [binary!]
+//      value [element?]
+//  ]
+//
+DECLARE_NATIVE(encode_rebin)
+{
+    INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    Rebin_Encoder e;
+    e.body = Make_Binary(256);
+    e.symbols = Make_Binary(256);
+    e.num_symbols = 0;
+    e.table_capacity = 64;
+    e.table = Make_Rebin_Table(e.table_capacity);
+
+    Encode_Rebin_Cell(&e, ARG(value));
+
+    Binary(*) bin = Make_Binary(
+        5 + 10 + BIN_LEN(e.symbols) + BIN_LEN(e.body)
+    );
+    TERM_BIN_LEN(bin, 0);
+
+    memcpy(Rebin_Reserve(bin, 4), "RBIN", 4);
+    *Rebin_Reserve(bin, 1) = REBIN_VERSION;
+    Rebin_Write_Varint(bin, e.num_symbols);
+    memcpy(
+        Rebin_Reserve(bin, BIN_LEN(e.symbols)),
+        BIN_HEAD(e.symbols),
+        BIN_LEN(e.symbols)
+    );
+    memcpy(
+        Rebin_Reserve(bin, BIN_LEN(e.body)),
+        BIN_HEAD(e.body),
+        BIN_LEN(e.body)
+    );
+    TERM_BIN(bin);
+
+    Free_Unmanaged_Series(e.table);
+    Free_Unmanaged_Series(e.symbols);
+    Free_Unmanaged_Series(e.body);
+
+    return Init_Binary(OUT, bin);
+}
+
+
+typedef struct {
+    const Byte* at;
+    const Byte* tail;
+    Array(*) symbols;  // WORD!s for each symbol in the table
+} Rebin_Decoder;
+
+
+static const Byte* Rebin_Need(Rebin_Decoder* d, Size size) {
+    if (cast(Size, d->tail - d->at) < size)
+        fail (Error_Bad_Rebin_Raw());
+    const Byte* bp = d->at;
+    d->at += size;
+    return bp;
+}
+
+static REBU64 Rebin_Read_Varint(Rebin_Decoder* d) {
+    REBU64 n = 0;
+    int shift;
+    for (shift = 0; shift < 64; shift += 7) {
+        Byte b = *Rebin_Need(d, 1);
+        n |= cast(REBU64, b & 0x7F) << shift;
+        if (not (b & 0x80))
+            return n;
+    }
+    fail (Error_Bad_Rebin_Raw());  // more than 64 bits
+}
+
+static REBU64 Rebin_Read_U64(Rebin_Decoder* d) {
+    const Byte* bp = Rebin_Need(d, 8);
+    REBU64 n = 0;
+    int i;
+    for (i = 7; i >= 0; --i)
+        n = (n << 8) | bp[i];
+    return n;
+}
+
+static const Byte* Rebin_Read_Bytes(Size* size_out, Rebin_Decoder* d) {
+    REBU64 size = Rebin_Read_Varint(d);
+    if (size > cast(REBU64, d->tail - d->at))
+        fail (Error_Bad_Rebin_Raw());
+    *size_out = cast(Size, size);
+    return Rebin_Need(d, *size_out);
+}
+
+
+//
+//  Decode_Rebin_Cell: C
+//
+// Pushes the decoded value to the data stack.
+//
+static void Decode_Rebin_Cell(Rebin_Decoder* d)
+{
+    if (C_STACK_OVERFLOWING(&d))
+        Fail_Stack_Overflow();
+
+    Byte heart = *Rebin_Need(d, 1);
+    Byte flags = *Rebin_Need(d, 1);
+
+    if (heart == REBIN_MOLDED) {
+        Size size;
+        const Byte* utf8 = Rebin_Read_Bytes(&size, d);
+        String(*) text = Make_Sized_String_UTF8(cs_cast(utf8), size);
+        Array(*) a = Scan_UTF8_Managed(ANONYMOUS, STR_HEAD(text), size, nullptr);
+        Free_Unmanaged_Series(text);
+        if (ARR_LEN(a) != 1)
+            fail (Error_Bad_Rebin_Raw());
+        Copy_Cell(PUSH(), ARR_HEAD(a));
+    }
+    else {
+        Byte quote_byte = UNQUOTED_1;
+        if (flags & REBIN_FLAG_QUOTED) {
+            quote_byte = *Rebin_Need(d, 1);
+            if (quote_byte == ISOTOPE_0)
+                fail (Error_Bad_Rebin_Raw());
+        }
+
+        if (heart == REB_BLANK)
+            Init_Blank(PUSH());
+        else if (heart == REB_INTEGER)
+            Init_Integer(PUSH(), cast(REBI64, Rebin_Read_U64(d)));
+        else if (heart == REB_DECIMAL or heart == REB_PERCENT) {
+            REBU64 bits = Rebin_Read_U64(d);
+            REBDEC dec;
+            memcpy(&dec, &bits, sizeof(dec));
+            if (heart == REB_DECIMAL)
+                Init_Decimal(PUSH(), dec);
+            else
+                Init_Percent(PUSH(), dec);
+        }
+        else if (heart == REB_BINARY) {
+            Size size;
+            const Byte* data = Rebin_Read_Bytes(&size, d);
+            Binary(*) bin = Make_Binary(size);
+            memcpy(BIN_HEAD(bin), data, size);
+            TERM_BIN_LEN(bin, size);
+            Init_Binary(PUSH(), bin);
+        }
+        else if (heart < REB_MAX and ANY_STRING_KIND(heart)) {
+            Size size;
+            const Byte* utf8 = Rebin_Read_Bytes(&size, d);
+            Init_Any_String(
+                PUSH(),
+                cast(enum Reb_Kind, heart),
+                Make_Sized_String_UTF8(cs_cast(utf8), size)
+            );
+        }
+        else if (heart < REB_MAX and ANY_WORD_KIND(heart)) {
+            REBU64 index = Rebin_Read_Varint(d);
+            if (index >= ARR_LEN(d->symbols))
+                fail (Error_Bad_Rebin_Raw());
+            Init_Any_Word(
+                PUSH(),
+                cast(enum Reb_Kind, heart),
+                VAL_WORD_SYMBOL(ARR_AT(d->symbols, cast(REBLEN, index)))
+            );
+        }
+        else if (heart < REB_MAX and ANY_ARRAY_KIND(heart)) {
+            REBU64 len = Rebin_Read_Varint(d);
+            if (len > cast(REBU64, d->tail - d->at) / 2)  // 2 bytes minimum
+                fail (Error_Bad_Rebin_Raw());
+
+            StackIndex base = TOP_INDEX;
+            for (; len != 0; --len)
+                Decode_Rebin_Cell(d);
+
+            Flags pop_flags = NODE_FLAG_MANAGED;
+            if (flags & REBIN_FLAG_NEWLINE_AT_TAIL)
+                pop_flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
+            Array(*) a = Pop_Stack_Values_Core(base, pop_flags);
+            Init_Array_Cell(PUSH(), cast(enum Reb_Kind, heart), a);
+        }
+        else
+            fail (Error_Bad_Rebin_Raw());
+
+        mutable_QUOTE_BYTE(TOP) = quote_byte;
+    }
+
+    if (flags & REBIN_FLAG_NEWLINE_BEFORE)
+        Set_Cell_Flag(TOP, NEWLINE_BEFORE);
+}
+
+
+//
+//  identify-rebin?: native [
+//
+//  {Codec for identifying the binary REBIN format}
+//
+//      return: [logic?]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(identify_rebin_q)
+{
+    INCLUDE_PARAMS_OF_IDENTIFY_REBIN_Q;
+
+    Size size;
+    const Byte* bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    return Init_Logic(
+        OUT,
+        size >= 5 and memcmp(bp, "RBIN", 4) == 0 and bp[4] == REBIN_VERSION
+    );
+}
+
+
+//
+//  decode-rebin: native [
+//
+//  {Codec for decoding data saved in the binary REBIN format}
+//
+//      return: [element?]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(decode_rebin)
+{
+    INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    Size size;
+    const Byte* bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    Rebin_Decoder d;
+    d.at = bp;
+    d.tail = bp + size;
+
+    const Byte* magic = Rebin_Need(&d, 5);
+    if (memcmp(magic, "RBIN", 4) != 0 or magic[4] != REBIN_VERSION)
+        fail (Error_Bad_Rebin_Raw());
+
+    REBU64 num_symbols = Rebin_Read_Varint(&d);
+    if (num_symbols > cast(REBU64, d.tail - d.at))  // 1 byte minimum each
+        fail (Error_Bad_Rebin_Raw());
+
+    d.symbols = Make_Array(cast(REBLEN, num_symbols));
+    for (; num_symbols != 0; --num_symbols) {
+        Size sym_size;
+        const Byte* utf8 = Rebin_Read_Bytes(&sym_size, &d);
+
+        Length len;
+        if (
+            sym_size == 0
+            or Find_Invalid_Utf8(&len, utf8, sym_size)
+            or memchr(utf8, '\0', sym_size)
+        ){
+            fail (Error_Bad_Rebin_Raw());  // interning doesn't check these
+        }
+        Init_Word(
+            Alloc_Tail_Array(d.symbols),
+            Intern_UTF8_Managed(utf8, sym_size)
+        );
+    }
+
+    Decode_Rebin_Cell(&d);
+    if (d.at != d.tail)
+        fail (Error_Bad_Rebin_Raw());
+
+    Free_Unmanaged_Series(d.symbols);
+
+    Move_Cell(OUT, TOP);
+    DROP();
+    return OUT;
+}
@@ -47,22 +47,155 @@
 #include "sys-core.h"
 
 
+// Step past the record at `*index` and any records after it whose first
+// element is equal to its first element, failing if the array turns out to
+// not be sorted.  Returns the index of the record that was stepped over.
+//
+static REBLEN Skip_Sorted_Run(
+    Array(const*) array,
+    REBLEN *index,
+    REBLEN skip,
+    bool cased
+){
+    REBLEN run = *index;
+    Cell(const*) first = ARR_AT(array, run);
+
+    *index += skip;
+    for (; *index < ARR_LEN(array); *index += skip) {
+        REBINT diff = Cmp_Value(ARR_AT(array, *index), first, cased);
+        if (diff < 0)
+            fail ("/SORTED set operation given input that isn't sorted");
+        if (diff > 0)
+            break;
+    }
+
+    return run;
+}
+
+
+// Set operations on arrays that are already sorted (as by SORT, or SORT/CASE
+// when `cased`) don't need hashing: walking both inputs in step finds which
+// elements are in one or the other or both, like a merge sort.  The result
+// is sorted too, with one record per distinct element.
+//
+// Note this differs from the hashed version in UNION and DIFFERENCE, which
+// give the elements of the first series before any from the second.
+//
+static Array(*) Make_Sorted_Set_Operation_Array(
+    const REBVAL *val1,
+    const REBVAL *val2,  // nullptr for UNIQUE
+    Flags flags,
+    bool cased,
+    REBLEN skip
+){
+    Array(const*) a1 = VAL_ARRAY(val1);
+    REBLEN i1 = VAL_INDEX(val1);
+    Array(const*) a2 = val2 ? VAL_ARRAY(val2) : nullptr;
+    REBLEN i2 = val2 ? VAL_INDEX(val2) : 0;
+
+    if (
+        (ARR_LEN(a1) - i1) % skip != 0
+        or (a2 and (ARR_LEN(a2) - i2) % skip != 0)
+    ){
+        fail (Error_Block_Skip_Wrong_Raw());  // see Make_Set_Operation_Series
+    }
+
+    // Which elements get into the result, based on where they are found:
+    //
+    //                 first only   second only   both
+    //     UNIQUE          x
+    //     INTERSECT                                x
+    //     UNION           x             x          x
+    //     DIFFERENCE      x             x
+    //     EXCLUDE         x
+    //
+    bool one_side = not (flags & SOP_FLAG_CHECK) or (flags & SOP_FLAG_INVERT);
+    bool keep_first_only = one_side;
+    bool keep_second_only = one_side and (flags & SOP_FLAG_BOTH);
+    bool keep_both = not (flags & SOP_FLAG_INVERT);
+
+    Array(*) buffer = Make_Array(
+        (ARR_LEN(a1) - i1) + (a2 ? ARR_LEN(a2) - i2 : 0)
+    );
+
+    while (i1 < ARR_LEN(a1) or (a2 and i2 < ARR_LEN(a2))) {
+        REBINT diff;
+        if (not a2 or i2 >= ARR_LEN(a2))
+            diff = -1;
+        else if (i1 >= ARR_LEN(a1))
+            diff = 1;
+        else
+            diff = Cmp_Value(ARR_AT(a1, i1), ARR_AT(a2, i2), cased);
+
+        Array(const*) from;
+        REBLEN at;
+        REBSPC *specifier;
+        bool keep;
+        if (diff < 0) {
+            from = a1;
+            at = Skip_Sorted_Run(a1, &i1, skip, cased);
+            specifier = VAL_SPECIFIER(val1);
+            keep = keep_first_only;
+        }
+        else if (diff > 0) {
+            from = a2;
+            at = Skip_Sorted_Run(a2, &i2, skip, cased);
+            specifier = VAL_SPECIFIER(val2);
+            keep = keep_second_only;
+        }
+        else {  // the first series' record represents the element
+            from = a1;
+            at = Skip_Sorted_Run(a1, &i1, skip, cased);
+            Skip_Sorted_Run(a2, &i2, skip, cased);
+            specifier = VAL_SPECIFIER(val1);
+            keep = keep_both;
+        }
+
+        if (not keep)
+            continue;
+
+        REBLEN n;
+        for (n = 0; n < skip; ++n)
+            Append_Value_Core(buffer, ARR_AT(from, at + n), specifier);
+    }
+
+    return buffer;
+}
+
+
 //
 //  Make_Set_Operation_Series: C
 //
 // Do set operations on a series.  Case-sensitive if `cased` is TRUE.
 // `skip` is the record size.
 //
+// If `sorted`, arrays are assumed to be in sorted order, and are merged
+// without hashing.  (Strings and binaries are searched the same either way.)
+//
+// The second value of INTERSECT or EXCLUDE on an array may be a MAP!, which
+// is checked for each element by looking it up as a key.  The map acts as a
+// hashed set that is built once and reused, instead of hashing `val2` on
+// each call.  Keys whose values have been removed from the map don't count.
+//
 REBSER *Make_Set_Operation_Series(
     const REBVAL *val1,
     const REBVAL *val2,
     Flags flags,
     bool cased,
-    REBLEN skip
+    REBLEN skip,
+    bool sorted
 ){
     assert(ANY_SERIES(val1));
 
-    if (val2) {
+    if (val2 and IS_MAP(val2)) {
+        if (not ANY_ARRAY(val1))
+            fail (Error_Unexpected_Type(VAL_TYPE(val1), VAL_TYPE(val2)));
+
+        assert(flags & SOP_FLAG_CHECK);  // only INTERSECT and EXCLUDE
+        if (flags & SOP_FLAG_BOTH)
+            fail (Error_Unexpected_Type(VAL_TYPE(val1), VAL_TYPE(val2)));
+    }
+    else if (val2) {
         assert(ANY_SERIES(val2));
 
         if (ANY_ARRAY(val1)) {
@@ -106,7 +239,14 @@ REBSER *Make_Set_Operation_Series(
     bool first_pass = true; // are we in the first pass over the series?
     REBSER *out_ser;
 
-    if (ANY_ARRAY(val1)) {
+    if (sorted and ANY_ARRAY(val1) and not (val2 and IS_MAP(val2))) {
+        Array(*) buffer = Make_Sorted_Set_Operation_Array(
+            val1, val2, flags, cased, skip
+        );
+        out_ser = Copy_Array_Shallow(buffer, SPECIFIED);
+        Free_Unmanaged_Series(buffer);
+    }
+    else if (ANY_ARRAY(val1)) {
         REBSER *hser = 0;   // hash table for series
         REBSER *hret;       // hash table for return series
 
@@ -115,7 +255,7 @@ REBSER *Make_Set_Operation_Series(
         // efficient.
         //
         REBSER *buffer = Make_Array(i);
-        hret = Make_Hash_Series(i);   // allocated
+        hret = Make_Scratch_Hash_Series(TOP_FRAME, i);  // freed with frame
 
         // Optimization note: !!
         // This code could be optimized for small blocks by not hashing them
@@ -128,15 +268,30 @@ REBSER *Make_Set_Operation_Series(
 
             // Check what is in series1 but not in series2
             //
-            if (flags & SOP_FLAG_CHECK)
-                hser = Hash_Block(val2, skip, cased);
+            if ((flags & SOP_FLAG_CHECK) and not IS_MAP(val2))
+                hser = Hash_Block(TOP_FRAME, val2, skip, cased);
 
             // Iterate over first series
             //
             i = VAL_INDEX(val1);
             for (; i < ARR_LEN(array1); i += skip) {
                 Cell(const*) item = ARR_AT(array1, i);
-                if (flags & SOP_FLAG_CHECK) {
+                if ((flags & SOP_FLAG_CHECK) and IS_MAP(val2)) {
+                    const REBMAP *map = VAL_MAP(val2);
+                    REBLEN n = Find_Map_Entry(
+                        m_cast(REBMAP*, map),  // search only, not modified
+                        item,
+                        VAL_SPECIFIER(val1),
+                        nullptr,
+                        SPECIFIED,
+                        cased
+                    );
+                    h = n != 0 and not Is_Void(
+                        ARR_AT(MAP_PAIRLIST(map), ((n - 1) * 2) + 1)
+                    );
+                    if (flags & SOP_FLAG_INVERT) h = !h;
+                }
+                else if (flags & SOP_FLAG_CHECK) {
                     h = Find_Key_Hashed(
                         m_cast(Array(*), VAL_ARRAY(val2)),  // mode 1 unchanged
                         hser,
@@ -172,9 +327,6 @@ REBSER *Make_Set_Operation_Series(
                 fail (Error_Block_Skip_Wrong_Raw());
             }
 
-            if (flags & SOP_FLAG_CHECK)
-                Free_Unmanaged_Series(hser);
-
             if (not first_pass)
                 break;
             first_pass = false;
@@ -187,9 +339,6 @@ REBSER *Make_Set_Operation_Series(
             val2 = temp;
         } while (true);
 
-        if (hret)
-            Free_Unmanaged_Series(hret);
-
         // The buffer may have been allocated too large, so copy it at the
         // used capacity size
         //
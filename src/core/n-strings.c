@@ -27,6 +27,100 @@
 #include "datatypes/sys-money.h"
 
 
+// Blocks that are only TEXT! and INTEGER! (or also WORD! in a THE-BLOCK!,
+// where they aren't fetched) need no evaluation, and none of the DELIMIT
+// rules about voids/blanks/chars apply.  So the size of the result can be
+// totaled first and the pieces copied once into a string of exactly that
+// size, instead of growing the mold buffer as the pieces arrive.
+//
+// Returns nullptr if the block doesn't qualify (including if it's empty, as
+// that has to give back NULL).
+//
+static String(*) Delimit_Inert_Block_Or_Null(
+    Cell(const*) block,
+    option(const REBVAL*) delimiter,
+    bool head,
+    bool tail
+){
+    bool words_ok = IS_THE_BLOCK(block);
+
+    REBLEN delimiter_len = 0;
+    Size delimiter_size = 0;
+    Utf8(const*) delimiter_utf8 = nullptr;
+    if (delimiter) {
+        if (not IS_TEXT(unwrap(delimiter)) and not IS_ISSUE(unwrap(delimiter)))
+            return nullptr;  // e.g. BLANK! delimiter, leave to the full code
+        delimiter_utf8 = VAL_UTF8_LEN_SIZE_AT(
+            &delimiter_len, &delimiter_size, unwrap(delimiter)
+        );
+    }
+
+    Cell(const*) item_tail;
+    Cell(const*) item_head = VAL_ARRAY_AT(&item_tail, block);
+    if (item_head == item_tail)
+        return nullptr;
+
+    Byte buf[60];  // enough for Emit_Integer() of any 64-bit integer
+
+    REBLEN len = 0;
+    Size size = 0;
+
+    Cell(const*) item = item_head;
+    for (; item != item_tail; ++item) {
+        if (IS_INTEGER(item)) {
+            REBINT n = Emit_Integer(buf, VAL_INT64(item));
+            len += n;
+            size += n;
+        }
+        else if (IS_TEXT(item) or (words_ok and IS_WORD(item))) {
+            REBLEN item_len;
+            Size item_size;
+            VAL_UTF8_LEN_SIZE_AT(&item_len, &item_size, item);
+            len += item_len;
+            size += item_size;
+        }
+        else
+            return nullptr;
+    }
+
+    REBLEN num_delimiters = (item_tail - item_head) - 1;
+    if (head)
+        ++num_delimiters;
+    if (tail)
+        ++num_delimiters;
+    len += num_delimiters * delimiter_len;
+    size += num_delimiters * delimiter_size;
+
+    String(*) s = Make_String(size);
+    Byte* dp = STR_HEAD(s);
+
+    for (item = item_head; item != item_tail; ++item) {
+        if (delimiter_size != 0 and (item != item_head or head)) {
+            memcpy(dp, delimiter_utf8, delimiter_size);
+            dp += delimiter_size;
+        }
+
+        if (IS_INTEGER(item))
+            dp += Emit_Integer(dp, VAL_INT64(item));  // room for its '\0'
+        else {
+            Size item_size;
+            Utf8(const*) utf8 = VAL_UTF8_SIZE_AT(&item_size, item);
+            memcpy(dp, utf8, item_size);
+            dp += item_size;
+        }
+    }
+
+    if (delimiter_size != 0 and tail) {
+        memcpy(dp, delimiter_utf8, delimiter_size);
+        dp += delimiter_size;
+    }
+
+    assert(cast(Size, dp - STR_HEAD(s)) == size);
+    TERM_STR_LEN_SIZE(s, len, size);
+    return s;
+}
+
+
 //
 //  delimit: native [
 //
@@ -107,6 +201,15 @@ DECLARE_NATIVE(delimit)
         return Init_Text(OUT, Pop_Molded_String(mo));
     }
 
+    String(*) fast = Delimit_Inert_Block_Or_Null(
+        line,
+        REF(delimiter) ? ARG(delimiter) : nullptr,
+        did REF(head),
+        did REF(tail)
+    );
+    if (fast)
+        return Init_Text(OUT, fast);
+
     Flags flags = FRAME_MASK_NONE;
     if (IS_THE_BLOCK(ARG(line)))
         flags |= EVAL_EXECUTOR_FLAG_NO_EVALUATIONS;
@@ -591,12 +694,6 @@ DECLARE_NATIVE(deline)
     }
 
     String(*) s = VAL_STRING_ENSURE_MUTABLE(input);
-    REBLEN len_head = STR_LEN(s);
-
-    REBLEN len_at = VAL_LEN_AT(input);
-
-    Utf8(*) dest = VAL_STRING_AT_KNOWN_MUTABLE(input);
-    Utf8(const*) src = dest;
 
     // DELINE tolerates either LF or CR LF, in order to avoid disincentivizing
     // remote data in CR LF format from being "fixed" to pure LF format, for
@@ -604,39 +701,47 @@ DECLARE_NATIVE(deline)
     // *all* CR LF or *all* LF format.  If they are mixed they are considered
     // to be malformed...and need custom handling.
     //
-    bool seen_a_cr_lf = false;
-    bool seen_a_lone_lf = false;
-
-    REBLEN n;
-    for (n = 0; n < len_at;) {
-        Codepoint c;
-        src = NEXT_CHR(&c, src);
-        ++n;
-        if (c == LF) {
-            if (seen_a_cr_lf)
-                fail (Error_Mixed_Cr_Lf_Found_Raw());
-            seen_a_lone_lf = true;
-        }
-
-        if (c == CR) {
-            if (seen_a_lone_lf)
-                fail (Error_Mixed_Cr_Lf_Found_Raw());
-
-            dest = WRITE_CHR(dest, LF);
-            src = NEXT_CHR(&c, src);
-            ++n;  // will see '\0' terminator before loop check, so is safe
-            if (c == LF) {
-                --len_head;  // don't write carraige return, note loss of char
-                seen_a_cr_lf = true;
-                continue;
-            }
-            // DELINE requires any CR to be followed by an LF
-            fail (Error_Illegal_Cr(BACK_STR(src), STR_HEAD(s)));
-        }
-        dest = WRITE_CHR(dest, c);
+    // CR and LF are ASCII, and UTF-8 never uses ASCII bytes inside of other
+    // codepoints, so this can work on bytes.  memchr() is used to skip ahead
+    // to the next CR or LF, which C libraries vectorize.
+    //
+    Byte* head = STR_HEAD(s);
+    Byte* at = VAL_STRING_AT_KNOWN_MUTABLE(input);
+    Byte* tail = at + VAL_SIZE_AT(input);
+
+    Byte* cr = cast(Byte*, memchr(at, CR, tail - at));
+    if (not cr)
+        return input;  // all LF (or no newlines), nothing to do
+
+    if (memchr(at, LF, cr - at))  // a lone LF came before the first CR LF
+        fail (Error_Mixed_Cr_Lf_Found_Raw());
+
+    Byte* dest = cr;
+    Byte* src = cr;
+    REBLEN num_crs = 0;
+    while (true) {
+        assert(*src == CR);
+        if (src + 1 == tail or src[1] != LF)  // any CR must be followed by LF
+            fail (Error_Illegal_Cr(src + 1, head));
+        ++src;  // drop the CR, the LF is copied with the run after it
+        ++num_crs;
+
+        Byte* run_tail = cast(Byte*, memchr(src, CR, tail - src));
+        if (not run_tail)
+            run_tail = tail;
+
+        if (memchr(src + 1, LF, run_tail - (src + 1)))  // lone LF after CR LF
+            fail (Error_Mixed_Cr_Lf_Found_Raw());
+
+        memmove(dest, src, run_tail - src);
+        dest += run_tail - src;
+        src = run_tail;
+        if (src == tail)
+            break;
     }
 
-    TERM_STR_LEN_SIZE(s, len_head, dest - VAL_STRING_AT(input));
+    Free_Bookmarks_Maybe_Null(s);  // byte offsets after the first CR moved
+    TERM_STR_LEN_SIZE(s, STR_LEN(s) - num_crs, dest - head);
 
     return input;
 }
@@ -658,75 +763,89 @@ DECLARE_NATIVE(enline)
     REBVAL *val = ARG(string);
 
     String(*) s = VAL_STRING_ENSURE_MUTABLE(val);
-    REBLEN idx = VAL_INDEX(val);
+    Size size = VAL_SIZE_AT(val);
 
-    Length len;
-    Size size = VAL_SIZE_LIMIT_AT(&len, val, UNLIMITED);
+    // CR and LF are ASCII, and UTF-8 never uses ASCII bytes inside of other
+    // codepoints, so this can work on bytes.  The LFs are counted first so
+    // the series is expanded once, then the text is slid toward the tail
+    // a line at a time, inserting a CR before each LF.
+    //
+    Byte* at = VAL_STRING_AT_KNOWN_MUTABLE(val);
+    Size offset = at - STR_HEAD(s);
 
-    REBLEN delta = 0;
+    Byte* cr = cast(Byte*, memchr(at, CR, size));
+    if (cr)
+        fail (Error_Illegal_Cr(cr, STR_HEAD(s)));
 
-    // Calculate the size difference by counting the number of LF's
-    // that have no CR's in front of them.
-    //
-    // !!! The Utf8(*) interface isn't technically necessary if one is
-    // counting to the end (one could just go by bytes instead of characters)
-    // but this would not work if someone added, say, an ENLINE/PART...since
-    // the byte ending position of interest might not be end of the string.
-
-    Utf8(*) cp = STR_AT(s, idx);
-
-    bool relax = false;  // !!! in case we wanted to tolerate CR LF already?
-    Codepoint c_prev = '\0';
-
-    REBLEN n;
-    for (n = 0; n < len; ++n) {
-        Codepoint c;
-        cp = NEXT_CHR(&c, cp);
-        if (c == LF and (not relax or c_prev != CR))
-            ++delta;
-        if (c == CR and not relax)  // !!! Note: `relax` fixed at false, ATM
-            fail (Error_Illegal_Cr(BACK_STR(cp), STR_HEAD(s)));
-        c_prev = c;
+    REBLEN delta = 0;
+    Byte* lf = at;
+    while ((lf = cast(Byte*, memchr(lf, LF, at + size - lf))) != nullptr) {
+        ++delta;
+        ++lf;
     }
 
     if (delta == 0)
         return COPY(ARG(string)); // nothing to do
 
-    REBLEN old_len = s->misc.length;
+    Length new_len = STR_LEN(s) + delta;  // just adding CR's
+    Size new_size = STR_SIZE(s) + delta;
     EXPAND_SERIES_TAIL(s, delta);  // corrupts str->misc.length
-    s->misc.length = old_len + delta;  // just adding CR's
-
-    // One feature of using UTF-8 for strings is that CR/LF substitution can
-    // stay a byte-oriented process..because UTF-8 doesn't reuse bytes in the
-    // ASCII range, and CR and LF are ASCII.  So as long as the "sliding" is
-    // done in terms of byte sizes and not character lengths, it should work.
 
     Free_Bookmarks_Maybe_Null(s);  // !!! Could this be avoided sometimes?
 
-    Byte* bp = STR_HEAD(s); // expand may change the pointer
-    Size tail = STR_SIZE(s); // size in bytes after expansion
-
-    // Add missing CRs
+    Byte* bp = STR_HEAD(s);  // expand may change the pointer
+    Byte* src = bp + offset + size;  // old tail
+    Byte* dest = src + delta;
 
     while (delta > 0) {
+        Byte* line = src - 1;
+        while (*line != LF)
+            --line;
+
+        Size run = src - line;  // from the LF up to what's been moved
+        dest -= run;
+        memmove(dest, line, run);
+        *--dest = CR;
+        --delta;
+        src = line;
+    }
+    assert(dest == src);
 
-        bp[tail--] = bp[size];  // Copy src to dst.
+    TERM_STR_LEN_SIZE(s, new_len, new_size);
 
-        if (
-            bp[size] == LF
-            and (
-                not relax  // !!! Note: `relax` fixed at false, ATM
-                or size == 0
-                or bp[size - 1] != CR
-            )
-        ){
-            bp[tail--] = CR;
-            --delta;
-        }
-        --size;
+    return COPY(ARG(string));
+}
+
+
+// ENTAB and DETAB only look for ASCII spaces, tabs, and line feeds, so they
+// can go by bytes and copy the runs in between without decoding them.
+// Codepoints are counted (by the bytes that aren't UTF-8 continuation bytes)
+// for the length of the result, and DETAB's column.
+//
+static Length Append_Valid_Utf8(String(*) dst, const Byte* utf8, Size size)
+{
+    Length len = 0;
+    Size i;
+    for (i = 0; i < size; ++i) {
+        if ((utf8[i] & 0xC0) != 0x80)
+            ++len;
     }
 
-    return COPY(ARG(string));
+    Length old_len = STR_LEN(dst);
+    Size old_size = STR_SIZE(dst);
+    EXPAND_SERIES_TAIL(dst, size);
+    memcpy(BIN_AT(dst, old_size), utf8, size);
+    TERM_STR_LEN_SIZE(dst, old_len + len, old_size + size);
+    return len;
+}
+
+static void Append_Spaces(String(*) dst, REBLEN n)
+{
+    Length old_len = STR_LEN(dst);
+    Size old_size = STR_SIZE(dst);
+    EXPAND_SERIES_TAIL(dst, n);
+    memset(BIN_AT(dst, old_size), ' ', n);
+    TERM_STR_LEN_SIZE(dst, old_len + n, old_size + n);
 }
 
 
@@ -743,6 +862,10 @@ DECLARE_NATIVE(enline)
 //  ]
 //
 DECLARE_NATIVE(entab)
+//
+// Only leading whitespace on each line is changed.  Each run of `tabsize`
+// spaces becomes a tab, and a tab absorbs any spaces before it that didn't
+// make a full run.  (Trailing whitespace at the very end is dropped.)
 {
     INCLUDE_PARAMS_OF_ENTAB;
 
@@ -755,50 +878,37 @@ DECLARE_NATIVE(entab)
     DECLARE_MOLD (mo);
     Push_Mold(mo);
 
-    REBLEN len = VAL_LEN_AT(ARG(string));
-
-    Utf8(const*) up = VAL_STRING_AT(ARG(string));
-    REBLEN index = VAL_INDEX(ARG(string));
+    const Byte* cp = VAL_STRING_AT(ARG(string));
+    const Byte* tail = cp + VAL_SIZE_AT(ARG(string));
 
-    REBINT n = 0;
-    for (; index < len; index++) {
-        Codepoint c;
-        up = NEXT_CHR(&c, up);
-
-        // Count leading spaces, insert TAB for each tabsize:
-        if (c == ' ') {
-            if (++n >= tabsize) {
+    while (cp != tail) {
+        REBINT n = 0;
+        for (; cp != tail; ++cp) {
+            if (*cp == ' ') {
+                if (++n >= tabsize) {
+                    Append_Codepoint(mo->series, '\t');
+                    n = 0;
+                }
+            }
+            else if (*cp == '\t') {
                 Append_Codepoint(mo->series, '\t');
                 n = 0;
             }
-            continue;
+            else
+                break;
         }
+        if (cp == tail)
+            break;
 
-        // Hitting a leading TAB resets space counter:
-        if (c == '\t') {
-            Append_Codepoint(mo->series, '\t');
-            n = 0;
-        }
-        else {
-            // Incomplete tab space, pad with spaces:
-            for (; n > 0; n--)
-                Append_Codepoint(mo->series, ' ');
-
-            // Copy chars thru end-of-line (or end of buffer):
-            for (; index < len; ++index) {
-                if (c == '\n') {
-                    //
-                    // !!! The original code didn't seem to actually move the
-                    // append pointer, it just changed the last character to
-                    // a newline.  Was this the intent?
-                    //
-                    Append_Codepoint(mo->series, '\n');
-                    break;
-                }
-                Append_Codepoint(mo->series, c);
-                up = NEXT_CHR(&c, up);
-            }
-        }
+        if (n > 0)  // incomplete tab space, pad with spaces
+            Append_Spaces(mo->series, n);
+
+        // Copy chars thru end-of-line (or end of buffer)
+        //
+        const Byte* lf = cast(const Byte*, memchr(cp, '\n', tail - cp));
+        const Byte* line_tail = lf ? lf + 1 : tail;
+        Append_Valid_Utf8(mo->series, cp, line_tail - cp);
+        cp = line_tail;
     }
 
     enum Reb_Kind kind = VAL_TYPE(ARG(string));
@@ -822,8 +932,6 @@ DECLARE_NATIVE(detab)
 {
     INCLUDE_PARAMS_OF_DETAB;
 
-    REBLEN len = VAL_LEN_AT(ARG(string));
-
     REBINT tabsize;
     if (REF(size))
         tabsize = Int32s(ARG(size), 1);
@@ -833,31 +941,29 @@ DECLARE_NATIVE(detab)
     DECLARE_MOLD (mo);
     Push_Mold(mo);
 
-    // Estimate new length based on tab expansion:
-
-    Utf8(const*) cp = VAL_STRING_AT(ARG(string));
-    REBLEN index = VAL_INDEX(ARG(string));
+    const Byte* cp = VAL_STRING_AT(ARG(string));
+    const Byte* tail = cp + VAL_SIZE_AT(ARG(string));
 
-    REBLEN n = 0;
+    REBLEN column = 0;  // in codepoints since the last line feed
+    while (cp != tail) {
+        const Byte* run = cp;
+        while (cp != tail and *cp != '\t' and *cp != '\n')
+            ++cp;
+        column += Append_Valid_Utf8(mo->series, run, cp - run);
 
-    for (; index < len; ++index) {
-        Codepoint c;
-        cp = NEXT_CHR(&c, cp);
+        if (cp == tail)
+            break;
 
-        if (c == '\t') {
-            Append_Codepoint(mo->series, ' ');
-            n++;
-            for (; n % tabsize != 0; n++)
-                Append_Codepoint(mo->series, ' ');
-            continue;
+        if (*cp == '\n') {
+            Append_Codepoint(mo->series, '\n');
+            column = 0;
         }
-
-        if (c == '\n')
-            n = 0;
-        else
-            ++n;
-
-        Append_Codepoint(mo->series, c);
+        else {
+            REBLEN spaces = tabsize - (column % tabsize);
+            Append_Spaces(mo->series, spaces);
+            column += spaces;
+        }
+        ++cp;
     }
 
     enum Reb_Kind kind = VAL_TYPE(ARG(string));
@@ -998,17 +1104,12 @@ DECLARE_NATIVE(invalid_utf8_q)
     Size size;
     const Byte* utf8 = VAL_BINARY_SIZE_AT(&size, arg);
 
-    const Byte* end = utf8 + size;
+    Length num_codepoints;
+    const Byte* bad = Find_Invalid_Utf8(&num_codepoints, utf8, size);
+    if (not bad)
+        return nullptr;  // no invalid byte found
 
-    REBLEN trail;
-    for (; utf8 != end; utf8 += trail) {
-        trail = trailingBytesForUTF8[*utf8] + 1;
-        if (utf8 + trail > end or not isLegalUTF8(utf8, trail)) {
-            Copy_Cell(OUT, arg);
-            VAL_INDEX_RAW(OUT) = utf8 - BIN_HEAD(VAL_BINARY(arg));
-            return OUT;
-        }
-    }
-
-    return nullptr;  // no invalid byte found
+    Copy_Cell(OUT, arg);
+    VAL_INDEX_RAW(OUT) = bad - BIN_HEAD(VAL_BINARY(arg));
+    return OUT;
 }
@@ -115,6 +115,15 @@ DECLARE_NATIVE(exit_rebol)
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /generational "Minor recycles skip frozen data, major every N (0=off)"
+//          [integer!]
+//      /slice "Sweep in slices of N microseconds between evaluations (0=off)"
+//          [integer!]
+//      /budget "Spend up to N microseconds recycling, resume sweep if pending"
+//          [integer!]
+//      /lazy "Leave sweeping to allocations that need the space"
+//          [logic!]
+//      /shrink "Give memory pool segments that are entirely free back to the OS"
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -143,6 +152,24 @@ DECLARE_NATIVE(recycle)
         TG_Ballast = 0;
     }
 
+    if (REF(generational)) {
+        REBINT n = VAL_INT32(ARG(generational));
+        if (n < 0)
+            fail (PARAM(generational));
+        GC_Generational = n;
+        GC_Minors_Since_Major = n;  // next recycle is major, so it tenures
+    }
+
+    if (REF(slice)) {
+        REBI64 usecs = VAL_INT64(ARG(slice));
+        if (usecs < 0)
+            fail (PARAM(slice));
+        GC_Sweep_Budget = usecs;
+    }
+
+    if (REF(lazy))
+        GC_Lazy_Sweep = VAL_LOGIC(ARG(lazy));
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
@@ -169,8 +196,31 @@ DECLARE_NATIVE(recycle)
         assert(recount == count);
       #endif
     }
+    else if (REF(budget)) {
+        REBI64 usecs = VAL_INT64(ARG(budget));
+        if (usecs <= 0)
+            fail (PARAM(budget));
+
+        if (Mem_Pools[STUB_POOL].unswept)  // idle time goes to pending sweep
+            count = Sweep_Pending_Series(usecs);
+        else {
+            REBI64 saved_budget = GC_Sweep_Budget;
+            GC_Sweep_Budget = usecs;  // mark everything, but defer the sweep
+            count = Recycle();
+            GC_Sweep_Budget = saved_budget;
+            count += Sweep_Pending_Series(usecs);
+        }
+    }
     else {
         count = Recycle();
+        if (Mem_Pools[STUB_POOL].unswept)  // explicit RECYCLE is a full one
+            count += Sweep_Pending_Series(0);
+    }
+
+    if (REF(shrink)) {
+        if (Mem_Pools[STUB_POOL].unswept)  // free list incomplete until swept
+            count += Sweep_Pending_Series(0);
+        Shrink_Pools();
     }
 
     if (REF(watch)) {
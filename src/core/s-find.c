@@ -97,6 +97,31 @@ REBINT Compare_UTF8(const Byte* s1, const Byte* s2, Size l2)
     Size l1 = strsize(s1);
     REBINT result = 0;
 
+    // Skip 8 bytes at a time while both sides are ASCII that's the same but
+    // for case (see Lowercase_Ascii_64()).  Any other difference is left for
+    // the codepoint loop to find.
+    //
+    while (l1 >= 8 and l2 >= 8) {
+        uint64_t w1;
+        uint64_t w2;
+        memcpy(&w1, s1, 8);
+        memcpy(&w2, s2, 8);
+        if (not Is_Ascii_64(w1 | w2))
+            break;
+        if (Lowercase_Ascii_64(w1) != Lowercase_Ascii_64(w2))
+            break;
+        if (w1 != w2 and result == 0) {  // first difference only in case
+            Size i = 0;
+            while (s1[i] == s2[i])
+                ++i;
+            result = (s1[i] > s2[i]) ? 3 : 1;
+        }
+        s1 += 8;
+        s2 += 8;
+        l1 -= 8;
+        l2 -= 8;
+    }
+
     for (; l1 > 0 && l2 > 0; s1++, s2++, l1--, l2--) {
         c1 = *s1;
         c2 = *s2;
@@ -124,6 +149,262 @@ REBINT Compare_UTF8(const Byte* s1, const Byte* s2, Size l2)
 }
 
 
+//=//// FIXED PATTERN BYTE SEARCH /////////////////////////////////////////=//
+//
+// Searching long text or binary for a fixed pattern with the general loop in
+// Find_Binstr_In_Binstr() decodes and tests every position.  When the search
+// goes forward one unit at a time, it can instead be done on bytes: UTF-8 is
+// self-synchronizing, so a byte match of a valid UTF-8 pattern can only
+// start on a codepoint boundary.
+//
+// Candidate positions are found with memchr() (which C libraries vectorize),
+// or 8 bytes at a time for an ASCII letter that may be in either case.  Then
+// the last byte of the pattern is checked before the rest.  If candidates
+// keep turning out to be false, the remainder is searched with the Two-Way
+// algorithm of Crochemore and Perrin, which is linear in the worst case.
+//
+// Caseless searches are only done this way for ASCII patterns, since only
+// ASCII letters are folded.  But two non-ASCII codepoints LO_CASE() to ASCII
+// letters: LONG S (U+017F) to `s` and KELVIN SIGN (U+212A) to `k`.  So if the
+// pattern has either letter, the haystack must not contain the lead bytes of
+// their encodings.
+//
+
+#define FIND_BYTES_MIN_SIZE 64  // haystack size worth the setup of a search
+#define FIND_BYTES_MAX_WASTE 2  // false candidate bytes per byte searched
+
+inline static Byte Fold_Byte(Byte b, bool caseless) {
+    if (caseless and b >= 'A' and b <= 'Z')
+        return cast(Byte, b + ('a' - 'A'));
+    return b;
+}
+
+
+// Find `lower` (an ASCII lowercase letter) or its uppercase form in [p end).
+//
+static const Byte* Find_Letter_Caseless(
+    const Byte* p,
+    const Byte* end,
+    Byte lower
+){
+    const uint64_t ones = 0x0101010101010101;
+    const uint64_t highs = 0x8080808080808080;
+    const uint64_t pattern = ones * lower;
+    const uint64_t case_bits = ones * 0x20;
+
+    for (; end - p >= 8; p += 8) {  // find the word with a match
+        uint64_t word;
+        memcpy(&word, p, 8);
+        uint64_t x = (word | case_bits) ^ pattern;  // has zero byte if match
+        if ((x - ones) & ~x & highs)
+            break;
+    }
+    for (; p != end; ++p) {
+        if ((*p | 0x20) == lower)
+            return p;
+    }
+    return nullptr;
+}
+
+
+// Two-Way search for the `size` bytes at `pat` in [h end).
+//
+static const Byte* Find_Bytes_Two_Way(
+    const Byte* h,
+    const Byte* end,
+    const Byte* pat,
+    Size size,
+    bool caseless
+){
+    // Compute the maximal suffix of the pattern for each of the two orders
+    // of bytes; the longer one gives the critical factorization.  Indices
+    // start at "-1", which relies on unsigned wraparound.
+    //
+    Size ip = cast(Size, -1);
+    Size jp = 0;
+    Size k = 1;
+    Size p = 1;
+    while (jp + k < size) {
+        Byte a = Fold_Byte(pat[ip + k], caseless);
+        Byte b = Fold_Byte(pat[jp + k], caseless);
+        if (a == b) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            }
+            else
+                ++k;
+        }
+        else if (a > b) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    Size ms = ip;
+    Size p0 = p;
+
+    ip = cast(Size, -1);
+    jp = 0;
+    k = p = 1;
+    while (jp + k < size) {
+        Byte a = Fold_Byte(pat[ip + k], caseless);
+        Byte b = Fold_Byte(pat[jp + k], caseless);
+        if (a == b) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            }
+            else
+                ++k;
+        }
+        else if (a < b) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    if (ip + 1 > ms + 1)
+        ms = ip;
+    else
+        p = p0;
+
+    // If the part before the factorization repeats at the period, a match
+    // failing in the left half lets the search resume knowing `mem` bytes
+    // already match.  Otherwise there's no such memory, and the shift can
+    // be bigger.
+    //
+    bool periodic = true;
+    for (k = 0; k < ms + 1; ++k) {
+        if (Fold_Byte(pat[k], caseless) != Fold_Byte(pat[k + p], caseless)) {
+            periodic = false;
+            break;
+        }
+    }
+    Size mem0;
+    if (periodic)
+        mem0 = size - p;
+    else {
+        mem0 = 0;
+        p = MAX(ms, size - ms - 1) + 1;
+    }
+    Size mem = 0;
+
+    while (cast(Size, end - h) >= size) {
+        for (k = MAX(ms + 1, mem); k < size; ++k) {  // right half
+            if (Fold_Byte(pat[k], caseless) != Fold_Byte(h[k], caseless))
+                break;
+        }
+        if (k < size) {
+            h += k - ms;
+            mem = 0;
+            continue;
+        }
+
+        for (k = ms + 1; k > mem; --k) {  // left half
+            if (
+                Fold_Byte(pat[k - 1], caseless)
+                != Fold_Byte(h[k - 1], caseless)
+            ){
+                break;
+            }
+        }
+        if (k <= mem)
+            return h;
+
+        h += p;
+        mem = mem0;
+    }
+    return nullptr;
+}
+
+
+// Find the `size` bytes at `pat` in [h end), see notes above.
+//
+static const Byte* Find_Bytes(
+    const Byte* h,
+    const Byte* end,
+    const Byte* pat,
+    Size size,
+    bool caseless
+){
+    if (cast(Size, end - h) < size)
+        return nullptr;
+
+    const Byte* start = h;
+    const Byte* last = end - size;  // last position a match could start
+    Byte first = Fold_Byte(pat[0], caseless);
+    Byte final = Fold_Byte(pat[size - 1], caseless);
+    bool either_case = caseless and first >= 'a' and first <= 'z';
+
+    Size waste = 0;
+    for (; h <= last; ++h) {
+        if (either_case)
+            h = Find_Letter_Caseless(h, last + 1, first);
+        else
+            h = cast(const Byte*, memchr(h, first, last + 1 - h));
+        if (not h)
+            return nullptr;
+
+        if (Fold_Byte(h[size - 1], caseless) != final)
+            continue;
+
+        Size k;
+        for (k = 1; k < size - 1; ++k) {
+            if (Fold_Byte(h[k], caseless) != Fold_Byte(pat[k], caseless))
+                break;
+        }
+        if (k >= size - 1)
+            return h;
+
+        waste += k;
+        if (waste > FIND_BYTES_MAX_WASTE * cast(Size, h - start) + size)
+            return Find_Bytes_Two_Way(h + 1, end, pat, size, caseless);
+    }
+    return nullptr;
+}
+
+
+// Whether Find_Bytes() gives the same answer as the general search would,
+// see notes above.
+//
+static bool Can_Find_Bytes(
+    const Byte* h,
+    const Byte* end,
+    const Byte* pat,
+    Size size,
+    bool caseless
+){
+    if (not caseless)
+        return true;
+
+    bool has_s_or_k = false;
+    Size i;
+    for (i = 0; i < size; ++i) {
+        if (pat[i] >= 0x80)
+            return false;
+        Byte b = Fold_Byte(pat[i], true);
+        if (b == 's' or b == 'k')
+            has_s_or_k = true;
+    }
+    if (not has_s_or_k)
+        return true;
+
+    return (
+        not memchr(h, 0xC5, end - h)  // LONG S is C5 BF
+        and not memchr(h, 0xE2, end - h)  // KELVIN SIGN is E2 84 AA
+    );
+}
+
+
 //
 //  Find_Binstr_In_Binstr: C
 //
@@ -252,6 +533,38 @@ REBINT Find_Binstr_In_Binstr(
     if (not is_2_str)
         caseless = false;  //
 
+    // Plain forward searches in enough data are done on bytes if possible.
+    //
+    if (
+        skip1 == 1
+        and not (flags & AM_FIND_MATCH)
+        and CELL_HEART(binstr1) != REB_ISSUE
+    ){
+        const Byte* end_ptr;
+        if (not is_1_str)
+            end_ptr = cp1 + (end1_unsigned - index1);
+        else if (end1_unsigned == len_head1)
+            end_ptr = cp1 + size_at1;
+        else
+            end_ptr = STR_AT(VAL_STRING(binstr1), end1_unsigned);
+
+        if (
+            end_ptr - cp1 >= FIND_BYTES_MIN_SIZE
+            and Can_Find_Bytes(cp1, end_ptr, head2, size2, caseless)
+        ){
+            const Byte* found = Find_Bytes(
+                cp1, end_ptr, head2, size2, caseless
+            );
+            if (not found)
+                return NOT_FOUND;
+
+            *len_out = window1;
+            if (not is_1_str)
+                return index1 + (found - cp1);
+            return index1 + Num_Codepoints_For_Bytes(cp1, found);
+        }
+    }
+
     // Binary-compatible to: [next2 = NEXT_CHR(&c2_canon, head2)]
     Codepoint c2_canon;  // calculate first char lowercase once, vs. each step
     const Byte* next2;
@@ -462,6 +775,20 @@ REBINT Find_Bitset_In_Binstr(
     bool is_str = (CELL_HEART(binstr) != REB_BINARY);
 
     const Byte* cp1 = is_str ? VAL_STRING_AT(binstr) : VAL_BINARY_AT(binstr);
+
+    if (skip == 1 and not (flags & AM_FIND_MATCH)) {  // common case, faster
+        if (index >= end)
+            return NOT_FOUND;
+        REBLEN span = Span_Bitset(
+            cp1, end - index, is_str, bset, uncase,
+            false  // span characters *not* in the set
+        );
+        if (index + cast(REBINT, span) == end)
+            return NOT_FOUND;
+        *len_out = 1;
+        return index + span;
+    }
+
     Codepoint c1;
     if (skip > 0) {  // skip 1 will pass over cp1, so leave as is
         if (is_str)
@@ -48,6 +48,106 @@ String(*) Make_String_Core(Size encoded_capacity, Flags flags)
 }
 
 
+//
+//  Find_String_Checkpoint: C
+//
+// Get the index and offset of the last bookmark checkpoint at or before `at`
+// (which may just be the head of the string).  If the string's bookmarks
+// have no checkpoints, they are made first, in one pass over the string.
+//
+REBLEN Find_String_Checkpoint(Size *offset_out, String(*) s, REBLEN at)
+{
+    REBBMK *book = LINK(Bookmarks, s);
+    assert(book);
+
+    if (SER_USED(book) == 1) {
+        REBLEN num = STR_LEN(s) / STR_INDEX_STRIDE;
+        EXPAND_SERIES_TAIL(book, num);
+
+        Utf8(const*) cp = STR_HEAD(s);
+        REBLEN n;
+        for (n = 1; n <= num; ++n) {
+            REBLEN i;
+            for (i = 0; i < STR_INDEX_STRIDE; ++i)
+                cp = NEXT_STR(cp);
+            BMK_AT(book, n)->index = n * STR_INDEX_STRIDE;
+            BMK_AT(book, n)->offset = cast(const Byte*, cp) - SER_DATA(s);
+        }
+    }
+
+    REBLEN lo = 1;  // binary search for first checkpoint past `at`
+    REBLEN hi = SER_USED(book);
+    while (lo < hi) {
+        REBLEN mid = lo + (hi - lo) / 2;
+        if (BMK_AT(book, mid)->index <= at)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo == 1) {  // all checkpoints are past `at`
+        *offset_out = 0;
+        return 0;
+    }
+    *offset_out = BMK_AT(book, lo - 1)->offset;
+    return BMK_AT(book, lo - 1)->index;
+}
+
+
+//
+//  Update_Bookmarks_For_Change: C
+//
+// Adjust a string's bookmarks after the `removed_len` codepoints (of size
+// `removed_size`) at `index` (and `offset`) were replaced by `added_len`
+// codepoints (of size `added_size`).  To an insertion, nothing is removed.
+//
+void Update_Bookmarks_For_Change(
+    String(*) s,
+    REBLEN index,
+    Size offset,
+    REBLEN removed_len,
+    Size removed_size,
+    REBLEN added_len,
+    Size added_size
+){
+    REBBMK *book = LINK(Bookmarks, s);
+    REBLEN end = index + removed_len;
+
+    struct Reb_Bookmark *last = BMK_AT(book, 0);  // last access
+    if (last->index > index) {
+        if (last->index < end) {  // inside the replaced material
+            last->index = index;
+            last->offset = offset;
+        }
+        else {
+            last->index = last->index - removed_len + added_len;
+            last->offset = last->offset - removed_size + added_size;
+        }
+    }
+
+    if (added_len > STR_INDEX_STRIDE) {  // too far between checkpoints now
+        SET_SERIES_LEN(book, 1);
+        return;
+    }
+
+    REBLEN used = SER_USED(book);
+    REBLEN n;
+    REBLEN dest = 1;
+    for (n = 1; n < used; ++n) {
+        struct Reb_Bookmark *b = BMK_AT(book, n);
+        if (b->index > index) {
+            if (b->index < end)
+                continue;  // inside the replaced material, drop it
+            b->index = b->index - removed_len + added_len;
+            b->offset = b->offset - removed_size + added_size;
+        }
+        *BMK_AT(book, dest) = *b;
+        ++dest;
+    }
+    SET_SERIES_LEN(book, dest);
+}
+
+
 //
 //  Copy_Bytes: C
 //
@@ -297,6 +397,30 @@ String(*) Append_UTF8_May_Fail(
 
     const Byte* bp = cb_cast(utf8);
 
+    // The usual case is valid data with no CR or zero bytes, which can be
+    // checked in bulk and copied as-is.  Other input goes through the loop
+    // below, to convert CR LF or report exactly where the problem is.
+    //
+  blockscope {
+    Length len;
+    if (
+        not Find_Invalid_Utf8(&len, bp, size)
+        and not memchr(bp, '\0', size)
+        and (strmode == STRMODE_ALL_CODEPOINTS or not memchr(bp, CR, size))
+    ){
+        if (not dst)
+            dst = Make_String(size);
+
+        Length old_len = STR_LEN(dst);
+        Size old_size = STR_SIZE(dst);
+
+        EXPAND_SERIES_TAIL(dst, size);
+        memcpy(BIN_AT(dst, old_size), bp, size);
+        TERM_STR_LEN_SIZE(dst, old_len + len, old_size + size);
+        return dst;
+    }
+  }
+
     DECLARE_MOLD (mo); // !!! REVIEW: don't need intermediate if no CRLF_TO_LF
     Push_Mold(mo);
 
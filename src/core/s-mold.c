@@ -381,6 +381,47 @@ void MF_Unhooked(REB_MOLD *mo, noquote(Cell(const*)) v, bool form)
 }
 
 
+//
+//  Flush_Mold_Sink: C
+//
+// Write all but the last `keep` bytes of a mold to its sink port, and drop
+// them from the mold buffer.  This way a mold of a huge value only needs a
+// chunk's worth of buffer at a time.
+//
+// Mold hooks may look back at (or trim) the last few bytes they emitted, so
+// a flush in mid-mold keeps some bytes back.  Codepoints aren't split.
+//
+void Flush_Mold_Sink(REB_MOLD *mo, Size keep)
+{
+    assert(mo->sink);
+
+    String(*) s = mo->series;
+    Size size = STR_SIZE(s) - mo->base.size;
+    if (size <= keep)
+        return;
+
+    Byte* head = BIN_AT(s, mo->base.size);
+    Size flush = size - keep;
+    while (flush > 0 and Is_Continuation_Byte_If_Utf8(head[flush]))
+        --flush;  // head[size] is the terminator if keep is 0
+
+    Length len = 0;
+    Size i;
+    for (i = 0; i < flush; ++i) {
+        if (not Is_Continuation_Byte_If_Utf8(head[i]))
+            ++len;
+    }
+
+    REBVAL *chunk = rebSizedBinary(head, flush);
+
+    memmove(head, head + flush, size - flush);
+    Free_Bookmarks_Maybe_Null(s);
+    TERM_STR_LEN_SIZE(s, STR_LEN(s) - len, STR_SIZE(s) - flush);
+
+    rebElide("write", mo->sink, rebR(chunk));  // may mold, above our tail
+}
+
+
 //
 //  Mold_Or_Form_Cell: C
 //
@@ -412,6 +453,13 @@ void Mold_Or_Form_Cell(
       #endif
     }
 
+    if (
+        mo->sink
+        and STR_SIZE(s) - mo->base.size >= MOLD_SINK_CHUNK + MOLD_SINK_KEEP
+    ){
+        Flush_Mold_Sink(mo, MOLD_SINK_KEEP);
+    }
+
     MOLD_HOOK *hook = Mold_Or_Form_Hook_For_Type_Of(cell);
     hook(mo, cell, form);
 
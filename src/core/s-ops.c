@@ -173,32 +173,40 @@ void Change_Case(
     // be possible, only contractions (is that true?)  Review when UTF-8
     // Everywhere is more mature to the point this is worth worrying about.
     //
+    // Runs of ASCII are changed 8 bytes at a time in place, with only the
+    // rest going through the case tables (see Lowercase_Ascii_64()).  There
+    // are at least as many bytes left as codepoints, so if 8 codepoints are
+    // left then 8 bytes can be read.
+    //
     Utf8(*) up = VAL_STRING_AT_ENSURE_MUTABLE(val);
-    Utf8(*) dp;
-    if (upper) {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            Codepoint c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, UP_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
+    REBLEN n = 0;
+    while (n < len) {
+        if (len - n >= 8) {
+            Byte* bp = cast(Byte*, up);
+            uint64_t w;
+            memcpy(&w, bp, 8);
+            if (Is_Ascii_64(w)) {
+                w = upper ? Uppercase_Ascii_64(w) : Lowercase_Ascii_64(w);
+                memcpy(bp, &w, 8);
+                up = cast(Utf8(*), bp + 8);
+                n += 8;
+                continue;
             }
         }
-    }
-    else {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            Codepoint c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, LO_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
+
+        Utf8(*) dp = up;
+
+        Codepoint c;
+        up = NEXT_CHR(&c, up);
+        ++n;
+
+        if (c >= UNICODE_CASES)
+            continue;
+
+        Codepoint changed = upper ? UP_CASE(c) : LO_CASE(c);
+        if (changed != c) {
+            dp = WRITE_CHR(dp, changed);
+            assert(dp == up); // !!! not all case changes same byte size?
         }
     }
 }
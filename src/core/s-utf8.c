@@ -0,0 +1,315 @@
+//
+//  File: %s-utf8.c
+//  Summary: "bulk UTF-8 validation and codepoint counting"
+//  Section: strings
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// When BINARY! data becomes TEXT! (or a file is read as text) the bytes have
+// to be checked as legal UTF-8, and the codepoints counted to cache as the
+// string's length.  Doing that with Back_Scan_UTF8_Char() on each non-ASCII
+// byte is slow for big inputs, so this file checks whole buffers at once.
+//
+// On x86-64 CPUs with SSSE3, 16 bytes are checked at a time using the lookup
+// table method from "Validating UTF-8 In Less Than One Instruction Per Byte"
+// (Keiser and Lemire, 2021), as used in simdjson.  Other platforms skip over
+// runs of ASCII a machine word at a time, and check the rest per codepoint.
+//
+// Either way, the rules are the same as isLegalUTF8(): no overlong forms, no
+// UTF-16 surrogates, nothing over U+10FFFF.  Note that zero bytes are legal
+// UTF-8, so callers making ANY-STRING! must check for those separately.
+//
+
+#include "sys-core.h"
+
+// The SSSE3 path is compiled for that instruction set with a target
+// attribute, and only taken if detected at runtime (like %s-crc.c does).
+//
+#if defined(__x86_64__) || defined(_M_X64)
+  #if defined(__GNUC__) || defined(__clang__)
+    #include <immintrin.h>
+    #define UTF8_SSSE3 1
+    #define UTF8_SSSE3_TARGET __attribute__((target("ssse3")))
+  #elif defined(_MSC_VER)
+    #include <intrin.h>
+    #define UTF8_SSSE3 1
+    #define UTF8_SSSE3_TARGET
+  #endif
+#endif
+
+static bool utf8_ssse3 = false;  // set by Startup_Utf8() if CPU supports
+
+
+//
+//  Find_Invalid_Utf8_Portable: C
+//
+// Checks codepoint by codepoint, with the same loop as INVALID-UTF8?.  So its
+// answer for where an error is defines the answer for the faster methods.
+//
+static const Byte* Find_Invalid_Utf8_Portable(
+    Length* num_codepoints,
+    const Byte* utf8,
+    Size size
+){
+    const Byte* bp = utf8;
+    const Byte* end = utf8 + size;
+    Length count = 0;
+
+    while (bp != end) {
+        while (end - bp >= cast(REBINT, sizeof(uintptr_t))) {
+            uintptr_t word;
+            memcpy(&word, bp, sizeof(uintptr_t));  // may be unaligned
+            if (word & (UINTPTR_MAX / 0xFF * 0x80))  // high bit of any byte
+                break;
+            bp += sizeof(uintptr_t);
+            count += sizeof(uintptr_t);
+        }
+        if (bp == end)
+            break;
+
+        REBLEN trail = trailingBytesForUTF8[*bp] + 1;
+        if (bp + trail > end or not isLegalUTF8(bp, trail)) {
+            *num_codepoints = count;
+            return bp;
+        }
+        bp += trail;
+        ++count;
+    }
+
+    *num_codepoints = count;
+    return nullptr;
+}
+
+
+#if defined(UTF8_SSSE3)
+
+// Errors that can be detected from the first two bytes of a sequence, by
+// ANDing together what the high nibble of the first byte, its low nibble,
+// and the high nibble of the second byte say is possible.
+//
+#define TOO_SHORT       (1 << 0)  // lead byte not followed by continuation
+#define TOO_LONG        (1 << 1)  // ASCII followed by continuation
+#define OVERLONG_3      (1 << 2)  // E0 followed by 80..9F
+#define TOO_LARGE       (1 << 3)  // F4 followed by 90..BF, or F5..FF
+#define SURROGATE       (1 << 4)  // ED followed by A0..BF
+#define OVERLONG_2      (1 << 5)  // C0 or C1
+#define TOO_LARGE_1000  (1 << 6)  // F5..FF followed by 80..8F
+#define OVERLONG_4      (1 << 6)  // F0 followed by 80..8F
+#define TWO_CONTS       (1 << 7)  // two continuation bytes (maybe legal)
+
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+static const int8_t byte_1_high[16] = {
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,  // 0xxx (ASCII)
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    cast(int8_t, TWO_CONTS), cast(int8_t, TWO_CONTS),  // 10xx (continuation)
+    cast(int8_t, TWO_CONTS), cast(int8_t, TWO_CONTS),
+    TOO_SHORT | OVERLONG_2,  // 1100
+    TOO_SHORT,  // 1101
+    TOO_SHORT | OVERLONG_3 | SURROGATE,  // 1110
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4  // 1111
+};
+
+static const int8_t byte_1_low[16] = {
+    cast(int8_t, CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4),  // xxxx0000
+    cast(int8_t, CARRY | OVERLONG_2),  // xxxx0001
+    cast(int8_t, CARRY),  // xxxx0010
+    cast(int8_t, CARRY),  // xxxx0011
+    cast(int8_t, CARRY | TOO_LARGE),  // xxxx0100
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),  // xxxx0101 and up...
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),  // 1101
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000),
+    cast(int8_t, CARRY | TOO_LARGE | TOO_LARGE_1000)
+};
+
+static const int8_t byte_2_high[16] = {
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,  // 0xxx (ASCII)
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    cast(int8_t,  // 1000
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000
+        | OVERLONG_4
+    ),
+    cast(int8_t,  // 1001
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE
+    ),
+    cast(int8_t, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+    cast(int8_t, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT  // 11xx (lead)
+};
+
+// Bytes that don't start with 10 are the start of a codepoint.
+//
+inline static REBLEN Count_Leads_16(int mask)
+{
+    REBLEN n = cast(REBLEN, mask);
+    n = n - ((n >> 1) & 0x5555);
+    n = (n & 0x3333) + ((n >> 2) & 0x3333);
+    n = (n + (n >> 4)) & 0x0F0F;
+    return (n + (n >> 8)) & 0x1F;
+}
+
+// Gives nonzero bytes where the 16 bytes in `input` (preceded by `prev`)
+// don't make up legal UTF-8, other than sequences that aren't finished yet.
+//
+UTF8_SSSE3_TARGET
+inline static __m128i Check_Utf8_16(__m128i input, __m128i prev)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+
+    __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    __m128i b1h = _mm_shuffle_epi8(
+        _mm_loadu_si128(cast(const __m128i*, byte_1_high)),
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)
+    );
+    __m128i b1l = _mm_shuffle_epi8(
+        _mm_loadu_si128(cast(const __m128i*, byte_1_low)),
+        _mm_and_si128(prev1, nibble)
+    );
+    __m128i b2h = _mm_shuffle_epi8(
+        _mm_loadu_si128(cast(const __m128i*, byte_2_high)),
+        _mm_and_si128(_mm_srli_epi16(input, 4), nibble)
+    );
+    __m128i special = _mm_and_si128(_mm_and_si128(b1h, b1l), b2h);
+
+    // A continuation after a continuation (TWO_CONTS) is only legal as the
+    // third byte after E0..FF or fourth after F0..FF, and it's required then.
+    //
+    __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+    __m128i is_third = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80));
+    __m128i is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80));
+    __m128i must_be_cont = _mm_and_si128(
+        _mm_or_si128(is_third, is_fourth),
+        _mm_set1_epi8(cast(char, 0x80))
+    );
+    return _mm_xor_si128(must_be_cont, special);
+}
+
+UTF8_SSSE3_TARGET
+static const Byte* Find_Invalid_Utf8_Ssse3(
+    Length* num_codepoints,
+    const Byte* utf8,
+    Size size
+){
+    const __m128i non_continuation = _mm_set1_epi8(-65);  // 0xBF signed
+    const __m128i incomplete_max = _mm_setr_epi8(  // last 3 bytes can't lead
+        -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1,
+        cast(char, 0xF0 - 1), cast(char, 0xE0 - 1), cast(char, 0xC0 - 1)
+    );
+
+    __m128i prev = _mm_setzero_si128();
+    __m128i incomplete = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+    Length count = 0;
+
+    const Byte* bp = utf8;
+    Size left = size;
+    while (true) {
+        __m128i input;
+        if (left >= 16)
+            input = _mm_loadu_si128(cast(const __m128i*, bp));
+        else {
+            Byte last[16];  // zero padding finds sequences cut off at end
+            memset(last, 0, 16);
+            memcpy(last, bp, left);
+            input = _mm_loadu_si128(cast(const __m128i*, last));
+        }
+
+        if (_mm_movemask_epi8(input) == 0) {  // all ASCII
+            error = _mm_or_si128(error, incomplete);
+            incomplete = _mm_setzero_si128();
+        }
+        else {
+            error = _mm_or_si128(error, Check_Utf8_16(input, prev));
+            incomplete = _mm_subs_epu8(input, incomplete_max);
+        }
+
+        if (left < 16) {  // padding is ASCII, so count just what's real
+            count += Count_Leads_16(
+                _mm_movemask_epi8(_mm_cmpgt_epi8(input, non_continuation))
+            ) - (16 - left);
+            break;
+        }
+        count += Count_Leads_16(
+            _mm_movemask_epi8(_mm_cmpgt_epi8(input, non_continuation))
+        );
+
+        prev = input;
+        bp += 16;
+        left -= 16;
+    }
+
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF)
+        return Find_Invalid_Utf8_Portable(num_codepoints, utf8, size);
+
+    *num_codepoints = count;
+    return nullptr;
+}
+
+static bool Cpu_Has_Ssse3(void) {
+  #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+  #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+  #endif
+}
+
+#endif
+
+
+//
+//  Find_Invalid_Utf8: C
+//
+// Check that `size` bytes of `utf8` are legal UTF-8, and count codepoints.
+// Returns nullptr if they are, else the start of the first bad sequence (and
+// the count is of the codepoints before it).
+//
+const Byte* Find_Invalid_Utf8(
+    Length* num_codepoints,
+    const Byte* utf8,
+    Size size
+){
+  #if defined(UTF8_SSSE3)
+    if (utf8_ssse3 and size >= 16)
+        return Find_Invalid_Utf8_Ssse3(num_codepoints, utf8, size);
+  #endif
+
+    return Find_Invalid_Utf8_Portable(num_codepoints, utf8, size);
+}
+
+
+//
+//  Startup_Utf8: C
+//
+void Startup_Utf8(void)
+{
+  #if defined(UTF8_SSSE3)
+    utf8_ssse3 = Cpu_Has_Ssse3();
+  #endif
+}
@@ -50,6 +50,9 @@ REBINT CT_Binary(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
     Size size2;
     const Byte* data2 = VAL_BINARY_SIZE_AT(&size2, b);
 
+    if (data1 == data2 and size1 == size2)  // same series and position
+        return 0;
+
     REBLEN size = MIN(size1, size2);
 
     REBINT n = memcmp(data1, data2, size);
@@ -160,11 +163,8 @@ static Bounce MAKE_TO_Binary_Common(Frame(*) frame_, const REBVAL *arg)
         }
         fail ("TUPLE! did not consist entirely of INTEGER! values 0-255"); }
 
-      case REB_BITSET:
-        return Init_Binary(
-            OUT,
-            Copy_Bytes(BIN_HEAD(VAL_BINARY(arg)), VAL_LEN_HEAD(arg))
-        );
+      case REB_BITSET:  // may have ranges, see BITS_RANGES()
+        return Init_Binary(OUT, Flatten_Bitset(VAL_BITSET(arg)));
 
       case REB_MONEY: {
         Binary(*) bin = Make_Binary(12);
@@ -788,6 +788,9 @@ REBTYPE(Binary)
         if (REF(compare))
             fail (Error_Bad_Refines_Raw());  // !!! not in R3-Alpha
 
+        if (REF(key))
+            fail (Error_Bad_Refines_Raw());
+
         Flags thunk = 0;
 
         Copy_Cell(OUT, v);  // copy to output before index adjustment
@@ -816,7 +819,9 @@ REBTYPE(Binary)
         if (REF(reverse))
             thunk |= CC_FLAG_REVERSE;
 
-        reb_qsort_r(
+        // Equal bytes are indistinguishable, but /SKIP records aren't.
+        //
+        (REF(stable) or skip > 1 ? &reb_stable_sort_r : &reb_qsort_r)(
             data_at,
             len,
             size,
@@ -25,6 +25,247 @@
 #include "sys-core.h"
 
 
+//
+//  Make_Bitset: C
+//
+Binary(*) Make_Bitset(REBLEN num_bits)
+{
+    REBLEN num_bytes = (num_bits + 7) / 8;
+    Binary(*) bin = Make_Binary(num_bytes);
+    Clear_Series(bin);
+    TERM_BIN_LEN(bin, num_bytes);
+    INIT_BITS_NOT(bin, false);
+    return bin;
+}
+
+
+static void Init_Bits_Ranges(Binary(*) bset, Binary(*) ranges)
+{
+    if (ranges) {
+        mutable_LINK(BitsetRanges, bset) = ranges;
+        SET_SERIES_FLAG(bset, LINK_NODE_NEEDS_MARK);
+    }
+    else
+        CLEAR_SERIES_FLAG(bset, LINK_NODE_NEEDS_MARK);
+}
+
+
+// Index of the first range whose high end is at or past `n`.  That's the
+// range holding `n` if there is one, else the first range after `n`, else
+// the count of ranges.
+//
+static REBLEN Find_Bits_Range(Binary(const*) ranges, Codepoint n)
+{
+    const Codepoint *r = BITS_RANGES_HEAD(ranges);
+    REBLEN lo = 0;
+    REBLEN hi = BITS_RANGES_COUNT(ranges);
+    while (lo < hi) {
+        REBLEN mid = (lo + hi) / 2;
+        if (r[mid * 2 + 1] < n)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+// Replace ranges [i, j) with the `count` [low high] pairs at `pairs`.
+//
+static void Splice_Bits_Ranges(
+    Binary(*) ranges,
+    REBLEN i,
+    REBLEN j,
+    const Codepoint *pairs,
+    REBLEN count
+){
+    const Size pair_size = 2 * sizeof(Codepoint);
+
+    if (count > j - i)
+        Expand_Series(ranges, j * pair_size, (count - (j - i)) * pair_size);
+    else if (count < j - i)
+        Remove_Series_Units(
+            ranges, (i + count) * pair_size, ((j - i) - count) * pair_size
+        );
+
+    if (count != 0)
+        memcpy(BITS_RANGES_HEAD(ranges) + i * 2, pairs, count * pair_size);
+    TERM_BIN(ranges);
+}
+
+
+// Set or clear the bits from `lo` to `hi` in the ranges.  These must all be
+// past the end of the binary, see BITS_RANGES().
+//
+static void Set_Bits_Sparse(
+    Binary(*) bset,
+    Codepoint lo,
+    Codepoint hi,
+    bool set
+){
+    assert(lo >= BIN_LEN(bset) * 8 and lo <= hi);
+
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (not ranges) {
+        if (not set)
+            return;
+        ranges = Make_Binary_Core(2 * sizeof(Codepoint), NODE_FLAG_MANAGED);
+        TERM_BIN_LEN(ranges, 0);
+        Init_Bits_Ranges(bset, ranges);
+    }
+
+    const Codepoint *r = BITS_RANGES_HEAD(ranges);
+    REBLEN count = BITS_RANGES_COUNT(ranges);
+
+    if (set) {  // merge with any ranges it overlaps or touches
+        REBLEN i = Find_Bits_Range(ranges, lo == 0 ? 0 : lo - 1);
+        REBLEN j = i;
+        while (j < count and r[j * 2] <= hi + 1)
+            ++j;
+
+        Codepoint pair[2];
+        pair[0] = (j > i and r[i * 2] < lo) ? r[i * 2] : lo;
+        pair[1] = (j > i and r[(j - 1) * 2 + 1] > hi) ? r[(j - 1) * 2 + 1] : hi;
+        Splice_Bits_Ranges(ranges, i, j, pair, 1);
+    }
+    else {  // cut out of any ranges it overlaps, maybe splitting one
+        REBLEN i = Find_Bits_Range(ranges, lo);
+        REBLEN j = i;
+        while (j < count and r[j * 2] <= hi)
+            ++j;
+        if (j == i)
+            return;
+
+        Codepoint pairs[4];
+        REBLEN n = 0;
+        if (r[i * 2] < lo) {
+            pairs[n++] = r[i * 2];
+            pairs[n++] = lo - 1;
+        }
+        if (r[(j - 1) * 2 + 1] > hi) {
+            pairs[n++] = hi + 1;
+            pairs[n++] = r[(j - 1) * 2 + 1];
+        }
+        Splice_Bits_Ranges(ranges, i, j, pairs, n / 2);
+    }
+}
+
+
+// Grow the binary of a bitset to `num_bytes`, moving any bits that are in
+// the ranges but now fall inside the binary into it.
+//
+static void Expand_Bitset_Dense(Binary(*) bset, REBLEN num_bytes)
+{
+    REBLEN tail = BIN_LEN(bset);
+    assert(num_bytes > tail);
+    Expand_Series(bset, tail, num_bytes - tail);
+    memset(BIN_AT(bset, tail), 0, num_bytes - tail);
+    TERM_SERIES_IF_NECESSARY(bset);
+
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (not ranges)
+        return;
+
+    Codepoint limit = num_bytes * 8;
+    const Codepoint *r = BITS_RANGES_HEAD(ranges);
+    REBLEN count = BITS_RANGES_COUNT(ranges);
+    Byte* bp = BIN_HEAD(bset);
+
+    REBLEN j;
+    for (j = 0; j < count and r[j * 2] < limit; ++j) {
+        Codepoint c = r[j * 2];
+        Codepoint hi = MIN(r[j * 2 + 1], limit - 1);
+        for (; c <= hi; ++c)
+            bp[c >> 3] |= (0x80 >> (c & 7));
+    }
+    if (j == 0)
+        return;
+
+    if (r[(j - 1) * 2 + 1] >= limit) {  // last one straddled the new limit
+        Codepoint rest[2];
+        rest[0] = limit;
+        rest[1] = r[(j - 1) * 2 + 1];
+        Splice_Bits_Ranges(ranges, 0, j, rest, 1);
+    }
+    else
+        Splice_Bits_Ranges(ranges, 0, j, nullptr, 0);
+}
+
+
+// How many bits LENGTH OF reports, bytes of the binary (or as if the ranges
+// were written out as bits) times 8.
+//
+static REBLEN Bitset_Length_Bits(Binary(const*) bset)
+{
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (ranges and BITS_RANGES_COUNT(ranges) != 0) {
+        REBLEN count = BITS_RANGES_COUNT(ranges);
+        Codepoint last = BITS_RANGES_HEAD(ranges)[count * 2 - 1];
+        return ((last >> 3) + 1) * 8;  // ranges are all past the binary
+    }
+    return BIN_LEN(bset) * 8;
+}
+
+
+//
+//  Copy_Bitset: C
+//
+// Copy of the binary and the ranges.  The copy is not negated, callers
+// decide that.
+//
+Binary(*) Copy_Bitset(Binary(const*) bset, Flags flags)
+{
+    Binary(*) copy = BIN(Copy_Series_Core(bset, flags));
+    INIT_BITS_NOT(copy, false);
+
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (ranges)
+        Init_Bits_Ranges(
+            copy,
+            BIN(Copy_Series_Core(ranges, NODE_FLAG_MANAGED))
+        );
+    return copy;
+}
+
+
+//
+//  Flatten_Bitset: C
+//
+// Unmanaged copy of a bitset as one flat binary, with the bits that are in
+// its ranges (see BITS_RANGES()) written in.  The copy is not negated.
+//
+Binary(*) Flatten_Bitset(Binary(const*) bset)
+{
+    Binary(*) flat = Make_Bitset(Bitset_Length_Bits(bset));
+    memcpy(BIN_HEAD(flat), BIN_HEAD(bset), BIN_LEN(bset));
+
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (ranges) {
+        const Codepoint *r = BITS_RANGES_HEAD(ranges);
+        REBLEN count = BITS_RANGES_COUNT(ranges);
+        Byte* bp = BIN_HEAD(flat);
+        REBLEN k;
+        for (k = 0; k < count; ++k) {
+            Codepoint c;
+            for (c = r[k * 2]; c <= r[k * 2 + 1]; ++c)
+                bp[c >> 3] |= (0x80 >> (c & 7));
+        }
+    }
+    return flat;
+}
+
+
+// The bitset itself if it has no ranges, else a flattened copy.
+//
+static Binary(const*) Flat_Bits(Binary(const*) bset)
+{
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (not ranges or BITS_RANGES_COUNT(ranges) == 0)
+        return bset;
+    return Flatten_Bitset(bset);
+}
+
+
 //
 //  CT_Bitset: C
 //
@@ -38,8 +279,8 @@ REBINT CT_Bitset(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
 {
     DECLARE_LOCAL (atemp);
     DECLARE_LOCAL (btemp);
-    Init_Binary(atemp, VAL_BITSET(a));
-    Init_Binary(btemp, VAL_BITSET(b));
+    Init_Binary(atemp, Flat_Bits(VAL_BITSET(a)));
+    Init_Binary(btemp, Flat_Bits(VAL_BITSET(b)));
 
     if (BITS_NOT(VAL_BITSET(a)) != BITS_NOT(VAL_BITSET(b)))
         return 1;
@@ -48,20 +289,6 @@ REBINT CT_Bitset(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
 }
 
 
-//
-//  Make_Bitset: C
-//
-Binary(*) Make_Bitset(REBLEN num_bits)
-{
-    REBLEN num_bytes = (num_bits + 7) / 8;
-    Binary(*) bin = Make_Binary(num_bytes);
-    Clear_Series(bin);
-    TERM_BIN_LEN(bin, num_bytes);
-    INIT_BITS_NOT(bin, false);
-    return bin;
-}
-
-
 //
 //  MF_Bitset: C
 //
@@ -77,7 +304,7 @@ void MF_Bitset(REB_MOLD *mo, noquote(Cell(const*)) v, bool form)
         Append_Ascii(mo->series, "[not bits ");
 
     DECLARE_LOCAL (binary);
-    Init_Binary(binary, s);
+    Init_Binary(binary, Flat_Bits(s));
     MF_Binary(mo, binary, false); // false = mold, don't form
 
     if (BITS_NOT(s))
@@ -104,6 +331,12 @@ Bounce MAKE_Bitset(
     if (len == NOT_FOUND)
         return RAISE(arg);
 
+    // An INTEGER! asks for a size, and a BINARY! is the raw bits.  Anything
+    // else only gets the dense part, higher bits go in ranges.
+    //
+    if (not IS_INTEGER(arg) and not IS_BINARY(arg) and len > BITSET_DENSE_MAX)
+        len = BITSET_DENSE_MAX;
+
     Binary(*) bin = Make_Bitset(cast(REBLEN, len));
     Manage_Series(bin);
     Init_Bitset(OUT, bin);
@@ -201,9 +434,8 @@ REBINT Find_Max_Bit(Cell(const*) val)
 //
 bool Check_Bit(Binary(const*) bset, REBLEN c, bool uncased)
 {
-    REBLEN i, n = c;
-    REBLEN tail = BIN_LEN(bset);
-    bool flag = false;
+    REBLEN n = c;
+    bool flag;
 
     if (uncased) {
         if (n >= UNICODE_CASES)
@@ -214,9 +446,15 @@ bool Check_Bit(Binary(const*) bset, REBLEN c, bool uncased)
 
     // Check lowercase char:
 retry:
-    i = n >> 3;
-    if (i < tail)
-        flag = did (BIN_HEAD(bset)[i] & (1 << (7 - (n & 7))));
+    if ((n >> 3) < BIN_LEN(bset))
+        flag = did (BIN_HEAD(bset)[n >> 3] & (1 << (7 - (n & 7))));
+    else {  // past the binary, so only in the ranges if anywhere
+        Binary(*) ranges = BITS_RANGES(bset);
+        REBLEN k = ranges ? Find_Bits_Range(ranges, n) : 0;
+        flag = ranges
+            and k < BITS_RANGES_COUNT(ranges)
+            and BITS_RANGES_HEAD(ranges)[k * 2] <= n;
+    }
 
     // Check uppercase if needed:
     if (uncased && !flag) {
@@ -232,6 +470,60 @@ retry:
 }
 
 
+inline static bool Raw_Bit(const Byte* bits, REBLEN size, Byte b) {
+    return (b >> 3) < size and (bits[b >> 3] & (0x80 >> (b & 7)));
+}
+
+//
+//  Span_Bitset: C
+//
+// Count how many of the `limit` units (bytes, or codepoints if `is_str`) at
+// `cp` are in the bitset--or aren't, if `in_set` is false--stopping at the
+// first one that isn't (or is).  This gives the same answers as calling
+// Check_Bit() on each unit.  But ASCII bytes are tested directly against the
+// bits of the set, which skips the case mapping tables and UTF-8 decoding.
+//
+// (Only the uppercase and lowercase of an ASCII letter are checked by
+// Check_Bit(), and those are the letter with and without the 0x20 bit.)
+//
+REBLEN Span_Bitset(
+    const Byte* cp,
+    REBLEN limit,
+    bool is_str,
+    Binary(const*) bset,
+    bool uncased,
+    bool in_set
+){
+    const Byte* bits = BIN_HEAD(bset);
+    REBLEN size = BIN_LEN(bset);
+    bool want = BITS_NOT(bset) ? not in_set : in_set;  // raw bit to span
+
+    REBLEN n;
+    for (n = 0; n < limit; ++n) {
+        Byte b = *cp;
+        if (b >= 0x80) {
+            Codepoint c;
+            if (is_str)
+                cp = Back_Scan_UTF8_Char_Unchecked(&c, cp);
+            else
+                c = b;
+            ++cp;
+            if (Check_Bit(bset, c, uncased) != in_set)
+                break;
+            continue;
+        }
+
+        bool hit = Raw_Bit(bits, size, b);
+        if (not hit and uncased and (b | 0x20) >= 'a' and (b | 0x20) <= 'z')
+            hit = Raw_Bit(bits, size, cast(Byte, b ^ 0x20));
+        if (hit != want)
+            break;
+        ++cp;
+    }
+    return n;
+}
+
+
 //
 //  Set_Bit: C
 //
@@ -243,12 +535,14 @@ void Set_Bit(Binary(*) bset, REBLEN n, bool set)
     REBLEN tail = BIN_LEN(bset);
     Byte bit;
 
-    // Expand if not enough room:
+    // Expand if not enough room, or use the ranges if it's a high bit:
     if (i >= tail) {
+        if (n >= BITSET_DENSE_MAX) {
+            Set_Bits_Sparse(bset, n, n, set);
+            return;
+        }
         if (!set) return; // no need to expand
-        Expand_Series(bset, tail, (i - tail) + 1);
-        memset(BIN_AT(bset, tail), 0, (i - tail) + 1);
-        TERM_SERIES_IF_NECESSARY(bset);
+        Expand_Bitset_Dense(bset, i + 1);
     }
 
     bit = 1 << (7 - ((n) & 7));
@@ -259,6 +553,25 @@ void Set_Bit(Binary(*) bset, REBLEN n, bool set)
 }
 
 
+//
+//  Set_Bit_Range: C
+//
+// Set/clear the bits from lo to hi inclusive.  The part of the span that
+// would be past the dense bits is done as one range, not bit by bit.
+//
+void Set_Bit_Range(Binary(*) bset, REBLEN lo, REBLEN hi, bool set)
+{
+    REBLEN split = MAX(BIN_LEN(bset) * 8, BITSET_DENSE_MAX);
+
+    REBLEN n;
+    for (n = lo; n <= hi and n < split; ++n)
+        Set_Bit(bset, n, set);
+
+    if (hi >= split)
+        Set_Bits_Sparse(bset, MAX(lo, split), hi, set);
+}
+
+
 //
 //  Set_Bits: C
 //
@@ -332,9 +645,7 @@ bool Set_Bits(Binary(*) bset, Cell(const*) val, bool set)
                     REBLEN n = VAL_CHAR(item);
                     if (n < c)
                         fail (Error_Index_Out_Of_Range_Raw());
-                    do {
-                        Set_Bit(bset, c, set);
-                    } while (c++ < n); // post-increment: test before overflow
+                    Set_Bit_Range(bset, c, n, set);
                 }
                 else
                     fail (Error_Bad_Value(item));
@@ -358,8 +669,7 @@ bool Set_Bits(Binary(*) bset, Cell(const*) val, bool set)
                     n = Int32s(SPECIFIC(item), 0);
                     if (n < c)
                         fail (Error_Index_Out_Of_Range_Raw());
-                    for (; c <= n; c++)
-                        Set_Bit(bset, c, set);
+                    Set_Bit_Range(bset, c, n, set);
                 }
                 else
                     fail (Error_Bad_Value(item));
@@ -388,11 +698,8 @@ bool Set_Bits(Binary(*) bset, Cell(const*) val, bool set)
             Size n;
             const Byte* at = VAL_BINARY_SIZE_AT(&n, item);
 
-            Codepoint c = BIN_LEN(bset);
-            if (n >= c) {
-                Expand_Series(bset, c, (n - c));
-                memset(BIN_AT(bset, c), 0, (n - c));
-            }
+            if (n > BIN_LEN(bset))
+                Expand_Bitset_Dense(bset, n);
             memcpy(BIN_HEAD(bset), at, n);
             break; }
 
@@ -544,6 +851,113 @@ void Trim_Tail_Zeros(Binary(*) ser)
 }
 
 
+inline static Byte Combine_Bits(option(SymId) sym, Byte a, Byte b) {
+    switch (sym) {
+      case SYM_INTERSECT:
+        return a & b;
+      case SYM_UNION:
+        return a | b;
+      case SYM_DIFFERENCE:
+        return a ^ b;
+      case SYM_EXCLUDE:
+        return a & ~b;
+      default:
+        panic (nullptr);
+    }
+}
+
+// Whether `pos` is in the ranges, and where that next changes (UINT32_MAX if
+// it never does).  `k` is a cursor, moved past ranges ending before `pos`.
+//
+static bool Bits_Range_State(
+    Codepoint *next,
+    Binary(const*) ranges,
+    REBLEN *k,
+    Codepoint pos
+){
+    REBLEN count = ranges ? BITS_RANGES_COUNT(ranges) : 0;
+    if (count == 0) {
+        *next = UINT32_MAX;
+        return false;
+    }
+    const Codepoint *r = BITS_RANGES_HEAD(ranges);
+    while (*k < count and r[*k * 2 + 1] < pos)
+        ++(*k);
+    if (*k == count) {
+        *next = UINT32_MAX;
+        return false;
+    }
+    if (r[*k * 2] <= pos) {
+        *next = r[*k * 2 + 1] + 1;
+        return true;
+    }
+    *next = r[*k * 2];
+    return false;
+}
+
+// Byte `i` of the flat bits, which may be past the binary and in the ranges.
+//
+static Byte Bitset_Byte(Binary(const*) bset, REBLEN i)
+{
+    if (i < BIN_LEN(bset))
+        return BIN_HEAD(bset)[i];
+
+    Binary(*) ranges = BITS_RANGES(bset);
+    if (not ranges)
+        return 0;
+
+    Byte b = 0;
+    REBLEN n;
+    for (n = 0; n < 8; ++n)
+        if (Check_Bit(bset, i * 8 + n, false) != BITS_NOT(bset))
+            b |= (0x80 >> n);
+    return b;
+}
+
+//
+//  Combine_Bitsets: C
+//
+// INTERSECT, UNION, DIFFERENCE or EXCLUDE of two bitsets, ignoring negation.
+// The binaries are combined bytewise, and the ranges past them by walking
+// both lists of ranges together, so a big range is handled in one step.
+// Result is unmanaged.
+//
+Binary(*) Combine_Bitsets(
+    Binary(const*) a,
+    Binary(const*) b,
+    option(SymId) sym
+){
+    REBLEN len = MAX(BIN_LEN(a), BIN_LEN(b));
+    Binary(*) out = Make_Bitset(len * 8);
+
+    Byte* bp = BIN_HEAD(out);
+    REBLEN i;
+    for (i = 0; i < len; ++i)
+        bp[i] = Combine_Bits(sym, Bitset_Byte(a, i), Bitset_Byte(b, i));
+
+    Binary(const*) ranges_a = BITS_RANGES(a);
+    Binary(const*) ranges_b = BITS_RANGES(b);
+    REBLEN ka = 0;
+    REBLEN kb = 0;
+    Codepoint pos = len * 8;  // membership only changes at ends of ranges
+    while (true) {
+        Codepoint next_a;
+        Codepoint next_b;
+        bool in_a = Bits_Range_State(&next_a, ranges_a, &ka, pos);
+        bool in_b = Bits_Range_State(&next_b, ranges_b, &kb, pos);
+        if (next_a == UINT32_MAX and next_b == UINT32_MAX)
+            break;  // neither has bits from here on
+
+        Codepoint next = MIN(next_a, next_b);
+        if (Combine_Bits(sym, cast(Byte, in_a), cast(Byte, in_b)) & 1)
+            Set_Bits_Sparse(out, pos, next - 1, true);
+        pos = next;
+    }
+
+    return out;
+}
+
+
 //
 //  REBTYPE: C
 //
@@ -593,11 +1007,11 @@ REBTYPE(Bitset)
         option(SymId) property = VAL_WORD_ID(ARG(property));
         switch (property) {
           case SYM_LENGTH:
-            return Init_Integer(v, BIN_LEN(VAL_BITSET(v)) * 8);
+            return Init_Integer(v, Bitset_Length_Bits(VAL_BITSET(v)));
 
           case SYM_TAIL_Q:
             // Necessary to make EMPTY? work:
-            return Init_Logic(OUT, BIN_LEN(VAL_BITSET(v)) == 0);
+            return Init_Logic(OUT, Bitset_Length_Bits(VAL_BITSET(v)) == 0);
 
           default:
             break;
@@ -623,7 +1037,7 @@ REBTYPE(Bitset)
         return Init_True(OUT); }
 
       case SYM_COMPLEMENT: {
-        Binary(*) copy = BIN(Copy_Series_Core(VAL_BITSET(v), NODE_FLAG_MANAGED));
+        Binary(*) copy = Copy_Bitset(VAL_BITSET(v), NODE_FLAG_MANAGED);
         INIT_BITS_NOT(copy, not BITS_NOT(VAL_BITSET(v)));
         return Init_Bitset(OUT, copy); }
 
@@ -669,13 +1083,14 @@ REBTYPE(Bitset)
         if (REF(part) or REF(deep))
             fail (Error_Bad_Refines_Raw());
 
-        Binary(*) copy = BIN(Copy_Series_Core(VAL_BITSET(v), NODE_FLAG_MANAGED));
+        Binary(*) copy = Copy_Bitset(VAL_BITSET(v), NODE_FLAG_MANAGED);
         INIT_BITS_NOT(copy, BITS_NOT(VAL_BITSET(v)));
         return Init_Bitset(OUT, copy); }
 
       case SYM_CLEAR: {
         Binary(*) bin = VAL_BITSET_ENSURE_MUTABLE(v);
         INIT_BITS_NOT(bin, false);
+        Init_Bits_Ranges(bin, nullptr);
         Clear_Series(bin);
         return COPY(v); }
 
@@ -684,14 +1099,23 @@ REBTYPE(Bitset)
       case SYM_DIFFERENCE:
       case SYM_EXCLUDE: {
         REBVAL *arg = D_ARG(2);
+
+        Binary(const*) arg_bits;
+        Binary(*) temp = nullptr;
         if (IS_BITSET(arg)) {
             if (BITS_NOT(VAL_BITSET(arg))) {  // !!! see #2365
                 fail ("Bitset negation not handled by set operations");
             }
-            Binary(const*) bin = VAL_BITSET(arg);
-            Init_Binary(arg, bin);
+            arg_bits = VAL_BITSET(arg);
+        }
+        else if (IS_BINARY(arg)) {  // raw bits
+            Size size;
+            const Byte* at = VAL_BINARY_SIZE_AT(&size, arg);
+            temp = Make_Bitset(size * 8);
+            memcpy(BIN_HEAD(temp), at, size);
+            arg_bits = temp;
         }
-        else if (not IS_BINARY(arg))
+        else
             fail (Error_Math_Args(VAL_TYPE(arg), verb));
 
         bool negated_result = false;
@@ -710,42 +1134,13 @@ REBTYPE(Bitset)
                 fail ("Bitset negation not handled by (most) set operations");
         }
 
-        Binary(const*) bin = VAL_BITSET(v);
-        Init_Binary(v, bin);
-
-        // !!! Until the replacement implementation with Roaring Bitmaps, the
-        // bitset is based on a BINARY!.  Reuse the code on the generated
-        // proxy values.
-        //
-        REBVAL *action;
-        switch (sym) {
-          case SYM_INTERSECT:
-            action = rebValue("unrun :bitwise-and");
-            break;
-
-          case SYM_UNION:
-            action = rebValue("unrun :bitwise-or");
-            break;
-
-          case SYM_DIFFERENCE:
-            action = rebValue("unrun :bitwise-xor");
-            break;
-
-          case SYM_EXCLUDE:
-            action = rebValue("unrun :bitwise-and-not");
-            break;
-
-          default:
-            panic (nullptr);
-        }
-
-        REBVAL *processed = rebValue(rebR(action), rebQ(v), rebQ(arg));
-
-        Binary(*) bits = VAL_BINARY_KNOWN_MUTABLE(processed);
-        rebRelease(processed);
+        Binary(*) bits = Combine_Bitsets(VAL_BITSET(v), arg_bits, sym);
+        if (temp)
+            Free_Unmanaged_Series(temp);
 
         INIT_BITS_NOT(bits, negated_result);
         Trim_Tail_Zeros(bits);
+        Manage_Series(bits);
         return Init_Bitset(OUT, bits); }
 
       default:
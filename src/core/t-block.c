@@ -512,6 +512,10 @@ REBINT Find_In_Array(
 }
 
 
+// Below this many items, starting threads costs more than it saves.
+//
+#define PARALLEL_SORT_MIN_LEN 100000
+
 struct sort_flags {
     bool cased;
     bool reverse;
@@ -587,6 +591,118 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 }
 
 
+//
+//  Is_Parallel_Sortable: C
+//
+// reb_parallel_sort_r() calls the comparison from several threads, so this
+// only allows values whose Cmp_Value() neither allocates nor touches any
+// shared state.  INTEGER! and DECIMAL! qualify.  (Strings don't, because
+// getting at their data can update or allocate their bookmark caches.)
+//
+static bool Is_Parallel_Sortable(Cell(const*) at, REBLEN len)
+{
+    enum Reb_Kind kind = VAL_TYPE(at);
+    if (kind != REB_INTEGER and kind != REB_DECIMAL)
+        return false;
+
+    Cell(const*) tail = at + len;
+    for (; at != tail; ++at) {
+        if (VAL_TYPE(at) != kind)
+            return false;
+    }
+    return true;
+}
+
+
+//
+//  Sort_Array_By_Key: C
+//
+// SORT/KEY calls the key function once per record (with the record's first
+// value), then sorts by the results with the native Compare_Val().  This is
+// the "decorate-sort-undecorate" idiom: a /COMPARE function gets called
+// through the evaluator O(n log n) times, which is far slower.
+//
+// The keys are gathered on the data stack, since the key function can run
+// the GC.  Once they are all in hand nothing else will be evaluated, so they
+// are put into an unmanaged array with each key followed by a copy of its
+// record, and that array is sorted by its first field.  The sort is stable,
+// as sorting by a key is generally expected to be.
+//
+static void Sort_Array_By_Key(
+    Array(*) arr,
+    REBLEN index,
+    REBLEN num_records,
+    REBLEN skip,
+    const REBVAL *key,
+    struct sort_flags *flags
+){
+    StackIndex base = TOP_INDEX;
+
+    DECLARE_LOCAL (result);
+
+    REBLEN n;
+    for (n = 0; n < num_records; ++n) {
+        if (rebRunThrows(
+            result,  // <-- output cell
+            key, ARR_AT(arr, index + n * skip)
+        )){
+            fail (Error_No_Catch_For_Throw(TOP_FRAME));
+        }
+        if (Is_Nulled(result))
+            fail ("SORT/KEY function returned NULL");
+        if (Is_Isotope(result))
+            fail (Error_Bad_Isotope(result));
+        Copy_Cell(PUSH(), result);
+    }
+
+    // The key function could have modified the array being sorted.
+    //
+    if (index + num_records * skip > ARR_LEN(arr))
+        fail ("SORT/KEY function changed the length of the series");
+
+    REBLEN width = skip + 1;
+    Array(*) decorated = Make_Array_Core(
+        num_records * width,
+        SERIES_FLAGS_NONE
+    );
+    for (n = 0; n < num_records; ++n) {
+        Cell(*) dest = ARR_AT(decorated, n * width);
+        Copy_Cell(dest, Data_Stack_At(base + 1 + n));
+
+        // Rare case where Cell bit copying is okay, as the cells are put
+        // right back where they came from.
+        //
+        memcpy(
+            cast(void*, dest + 1),
+            cast(void*, ARR_AT(arr, index + n * skip)),
+            sizeof(REBVAL) * skip
+        );
+    }
+    SET_SERIES_LEN(decorated, num_records * width);
+    Drop_Data_Stack_To(base);
+
+    REBLEN offset = flags->offset;
+    flags->offset = 0;  // compare by the key field
+    reb_stable_sort_r(
+        ARR_HEAD(decorated),
+        num_records,
+        sizeof(REBVAL) * width,
+        flags,
+        &Compare_Val
+    );
+    flags->offset = offset;
+
+    for (n = 0; n < num_records; ++n)
+        memcpy(
+            cast(void*, ARR_AT(arr, index + n * skip)),
+            cast(void*, ARR_AT(decorated, n * width) + 1),
+            sizeof(REBVAL) * skip
+        );
+
+    Free_Unmanaged_Series(decorated);
+}
+
+
 //
 //  Shuffle_Array: C
 //
@@ -803,68 +919,99 @@ void MF_Array(REB_MOLD *mo, noquote(Cell(const*)) v, bool form)
 
 
 //
-//  REBTYPE: C
+//  Array_Pick_P: C
 //
-// Implementation of type dispatch for ANY-ARRAY! (ANY-BLOCK! and ANY-GROUP!)
+// PICK* for ANY-ARRAY! (see %sys-pick.h for explanation).  This is called
+// directly by Run_Generic_Dispatch(), without going through REBTYPE(Array),
+// because it is listed in %verb-hooks.r.
 //
-REBTYPE(Array)
+Bounce Array_Pick_P(Frame(*) frame_, Symbol(const*) verb)
 {
+    INCLUDE_PARAMS_OF_PICK_P;
+    UNUSED(verb);
+    UNUSED(ARG(location));
+
     REBVAL *array = D_ARG(1);
 
-    REBSPC *specifier = VAL_SPECIFIER(array);
+    Cell(const*) picker = ARG(picker);
+    REBINT n = Try_Get_Array_Index_From_Picker(array, picker);
+    if (n < 0 or n >= cast(REBINT, VAL_LEN_HEAD(array)))
+        return nullptr;
 
-    option(SymId) id = ID_OF_SYMBOL(verb);
+    Cell(const*) at = ARR_AT(VAL_ARRAY(array), n);
 
-    switch (id) {
+    Derelativize(OUT, at, VAL_SPECIFIER(array));
+    Inherit_Const(OUT, array);
+    return OUT;
+}
 
-    //=//// PICK* (see %sys-pick.h for explanation) ////////////////////////=//
 
-      case SYM_PICK_P: {
-        INCLUDE_PARAMS_OF_PICK_P;
-        UNUSED(ARG(location));
+//
+//  Array_Poke_P: C
+//
+// POKE* for ANY-ARRAY! (see %sys-pick.h for explanation).  Also called
+// directly, see Array_Pick_P().
+//
+Bounce Array_Poke_P(Frame(*) frame_, Symbol(const*) verb)
+{
+    INCLUDE_PARAMS_OF_POKE_P;
+    UNUSED(verb);
+    UNUSED(ARG(location));
 
-        Cell(const*) picker = ARG(picker);
-        REBINT n = Try_Get_Array_Index_From_Picker(array, picker);
-        if (n < 0 or n >= cast(REBINT, VAL_LEN_HEAD(array)))
-            return nullptr;
+    REBVAL *array = D_ARG(1);
 
-        Cell(const*) at = ARR_AT(VAL_ARRAY(array), n);
+    Cell(const*) picker = ARG(picker);
 
-        Derelativize(OUT, at, VAL_SPECIFIER(array));
-        Inherit_Const(OUT, array);
-        return OUT; }
+    REBVAL *setval = ARG(value);
 
+    if (Is_Isotope(setval))
+        fail (Error_Bad_Isotope(setval));  // can't put in blocks
 
-    //=//// POKE* (see %sys-pick.h for explanation) ////////////////////////=//
+    if (Is_Nulled(setval))
+        fail (Error_Need_Non_Null_Raw());  // also can't put in blocks
 
-      case SYM_POKE_P: {
-        INCLUDE_PARAMS_OF_POKE_P;
-        UNUSED(ARG(location));
+    // !!! If we are jumping here from getting updated bits, then
+    // if the block isn't immutable or locked from modification, the
+    // memory may have moved!  There's no way to guarantee semantics
+    // of an update if we don't lock the array for the poke duration.
+    //
+    REBINT n = Try_Get_Array_Index_From_Picker(array, picker);
+    if (n < 0 or n >= cast(REBINT, VAL_LEN_HEAD(array)))
+        fail (Error_Out_Of_Range(picker));
 
-        Cell(const*) picker = ARG(picker);
+    Array(*) mut_arr = VAL_ARRAY_ENSURE_MUTABLE(array);
+    Cell(*) at = ARR_AT(mut_arr, n);
+    Copy_Cell(at, setval);
 
-        REBVAL *setval = ARG(value);
+    return nullptr;  // Array(*) is still fine, caller need not update
+}
 
-        if (Is_Isotope(setval))
-            fail (Error_Bad_Isotope(setval));  // can't put in blocks
 
-        if (Is_Nulled(setval))
-            fail (Error_Need_Non_Null_Raw());  // also can't put in blocks
+//
+//  REBTYPE: C
+//
+// Implementation of type dispatch for ANY-ARRAY! (ANY-BLOCK! and ANY-GROUP!)
+//
+REBTYPE(Array)
+{
+    REBVAL *array = D_ARG(1);
 
-        // !!! If we are jumping here from getting updated bits, then
-        // if the block isn't immutable or locked from modification, the
-        // memory may have moved!  There's no way to guarantee semantics
-        // of an update if we don't lock the array for the poke duration.
-        //
-        REBINT n = Try_Get_Array_Index_From_Picker(array, picker);
-        if (n < 0 or n >= cast(REBINT, VAL_LEN_HEAD(array)))
-            fail (Error_Out_Of_Range(picker));
+    REBSPC *specifier = VAL_SPECIFIER(array);
+
+    option(SymId) id = ID_OF_SYMBOL(verb);
 
-        Array(*) mut_arr = VAL_ARRAY_ENSURE_MUTABLE(array);
-        Cell(*) at = ARR_AT(mut_arr, n);
-        Copy_Cell(at, setval);
+    switch (id) {
+
+    //=//// PICK* (see %sys-pick.h for explanation) ////////////////////////=//
 
-        return nullptr; }  // Array(*) is still fine, caller need not update
+      case SYM_PICK_P:
+        return Array_Pick_P(frame_, verb);
+
+
+    //=//// POKE* (see %sys-pick.h for explanation) ////////////////////////=//
+
+      case SYM_POKE_P:
+        return Array_Poke_P(frame_, verb);
 
 
       case SYM_UNIQUE:
@@ -1082,14 +1229,15 @@ REBTYPE(Array)
         //
         flags |= (array->header.bits & ARRAY_FLAG_CONST_SHALLOW);
 
-        Array(*) copy = Copy_Array_Core_Managed(
+        Array(*) copy = Copy_Array_Shared_Managed(
             arr,
             index, // at
             specifier,
             tail, // tail
             0, // extra
             flags, // flags
-            types // types to copy deeply
+            types, // types to copy deeply
+            REF(shared)  // copy series reached more than once only once
         );
 
         return Init_Array_Cell(OUT, VAL_TYPE(array), copy); }
@@ -1241,7 +1389,38 @@ REBTYPE(Array)
                 fail (Error_Out_Of_Range(ARG(skip)));
         }
 
-        reb_qsort_r(
+        if (REF(key)) {
+            if (not Is_Nulled(ARG(compare)))
+                fail (Error_Bad_Refines_Raw());
+
+            REBVAL *key = ARG(key);
+            Deactivate_If_Activation(key);
+            Sort_Array_By_Key(arr, index, len / skip, skip, key, &flags);
+            return OUT;
+        }
+
+        if (
+            REBOL_PARALLEL_SORT
+            and len >= PARALLEL_SORT_MIN_LEN
+            and skip == 1
+            and not REF(stable)
+            and flags.comparator == nullptr
+            and Is_Parallel_Sortable(ARR_AT(arr, index), len)
+        ){
+            reb_parallel_sort_r(
+                ARR_AT(arr, index),
+                len,
+                sizeof(REBVAL),
+                &flags,
+                &Compare_Val
+            );
+            return OUT;
+        }
+
+        // Records sorted by a key field are expected to keep their order for
+        // equal keys, so /SKIP implies /STABLE.
+        //
+        (REF(stable) or skip > 1 ? &reb_stable_sort_r : &reb_qsort_r)(
             ARR_AT(arr, index),
             len / skip,
             sizeof(REBVAL) * skip,
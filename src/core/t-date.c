@@ -1229,6 +1229,104 @@ DECLARE_NATIVE(make_date_ymdsnz)
 }
 
 
+// "00" to "99", so formatting a two digit field is a two byte copy.
+//
+static const char Digit_Pairs[] =
+    "00010203040506070809" "10111213141516171819"
+    "20212223242526272829" "30313233343536373839"
+    "40414243444546474849" "50515253545556575859"
+    "60616263646566676869" "70717273747576777879"
+    "80818283848586878889" "90919293949596979899";
+
+inline static Byte* Form_Digit_Pair(Byte* bp, REBLEN n) {
+    assert(n < 100);
+    memcpy(bp, &Digit_Pairs[n * 2], 2);
+    return bp + 2;
+}
+
+
+//
+//  iso-8601: native [
+//
+//  {Format a date as ISO-8601 text, e.g. 2023-06-01T12:34:56.789+05:30}
+//
+//      return: [text!]
+//      date [date!]
+//  ]
+//
+DECLARE_NATIVE(iso_8601)
+//
+// This is the fixed width form that Scan_Date() has a fast path for, so the
+// result will LOAD (or TO DATE!) back to an equal date.  A date with no time
+// is just `YYYY-MM-DD`, no zone is a local time (no suffix), and a zone of
+// zero is written as `Z`.  The fraction is only written when nonzero, with
+// trailing zeros trimmed.
+{
+    INCLUDE_PARAMS_OF_ISO_8601;
+
+    REBVAL *v = ARG(date);
+
+    int zone = Does_Date_Have_Zone(v) ? VAL_ZONE(v) : NO_DATE_ZONE;  // capture
+    Fold_Zone_Into_Date(v);  // we own the argument cell, can modify it
+
+    REBLEN year = VAL_YEAR(v);
+    if (year > 9999)
+        fail (Error_Out_Of_Range(ARG(date)));
+
+    Byte buf[48];  // "YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+hh:mm" is 35 bytes
+    Byte* bp = &buf[0];
+
+    bp = Form_Digit_Pair(bp, year / 100);
+    bp = Form_Digit_Pair(bp, year % 100);
+    *bp++ = '-';
+    bp = Form_Digit_Pair(bp, VAL_MONTH(v));
+    *bp++ = '-';
+    bp = Form_Digit_Pair(bp, VAL_DAY(v));
+
+    if (Does_Date_Have_Time(v)) {
+        REB_TIMEF tf;
+        Split_Time(VAL_NANO(v), &tf);
+
+        *bp++ = 'T';
+        bp = Form_Digit_Pair(bp, tf.h);
+        *bp++ = ':';
+        bp = Form_Digit_Pair(bp, tf.m);
+        *bp++ = ':';
+        bp = Form_Digit_Pair(bp, tf.s);
+
+        if (tf.n != 0) {
+            *bp++ = '.';
+            REBLEN n = tf.n;
+            int digits = 9;
+            for (; n % 10 == 0; n /= 10)
+                --digits;
+            int i;
+            for (i = digits - 1; i >= 0; --i, n /= 10)
+                bp[i] = '0' + n % 10;
+            bp += digits;
+        }
+
+        if (zone == 0)
+            *bp++ = 'Z';
+        else if (zone != NO_DATE_ZONE) {
+            if (zone < 0) {
+                *bp++ = '-';
+                zone = -zone;
+            }
+            else
+                *bp++ = '+';
+            bp = Form_Digit_Pair(bp, zone / 4);
+            *bp++ = ':';
+            bp = Form_Digit_Pair(bp, (zone & 3) * 15);
+        }
+    }
+
+    String(*) s = Make_String(bp - buf);
+    Append_Ascii_Len(s, s_cast(buf), bp - buf);
+    return Init_Text(OUT, s);
+}
+
+
 //
 //  make-time-sn: native [
 //
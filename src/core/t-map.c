@@ -41,17 +41,60 @@ REBINT CT_Map(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
 }
 
 
+// A map's hashlist is rebuilt when its load passes 1/4, or if more than half
+// of the records it indexes are zombies.  Once the map is managed that is
+// done incrementally: a new table is made and each Find_Map_Entry() moves
+// this many slots of the old one into it.
+//
+// The new table is sized so its load starts at no more than 1/6.  Since the
+// old table is finished in (old slots / MAP_MIGRATE_SLOTS) operations, and
+// the new one is never smaller, inserts during the migration can't take it
+// past the load where another rebuild would be wanted.
+//
+#define MAP_MIGRATE_SLOTS 16
+#define MAP_MIN_COMPACT_ZOMBIES 8
+
+// Maps with no more than this many records have no hashlist, and are just
+// searched linearly.  Comparing a few keys costs about the same as hashing
+// one, and most maps made from small JSON-like payloads never get bigger.
+//
+#define MAP_MAX_LINEAR 8
+
+
+// Map hashlists can link to an old table that is still being migrated, and
+// the GC has to keep that table alive until it is done.
+//
+static REBSER *Make_Map_Hashlist(REBLEN num_slots)
+{
+    REBSER *hashlist = Make_Series_Core(
+        HASHLIST_HEADER_LEN + num_slots * 2,
+        FLAG_FLAVOR(HASHLIST) | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    );
+    Clear_Series(hashlist);
+    SET_SERIES_LEN(hashlist, HASHLIST_HEADER_LEN + num_slots * 2);
+    mutable_LINK(Unmigrated, hashlist) = nullptr;
+
+    return hashlist;
+}
+
+
 //
 //  Make_Map: C
 //
 // Makes a MAP block (that holds both keys and values).
 // Capacity is measured in key-value pairings.
-// A hash series is also created.
+// A hash series is also created, unless the capacity is small enough that
+// the map will start out being searched linearly.
 //
 REBMAP *Make_Map(REBLEN capacity)
 {
     Array(*) pairlist = Make_Array_Core(capacity * 2, SERIES_MASK_PAIRLIST);
-    mutable_LINK(Hashlist, pairlist) = Make_Hash_Series(capacity);
+    if (capacity <= MAP_MAX_LINEAR)
+        mutable_LINK(Hashlist, pairlist) = nullptr;
+    else
+        mutable_LINK(Hashlist, pairlist) = Make_Map_Hashlist(
+            Get_Hash_Prime_May_Fail(capacity * 2)  // best when 2X # of keys
+        );
 
     return MAP(pairlist);
 }
@@ -100,8 +143,12 @@ REBINT Find_Key_Hashed(
     // adding skip (and subtracting len when needed) all positions are
     // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
     //
-    REBLEN used = SER_USED(hashlist);
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
+    // Each slot also caches the hash of the key it indexes.  Since keys that
+    // are equal (even case-insensitively) have equal hashes, a slot whose
+    // stored hash differs can't match, and needs no Cmp_Value().
+    //
+    REBLEN used = Hashlist_Num_Slots(hashlist);
+    REBLEN *indexes = Hashlist_Slots(hashlist);
 
     uint32_t hash = Hash_Value(key);
     REBLEN slot = hash % used;  // first slot to try for this hash
@@ -120,8 +167,11 @@ REBINT Find_Key_Hashed(
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
     REBLEN n;
-    while ((n = indexes[slot]) != 0) {
+    while ((n = HASHLIST_INDEX(indexes, slot)) != 0) {
         Cell(*) k = ARR_AT(array, (n - 1) * wide); // stored key
+        if (HASHLIST_HASH(indexes, slot) != hash)
+            goto next_slot;  // can't be equal, strictly or not
+
         if (0 == Cmp_Value(k, key, true)) {
             if (strict)
                 return slot; // don't need to check synonyms, stop looking
@@ -139,6 +189,8 @@ REBINT Find_Key_Hashed(
             }
         }
 
+      next_slot:
+
         if (wide > 1 && Is_Void(k + 1) && zombie_slot == -1)
             zombie_slot = slot;
 
@@ -152,19 +204,26 @@ REBINT Find_Key_Hashed(
         return synonym_slot; // there weren't other spellings of the same key
     }
 
+    if (mode > 0)
+        zombie_slot = -1;  // only a plain search reuses zombies
+
     if (zombie_slot != -1) { // zombie encountered; overwrite with new key
-        assert(mode == 0);
         slot = zombie_slot;
         Derelativize(
-            ARR_AT(array, (indexes[slot] - 1) * wide),
+            ARR_AT(array, (HASHLIST_INDEX(indexes, slot) - 1) * wide),
             key,
             specifier
         );
     }
 
+    // The slot will hold this key if the caller fills in its index (or it is
+    // a reused zombie), so it gets this key's hash.  Harmless if unused.
+    //
+    HASHLIST_HASH(indexes, slot) = hash;
+
     if (mode > 1) { // append new value to the target series
         Cell(const*) src = key;
-        indexes[slot] = (ARR_LEN(array) / wide) + 1;
+        HASHLIST_INDEX(indexes, slot) = (ARR_LEN(array) / wide) + 1;
 
         REBLEN index;
         for (index = 0; index < wide; ++src, ++index)
@@ -175,26 +234,107 @@ REBINT Find_Key_Hashed(
 }
 
 
+// Keys in a map are unique, so no comparisons are needed to find a slot for
+// one in a fresh table...just probe for an empty slot.
+//
+static void Index_Map_Record(REBSER *hashlist, REBLEN n, REBLEN hash)
+{
+    REBLEN *indexes = Hashlist_Slots(hashlist);
+    REBLEN num_slots = Hashlist_Num_Slots(hashlist);
+
+    REBLEN slot = hash % num_slots;
+    REBLEN skip = hash % (num_slots - 1) + 1;
+    while (HASHLIST_INDEX(indexes, slot) != 0) {
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
+    }
+    HASHLIST_INDEX(indexes, slot) = n;
+    HASHLIST_HASH(indexes, slot) = hash;
+}
+
+
+//
+//  Expand_Hash: C
+//
+// Expand hash series. Clear it (including its header) but set its tail.
+//
+void Expand_Hash(REBSER *ser)
+{
+    assert(not IS_SER_ARRAY(ser));
+
+    REBINT prime = Get_Hash_Prime_May_Fail(Hashlist_Num_Slots(ser) + 1);
+    Remake_Series(
+        ser,
+        HASHLIST_HEADER_LEN + prime * 2,
+        SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
+    );
+
+    Clear_Series(ser);
+    SET_SERIES_LEN(ser, HASHLIST_HEADER_LEN + prime * 2);
+}
+
+
 //
 //  Rehash_Map: C
 //
-// Recompute the entire hash table for a map. Table must be large enough.
+// Expand the hash table for a map and reindex its keys, dropping "zombie"
+// records (those whose value is void) and holes along the way.  The hashes
+// cached in the old table are reused, so no keys are hashed again.
+//
+// This does all the work at once, and moves records around in the pairlist.
+// It's used on maps that are still being built, see Find_Map_Entry().
 //
 static void Rehash_Map(REBMAP *map)
 {
     REBSER *hashlist = MAP_HASHLIST(map);
+    Array(*) pairlist = MAP_PAIRLIST(map);
 
-    if (!hashlist) return;
+    if (not hashlist)
+        return;  // small map, searched linearly
 
-    REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
-    Array(*) pairlist = MAP_PAIRLIST(map);
+    assert(not LINK(Unmigrated, hashlist));
 
-    REBVAL *key = SPECIFIC(ARR_HEAD(pairlist));
-    REBLEN n;
+    // Every record in a map's pairlist with a value is indexed by some slot.
+    // Collect the cached hashes by record before the expansion clears the
+    // table.  (Holes aren't indexed, but they are dropped without needing
+    // their hashes.)
+    //
+    REBLEN num_records = ARR_LEN(pairlist) / 2;
+    REBSER *record_hashes = Make_Series_Core(
+        num_records + 1,  // +1 so there's an allocation for an empty map
+        FLAG_FLAVOR(HASHLIST)
+    );
+    REBLEN *by_record = SER_HEAD(REBLEN, record_hashes);
+
+    REBLEN *indexes = Hashlist_Slots(hashlist);
+    REBLEN num_slots = Hashlist_Num_Slots(hashlist);
+    REBLEN slot;
+    for (slot = 0; slot < num_slots; ++slot) {
+        REBLEN n = HASHLIST_INDEX(indexes, slot);
+        if (n != 0)
+            by_record[n - 1] = HASHLIST_HASH(indexes, slot);
+    }
 
-    for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
-        const bool cased = true; // cased=true is always fine
+    Expand_Hash(hashlist);  // modifies size value, zeroes zombie/hole counts
 
+    REBLEN n = 0;
+    while (true) {
+        //
+        // Discard zombies at end of pairlist, so the last record (if it is
+        // not the one at n) is one that can be moved to fill a zombie.
+        //
+        while (
+            ARR_LEN(pairlist) > n
+            and Is_Void(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
+        ){
+            SET_SERIES_LEN(pairlist, ARR_LEN(pairlist) - 2);
+        }
+
+        if (n == ARR_LEN(pairlist))
+            break;
+
+        REBVAL *key = SPECIFIC(ARR_AT(pairlist, n));
         if (Is_Void(key + 1)) {
             //
             // It's a "zombie", move last key to overwrite it
@@ -205,41 +345,269 @@ static void Rehash_Map(REBMAP *map)
             Copy_Cell(
                 &key[1], SPECIFIC(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
             );
+            by_record[n / 2] = by_record[ARR_LEN(pairlist) / 2 - 1];
             SET_SERIES_LEN(pairlist, ARR_LEN(pairlist) - 2);
         }
 
-        REBLEN hash = Find_Key_Hashed(
-            pairlist, hashlist, key, SPECIFIED, 2, cased, 0
-        );
-        hashes[hash] = n / 2 + 1;
+        REBLEN hash = by_record[n / 2];
+        assert(hash == Hash_Value(key));
 
-        // discard zombies at end of pairlist
-        //
-        while (Is_Void(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_SERIES_LEN(pairlist, ARR_LEN(pairlist) - 2);
+        Index_Map_Record(hashlist, n / 2 + 1, hash);
+
+        n += 2;
+    }
+
+    Free_Unmanaged_Series(record_hashes);
+}
+
+
+// While a map is being rehashed incrementally, records not yet migrated are
+// indexed by the old table.  Search it without claiming any slots, and skip
+// over matches in slots behind the migration cursor: those records were
+// moved to the new table, or were made into holes (which may be reused).
+//
+// Returns the 1-based record index of the key, or 0 if it's not there.
+//
+static REBLEN Find_Unmigrated_Key(
+    Array(*) pairlist,
+    REBSER *unmigrated,
+    Cell(const*) key,
+    REBSPC *specifier,
+    bool strict
+){
+    REBLEN num_slots = Hashlist_Num_Slots(unmigrated);
+    REBLEN *indexes = Hashlist_Slots(unmigrated);
+    REBLEN num_migrated = Hashlist_Header(unmigrated)[HASHLIST_NUM_MIGRATED];
+
+    uint32_t hash = Hash_Value(key);
+    REBLEN slot = hash % num_slots;
+    REBLEN skip = hash % (num_slots - 1) + 1;
+
+    REBLEN found = 0;
+
+    REBLEN n;
+    while ((n = HASHLIST_INDEX(indexes, slot)) != 0) {
+        if (slot >= num_migrated and HASHLIST_HASH(indexes, slot) == hash) {
+            Cell(const*) k = ARR_AT(pairlist, (n - 1) * 2);
+            if (0 == Cmp_Value(k, key, strict)) {
+                if (strict)
+                    return n;
+                if (found != 0)  // another spelling of the key already seen
+                    fail (Error_Conflicting_Key(key, specifier));
+                found = n;
+            }
         }
+
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
     }
+
+    return found;
 }
 
 
+// Move up to `limit` slots out of the old table a hashlist links to.  Live
+// records are reindexed using their cached hashes.  Zombies are dropped from
+// the index and become holes: their key cell is overwritten with an INTEGER!
+// linking to the next hole, so a later insert can reuse the record.
 //
-//  Expand_Hash: C
+static void Migrate_Map_Slots(
+    Array(*) pairlist,
+    REBSER *hashlist,
+    REBLEN limit
+){
+    REBSER *unmigrated = LINK(Unmigrated, hashlist);
+    REBLEN *old_indexes = Hashlist_Slots(unmigrated);
+    REBLEN old_num_slots = Hashlist_Num_Slots(unmigrated);
+
+    REBLEN *header = Hashlist_Header(hashlist);
+
+    REBLEN old_slot = Hashlist_Header(unmigrated)[HASHLIST_NUM_MIGRATED];
+    for (; old_slot < old_num_slots and limit != 0; ++old_slot, --limit) {
+        REBLEN n = HASHLIST_INDEX(old_indexes, old_slot);
+        if (n == 0)
+            continue;
+
+        Cell(*) k = ARR_AT(pairlist, (n - 1) * 2);
+        if (Is_Void(k + 1)) {
+            Init_Integer(k, header[HASHLIST_FIRST_HOLE]);
+            header[HASHLIST_FIRST_HOLE] = n;
+            --header[HASHLIST_NUM_ZOMBIES];
+            ++header[HASHLIST_NUM_HOLES];
+            continue;
+        }
+
+        Index_Map_Record(hashlist, n, HASHLIST_HASH(old_indexes, old_slot));
+    }
+
+    Hashlist_Header(unmigrated)[HASHLIST_NUM_MIGRATED] = old_slot;
+
+    if (old_slot == old_num_slots)
+        mutable_LINK(Unmigrated, hashlist) = nullptr;  // GC frees old table
+}
+
+
+// Called before each map access to do a step of any migration in progress,
+// or to start a rebuild of the hashlist if it's needed.
 //
-// Expand hash series. Clear it but set its tail.
+static void Update_Map_Hashlist(REBMAP *map)
+{
+    Array(*) pairlist = MAP_PAIRLIST(map);
+    REBSER *hashlist = MAP_HASHLIST(map);
+
+    if (LINK(Unmigrated, hashlist)) {  // finish one rebuild before another
+        Migrate_Map_Slots(pairlist, hashlist, MAP_MIGRATE_SLOTS);
+        return;
+    }
+
+    REBLEN *header = Hashlist_Header(hashlist);
+    REBLEN num_slots = Hashlist_Num_Slots(hashlist);
+    REBLEN num_indexed = ARR_LEN(pairlist) / 2 - header[HASHLIST_NUM_HOLES];
+    REBLEN num_zombies = header[HASHLIST_NUM_ZOMBIES];
+
+    if (
+        num_indexed * 4 <= num_slots
+        and (
+            num_zombies < MAP_MIN_COMPACT_ZOMBIES
+            or num_zombies * 2 <= num_indexed
+        )
+    ){
+        return;
+    }
+
+    // A map still being built (e.g. by TO_Map()) has no MAP! value that
+    // could observe a pause, so rebuild it all at once.
+    //
+    if (NOT_SERIES_FLAG(hashlist, MANAGED)) {
+        Rehash_Map(map);
+        return;
+    }
+
+    REBLEN num_live = num_indexed - num_zombies;
+    REBLEN new_num_slots = Get_Hash_Prime_May_Fail(num_live * 6 + 1);
+    if (new_num_slots < num_slots)
+        new_num_slots = num_slots;  // tables don't shrink, see notes above
+
+    REBSER *fresh = Make_Map_Hashlist(new_num_slots);
+    memcpy(
+        Hashlist_Header(fresh),
+        header,
+        sizeof(REBLEN) * HASHLIST_HEADER_LEN
+    );
+    Hashlist_Header(fresh)[HASHLIST_NUM_MIGRATED] = 0;
+    header[HASHLIST_NUM_MIGRATED] = 0;  // cursor for migrating out of it
+
+    mutable_LINK(Unmigrated, fresh) = hashlist;
+    mutable_LINK(Hashlist, pairlist) = Manage_Series(fresh);
+
+    Migrate_Map_Slots(pairlist, fresh, MAP_MIGRATE_SLOTS);
+}
+
+
+// Complete any incremental rebuild of a map's hashlist.  Used before making
+// a copy of the hashlist, so the copy doesn't need the old table.
 //
-void Expand_Hash(REBSER *ser)
+static void Finish_Map_Rehash(REBMAP *map)
 {
-    assert(not IS_SER_ARRAY(ser));
+    REBSER *hashlist = MAP_HASHLIST(map);
+    if (not hashlist)
+        return;
 
-    REBINT prime = Get_Hash_Prime_May_Fail(SER_USED(ser) + 1);
-    Remake_Series(
-        ser,
-        prime + 1,
-        SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
+    REBSER *unmigrated = LINK(Unmigrated, hashlist);
+    if (unmigrated)
+        Migrate_Map_Slots(
+            MAP_PAIRLIST(map),
+            hashlist,
+            Hashlist_Num_Slots(unmigrated)
+        );
+    assert(not LINK(Unmigrated, hashlist));
+}
+
+
+// Give a linearly searched map a hashlist, once it has enough records.  The
+// records are indexed in place, keeping their order, and records with void
+// values become zombies (they can be compacted away later).
+//
+static void Hash_Map_Pairlist(Array(*) pairlist)
+{
+    REBLEN num_records = ARR_LEN(pairlist) / 2;
+    REBSER *hashlist = Make_Map_Hashlist(
+        Get_Hash_Prime_May_Fail(num_records * 6 + 1)  // see MAP_MIGRATE_SLOTS
     );
 
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, prime);
+    REBLEN n;
+    for (n = 1; n <= num_records; ++n) {
+        Cell(const*) key = ARR_AT(pairlist, (n - 1) * 2);
+        if (Is_Void(key + 1))
+            ++Hashlist_Header(hashlist)[HASHLIST_NUM_ZOMBIES];
+        Index_Map_Record(hashlist, n, Hash_Value(key));
+    }
+
+    if (GET_SERIES_FLAG(pairlist, MANAGED))  // else Init_Map() will do it
+        Manage_Series(hashlist);
+
+    mutable_LINK(Hashlist, pairlist) = hashlist;
+}
+
+
+// A map with no hashlist is searched in record order.  Only keys with the
+// same heart are compared, since keys with different hearts (like 1 and 1.0)
+// would have different hashes, and be distinct keys in a hashed map.
+//
+// Same contract as Find_Map_Entry().
+//
+static REBLEN Find_Linear_Map_Entry(
+    Array(*) pairlist,
+    Cell(const*) key,
+    REBSPC *key_specifier,
+    Cell(const*) val,
+    REBSPC *val_specifier,
+    bool strict
+){
+    enum Reb_Kind heart = CELL_HEART(key);
+
+    REBLEN n = 0;
+    REBLEN zombie = 0;  // first record with a void value, reused on insert
+
+    REBLEN num_records = ARR_LEN(pairlist) / 2;
+    REBLEN i;
+    for (i = 1; i <= num_records; ++i) {
+        Cell(const*) k = ARR_AT(pairlist, (i - 1) * 2);
+        if (CELL_HEART(k) == heart and 0 == Cmp_Value(k, key, strict)) {
+            if (strict) {
+                n = i;
+                break;
+            }
+            if (n != 0)  // another spelling of the key already matched
+                fail (Error_Conflicting_Key(key, key_specifier));
+            n = i;
+        }
+        else if (zombie == 0 and Is_Void(k + 1))
+            zombie = i;
+    }
+
+    if (val == nullptr)
+        return n;  // was just fetching the value
+
+    Force_Value_Frozen_Deep_Blame(key, pairlist);  // see Find_Map_Entry()
+
+    if (n == 0) {
+        if (Is_Void(val))
+            return 0;  // trying to remove non-existing key
+
+        if (zombie == 0) {
+            Append_Value_Core(pairlist, key, key_specifier);
+            Append_Value_Core(pairlist, val, val_specifier);
+            return ARR_LEN(pairlist) / 2;
+        }
+
+        n = zombie;
+        Derelativize(ARR_AT(pairlist, (n - 1) * 2), key, key_specifier);
+    }
+
+    Derelativize(ARR_AT(pairlist, ((n - 1) * 2) + 1), val, val_specifier);
+    return n;
 }
 
 
@@ -261,25 +629,49 @@ REBLEN Find_Map_Entry(
 ) {
     assert(not Is_Isotope(key));
 
-    REBSER *hashlist = MAP_HASHLIST(map); // can be null
     Array(*) pairlist = MAP_PAIRLIST(map);
 
-    assert(hashlist);
-
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_USED(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
+    if (not MAP_HASHLIST(map)) {
+        if (ARR_LEN(pairlist) < MAP_MAX_LINEAR * 2)
+            return Find_Linear_Map_Entry(
+                pairlist, key, key_specifier, val, val_specifier, strict
+            );
+        Hash_Map_Pairlist(pairlist);
     }
 
-    const REBLEN wide = 2;
-    const Byte mode = 0; // just search for key, don't add it
-    REBLEN slot = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, wide, strict, mode
-    );
+    Update_Map_Hashlist(map);  // may replace the hashlist
+
+    REBSER *hashlist = MAP_HASHLIST(map);
+    REBLEN *header = Hashlist_Header(hashlist);
+
+    // If a rebuild is in progress, the key may be indexed by the old table.
+    // A non-strict search that finds it there must still make sure no other
+    // spelling of the key is in the new table.
+    //
+    REBLEN n = 0;
+    REBSER *unmigrated = LINK(Unmigrated, hashlist);
+    if (unmigrated)
+        n = Find_Unmigrated_Key(
+            pairlist, unmigrated, key, key_specifier, strict
+        );
 
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
-    REBLEN n = indexes[slot];
+    const REBLEN wide = 2;
+    REBINT slot = -1;
+    if (n == 0) {
+        const Byte mode = 0; // just search for key, don't add it
+        slot = Find_Key_Hashed(
+            pairlist, hashlist, key, key_specifier, wide, strict, mode
+        );
+        n = HASHLIST_INDEX(Hashlist_Slots(hashlist), slot);
+    }
+    else if (not strict) {
+        const Byte mode = 1; // search, but don't touch zombies
+        if (-1 != Find_Key_Hashed(
+            pairlist, hashlist, key, key_specifier, wide, strict, mode
+        )){
+            fail (Error_Conflicting_Key(key, key_specifier));
+        }
+    }
 
     // n==0 or pairlist[(n-1)*]=~key
 
@@ -295,23 +687,40 @@ REBLEN Find_Map_Entry(
 
     // Must set the value:
     if (n) {  // re-set it:
-        Derelativize(
-            ARR_AT(pairlist, ((n - 1) * 2) + 1),
-            val,
-            val_specifier
-        );
+        Cell(*) v = ARR_AT(pairlist, ((n - 1) * 2) + 1);
+        bool was_zombie = Is_Void(v);
+        Derelativize(v, val, val_specifier);
+
+        if (was_zombie and not Is_Void(v))
+            --header[HASHLIST_NUM_ZOMBIES];
+        else if (not was_zombie and Is_Void(v))
+            ++header[HASHLIST_NUM_ZOMBIES];
         return n;
     }
 
     if (Is_Void(val)) return 0; // trying to remove non-existing key
 
-    // Create new entry.  Note that it does not copy underlying series (e.g.
-    // the data of a string), which is why the immutability test is necessary
+    // Create new entry, in a hole if there is one.  Note that it does not
+    // copy underlying series (e.g. the data of a string), which is why the
+    // immutability test is necessary
     //
-    Append_Value_Core(pairlist, key, key_specifier);
-    Append_Value_Core(pairlist, val, val_specifier);
+    if (header[HASHLIST_FIRST_HOLE] != 0) {
+        n = header[HASHLIST_FIRST_HOLE];
+        Cell(*) k = ARR_AT(pairlist, (n - 1) * 2);
+        assert(IS_INTEGER(k) and Is_Void(k + 1));
+        header[HASHLIST_FIRST_HOLE] = VAL_INT32(k);
+        --header[HASHLIST_NUM_HOLES];
+
+        Derelativize(k, key, key_specifier);
+        Derelativize(k + 1, val, val_specifier);
+    }
+    else {
+        Append_Value_Core(pairlist, key, key_specifier);
+        Append_Value_Core(pairlist, val, val_specifier);
+        n = ARR_LEN(pairlist) / 2;
+    }
 
-    return (indexes[slot] = (ARR_LEN(pairlist) / 2));
+    return (HASHLIST_INDEX(Hashlist_Slots(hashlist), slot) = n);
 }
 
 
@@ -377,6 +786,8 @@ Bounce MAKE_Map(
 
 
 inline static REBMAP *Copy_Map(const REBMAP *map, REBU64 types) {
+    Finish_Map_Rehash(m_cast(REBMAP*, map));  // only changes hidden state
+
     Array(*) copy = Copy_Array_Shallow_Flags(
         MAP_PAIRLIST(map),
         SPECIFIED,
@@ -385,14 +796,20 @@ inline static REBMAP *Copy_Map(const REBMAP *map, REBU64 types) {
 
     // So long as the copied pairlist is the same array size as the original,
     // a literal copy of the hashlist can still be used, as a start (needs
-    // its own copy so new map's hashes will reflect its own mutations)
+    // its own copy so new map's hashes will reflect its own mutations).
+    // Holes are copied as is, so the hole list in its header stays valid.
     //
-    REBSER *hashlist = Copy_Series_Core(
-        MAP_HASHLIST(map),
-        SERIES_FLAGS_NONE | FLAG_FLAVOR(HASHLIST)
-            // ^-- !!! No NODE_FLAG_MANAGED?
-    );
-    mutable_LINK(Hashlist, copy) = hashlist;
+    if (not MAP_HASHLIST(map))  // small map, searched linearly
+        mutable_LINK(Hashlist, copy) = nullptr;
+    else {
+        REBSER *hashlist = Copy_Series_Core(
+            MAP_HASHLIST(map),
+            SERIES_FLAG_LINK_NODE_NEEDS_MARK | FLAG_FLAVOR(HASHLIST)
+                // ^-- !!! No NODE_FLAG_MANAGED?
+        );
+        mutable_LINK(Unmigrated, hashlist) = nullptr;
+        mutable_LINK(Hashlist, copy) = hashlist;
+    }
 
     if (types == 0)
         return MAP(copy); // no types have deep copy requested, shallow is OK
@@ -406,12 +823,12 @@ inline static REBMAP *Copy_Map(const REBMAP *map, REBU64 types) {
     Cell(const*) tail = ARR_TAIL(copy);
     REBVAL *key = SPECIFIC(ARR_HEAD(copy));  // keys/vals specified
     for (; key != tail; key += 2) {
-        assert(Is_Value_Frozen_Deep(key));  // immutable key
-
         REBVAL *v = key + 1;
         assert(v != tail);
         if (Is_Void(v))
-            continue; // "zombie" map element (not present)
+            continue; // "zombie" map element, or hole (not present)
+
+        assert(Is_Value_Frozen_Deep(key));  // immutable key
 
         Flags flags = NODE_FLAG_MANAGED;  // !!! Review
         Clonify(v, flags, types);
@@ -714,10 +1131,10 @@ REBTYPE(Map)
 
         Reset_Array(MAP_PAIRLIST(m));
 
-        // !!! Review: should the space for the hashlist be reclaimed?  This
-        // clears all the indices but doesn't scale back the size.
+        // An empty map is searched linearly, so drop the hashlist (if any)
+        // and let the GC reclaim it.
         //
-        Clear_Series(MAP_HASHLIST(m));
+        mutable_LINK(Hashlist, MAP_PAIRLIST(m)) = nullptr;
 
         return Init_Map(OUT, m); }
 
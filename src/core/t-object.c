@@ -232,7 +232,7 @@ void Init_Evars(EVARS *e, noquote(Cell(const*)) v) {
         Symbol(*) *psym = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
         Symbol(*) *psym_tail = SER_TAIL(Symbol(*), PG_Symbols_By_Hash);
         for (; psym != psym_tail; ++psym) {
-            if (*psym == nullptr or *psym == &PG_Deleted_Symbol)
+            if (*psym == nullptr)
                 continue;
 
             REBSER *patch = MISC(Hitch, *psym);
@@ -828,7 +828,7 @@ Context(*) Copy_Context_Extra_Managed(
         Symbol(*) *psym = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
         Symbol(*) *psym_tail = SER_TAIL(Symbol(*), PG_Symbols_By_Hash);
         for (; psym != psym_tail; ++psym) {
-            if (*psym == nullptr or *psym == &PG_Deleted_Symbol)
+            if (*psym == nullptr)
                 continue;
 
             REBSER *patch = MISC(Hitch, *psym);
@@ -1068,6 +1068,9 @@ REBTYPE(Context)
     if (IS_PORT(context))
         assert(symid == SYM_PICK_P or symid == SYM_POKE_P);
 
+    if (IS_ERROR(context))  // fields like NEAR may not be filled in yet
+        Finish_Lazy_Location_Of_Error(c);
+
     switch (symid) {
       case SYM_REFLECT: {
         INCLUDE_PARAMS_OF_REFLECT;
@@ -127,6 +127,8 @@ REBTYPE(Port)
     if (id == SYM_PICK_P or id == SYM_POKE_P)
         return T_Context(frame_, verb);
 
+    TRACEPOINT1(port__start, STR_UTF8(verb));
+
     Context(*) ctx = VAL_CONTEXT(port);
     REBVAL *actor = CTX_VAR(ctx, STD_PORT_ACTOR);
 
@@ -175,6 +177,8 @@ REBTYPE(Port)
 
 } post_process_output: {  ////////////////////////////////////////////////////
 
+    TRACEPOINT1(port__finish, STR_UTF8(verb));
+
     // !!! READ's /LINES and /STRING refinements are something that should
     // work regardless of data source.  But R3-Alpha only implemented it in
     // %p-file.c, so it got ignored.  Ren-C caught that it was being ignored,
@@ -188,6 +192,8 @@ REBTYPE(Port)
         UNUSED(PARAM(source));
         UNUSED(PARAM(part));
         UNUSED(PARAM(seek));
+        UNUSED(PARAM(into));  // network READ/INTO returns the PORT!
+        UNUSED(PARAM(mapped));  // only FILE! ports map, others ignore
 
         if (Is_Nulled(OUT))
             return nullptr;  // !!! `read dns://` returns nullptr on failure
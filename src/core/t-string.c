@@ -65,35 +65,76 @@ REBINT CT_String(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
         or REB_URL == CELL_HEART(a)
     );
 
-    REBLEN l1;
-    Utf8(const*) cp1 = VAL_UTF8_LEN_SIZE_AT(&l1, nullptr, a);
+    Size size1;
+    const Byte* bp1 = VAL_UTF8_LEN_SIZE_AT(nullptr, &size1, a);
+    const Byte* tail1 = bp1 + size1;
 
-    REBLEN l2;
-    Utf8(const*) cp2 = VAL_UTF8_LEN_SIZE_AT(&l2, nullptr, b);
+    Size size2;
+    const Byte* bp2 = VAL_UTF8_LEN_SIZE_AT(nullptr, &size2, b);
+    const Byte* tail2 = bp2 + size2;
 
-    REBLEN len = MIN(l1, l2);
+    if (bp1 == bp2 and size1 == size2)  // same series and position (or span)
+        return 0;
+
+    // UTF-8 was designed so that comparing the bytes orders the same way as
+    // comparing the decoded codepoints, and if one encoding is a prefix of
+    // the other then so is the one string of the other.  So a cased compare
+    // is just memcmp(), which the C library vectorizes.
+    //
+    if (strict) {
+        int d = memcmp(bp1, bp2, MIN(size1, size2));
+        if (d != 0)
+            return d > 0 ? 1 : -1;
+        if (size1 == size2)
+            return 0;
+        return size1 > size2 ? 1 : -1;
+    }
 
-    for (; len > 0; len--) {
-        Codepoint c1;
-        Codepoint c2;
+    // Caseless compares can't use byte sizes to decide, since LO_CASE() may
+    // map between codepoints of different encoded sizes.  But both sides are
+    // stepped a codepoint at a time in lockstep, so whichever side runs out
+    // of bytes first has fewer codepoints.  Runs where both sides are ASCII
+    // are folded and compared 8 bytes at a time.
+    //
+    while (bp1 != tail1 and bp2 != tail2) {
+        if (tail1 - bp1 >= 8 and tail2 - bp2 >= 8) {
+            uint64_t w1;
+            uint64_t w2;
+            memcpy(&w1, bp1, 8);
+            memcpy(&w2, bp2, 8);
+            if (Is_Ascii_64(w1 | w2)) {
+                if (Lowercase_Ascii_64(w1) == Lowercase_Ascii_64(w2)) {
+                    bp1 += 8;
+                    bp2 += 8;
+                    continue;
+                }
+                for (; ; ++bp1, ++bp2) {  // some byte in the word differs
+                    REBINT d = LO_CASE(*bp1) - LO_CASE(*bp2);
+                    if (d != 0)
+                        return d > 0 ? 1 : -1;
+                }
+            }
+        }
 
-        cp1 = NEXT_CHR(&c1, cp1);
-        cp2 = NEXT_CHR(&c2, cp2);
+        Codepoint c1 = *bp1;
+        if (c1 >= 0x80)
+            bp1 = Back_Scan_UTF8_Char_Unchecked(&c1, bp1);
+        ++bp1;
 
-        REBINT d;
-        if (strict)
-            d = c1 - c2;
-        else
-            d = LO_CASE(c1) - LO_CASE(c2);
+        Codepoint c2 = *bp2;
+        if (c2 >= 0x80)
+            bp2 = Back_Scan_UTF8_Char_Unchecked(&c2, bp2);
+        ++bp2;
 
+        REBINT d = LO_CASE(c1) - LO_CASE(c2);
         if (d != 0)
             return d > 0 ? 1 : -1;
     }
 
-    if (l1 == l2)
+    if (bp1 == tail1 and bp2 == tail2)
         return 0;
 
-    return l1 > l2 ? 1 : -1;
+    return bp1 == tail1 ? -1 : 1;
 }
 
 
@@ -195,17 +236,11 @@ Bounce MAKE_String(
         Length len;
         Size size;
         const Byte* utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, def);
-        UNUSED(len);  // !!! Data already valid and checked, should leverage
-        return Init_Any_String(
-            OUT,
-            kind,
-            Append_UTF8_May_Fail(  // !!! Should never fail
-                nullptr,
-                cs_cast(utf8),
-                size,
-                STRMODE_ALL_CODEPOINTS
-            )
-        );
+
+        String(*) copy = Make_String(size);  // already valid, just copy it
+        memcpy(BIN_HEAD(copy), utf8, size);
+        TERM_STR_LEN_SIZE(copy, len, size);
+        return Init_Any_String(OUT, kind, copy);
     }
 
     if (IS_BINARY(def)) {  // not necessarily valid UTF-8, so must check
@@ -740,65 +775,98 @@ bool Did_Get_Series_Index_From_Picker(
 
 
 //
-//  REBTYPE: C
+//  String_Pick_P: C
 //
-// Action handler for ANY-STRING!
+// PICK* for ANY-STRING! (see %sys-pick.h for explanation).  This is called
+// directly by Run_Generic_Dispatch(), without going through REBTYPE(String),
+// because it is listed in %verb-hooks.r.
 //
-REBTYPE(String)
+Bounce String_Pick_P(Frame(*) frame_, Symbol(const*) verb)
 {
+    INCLUDE_PARAMS_OF_PICK_P;
+    UNUSED(verb);
+    UNUSED(ARG(location));
+
     REBVAL *v = D_ARG(1);
     assert(ANY_STRING(v));
 
-    option(SymId) id = ID_OF_SYMBOL(verb);
+    Cell(const*) picker = ARG(picker);
+    REBINT n;
+    if (not Did_Get_Series_Index_From_Picker(&n, v, picker))
+        return nullptr;
 
-    switch (id) {
+    Codepoint c = GET_CHAR_AT(VAL_STRING(v), n);
 
-    //=//// PICK* (see %sys-pick.h for explanation) ////////////////////////=//
+    return Init_Char_Unchecked(OUT, c);
+}
 
-      case SYM_PICK_P: {
-        INCLUDE_PARAMS_OF_PICK_P;
-        UNUSED(ARG(location));
 
-        Cell(const*) picker = ARG(picker);
-        REBINT n;
-        if (not Did_Get_Series_Index_From_Picker(&n, v, picker))
-            return nullptr;
+//
+//  String_Poke_P: C
+//
+// POKE* for ANY-STRING! (see %sys-pick.h for explanation).  Also called
+// directly, see String_Pick_P().
+//
+Bounce String_Poke_P(Frame(*) frame_, Symbol(const*) verb)
+{
+    INCLUDE_PARAMS_OF_POKE_P;
+    UNUSED(verb);
+    UNUSED(ARG(location));
 
-        Codepoint c = GET_CHAR_AT(VAL_STRING(v), n);
+    REBVAL *v = D_ARG(1);
+    assert(ANY_STRING(v));
 
-        return Init_Char_Unchecked(OUT, c); }
+    Cell(const*) picker = ARG(picker);
+    REBINT n;
+    if (not Did_Get_Series_Index_From_Picker(&n, v, picker))
+        fail (Error_Out_Of_Range(picker));
 
+    REBVAL *setval = ARG(value);
 
-    //=//// POKE* (see %sys-pick.h for explanation) ////////////////////////=//
+    Codepoint c;
+    if (IS_CHAR(setval)) {
+        c = VAL_CHAR(setval);
+    }
+    else if (IS_INTEGER(setval)) {
+        c = Int32(setval);
+    }
+    else  // CHANGE is a better route for splicing/removal/etc.
+        fail (PARAM(value));
 
-      case SYM_POKE_P: {
-        INCLUDE_PARAMS_OF_POKE_P;
-        UNUSED(ARG(location));
+    if (c == 0)
+        fail (Error_Illegal_Zero_Byte_Raw());
 
-        Cell(const*) picker = ARG(picker);
-        REBINT n;
-        if (not Did_Get_Series_Index_From_Picker(&n, v, picker))
-            fail (Error_Out_Of_Range(picker));
+    String(*) s = VAL_STRING_ENSURE_MUTABLE(v);
+    SET_CHAR_AT(s, n, c);
 
-        REBVAL *setval = ARG(value);
+    return nullptr;  // String(*) is still fine, caller need not update
+}
 
-        Codepoint c;
-        if (IS_CHAR(setval)) {
-            c = VAL_CHAR(setval);
-        }
-        else if (IS_INTEGER(setval)) {
-            c = Int32(setval);
-        }
-        else  // CHANGE is a better route for splicing/removal/etc.
-            fail (PARAM(value));
 
-        if (c == 0)
-            fail (Error_Illegal_Zero_Byte_Raw());
+//
+//  REBTYPE: C
+//
+// Action handler for ANY-STRING!
+//
+REBTYPE(String)
+{
+    REBVAL *v = D_ARG(1);
+    assert(ANY_STRING(v));
 
-        String(*) s = VAL_STRING_ENSURE_MUTABLE(v);
-        SET_CHAR_AT(s, n, c);
+    option(SymId) id = ID_OF_SYMBOL(verb);
+
+    switch (id) {
 
-        return nullptr; }  // Array(*) is still fine, caller need not update
+    //=//// PICK* (see %sys-pick.h for explanation) ////////////////////////=//
+
+      case SYM_PICK_P:
+        return String_Pick_P(frame_, verb);
+
+
+    //=//// POKE* (see %sys-pick.h for explanation) ////////////////////////=//
+
+      case SYM_POKE_P:
+        return String_Poke_P(frame_, verb);
 
 
       case SYM_REFLECT: {
@@ -1114,6 +1182,9 @@ REBTYPE(String)
         if (REF(compare))
             fail (Error_Bad_Refines_Raw());  // !!! not in R3-Alpha
 
+        if (REF(key))
+            fail (Error_Bad_Refines_Raw());
+
         Copy_Cell(OUT, v);  // before index modification
         REBLEN limit = Part_Len_May_Modify_Index(v, ARG(part));
         if (limit <= 1)
@@ -1151,7 +1222,7 @@ REBTYPE(String)
         if (REF(reverse))
             thunk |= CC_FLAG_REVERSE;
 
-        reb_qsort_r(
+        (REF(stable) or skip > 1 ? &reb_stable_sort_r : &reb_qsort_r)(
             m_cast(Byte*, utf8),  // ok due to VAL_STRING_MUTABLE()
             len,
             span * sizeof(Byte),
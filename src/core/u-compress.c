@@ -28,8 +28,12 @@
 //
 // Options are offered for using zlib envelope, gzip envelope, or raw deflate.
 //
-// !!! zlib is designed to do streaming compression.  While that code is
-// part of the linked in library, it's not exposed by this interface.
+// zlib's streaming state is exposed by ZLIB-STREAM and ZLIB-FEED, so data
+// can be compressed or decompressed chunk by chunk in constant memory.
+//
+// !!! Streams are a HANDLE! fed through a native call, similar to what the
+// Crypt extension does with AES-KEY and AES-STREAM.  A PORT! wrapping
+// another port would be nicer for piping, but could be built on this.
 //
 // !!! Since the zlib code/API isn't actually modified, one could dynamically
 // link to a zlib on the platform instead of using the extracted version.
@@ -40,6 +44,15 @@
 #undef Byte  // sys-zlib.h defines it compatibly (unsigned char)
 #include "sys-zlib.h"
 
+#if REBOL_PARALLEL_DEFLATE
+    #include <pthread.h>
+    #include <unistd.h>  // sysconf()
+#endif
+
+#define PARALLEL_DEFLATE_MAX_THREADS 16
+#define PARALLEL_DEFLATE_MIN_CHUNK (1024 * 1024)
+#define DEFLATE_DICTIONARY_SIZE 32768  // the most a back-reference can reach
+
 
 //
 //  Bytes_To_U32_BE: C
@@ -217,6 +230,266 @@ Byte* Compress_Alloc_Core(
 }
 
 
+// A chunk of a parallel deflate.  This is filled in and read only by the
+// calling thread, except for the output fields written by its worker.
+//
+// Workers must not touch the interpreter: no fail(), no rebMalloc(), and not
+// even Try_Alloc_Mem() (which updates unsynchronized memory statistics).  So
+// zlib uses its own default malloc()-based allocator and the output buffer
+// is a plain malloc() too, freed by the calling thread after copying it.
+//
+struct Reb_Deflate_Task {
+    const Byte* dictionary;  // up to 32K of input just before this chunk
+    Size dictionary_size;
+    const Byte* input;
+    Size size_in;
+    bool last;  // Z_FINISH instead of Z_SYNC_FLUSH
+
+    Byte* output;  // malloc()'d, or nullptr on failure
+    Size size_out;
+    uLong crc;
+    uLong adler;
+};
+
+static void Run_Deflate_Task(struct Reb_Deflate_Task *t)
+{
+    t->output = nullptr;
+    t->crc = crc32_z(0L, t->input, t->size_in);
+    t->adler = z_adler32(1L, t->input, t->size_in);
+
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    if (Z_OK != deflateInit2(
+        &strm,
+        Z_DEFAULT_COMPRESSION,
+        Z_DEFLATED,
+        window_bits_zlib_raw,  // envelope is added once, around all chunks
+        8,
+        Z_DEFAULT_STRATEGY
+    )){
+        return;
+    }
+
+    if (t->dictionary_size != 0) {
+        deflateSetDictionary(&strm, t->dictionary, t->dictionary_size);
+    }
+
+    // A sync flush ends on a byte boundary without setting the "final block"
+    // bit, so the chunks can be concatenated.  Allow for its empty stored
+    // block on top of the usual bound.
+    //
+    Size buf_size = deflateBound(&strm, t->size_in) + 16;
+    Byte* output = cast(Byte*, malloc(buf_size));
+    if (not output) {
+        deflateEnd(&strm);
+        return;
+    }
+
+    strm.next_in = cast(const z_Bytef*, t->input);
+    strm.avail_in = t->size_in;
+    strm.next_out = output;
+    strm.avail_out = buf_size;
+
+    int ret = deflate(&strm, t->last ? Z_FINISH : Z_SYNC_FLUSH);
+    bool ok = t->last
+        ? (ret == Z_STREAM_END)
+        : (ret == Z_OK and strm.avail_in == 0 and strm.avail_out != 0);
+
+    t->size_out = buf_size - strm.avail_out;
+    deflateEnd(&strm);
+
+    if (ok)
+        t->output = output;
+    else
+        free(output);
+}
+
+
+#if REBOL_PARALLEL_DEFLATE
+    static void *Deflate_Thread(void *t) {
+        Run_Deflate_Task(cast(struct Reb_Deflate_Task*, t));
+        return nullptr;
+    }
+#endif
+
+
+//
+//  Compress_Parallel_Alloc_Core: C
+//
+// Compress like Compress_Alloc_Core(), but split big input into a chunk per
+// CPU which are deflated concurrently (when built with REBOL_PARALLEL_DEFLATE)
+// and concatenated.  Each chunk is primed with the 32K of input before it, so
+// the ratio is about the same as a single-threaded DEFLATE.  The checksum of
+// the whole is put together from those of the chunks with crc32_combine() or
+// adler32_combine(), and the output is standard: any inflater reads it.
+//
+Byte* Compress_Parallel_Alloc_Core(
+    option(Size*) size_out,
+    const void* input,
+    Size size_in,
+    enum Reb_Symbol_Id envelope  // SYM_NONE, SYM_ZLIB, or SYM_GZIP
+){
+    size_t num_chunks = 1;
+  #if REBOL_PARALLEL_DEFLATE
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > 1)
+        num_chunks = MIN(cast(size_t, cpus), PARALLEL_DEFLATE_MAX_THREADS);
+  #endif
+    if (num_chunks > size_in / PARALLEL_DEFLATE_MIN_CHUNK)
+        num_chunks = size_in / PARALLEL_DEFLATE_MIN_CHUNK;
+
+    if (num_chunks <= 1)
+        return Compress_Alloc_Core(size_out, input, size_in, envelope);
+
+    const Byte* in = cast(const Byte*, input);
+
+    struct Reb_Deflate_Task tasks[PARALLEL_DEFLATE_MAX_THREADS];
+    size_t i;
+    for (i = 0; i < num_chunks; ++i) {
+        Size lo = size_in * i / num_chunks;
+        Size hi = size_in * (i + 1) / num_chunks;
+        Size dict = MIN(lo, cast(Size, DEFLATE_DICTIONARY_SIZE));
+        tasks[i].dictionary = in + lo - dict;
+        tasks[i].dictionary_size = dict;
+        tasks[i].input = in + lo;
+        tasks[i].size_in = hi - lo;
+        tasks[i].last = (i == num_chunks - 1);
+    }
+
+  #if REBOL_PARALLEL_DEFLATE
+    pthread_t threads[PARALLEL_DEFLATE_MAX_THREADS];
+    bool started[PARALLEL_DEFLATE_MAX_THREADS];
+    for (i = 0; i < num_chunks - 1; ++i)
+        started[i] = (
+            0 == pthread_create(&threads[i], nullptr, &Deflate_Thread, &tasks[i])
+        );
+
+    Run_Deflate_Task(&tasks[num_chunks - 1]);
+
+    for (i = 0; i < num_chunks - 1; ++i) {
+        if (started[i])
+            pthread_join(threads[i], nullptr);
+        else
+            Run_Deflate_Task(&tasks[i]);
+    }
+  #else
+    for (i = 0; i < num_chunks; ++i)
+        Run_Deflate_Task(&tasks[i]);
+  #endif
+
+    bool ok = true;
+    Size total = 0;
+    for (i = 0; i < num_chunks; ++i) {
+        if (tasks[i].output == nullptr)
+            ok = false;
+        else
+            total += tasks[i].size_out;
+    }
+    if (not ok) {
+        for (i = 0; i < num_chunks; ++i)
+            free(tasks[i].output);  // free(nullptr) is a no-op
+        fail (Error_No_Memory(size_in));
+    }
+
+    uLong crc = tasks[0].crc;
+    uLong adler = tasks[0].adler;
+    for (i = 1; i < num_chunks; ++i) {
+        crc = crc32_combine(crc, tasks[i].crc, tasks[i].size_in);
+        adler = adler32_combine(adler, tasks[i].adler, tasks[i].size_in);
+    }
+
+    Size header_size = 0;
+    Size trailer_size = 0;
+    if (envelope == SYM_ZLIB) {
+        header_size = 2;
+        trailer_size = 4;
+    }
+    else if (envelope == SYM_GZIP) {
+        header_size = 10;
+        trailer_size = 8;
+    }
+    else
+        assert(envelope == SYM_NONE);
+
+    Size out_size = header_size + total + trailer_size;
+    Byte* output = rebAllocN(Byte, out_size);
+    Byte* bp = output;
+
+    if (envelope == SYM_ZLIB) {
+        *bp++ = 0x78;  // deflate, 32K window
+        *bp++ = 0x9C;  // default compression level, header check bits
+    }
+    else if (envelope == SYM_GZIP) {
+        static const Byte gzip_header[10] = {
+            0x1F, 0x8B,  // magic number
+            8,  // deflate
+            0,  // no flags (no name, comment, extra field, header CRC)
+            0, 0, 0, 0,  // no modification time
+            0,  // no extra flags
+            0xFF  // unknown OS
+        };
+        memcpy(bp, gzip_header, 10);
+        bp += 10;
+    }
+
+    for (i = 0; i < num_chunks; ++i) {
+        memcpy(bp, tasks[i].output, tasks[i].size_out);
+        bp += tasks[i].size_out;
+        free(tasks[i].output);
+    }
+
+    if (envelope == SYM_ZLIB) {  // Adler-32 is big endian
+        *bp++ = cast(Byte, adler >> 24);
+        *bp++ = cast(Byte, adler >> 16);
+        *bp++ = cast(Byte, adler >> 8);
+        *bp++ = cast(Byte, adler);
+    }
+    else if (envelope == SYM_GZIP) {  // CRC-32 and size are little endian
+        *bp++ = cast(Byte, crc);
+        *bp++ = cast(Byte, crc >> 8);
+        *bp++ = cast(Byte, crc >> 16);
+        *bp++ = cast(Byte, crc >> 24);
+        *bp++ = cast(Byte, size_in);
+        *bp++ = cast(Byte, size_in >> 8);
+        *bp++ = cast(Byte, size_in >> 16);
+        *bp++ = cast(Byte, size_in >> 24);
+    }
+
+    assert(bp == output + out_size);
+    if (size_out)
+        *unwrap(size_out) = out_size;
+    return output;
+}
+
+
+// Decompression can tell zlib from gzip envelopes, so it has one more
+// option than compression.
+//
+static int Inflate_Window_Bits(enum Reb_Symbol_Id envelope)
+{
+    switch (envelope) {
+      case SYM_NONE:
+        return window_bits_zlib_raw;
+
+      case SYM_ZLIB:
+        return window_bits_zlib;
+
+      case SYM_GZIP:
+        return window_bits_gzip;
+
+      case SYM_DETECT:
+        return window_bits_detect_zlib_gzip;
+
+      default:
+        assert(false);  // use gzip in release build
+        return window_bits_gzip;
+    }
+}
+
+
 //
 //  Decompress_Alloc_Core: C
 //
@@ -239,29 +512,7 @@ Byte* Decompress_Alloc_Core(
     strm.avail_in = size_in;
     strm.next_in = cast(const z_Bytef*, input);
 
-    int window_bits = window_bits_gzip;
-    switch (envelope) {
-      case SYM_NONE:
-        window_bits = window_bits_zlib_raw;
-        break;
-
-      case SYM_ZLIB:
-        window_bits = window_bits_zlib;
-        break;
-
-      case SYM_GZIP:
-        window_bits = window_bits_gzip;
-        break;
-
-      case SYM_DETECT:
-        window_bits = window_bits_detect_zlib_gzip;
-        break;
-
-      default:
-        assert(false);  // fall through with default in release build
-    }
-
-    int ret_init = inflateInit2(&strm, window_bits);
+    int ret_init = inflateInit2(&strm, Inflate_Window_Bits(envelope));
     if (ret_init != Z_OK)
         fail (Error_Compression(&strm, ret_init));
 
@@ -342,10 +593,11 @@ Byte* Decompress_Alloc_Core(
         }
 
         // Use remaining input amount to guess how much more decompressed
-        // data might be produced.  Clamp to limit.
+        // data might be produced, but at least double so that many small
+        // guesses don't add up to quadratic copying.  Clamp to limit.
         //
         REBLEN old_size = buf_size;
-        buf_size = buf_size + strm.avail_in * 3;
+        buf_size = buf_size + MAX(buf_size, strm.avail_in * 3);
         if (max >= 0 and buf_size > cast(REBLEN, max))
             buf_size = max;
 
@@ -363,7 +615,7 @@ Byte* Decompress_Alloc_Core(
     // e.g. decompression on boot isn't wasting time with this realloc.)
     //
     assert(buf_size >= strm.total_out);
-    if (strm.total_out - buf_size > 1024)
+    if (buf_size - strm.total_out > 1024)
         output = cast(Byte*, rebRealloc(output, strm.total_out));
 
     if (size_out)
@@ -374,6 +626,97 @@ Byte* Decompress_Alloc_Core(
 }
 
 
+//
+//  Decompress_Into_Binary_Core: C
+//
+// Decompress onto the tail of a BINARY!, so a caller can reuse one buffer's
+// spare capacity over many payloads (instead of allocating per payload and
+// then copying the result somewhere).
+//
+// If a size_hint is given then that much room is made up front, and if it is
+// right no reallocation happens at all.  Otherwise the room grows at least
+// geometrically, so the bytes are re-copied a bounded number of times.
+//
+// Returns the number of bytes added.
+//
+Size Decompress_Into_Binary_Core(
+    Binary(*) bin,
+    const void *input,
+    Size size_in,
+    REBINT max,  // -1 for no limit, else maximum number of bytes to add
+    REBINT size_hint,  // -1 if unknown
+    enum Reb_Symbol_Id envelope  // SYM_NONE, SYM_ZLIB, SYM_GZIP, or SYM_DETECT
+){
+    z_stream strm;
+    strm.zalloc = &zalloc;  // fail() cleans up automatically, see notes
+    strm.zfree = &zfree;
+    strm.opaque = nullptr;  // passed to zalloc/zfree, not needed currently
+    strm.total_out = 0;
+
+    strm.avail_in = size_in;
+    strm.next_in = cast(const z_Bytef*, input);
+
+    int ret_init = inflateInit2(&strm, Inflate_Window_Bits(envelope));
+    if (ret_init != Z_OK)
+        fail (Error_Compression(&strm, ret_init));
+
+    Size room;
+    if (size_hint >= 0)
+        room = size_hint;
+    else if (envelope == SYM_GZIP and size_in >= 18 and size_in < 4161808)
+        room = Bytes_To_U32_BE(  // see notes in Decompress_Alloc_Core()
+            cast(const Byte*, input) + size_in - sizeof(uint32_t)
+        );
+    else
+        room = size_in * 3;
+
+    if (max >= 0 and room > cast(Size, max))
+        room = max;
+    if (room == 0)
+        room = 64;  // inflate() can't make progress with no output space
+
+    Size base = BIN_LEN(bin);
+    Extend_Series_If_Necessary(bin, room);  // leaves the length alone
+
+    strm.next_out = BIN_AT(bin, base);
+    strm.avail_out = room;
+
+    while (true) {
+        int ret_inflate = inflate(&strm, Z_NO_FLUSH);
+
+        if (ret_inflate == Z_STREAM_END)
+            break;
+
+        if (ret_inflate != Z_OK and ret_inflate != Z_BUF_ERROR)
+            fail (Error_Compression(&strm, ret_inflate));
+
+        if (strm.avail_out != 0)  // it had room but wanted more input
+            fail (Error_Compression(&strm, Z_BUF_ERROR));  // truncated
+
+        if (max >= 0 and room >= cast(Size, max)) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, max);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+
+        Size more = MAX(room, strm.avail_in * 3);
+        if (max >= 0 and room + more > cast(Size, max))
+            more = max - room;
+
+        Extend_Series_If_Necessary(bin, room + more);
+        strm.next_out = BIN_AT(bin, base + room);  // data may have moved
+        strm.avail_out = more;
+        room += more;
+    }
+
+    Size added = strm.total_out;
+    TERM_BIN_LEN(bin, base + added);
+
+    inflateEnd(&strm);  // done last (so strm variables can be read up to end)
+    return added;
+}
+
+
 //
 //  checksum-core: native [
 //
@@ -387,6 +730,8 @@ Byte* Decompress_Alloc_Core(
 //          [binary! text!]
 //      /part "Length of data"
 //          [any-value!]
+//      /prior "Result for the data before this, to checksum in chunks"
+//          [binary!]
 //  ]
 //
 DECLARE_NATIVE(checksum_core)
@@ -409,10 +754,21 @@ DECLARE_NATIVE(checksum_core)
     Size size;
     const Byte* data = VAL_BYTES_LIMIT_AT(&size, ARG(data), len);
 
+    uLong prior = 0;  // same little endian format as the result
+    if (REF(prior)) {
+        Size prior_size;
+        const Byte* pp = VAL_BINARY_SIZE_AT(&prior_size, ARG(prior));
+        if (prior_size != 4)
+            fail (PARAM(prior));
+        int i;
+        for (i = 3; i >= 0; --i)
+            prior = (prior << 8) | pp[i];
+    }
+
     uLong crc;  // Note: zlib.h defines "crc32" as "z_crc32"
     switch (VAL_WORD_ID(ARG(method))) {
       case SYM_CRC32:
-        crc = crc32_z(0L, data, size);
+        crc = crc32_z(prior, data, size);
         break;
 
       case SYM_ADLER32:
@@ -421,7 +777,7 @@ DECLARE_NATIVE(checksum_core)
         // "At the beginning [of Adler-32], A is initialized to 1, B to 0"
         // A is the low 16-bits, B is the high.  Hence start with 1L.
         //
-        crc = z_adler32(1L, data, size);
+        crc = z_adler32(REF(prior) ? prior : 1L, data, size);
         break;
 
       default:
@@ -461,6 +817,7 @@ DECLARE_NATIVE(checksum_core)
 //          [any-value!]
 //      /envelope "ZLIB (adler32, no size) or GZIP (crc32, uncompressed size)"
 //          [word!]
+//      /parallel "Compress big data in chunks on multiple threads, if built"
 //  ]
 //
 DECLARE_NATIVE(deflate)
@@ -488,12 +845,21 @@ DECLARE_NATIVE(deflate)
     }
 
     size_t compressed_size;
-    void *compressed = Compress_Alloc_Core(
-        &compressed_size,
-        bp,
-        size,
-        envelope
-    );
+    void *compressed;
+    if (REF(parallel))
+        compressed = Compress_Parallel_Alloc_Core(
+            &compressed_size,
+            bp,
+            size,
+            envelope
+        );
+    else
+        compressed = Compress_Alloc_Core(
+            &compressed_size,
+            bp,
+            size,
+            envelope
+        );
 
     return rebRepossess(compressed, compressed_size);
 }
@@ -512,6 +878,10 @@ DECLARE_NATIVE(deflate)
 //          [integer!]
 //      /envelope "ZLIB, GZIP, or DETECT (http://stackoverflow.com/a/9213826)"
 //          [word!]
+//      /size-hint "Expected decompressed size, to make room for it up front"
+//          [integer!]
+//      /into "Append the result to this BINARY! (reusing its spare capacity)"
+//          [binary!]
 //  ]
 //
 DECLARE_NATIVE(inflate)
@@ -564,14 +934,238 @@ DECLARE_NATIVE(inflate)
         }
     }
 
-    size_t decompressed_size;
-    void *decompressed = Decompress_Alloc_Core(
-        &decompressed_size,
-        data,
-        size,
-        max,
-        envelope
+    REBINT size_hint;
+    if (REF(size_hint)) {
+        size_hint = Int32s(ARG(size_hint), 0);
+        if (size_hint < 0)
+            fail (PARAM(size_hint));
+    }
+    else
+        size_hint = -1;
+
+    if (REF(into)) {
+        Binary(*) bin = BIN(VAL_SERIES_ENSURE_MUTABLE(ARG(into)));
+        if (
+            IS_BINARY(ARG(data))
+            and VAL_SERIES(ARG(data)) == bin  // growing would move the input
+        ){
+            fail (PARAM(into));
+        }
+        Decompress_Into_Binary_Core(bin, data, size, max, size_hint, envelope);
+        return COPY(ARG(into));
+    }
+
+    if (size_hint < 0) {  // the Alloc routine has its own size guessing
+        size_t decompressed_size;
+        void *decompressed = Decompress_Alloc_Core(
+            &decompressed_size,
+            data,
+            size,
+            max,
+            envelope
+        );
+
+        return rebRepossess(decompressed, decompressed_size);
+    }
+
+    Binary(*) bin = Make_Binary(size_hint);
+    Decompress_Into_Binary_Core(bin, data, size, max, size_hint, envelope);
+    return Init_Binary(OUT, bin);
+}
+
+
+// Streaming state outlives the native call that creates it, so it can't use
+// rebMalloc()'d memory (which is tied to the frame failing).  The z_stream
+// is allocated with the core's allocator and zlib uses its own default
+// malloc()-based zalloc/zfree.  The HANDLE!'s cleaner frees it all.
+//
+struct Reb_Zlib_Stream {
+    z_stream strm;
+    bool inflating;
+    bool finished;
+};
+
+static void cleanup_zlib_stream(const REBVAL *v)
+{
+    struct Reb_Zlib_Stream *z = VAL_HANDLE_POINTER(struct Reb_Zlib_Stream, v);
+    if (z->inflating)
+        inflateEnd(&z->strm);
+    else
+        deflateEnd(&z->strm);
+    FREE(struct Reb_Zlib_Stream, z);
+}
+
+
+//
+//  zlib-stream: native [
+//
+//  "Make a stream for chunked DEFLATE or INFLATE, to be used with ZLIB-FEED"
+//
+//      return: [handle!]
+//      mode "DEFLATE or INFLATE"
+//          [word!]
+//      /envelope "ZLIB, GZIP, or DETECT (DETECT for INFLATE only)"
+//          [word!]
+//  ]
+//
+DECLARE_NATIVE(zlib_stream)
+{
+    INCLUDE_PARAMS_OF_ZLIB_STREAM;
+
+    bool inflating;
+    switch (VAL_WORD_ID(ARG(mode))) {
+      case SYM_DEFLATE:
+        inflating = false;
+        break;
+
+      case SYM_INFLATE:
+        inflating = true;
+        break;
+
+      default:
+        fail (PARAM(mode));
+    }
+
+    int window_bits = window_bits_zlib_raw;
+    if (REF(envelope)) {
+        switch (VAL_WORD_ID(ARG(envelope))) {
+          case SYM_ZLIB:
+            window_bits = window_bits_zlib;
+            break;
+
+          case SYM_GZIP:
+            window_bits = window_bits_gzip;
+            break;
+
+          case SYM_DETECT:
+            if (not inflating)
+                fail (PARAM(envelope));
+            window_bits = window_bits_detect_zlib_gzip;
+            break;
+
+          default:
+            fail (PARAM(envelope));
+        }
+    }
+
+    struct Reb_Zlib_Stream *z = TRY_ALLOC(struct Reb_Zlib_Stream);
+    if (z == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Zlib_Stream)));
+
+    z->strm.zalloc = Z_NULL;  // zlib defaults, see notes on the struct
+    z->strm.zfree = Z_NULL;
+    z->strm.opaque = Z_NULL;
+    z->strm.next_in = Z_NULL;
+    z->strm.avail_in = 0;
+    z->inflating = inflating;
+    z->finished = false;
+
+    int ret;
+    if (inflating)
+        ret = inflateInit2(&z->strm, window_bits);
+    else
+        ret = deflateInit2(
+            &z->strm,
+            Z_DEFAULT_COMPRESSION,
+            Z_DEFLATED,
+            window_bits,
+            8,
+            Z_DEFAULT_STRATEGY
+        );
+
+    if (ret != Z_OK) {
+        DECLARE_LOCAL (arg);
+        Init_Integer(arg, ret);
+        FREE(struct Reb_Zlib_Stream, z);
+        fail (Error_Bad_Compression_Raw(arg));
+    }
+
+    return Init_Handle_Cdata_Managed(
+        OUT,
+        z,
+        sizeof(struct Reb_Zlib_Stream),
+        &cleanup_zlib_stream
     );
+}
+
+
+//
+//  zlib-feed: native [
+//
+//  "Push a chunk through a ZLIB-STREAM, returning whatever output is ready"
+//
+//      return: "May be empty if the stream is buffering input"
+//          [binary!]
+//      stream [handle!]
+//      data "If text, it will be UTF-8 encoded"
+//          [binary! text!]
+//      /finish "Signal end of input (DEFLATE flushes, INFLATE checks end)"
+//  ]
+//
+DECLARE_NATIVE(zlib_feed)
+//
+// Output is accumulated in a rebMalloc()'d buffer which is rebRepossess()'d
+// as the BINARY! result, so a fail() mid-chunk won't leak it.  The buffer
+// starts at a guess and is doubled when zlib fills it.
+{
+    INCLUDE_PARAMS_OF_ZLIB_FEED;
+
+    if (VAL_HANDLE_CLEANER(ARG(stream)) != &cleanup_zlib_stream)
+        fail (PARAM(stream));
+
+    struct Reb_Zlib_Stream *z = VAL_HANDLE_POINTER(
+        struct Reb_Zlib_Stream, ARG(stream)
+    );
+    if (z->finished)
+        fail ("ZLIB-FEED called on a stream that has already finished");
+
+    Size size_in;
+    const Byte* input = VAL_BYTES_AT(&size_in, ARG(data));
+
+    z_stream *strm = &z->strm;
+    strm->next_in = cast(const z_Bytef*, input);
+    strm->avail_in = size_in;
+
+    int flush = REF(finish) ? Z_FINISH : Z_NO_FLUSH;
+
+    Size buf_size = z->inflating ? size_in * 3 : size_in / 2;
+    if (buf_size < 4096)
+        buf_size = 4096;
+
+    Byte* output = rebAllocN(Byte, buf_size);
+    strm->next_out = output;
+    strm->avail_out = buf_size;
+
+    while (true) {
+        int ret = z->inflating ? inflate(strm, flush) : deflate(strm, flush);
+
+        if (ret == Z_STREAM_END) {
+            z->finished = true;
+            break;
+        }
+
+        if (ret != Z_OK and ret != Z_BUF_ERROR)
+            fail (Error_Compression(strm, ret));
+
+        if (strm->avail_out == 0) {  // out of room, there may be more to go
+            Size used = buf_size;
+            buf_size *= 2;
+            output = cast(Byte*, rebRealloc(output, buf_size));
+            strm->next_out = output + used;
+            strm->avail_out = buf_size - used;
+            continue;
+        }
+
+        // Room was left over, so zlib consumed all the input it could.  If
+        // the input is being finished that should have been Z_STREAM_END.
+        //
+        if (REF(finish))
+            fail (Error_Compression(strm, Z_BUF_ERROR));  // truncated
+        break;
+    }
+
+    strm->next_in = Z_NULL;  // don't hold onto data from this call
+    strm->avail_in = 0;
 
-    return rebRepossess(decompressed, decompressed_size);
+    return rebRepossess(output, buf_size - strm->avail_out);
 }
@@ -0,0 +1,359 @@
+//
+//  File: %u-lz4.c
+//  Summary: "LZ4 block compression"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// LZ4 trades compression ratio for speed: it has no entropy coding stage,
+// just literal runs and back-references, so both directions run at memory
+// bandwidth rather than the few tens of MB/s of zlib.  That makes it a good
+// fit for serialized data that is saved and loaded often.
+//
+// This is a small implementation of the LZ4 *block* format, not a wrapper of
+// the reference library:
+//
+// https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+//
+// The block format does not record the decompressed size, so the BINARY!
+// produced by LZ4 starts with that size as a 4-byte little-endian integer.
+// (This is the same convention as the `store_size` option of Python's
+// `lz4.block` module, so such data interoperates.)
+//
+// The compressor is the simple greedy one: a hash table of the last position
+// where each 4-byte sequence was seen, with no lazy matching.  Output is
+// standard, so a better compressor could be swapped in later without
+// changing the decoder.
+//
+// !!! Zstandard would be the other obvious choice, but it is a large library
+// that would have to be brought into the tree as an extension.
+//
+
+#include "sys-core.h"
+
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5  // spec: last 5 bytes are always literals
+#define LZ4_MF_LIMIT 12  // spec: last match must start 12 bytes before end
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_BITS 12
+
+#define LZ4_SIZE_HEADER 4
+
+
+inline static uint32_t Read_U32(const Byte* bp) {
+    uint32_t u;
+    memcpy(&u, bp, sizeof(u));
+    return u;
+}
+
+inline static uint32_t Lz4_Hash(uint32_t sequence)
+  { return (sequence * 2654435761U) >> (32 - LZ4_HASH_BITS); }
+
+
+// Write a length that didn't fit in a 4-bit token nibble (the nibble is 15)
+// as a run of 255 bytes and a final byte less than 255.
+//
+inline static Byte* Write_Lz4_Length(Byte* op, Size len) {
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = cast(Byte, len);
+    return op;
+}
+
+static Byte* Write_Lz4_Literals(
+    Byte* op,
+    Byte* token,
+    const Byte* literals,
+    Size num_literals
+){
+    if (num_literals >= 15) {
+        *token = 15 << 4;
+        op = Write_Lz4_Length(op, num_literals - 15);
+    }
+    else
+        *token = cast(Byte, num_literals << 4);
+
+    memcpy(op, literals, num_literals);
+    return op + num_literals;
+}
+
+
+//
+//  Compress_Lz4_Alloc: C
+//
+// Returns rebMalloc()'d data, so it can be rebRepossess()'d as a BINARY!.
+//
+Byte* Compress_Lz4_Alloc(Size* size_out, const Byte* input, Size size_in)
+{
+    if (size_in > UINT32_MAX) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, UINT32_MAX);
+        fail (Error_Size_Limit_Raw(temp));
+    }
+
+    // Worst case is all literals: one extension byte per 255 of them.
+    //
+    Size bound = LZ4_SIZE_HEADER + size_in + (size_in / 255) + 16;
+    Byte* output = rebAllocN(Byte, bound);
+
+    Byte* op = output;
+    *op++ = cast(Byte, size_in);
+    *op++ = cast(Byte, size_in >> 8);
+    *op++ = cast(Byte, size_in >> 16);
+    *op++ = cast(Byte, size_in >> 24);
+
+    const Byte* anchor = input;  // start of pending literals
+
+    if (size_in > LZ4_MF_LIMIT) {
+        uint32_t table[1 << LZ4_HASH_BITS];
+        memset(table, 0, sizeof(table));
+
+        const Byte* ip = input + 1;  // position 0 is the table's "empty"
+        const Byte* match_limit = input + size_in - LZ4_MF_LIMIT;
+        const Byte* match_end = input + size_in - LZ4_LAST_LITERALS;
+
+        while (ip < match_limit) {
+            uint32_t sequence = Read_U32(ip);
+            uint32_t* slot = &table[Lz4_Hash(sequence)];
+            const Byte* ref = input + *slot;
+            *slot = cast(uint32_t, ip - input);
+
+            if (
+                ref == input  // empty slot (or position 0, never used)
+                or ip - ref > LZ4_MAX_OFFSET
+                or Read_U32(ref) != sequence
+            ){
+                ++ip;
+                continue;
+            }
+
+            const Byte* mp = ip + LZ4_MIN_MATCH;
+            const Byte* rp = ref + LZ4_MIN_MATCH;
+            while (mp < match_end and *mp == *rp) {
+                ++mp;
+                ++rp;
+            }
+
+            Byte* token = op++;
+            op = Write_Lz4_Literals(op, token, anchor, ip - anchor);
+
+            Size offset = ip - ref;
+            *op++ = cast(Byte, offset);
+            *op++ = cast(Byte, offset >> 8);
+
+            Size match_len = (mp - ip) - LZ4_MIN_MATCH;
+            if (match_len >= 15) {
+                *token |= 15;
+                op = Write_Lz4_Length(op, match_len - 15);
+            }
+            else
+                *token |= cast(Byte, match_len);
+
+            ip = mp;
+            anchor = ip;
+        }
+    }
+
+    Byte* token = op++;
+    op = Write_Lz4_Literals(op, token, anchor, input + size_in - anchor);
+
+    assert(cast(Size, op - output) <= bound);
+    *size_out = op - output;
+    return output;
+}
+
+
+static Context(*) Error_Bad_Lz4(const char* why) {
+    DECLARE_LOCAL (arg);
+    Init_Text(arg, Make_String_UTF8(why));
+    return Error_Bad_Compression_Raw(arg);
+}
+
+
+//
+//  Decompress_Lz4_Alloc: C
+//
+// All lengths and offsets in the data are checked against the buffers, so
+// corrupt or hostile input fails instead of reading or writing out of range.
+//
+Byte* Decompress_Lz4_Alloc(
+    Size* size_out,
+    const Byte* input,
+    Size size_in,
+    REBINT max  // -1 for no limit
+){
+    if (size_in < LZ4_SIZE_HEADER + 1)
+        fail (Error_Bad_Lz4("LZ4 data too short"));
+
+    Size size = cast(Size, input[0])
+        | (cast(Size, input[1]) << 8)
+        | (cast(Size, input[2]) << 16)
+        | (cast(Size, input[3]) << 24);
+
+    if (max >= 0 and size > cast(Size, max)) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, max);
+        fail (Error_Size_Limit_Raw(temp));
+    }
+
+    Byte* output = rebAllocN(Byte, size);
+    Byte* op = output;
+    Byte* op_end = output + size;
+
+    const Byte* ip = input + LZ4_SIZE_HEADER;
+    const Byte* ip_end = input + size_in;
+
+    while (true) {
+        if (ip >= ip_end)
+            fail (Error_Bad_Lz4("LZ4 data truncated"));
+
+        Byte token = *ip++;
+
+        Size len = token >> 4;
+        if (len == 15) {
+            Byte b;
+            do {
+                if (ip >= ip_end)
+                    fail (Error_Bad_Lz4("LZ4 data truncated"));
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+
+        if (len > cast(Size, ip_end - ip) or len > cast(Size, op_end - op))
+            fail (Error_Bad_Lz4("LZ4 literal run out of range"));
+        memcpy(op, ip, len);
+        ip += len;
+        op += len;
+
+        if (ip == ip_end)
+            break;  // the last sequence is literals only
+
+        if (ip_end - ip < 2)
+            fail (Error_Bad_Lz4("LZ4 data truncated"));
+        Size offset = cast(Size, ip[0]) | (cast(Size, ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 or offset > cast(Size, op - output))
+            fail (Error_Bad_Lz4("LZ4 match offset out of range"));
+
+        len = token & 15;
+        if (len == 15) {
+            Byte b;
+            do {
+                if (ip >= ip_end)
+                    fail (Error_Bad_Lz4("LZ4 data truncated"));
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += LZ4_MIN_MATCH;
+
+        if (len > cast(Size, op_end - op))
+            fail (Error_Bad_Lz4("LZ4 match length out of range"));
+
+        // Matches may overlap their own output (e.g. offset 1 repeats one
+        // byte), so only use memcpy() when the regions are disjoint.
+        //
+        const Byte* ref = op - offset;
+        if (offset >= len)
+            memcpy(op, ref, len);
+        else {
+            Size n;
+            for (n = 0; n < len; ++n)
+                op[n] = ref[n];
+        }
+        op += len;
+    }
+
+    if (op != op_end)
+        fail (Error_Bad_Lz4("LZ4 data shorter than its stored size"));
+
+    *size_out = size;
+    return output;
+}
+
+
+//
+//  lz4: native [
+//
+//  "Compress data using LZ4: https://en.wikipedia.org/wiki/LZ4_(compression_algorithm)"
+//
+//      return: "LZ4 block, prefixed with 4-byte little-endian original size"
+//          [binary!]
+//      data "If text, it will be UTF-8 encoded"
+//          [binary! text!]
+//      /part "Length of data (elements)"
+//          [any-value!]
+//  ]
+//
+DECLARE_NATIVE(lz4)
+{
+    INCLUDE_PARAMS_OF_LZ4;
+
+    REBLEN limit = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+
+    Size size;
+    const Byte* bp = VAL_BYTES_LIMIT_AT(&size, ARG(data), limit);
+
+    Size compressed_size;
+    Byte* compressed = Compress_Lz4_Alloc(&compressed_size, bp, size);
+
+    return rebRepossess(compressed, compressed_size);
+}
+
+
+//
+//  unlz4: native [
+//
+//  "Decompress data made by LZ4"
+//
+//      return: [binary!]
+//      data [binary!]
+//      /part "Length of compressed data"
+//          [any-value!]
+//      /max "Error out if result is larger than this"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(unlz4)
+{
+    INCLUDE_PARAMS_OF_UNLZ4;
+
+    REBINT max;
+    if (REF(max)) {
+        max = Int32s(ARG(max), 1);
+        if (max < 0)
+            fail (PARAM(max));
+    }
+    else
+        max = -1;
+
+    Size size = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+    const Byte* data = VAL_BINARY_AT(ARG(data));
+
+    Size decompressed_size;
+    Byte* decompressed = Decompress_Lz4_Alloc(
+        &decompressed_size,
+        data,
+        size,
+        max
+    );
+
+    return rebRepossess(decompressed, decompressed_size);
+}
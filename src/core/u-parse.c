@@ -70,6 +70,8 @@
 
 #include "sys-core.h"
 
+#include <time.h>  // clock() for PARSE3*/PROFILE
+
 
 // !!! R3-Alpha would frequently conflate indexes and flags, which could be
 // confusing in the evaluator and led to many THROWN values being overlooked.
@@ -107,6 +109,8 @@
     USED(ARG(input)); \
     USED(ARG(flags)); \
     USED(ARG(collection)); \
+    USED(ARG(memo)); \
+    USED(ARG(profile)); \
     USED(ARG(num_quotes)); \
     USED(ARG(position)); \
     USED(ARG(save))
@@ -129,6 +133,18 @@
         : VAL_ARRAY_KNOWN_MUTABLE(ARG(collection)) \
     )
 
+#define P_MEMO \
+    (Is_Nulled(ARG(memo)) \
+        ? cast(Binary(*), nullptr) \
+        : BIN(VAL_SERIES_KNOWN_MUTABLE(ARG(memo))) \
+    )
+
+#define P_PROFILE \
+    (Is_Nulled(ARG(profile)) \
+        ? cast(Array(*), nullptr) \
+        : VAL_ARRAY_KNOWN_MUTABLE(ARG(profile)) \
+    )
+
 #define P_NUM_QUOTES        VAL_INT32(ARG(num_quotes))
 
 #define P_POS               VAL_INDEX_UNBOUNDED(ARG(position))
@@ -220,6 +236,29 @@ STATIC_ASSERT((int)AM_FIND_MATCH == (int)PF_FIND_MATCH);
 #define PF_STATE_MASK (~PF_FIND_MASK & ~PF_ONE_RULE & ~PF_REDBOL)
 
 
+// See Make_Parse_Memo() for PARSE3*/MEMO.  REBIXO results are stored, so
+// END_FLAG for a rule that didn't match.
+//
+#define PARSE_MEMO_MAX_SLOTS (1 << 16)
+
+struct Parse_Memo_Entry {
+    Array(const*) rule;  // nullptr if unused
+    REBLEN index;
+    REBSPC *specifier;
+    const REBSER *input;
+    REBLEN pos;
+    REBIXO result;
+};
+
+
+// See Parse_Profile_Row() for PARSE3*/PROFILE.  Hints are indices of rows in
+// a report block, so they may be stale and have to be checked before use.
+//
+#define PARSE_PROFILE_HINTS 256
+
+static REBLEN Parse_Profile_Hints[PARSE_PROFILE_HINTS];
+
+
 // In %words.r, the parse words are lined up in order so they can be quickly
 // filtered, skipping the need for a switch statement if something is not
 // a parse command.
@@ -255,6 +294,8 @@ static bool Subparse_Throws(
     REBSPC *input_specifier,
     Frame(*) f,
     option(Array(*)) collection,
+    option(Binary(*)) memo,
+    option(Array(*)) profile,
     Flags flags
 ){
     assert(ANY_SERIES_KIND(CELL_HEART(input)));
@@ -295,6 +336,16 @@ static bool Subparse_Throws(
         collect_tail = 0;
     }
 
+    if (memo)
+        Init_Binary(ARG(memo), unwrap(memo));
+    else
+        Init_Nulled(ARG(memo));
+
+    if (profile)
+        Init_Block(ARG(profile), unwrap(profile));
+    else
+        Init_Nulled(ARG(profile));
+
     // Locals in frame would be unset on entry if called by action dispatch.
     //
     Finalize_None(ARG(num_quotes));
@@ -424,6 +475,14 @@ static void Print_Parse_Index(Frame(*) frame_) {
 // Gets the value of a word (when not a command) or path.  Returns all other
 // values as-is.
 //
+// !!! Compiling rule blocks into a matcher program with the rule variables
+// resolved ahead of time has been requested.  Commands are already found by
+// symbol ID (see VAL_CMD()), and word lookups go through the virtual bind
+// cache.  But a compiled form can't hold onto the *values* of rule words:
+// there is no write barrier on variables, so nothing would notice a rule
+// like `digit: charset "01"` being set to something else between matches.
+// (Grammars commonly change their rules mid-parse in just that way.)
+//
 static Cell(const*) Get_Parse_Value(
     REBVAL *cell,  // storage for fetched values; must be GC protected
     Cell(const*) rule,
@@ -486,6 +545,183 @@ bool Process_Group_For_Parse_Throws(
 }
 
 
+//
+//  Make_Parse_Memo: C
+//
+// PARSE3*/MEMO keeps a "packrat" table of what each BLOCK! rule matched at
+// each input position, so backtracking grammars don't match the same rule at
+// the same place over and over.  The table is a BINARY! of slots that new
+// results overwrite, so memory is bounded (a lost result just gets matched
+// again).  It's sized from the input, up to PARSE_MEMO_MAX_SLOTS.
+//
+// The pointers in it don't keep anything alive.  With /MEMO the caller
+// promises the rules don't have side effects or get changed during the
+// parse--so all the rules and input stay reachable from the grammar.
+//
+static Binary(*) Make_Parse_Memo(REBLEN input_len)
+{
+    REBLEN slots = 256;
+    while (slots < input_len * 4 and slots < PARSE_MEMO_MAX_SLOTS)
+        slots *= 2;
+
+    Size size = sizeof(struct Parse_Memo_Entry) * slots;
+    Binary(*) bin = Make_Binary(size);
+    memset(BIN_HEAD(bin), 0, size);
+    TERM_BIN_LEN(bin, size);
+    return bin;
+}
+
+
+//
+//  Parse_Memo_Slot: C
+//
+// Get the slot for a BLOCK! rule at an input position.  Its `rule` is not
+// nullptr if it has the result already (see Make_Parse_Memo()).
+//
+static struct Parse_Memo_Entry *Parse_Memo_Slot(
+    Binary(*) memo,
+    Cell(const*) rule,
+    REBSPC *specifier,
+    const REBSER *input,
+    REBLEN pos
+){
+    Array(const*) a = VAL_ARRAY(rule);
+    REBLEN index = VAL_INDEX(rule);
+
+    uintptr_t bits = (
+        (cast(uintptr_t, a) >> 4) ^ (cast(uintptr_t, specifier) >> 4)
+            ^ (cast(uintptr_t, input) >> 4)
+    ) + (index * 31) + (pos * 131);
+    uint32_t hash = cast(uint32_t, bits ^ (bits >> 16)) * 2654435761u;
+
+    REBLEN slots = BIN_LEN(memo) / sizeof(struct Parse_Memo_Entry);
+    struct Parse_Memo_Entry *entry = cast(struct Parse_Memo_Entry*,
+        BIN_HEAD(memo)
+    ) + ((hash >> 8) & (slots - 1));
+
+    if (
+        entry->rule == a
+        and entry->index == index
+        and entry->specifier == specifier
+        and entry->input == input
+        and entry->pos == pos
+    ){
+        return entry;
+    }
+
+    entry->rule = nullptr;  // caller will fill in if it gets a result
+    return entry;
+}
+
+
+//
+//  Is_Parse_Profile_Row: C
+//
+static bool Is_Parse_Profile_Row(
+    Cell(const*) cell,
+    Array(const*) rules,
+    REBLEN index
+){
+    if (not IS_BLOCK(cell))
+        return false;
+
+    Array(const*) row = VAL_ARRAY(cell);
+    if (ARR_LEN(row) != 5)
+        return false;
+
+    Cell(const*) at = ARR_HEAD(row);
+    return (
+        IS_BLOCK(at)
+        and VAL_ARRAY(at) == rules
+        and VAL_INDEX_UNBOUNDED(at) == cast(REBIDX, index)
+        and IS_INTEGER(at + 1)
+        and IS_INTEGER(at + 2)
+        and IS_INTEGER(at + 3)
+        and IS_DECIMAL(at + 4)
+    );
+}
+
+
+//
+//  Parse_Profile_Row: C
+//
+// PARSE3*/PROFILE tallies each rule step--identified by its rules block at the
+// index of the step--into a row of the caller's report block:
+//
+//     [rule attempts successes backtracks seconds]
+//
+// A backtrack is a failure that throws away input matched by earlier steps in
+// its alternate, which tends to be where the time goes in a slow grammar.
+// Seconds include time spent in subrules, so they overlap between rows.
+//
+// Rows are appended to the report as steps are first seen, so passing the
+// same report to several parses accumulates their counts.
+//
+static Array(*) Parse_Profile_Row(
+    Array(*) report,
+    Array(const*) rules,
+    REBLEN index,
+    REBSPC *specifier
+){
+    uintptr_t bits = (cast(uintptr_t, rules) >> 4) + (index * 31);
+    REBLEN *hint = &Parse_Profile_Hints[
+        (cast(uint32_t, bits ^ (bits >> 16)) * 2654435761u)
+            % PARSE_PROFILE_HINTS
+    ];
+
+    if (
+        *hint < ARR_LEN(report)
+        and Is_Parse_Profile_Row(ARR_AT(report, *hint), rules, index)
+    ){
+        return VAL_ARRAY_ENSURE_MUTABLE(ARR_AT(report, *hint));
+    }
+
+    REBLEN n;
+    for (n = 0; n < ARR_LEN(report); ++n) {
+        if (Is_Parse_Profile_Row(ARR_AT(report, n), rules, index)) {
+            *hint = n;
+            return VAL_ARRAY_ENSURE_MUTABLE(ARR_AT(report, n));
+        }
+    }
+
+    Array(*) row = Make_Array(5);
+    Init_Array_Cell_At_Core(
+        Alloc_Tail_Array(row),
+        REB_BLOCK,
+        rules,
+        index,
+        specifier
+    );
+    Init_Integer(Alloc_Tail_Array(row), 0);
+    Init_Integer(Alloc_Tail_Array(row), 0);
+    Init_Integer(Alloc_Tail_Array(row), 0);
+    Init_Decimal(Alloc_Tail_Array(row), 0.0);
+
+    *hint = ARR_LEN(report);
+    Init_Block(Alloc_Tail_Array(report), row);
+    return row;
+}
+
+
+//
+//  Tally_Parse_Profile: C
+//
+static void Tally_Parse_Profile(
+    Array(*) row,
+    bool matched,
+    bool backtracked,
+    clock_t start
+){
+    Cell(*) at = ARR_HEAD(row);
+    VAL_INT64(at + 1) += 1;
+    if (matched)
+        VAL_INT64(at + 2) += 1;
+    else if (backtracked)
+        VAL_INT64(at + 3) += 1;
+    VAL_DECIMAL(at + 4) += cast(REBDEC, clock() - start) / CLOCKS_PER_SEC;
+}
+
+
 //
 //  Parse_One_Rule: C
 //
@@ -575,6 +811,19 @@ static REBIXO Parse_One_Rule(
         // value regarding whether a match occurred or not has to be based on
         // the result that comes back in OUT.
 
+        struct Parse_Memo_Entry *memo_entry = nullptr;
+        if (P_MEMO) {  // PARSE3*/MEMO, see Parse_Memo_Slot()
+            memo_entry = Parse_Memo_Slot(
+                P_MEMO,
+                rule,
+                Derive_Specifier(rule_specifier(), rule),
+                P_INPUT,
+                pos
+            );
+            if (memo_entry->rule != nullptr)
+                return memo_entry->result;
+        }
+
         REBLEN pos_before = P_POS;
         P_POS = pos;  // modify input position
 
@@ -592,22 +841,34 @@ static REBIXO Parse_One_Rule(
             SPECIFIED,
             subframe,
             P_COLLECTION,
+            P_MEMO,
+            P_PROFILE,
             (P_FLAGS & PF_FIND_MASK)
                 | (P_FLAGS & PF_REDBOL)
         )){
             return THROWN_FLAG;
         }
 
-        UNUSED(interrupted);  // !!! ignore "interrupted" (ACCEPT or REJECT?)
-
         P_POS = pos_before;  // restore input position
 
+        REBIXO result;
         if (Is_Nulled(subresult))
-            return END_FLAG;
+            result = END_FLAG;
+        else {
+            REBINT index = VAL_INT32(subresult);
+            assert(index >= 0);
+            result = index;
+        }
 
-        REBINT index = VAL_INT32(subresult);
-        assert(index >= 0);
-        return index; }
+        if (memo_entry and not interrupted) {  // ACCEPT/REJECT aren't pure
+            memo_entry->rule = VAL_ARRAY(rule);
+            memo_entry->index = VAL_INDEX(rule);
+            memo_entry->specifier = Derive_Specifier(rule_specifier(), rule);
+            memo_entry->input = P_INPUT;
+            memo_entry->pos = pos;
+            memo_entry->result = result;
+        }
+        return result; }
 
       default:;
         // Other cases handled distinctly between blocks/strings/binaries...
@@ -1210,6 +1471,10 @@ static void Handle_Seek_Rule_Dont_Update_Begin(
 //      flags [integer!]
 //      /collection "Array into which any KEEP values are collected"
 //          [any-series!]
+//      /memo "Table of BLOCK! rule results, see PARSE3*/MEMO"
+//          [binary!]
+//      /profile "Rows tallied by rule step, see PARSE3*/PROFILE"
+//          [block!]
 //      <local> position num-quotes save
 //  ]
 //
@@ -1320,6 +1585,9 @@ DECLARE_NATIVE(subparse)
     REBINT mincount = 1;  // min pattern count
     REBINT maxcount = 1;  // max pattern count
 
+    Array(*) profile_row = nullptr;  // set for each step if PARSE3*/PROFILE
+    clock_t profile_start = 0;
+
 
     //==////////////////////////////////////////////////////////////////==//
     //
@@ -1417,7 +1685,7 @@ DECLARE_NATIVE(subparse)
         ++Total_Eval_Cycles_Doublecheck;
       #endif
 
-        if (--Eval_Countdown <= 0) {
+        if (Eval_Step_Polls_Signals()) {
             if (Do_Signals_Throws(FRAME))
                 return THROWN;
         }
@@ -1675,6 +1943,8 @@ DECLARE_NATIVE(subparse)
                         SPECIFIED,
                         subframe,
                         P_COLLECTION,
+                        P_MEMO,
+                        P_PROFILE,
                         (P_FLAGS & PF_FIND_MASK) | PF_ONE_RULE
                             | (P_FLAGS & PF_REDBOL)
                     );
@@ -1947,6 +2217,8 @@ DECLARE_NATIVE(subparse)
                 SPECIFIED,
                 subframe,
                 collection,
+                P_MEMO,
+                P_PROFILE,
                 (P_FLAGS & PF_FIND_MASK) | PF_ONE_RULE
                     | (P_FLAGS & PF_REDBOL)
             );
@@ -2077,6 +2349,16 @@ DECLARE_NATIVE(subparse)
 
     begin = P_POS;  // input at beginning of match section
 
+    if (P_PROFILE) {  // PARSE3*/PROFILE, see Parse_Profile_Row()
+        profile_row = Parse_Profile_Row(
+            P_PROFILE,
+            FEED_ARRAY(f->feed),
+            FEED_INDEX(f->feed) - 1,  // fetched, so back up to the rule
+            P_RULE_SPECIFIER
+        );
+        profile_start = clock();  // last, so lookup isn't counted
+    }
+
     REBINT count;  // gotos would cross initialization
     count = 0;
     while (count < maxcount) {
@@ -2204,6 +2486,8 @@ DECLARE_NATIVE(subparse)
                     P_INPUT_SPECIFIER,  // harmless if specified API value
                     subframe,
                     P_COLLECTION,
+                    P_MEMO,
+                    P_PROFILE,
                     (P_FLAGS & PF_FIND_MASK)  // PF_ONE_RULE?
                         | (P_FLAGS & PF_REDBOL)
                 )){
@@ -2247,6 +2531,8 @@ DECLARE_NATIVE(subparse)
                 SPECIFIED,
                 subframe,
                 P_COLLECTION,
+                P_MEMO,
+                P_PROFILE,
                 (P_FLAGS & PF_FIND_MASK)  // no PF_ONE_RULE
                     | (P_FLAGS & PF_REDBOL)
             )){
@@ -2278,6 +2564,34 @@ DECLARE_NATIVE(subparse)
                 ? END_FLAG
                 : P_INPUT_LEN;
         }
+        else if (
+            IS_BITSET(rule)
+            and not IS_SER_ARRAY(P_INPUT)
+            and not Trace_Level
+            and P_POS < cast(REBIDX, P_INPUT_LEN)
+        ){
+            // Span as many matching characters as the count allows at once,
+            // instead of one Parse_One_Rule() per character.
+            //
+            bool is_str = (P_TYPE != REB_BINARY);
+            const Byte* at = is_str
+                ? cast(const Byte*, STR_AT(STR(P_INPUT), P_POS))
+                : BIN_AT(BIN(P_INPUT), P_POS);
+            REBLEN span = Span_Bitset(
+                at,
+                MIN(cast(REBLEN, maxcount - count), P_INPUT_LEN - P_POS),
+                is_str,
+                VAL_BITSET(rule),
+                is_str and not (P_FLAGS & AM_FIND_CASE),  // uncased
+                true  // span characters in the set
+            );
+            if (span == 0)
+                i = END_FLAG;
+            else {
+                count += span - 1;  // loop increments count for this match
+                i = P_POS + span;
+            }
+        }
         else {
             // Parse according to datatype
 
@@ -2328,6 +2642,16 @@ DECLARE_NATIVE(subparse)
         if (P_POS > cast(REBIDX, P_INPUT_LEN))
             Init_Nulled(ARG(position));  // not found
 
+    if (profile_row) {
+        Tally_Parse_Profile(
+            profile_row,
+            not Is_Nulled(ARG(position)),
+            begin > P_INPUT_IDX,  // alternate had matched input before this
+            profile_start
+        );
+        profile_row = nullptr;  // `goto handle_end` can bypass the lookup
+    }
+
 
     //==////////////////////////////////////////////////////////////////==//
     //
@@ -2641,6 +2965,9 @@ DECLARE_NATIVE(subparse)
 //      /case "Uses case-sensitive comparison"
 //      /fully "Require parse to reach end, see PARSE specialization"
 //      /redbol "Use Rebol2/Red-style rules vs. UPARSE-style rules"
+//      /memo "Remember BLOCK! rule matches by position (rules must be pure)"
+//      /profile "Add [rule attempts successes backtracks seconds] rows"
+//          [block!]
 //  ]
 //
 DECLARE_NATIVE(parse3_p)
@@ -2711,6 +3038,8 @@ DECLARE_NATIVE(parse3_p)
         input, SPECIFIED,
         subframe,
         nullptr,  // start out with no COLLECT in effect, so no P_COLLECTION
+        REF(memo) ? Make_Parse_Memo(VAL_LEN_AT(input)) : nullptr,
+        REF(profile) ? VAL_ARRAY_ENSURE_MUTABLE(ARG(profile)) : nullptr,
         (REF(case) ? AM_FIND_CASE : 0) | (REF(redbol) ? PF_REDBOL : 0)
         //
         // We always want "case-sensitivity" on binary bytes, vs. treating
@@ -41,6 +41,7 @@
 
 #include "sys-zlib.h"  /* REBOL: see make-zlib.r */
 #define local static
+unsigned long ZEXPORT crc32_z_portable(unsigned long, const unsigned char FAR *, z_size_t);  /* REBOL: see make-zlib.r */
 
 /* crc32.c -- compute the CRC-32 of a data stream
  * Copyright (C) 1995-2006, 2010, 2011, 2012, 2016 Mark Adler
@@ -683,7 +684,7 @@ const z_crc_t FAR * ZEXPORT get_crc_table()
 #define DO8 DO1; DO1; DO1; DO1; DO1; DO1; DO1; DO1
 
 /* ========================================================================= */
-unsigned long ZEXPORT crc32_z(
+unsigned long ZEXPORT crc32_z_portable(
     unsigned long crc,
     const unsigned char FAR *buf,
     z_size_t len)
@@ -323,6 +323,9 @@ enum {
     Copy_Values_Len_Extra_Shallow_Core((v), (s), (l), (e), 0)
 
 
+#define Copy_Array_Core_Managed(a,i,s,t,e,f,d) \
+    Copy_Array_Shared_Managed((a), (i), (s), (t), (e), (f), (d), false)
+
 #define Copy_Array_Shallow(a,s) \
     Copy_Array_At_Shallow((a), 0, (s))
 
@@ -397,11 +400,21 @@ inline static Array(const*) VAL_ARRAY(noquote(Cell(const*)) v) {
     return a;
 }
 
+// Code that gets mutable access to an array's cells could put bindable
+// values into it, so these accessors clear ARRAY_FLAG_NO_BINDABLES.
+//
+inline static Array(*) Mutable_Array_Maybe_Bindables(Array(const*) a) {
+    Array(*) m = m_cast(Array(*), a);
+    if (SER_FLAVOR(m) == FLAVOR_ARRAY)
+        Clear_Subclass_Flag(ARRAY, m, NO_BINDABLES);
+    return m;
+}
+
 #define VAL_ARRAY_ENSURE_MUTABLE(v) \
-    m_cast(Array(*), VAL_ARRAY(ENSURE_MUTABLE(v)))
+    Mutable_Array_Maybe_Bindables(VAL_ARRAY(ENSURE_MUTABLE(v)))
 
 #define VAL_ARRAY_KNOWN_MUTABLE(v) \
-    m_cast(Array(*), VAL_ARRAY(KNOWN_MUTABLE(v)))
+    Mutable_Array_Maybe_Bindables(VAL_ARRAY(KNOWN_MUTABLE(v)))
 
 
 // These array operations take the index position into account.  The use
@@ -449,11 +462,34 @@ inline static Cell(const*) VAL_ARRAY_ITEM_AT(noquote(Cell(const*)) v) {
 }
 
 
-#define VAL_ARRAY_AT_ENSURE_MUTABLE(tail_out,v) \
-    m_cast(Cell(*), VAL_ARRAY_AT((tail_out), ENSURE_MUTABLE(v)))
+inline static Cell(*) VAL_ARRAY_AT_ENSURE_MUTABLE(
+    option(Cell(const*)*) tail_out,
+    Cell(const*) v
+){
+    Mutable_Array_Maybe_Bindables(VAL_ARRAY(ENSURE_MUTABLE(v)));
+    return m_cast(Cell(*), VAL_ARRAY_AT(tail_out, v));
+}
 
-#define VAL_ARRAY_KNOWN_MUTABLE_AT(tail_out,v) \
-    m_cast(Cell(*), VAL_ARRAY_AT((tail_out), KNOWN_MUTABLE(v)))
+inline static Cell(*) VAL_ARRAY_KNOWN_MUTABLE_AT(
+    option(Cell(const*)*) tail_out,
+    Cell(const*) v
+){
+    Mutable_Array_Maybe_Bindables(VAL_ARRAY(KNOWN_MUTABLE(v)));
+    return m_cast(Cell(*), VAL_ARRAY_AT(tail_out, v));
+}
+
+
+// The scanner calls this on arrays it makes, see ARRAY_FLAG_NO_BINDABLES.
+//
+inline static void Flag_Array_If_No_Bindables(Array(*) a) {
+    Cell(const*) tail = ARR_TAIL(a);
+    Cell(const*) v = ARR_HEAD(a);
+    for (; v != tail; ++v) {
+        if (Is_Bindable(v))
+            return;
+    }
+    Set_Subclass_Flag(ARRAY, a, NO_BINDABLES);
+}
 
 
 // !!! R3-Alpha introduced concepts of immutable series with PROTECT, but
@@ -47,6 +47,45 @@ inline static void INIT_BITS_NOT(REBSER *s, bool negated)
   { s->misc.negated = negated; }
 
 
+//=//// SPARSE RANGES PAST THE DENSE BITS /////////////////////////////////=//
+//
+// A flat bit array has to be as big as the highest bit set, so a charset with
+// a few CJK blocks or a codepoint up at U+10FFFF costs up to 136K.  Hence the
+// BINARY! of a bitset is only grown to hold bits under BITSET_DENSE_MAX (a
+// 256 byte head covers ASCII, Latin, Greek, Cyrillic...)  Bits set past the
+// end of the binary go into a sorted list of inclusive [low high] ranges.
+//
+// The ranges are Codepoint pairs in a second byte series, in the LINK() of
+// the bitset.  They never overlap or touch, and never hold a bit that is in
+// the length of the binary.  So a bit is looked up in exactly one place:
+// the binary if it's in range, else a binary search of the ranges.
+//
+// Code that wants a bitset as flat bits (MOLD, TO BINARY!, comparison) uses
+// Flatten_Bitset() to get a copy.
+//
+
+#define BITSET_DENSE_MAX 0x800  // in bits, so 256 bytes
+
+#define LINK_BitsetRanges_TYPE      Binary(*)
+#define LINK_BitsetRanges_CAST      BIN
+#define HAS_LINK_BitsetRanges       FLAVOR_BINARY
+
+// The flag is what says the LINK() is in use, as binaries don't initialize
+// their LINK() (and Copy_Series_Core() doesn't copy flags).
+//
+inline static Binary(*) BITS_RANGES(const REBSER *s) {
+    if (NOT_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK))
+        return nullptr;
+    return LINK(BitsetRanges, s);
+}
+
+#define BITS_RANGES_HEAD(ranges) \
+    cast(Codepoint*, m_cast(Byte*, BIN_HEAD(ranges)))
+
+#define BITS_RANGES_COUNT(ranges) \
+    (BIN_LEN(ranges) / (2 * sizeof(Codepoint)))
+
+
 inline static Binary(*) VAL_BITSET(noquote(Cell(const*)) v) {
     assert(CELL_HEART(v) == REB_BITSET);
     return BIN(VAL_NODE1(v));
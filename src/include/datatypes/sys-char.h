@@ -197,6 +197,42 @@ inline static Codepoint UP_CASE(Codepoint c)
 inline static Codepoint LO_CASE(Codepoint c)
   { assert(c != '\0'); return c < UNICODE_CASES ? Lower_Cases[c] : c; }
 
+
+//=//// ASCII CASE CHANGES 8 BYTES AT A TIME //////////////////////////////=//
+//
+// Text is usually mostly ASCII, and the only case change for an ASCII byte
+// is flipping 0x20 on a letter.  So LOWERCASE and UPPERCASE, caseless string
+// compares, and caseless hashes all load 8 bytes into a uint64_t.  If none of
+// them have the high bit set, they are changed in one go by these functions.
+// Only the non-ASCII codepoints go through UP_CASE() and LO_CASE().
+//
+// Each byte is < 0x80, so adding to a byte can't carry into its neighbor.
+// After the additions, the high bit of each byte tells whether it was >= 'A'
+// and whether it was > 'Z'.  (None of this depends on the byte order.)
+//
+
+#define ASCII_HIGH_BITS_64  0x8080808080808080ULL
+#define ASCII_ONES_64  0x0101010101010101ULL
+
+inline static bool Is_Ascii_64(uint64_t w)
+  { return (w & ASCII_HIGH_BITS_64) == 0; }
+
+inline static uint64_t Lowercase_Ascii_64(uint64_t w) {
+    assert(Is_Ascii_64(w));
+    uint64_t at_least_A = w + (0x80 - 'A') * ASCII_ONES_64;
+    uint64_t above_Z = w + (0x7F - 'Z') * ASCII_ONES_64;
+    uint64_t is_upper = at_least_A & ~above_Z & ASCII_HIGH_BITS_64;
+    return w | (is_upper >> 2);  // 0x80 >> 2 is 0x20, the case bit
+}
+
+inline static uint64_t Uppercase_Ascii_64(uint64_t w) {
+    assert(Is_Ascii_64(w));
+    uint64_t at_least_a = w + (0x80 - 'a') * ASCII_ONES_64;
+    uint64_t above_z = w + (0x7F - 'z') * ASCII_ONES_64;
+    uint64_t is_lower = at_least_a & ~above_z & ASCII_HIGH_BITS_64;
+    return w & ~(is_lower >> 2);
+}
+
 inline static bool IS_WHITE(Codepoint c)
   { assert(c != '\0'); return c <= 32 and ((White_Chars[c] & 1) != 0); }
 
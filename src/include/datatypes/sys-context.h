@@ -107,6 +107,27 @@
     SERIES_FLAG_24
 
 
+//=//// KEYLIST_FLAG_INDEXED //////////////////////////////////////////////=//
+//
+// Finding a symbol in a context walks its keys, which adds up for module-like
+// records with hundreds of fields.  Once a keylist has KEYLIST_INDEX_MIN_KEYS
+// keys, the first lookup in it builds a hash index of the first position of
+// each symbol.  This flag says the index is in `misc.keylist_index`.
+//
+// The index belongs to the keylist, so every context sharing the keylist
+// shares it.  Append_Context_Core() keeps it up to date (an expansion that
+// has to copy a shared keylist gets a new keylist with no index yet), and
+// Decay_Series() frees it.
+//
+// The index is an array of uint32_t.  [0] is the number of slots (a power
+// of 2) and each slot after it is a 1-based key position, or 0 if empty.
+//
+#define KEYLIST_FLAG_INDEXED \
+    SERIES_FLAG_25
+
+#define KEYLIST_INDEX_MIN_KEYS 32
+
+
 // Context(*) properties (note: shares BONUS_KEYSOURCE() with Action(*))
 //
 // Note: MODULE! contexts depend on a property stored in the META field, which
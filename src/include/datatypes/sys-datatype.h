@@ -115,6 +115,13 @@ extern const REBU64 Typesets[];
 //
 extern CFUNC* Builtin_Type_Hooks[REB_MAX][IDX_HOOKS_MAX];
 
+// Also generated from %types.r, with %verb-hooks.r.  For the few verbs that
+// are hot enough to matter (e.g. PICK* and POKE*), a type's class may give a
+// function that handles just that verb, called without its REBTYPE().
+//
+extern const SymId Verb_Hook_Syms[VERB_HOOK_MAX];
+extern GENERIC_HOOK* const Builtin_Verb_Hooks[REB_MAX][VERB_HOOK_MAX];
+
 
 // The datatype only knows a symbol.  Have to look that symbol up to get the
 // list of hooks registered by the extension providing the custom type.
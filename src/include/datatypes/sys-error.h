@@ -45,11 +45,27 @@
     Init_Context_Cell((v), REB_ERROR, (c))
 
 inline static void Force_Location_Of_Error(Context(*) error, Frame(*) where) {
+    Finish_Lazy_Location_Of_Error(error);
+
     ERROR_VARS *vars = ERR_VARS(error);
     if (Is_Nulled(&vars->where))
         Set_Location_Of_Error(error, where);
 }
 
+// Definitional errors are often trapped and thrown away without being looked
+// at, so they only get the location information that costs nothing to take.
+// If they escape as an abrupt fail(), the rest is filled in then.
+//
+inline static void Lazy_Location_Of_Error(Context(*) error, Frame(*) where) {
+    ERROR_VARS *vars = ERR_VARS(error);
+    if (
+        Is_Nulled(&vars->where)
+        and Not_Subclass_Flag(VARLIST, CTX_VARLIST(error), ERROR_LOCATION_LAZY)
+    ){
+        Set_Lazy_Location_Of_Error(error, where);
+    }
+}
+
 
 // An isotopic ERROR! represents a thrown state.  This failure state can't be
 // stored in variables and will raise an alarm if something in a processing
@@ -67,7 +83,7 @@ inline static bool Is_Meta_Of_Raised(Cell(const*) v)
 
 inline static Value(*) Raisify(Cell(*) v) {
     assert(IS_ERROR(v) and QUOTE_BYTE(v) == UNQUOTED_1);
-    Force_Location_Of_Error(VAL_CONTEXT(v), TOP_FRAME);  // ideally already set
+    Lazy_Location_Of_Error(VAL_CONTEXT(v), TOP_FRAME);  // ideally already set
     mutable_QUOTE_BYTE(v) = ISOTOPE_0;
     return VAL(v);
 }
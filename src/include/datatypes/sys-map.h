@@ -21,12 +21,14 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // Maps are implemented as a light hashing layer on top of an array.  The
-// hash indices are stored in the series node's "misc", while the values are
-// retained in pairs as `[key val key val key val ...]`.
+// hash indices are stored in the series node's "link", while the values are
+// retained in pairs as `[key val key val key val ...]`.  New keys go at the
+// end of the pairlist (or into a record freed by a removal), and the hash
+// indices only ever refer to records...so enumeration is in record order.
 //
 // When there are too few values to warrant hashing, no hash indices are
 // made and the array is searched linearly.  This is indicated by the hashlist
-// being NULL.
+// being NULL.  (See MAP_MAX_LINEAR in %t-map.c.)
 //
 // Though maps are not considered a series in the "ANY-SERIES!" value sense,
 // they are implemented using series--and hence are in %sys-series.h, at least
@@ -64,6 +66,55 @@ inline static Array(*) MAP_PAIRLIST(const_if_c REBMAP *map)
     SER_HEAD(MAP_HASHLIST(m))
 
 
+// Hashlists are used both by maps and set operations (see Hash_Block()).
+// Each slot holds two REBLENs: a 1-based index of the record in the array
+// (0 if the slot is empty), and the Hash_Value() of that record's key.
+// Checking the stored hash rejects most probe collisions without needing a
+// Cmp_Value(), and growing a map can reinsert keys without rehashing them.
+//
+// The stored hash is only meaningful for slots with a nonzero index.
+//
+#define HASHLIST_INDEX(indexes,slot) \
+    (indexes)[(slot) * 2]
+
+#define HASHLIST_HASH(indexes,slot) \
+    (indexes)[(slot) * 2 + 1]
+
+// The slots are preceded by a small header of REBLENs, which maps use to
+// track their removed keys and rehashing progress (see %t-map.c):
+//
+// * A "zombie" is a record whose value is void, where the key was removed
+//   but the record is still indexed by a slot.  A later insert whose probe
+//   passes through the zombie's slot can reuse it.
+//
+// * A "hole" is a zombie that was dropped from the index when the table
+//   was rebuilt.  Holes are chained through their key cells (as INTEGER!s)
+//   so new keys can fill them instead of growing the pairlist.
+//
+#define HASHLIST_NUM_ZOMBIES    0
+#define HASHLIST_NUM_HOLES      1
+#define HASHLIST_FIRST_HOLE     2  // 1-based record index, 0 if no holes
+#define HASHLIST_NUM_MIGRATED   3  // slots moved out of an Unmigrated table
+#define HASHLIST_HEADER_LEN     4
+
+inline static REBLEN *Hashlist_Header(const_if_c REBSER *hashlist)
+  { return SER_HEAD(REBLEN, hashlist); }
+
+inline static REBLEN *Hashlist_Slots(const_if_c REBSER *hashlist)
+  { return SER_AT(REBLEN, hashlist, HASHLIST_HEADER_LEN); }
+
+inline static REBLEN Hashlist_Num_Slots(const REBSER *hashlist)
+  { return (SER_USED(hashlist) - HASHLIST_HEADER_LEN) / 2; }
+
+// A map's hashlist is replaced by a larger (or zombie-free) one a few slots
+// at a time.  While that is happening, the table being replaced is linked
+// from the new one.
+//
+#define LINK_Unmigrated_TYPE        REBSER*
+#define LINK_Unmigrated_CAST        SER
+#define HAS_LINK_Unmigrated         FLAVOR_HASHLIST
+
+
 inline static const REBMAP *VAL_MAP(noquote(Cell(const*)) v) {
     assert(CELL_HEART(v) == REB_MAP);
 
@@ -87,7 +138,7 @@ inline static REBLEN Length_Map(const REBMAP *map)
 
     REBLEN count = 0;
     for (; v != tail; v += 2) {
-        if (not Is_Nulled(v + 1))
+        if (not Is_Void(v + 1))  // void values are removed keys
             ++count;
     }
 
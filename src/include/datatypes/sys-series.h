@@ -1287,7 +1287,7 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN capacity) {
                 CLEAR_SERIES_FLAG(s, POWER_OF_2);
         }
 
-        s->content.dynamic.data = TRY_ALLOC_N(char, size);
+        s->content.dynamic.data = cast(char*, Try_Alloc_Big_Mem(size));
         if (not s->content.dynamic.data)
             return false;
 
@@ -1388,6 +1388,9 @@ inline static REBSER *Make_Series_Into(
         ] = s; // start out managed to not need to find/remove from this later
     }
 
+    if (Alloc_Sample_Countdown != 0 and --Alloc_Sample_Countdown == 0)
+        Sample_Alloc(s);  // see SAMPLE-ALLOCS
+
     return s;
 }
 
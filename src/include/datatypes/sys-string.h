@@ -37,7 +37,8 @@
 //
 // * Maintaining caches (called "Bookmarks") that map from codepoint indexes
 //   to byte offsets for larger strings.  These caches must be updated
-//   whenever the string is modified.   !!! Only one bookmark per string ATM
+//   whenever the string is modified.  There's one for the last position
+//   accessed, and long strings also get a table of checkpoints.
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
@@ -182,26 +183,29 @@ inline static Utf8(*) WRITE_CHR(Utf8(*) cp, Codepoint c) {
 //=//// STRING ALL-ASCII FLAG /////////////////////////////////////////////=//
 //
 // One of the best optimizations that can be done on strings is to keep track
-// of if they contain only ASCII codepoints.  Such a flag would likely have
-// false negatives, unless all removals checked the removed portion for if
-// the ASCII flag is true.  It could be then refreshed by any routine that
-// walks an entire string for some other reason (like molding or printing).
+// of if they contain only ASCII codepoints, so that byte offsets are the
+// same as codepoint indexes and no bookmarks are needed.
 //
-// For the moment, we punt on this optimization.  The main reason is that it
-// means the non-ASCII code is exercised on every code path, which is a good
-// substitute for finding high-codepoint data to pass through to places that
-// would not receive it otherwise.
+// Non-symbol strings already keep their codepoint length cached alongside
+// their byte size, and every mutation must keep that length correct.  Since
+// each codepoint is at least one byte, the size equals the length exactly
+// when all of them are ASCII--so comparing the two acts as a flag that can't
+// go out of date, with no false negatives after removals.  Symbols are
+// immutable and don't cache their length, so they get SYMBOL_FLAG_ALL_ASCII
+// when interned instead.
 //
-// But ultimately this optimization will be necessary, and decisions on how
-// up-to-date the flag should be kept would need to be made.
+// Note that this means ASCII strings don't exercise the UTF-8 navigation
+// code.  Tests should use high-codepoint data to get coverage of it.
 
-#define Is_Definitely_Ascii(s) false
-
-inline static bool Is_String_Definitely_ASCII(String(const*) str) {
-    UNUSED(str);
-    return false;
+inline static bool Is_Definitely_Ascii(const Raw_String* s) {
+    if (IS_NONSYMBOL_STRING(s))
+        return SER_USED(s) == s->misc.length;  // each codepoint is 1 byte
+    return Get_Subclass_Flag(SYMBOL, s, ALL_ASCII);
 }
 
+#define Is_String_Definitely_ASCII(str) \
+    Is_Definitely_Ascii(ensure(String(const*), (str)))
+
 #define STR_UTF8(s) \
     SER_HEAD(const char, ensure(String(const*), s))
 
@@ -304,10 +308,19 @@ inline static void TERM_STR_LEN_SIZE(Raw_String* s, REBLEN len, Size used) {
 // UTF-8 strings based on index, vs. having to necessarily search from the
 // beginning.
 //
-// !!! At the moment, only one bookmark is in effect at a time.  Even though
-// it's just two numbers, there's only one pointer's worth of space in the
-// series node otherwise.  Bookmarks aren't generated for strings that are
-// very short, or that are never enumerated.
+// The first bookmark in the list is the last position that was accessed,
+// which makes iterating cheap.  Bookmarks aren't generated for strings that
+// are very short, or that are never enumerated.
+//
+// Strings of at least STR_INDEX_MIN_LEN codepoints add "checkpoints" after
+// that, in order of increasing index.  These are made every STR_INDEX_STRIDE
+// codepoints the first time an access is far from the last one, so after
+// that no access has to scan much further than that.  Modifications shift
+// the checkpoints after them, and drop any in material that was replaced.
+// (Big insertions drop all the checkpoints, to be remade if needed.)
+
+#define STR_INDEX_STRIDE 512
+#define STR_INDEX_MIN_LEN (4 * STR_INDEX_STRIDE)
 
 #define BMK_INDEX(b) \
     SER_HEAD(struct Reb_Bookmark, c_cast(REBBMK*, (b)))->index
@@ -315,6 +328,9 @@ inline static void TERM_STR_LEN_SIZE(Raw_String* s, REBLEN len, Size used) {
 #define BMK_OFFSET(b) \
     SER_HEAD(struct Reb_Bookmark, c_cast(REBBMK*, (b)))->offset
 
+#define BMK_AT(b,n) \
+    SER_AT(struct Reb_Bookmark, m_cast(REBBMK*, (b)), (n))
+
 inline static REBBMK* Alloc_Bookmark(void) {
     REBSER *s = Make_Series_Core(
         1,
@@ -322,7 +338,10 @@ inline static REBBMK* Alloc_Bookmark(void) {
     );
     SET_SERIES_LEN(s, 1);
     CLEAR_SERIES_FLAG(s, MANAGED);  // manual but untracked (avoid leak error)
-    return cast(REBBMK*, s);
+    REBBMK *bookmark = cast(REBBMK*, s);
+    BMK_INDEX(bookmark) = 0;
+    BMK_OFFSET(bookmark) = 0;
+    return bookmark;
 }
 
 inline static void Free_Bookmarks_Maybe_Null(String(*) str) {
@@ -339,16 +358,20 @@ inline static void Free_Bookmarks_Maybe_Null(String(*) str) {
         if (not bookmark)
             return;
 
-        REBLEN index = BMK_INDEX(bookmark);
-        Size offset = BMK_OFFSET(bookmark);
+        REBLEN n;
+        for (n = 0; n < SER_USED(bookmark); ++n) {
+            REBLEN index = BMK_AT(bookmark, n)->index;
+            Size offset = BMK_AT(bookmark, n)->offset;
+            assert(n < 2 or index >= BMK_AT(bookmark, n - 1)->index);
 
-        Utf8(*) cp = STR_HEAD(s);
-        REBLEN i;
-        for (i = 0; i != index; ++i)
-            cp = NEXT_STR(cp);
+            Utf8(*) cp = STR_HEAD(s);
+            REBLEN i;
+            for (i = 0; i != index; ++i)
+                cp = NEXT_STR(cp);
 
-        Size actual = cast(Byte*, cp) - SER_DATA(s);
-        assert(actual == offset);
+            Size actual = cast(Byte*, cp) - SER_DATA(s);
+            assert(actual == offset);
+        }
     }
 #endif
 
@@ -373,10 +396,8 @@ inline static void Free_Bookmarks_Maybe_Null(String(*) str) {
 inline static Utf8(*) STR_AT(const_if_c Raw_String* s, REBLEN at) {
     assert(at <= STR_LEN(s));
 
-    if (Is_Definitely_Ascii(s)) {  // can't have any false positives
-        assert(not LINK(Bookmarks, s));  // mutations must ensure this
+    if (Is_Definitely_Ascii(s))  // can't have any false positives
         return cast(Utf8(*), cast(Byte*, STR_HEAD(s)) + at);
-    }
 
     Utf8(*) cp;  // can be used to calculate offset (relative to STR_HEAD())
     REBLEN index;
@@ -412,7 +433,8 @@ inline static Utf8(*) STR_AT(const_if_c Raw_String* s, REBLEN at) {
             bookmark = Alloc_Bookmark();
             const Raw_String* p = s;
             mutable_LINK(Bookmarks, m_cast(Raw_String*, p)) = bookmark;
-            goto scan_from_head;  // will fill in bookmark
+            if (len < STR_INDEX_MIN_LEN)
+                goto scan_from_head;  // will fill in bookmark
         }
     }
     else {
@@ -428,21 +450,31 @@ inline static Utf8(*) STR_AT(const_if_c Raw_String* s, REBLEN at) {
             bookmark = Alloc_Bookmark();
             const Raw_String *p = s;
             mutable_LINK(Bookmarks, m_cast(Raw_String*, p)) = bookmark;
-            goto scan_from_tail;  // will fill in bookmark
+            if (len < STR_INDEX_MIN_LEN)
+                goto scan_from_tail;  // will fill in bookmark
         }
     }
 
-    // Theoretically, a large UTF-8 string could have multiple "bookmarks".
-    // That would complicate this logic by having to decide which one was
-    // closest to be using.  For simplicity we just use one right now to
-    // track the last access--which speeds up the most common case of an
-    // iteration.  Improve as time permits!
-    //
-    assert(not bookmark or SER_USED(bookmark) == 1);  // only one
-
   blockscope {
     REBLEN booked = bookmark ? BMK_INDEX(bookmark) : 0;
 
+    // If a long string is accessed far from the last access, start from the
+    // closest checkpoint before `at` instead (unless the tail is closer).
+    //
+    if (
+        bookmark
+        and len >= STR_INDEX_MIN_LEN
+        and (at > booked ? at - booked : booked - at) > STR_INDEX_STRIDE
+    ){
+        Size offset;
+        index = Find_String_Checkpoint(&offset, m_cast(Raw_String*, s), at);
+        if (at - index <= len - at) {
+            cp = cast(Utf8(*), SER_DATA(s) + offset);
+            goto scan_forward;
+        }
+        goto scan_from_tail;
+    }
+
     // `at` is always positive.  `booked - at` may be negative, but if it
     // is positive and bigger than `at`, faster to seek from head.
     //
@@ -628,6 +660,8 @@ inline static Size VAL_SIZE_LIMIT_AT(
         assert(limit >= 0);
         if (length_out)
             *unwrap(length_out) = limit;
+        if (Is_Definitely_Ascii(VAL_STRING(v)))
+            return limit;
         tail = at;
         for (; limit > 0; --limit)
             tail = NEXT_STR(tail);
@@ -739,12 +773,10 @@ inline static void SET_CHAR_AT(String(*) s, REBLEN n, Codepoint c) {
         *cast(Byte*, STR_TAIL(s)) = '\0';  // add terminator
 
         // `cp` still is the start of the character for the index we were
-        // dealing with.  Only update bookmark if it's an offset *after*
-        // that character position...
+        // dealing with.  Only bookmarks *after* that character move.
         //
-        REBBMK *book = LINK(Bookmarks, s);
-        if (book and BMK_OFFSET(book) > cp_offset)
-            BMK_OFFSET(book) += delta;
+        if (LINK(Bookmarks, s))
+            Update_Bookmarks_For_Change(s, n, cp_offset, 1, old_size, 1, size);
     }
 
   #if DEBUG_UTF8_EVERYWHERE  // see note on `len` at start of function
@@ -839,15 +871,17 @@ inline static String(*) Make_Sized_String_UTF8(const char *utf8, size_t size) {
 inline static REBINT Hash_String(String(const*) str)
     { return Hash_UTF8_Len_Caseless(STR_HEAD(str), STR_LEN(str)); }
 
-inline static REBINT First_Hash_Candidate_Slot(
-    REBLEN *skip_out,
-    REBLEN hash,
-    REBLEN num_slots
-){
-    *skip_out = (hash & 0x0000FFFF) % num_slots;
-    if (*skip_out == 0)
-        *skip_out = 1;
-    return (hash & 0x00FFFF00) % num_slots;
+// Symbols are immutable, so Intern_UTF8_Managed_Core() computes their
+// caseless hash once and stores it just past the spelling's terminator,
+// rounded up to a 4-byte boundary.  Hashing a WORD! is then just a load,
+// instead of a codepoint-by-codepoint walk of the spelling.
+//
+inline static Size Symbol_Hash_Offset(Size utf8_size)
+  { return (utf8_size + 1 + 3) & ~cast(Size, 3); }
+
+inline static uint32_t Hash_Symbol(Symbol(const*) s) {
+    const Byte* head = SER_DATA(s);  // symbols are never biased
+    return *cast(const uint32_t*, head + Symbol_Hash_Offset(STR_SIZE(s)));
 }
 
 
@@ -57,7 +57,17 @@ inline static option(Array(const*)) VAL_PARAMETER_ARRAY(
 }
 
 #define INIT_VAL_PARAMETER_ARRAY(v, a) \
-    INIT_VAL_NODE1((v), (a))
+    (INIT_VAL_NODE1((v), (a)), \
+        VAL_PARAM_FLAGS(v) &= ~PARAM_FLAG_FAST_KINDS_CACHED)
+
+#define VAL_PARAMETER_FAST_KINDS(v) \
+    PAYLOAD(Any, (v)).second.u
+
+// Kinds at or above this number don't fit in the fast kinds bitset, and
+// always take the slow path (only an issue on 32-bit platforms).
+//
+#define PARAM_FAST_KINDS_LIMIT \
+    (sizeof(uintptr_t) * 8)
 
 
 inline static bool TYPE_CHECK(Cell(const*) typeset, Value(const*) v) {
@@ -152,7 +162,11 @@ inline static bool Matcher_Matches(
 #define PARAM_FLAG_NOOP_IF_VOID \
     FLAG_LEFT_BIT(13)
 
-#define PARAM_FLAG_14 \
+// PARAMETER! cells keep a bitset of the kinds their types array accepts by
+// plain tests in the payload's second slot.  This says it's been filled in.
+// (See Is_Fast_Kind_Of_Param().)
+//
+#define PARAM_FLAG_FAST_KINDS_CACHED \
     FLAG_LEFT_BIT(14)
 
 #define PARAM_FLAG_CONST \
@@ -232,6 +246,7 @@ inline static REBVAL *Init_Parameter_Core(Cell(*) out, Array(const*) array)
     if (array)
         ASSERT_SERIES_MANAGED(array);
     INIT_VAL_PARAMETER_ARRAY(out, array);
+    VAL_PARAMETER_FAST_KINDS(out) = 0;
     VAL_PARAM_FLAGS(out) = FLAG_PARAM_CLASS_BYTE(PARAM_CLASS_0);
     return cast(REBVAL*, out);
 }
@@ -251,6 +266,7 @@ inline static REBPAR *Init_Param_Core(
 
     VAL_PARAM_FLAGS(out) = param_flags;
     INIT_VAL_PARAMETER_ARRAY(out, array);
+    VAL_PARAMETER_FAST_KINDS(out) = 0;
 
     REBPAR *param = cast(REBPAR*, cast(REBVAL*, out));
     assert(VAL_PARAM_CLASS(param) != PARAM_CLASS_0);  // must set
@@ -267,6 +283,33 @@ inline static REBVAL *Refinify(REBVAL *v);  // forward declaration
 inline static bool IS_REFINEMENT(Cell(const*) v);  // forward decl
 inline static bool IS_PREDICATE(Cell(const*) v);  // forward decl
 
+// Most parameter specs are lists of TYPE-WORD!s and TYPECHECKER functions
+// like ANY-SERIES?, which only look at the kind.  Those kinds are gathered
+// into a bitset on the first typecheck of the parameter, so later checks of
+// such kinds are one bit test.  Anything else in the spec (e.g. EVEN?) still
+// runs through Typecheck_Value(), but only for kinds the bitset misses.
+//
+// Gathering on first use lets a spec mention typecheckers that are defined
+// after the function is made.  But like R3-Alpha's typesets, redefining a
+// type word afterward won't change what an already-checked parameter takes.
+//
+inline static bool Is_Fast_Kind_Of_Param(
+    const REBPAR *param,
+    enum Reb_Kind kind
+){
+    if (cast(REBLEN, kind) >= PARAM_FAST_KINDS_LIMIT)
+        return false;
+
+    uintptr_t bits;
+    if (GET_PARAM_FLAG(param, FAST_KINDS_CACHED))
+        bits = VAL_PARAMETER_FAST_KINDS(param);
+    else
+        bits = Cache_Parameter_Fast_Kinds(m_cast(REBPAR*, param));
+
+    return did (bits & (cast(uintptr_t, 1) << kind));
+}
+
+
 // This is an interim workaround for the need to be able check constrained
 // data types (e.g. PATH!-with-BLANK!-at-head being REFINEMENT!).  See
 // Startup_Fake_Type_Constraint() for an explanation.
@@ -300,6 +343,13 @@ inline static bool Typecheck_Including_Constraints(
     else
         unquoted = false;
 
+    if (Is_Fast_Kind_Of_Param(param, VAL_TYPE(v))) {
+        ++Typecheck_Fast_Count;
+        goto return_true;
+    }
+
+    ++Typecheck_Slow_Count;  // see STATS/TYPECHECKS
+
     if (TYPE_CHECK(param, v))
         goto return_true;
 
@@ -120,6 +120,13 @@ typedef struct rebol_scan_state {  // shared across all levels of a scan
     LineNumber line;  // line number where current scan position is
     const Byte* line_head;  // pointer to head of current line (for errors)
 
+    // A variadic UTF-8 fragment that began at a point where it could be
+    // cached, and the stack index that its values are pushed after.  See
+    // Cache_Scan_Fragment().
+    //
+    const Byte* fragment;
+    StackIndex fragment_base;
+
     // The "limit" feature was not implemented, scanning just stopped at '\0'.
     // It may be interesting in the future, but it doesn't mix well with
     // scanning variadics which merge REBVAL and UTF-8 strings together...
@@ -58,8 +58,27 @@ struct rebol_mem_pool {
     Length num_units_per_segment;  // units per segment allocation
     Count free;  // number of units remaining
     Count has;  // total number of units
+    Count high_water;  // most units ever in use at once
+    REBU64 num_allocs;  // cumulative allocations from this pool
+
+    // When a recycle's sweep is split into slices, this is the first segment
+    // that hasn't been swept yet.  While it is non-null, the free list only
+    // holds units from segments that have been swept (or fresh segments), and
+    // Free_Pooled() leaves units for the sweep to link.
+    //
+    Segment* unswept;
 };
 
+// Chunk of a frame's scratch arena, see Alloc_Frame_Scratch()
+//
+typedef struct Reb_Scratch_Chunk {
+    struct Reb_Scratch_Chunk *prior;
+    Size size;  // bytes available after this header
+    Size used;
+} ScratchChunk;
+
+#define SCRATCH_CHUNK_SIZE 4096  // bigger requests get a chunk of their own
+
 #define DEF_POOL(size, count) {size, count}
 #define MOD_POOL(size, count) {size * MEM_MIN_SIZE, count}
 
@@ -68,6 +87,8 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+#define HUGE_MIN_ALLOC (64 * 1024)  // smaller than this is never OS-mapped
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
@@ -342,6 +342,77 @@ Special internal defines used by RT, not Host-Kit developers:
 #endif
 
 
+//=//// PARALLEL SORT //////////////////////////////////////////////////////=//
+
+// SORT of a big block of INTEGER!, DECIMAL!, or TEXT! values can spread the
+// work over several threads, because comparing those runs no evaluator code
+// and never touches the GC.  The interpreter otherwise has no threads, so
+// this is opt-in: it uses POSIX threads and needs e.g. `libraries: [%pthread]`
+// in the build config on platforms where they aren't part of the C library.
+//
+#if !defined(REBOL_PARALLEL_SORT)
+    #define REBOL_PARALLEL_SORT 0
+#elif REBOL_PARALLEL_SORT && defined(_WIN32)
+    #error "REBOL_PARALLEL_SORT currently requires POSIX threads"
+#endif
+
+
+//=//// PARALLEL DEFLATE ///////////////////////////////////////////////////=//
+
+// DEFLATE/PARALLEL compresses independent chunks of a big BINARY! in worker
+// threads (pigz style).  Like parallel sort it is opt-in, because it needs
+// POSIX threads.  Without it, /PARALLEL compresses on the calling thread.
+//
+#if !defined(REBOL_PARALLEL_DEFLATE)
+    #define REBOL_PARALLEL_DEFLATE 0
+#elif REBOL_PARALLEL_DEFLATE && defined(_WIN32)
+    #error "REBOL_PARALLEL_DEFLATE currently requires POSIX threads"
+#endif
+
+
+//=//// SAMPLING PROFILER //////////////////////////////////////////////////=//
+
+// SAMPLE-STACK counts what the frame stack looks like each time a SIGPROF
+// CPU timer fires (see %d-profile.c).  The timer is only armed while it is
+// sampling, but platforms without setitimer() can turn it off.
+//
+#if !defined(REBOL_SAMPLING_PROFILER)
+    #define REBOL_SAMPLING_PROFILER (TO_LINUX || TO_OSX)
+#elif REBOL_SAMPLING_PROFILER && defined(_WIN32)
+    #error "REBOL_SAMPLING_PROFILER currently requires POSIX setitimer()"
+#endif
+
+
+//=//// USDT PROBES ////////////////////////////////////////////////////////=//
+
+// Static tracepoints at function calls, garbage collection, series expansion
+// and port actions, for perf/bpftrace/SystemTap (see %sys-probes.h).  They
+// are nearly free when nothing is attached, but need <sys/sdt.h> (e.g. the
+// systemtap-sdt-dev package), so they are off unless asked for.
+//
+#if !defined(REBOL_USDT_PROBES)
+    #define REBOL_USDT_PROBES 0
+#elif REBOL_USDT_PROBES && !TO_LINUX
+    #error "REBOL_USDT_PROBES currently requires Linux <sys/sdt.h>"
+#endif
+
+
+//=//// TIMER-DRIVEN SIGNAL POLLING ///////////////////////////////////////=//
+
+// By default each evaluator step decrements Eval_Countdown, and signals are
+// looked at every EVAL_DOSE steps (or on the next step after SET_SIGNAL()).
+// With this on, a step only tests the Eval_Poll flag, which is set by
+// SET_SIGNAL() and by a CPU timer (see Startup_Signal_Timer()).  So periodic
+// work like incremental sweeping runs at a fixed rate in time instead of in
+// steps, but Total_Eval_Cycles is not kept (so STATS/EVALS is unavailable).
+//
+#if !defined(REBOL_TIMER_SIGNALS)
+    #define REBOL_TIMER_SIGNALS 0
+#elif REBOL_TIMER_SIGNALS && defined(_WIN32)
+    #error "REBOL_TIMER_SIGNALS currently requires POSIX setitimer()"
+#endif
+
+
 // NDEBUG is the variable that is either #defined or not by the C assert.h
 // convention.  The reason NDEBUG was used was because it was a weird name and
 // unlikely to compete with codebases that had their own DEBUG definition.
@@ -760,6 +831,26 @@ Special internal defines used by RT, not Host-Kit developers:
     #define DEBUG_DTOA 0
 #endif
 
+// Most DECIMAL! values in practice are short decimal fractions, which can be
+// converted exactly with one IEEE multiply or divide by a power of ten.  This
+// gives the same results as dtoa() and strtod() (shortest round-trip digits,
+// correct rounding), only faster.  The switch is here to rule it out if a
+// platform's floating point is suspect.
+//
+#if !defined(FAST_DECIMAL_CONVERSION)
+    #define FAST_DECIMAL_CONVERSION 1
+#endif
+
+// The boot block (natives, errors, base, sys, and mezzanine source) is built
+// into the executable gzip-compressed, and inflated on every startup.  For
+// short-lived command-line runs that's a noticeable part of launch time, so
+// this can trade a few times the boot block's size in the executable for
+// scanning it directly out of read-only data.
+//
+#if !defined(BOOT_BLOCK_UNCOMPRESSED)
+    #define BOOT_BLOCK_UNCOMPRESSED 0
+#endif
+
 // It would seem that cells like REB_BLANK which don't use their payloads
 // could just leave them uninitialized...saving time on the assignments.
 //
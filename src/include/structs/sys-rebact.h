@@ -183,3 +183,28 @@
         | FLAG_FLAVOR(PARTIALS) \
         /* LINK is unused at this time */ \
         /* MISC is unused at this time (could be paramlist cache?) */)
+
+
+//=//// SHARED FUNCTION BODY CACHE ///////////////////////////////////////=//
+//
+// A FUNC made from a deeply frozen body gets a frozen relativized copy, and
+// the copy is remembered here so another FUNC made from the same body--with
+// the same keys--can use it instead of making a copy of its own.  See
+// Copy_Or_Share_Body_Managed().
+//
+// The GC clears the whole table when it starts a recycle, so none of these
+// pointers have to keep anything alive: nothing in it can be freed until the
+// next recycle.
+//
+
+#define BODY_CACHE_SIZE 64  // must be a power of 2
+
+struct Reb_Body_Cache_Entry {
+    Array(const*) source;  // frozen body that was copied (nullptr if unused)
+    REBLEN index;
+    REBSPC *specifier;
+
+    Action(*) action;  // action the copy was relativized to
+    Array(*) copy;
+};
+
@@ -94,9 +94,21 @@ enum Reb_Type_Hook_Index {
     (ARRAY_FLAG_HAS_FILE_LINE_UNMASKED | SERIES_FLAG_LINK_NODE_NEEDS_MARK)
 
 
-//=//// ARRAY_FLAG_25 /////////////////////////////////////////////////////=//
+//=//// ARRAY_FLAG_NO_BINDABLES ///////////////////////////////////////////=//
 //
-#define ARRAY_FLAG_25 \
+// Loaded data is often big arrays of numbers and strings, and walking every
+// cell of them when binding code that contains them is wasted time.  So the
+// scanner sets this flag on an array when none of its cells are bindable
+// (see Is_Bindable()), so no words and no nested arrays.  Since there's
+// nothing underneath to change, it holds deeply, and binding can skip the
+// whole array without looking in it.
+//
+// It may be missing from arrays that qualify (only the scanner and copies
+// of flagged arrays set it), but must never be on one that doesn't.  Hence
+// getting mutable access to an array's cells with VAL_ARRAY_ENSURE_MUTABLE()
+// and its relatives clears it.
+//
+#define ARRAY_FLAG_NO_BINDABLES \
     SERIES_FLAG_25
 
 
@@ -64,6 +64,17 @@
     SERIES_FLAG_24
 
 
+//=//// ERROR_LOCATION_LAZY ///////////////////////////////////////////////=//
+//
+// A definitional error (e.g. one from RAISE that TRAP or ATTEMPT intercepts)
+// starts out with only a cheap location: its NEAR is a plain BLOCK! at the
+// execution position, and WHERE isn't filled in.  This flag says NEAR still
+// has to be turned into the usual excerpt, see Finish_Lazy_Location_Of_Error()
+//
+#define VARLIST_FLAG_ERROR_LOCATION_LAZY \
+    SERIES_FLAG_25
+
+
 #define CELL_MASK_ANY_CONTEXT \
     (CELL_FLAG_FIRST_IS_NODE  /* varlist */ \
         | CELL_FLAG_SECOND_IS_NODE  /* phase (for FRAME!) */)
@@ -91,3 +102,61 @@
 
 inline static Array(*) CTX_VARLIST(Context(*) ctx)
   { return x_cast(Array(*), ctx); }  // ARR() has debug cost, not defined yet
+
+
+//=//// KEYLIST SHAPE AND FIELD CACHES ////////////////////////////////////=//
+//
+// Objects made by running the same spec get the same keylist, and when a key
+// is added to an object whose keylist is shared, the keylist it moves to is
+// remembered so other objects adding the same key move to the same one.  So
+// keylists act like the "shapes" (or hidden classes) of JavaScript engines:
+// see Make_Context_Detect_Managed() and Append_Context_Core().
+//
+// Since instances share keylists, the position a symbol was found at in one
+// of them is good for all of them.  Keylists only grow at the tail, so a
+// position found stays right as long as the keylist lives.  That is kept in
+// the field cache, used by Find_Symbol_In_Context().
+//
+// The GC clears both tables when it starts a recycle, so none of these
+// pointers have to keep anything alive.
+//
+
+#define SHAPE_CACHE_SIZE 256  // must be a power of 2
+
+struct Reb_Shape_Cache_Entry {
+    const void *from;  // shared keylist, or spec cell of a new object
+    Symbol(const*) symbol;  // key added to `from` (nullptr for a spec)
+    Keylist(*) to;
+};
+
+#define FIELD_CACHE_SIZE 256  // must be a power of 2
+
+struct Reb_Field_Cache_Entry {
+    Keylist(const*) keylist;  // (nullptr if unused)
+    Symbol(const*) symbol;
+    bool strict;
+    REBLEN index;
+};
+
+
+//=//// TUPLE! PICK CACHE /////////////////////////////////////////////////=//
+//
+// Each step of a TUPLE! like `obj.field.subfield` that picks a WORD! out of
+// an OBJECT! remembers the keylist it saw and the position it found, keyed
+// by the tuple's array (its "call site") and the step.  When the next object
+// picked from at that step has the same keylist, which is likely with the
+// keylist sharing above, the variable is found with a pointer compare.  See
+// Pick_Object_Var_Cached().
+//
+// Cleared by the GC at the start of a recycle, like the caches above.
+//
+
+#define PICK_CACHE_SIZE 256  // must be a power of 2
+
+struct Reb_Pick_Cache_Entry {
+    const Node* site;  // array of the TUPLE! (nullptr if unused)
+    REBLEN step;
+    Keylist(const*) keylist;
+    Symbol(const*) symbol;
+    REBLEN index;
+};
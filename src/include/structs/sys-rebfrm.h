@@ -257,6 +257,53 @@ STATIC_ASSERT(31 < 32);  // otherwise FRAME_FLAG_XXX too high
     ((FRM(f)->flags.bits & FRAME_FLAG_##name) == 0)
 
 
+// Varlists of frames for actions with fewer than SPARE_VARLIST_ARGS params
+// (counting locals) are kept for reuse, SPARE_VARLISTS_EACH per count.
+// See Free_Action_Varlist().
+//
+#define SPARE_VARLIST_ARGS 16
+#define SPARE_VARLISTS_EACH 4
+
+// Iteration states of FOR-EACH and friends are kept for reuse too, so nested
+// loops don't allocate on each run.  See Init_Loop_Each().
+//
+#define SPARE_LOOP_EACH_STATES 8
+
+// COMPOSE/DEEP remembers which deeply frozen arrays have no GROUP!s in them
+// at any depth, so it can take those as-is without walking them again.  See
+// Array_Has_Compose_Groups().  Cleared by the GC at each recycle.
+//
+#define COMPOSE_CACHE_SIZE 64  // must be a power of 2
+
+struct Reb_Compose_Cache_Entry {
+    Array(const*) array;  // (nullptr if unused)
+    bool has_groups;
+};
+
+// COMBINATORIZE remembers the parsers it made for UPARSE steps that did not
+// need other parsers made for their arguments (e.g. TEXT! or BLOCK! rules,
+// but not SOME), so each trip around a loop doesn't make the same parser
+// again.  Entries keep copies of the rule cells they consumed, so rules that
+// have been changed will miss.  See Combinatorize_Cache_Slot().  Cleared by
+// the GC at each recycle.
+//
+#define COMBINATOR_CACHE_SIZE 256  // must be a power of 2
+#define COMBINATOR_CACHE_MAX_CELLS 4  // rule cells one cached step may use
+
+struct Reb_Combinator_Cache_Entry {
+    Array(const*) rules;  // (nullptr if unused)
+    REBLEN index;
+    REBSPC *specifier;
+    Action(*) combinator;
+    Context(*) state;
+    bool has_value;
+    RawCell value;  // bits of the /VALUE, if any
+    REBLEN num_cells;
+    RawCell cells[COMBINATOR_CACHE_MAX_CELLS];
+    Action(*) parser;
+};
+
+
 // !!! It was thought that a standard layout struct with just {REBVAL *p} in
 // it would be compatible as a return result with plain REBVAL *p.  That does
 // not seem to be the case...because when an extension-defined dispatcher is
@@ -428,6 +475,7 @@ typedef Executor Dispatcher;  // sub-dispatched in Action_Executor()
     // ask for a FRAME! value, and the Context(*) isn't needed to store in a
     // Derelativize()'d or Move_Velue()'d value as a binding, it can be
     // reused or freed.  See Push_Action() and Drop_Action() for the logic.
+    // (Freed ones may be kept as spares, see Free_Action_Varlist().)
     //
     Array(*) varlist;
     REBVAL *rootvar; // cache of CTX_ARCHETYPE(varlist) if varlist is not null
@@ -468,6 +516,13 @@ typedef Executor Dispatcher;  // sub-dispatched in Action_Executor()
     //
     Node* alloc_value_list;
 
+    // Natives can ask for scratch memory that lives only as long as their
+    // frame, see Alloc_Frame_Scratch().  It's carved out of these chunks with
+    // a bump pointer and all released at once when the frame is dropped, so
+    // series made this way never go through the pools or the GC.
+    //
+    struct Reb_Scratch_Chunk* scratch;
+
    #if DEBUG_COUNT_TICKS
     //
     // The expression evaluation "tick" where the Reb_Frame is starting its
@@ -67,6 +67,30 @@
 //
 // Next node is either to another let, a frame specifier context, or nullptr.
 //
+// A body with many LETs builds a long run of them, and a word that none of
+// them bind (e.g. any call to a library function) would have to step
+// through every one.  So once a run reaches LET_SUMMARY_MIN_RUN, its LETs
+// share a "summary": a small bloom filter of the symbols bound in the run,
+// and the last LET of the run.  A lookup that misses in the filter jumps
+// right to that last LET and continues after it.
+//
+// New LETs made on top of a summarized LET add their symbol to the same
+// summary.  Two LETs branching off the same run therefore both land in the
+// filter, but a filter that over-reports is only slower, never wrong.  (The
+// last LET of a run can't change: the only later write to a chain is giving
+// a null tail a frame, and a frame is not a LET.)
+//
+
+#define LET_SUMMARY_MIN_RUN 3
+#define LET_SUMMARY_BITS 256  // must be a power of 2
+
+struct Reb_Let_Summary {
+    Array(*) last;  // last LET of the run, its NextVirtual() is not a LET
+    uint32_t bits[LET_SUMMARY_BITS / 32];
+};
+
+#define LET_SUMMARY(bin) \
+    cast(struct Reb_Let_Summary*, BIN_HEAD(bin))
 
 #define INODE_LetSymbol_TYPE           Symbol(const*)
 #define INODE_LetSymbol_CAST           SYM
@@ -76,9 +100,9 @@
 #define LINK_NextLet_CAST              ARR
 #define HAS_LINK_NextLet               FLAVOR_LET
 
-#define MISC_LetReserved_TYPE          Array(*)
-#define MISC_LetReserved_CAST          ARR
-#define HAS_MISC_LetReserved           FLAVOR_LET
+#define MISC_LetSummary_TYPE           Binary(*)  // nullptr if short run
+#define MISC_LetSummary_CAST           BIN
+#define HAS_MISC_LetSummary            FLAVOR_LET
 
 
 //=//// "USE" FOR VIRTUAL BINDING TO OBJECTS //////////////////////////////=//
@@ -107,3 +131,39 @@
 //
 #define NextVirtual(let_or_use) \
     ARR(node_LINK(NextLet, let_or_use))
+
+
+//=//// VIRTUAL BINDING LOOKUP CACHE //////////////////////////////////////=//
+//
+// Resolving a word through a chain of LETs and USEs means walking the chain
+// and searching each overloading object's keys.  In a loop body the same
+// word is looked up through the same chain over and over, so the outcome of
+// recent walks is kept in a small direct-mapped table (see TG_Virtual_Cache).
+//
+// An entry is keyed on the specifier at the head of the chain, the symbol
+// and whether the word is a SET-WORD! (some USEs only apply to SET-WORD!s).
+// A hit gives the container and index that were found, a miss gives the
+// specifier the chain bottomed out at.  Everything the result refers to is
+// reachable from the head specifier, so it can't go stale unless:
+//
+// * A key is appended to a context (an overload, or a module getting a new
+//   variable that MOD_VAR() would now find).
+//
+// * A LET or USE is freed by the GC, so a new chain could be allocated at
+//   the same address.
+//
+// Both bump TG_Virtual_Cache_Epoch, which invalidates all entries at once.
+//
+
+#define VIRTUAL_CACHE_SIZE 256  // must be a power of 2
+
+struct Reb_Virtual_Cache_Entry {
+    uintptr_t epoch;  // entry valid only when matching TG_Virtual_Cache_Epoch
+    REBSPC *specifier;
+    Symbol(const*) symbol;
+    bool set_word;
+
+    REBSER *found;  // nullptr if the chain had no match for the symbol
+    REBLEN index;  // index in found, if a match
+    REBSPC *rest;  // specifier the chain bottomed out at, if no match
+};
@@ -252,9 +252,19 @@
     FLAG_LEFT_BIT(12)
 
 
-//=//// SERIES_FLAG_13 ////////////////////////////////////////////////////=//
+//=//// SERIES_FLAG_TENURED //////////////////////////////////////////////=//
 //
-#define SERIES_FLAG_13 \
+// When generational collection is enabled (see RECYCLE/GENERATIONAL), a
+// frozen series that survives a major collection--and which only references
+// other tenured series--gets this flag.  A tenured series keeps its
+// NODE_FLAG_MARKED set between minor collections, so the marking phase stops
+// when it reaches one and never walks its contents.
+//
+// Because a frozen series can't be written to, it can't acquire references
+// to series allocated after it was tenured.  That's what makes it safe to
+// skip it without a write barrier: the "remembered set" is always empty.
+//
+#define SERIES_FLAG_TENURED \
     FLAG_LEFT_BIT(13)
 
 
@@ -352,9 +362,15 @@ inline static Byte FLAVOR_BYTE(uintptr_t flags)
 STATIC_ASSERT(SERIES_INFO_0_IS_FALSE == NODE_FLAG_NODE);
 
 
-//=//// SERIES_INFO_1 /////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_HASH_CACHED ///////////////////////////////////////////=//
 //
-#define SERIES_INFO_1 \
+// A frozen string's content can never change, so Hash_Value() of it at its
+// head is computed once and stored just past the terminator (the same place
+// a symbol keeps its hash, see Hash_Symbol()).  This says it is there.  It's
+// only set on FLAVOR_STRING series, so a BINARY! aliasing the bytes (which
+// hashes them cased) doesn't see it.
+//
+#define SERIES_INFO_HASH_CACHED \
     FLAG_LEFT_BIT(1)
 
 
@@ -433,9 +449,17 @@ STATIC_ASSERT(SERIES_INFO_0_IS_FALSE == NODE_FLAG_NODE);
     FLAG_LEFT_BIT(6)
 
 
-//=//// SERIES_INFO_7 //////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_EXTERNAL_DATA ////////////////////////////////////////=//
+//
+// The dynamic data of the series was not allocated by the memory pools, but
+// was handed over by Make_Binary_External() (e.g. a memory-mapped file).  It
+// is released by the function registered with it instead of being freed, and
+// the series is frozen and FIXED_SIZE so it is never written or reallocated.
 //
-#define SERIES_INFO_7 \
+// This is an INFO bit and not a subclass flag because AS TEXT! can change a
+// BINARY! to a string flavor in place.
+//
+#define SERIES_INFO_EXTERNAL_DATA \
     FLAG_LEFT_BIT(7)
 
 
@@ -687,6 +711,11 @@ union Reb_Stub_Misc {
     //
     bool negated;
 
+    // Hash index of a large keylist, see KEYLIST_FLAG_INDEXED.  This is
+    // plain allocated memory (not a node), so the GC doesn't look at it.
+    //
+    uint32_t *keylist_index;
+
     // If a Node* is stored in the misc field, it has to use this union
     // member for SERIES_INFO_MISC_NODE_NEEDS_MARK to see it.  To help make
     // the reference sites be unique for each purpose and still be type safe,
@@ -62,6 +62,16 @@
 //   those flags which are common to every value of every type.  Due to their
 //   scarcity, they are chosen carefully.
 //
+// * A "compact" 16-byte cell for 64-bit builds (compressed 32-bit node
+//   references, NaN-boxing) has been asked for, but the four-pointer size is
+//   assumed well beyond this file.  A series stub holds exactly one cell's
+//   worth of content, a pairing is two cells in a stub-sized allocation, and
+//   the first byte of a cell must be readable as the same node header byte
+//   that series stubs and UTF-8 strings are told apart by.  Also, payloads
+//   hold raw Node(*) and C pointers (HANDLE!, frame feeds) which the GC marks
+//   in place.  Until all of that changes together, dense numeric data should
+//   go in a BINARY! and use the natives in %n-packed.c, at 1-8 bytes a value.
+//
 
 
 #define CELL_MASK_NO_NODES 0  // no CELL_FLAG_FIRST_IS_NODE or SECOND_IS_NODE
@@ -215,11 +225,23 @@
 #define CELL_FLAG_REFINEMENT_LIKE   CELL_FLAG_TYPE_SPECIFIC  // ANY-SEQUENCE!
 
 
-//=//// CELL_FLAG_26 ///////////////////////////////////////////////////////=//
+//=//// CELL_FLAG_BREAKPOINT /////////////////////////////////////////////=//
+//
+// The debugger's SET-BREAKPOINT puts this on a cell in an array, and the
+// evaluator tests it on each cell it starts an expression with.  Since the
+// header is already loaded to get the type, this costs nothing until a
+// breakpoint is actually set.  Then PG_Breakpoint_Hook is called before the
+// expression runs.
+//
+// It is not copied (see CELL_MASK_COPY), so the breakpoint stays with the
+// position in the array it was set on...and goes away if that cell is
+// overwritten.
 //
 #define CELL_FLAG_26 \
     FLAG_LEFT_BIT(26)
 
+#define CELL_FLAG_BREAKPOINT CELL_FLAG_26
+
 
 //=//// CELL_FLAG_UNEVALUATED /////////////////////////////////////////////=//
 //
@@ -350,7 +372,8 @@
     (NODE_FLAG_MANAGED | NODE_FLAG_ROOT | NODE_FLAG_MARKED)
 
 #define CELL_MASK_COPY \
-    ~(CELL_MASK_PERSIST | CELL_FLAG_NOTE | CELL_FLAG_UNEVALUATED | CELL_FLAG_PROTECTED)
+    ~(CELL_MASK_PERSIST | CELL_FLAG_NOTE | CELL_FLAG_UNEVALUATED \
+        | CELL_FLAG_PROTECTED | CELL_FLAG_BREAKPOINT)
 
 #define CELL_MASK_ALL \
     ~cast(Flags, 0)
@@ -467,6 +467,47 @@ enum Reb_Attach_Mode {
     ATTACH_COPY
 };
 
+// Invalidate all entries in the virtual binding lookup cache.  (The epoch
+// only wraps after an astronomical number of bumps, but if it does then the
+// table is wiped so a very old entry can't come back to life.)
+//
+inline static void Invalidate_Virtual_Cache(void) {
+    if (++TG_Virtual_Cache_Epoch == 0) {
+        memset(TG_Virtual_Cache, 0, sizeof(TG_Virtual_Cache));
+        TG_Virtual_Cache_Epoch = 1;
+    }
+}
+
+inline static REBLEN Let_Summary_Slot(Symbol(const*) symbol) {
+    uintptr_t hash = cast(uintptr_t, symbol) >> 4;  // stubs are aligned
+    return (hash ^ (hash >> 8)) & (LET_SUMMARY_BITS - 1);
+}
+
+inline static void Add_Let_Summary_Symbol(
+    struct Reb_Let_Summary *summary,
+    Symbol(const*) symbol
+){
+    REBLEN slot = Let_Summary_Slot(symbol);
+    summary->bits[slot / 32] |= (cast(uint32_t, 1) << (slot % 32));
+}
+
+inline static bool Let_Summary_Might_Have(
+    const struct Reb_Let_Summary *summary,
+    Symbol(const*) symbol
+){
+    REBLEN slot = Let_Summary_Slot(symbol);
+    return did (summary->bits[slot / 32] & (cast(uint32_t, 1) << (slot % 32)));
+}
+
+inline static struct Reb_Virtual_Cache_Entry *Virtual_Cache_Entry(
+    REBSPC *specifier,
+    Symbol(const*) symbol
+){
+    uintptr_t hash = (cast(uintptr_t, specifier) >> 4)
+        ^ (cast(uintptr_t, symbol) >> 3);
+    return &TG_Virtual_Cache[hash & (VIRTUAL_CACHE_SIZE - 1)];
+}
+
 // Find the context a word is bound into.  This must account for the various
 // binding forms: Relative Binding, Derived Binding, and Virtual Binding.
 //
@@ -497,12 +538,36 @@ inline static option(REBSER*) Get_Word_Container(
 
   blockscope {
     //
-    // There was caching to assist with this previously...but it was complex
-    // and needs to be rethought.  Hence we have no way of knowing if
-    // this word is overridden without doing a linear search.  Do it
-    // and then save the hit or miss information in the word for next use.
+    // There was caching in the specifiers to assist with this previously,
+    // but it was complex and needs to be rethought.  Without it there's no
+    // way of knowing if this word is overridden without a linear search, so
+    // the outcome is remembered in TG_Virtual_Cache for next time.
     //
     Symbol(const*) symbol = VAL_WORD_SYMBOL(VAL_UNESCAPED(any_word));
+    bool set_word = (REB_SET_WORD == CELL_HEART(any_word));
+
+    struct Reb_Virtual_Cache_Entry *entry
+        = Virtual_Cache_Entry(specifier, symbol);
+    if (
+        entry->epoch == TG_Virtual_Cache_Epoch
+        and entry->specifier == specifier
+        and entry->symbol == symbol
+        and entry->set_word == set_word
+    ){
+        if (entry->found) {
+            *index_out = entry->index;
+            return entry->found;
+        }
+        specifier = entry->rest;
+        goto not_virtually_bound;
+    }
+
+    entry->epoch = TG_Virtual_Cache_Epoch;
+    entry->specifier = specifier;
+    entry->symbol = symbol;
+    entry->set_word = set_word;
+
+    REBSER *found;  // declared up front, avoid goto-past-initialization
 
     // !!! Virtual binding could use the bind table as a kind of next
     // level cache if it encounters a large enough object to make it
@@ -512,7 +577,14 @@ inline static option(REBSER*) Get_Word_Container(
         if (IS_LET(specifier)) {
             if (INODE(LetSymbol, specifier) == symbol) {
                 *index_out = INDEX_PATCHED;
-                return specifier;
+                found = specifier;
+                goto found_virtual;
+            }
+            if (MISC(LetSummary, specifier)) {  // see LET_SUMMARY_MIN_RUN
+                const struct Reb_Let_Summary *summary
+                    = LET_SUMMARY(MISC(LetSummary, specifier));
+                if (not Let_Summary_Might_Have(summary, symbol))
+                    specifier = summary->last;  // no LET in run binds it
             }
             goto skip_miss_patch;
         }
@@ -522,7 +594,8 @@ inline static option(REBSER*) Get_Word_Container(
             REBVAL *var = MOD_VAR(mod, symbol, true);
             if (var) {
                 *index_out = INDEX_PATCHED;
-                return Singular_From_Cell(var);
+                found = Singular_From_Cell(var);
+                goto found_virtual;
             }
             goto skip_miss_patch;
         }
@@ -532,15 +605,13 @@ inline static option(REBSER*) Get_Word_Container(
         if (not IS_VARLIST(overbind)) {  // a patch-formed LET overload
             if (INODE(LetSymbol, overbind) == symbol) {
                 *index_out = 1;
-                return overbind;
+                found = overbind;
+                goto found_virtual;
             }
             goto skip_miss_patch;
         }
 
-        if (
-            IS_SET_WORD(ARR_SINGLE(specifier))
-            and REB_SET_WORD != CELL_HEART(any_word)
-        ){
+        if (IS_SET_WORD(ARR_SINGLE(specifier)) and not set_word) {
             goto skip_miss_patch;
         }
 
@@ -572,7 +643,8 @@ inline static option(REBSER*) Get_Word_Container(
                 break;
 
             *index_out = index;
-            return CTX_VARLIST(overload);
+            found = CTX_VARLIST(overload);
+            goto found_virtual;
         }
       }
       skip_miss_patch:
@@ -584,6 +656,15 @@ inline static option(REBSER*) Get_Word_Container(
     // The linked list of specifiers bottoms out with either null or the
     // varlist of the frame we want to bind relative values with.  So
     // `specifier` should be set now.
+
+    entry->found = nullptr;
+    entry->rest = specifier;
+    goto not_virtually_bound;
+
+  found_virtual:
+    entry->found = found;
+    entry->index = *index_out;
+    return found;
   }
 
   not_virtually_bound: {
@@ -123,6 +123,10 @@
 #include <math.h>
 #include <stddef.h> // for offsetof()
 
+#if REBOL_TIMER_SIGNALS
+    #include <signal.h>  // sig_atomic_t for Eval_Poll
+#endif
+
 
 //=//// ALLOW ONLY MINIMAL USE OF STDIO.H IN RELEASE BUILDS ////////////////=//
 //
@@ -227,6 +231,8 @@
 
 #include "sys-hooks.h"  // function pointer definitions
 
+#include "sys-probes.h"  // USDT tracepoints, no-ops unless REBOL_USDT_PROBES
+
 
 // There is a significant amount of code that wants to enumerate the parameters
 // of functions or keys of a frame.  It's fairly complex logic, because the
@@ -270,6 +276,12 @@ struct Reb_Enum_Vars {
 typedef struct Reb_Enum_Vars EVARS;
 
 
+// Comparison function for reb_qsort_r() and reb_stable_sort_r(), which gets
+// the "thunk" passed to them as its first argument.
+//
+typedef int cmp_t(void *, const void *, const void *);
+
+
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // #INCLUDE THE AUTO-GENERATED FUNCTION PROTOTYPES FOR THE INTERNAL API
@@ -335,6 +347,16 @@ typedef struct rebol_opts {
 // out.  And so this separation really just caused problems when two different
 // threads wanted to work with the same data (at different times).  Such a
 // feature is better implemented as in the V8 JavaScript engine as "isolates"
+//
+// !!! Making the TVARs `thread_local` would not give an isolate per thread.
+// Several PVARs are per-interpreter state too (e.g. the symbol table and
+// PG_Lib_Patches, which Canon() and Lib() reach directly), as are `static`
+// variables in many files (caches, profiling, random state).  What an
+// isolate would need is for all of these to go in one instance struct, with
+// rebStartup() returning it and one thread-local pointer to the current one.
+// All the `PG_Xxx` and `TG_Xxx` references would become macros over that
+// pointer.  The boot block and other immutable tables could then be shared.
+// This is a large change, and it has not been done.
 
 #ifdef __cplusplus
     #define PVAR extern "C" RL_API
@@ -416,9 +438,6 @@ enum {
     ((REBLEN)(-1))
 
 
-typedef int cmp_t(void *, const void *, const void *);
-extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
-
 
 
 #include "tmp-constants.h"
@@ -477,12 +496,27 @@ enum rebol_signals {
     // state.  Because the ability to manage such a state may not be
     // registered by the host, this could generate an error.
     //
-    SIG_INTERRUPT = 1 << 2
+    SIG_INTERRUPT = 1 << 2,
+
+    // SIG_SWEEP means a recycle finished marking, but left some of its sweep
+    // to be done in slices between evaluation steps (see GC_Sweep_Budget).
+    //
+    SIG_SWEEP = 1 << 3,
+
+    // SIG_SAMPLE is set by the SAMPLE-STACK timer, asking for the frame
+    // stack to be tallied at the next evaluator step (see %d-profile.c).
+    //
+    SIG_SAMPLE = 1 << 4
 };
 
 inline static void SET_SIGNAL(Flags f) { // used in %sys-series.h
     Eval_Signals |= f;
 
+  #if REBOL_TIMER_SIGNALS
+    Eval_Poll = 1;  // no countdown to reconcile, next step polls
+    return;
+  #endif
+
     if (Eval_Countdown == -1)  // already set to trigger on next tick...
         return;  // ...we already reconciled the dose
 
@@ -505,6 +539,17 @@ inline static void SET_SIGNAL(Flags f) { // used in %sys-series.h
 #define CLR_SIGNAL(f) \
     cast(void, Eval_Signals &= ~(f))
 
+// Test made by the evaluator (and PARSE) on each step, to decide whether to
+// call Do_Signals_Throws().  See REBOL_TIMER_SIGNALS.
+//
+#if REBOL_TIMER_SIGNALS
+    #define Eval_Step_Polls_Signals() \
+        (Eval_Poll != 0)
+#else
+    #define Eval_Step_Polls_Signals() \
+        (--Eval_Countdown <= 0)
+#endif
+
 
 #include "datatypes/sys-series.h"
 #include "datatypes/sys-array.h"  // Array(*) used by UTF-8 string bookmarks
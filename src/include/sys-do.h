@@ -109,9 +109,16 @@ inline static Bounce Run_Generic_Dispatch_Core(
       case ISOTOPE_0:
         hook = &T_Isotope;
         break;
-      case UNQUOTED_1:
+      case UNQUOTED_1: {
+        REBLEN id = SECOND_UINT16(verb->info);  // SYM_0 if not a SYM_XXX
+        Byte verb_hook = PG_Verb_Hook_Indices[id];
+        if (verb_hook != VERB_HOOK_0) {
+            hook = Builtin_Verb_Hooks[CELL_HEART(first_arg)][verb_hook];
+            if (hook)
+                break;  // e.g. PICK* on a BLOCK!, see %verb-hooks.r
+        }
         hook = Generic_Hook_For_Type_Of(first_arg);
-        break;
+        break; }
       case QUASI_2:
         hook = &T_Quasi;
         break;
@@ -391,7 +391,7 @@ inline static Bounce Native_Raised_Result(Frame(*) frame_, const void *p) {
     }
 
     assert(CTX_TYPE(error) == REB_ERROR);
-    Force_Location_Of_Error(error, frame_);
+    Lazy_Location_Of_Error(error, frame_);  // full location only if it escapes
 
     while (TOP_FRAME != frame_)  // cancel subframes as default behavior
         Drop_Frame_Unbalanced(TOP_FRAME);  // Note: won't seem like THROW/Fail
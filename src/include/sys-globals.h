@@ -35,6 +35,8 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
+PVAR REBU64 PG_Segments_Released;  // Pool segments given back, RECYCLE/SHRINK
+PVAR bool PG_Huge_Pages;  // Map big allocations from OS, see R3_HUGE_PAGES
 
 
 
@@ -54,12 +56,14 @@ PVAR Raw_Array PG_Lib_Patches[LIB_SYMS_MAX];
 //
 PVAR Raw_Symbol PG_Symbol_Canons[ALL_SYMS_MAX + 1];
 
+// Which row of Builtin_Verb_Hooks a SYM_XXX verb uses, or VERB_HOOK_0 if it
+// has no direct handlers.  Filled in by Startup_Symbols() from Verb_Hook_Syms.
+//
+PVAR Byte PG_Verb_Hook_Indices[ALL_SYMS_MAX];
+
 PVAR REBSER *PG_Symbols_By_Hash; // Symbol REBSTR pointers indexed by hash
-PVAR REBLEN PG_Num_Symbol_Slots_In_Use; // Total symbol hash slots (+deleteds)
-#if !defined(NDEBUG)
-    PVAR REBLEN PG_Num_Symbol_Deleteds; // Deleted symbol hash slots "in use"
-#endif
-PVAR Raw_Symbol PG_Deleted_Symbol;  // pointer used to indicate a deletion
+PVAR REBSER *PG_Symbol_Hashes;  // Caseless hash of each PG_Symbols_By_Hash slot
+PVAR REBLEN PG_Num_Symbol_Slots_In_Use; // Total symbol hash slots in use
 
 PVAR REBVAL *Lib_Context_Value;
 PVAR REBVAL *Sys_Util_Module;
@@ -164,6 +168,8 @@ PVAR REBVAL *Root_No_Memory_Error;  // also must be made in advance
 // when implemented that way. Needs research!!!!
 PVAR Flags Eval_Signals;   // Signal flags
 
+PVAR BREAKPOINT_HOOK *PG_Breakpoint_Hook;  // set by debugger, see SET-BREAKPOINT
+
 
 /***********************************************************************
 **
@@ -192,13 +198,42 @@ TVAR Frame(*) TG_Unwind_Frame;
 TVAR REBI64 TG_Ballast;
 TVAR REBI64 TG_Max_Ballast;
 
+//-- Frames:
+TVAR Array(*) TG_Spare_Varlists[SPARE_VARLIST_ARGS][SPARE_VARLISTS_EACH];
+TVAR REBLEN TG_Num_Spare_Varlists[SPARE_VARLIST_ARGS];
+TVAR void *TG_Spare_Loop_Each_States[SPARE_LOOP_EACH_STATES];
+TVAR REBLEN TG_Num_Spare_Loop_Each_States;
+
+//-- Binding:
+TVAR uintptr_t TG_Virtual_Cache_Epoch;  // see VIRTUAL_CACHE_SIZE
+TVAR struct Reb_Virtual_Cache_Entry TG_Virtual_Cache[VIRTUAL_CACHE_SIZE];
+TVAR struct Reb_Body_Cache_Entry TG_Body_Cache[BODY_CACHE_SIZE];
+TVAR struct Reb_Shape_Cache_Entry TG_Shape_Cache[SHAPE_CACHE_SIZE];
+TVAR struct Reb_Field_Cache_Entry TG_Field_Cache[FIELD_CACHE_SIZE];
+TVAR struct Reb_Pick_Cache_Entry TG_Pick_Cache[PICK_CACHE_SIZE];
+TVAR struct Reb_Compose_Cache_Entry TG_Compose_Cache[COMPOSE_CACHE_SIZE];
+TVAR struct Reb_Combinator_Cache_Entry TG_Combinator_Cache[
+    COMBINATOR_CACHE_SIZE
+];
+
 //-- Memory and GC:
 TVAR Pool* Mem_Pools;     // Memory pool array
 TVAR bool GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
+TVAR REBI64 GC_Stubs_Made;  // Stubs ever allocated, for PROFILE-CALLS
+TVAR REBINT GC_Adapted_Ballast;  // Last ballast chosen from gc-growth option
+TVAR REBI64 GC_Ballast_Grows;  // Times adapting raised the ballast
+TVAR REBI64 GC_Ballast_Shrinks;  // Times adapting lowered the ballast
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBLEN GC_Generational;  // Minor recycles between majors (0 is off)
+TVAR REBLEN GC_Minors_Since_Major;  // Countdown toward next major recycle
+TVAR REBLEN GC_Num_Tenured;  // Series with SERIES_FLAG_TENURED at the moment
+TVAR REBI64 GC_Minor_Count;  // Recycles that skipped tenured series
+TVAR REBI64 GC_Major_Count;  // Recycles that marked from scratch
+TVAR REBI64 GC_Sweep_Budget;  // Microseconds per sweep slice (0 is no limit)
+TVAR bool GC_Lazy_Sweep;  // Leave sweeping to allocations that need space
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 #if !defined(NDEBUG)  // Used by the FUZZ native to inject memory failures
@@ -240,6 +275,11 @@ TVAR Frame(*) TG_Top_Frame;
 TVAR Frame(*) TG_Bottom_Frame;
 TVAR Feed(*) TG_End_Feed;
 
+// Frames are bump-allocated from this chunk, see Alloc_Frame()
+//
+TVAR Frame(*) TG_Frame_Chunk;  // FRAME_CHUNK_COUNT contiguous frames
+TVAR REBLEN TG_Frame_Chunk_Top;  // frames below this are in use (or pinned)
+
 
 //-- Evaluation stack:
 TVAR Array(*) DS_Array;
@@ -269,6 +309,9 @@ TVAR REBI64 Total_Eval_Cycles;      // Total evaluation counter (upward)
 TVAR REBI64 Eval_Limit;             // Evaluation limit (set by secure)
 TVAR int_fast32_t Eval_Countdown;  // Evaluation counter until Do_Signals()
 TVAR int_fast32_t Eval_Dose;        // Evaluation counter reset value
+#if REBOL_TIMER_SIGNALS
+    PVAR volatile sig_atomic_t Eval_Poll;  // Set by SET_SIGNAL() or timer
+#endif
 TVAR Flags Eval_Sigmask;          // Masking out signal flags
 
 TVAR Flags Trace_Flags;    // Trace flag
@@ -276,3 +319,12 @@ TVAR REBINT Trace_Level;    // Trace depth desired
 TVAR REBINT Trace_Depth;    // Tracks trace indentation
 TVAR REBLEN Trace_Limit;    // Backtrace buffering limit
 TVAR REBSER *Trace_Buffer;  // Holds backtrace lines
+
+TVAR bool Trace_Logging;  // TRACE-LOG is recording (see %d-trace.c)
+
+TVAR bool Profile_Calls;    // PROFILE-CALLS is counting (see %d-profile.c)
+TVAR bool Count_Lines;  // COUNT-LINES is counting (see %d-profile.c)
+TVAR REBLEN Alloc_Sample_Countdown;  // SAMPLE-ALLOCS when nonzero
+
+TVAR REBI64 Typecheck_Fast_Count;  // Parameter kind found in fast bitset
+TVAR REBI64 Typecheck_Slow_Count;  // ...and not, so Typecheck_Value() ran
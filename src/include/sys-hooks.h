@@ -84,11 +84,24 @@ typedef Bounce (TO_HOOK)(Frame(*) frame_, enum Reb_Kind, const REBVAL*);
 typedef void (MOLD_HOOK)(REB_MOLD *mo, noquote(Cell(const*)) v, bool form);
 
 
+// Releases data given to Make_Binary_External() when its series is freed,
+// e.g. munmap() for a memory-mapped file.
+//
+typedef void (EXTERNAL_RELEASER)(void *base, Size size);
+
+
 // Just requests what symbol a custom datatype wants to use for its type
 //
 typedef Symbol(const*) (SYMBOL_HOOK)(void);
 
 
+// Called by the evaluator when an expression starts at a cell that has
+// CELL_FLAG_BREAKPOINT.  Returns true if it threw (e.g. QUIT from the debug
+// console), in which case `out` holds the thrown value.
+//
+typedef bool (BREAKPOINT_HOOK)(REBVAL *out, Frame(*) f);
+
+
 //
 // PER-TYPE GENERIC HOOKS: e.g. for `append value x` or `select value y`
 //
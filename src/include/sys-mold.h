@@ -36,6 +36,7 @@ struct rebol_mold {
     Byte period;      // for decimal point
     Byte dash;        // for date fields
     Byte digits;      // decimal digits
+    const REBVAL *sink;  // PORT! to write to as output builds up (or null)
 };
 
 #define Drop_Mold_If_Pushed(mo) \
@@ -86,6 +87,12 @@ enum REB_Mold_Opts {
 
 #define MOLD_MASK_NONE 0
 
+// A mold with a sink writes its output there once this much has built up (as
+// values start to be molded), keeping the last MOLD_SINK_KEEP bytes back.
+//
+#define MOLD_SINK_CHUNK (64 * 1024)
+#define MOLD_SINK_KEEP 256
+
 // Temporary:
 #define MOLD_FLAG_NON_ANSI_PARENED \
     MOLD_FLAG_ALL // Non ANSI chars are ^() escaped
@@ -95,6 +102,7 @@ enum REB_Mold_Opts {
     mold_struct.series = nullptr; /* used to tell if pushed or not */ \
     mold_struct.opts = 0; \
     mold_struct.indent = 0; \
+    mold_struct.sink = nullptr; \
     REB_MOLD *name = &mold_struct; \
 
 #define SET_MOLD_FLAG(mo,f) \
@@ -126,7 +126,10 @@ inline static void *Try_Alloc_Pooled(PoolID pool_id)
 {
     Pool* pool = &Mem_Pools[pool_id];
     if (not pool->first) {  // pool has run out of nodes
-        if (not Try_Fill_Pool(pool))  // attempt to refill it
+        while (pool->unswept and not pool->first)  // a recycle's sweep lags
+            Sweep_Pending_Segment();  // reclaim garbage before growing
+
+        if (not pool->first and not Try_Fill_Pool(pool))  // attempt to refill
             return nullptr;
     }
 
@@ -154,6 +157,10 @@ inline static void *Try_Alloc_Pooled(PoolID pool_id)
 
     pool->free--;
 
+    ++pool->num_allocs;  // cheap enough to keep in release builds
+    if (pool->has - pool->free > pool->high_water)
+        pool->high_water = pool->has - pool->free;
+
   #if DEBUG_MEMORY_ALIGN
     if (cast(uintptr_t, unit) % sizeof(REBI64) != 0) {
         printf(
@@ -186,6 +193,7 @@ inline static void *Alloc_Pooled(PoolID pool_id) {
 }
 
 #define Alloc_Stub() ( \
+    ++GC_Stubs_Made, \
     (GC_Ballast -= sizeof(Stub)) <= 0 ? SET_SIGNAL(SIG_RECYCLE) : NOOP, \
     Alloc_Pooled(STUB_POOL))  // won't pass SER() yet, don't cast it
 
@@ -212,6 +220,13 @@ inline static void Free_Pooled(PoolID pool_id, void* p)
 
     Pool* pool = &Mem_Pools[pool_id];
 
+    // If a sweep is in progress, it is rebuilding the free list in segment
+    // order.  Linking the unit here could put it on the list twice, so let
+    // the sweep pick it up (or the next sweep, if this one is past it).
+    //
+    if (pool->unswept)
+        return;
+
   #ifdef NDEBUG
     unit->next_if_free = pool->first;
     pool->first = unit;
@@ -0,0 +1,71 @@
+//
+//  File: %sys-probes.h
+//  Summary: "Static tracepoints for perf, bpftrace, and SystemTap"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// When built with REBOL_USDT_PROBES, the interpreter has "USDT" probes (the
+// DTrace-style tracepoints of <sys/sdt.h>) in the `rebol` provider.  Each is
+// a single NOP in the code plus a note in the ELF file, so they cost next to
+// nothing until a tool attaches to them.  For instance:
+//
+//     perf probe -x ./r3 sdt_rebol:action__entry
+//     bpftrace -e 'usdt:./r3:rebol:gc__end { @swept = hist(arg0); }'
+//     bpftrace -e 'usdt:./r3:rebol:action__entry { @[str(arg0)] = count(); }'
+//
+// The last is how time in the evaluator can be attributed to Rebol function
+// names: a native profiler only sees Action_Executor() and the dispatchers.
+//
+// The probes are:
+//
+//     action__entry (label, frame)  Begin_Action(), label may be null
+//     action__return (label, frame)  Drop_Action()
+//     gc__begin (major, shutdown)  Recycle_Core() is marking
+//     gc__end (swept, major)  ...and has swept (or deferred sweeping)
+//     series__expand (series, used, delta)  Expand_Series() at any index
+//     symbols__expand (old_slots, new_slots)  Expand_Word_Table() doubling
+//     port__start (verb)  REBTYPE(Port) got a verb for a port's actor
+//     port__finish (verb)  ...and the actor has completed it
+//
+// Labels and verbs are passed as UTF-8 `const char*`.
+//
+// The names use a double underscore, which the tools show as a dash.  None
+// of this is named "PROBE" because PROBE() is already the debug output macro.
+//
+
+#if REBOL_USDT_PROBES
+    #include <sys/sdt.h>
+
+    #define TRACEPOINT0(name) \
+        DTRACE_PROBE(rebol, name)
+    #define TRACEPOINT1(name,a) \
+        DTRACE_PROBE1(rebol, name, (a))
+    #define TRACEPOINT2(name,a,b) \
+        DTRACE_PROBE2(rebol, name, (a), (b))
+    #define TRACEPOINT3(name,a,b,c) \
+        DTRACE_PROBE3(rebol, name, (a), (b), (c))
+#else
+    #define TRACEPOINT0(name) \
+        NOOP
+    #define TRACEPOINT1(name,a) \
+        NOOP
+    #define TRACEPOINT2(name,a,b) \
+        NOOP
+    #define TRACEPOINT3(name,a,b,c) \
+        NOOP
+#endif
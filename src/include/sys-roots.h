@@ -58,6 +58,13 @@
     SERIES_FLAG_24
 
 
+// rebEnterScope() puts a handle with this flag in the frame's list of API
+// handles, and rebLeaveScope() frees everything in the list down to it.
+//
+#define API_FLAG_SCOPE \
+    SERIES_FLAG_25
+
+
 // What distinguishes an API value is that it has both the NODE_FLAG_CELL and
 // NODE_FLAG_ROOT bits set.
 //
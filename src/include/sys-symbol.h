@@ -91,6 +91,16 @@
     SERIES_FLAG_26
 
 
+//=//// SYMBOL_FLAG_ALL_ASCII //////////////////////////////////////////////=//
+//
+// Symbols don't cache their codepoint length like other strings do, so it
+// can't be compared with the size to know if every codepoint is one byte.
+// Since symbols are immutable, this is just checked once when interned.
+//
+#define SYMBOL_FLAG_ALL_ASCII \
+    SERIES_FLAG_27
+
+
 inline static option(SymId) ID_OF_SYMBOL(Symbol(const*) s)
   { return cast(SymId, SECOND_UINT16(s->info)); }
 
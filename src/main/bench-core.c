@@ -0,0 +1,320 @@
+//
+//  File: %bench-core.c
+//  Summary: "Microbenchmarks of core data structures, called directly from C"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// This is the main() of a separate executable, built with `make.r` as the
+// `bench` target:
+//
+//     r3 make.r config=... target=bench
+//     ./r3-bench
+//
+// Unlike %tests/bench/, which time Rebol code (and so mostly the evaluator),
+// this links libr3-core and calls internals like Alloc_Pooled(), the word
+// interning, Hash_Value(), Find_Key_Hashed(), Find_Binstr_In_Binstr(), and
+// Expand_Series() directly in loops.  So a change to the memory pools or
+// hashing can be judged by itself.
+//
+// Inputs come from a fixed-seed generator (and RANDOM/SEED for the ones that
+// are made with Rebol code), so every run measures the same work.  Each
+// benchmark is timed BENCH_SAMPLES times, and the median and fastest times
+// per operation are printed, one benchmark per line.
+//
+// The interpreter is started, but no evaluation happens during timing, so
+// there is no GC running in the middle of a measurement.
+//
+
+#include "sys-core.h"
+
+#include <time.h>  // clock_gettime(), or clock() on Windows
+
+
+#define BENCH_SAMPLES 7
+
+
+static uint64_t Bench_Seed = 0x9E3779B97F4A7C15;
+
+static uint32_t Bench_Random(void)  // xorshift64*, reproducible everywhere
+{
+    Bench_Seed ^= Bench_Seed >> 12;
+    Bench_Seed ^= Bench_Seed << 25;
+    Bench_Seed ^= Bench_Seed >> 27;
+    return cast(uint32_t, (Bench_Seed * 0x2545F4914F6CDD1D) >> 32);
+}
+
+static double Bench_Seconds(void)
+{
+  #if TO_WINDOWS
+    return cast(double, clock()) / CLOCKS_PER_SEC;  // coarse, no windows.h
+  #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1.0e9;
+  #endif
+}
+
+static int Compare_Doubles(const void *a, const void *b)
+{
+    double x = *cast(const double*, a);
+    double y = *cast(const double*, b);
+    return (x > y) - (x < y);
+}
+
+
+// Run the benchmark BENCH_SAMPLES times and print nanoseconds per operation.
+// The function returns how many operations it did (the same for each run).
+//
+static void Run_Bench(const char *name, REBLEN (*bench)(void))
+{
+    bench();  // warm up
+
+    double ns[BENCH_SAMPLES];
+    int i;
+    for (i = 0; i < BENCH_SAMPLES; ++i) {
+        double start = Bench_Seconds();
+        REBLEN ops = bench();
+        ns[i] = (Bench_Seconds() - start) * 1.0e9 / ops;
+    }
+
+    qsort(ns, BENCH_SAMPLES, sizeof(double), &Compare_Doubles);
+    printf(
+        "%-28s %10.2f ns/op median %10.2f ns/op min\n",
+        name, ns[BENCH_SAMPLES / 2], ns[0]
+    );
+    fflush(stdout);
+}
+
+
+//=//// INPUTS ////////////////////////////////////////////////////////////=//
+
+#define NUM_SPELLINGS 10000
+#define NUM_KEYS 10000
+#define HAYSTACK_SIZE (1024 * 1024)
+
+static char *Spellings;  // NUM_SPELLINGS words, each NUL terminated
+static Size Spelling_Sizes[NUM_SPELLINGS];
+
+static REBVAL *Keys;  // BLOCK! of INTEGER! and TEXT!
+static REBVAL *Key_Map;  // MAP! with all of Keys
+static REBVAL *Haystack;  // TEXT! of random lowercase letters
+static REBVAL *Needle;  // TEXT! not in Haystack (if case-sensitive)
+
+static void Make_Inputs(void)
+{
+    Spellings = rebAllocN(char, NUM_SPELLINGS * 16);
+    char *cp = Spellings;
+    REBLEN i;
+    for (i = 0; i < NUM_SPELLINGS; ++i) {
+        Size size = 3 + Bench_Random() % 12;
+        Spelling_Sizes[i] = size;
+        Size n;
+        for (n = 0; n < size; ++n)
+            *cp++ = 'a' + Bench_Random() % 26;
+        *cp++ = '\0';
+        cp += 15 - size;
+    }
+
+    rebElide("random/seed 1020");
+    Keys = rebValue(
+        "collect [repeat", rebI(NUM_KEYS / 2), "[",
+            "keep random 1000000",
+            "keep form random 1000000",
+        "]]"
+    );
+    Key_Map = rebValue(
+        "let m: make map! length of", Keys,
+        "for-each k", Keys, "[m.(k): true]",
+        "m"
+    );
+
+    char *hay = rebAllocN(char, HAYSTACK_SIZE + 1);
+    for (i = 0; i < HAYSTACK_SIZE; ++i)
+        hay[i] = 'a' + Bench_Random() % 26;
+    hay[HAYSTACK_SIZE] = '\0';
+    Haystack = rebText(hay);
+    rebFree(hay);
+
+    Needle = rebText("abcdEfgh");  // uppercase never matches if cased
+}
+
+static void Free_Inputs(void)
+{
+    rebFree(Spellings);
+    rebRelease(Keys);
+    rebRelease(Key_Map);
+    rebRelease(Haystack);
+    rebRelease(Needle);
+}
+
+
+//=//// BENCHMARKS ////////////////////////////////////////////////////////=//
+
+static REBLEN Bench_Pool_Alloc_Free(void)
+{
+    PoolID pool_id = Pool_Id_For_Size(4 * sizeof(Cell));
+    void *units[1000];
+
+    REBLEN round;
+    for (round = 0; round < 1000; ++round) {
+        REBLEN i;
+        for (i = 0; i < 1000; ++i)
+            units[i] = Alloc_Pooled(pool_id);
+        for (i = 0; i < 1000; ++i)
+            Free_Pooled(pool_id, units[1000 - 1 - i]);
+    }
+    return 1000 * 1000;
+}
+
+static REBLEN Bench_Intern_Existing(void)
+{
+    REBLEN round;
+    for (round = 0; round < 100; ++round) {
+        const char *cp = Spellings;
+        REBLEN i;
+        for (i = 0; i < NUM_SPELLINGS; ++i, cp += 16)
+            Intern_UTF8_Managed(cb_cast(cp), Spelling_Sizes[i]);
+    }
+    return 100 * NUM_SPELLINGS;
+}
+
+static REBLEN Bench_Hash_Value(void)
+{
+    Cell(const*) tail;
+    Cell(const*) head = VAL_ARRAY_AT(&tail, Keys);
+    uint32_t sum = 0;
+
+    REBLEN round;
+    for (round = 0; round < 100; ++round) {
+        Cell(const*) item;
+        for (item = head; item != tail; ++item)
+            sum += Hash_Value(item);
+    }
+    if (sum == 0)
+        printf("(hash sum was zero)\n");  // keep the loop from being elided
+    return 100 * NUM_KEYS;
+}
+
+static REBLEN Bench_Find_Key_Hashed(void)
+{
+    REBMAP *map = m_cast(REBMAP*, VAL_MAP(Key_Map));  // mode 1 won't modify
+    Array(*) pairlist = MAP_PAIRLIST(map);
+    REBSER *hashlist = MAP_HASHLIST(map);
+
+    Cell(const*) tail;
+    Cell(const*) head = VAL_ARRAY_AT(&tail, Keys);
+
+    REBLEN round;
+    for (round = 0; round < 100; ++round) {
+        Cell(const*) item;
+        for (item = head; item != tail; ++item) {
+            REBINT n = Find_Key_Hashed(
+                pairlist, hashlist, item, SPECIFIED, 2, false, 1
+            );
+            assert(n >= 0);
+            UNUSED(n);
+        }
+    }
+    return 100 * NUM_KEYS;
+}
+
+static REBLEN Bench_Find_Binstr_Cased(void)
+{
+    REBLEN round;
+    for (round = 0; round < 10; ++round) {
+        REBLEN len;
+        REBINT n = Find_Binstr_In_Binstr(
+            &len, Haystack, VAL_LEN_HEAD(Haystack),
+            Needle, VAL_LEN_AT(Needle),
+            AM_FIND_CASE,
+            1
+        );
+        assert(n == NOT_FOUND);
+        UNUSED(n);
+    }
+    return 10 * HAYSTACK_SIZE;  // per byte scanned
+}
+
+static REBLEN Bench_Find_Binstr_Caseless(void)
+{
+    REBLEN round;
+    for (round = 0; round < 10; ++round) {
+        REBLEN len;
+        REBINT n = Find_Binstr_In_Binstr(
+            &len, Haystack, VAL_LEN_HEAD(Haystack),
+            Needle, VAL_LEN_AT(Needle),
+            0,  // caseless
+            1
+        );
+        UNUSED(n);  // random letters may contain "abcdefgh", ignore
+    }
+    return 10 * HAYSTACK_SIZE;
+}
+
+static REBLEN Bench_Expand_Series_Tail(void)
+{
+    REBLEN round;
+    for (round = 0; round < 10; ++round) {
+        Binary(*) bin = Make_Binary(0);
+        REBLEN i;
+        for (i = 0; i < HAYSTACK_SIZE / 16; ++i) {
+            Expand_Series(bin, BIN_LEN(bin), 16);
+            TERM_BIN(bin);
+        }
+        Free_Unmanaged_Series(bin);
+    }
+    return 10 * (HAYSTACK_SIZE / 16);
+}
+
+static REBLEN Bench_Expand_Series_Head(void)
+{
+    REBLEN round;
+    for (round = 0; round < 10; ++round) {
+        Binary(*) bin = Make_Binary(0);
+        REBLEN i;
+        for (i = 0; i < 10000; ++i) {
+            Expand_Series(bin, 0, 16);  // can use the series' bias
+            TERM_BIN(bin);
+        }
+        Free_Unmanaged_Series(bin);
+    }
+    return 10 * 10000;
+}
+
+
+int main(int argc, char **argv)
+{
+    UNUSED(argc);
+    UNUSED(argv);
+
+    rebStartup();
+    Make_Inputs();
+
+    Run_Bench("pool: alloc and free", &Bench_Pool_Alloc_Free);
+    Run_Bench("intern: existing words", &Bench_Intern_Existing);
+    Run_Bench("hash: Hash_Value()", &Bench_Hash_Value);
+    Run_Bench("map: Find_Key_Hashed()", &Bench_Find_Key_Hashed);
+    Run_Bench("find: 1MB text, cased", &Bench_Find_Binstr_Cased);
+    Run_Bench("find: 1MB text, caseless", &Bench_Find_Binstr_Caseless);
+    Run_Bench("expand: at tail", &Bench_Expand_Series_Tail);
+    Run_Bench("expand: at head", &Bench_Expand_Series_Head);
+
+    Free_Inputs();
+    rebShutdown(true);
+    return 0;
+}
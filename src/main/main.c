@@ -43,6 +43,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <time.h>  // clock() for timing MAIN-STARTUP
 
 #if TO_WINDOWS
     #undef _WIN32_WINNT  // https://forum.rebol.info/t/326/4
@@ -255,6 +256,8 @@ int main(int argc, char *argv_ansi[])
     // means we get back a usermode function that is ready to process the
     // command line arguments.
     //
+    clock_t startup_start = clock();
+
     REBVAL *main_startup = rebValue(
         "ensure action! do transcode/where", rebR(startup_bin), "lib"
     );
@@ -276,6 +279,22 @@ int main(int argc, char *argv_ansi[])
     REBVAL *code = rebValue("unquote @", trapped);  // entrap quotes non-errors
     rebRelease(trapped);  // don't need the outer block any more
 
+    // The core's Startup_Core() phases and each LOAD-EXTENSION have their
+    // times in SYSTEM.STATE.STARTUP-TIMINGS already.  Add MAIN-STARTUP's
+    // (which includes the extension loading), and show them all if asked.
+    //
+    double startup_secs
+        = cast(double, clock() - startup_start) / CLOCKS_PER_SEC;
+    rebElide(
+        "append system.state.startup-timings 'main-startup",
+        "append system.state.startup-timings", rebR(rebDecimal(startup_secs)),
+        "if system.options.startup-profile [",
+            "for-each [phase secs] system.state.startup-timings [",
+                "print [phase (round/to (secs * 1000) 0.01) {ms}]",
+            "]",
+        "]"
+    );
+
     // !!! For the moment, the CONSOLE extension does all the work of running
     // usermode code or interpreting exit codes.  This requires significant
     // logic which is reused by the debugger, which ranges from the managing
@@ -40,10 +40,15 @@ REBOL [
     %mezz-files.r
     %mezz-shell.r
     %mezz-math.r
-    %mezz-help.r  ; depends on DUMP-OBJ in %mezz-dump.r
     %mezz-colors.r
     %mezz-legacy.r
 
     %uparse.r  ; migrated to mezzanine, will someday have native portions
     %uparse-extras.r  ; e.g. DESTRUCTURE
 ]
+
+; lib (lazy): only FUNC/FUNCTION/LAMBDA definitions, run on first call
+; (see DEFINE-LAZY in %sys-base.r)
+[
+    %mezz-help.r  ; depends on DUMP-OBJ in %mezz-dump.r
+]
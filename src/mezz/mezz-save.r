@@ -117,6 +117,19 @@ save: function [
         header: body-of header
     ]
 
+    ; With no header to checksum or length-prefix, a file can be written as
+    ; the mold is produced, instead of building the whole script in memory.
+    ;
+    all [file? where, not header] then [
+        let port: open/write/new where
+        either all_SAVE [mold/all/only/stream :value port] [
+            mold/only/stream :value port
+        ]
+        write port newline
+        close port
+        return port
+    ]
+
     ; !!! Maybe /all should be the default?  See #2159
     data: either all_SAVE [mold/all/only :value] [
         mold/only :value
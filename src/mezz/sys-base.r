@@ -261,3 +261,143 @@ do*: func [
     ;
     return unmeta [_ @]: import*/args/only null source args only
 ]
+
+
+define-lazy: func [
+    {Define stubs for `name: func [...] [...]` code, that run it on first call}
+
+    return: <none>
+    code "Top-level definitions, already bound (ends in ~done~)"
+        [block!]
+    <local> loaded forward pos
+][
+    ; Mezzanine sections like %mezz-help.r are big, and most scripts never
+    ; call anything in them.  So instead of running them at boot, each name
+    ; gets a stub with the same interface.  Calling any stub runs the
+    ; whole section once (which overwrites the stubs with the real
+    ; functions), then passes its arguments on to the real function.
+    ;
+    ; The stub is made by the same generator from the same spec, so it
+    ; gathers arguments the same way and has the same RETURN: type.  FORWARD
+    ; is a LAMBDA so that whatever the real function returns passes through.
+    ;
+    loaded: false
+
+    forward: lambda [stub [frame!] name [word!]] [
+        if not loaded [
+            loaded: true
+            if not equal? '~done~ do code [fail {lazy definitions}]
+        ]
+        let f: make frame! unrun get name
+        for-each key f [
+            if key = 'return [continue]  ; stub's RETURN isn't the real one
+            let word: in stub key
+            if word [set/any (in f key) get/any word]
+        ]
+        do f
+    ]
+
+    pos: code
+    while [set-word? pos.1] [
+        if not all [
+            find [func function] pos.2
+            block? pos.3
+            block? pos.4
+        ][
+            fail [{Lazy definitions must be FUNC or FUNCTION:} pos.1]
+        ]
+        let body: compose [
+            return (unrun :forward) binding of 'return (quote as word! pos.1)
+        ]
+        set pos.1 either pos.2 = 'func [
+            func (copy pos.3) body
+        ][
+            function (copy pos.3) body
+        ]
+        pos: skip pos 4
+    ]
+    if pos.1 <> '~done~ [
+        fail [{Unexpected item in lazy definitions:} mold pos.1]
+    ]
+]
+
+
+lazy-extension: func [
+    {Export stubs for a builtin extension, that load it on first call}
+
+    return: "false if the extension isn't marked lazy, or can't be stubbed"
+        [logic!]
+    script "Decompressed extension script (see LOAD-EXTENSION/LAZY)"
+        [binary! text!]
+    collation "Extension details from BUILTIN-EXTENSIONS"
+        [block!]
+    <local> hdr code defs exports module forward pos
+][
+    ; Extensions like Crypt do costly work in STARTUP* (seeding a random
+    ; number generator, etc.) that most runs of the interpreter never need.
+    ; If the header has `Options: [lazy]`, then instead of running the script
+    ; each exported name gets a stub with the same interface, as DEFINE-LAZY
+    ; does for mezzanine sections.  Calling a stub loads the extension (which
+    ; overwrites the stubs in lib) and passes its arguments on.
+    ;
+    ; Only the script is scanned to make the stubs, nothing in it is run.  So
+    ; the init code of a lazy extension must do nothing but define things.
+    ; Every export has to be a NATIVE, FUNC, FUNCTION or LAMBDA with a literal
+    ; spec block, or the extension is just loaded up front.
+    ;
+    [hdr code]: load-header script except [return false]
+    if not find maybe (select maybe hdr 'options) 'lazy [return false]
+
+    defs: copy []  ; name and spec pairs
+    exports: copy []
+
+    pos: transcode code
+    until [tail? pos] [
+        let export: did if pos.1 = 'export [pos: next pos]
+        case [
+            block? pos.1 [  ; EXPORT [word1 word2 ...]
+                if export [append exports pos.1]
+            ]
+            set-word? pos.1 [
+                if all [
+                    word? pos.2
+                    find [native func function lambda] pos.2
+                    block? pos.3
+                ][
+                    append defs spread reduce [as word! pos.1 pos.3]
+                ]
+                if export [append exports as word! pos.1]
+            ]
+        ]
+        pos: next pos
+    ]
+
+    if empty? exports [return false]  ; nothing would ever trigger a load
+    for-each name exports [
+        if not word? name [return false]
+        if not select defs name [return false]
+    ]
+
+    module: null
+
+    forward: lambda [stub [frame!] name [word!]] [
+        if not module [
+            module: load-extension collation
+        ]
+        let f: make frame! unrun get (in module name)
+        for-each key f [
+            if key = 'return [continue]  ; stub's RETURN isn't the real one
+            let word: in stub key
+            if word [set/any (in f key) get/any word]
+        ]
+        do f
+    ]
+
+    for-each name exports [
+        let body: compose [
+            return (unrun :forward) binding of 'return (quote name)
+        ]
+        append lib spread reduce [name ^(func (copy select defs name) body)]
+    ]
+    return true
+]
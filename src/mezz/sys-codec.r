@@ -130,3 +130,34 @@ encoding-of: function [
     ]
     return null
 ]
+
+
+; Binary serialization of loadable data (see %n-serialize.c).  SAVE of a file
+; with this suffix writes it, LOAD reads it back without re-scanning.
+;
+register-codec* 'rebin %.rbin
+    unrun :identify-rebin?
+    unrun :decode-rebin
+    unrun :encode-rebin
+
+
+; JSON (see %n-json.c).  Objects decode as MAP!, arrays as BLOCK!.
+;
+register-codec* 'json %.json
+    unrun :identify-json?
+    unrun :decode-json
+    unrun :encode-json
+
+
+; CSV and TSV (see %n-csv.c).  Rows decode as BLOCK!s of TEXT!, and use the
+; natives directly for /HEADER, /TYPES, /COLUMNS, or reading row by row.
+;
+register-codec* 'csv %.csv
+    unrun :identify-csv?
+    unrun :decode-csv
+    unrun :encode-csv
+
+register-codec* 'tsv %.tsv
+    unrun specialize :identify-csv? [delimiter: #"^-"]
+    unrun specialize :decode-csv [delimiter: #"^-"]
+    unrun specialize :encode-csv [delimiter: #"^-"]
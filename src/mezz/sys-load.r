@@ -389,6 +389,85 @@ adjust-url-for-raw: func [
 ]
 
 
+; If SYSTEM.OPTIONS.MODULE-CACHE is a directory, then IMPORT and DO of a FILE!
+; keep the header block and scanned body of each script there, encoded as
+; REBIN (see %n-serialize.c).  Later runs decode that instead of reading,
+; decompressing, and scanning the source again.
+;
+; An entry is keyed by the file's path, modification date, and size, as well
+; as the interpreter version...so an edit or an upgrade just misses.  The
+; file name is a CRC-32 of the key, and the key is stored in the entry and
+; checked on load in case of collisions.  Stale entries are never removed,
+; but the directory can be deleted at any time.
+;
+; !!! Blocks decoded from REBIN have no file and line information, so errors
+; raised by cached code can't say where in the source they are.
+;
+module-cache-key: func [
+    {Key for a source file's entry in the module cache, null if no caching}
+
+    return: [<opt> text!]
+    source [file!]
+][
+    if not file? system.options.module-cache [return null]
+    let info: attempt [query source] else [return null]
+    return mold reduce [source info.date info.size system.version]
+]
+
+module-cache-file: func [
+    return: [file!]
+    key [text!]
+][
+    return join system.options.module-cache as file! unspaced [
+        enbase/base (checksum-core 'crc32 key) 16, ".rbin"
+    ]
+]
+
+read-module-cache: func [
+    {Get the [key header line body] block cached for a key, if there is one}
+
+    return: [<opt> block!]
+    key [text!]
+][
+    let file: module-cache-file key
+    if not exists? file [return null]
+
+    let entry
+    if error? sys.util.rescue [entry: decode 'rebin read file] [
+        return null  ; corrupt or truncated (e.g. interrupted WRITE)
+    ]
+    all [
+        block? entry
+        4 = length of entry
+        key = entry.1
+        block? entry.2
+        integer? entry.3
+        block? entry.4
+    ] else [
+        return null
+    ]
+    return entry
+]
+
+write-module-cache: func [
+    return: <none>
+    key [text!]
+    hdr "Header block, as scanned from the source (not the OBJECT!)"
+        [block!]
+    line "Line number the body starts on"
+        [integer!]
+    body "Scanned body, not yet bound"
+        [block!]
+][
+    ; The cache is an optimization, so failing to write it (e.g. because the
+    ; directory isn't writable) shouldn't stop the import.
+    ;
+    sys.util.rescue [
+        write (module-cache-file key) encode 'rebin reduce [key hdr line body]
+    ]
+]
+
+
 ; While DO can run a script any number of times with fresh variables on each
 ; run, we don't want to IMPORT the same module more than once.  This is
 ; standard in languages like Python and JavaScript:
@@ -536,9 +615,32 @@ import*: func [
 
     let file: match [file! url!] source  ; used for file/line info during scan
 
-    let data: match [binary! text!] source else [read source]
+    let hdr
+    let code
+    let line
+
+    let cache-key: all [file? source, module-cache-key source]
+    let entry: all [cache-key, read-module-cache cache-key]
+    if entry [  ; header and body were already scanned by an earlier run
+        hdr: construct/with/only entry.2 system.standard.header
+        line: entry.3
+        code: entry.4
+    ] else [
+        let data: match [binary! text!] source else [read source]
+
+        [hdr code line]: load-header/file data file
+
+        all [
+            cache-key
+            hdr
+            not find maybe hdr.options 'content  ; would need the source data
+        ] then [
+            let hdr-block: transcode-header/file (as binary! data) file
+            code: transcode/file/line code file line
+            write-module-cache cache-key hdr-block line code
+        ]
+    ]
 
-    let [hdr code line]: load-header/file data file
     if not hdr [
         if where [  ; not just a DO
             fail ["IMPORT requires a header on:" (any [file, "<source>"])]
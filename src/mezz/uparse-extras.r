@@ -7,6 +7,7 @@ Rebol [
 
     Exports: [
         destructure
+        parse-records
     ]
 
     Description: {
@@ -44,3 +45,81 @@ destructure: func [
     ]]
     return unmeta result'
 ]
+
+
+; PARSE needs its whole input in memory as a series, so it can't be pointed
+; at a PORT! directly.  But a common case is input that is a sequence of
+; records (e.g. lines of a log), where no rule needs to backtrack across a
+; record boundary.  That can be handled by reading a chunk at a time into a
+; buffer and running the rules on each complete record, taking consumed data
+; off the head of the buffer so memory stays proportional to the longest
+; record...not the size of the file.  (Removals at the head of a series are
+; cheap, as they just bump the series "bias".)
+;
+; !!! A general streaming PARSE that could release data behind the earliest
+; live mark would need the combinators to report their marks, which they do
+; not currently do.
+;
+parse-records: func [
+    {Run PARSE rules on each delimited record of a port, read in chunks}
+
+    return: "Count of records parsed"
+        [integer!]
+    source "Opened (and closed when done) if a FILE!"
+        [port! file!]
+    rules [block!]
+    /delimiter "Ends each record, default is newline"
+        [char! text! binary!]
+    /chunk "How many bytes to READ/PART at a time (default 64K)"
+        [integer!]
+    /limit "Longest a record may be before it is an error (default 1MB)"
+        [integer!]
+    /binary "Give the rules BINARY! records instead of TEXT!"
+    <local> port buffer data pos count parse-one
+][
+    delimiter: as binary! either text? delimiter [
+        delimiter
+    ][
+        to text! any [delimiter newline]
+    ]
+    if empty? delimiter [
+        fail "PARSE-RECORDS delimiter can't be empty"
+    ]
+    chunk: default [65536]
+    limit: default [1048576]
+
+    port: either file? source [open source] [source]
+    buffer: make binary! chunk
+    count: 0
+
+    parse-one: func [record [binary!]] [
+        if limit < length of record [
+            if file? source [close port]
+            fail ["PARSE-RECORDS record longer than /LIMIT of" limit "bytes"]
+        ]
+        count: count + 1
+        parse (either binary [record] [as text! record]) rules except e -> [
+            if file? source [close port]
+            fail e
+        ]
+    ]
+
+    until [
+        data: read/part port chunk  ; NULL when no more data
+        append buffer maybe data
+        while [pos: find buffer delimiter] [
+            parse-one take/part buffer pos
+            remove/part buffer length of delimiter
+        ]
+        if limit < length of buffer [  ; don't wait for EOF to notice
+            parse-one buffer
+        ]
+        null? data
+    ]
+    if not empty? buffer [  ; last record need not have a delimiter
+        parse-one buffer
+    ]
+
+    if file? source [close port]
+    return count
+]
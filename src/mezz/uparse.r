@@ -255,6 +255,43 @@ combinator?: func [
 ]
 
 
+; PARSE*/PROFILE tallies each rule step--identified by its rules block at the
+; position of the step--into a row of the report block given:
+;
+;     [rule attempts successes backtracks seconds]
+;
+; This is the same report PARSE3*/PROFILE makes.  A backtrack is a failure
+; that throws away input matched by earlier steps in its alternate, and the
+; seconds include time spent in subrules.
+;
+tally-parse-step: func [
+    return: <none>
+    report [block!]
+    step [block!]
+    matched [logic?]
+    backtracked [logic?]
+    start [date!]
+    <local> row
+][
+    row: null
+    for-each r report [
+        if all [block? r, 5 = length of r, same? first r step] [
+            row: r
+            break
+        ]
+    ]
+    if not row [
+        append report row: reduce [step 0 0 0 0.0]
+    ]
+    row.2: row.2 + 1
+    case [
+        matched [row.3: row.3 + 1]
+        backtracked [row.4: row.4 + 1]
+    ]
+    row.5: row.5 + to decimal! difference now/precise start
+]
+
+
 ; !!! We use a MAP! here instead of an OBJECT! because if it were MAKE OBJECT!
 ; then the parse keywords would override the Rebol functions (so you couldn't
 ; use ANY inside the implementation of a combinator, because there's a
@@ -2277,7 +2314,7 @@ default-combinators: make map! reduce [
         /limit "Limit of how far to consider (used by ... recursion)"
             [block!]
         /thru "Keep trying rule until end of block"
-        <local> rules pos result' f sublimit subpending temp
+        <local> rules pos result' f sublimit subpending temp step start
     ][
         rules: value  ; alias for clarity
         limit: default [tail of rules]
@@ -2348,6 +2385,7 @@ default-combinators: make map! reduce [
             ; Do one "Parse Step".  This involves turning whatever is at the
             ; next parse position into an ACTION!, then running it.
             ;
+            step: rules  ; for PARSE*/PROFILE
             if rules.1 = '... [  ; "variadic" parser, use recursion
                 rules: next rules
                 if tail? rules [  ; if at end, act like [elide to <end>]
@@ -2369,7 +2407,15 @@ default-combinators: make map! reduce [
 
             f.input: pos
 
-            if not error? temp: entrap f [
+            if state.profile [start: now/precise]
+            temp: entrap f
+            if state.profile [
+                tally-parse-step state.profile step (not error? temp) (
+                    (index of pos) > (index of input)  ; alternate matched some
+                ) start
+            ]
+
+            if not error? temp [
                 [^temp pos subpending]: unmeta temp
                 if unset? 'pos [
                     print mold/limit rules 200
@@ -2461,6 +2507,21 @@ default-combinators: make map! reduce [
 default-combinators.(tuple!): default-combinators.(word!)
 
 
+=== NATIVE LEAF COMBINATORS ===
+
+; Combinators that don't call other parsers spend most of their time in the
+; overhead of being usermode functions, so there are native versions of the
+; common ones in %c-combinator.c.  The usermode definitions are left above,
+; both as documentation and so they can be swapped back in for testing.
+;
+; !!! Combinators that take parsers (BLOCK!, TO, THRU, SOME...) need to run
+; their parsers as continuations and handle raised errors coming back.  The
+; natives for SOME and FURTHER predate that, so aren't used here yet.
+
+default-combinators.(text!): unrun :text!-combinator
+default-combinators.(bitset!): unrun :bitset!-combinator
+
+
 === COMPATIBILITY FOR NON-TAG KEYWORD FORMS ===
 
 ; !!! This has been deprecated.  But it's currently possible to get this
@@ -2823,6 +2884,8 @@ parse*: func [
         [integer! any-series!]
 
     /verbose "Print some additional debug information"
+    /profile "Add [rule attempts successes backtracks seconds] rows"
+        [block!]
 
     <local> loops furthest synthesized' remainder
 ][
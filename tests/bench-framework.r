@@ -0,0 +1,232 @@
+Rebol [
+    Title: "Benchmark Framework"
+    File: %bench-framework.r
+    Type: module
+    Name: Bench-Framework
+    Copyright: [
+        2023 "Ren-C Open Source Contributors"
+    ]
+    License: {
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+    }
+    Description: {
+        Runs the benchmarks in a %xxx.bench.reb file, which is a series of
+        TEXT! names each followed by a BLOCK! of code to time.  GROUP!s at
+        the top level are run once as setup, when they are reached.  All the
+        code in a file shares one isolated module, so setup can define things
+        for the benchmarks after it.
+
+        Each benchmark is run once to warm up, then timed SAMPLES times.  The
+        median is reported along with the mean, variance, and fastest sample,
+        so noisy runs are visible.  Results can be written as JSON, and
+        compared to a JSON file from an earlier run to flag regressions.
+    }
+]
+
+
+bench-samples: 7  ; odd, so the median is one of the samples
+
+
+median-of: func [
+    return: [decimal!]
+    samples [block!] "DECIMAL! seconds"
+][
+    let sorted: sort copy samples
+    let n: length of sorted
+    let mid: to integer! round/down ((n + 1) / 2)
+    if odd? n [return sorted.(mid)]
+    return (sorted.(mid) + sorted.(mid + 1)) / 2
+]
+
+mean-of: func [
+    return: [decimal!]
+    samples [block!]
+][
+    let sum: 0.0
+    for-each s samples [sum: sum + s]
+    return sum / length of samples
+]
+
+variance-of: func [
+    {Sample variance (divides by N - 1)}
+    return: [decimal!]
+    samples [block!]
+][
+    if 2 > length of samples [return 0.0]
+    let mean: mean-of samples
+    let sum: 0.0
+    for-each s samples [sum: sum + ((s - mean) * (s - mean))]
+    return sum / ((length of samples) - 1)
+]
+
+
+export run-benchmarks: func [
+    {Run a benchmark file, printing results, and return them as a BLOCK!}
+
+    return: "OBJECT!s with NAME, MEDIAN, MEAN, VARIANCE, MIN, and SAMPLES"
+        [block!]
+    file [file!]
+    /samples "How many timed runs of each benchmark (default 7)"
+        [integer!]
+][
+    samples: default [bench-samples]
+
+    let code: load file
+    let isolate: module null []
+    intern* isolate code
+
+    print ["=== Running Benchmarks in" mold file "==="]
+
+    let results: copy []
+    let pos: code
+    while [not tail? pos] [
+        if group? pos.1 [
+            do as block! pos.1
+            pos: next pos
+            continue
+        ]
+        if not all [text? pos.1, block? pos.2] [
+            fail ["Benchmark file expects TEXT! BLOCK! or GROUP! at" mold pos]
+        ]
+        let name: pos.1
+        let body: pos.2
+        pos: skip pos 2
+
+        do body  ; warm up (caches, lazy initialization, GC state)
+
+        let times: collect [
+            repeat samples [
+                keep (delta-nanoseconds body) / 1'000'000'000  ; wall clock may jump
+            ]
+        ]
+        let result: make object! compose [
+            name: (name)
+            median: (median-of times)
+            mean: (mean-of times)
+            variance: (variance-of times)
+            min: (first sort copy times)
+            samples: (samples)
+        ]
+        print [
+            name ":" result.median "sec median,"
+            result.variance "variance"
+        ]
+        append results result
+    ]
+
+    return results
+]
+
+
+json-string: func [
+    return: [text!]
+    text [text!]
+][
+    let escaped: copy text
+    replace/all escaped "\" "\\"
+    replace/all escaped {"} {\"}
+    return unspaced [{"} escaped {"}]
+]
+
+export write-bench-json: func [
+    {Write results from RUN-BENCHMARKS as JSON}
+
+    return: <none>
+    file [file!]
+    results [block!]
+][
+    ; One benchmark per line, so diffs between runs are easy to read (and so
+    ; READ-BENCH-JSON can get them back without a general JSON parser).
+    ;
+    let lines: collect [
+        for-each r results [
+            keep unspaced [
+                "    {"
+                {"name": } json-string r.name ", "
+                {"median": } r.median ", "
+                {"mean": } r.mean ", "
+                {"variance": } r.variance ", "
+                {"min": } r.min ", "
+                {"samples": } r.samples
+                "}"
+            ]
+        ]
+    ]
+
+    write file unspaced [
+        "{" newline
+        {  "interpreter": } json-string mold system.version "," newline
+        {  "benchmarks": [} newline
+        delimit unspaced ["," newline] lines newline
+        "  ]" newline
+        "}" newline
+    ]
+]
+
+export read-bench-json: func [
+    {Read the name and median of each benchmark in a WRITE-BENCH-JSON file}
+
+    return: "Alternating TEXT! name and DECIMAL! median"
+        [block!]
+    file [file!]
+    <local> name median
+][
+    return collect [
+        for-each line split read/string file newline [
+            parse3 line [
+                thru {"name": "} copy name to {"}
+                thru {"median": } copy median to ","
+                to <end>
+            ] then [
+                replace/all name {\"} {"}
+                replace/all name "\\" "\"
+                keep name
+                keep to decimal! median
+            ]
+        ]
+    ]
+]
+
+export compare-benchmarks: func [
+    {Print how RESULTS compare to a baseline, flagging regressions}
+
+    return: "Number of regressions"
+        [integer!]
+    results [block!] "from RUN-BENCHMARKS"
+    baseline [block!] "from READ-BENCH-JSON"
+    /tolerance "Ratio of slowdown to tolerate (default 0.10, e.g. 10%)"
+        [decimal!]
+][
+    tolerance: default [0.10]
+
+    print "=== Comparison to Baseline ==="
+
+    let regressions: 0
+    for-each r results [
+        let old: select baseline r.name
+        if not old [
+            print [r.name ": new benchmark, no baseline"]
+            continue
+        ]
+        let ratio: r.median / old
+        let verdict: case [
+            ratio > (1 + tolerance) [
+                regressions: regressions + 1
+                "REGRESSION"
+            ]
+            ratio < (1 - tolerance) ["faster"]
+            true ["same"]
+        ]
+        print [
+            r.name ":" old "->" r.median "sec"
+            unspaced ["(" round/to (ratio * 100) 0.1 "%)"] verdict
+        ]
+    ]
+
+    print [regressions "regression(s) beyond" tolerance * 100 "% tolerance"]
+    return regressions
+]
@@ -115,9 +115,13 @@
 
 %convert/as-binary.test.reb
 %convert/as-string.test.reb
+%convert/enbase.test.reb
 %convert/enbin.test.reb
 %convert/encode.test.reb
 %convert/mold.test.reb
+%convert/rebin.test.reb
+%convert/json.test.reb
+%convert/csv.test.reb
 %convert/to.test.reb
 
 %define/func.test.reb
@@ -145,6 +149,7 @@
 %functions/let.test.reb
 %functions/literal.test.reb
 %functions/macro.test.reb
+%functions/memoize.test.reb
 %functions/multi.test.reb
 %functions/native.test.reb
 %functions/oneshot.test.reb
@@ -195,6 +200,7 @@
 %math/negativeq.test.reb
 %math/not.test.reb
 %math/oddq.test.reb
+%math/packed.test.reb
 %math/positiveq.test.reb
 %math/power.test.reb
 %math/random.test.reb
@@ -205,10 +211,12 @@
 %math/sine.test.reb
 %math/square-root.test.reb
 %math/subtract.test.reb
+%math/sum.test.reb
 %math/tangent.test.reb
 %math/zeroq.test.reb
 
 %network/http.test.reb
+%network/http-server.test.reb
 
 %parse/parse3.test.reb
 %parse/parse3-collect.test.reb
@@ -306,9 +314,12 @@
 %series/find.test.reb
 %series/free.test.reb
 %series/glom.test.reb
+%series/group-by.test.reb
+%series/heap.test.reb
 %series/indexq.test.reb
 %series/insert.test.reb
 %series/intersect.test.reb
+%series/join-by.test.reb
 %series/just.test.reb
 %series/join.test.reb
 %series/last.test.reb
@@ -336,6 +347,8 @@
 %string/encode.test.reb
 %string/decompress.test.reb
 %string/dehex.test.reb
+%string/detab.test.reb
+%string/case.test.reb
 %string/transcode.test.reb
 %string/utf8.test.reb
 
@@ -15,10 +15,17 @@ Rebol [
     Description: {
         This script will either run a single file of tests, or if given a
         directory run all the tests in that directory.
+
+        Given a %xxx.bench.reb file it runs benchmarks instead (see the
+        %bench-framework.r).  Options after the file are:
+
+            --json %results.json  ; write results as JSON
+            --compare %baseline.json  ; flag regressions vs. an earlier run
     }
 ]
 
 import %test-framework.r
+import %bench-framework.r
 
 
 === SET UP FLAGS FOR WHICH TESTS TO RUN ===
@@ -65,6 +72,39 @@ run-tests: func [
 ]
 
 
+=== BENCHMARK RUNNER FUNCTION ===
+
+run-bench: func [
+    return: <none>
+    file [file!]
+    options [block!] "TEXT! command line arguments after the file"
+    <local> json-file baseline-file
+][
+    while [not tail? options] [
+        switch options.1 [
+            "--json" [json-file: local-to-file options.2]
+            "--compare" [baseline-file: local-to-file options.2]
+        ] else [
+            fail ["Unknown benchmark option:" options.1]
+        ]
+        options: skip options 2
+    ]
+
+    let results: run-benchmarks file
+    print newline
+
+    if json-file [
+        write-bench-json json-file results
+        print ["=== JSON results ===" newline mold json-file newline]
+    ]
+
+    if baseline-file [
+        let regressions: compare-benchmarks results read-bench-json baseline-file
+        if regressions > 0 [quit/with 1]  ; so scripts can check the exit status
+    ]
+]
+
+
 === RUN TESTS SPECIFIED BY COMMAND LINE (SINGLE FILE OR DIRECTORY) ===
 
 print newline
@@ -75,12 +115,18 @@ if first system.options.args [
     tests: %core-tests.r
 ]
 
-if dir? tests [
-    tests: dirize tests
-    change-dir tests
-    for-each file read tests [
-        if %.test.reb = find-last file %.t [run-tests file]
+case [
+    %.bench.reb = find-last tests %.b [
+        run-bench tests next system.options.args
+    ]
+    dir? tests [
+        tests: dirize tests
+        change-dir tests
+        for-each file read tests [
+            if %.test.reb = find-last file %.t [run-tests file]
+        ]
+    ]
+    true [
+        run-tests tests
     ]
-] else [
-    run-tests tests
 ]
@@ -37,6 +37,7 @@ core: [
     functionals/c-hijack.c
     functionals/c-lambda.c
     functionals/c-macro.c
+    functionals/c-memoize.c
     functionals/c-native.c
     functionals/c-oneshot.c
     functionals/c-reframer.c
@@ -95,6 +96,7 @@ core: [
     d-eval.c
     d-gc.c
     d-print.c
+    d-profile.c
     d-stack.c
     d-stats.c
     d-test.c
@@ -164,14 +166,20 @@ core: [
 
     ; (N)atives
     n-control.c
+    n-csv.c
     n-data.c
     n-do.c
     n-error.c
+    n-heap.c
     n-io.c
+    n-json.c
     n-loop.c
     n-math.c
+    n-packed.c
     n-protect.c
+    n-records.c
     n-reduce.c
+    n-serialize.c
     n-sets.c
     n-strings.c
     n-system.c
@@ -183,6 +191,7 @@ core: [
     s-make.c
     s-mold.c
     s-ops.c
+    s-utf8.c
 
     ; (T)ypes
     t-binary.c
@@ -213,6 +222,7 @@ core: [
 
     ; (U)??? (3rd-party code extractions)
     u-compress.c
+    u-lz4.c
     u-parse.c
     [
         u-zlib.c
@@ -248,6 +258,8 @@ made: [
 
 main: 'main.c
 
+bench: 'bench-core.c  ; C microbenchmarks, see `target=bench` in %make.r
+
 boot-files: [
     version.r
 ]
@@ -520,6 +520,37 @@ for-each-datatype t [
     e-types/emit newline
 ]
 
+
+; %verb-hooks.r lists verbs that some classes of type handle with a direct C
+; function, instead of through the switch() in their REBTYPE().  Each verb
+; gets an index into the rows of Builtin_Verb_Hooks (made below).
+
+verb-hooks: load %verb-hooks.r
+verb-hook-names: collect [
+    for-each [class verbs] verb-hooks [
+        for-each [verb handler] verbs [keep verb]
+    ]
+]
+verb-hook-names: unique verb-hook-names
+
+verb-hook-enums: collect [
+    for-each name verb-hook-names [
+        keep cscape/with {VERB_HOOK_${NAME}} 'name
+    ]
+]
+
+e-types/emit [verb-hook-enums] {
+    /*
+     * VERBS WITH DIRECT HANDLERS FOR SOME TYPES (see %verb-hooks.r)
+     */
+    enum Reb_Verb_Hook {
+        VERB_HOOK_0,  /* verb has no direct handlers, use the REBTYPE() */
+        $(Verb-Hook-Enums),
+        VERB_HOOK_MAX
+    };
+}
+e-types/emit newline
+
 e-types/write-emitted
 
 
@@ -585,6 +616,49 @@ e-hooks/emit 'hook-list {
     };
 }
 
+
+verb-hook-syms: collect [
+    for-each name verb-hook-names [
+        keep cscape/with {SYM_${NAME}} 'name
+    ]
+]
+
+verb-hook-list: collect [
+    voids: collect [for-each name verb-hook-names [keep "nullptr"]]
+    keep cscape/with {
+        {  /* VOID = 0 */
+            nullptr,  /* VERB_HOOK_0 */
+            $(Voids),
+        }} [voids]
+
+    for-each-datatype t [
+        handlers: collect [
+            for-each name verb-hook-names [
+                verbs: select verb-hooks t/class
+                handler: all [verbs, select verbs name]
+                keep either handler [unspaced ["&" handler]] ["nullptr"]
+            ]
+        ]
+        keep cscape/with {
+            {  /* $<T/NAME> = $<T/HEART> */
+                nullptr,  /* VERB_HOOK_0 */
+                $(Handlers),
+            }} [t handlers]
+    ]
+]
+
+e-hooks/emit [verb-hook-syms verb-hook-list] {
+    /* Indexed by enum Reb_Verb_Hook, see %verb-hooks.r */
+    const SymId Verb_Hook_Syms[VERB_HOOK_MAX] = {
+        SYM_0,
+        $(Verb-Hook-Syms),
+    };
+
+    GENERIC_HOOK* const Builtin_Verb_Hooks[REB_MAX][VERB_HOOK_MAX] = {
+        $(Verb-Hook-List),
+    };
+}
+
 e-hooks/write-emitted
 
 
@@ -901,11 +975,11 @@ e-errfuncs/write-emitted
 ; made involved LOAD-ing the objects.  While we could rewrite that not to do
 ; a LOAD as well, keep it how it was for the moment.
 
-mezz-files: load %../mezz/boot-files.r  ; base, sys, mezz
+mezz-files: load %../mezz/boot-files.r  ; base, sys, mezz, lazy mezz
 
 sys-toplevel: copy []
 
-for-each section [boot-base boot-system-util boot-mezz] [
+for-each section [boot-base boot-system-util boot-mezz boot-mezz-lazy] [
     set section s: make text! 20000
     append/line s "["
     for-each file first mezz-files [  ; doesn't use LOAD to strip
@@ -958,6 +1032,7 @@ sections: [
     :boot-base
     :boot-system-util
     :boot-mezz
+    :boot-mezz-lazy
 ]
 
 nats: collect [
@@ -1027,8 +1102,19 @@ write-if-changed (join prep-dir %boot/tmp-boot-block.r) boot-molded
 data: as binary! boot-molded
 
 compressed: gzip data
+terminated: append copy data #{00}  ; scanner wants a '\0' at the end
 
 e-bootblock/emit 'compressed {
+  #if BOOT_BLOCK_UNCOMPRESSED
+    /*
+     * Boot block as plain UTF-8, so startup can scan it in place
+     * (gzip compression would be $<length of compressed> bytes)
+     */
+    const REBLEN Boot_Block_Size = $<length of data>;
+    const Byte Boot_Block_Uncompressed[$<length of terminated>] = {
+        $<Binary-To-C Terminated>
+    };
+  #else
     /*
      * Gzip compression of boot block
      * Originally $<length of data> bytes
@@ -1040,6 +1126,7 @@ e-bootblock/emit 'compressed {
     const Byte Boot_Block_Compressed[$<length of compressed>] = {
         $<Binary-To-C Compressed>
     };
+  #endif
 }
 
 e-bootblock/write-emitted
@@ -1073,6 +1160,12 @@ e-boot/emit 'fields {
     EXTERN_C const REBLEN Boot_Block_Compressed_Size;
     EXTERN_C const Byte Boot_Block_Compressed[];
 
+    /*
+     * Uncompressed boot block, if built with BOOT_BLOCK_UNCOMPRESSED.
+     */
+    EXTERN_C const REBLEN Boot_Block_Size;
+    EXTERN_C const Byte Boot_Block_Uncompressed[];
+
     /*
      * Raw C function pointers for natives, take Frame(*) and return REBVAL*.
      */
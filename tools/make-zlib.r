@@ -351,6 +351,17 @@ source-lines: copy []
 
 append source-lines spread read/lines (join path-zlib %crc32.c)
 
+;
+; Ren-C supplies its own crc32_z() in %s-crc.c, which uses CRC32 instructions
+; when the CPU has them.  ZLIB's is renamed to be the portable fallback, so
+; the CRCs that deflate and inflate do for gzip get the hardware path too.
+;
+for-each line source-lines [
+    replace line "unsigned long ZEXPORT crc32_z(" (
+        "unsigned long ZEXPORT crc32_z_portable("
+    )
+]
+
 ;
 ; Macros DO1 and DO8 are defined differently in crc32.c, and if you don't
 ; #undef them you'll get a redefinition warning.
@@ -389,6 +400,7 @@ insert source-lines spread [
     {}
     {#include "sys-zlib.h"  /* REBOL: see make-zlib.r */}
     {#define local static}
+    {unsigned long ZEXPORT crc32_z_portable(unsigned long, const unsigned char FAR *, z_size_t);  /* REBOL: see make-zlib.r */}
     {}
 ]
 